@@ -3,8 +3,8 @@
 
 #include "arm7tdmi.h"
 
-arm7tdmi::arm7tdmi(struct bus *bus, bool gdbserver, bool gdbstart, bool bigendian)
-: mmu(bus, gdbserver, gdbstart, bigendian)
+arm7tdmi::arm7tdmi(struct bus *bus, bool gdbserver, bool gdbstart, bool bigendian, int gdbport)
+: mmu(bus, gdbserver, gdbstart, bigendian, gdbport)
 {
     // configure the ARM
     m_DeviceId = 0x41007700;
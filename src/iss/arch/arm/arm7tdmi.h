@@ -6,7 +6,8 @@
 struct arm7tdmi: public mmu
 {
 public:
-    arm7tdmi(struct bus *bus, bool gdbserver = false, bool gdbstart = false, bool bigendian = false);
+    arm7tdmi(struct bus *bus, bool gdbserver = false, bool gdbstart = false, bool bigendian = false,
+             int gdbport = ARM_GDB_PORT);
 
     /// Read byte data
     enum fault_t
@@ -34,8 +34,8 @@ arm920t_desc = {
     {8, 8}			//for byte size
 };
 
-arm920t::arm920t(struct bus *bus, bool gdbserver, bool gdbstart, bool bigendian)
-: mmu(bus, gdbserver, gdbstart, bigendian)
+arm920t::arm920t(struct bus *bus, bool gdbserver, bool gdbstart, bool bigendian, int gdbport)
+: mmu(bus, gdbserver, gdbstart, bigendian, gdbport)
 {
     arm920t_desc_t *desc;
     struct cache_desc *c_desc;
@@ -69,6 +69,13 @@ arm920t::arm920t(struct bus *bus, bool gdbserver, bool gdbstart, bool bigendian)
             c_desc->set, c_desc->w_mode) == 0);
 
     assert(mmu_wb_init(ARM920T_WB(), desc->wb.num, desc->wb.nb) == 0);
+
+    // structures reported by "monitor stats"
+    mmu_stats_add("icache", ARM920T_I_CACHE());
+    mmu_stats_add("dcache", ARM920T_D_CACHE());
+    mmu_stats_add("itlb", ARM920T_I_TLB());
+    mmu_stats_add("dtlb", ARM920T_D_TLB());
+    mmu_stats_add("wb", ARM920T_WB());
 }
 
 enum arm::fault_t
@@ -116,7 +123,7 @@ arm920t::mmu_load_instr(uint32_t va, uint32_t * instr)
     }
 
     // search cache no matter MMU enabled/disabled
-    cache = mmu_cache_search(ARM920T_I_CACHE(), mva);
+    cache = mmu_cache_lookup(ARM920T_I_CACHE(), mva);
     if (cache)
     {
         *instr = cache->data[va_cache_index(mva, ARM920T_I_CACHE())];
@@ -234,7 +241,7 @@ arm920t::mmu_read(uint32_t va, uint32_t * data, enum arm_data_type datatype)
         return fault;
     }
     // search main cache
-    cache = mmu_cache_search(ARM920T_D_CACHE(), mva);
+    cache = mmu_cache_lookup(ARM920T_D_CACHE(), mva);
     if (cache)
     {
         *data = cache->data[va_cache_index(mva, ARM920T_D_CACHE())];
@@ -391,7 +398,7 @@ arm920t::mmu_write(uint32_t va, uint32_t data, enum arm_data_type datatype)
     }
 
     // search main cache
-    cache = mmu_cache_search(ARM920T_D_CACHE(), mva);
+    cache = mmu_cache_lookup(ARM920T_D_CACHE(), mva);
     if (cache)
     {
         update_cache(mva, data, datatype, cache, ARM920T_D_CACHE(), va);
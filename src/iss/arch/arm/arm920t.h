@@ -6,7 +6,8 @@
 struct arm920t: public mmu
 {
 public:
-    arm920t(struct bus *bus, bool gdbserver = false, bool gdbstart = false, bool bigendian = false);
+    arm920t(struct bus *bus, bool gdbserver = false, bool gdbstart = false, bool bigendian = false,
+            int gdbport = ARM_GDB_PORT);
 
     /// Read byte data
     enum fault_t
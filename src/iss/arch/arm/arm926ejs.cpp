@@ -38,8 +38,8 @@ static arm926ejs_desc_t arm926ejs_desc =
     {8, 8} //for byte size
 };
 
-arm926ejs::arm926ejs(struct bus* bus, bool gdbserver, bool gdbstart, bool bigendian)
-: mmu(bus, gdbserver, gdbstart, bigendian)
+arm926ejs::arm926ejs(struct bus* bus, bool gdbserver, bool gdbstart, bool bigendian, int gdbport)
+: mmu(bus, gdbserver, gdbstart, bigendian, gdbport)
 {
     arm926ejs_desc_t *desc;
     struct cache_desc *c_desc;
@@ -73,6 +73,12 @@ arm926ejs::arm926ejs(struct bus* bus, bool gdbserver, bool gdbstart, bool bigend
             c_desc->set, c_desc->w_mode) == 0);
 
     assert(mmu_wb_init(ARM926EJS_WB(), desc->wb.num, desc->wb.nb) == 0);
+
+    // structures reported by "monitor stats"
+    mmu_stats_add("icache", ARM926EJS_I_CACHE());
+    mmu_stats_add("dcache", ARM926EJS_D_CACHE());
+    mmu_stats_add("tlb", ARM926EJS_MAIN_TLB());
+    mmu_stats_add("wb", ARM926EJS_WB());
 }
 
 enum arm::fault_t
@@ -107,7 +113,7 @@ arm926ejs::mmu_load_instr(uint32_t va, uint32_t* instr)
         return NO_FAULT;
     }
     // search cache no matter MMU enabled/disabled
-    cache = mmu_cache_search(ARM926EJS_I_CACHE(), mva);
+    cache = mmu_cache_lookup(ARM926EJS_I_CACHE(), mva);
 
     // if cache was hit, then return immediately the data
     if (cache)
@@ -256,7 +262,7 @@ arm926ejs::mmu_read(uint32_t va, uint32_t * data, enum arm_data_type datatype)
         return fault;
     }
     // search main cache
-    cache = mmu_cache_search(ARM926EJS_D_CACHE(), mva);
+    cache = mmu_cache_lookup(ARM926EJS_D_CACHE(), mva);
     if (cache)
     {
         // data found in cache
@@ -416,7 +422,7 @@ arm926ejs::mmu_write(uint32_t va, uint32_t data, enum arm_data_type datatype)
     }
 
     // search main cache
-    cache = mmu_cache_search(ARM926EJS_D_CACHE(), mva);
+    cache = mmu_cache_lookup(ARM926EJS_D_CACHE(), mva);
     if (cache)
     {
         update_cache(mva, data, datatype, cache, ARM926EJS_D_CACHE(), va);
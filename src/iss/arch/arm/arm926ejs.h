@@ -6,7 +6,8 @@
 struct arm926ejs: public mmu
 {
 public:
-    arm926ejs(struct bus* bus, bool gdbserver = false, bool gdbstart = false, bool bigendian = false);
+    arm926ejs(struct bus* bus, bool gdbserver = false, bool gdbstart = false, bool bigendian = false,
+              int gdbport = ARM_GDB_PORT);
 
     /// Virtual function implementation
     enum fault_t
@@ -20,10 +20,10 @@ uint32_t ARMul_ImmedTable[4096];
 /// Number of bits in a byte table
 char ARMul_BitList[256];
 
-arm::arm(bool gdbserver, bool gdbstart, bool bigendian)
+arm::arm(bool gdbserver, bool gdbstart, bool bigendian, int gdbport)
 {
     // launch the gdbserver (in blocking mode if it must wait for debugger)
-    gdbserver::start(12345, gdbserver, gdbstart);
+    gdbserver::start(gdbport, gdbserver, gdbstart);
 
     // save local variables
     m_gdbconnected = false;
@@ -55,6 +55,44 @@ arm::run()
     }
 }
 
+void
+arm::run(uint64_t count)
+{
+    uint64_t end = m_NumInstrs + count;
+
+    // resume from the current state
+    m_Emulate = RUN;
+
+    while (m_NumInstrs < end)
+    {
+        this->emulate();
+    }
+}
+
+bool
+arm::run_until(uint64_t count, uint32_t addr)
+{
+    // the count is saturated, so that a huge count means no limit
+    uint64_t end = (count > ~m_NumInstrs) ? ~0ULL : m_NumInstrs + count;
+
+    // treat as a first call to the emulator
+    FLUSHPIPE;
+
+    // set in run mode
+    m_Emulate = RUN;
+
+    // the conditions are checked between the instructions, out of the decoder
+    while (m_NumInstrs < end)
+    {
+        this->emulate();
+        if (m_PC == addr)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 void
 arm::init_helpers()
 {
@@ -117,6 +155,15 @@ arm::init_state(void)
     m_PCChanged = false;
     memset(m_BreakPts, 0, sizeof(m_BreakPts));
     m_NumBreakPts=0;
+    //  - profiling
+    m_Observer = NULL;
+    m_ObserverPeriod = 1;
+    m_ObserverCountdown = 1;
+    m_ObserverNext = ARM_OBSERVER_REPORT;
+    m_Coverage = NULL;
+    //  - semihosting
+    m_Semihosting = false;
+    m_SemiErrno = 0;
 
     //  - configure the default values
     m_Emulate = RUN;
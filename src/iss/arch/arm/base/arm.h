@@ -8,24 +8,173 @@
 #define _ARM_H_
 
 #include <iostream>
+#include <vector>
 #include <stdint.h>
+#include <stdio.h>
 
 // derived classes
 #include "gdbserver.h"
 
+/// Default TCP port of the gdbserver of a core
+#define ARM_GDB_PORT 12345
+
+/// Next instruction address forcing a report to the observer (never an instruction address)
+#define ARM_OBSERVER_REPORT 0xFFFFFFFF
+
+/// Observer of the instruction flow of the core (profiling)
+struct arm_observer
+{
+    virtual
+    ~arm_observer()
+    {
+    }
+
+    /** Called before the execution of every branch target, and of one sequential
+     * instruction out of the reporting period (the others are not reported)
+     * @param[in] pc Address of the instruction
+     * @param[in] lr Link register of the current mode
+     * @param[in] thumb Indicates if the instruction is a Thumb instruction
+     * @param[in] cycles Number of cycles elapsed since reset (wraps around)
+     * @param[in] instrs Number of instructions executed since reset (wraps around)
+     */
+    virtual void
+    arm_instr(uint32_t pc, uint32_t lr, bool thumb, uint32_t cycles, uint32_t instrs) = 0;
+
+    /** Called when an exception is taken
+     * @param[in] vector Exception vector (ARMul_xxxV)
+     * @param[in] ret Address at which the exception handler returns
+     */
+    virtual void
+    arm_exception(uint32_t vector, uint32_t ret) = 0;
+};
+
+/// Code coverage of the core, one bit per halfword of the covered regions
+struct arm_coverage
+{
+    /// Covered memory region
+    struct region
+    {
+        /// Start address of the region
+        uint32_t base;
+        /// Size of the region in bytes
+        uint32_t size;
+        /// Instructions executed
+        uint8_t* executed;
+        /// Conditional instructions executed with the condition passed
+        uint8_t* passed;
+        /// Conditional instructions executed with the condition failed
+        uint8_t* failed;
+    };
+
+    arm_coverage()
+    : m_last(NULL)
+    {
+    }
+
+    virtual
+    ~arm_coverage()
+    {
+    }
+
+    /** Mark an instruction as executed
+     * @param[in] pc Address of the instruction
+     */
+    void
+    executed(uint32_t pc)
+    {
+        region* r = this->find(pc);
+        if (r != NULL)
+        {
+            mark(r->executed, pc - r->base);
+        }
+    }
+
+    /** Record the outcome of the condition of an instruction
+     * @param[in] pc Address of the instruction
+     * @param[in] passed Indicates if the condition passed
+     */
+    void
+    condition(uint32_t pc, bool passed)
+    {
+        region* r = this->find(pc);
+        if (r != NULL)
+        {
+            mark(passed ? r->passed : r->failed, pc - r->base);
+        }
+    }
+
+protected:
+    /** Find the region containing an address
+     * @param[in] pc Address to look for
+     * @return The region, NULL if the address is not covered
+     */
+    region*
+    find(uint32_t pc)
+    {
+        // most of the instructions are in the same region as the previous one
+        if ((m_last != NULL) && ((pc - m_last->base) < m_last->size))
+        {
+            return m_last;
+        }
+        for (size_t i = 0; i < m_regions.size(); i++)
+        {
+            if ((pc - m_regions[i].base) < m_regions[i].size)
+            {
+                m_last = &m_regions[i];
+                return m_last;
+            }
+        }
+        return NULL;
+    }
+
+    /** Set the bit of a halfword in a bitmap
+     * @param[in, out] bitmap Bitmap to update
+     * @param[in] offset Offset of the halfword in the region
+     */
+    static void
+    mark(uint8_t* bitmap, uint32_t offset)
+    {
+        offset >>= 1;
+        bitmap[offset >> 3] |= 1 << (offset & 7);
+    }
+
+    /// Covered regions
+    std::vector<region> m_regions;
+
+    /// Region of the last instruction
+    region* m_last;
+};
+
 struct arm: public gdbserver
 {
     /// ARM constructor
     /** Function that performs the complete initialization of the ARM
      * @param[in] gdbserver Specifies if the GDB remote connection must be supported
      * @param[in] bigendian Big or little endian mode
+     * @param[in] gdbport TCP port of the GDB remote connection (one per core)
      */
-    arm(bool gdbserver = false, bool gdbstart = false, bool bigendian = false);
+    arm(bool gdbserver = false, bool gdbstart = false, bool bigendian = false,
+        int gdbport = ARM_GDB_PORT);
 
     /// Run the ARM
     void
     run(void);
 
+    /** Run the ARM for a number of instructions
+     * @param[in] count Number of instructions to execute before returning
+     */
+    void
+    run(uint64_t count);
+
+    /** Run the ARM until a number of instructions or an address is reached
+     * @param[in] count Number of instructions to execute before returning
+     * @param[in] addr Address of the last instruction to execute
+     * @return true if the instruction at the address was executed, false if the
+     *  number of instructions was executed
+     */
+    bool
+    run_until(uint64_t count, uint32_t addr);
+
     bool irq_get(void)
     {
         // signal is active low
@@ -62,6 +211,52 @@ struct arm: public gdbserver
         m_NfiqSig = true;
     }
 
+    /** Set the observer of the instruction flow
+     * @param[in] observer Observer to call, NULL to remove it
+     * @param[in] period Only one sequential instruction out of period is reported
+     */
+    void set_observer(arm_observer* observer, uint32_t period = 1)
+    {
+        m_Observer = observer;
+        m_ObserverPeriod = period;
+        m_ObserverCountdown = period;
+        m_ObserverNext = ARM_OBSERVER_REPORT;
+    }
+
+    /** Set the code coverage bitmaps
+     * @param[in] coverage Coverage to update, NULL to remove it
+     */
+    void set_coverage(arm_coverage* coverage)
+    {
+        m_Coverage = coverage;
+    }
+
+    /** Enable the semihosting calls (SWI 0x123456, Thumb SWI 0xAB and BKPT 0xAB)
+     * @param[in] enabled Indicates if the calls are executed by the host instead of
+     *                    taking the exception
+     */
+    void set_semihosting(bool enabled)
+    {
+        m_Semihosting = enabled;
+    }
+
+    /** Get a register of the current mode
+     * @param[in] reg Number of the register
+     * @return The value of the register
+     */
+    uint32_t get_reg(int reg)
+    {
+        return m_Reg[reg];
+    }
+
+    /** Get the number of core cycles executed (S, N, I and C cycles)
+     * @return The number of cycles, wrapping at 32 bits
+     */
+    uint32_t get_cycles()
+    {
+        return m_NumScycles + m_NumNcycles + m_NumIcycles + m_NumCcycles;
+    }
+
     /// Count the number of instructions executed
     uint64_t m_NumInstrs;
 
@@ -177,6 +372,28 @@ protected:
     uint8_t m_NumBreakPts;
     /// @}
 
+    /// Observer of the instruction flow (NULL if none)
+    arm_observer* m_Observer;
+    /// Reporting period of the sequential instructions to the observer
+    uint32_t m_ObserverPeriod;
+    /// Sequential instructions left before the next report
+    uint32_t m_ObserverCountdown;
+    /// Address of the next sequential instruction (ARM_OBSERVER_REPORT to force a report)
+    uint32_t m_ObserverNext;
+
+    /// Code coverage (NULL if none)
+    arm_coverage* m_Coverage;
+
+    /** Semihosting related variables
+     * @{
+     */
+    bool m_Semihosting;
+    /// Host files opened by the firmware, indexed by handle - 1 (NULL if closed)
+    std::vector<FILE*> m_SemiFiles;
+    /// Host errno of the last failed call
+    int m_SemiErrno;
+    /// @}
+
     /** Scheduler related virtual function, indicates to the scheduler the number of core
      * cycles that were spent for the execution stage of the current instruction
      * param[in] cycles Number of cycles needed to execute the last instruction
@@ -188,6 +405,17 @@ protected:
         return;
     }
 
+    /** Scheduler related virtual function, indicates that the firmware exited (semihosting),
+     * the simulation is expected to end
+     * param[in] code Exit code of the firmware
+     */
+    virtual void
+    arm_exit(int code)
+    {
+        std::cout << "ERROR: virtual function '" << __FUNCTION__ << "' undefined" << std::endl;
+        return;
+    }
+
     /** MMU related virtual functions that must be implemented by the object that
      * derives the core.  If it is an MMU, it should implement the appropriate
      * mechanism.  If it is not an MMU, these functions should still be implemented as a
@@ -393,6 +621,46 @@ private:
     void
     init_state();
 
+    /** Execute a semihosting call if the instruction is one
+     * @param[in] instr SWI or BKPT instruction (ARM encoding)
+     * @return true if the call was executed, false if the instruction must be executed
+     */
+    bool
+    semihosting(uint32_t instr);
+
+    /** Execute a semihosting operation
+     * @param[in] op Operation number (r0)
+     * @param[in] args Parameter of the operation (r1)
+     * @return The value returned to the firmware in r0
+     */
+    uint32_t
+    semihosting_call(uint32_t op, uint32_t args);
+
+    /** Read the guest memory for a semihosting call
+     * @param[in] addr Virtual address to read
+     * @param[out] buf Buffer to fill
+     * @param[in] len Number of bytes to read
+     * @return true if there was an error, false otherwise
+     */
+    bool
+    semihosting_read(uint32_t addr, uint8_t* buf, uint32_t len);
+
+    /** Write the guest memory for a semihosting call
+     * @param[in] addr Virtual address to write
+     * @param[in] buf Buffer to copy
+     * @param[in] len Number of bytes to write
+     * @return true if there was an error, false otherwise
+     */
+    bool
+    semihosting_write(uint32_t addr, uint8_t* buf, uint32_t len);
+
+    /** Get a host file from a semihosting handle
+     * @param[in] handle Handle given to the firmware
+     * @return The file, NULL if the handle is not valid
+     */
+    FILE*
+    semihosting_file(uint32_t handle);
+
     /// Emulate one instruction cycle
     void
     emulate();
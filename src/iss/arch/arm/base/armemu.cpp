@@ -353,6 +353,25 @@ armulate_trapped:
             }
         }
 armulate_nottrapped:
+        // report the instruction to the observer (the sequential ones once per period)
+        if (m_Observer != NULL)
+        {
+            if ((m_PC != m_ObserverNext) || (--m_ObserverCountdown == 0))
+            {
+                m_ObserverCountdown = m_ObserverPeriod;
+                m_Observer->arm_instr(m_PC, m_Reg[14], TFLAG,
+                        m_NumScycles + m_NumNcycles + m_NumIcycles + m_NumCcycles,
+                        (uint32_t)m_NumInstrs);
+            }
+            m_ObserverNext = m_PC + (TFLAG ? 2 : 4);
+        }
+
+        // mark the instruction as covered
+        if (m_Coverage != NULL)
+        {
+            m_Coverage->executed(m_PC);
+        }
+
         // increment the number of instructions executed
 		m_NumInstrs++;
 
@@ -480,6 +499,10 @@ armulate_nottrapped:
 			break;
 		}		/* cc check */
 
+		/* Record the outcome of the condition for the branch coverage.  */
+		if ((m_Coverage != NULL) && (TOPBITS (28) != NV))
+			m_Coverage->condition(m_PC, temp);
+
 		/* Actual execution of instructions begins here.  */
 		/* If the condition codes don't match, stop here.  */
 		if (temp) {
@@ -1118,6 +1141,10 @@ armulate_nottrapped:
 						   uses this instruction for its breakpoints (at least in
 						   Thumb mode it does).  So intercept the instruction here
 						   and generate a breakpoint SWI instead.  */
+						if (semihosting(instr))
+						{
+							break;
+						}
 					    assert(0);
 						/* Force the next instruction to be refetched.  */
 						FLUSHPIPE;
@@ -2923,6 +2950,11 @@ armulate_nottrapped:
 					ARMul_Abort(ARMul_PrefetchAbortV);
 					break;
 				}
+				// semihosting calls are executed by the host
+				if (semihosting(instr))
+				{
+					break;
+				}
 				ARMul_Abort(ARMul_SWIV);
 				break;
 			}
@@ -0,0 +1,413 @@
+/** @file armsemi.cpp
+ * @brief ARM semihosting implementation
+ *
+ * The semihosting calls are executed directly by the host, with the operation
+ * number in r0 and its parameter in r1 (usually a pointer to a parameter block),
+ * the result is returned in r0.
+ *
+ * @sa http://infocenter.arm.com/ (RealView Compilation Tools Developer Guide, semihosting)
+ */
+
+#include "arm.h"
+
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <string>
+
+/// Semihosting operation numbers
+enum semihosting_op
+{
+    SYS_OPEN = 0x01,
+    SYS_CLOSE = 0x02,
+    SYS_WRITEC = 0x03,
+    SYS_WRITE0 = 0x04,
+    SYS_WRITE = 0x05,
+    SYS_READ = 0x06,
+    SYS_READC = 0x07,
+    SYS_ISERROR = 0x08,
+    SYS_ISTTY = 0x09,
+    SYS_SEEK = 0x0A,
+    SYS_FLEN = 0x0C,
+    SYS_TMPNAM = 0x0D,
+    SYS_REMOVE = 0x0E,
+    SYS_RENAME = 0x0F,
+    SYS_CLOCK = 0x10,
+    SYS_TIME = 0x11,
+    SYS_SYSTEM = 0x12,
+    SYS_ERRNO = 0x13,
+    SYS_GET_CMDLINE = 0x15,
+    SYS_HEAPINFO = 0x16,
+    SYS_EXIT = 0x18,
+    SYS_EXIT_EXTENDED = 0x20
+};
+
+/// Reason of SYS_EXIT for a normal end of the application
+#define ADP_STOPPED_APPLICATION_EXIT 0x20026
+
+/// fopen() modes of the SYS_OPEN mode parameter
+static const char* semihosting_modes[12] =
+{
+    "r", "rb", "r+", "r+b", "w", "wb", "w+", "w+b", "a", "ab", "a+", "a+b"
+};
+
+bool
+arm::semihosting(uint32_t instr)
+{
+    bool call;
+
+    if (!m_Semihosting)
+    {
+        return false;
+    }
+
+    if ((instr & 0x0FF000F0) == 0x01200070)
+    {
+        // BKPT 0xAB
+        call = ((((instr >> 4) & 0xFFF0) | (instr & 0xF)) == 0xAB);
+    }
+    else if (m_TFlag)
+    {
+        // SWI 0xAB (Thumb SWI converted to ARM)
+        call = ((instr & 0xFFFFFF) == 0xAB);
+    }
+    else
+    {
+        // SWI 0x123456
+        call = ((instr & 0xFFFFFF) == 0x123456);
+    }
+
+    if (call)
+    {
+        m_Reg[0] = this->semihosting_call(m_Reg[0], m_Reg[1]);
+    }
+    return call;
+}
+
+bool
+arm::semihosting_read(uint32_t addr, uint8_t* buf, uint32_t len)
+{
+    uint32_t i, data;
+
+    // debug access (direct copy), then through the caches if not possible
+    if (this->gdb_read(addr, buf, len) == (int)len)
+    {
+        return false;
+    }
+    for (i = 0; i < len; i++)
+    {
+        if (this->mmu_read_byte(addr + i, &data) != NO_FAULT)
+        {
+            return true;
+        }
+        buf[i] = data;
+    }
+    return false;
+}
+
+bool
+arm::semihosting_write(uint32_t addr, uint8_t* buf, uint32_t len)
+{
+    uint32_t i;
+
+    // debug access (direct copy), then through the caches if not possible
+    if (this->gdb_write(addr, buf, len) == (int)len)
+    {
+        return false;
+    }
+    for (i = 0; i < len; i++)
+    {
+        if (this->mmu_write_byte(addr + i, buf[i]) != NO_FAULT)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+FILE*
+arm::semihosting_file(uint32_t handle)
+{
+    if ((handle == 0) || (handle > m_SemiFiles.size()))
+    {
+        return NULL;
+    }
+    return m_SemiFiles[handle - 1];
+}
+
+uint32_t
+arm::semihosting_call(uint32_t op, uint32_t args)
+{
+    uint32_t arg[4] = {0, 0, 0, 0};
+    std::string name, name2;
+    uint8_t c;
+    FILE* file;
+    size_t i;
+
+    // parameter block (up to 4 words for all the supported operations)
+    if ((op != SYS_WRITEC) && (op != SYS_WRITE0) && (op != SYS_EXIT) && (args != 0))
+    {
+        if (this->semihosting_read(args, (uint8_t*)arg, sizeof(arg)))
+        {
+            ARM_WARN("semihosting: can not read the parameters @0x%08X", args);
+            return (uint32_t)-1;
+        }
+    }
+
+    switch (op)
+    {
+    case SYS_OPEN:
+        if (arg[1] >= 12)
+        {
+            m_SemiErrno = EINVAL;
+            return (uint32_t)-1;
+        }
+        name.resize(arg[2]);
+        if ((arg[2] != 0) && this->semihosting_read(arg[0], (uint8_t*)&name[0], arg[2]))
+        {
+            m_SemiErrno = EFAULT;
+            return (uint32_t)-1;
+        }
+        // ":tt" is the console (stdin for reading, stdout for writing, stderr for appending)
+        if (name == ":tt")
+        {
+            file = (arg[1] < 4) ? stdin : ((arg[1] < 8) ? stdout : stderr);
+        }
+        else
+        {
+            file = fopen(name.c_str(), semihosting_modes[arg[1]]);
+            if (file == NULL)
+            {
+                m_SemiErrno = errno;
+                return (uint32_t)-1;
+            }
+        }
+        // reuse a closed handle
+        for (i = 0; i < m_SemiFiles.size(); i++)
+        {
+            if (m_SemiFiles[i] == NULL)
+            {
+                m_SemiFiles[i] = file;
+                return i + 1;
+            }
+        }
+        m_SemiFiles.push_back(file);
+        return m_SemiFiles.size();
+
+    case SYS_CLOSE:
+        file = this->semihosting_file(arg[0]);
+        if (file == NULL)
+        {
+            m_SemiErrno = EBADF;
+            return (uint32_t)-1;
+        }
+        m_SemiFiles[arg[0] - 1] = NULL;
+        if ((file == stdin) || (file == stdout) || (file == stderr))
+        {
+            fflush(file);
+            return 0;
+        }
+        return (fclose(file) == 0) ? 0 : (uint32_t)-1;
+
+    case SYS_WRITEC:
+        if (this->semihosting_read(args, &c, 1))
+        {
+            return (uint32_t)-1;
+        }
+        fputc(c, stdout);
+        return 0;
+
+    case SYS_WRITE0:
+        for (;; args++)
+        {
+            if (this->semihosting_read(args, &c, 1) || (c == '\0'))
+            {
+                break;
+            }
+            fputc(c, stdout);
+        }
+        return 0;
+
+    case SYS_WRITE:
+    {
+        // the number of bytes not written is returned
+        std::vector<uint8_t> buf(arg[2]);
+
+        file = this->semihosting_file(arg[0]);
+        if (file == NULL)
+        {
+            m_SemiErrno = EBADF;
+            return arg[2];
+        }
+        if ((arg[2] == 0) || this->semihosting_read(arg[1], &buf[0], arg[2]))
+        {
+            return arg[2];
+        }
+        i = fwrite(&buf[0], 1, arg[2], file);
+        if (i != arg[2])
+        {
+            m_SemiErrno = errno;
+        }
+        return arg[2] - i;
+    }
+
+    case SYS_READ:
+    {
+        // the number of bytes not read is returned
+        std::vector<uint8_t> buf(arg[2]);
+
+        file = this->semihosting_file(arg[0]);
+        if (file == NULL)
+        {
+            m_SemiErrno = EBADF;
+            return arg[2];
+        }
+        if (file == stdin)
+        {
+            fflush(stdout);
+        }
+        i = (arg[2] != 0) ? fread(&buf[0], 1, arg[2], file) : 0;
+        if ((i != 0) && this->semihosting_write(arg[1], &buf[0], i))
+        {
+            return arg[2];
+        }
+        return arg[2] - i;
+    }
+
+    case SYS_READC:
+        fflush(stdout);
+        return fgetc(stdin);
+
+    case SYS_ISERROR:
+        return ((int32_t)arg[0] < 0);
+
+    case SYS_ISTTY:
+        file = this->semihosting_file(arg[0]);
+        if (file == NULL)
+        {
+            m_SemiErrno = EBADF;
+            return (uint32_t)-1;
+        }
+        return isatty(fileno(file));
+
+    case SYS_SEEK:
+        file = this->semihosting_file(arg[0]);
+        if ((file == NULL) || (fseek(file, arg[1], SEEK_SET) != 0))
+        {
+            m_SemiErrno = (file == NULL) ? EBADF : errno;
+            return (uint32_t)-1;
+        }
+        return 0;
+
+    case SYS_FLEN:
+    {
+        long pos, len;
+
+        file = this->semihosting_file(arg[0]);
+        if (file == NULL)
+        {
+            m_SemiErrno = EBADF;
+            return (uint32_t)-1;
+        }
+        pos = ftell(file);
+        fseek(file, 0, SEEK_END);
+        len = ftell(file);
+        fseek(file, pos, SEEK_SET);
+        return len;
+    }
+
+    case SYS_REMOVE:
+        name.resize(arg[1]);
+        if ((arg[1] != 0) && this->semihosting_read(arg[0], (uint8_t*)&name[0], arg[1]))
+        {
+            return (uint32_t)-1;
+        }
+        if (remove(name.c_str()) != 0)
+        {
+            m_SemiErrno = errno;
+            return (uint32_t)-1;
+        }
+        return 0;
+
+    case SYS_RENAME:
+        name.resize(arg[1]);
+        name2.resize(arg[3]);
+        if (((arg[1] != 0) && this->semihosting_read(arg[0], (uint8_t*)&name[0], arg[1])) ||
+            ((arg[3] != 0) && this->semihosting_read(arg[2], (uint8_t*)&name2[0], arg[3])))
+        {
+            return (uint32_t)-1;
+        }
+        if (rename(name.c_str(), name2.c_str()) != 0)
+        {
+            m_SemiErrno = errno;
+            return (uint32_t)-1;
+        }
+        return 0;
+
+    case SYS_CLOCK:
+        // centiseconds of host execution time
+        return (uint32_t)(clock() / (CLOCKS_PER_SEC / 100));
+
+    case SYS_TIME:
+        return (uint32_t)time(NULL);
+
+    case SYS_ERRNO:
+        return m_SemiErrno;
+
+    case SYS_GET_CMDLINE:
+        // no command line: empty string
+        c = '\0';
+        if ((arg[1] == 0) || this->semihosting_write(arg[0], &c, 1))
+        {
+            return (uint32_t)-1;
+        }
+        arg[1] = 0;
+        return this->semihosting_write(args + 4, (uint8_t*)&arg[1], 4) ? (uint32_t)-1 : 0;
+
+    case SYS_HEAPINFO:
+    {
+        // unknown heap and stack (the C library uses its linker symbols)
+        uint32_t info[4] = {0, 0, 0, 0};
+
+        return this->semihosting_write(arg[0], (uint8_t*)info, sizeof(info)) ? (uint32_t)-1 : 0;
+    }
+
+    case SYS_EXIT:
+    case SYS_EXIT_EXTENDED:
+    {
+        int code;
+
+        if (op == SYS_EXIT)
+        {
+            code = (args == ADP_STOPPED_APPLICATION_EXIT) ? 0 : 1;
+        }
+        else
+        {
+            code = (arg[0] == ADP_STOPPED_APPLICATION_EXIT) ? arg[1] : 1;
+        }
+
+        // flush the firmware files, tell the debugger and end the simulation
+        for (i = 0; i < m_SemiFiles.size(); i++)
+        {
+            if ((m_SemiFiles[i] != NULL) && (m_SemiFiles[i] != stdin) &&
+                (m_SemiFiles[i] != stdout) && (m_SemiFiles[i] != stderr))
+            {
+                fclose(m_SemiFiles[i]);
+            }
+            m_SemiFiles[i] = NULL;
+        }
+        fflush(stdout);
+        this->end(code);
+        this->arm_exit(code);
+        return 0;
+    }
+
+    case SYS_TMPNAM:
+    case SYS_SYSTEM:
+    default:
+        ARM_WARN("semihosting: unsupported operation 0x%02X", op);
+        m_SemiErrno = ENOSYS;
+        return (uint32_t)-1;
+    }
+}
@@ -414,6 +414,23 @@ arm::ARMul_Abort(uint32_t vector)
 
     temp = m_Reg[15];
 
+    // report the exception to the observer (interrupts and aborts return to the
+    // current instruction, the other exceptions to the next one)
+    if (m_Observer != NULL)
+    {
+        if ((vector == ARMul_SWIV) || (vector == ARMul_UndefinedInstrV))
+        {
+            m_Observer->arm_exception(vector, m_PC + isize);
+        }
+        else
+        {
+            m_Observer->arm_exception(vector, m_PC);
+        }
+
+        // the entry of the handler is always reported
+        m_ObserverNext = ARM_OBSERVER_REPORT;
+    }
+
     switch (vector)
     {
     case ARMul_ResetV:  /* RESET */
@@ -310,6 +310,12 @@ arm::ARMul_ThumbDecode(uint32_t pc,uint32_t tinstr,uint32_t* ainstr)
 		}
 		else if ((tinstr & 0x0F00) == 0x0e00)
 		{
+			/* BKPT 0xAB is a semihosting call: converted to the ARM BKPT.  */
+			if (m_Semihosting && m_IsV5 && ((tinstr & 0x00FF) == 0xAB))
+			{
+				*ainstr = 0xE1200A7B;
+				break;
+			}
             // Unsupported SWI breakpoint setting
 		    assert(0);
 			// *ainstr = 0xEF000000 | SWI_Breakpoint;
@@ -412,6 +418,9 @@ arm::ARMul_ThumbDecode(uint32_t pc,uint32_t tinstr,uint32_t* ainstr)
 					|| (!NFLAG && VFLAG)) || ZFLAG;
 				break;
 			}
+			/* Record the outcome of the condition for the branch coverage.  */
+			if (m_Coverage != NULL)
+				m_Coverage->condition(pc, doit);
 			if (doit) {
 				m_Reg[15] = (pc + 4
 						  + (((tinstr & 0x7F) << 1)
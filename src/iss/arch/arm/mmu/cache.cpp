@@ -42,6 +42,7 @@ mmu::mmu_cache_init(struct cache* cache_t, uint32_t width, uint32_t way, uint32_
     cache_t->set = set;
     cache_t->way = way;
     cache_t->w_mode = w_mode;
+    memset(&cache_t->stats, 0, sizeof(cache_t->stats));
     return 0;
 }
 
@@ -87,6 +88,22 @@ mmu::mmu_cache_search(struct cache* cache_t, uint32_t va)
     return NULL;
 }
 
+struct mmu::cache_line*
+mmu::mmu_cache_lookup(struct cache* cache_t, uint32_t va)
+{
+    struct cache_line *cache = mmu_cache_search(cache_t, va);
+
+    if (cache)
+    {
+        cache_t->stats.hits++;
+    }
+    else
+    {
+        cache_t->stats.misses++;
+    }
+    return cache;
+}
+
 struct mmu::cache_line*
 mmu::mmu_cache_search_by_index(struct cache* cache_t, uint32_t index)
 {
@@ -123,6 +140,12 @@ mmu::mmu_cache_alloc(struct cache* cache_t, uint32_t va, uint32_t pa)
     if (set->cycle == cache_t->way)
         set->cycle = 0;
 
+    cache_t->stats.linefills++;
+    if (cache->tag & TAG_VALID_FLAG)
+    {
+        cache_t->stats.evictions++;
+    }
+
     if (cache_t->w_mode == CACHE_WRITE_BACK)
     {
         uint32_t t;
@@ -178,6 +201,7 @@ mmu::mmu_cache_write_back(struct cache* cache_t, struct cache_line * cache)
     {
         m_bus.wr_l(m_bus.obj, pa, *data);
     }
+    cache_t->stats.write_backs++;
 
     cache->tag &= ~(TAG_FIRST_HALF_DIRTY | TAG_LAST_HALF_DIRTY);
 }
@@ -252,6 +276,30 @@ mmu::mmu_cache_invalidate_all(struct cache* cache_t)
     }
 };
 
+void
+mmu::mmu_cache_invalidate_phys(struct cache* cache_t, uint32_t start, uint32_t end)
+{
+    uint32_t i, j;
+    struct cache_set *set;
+    struct cache_line *cache;
+
+    set = cache_t->sets;
+    for (i = 0; i < cache_t->set; i++, set++)
+    {
+        cache = set->lines;
+        for (j = 0; j < cache_t->way; j++, cache++)
+        {
+            // line overlapping the range
+            if ((cache->tag & TAG_VALID_FLAG) && (cache->pa <= end) &&
+                ((cache->pa + cache_t->width - 1) >= start))
+            {
+                mmu_cache_write_back(cache_t, cache);
+                cache->tag = 0;
+            }
+        }
+    }
+}
+
 void
 mmu::mmu_cache_soft_flush(struct cache* cache_t, uint32_t pa)
 {
@@ -11,3 +11,20 @@ mmu::arm_exec_cycles(int cycles)
     // call the CPU callback function
     m_bus.exec_cycles(m_bus.obj, cycles);
 }
+
+void
+mmu::arm_exit(int code)
+{
+    // call the CPU callback function
+    m_bus.exit(m_bus.obj, code);
+}
+
+void
+mmu::mmu_invalidate_phys(uint32_t start, uint32_t end)
+{
+    // all the caches of the core are registered for the statistics
+    for (size_t i = 0; i < m_stats_caches.size(); i++)
+    {
+        mmu_cache_invalidate_phys(m_stats_caches[i].second, start, end);
+    }
+}
@@ -3,6 +3,9 @@
 
 #include <iostream>
 #include <stdint.h>
+#include <string.h>
+#include <string>
+#include <vector>
 
 #include "arm.h"
 
@@ -120,6 +123,8 @@ struct mmu: public arm
         void (*exec_cycles)(void *obj, int cycles);
         /// Wait for an interrupt
         void (*wfi)(void *obj);
+        /// Exit of the firmware (semihosting)
+        void (*exit)(void *obj, int code);
     };
 public:
     /** MMU Constructor
@@ -127,12 +132,15 @@ public:
      * @param[in] gdbserver Indicate if ISS shall run gdbserver, support gdb connections
      * @param[in] gdbstart Indicate if ISS shall wait for gdb connect at start
      * @param[in] bigendian Indicate if ISS is little or big endian
+     * @param[in] gdbport TCP port of the gdbserver
      */
     mmu(struct bus *bus,
-        bool gdbserver = false, bool gdbstart = false, bool bigendian = false)
-    : arm(gdbserver, gdbstart, bigendian)
+        bool gdbserver = false, bool gdbstart = false, bool bigendian = false,
+        int gdbport = ARM_GDB_PORT)
+    : arm(gdbserver, gdbstart, bigendian, gdbport)
     {
         m_bus = *bus;
+        memset(m_faults, 0, sizeof(m_faults));
     }
 
     /// Cache supported write modes
@@ -185,12 +193,47 @@ public:
      * @param[in] fault Fault status of the failed access
      * @param[in] address Address of the failed access
      */
-    void mmu_set_fault(uint32_t fault, uint32_t address)
+    void mmu_set_fault(enum fault_t fault, uint32_t address)
     {
+        m_faults[fault & 0xF]++;
         fault_status = (fault | (last_domain << 4)) & 0xFF;
         fault_address = address;
     }
 
+    /** Invalidate the cache lines of a physical address range (the lines are cleaned first)
+     * @param[in] start First address of the range
+     * @param[in] end Last address of the range (included)
+     */
+    void
+    mmu_invalidate_phys(uint32_t start, uint32_t end);
+
+    /** Get the statistics of the caches, TLBs and write buffer in text
+     * @return The statistics, one line per structure
+     */
+    std::string
+    mmu_stats_text();
+
+    /** Write the statistics of the caches, TLBs and write buffer in JSON
+     * @param[in] path Path of the JSON file
+     * @return true if there was an error, false otherwise
+     */
+    bool
+    mmu_stats_json(const char* path);
+
+    /// Clear the statistics of the caches, TLBs and write buffer
+    void
+    mmu_stats_reset();
+
+    /// Implementation of gdbserver virtual function ("monitor stats [reset|json <file>]")
+    bool
+    gdb_monitor(const char* name, const char* args, std::string& output);
+
+    /// Implementation of gdbserver virtual function
+    const char*
+    gdb_monitor_names()
+    {
+        return " stats";
+    }
 
 
 protected:
@@ -267,6 +310,15 @@ protected:
         enum tlb_mapping mapping;
     };
 
+    /// Translation Lookaside Buffer statistics
+    struct tlb_stats
+    {
+        /// Translations found in the TLB
+        uint64_t hits;
+        /// Translations walking the translation tables
+        uint64_t walks;
+    };
+
     /// Translation Lookaside Buffer list
     struct tlb
     {
@@ -276,6 +328,8 @@ protected:
         int cycle;
         /// Array of TLBs
         struct tlb_entry* entries;
+        /// Statistics
+        struct tlb_stats stats;
     };
 
     /** Check if access is allowed
@@ -351,6 +405,17 @@ protected:
         uint32_t nb;
     };
 
+    /// Write buffer statistics
+    struct wb_stats
+    {
+        /// Entries written in the buffers
+        uint64_t writes;
+        /// Writes waiting for the oldest entry to be flushed (buffers full)
+        uint64_t stalls;
+        /// Drains of the buffers (with at least one entry used)
+        uint64_t drains;
+    };
+
     /// Write buffer list
     struct wb
     {
@@ -366,6 +431,8 @@ protected:
         uint32_t used;
         /// Pointer to the write buffers array
         struct wb_entry* entries;
+        /// Statistics
+        struct wb_stats stats;
     } wb;
 
     /** @brief Allocates the write buffers in local memory (to simulate cache)
@@ -509,6 +576,21 @@ protected:
         uint32_t cycle;
     };
 
+    /// Cache statistics
+    struct cache_stats
+    {
+        /// Accesses found in the cache
+        uint64_t hits;
+        /// Accesses not found in the cache
+        uint64_t misses;
+        /// Lines allocated
+        uint64_t linefills;
+        /// Valid lines replaced by an allocation
+        uint64_t evictions;
+        /// Dirty lines written back to memory
+        uint64_t write_backs;
+    };
+
     /// Full cache descriptor
     struct cache
     {
@@ -522,6 +604,8 @@ protected:
         enum write_mode w_mode;
         /// Cache sets array
         struct cache_set* sets;
+        /// Statistics
+        struct cache_stats stats;
     };
 
 
@@ -534,6 +618,14 @@ protected:
     struct cache_line*
     mmu_cache_search(struct cache* cache_t, uint32_t va);
 
+    /** Search a cache for a CPU access, counting the hits and misses
+     * @param[in, out] cache_t Cache pointer
+     * @param[in] va Virtual address of the access
+     * @return The cache line or NULL if not found
+     */
+    struct cache_line*
+    mmu_cache_lookup(struct cache* cache_t, uint32_t va);
+
     struct cache_line*
     mmu_cache_search_by_index(struct cache* cache_t, uint32_t index);
 
@@ -558,6 +650,14 @@ protected:
     void
     mmu_cache_invalidate_all(struct cache* cache_t);
 
+    /** Clean and invalidate the lines of a physical address range
+     * @param[in, out] cache_t Cache pointer
+     * @param[in] start First address of the range
+     * @param[in] end Last address of the range (included)
+     */
+    void
+    mmu_cache_invalidate_phys(struct cache* cache_t, uint32_t start, uint32_t end);
+
     void
     mmu_cache_soft_flush(struct cache* cache_t, uint32_t pa);
 
@@ -565,6 +665,31 @@ protected:
     void
     arm_exec_cycles(int cycles);
 
+    /// Implementation of virtual function
+    void
+    arm_exit(int code);
+
+    /** Register a cache in the statistics
+     * @param[in] name Name of the cache
+     * @param[in] cache_t Cache pointer
+     */
+    void
+    mmu_stats_add(const char* name, struct cache* cache_t);
+
+    /** Register a TLB list in the statistics
+     * @param[in] name Name of the TLB
+     * @param[in] tlb TLB list pointer
+     */
+    void
+    mmu_stats_add(const char* name, struct tlb* tlb);
+
+    /** Register a write buffer list in the statistics
+     * @param[in] name Name of the write buffer
+     * @param[in] wb Write buffer list pointer
+     */
+    void
+    mmu_stats_add(const char* name, struct wb* wb);
+
 
     /// MMU control register
     uint32_t control;
@@ -583,6 +708,15 @@ protected:
 
     /// Bus interface
     struct bus m_bus;
+
+    /// Caches registered in the statistics
+    std::vector<std::pair<const char*, struct cache*> > m_stats_caches;
+    /// TLB lists registered in the statistics
+    std::vector<std::pair<const char*, struct tlb*> > m_stats_tlbs;
+    /// Write buffer lists registered in the statistics
+    std::vector<std::pair<const char*, struct wb*> > m_stats_wbs;
+    /// Number of faults delivered, indexed by fault status
+    uint64_t m_faults[16];
 };
 
 
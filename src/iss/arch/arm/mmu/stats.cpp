@@ -0,0 +1,195 @@
+/** @file stats.cpp
+ * @brief Caches, TLBs and write buffer statistics
+ *
+ * The statistics are read with the remote GDB command:
+ *  - "monitor stats": print the counters
+ *  - "monitor stats reset": clear the counters
+ *  - "monitor stats json <file>": write the counters in JSON
+ */
+#include <stdio.h>
+
+#include "mmu.h"
+
+/// Names of the fault status values
+static const char* fault_names[16] =
+{
+    NULL, "alignment", NULL, NULL, NULL, "section_translation", NULL, "page_translation",
+    NULL, "section_domain", NULL, "page_domain", NULL, "section_permission", NULL, "subpage_permission"
+};
+
+void
+mmu::mmu_stats_add(const char* name, struct cache* cache_t)
+{
+    m_stats_caches.push_back(std::make_pair(name, cache_t));
+}
+
+void
+mmu::mmu_stats_add(const char* name, struct tlb* tlb)
+{
+    m_stats_tlbs.push_back(std::make_pair(name, tlb));
+}
+
+void
+mmu::mmu_stats_add(const char* name, struct wb* wb)
+{
+    m_stats_wbs.push_back(std::make_pair(name, wb));
+}
+
+std::string
+mmu::mmu_stats_text()
+{
+    std::string text;
+    char line[256];
+    size_t i;
+
+    for (i = 0; i < m_stats_caches.size(); i++)
+    {
+        const struct cache_stats& stats = m_stats_caches[i].second->stats;
+        uint64_t accesses = stats.hits + stats.misses;
+
+        sprintf(line, "%-8s hits %llu, misses %llu (%.2f%% hit), linefills %llu, evictions %llu, "
+                "write-backs %llu\n", m_stats_caches[i].first,
+                (unsigned long long)stats.hits, (unsigned long long)stats.misses,
+                accesses ? 100.0 * stats.hits / accesses : 0.0,
+                (unsigned long long)stats.linefills, (unsigned long long)stats.evictions,
+                (unsigned long long)stats.write_backs);
+        text += line;
+    }
+    for (i = 0; i < m_stats_tlbs.size(); i++)
+    {
+        const struct tlb_stats& stats = m_stats_tlbs[i].second->stats;
+
+        sprintf(line, "%-8s hits %llu, walks %llu\n", m_stats_tlbs[i].first,
+                (unsigned long long)stats.hits, (unsigned long long)stats.walks);
+        text += line;
+    }
+    for (i = 0; i < m_stats_wbs.size(); i++)
+    {
+        const struct wb_stats& stats = m_stats_wbs[i].second->stats;
+
+        sprintf(line, "%-8s writes %llu, stalls %llu, drains %llu\n", m_stats_wbs[i].first,
+                (unsigned long long)stats.writes, (unsigned long long)stats.stalls,
+                (unsigned long long)stats.drains);
+        text += line;
+    }
+    text += "faults  ";
+    for (i = 0; i < 16; i++)
+    {
+        if (fault_names[i] != NULL)
+        {
+            sprintf(line, " %s %llu", fault_names[i], (unsigned long long)m_faults[i]);
+            text += line;
+        }
+    }
+    text += "\n";
+    return text;
+}
+
+bool
+mmu::mmu_stats_json(const char* path)
+{
+    FILE* file = fopen(path, "w");
+    const char* sep = "";
+    size_t i;
+
+    if (file == NULL)
+    {
+        return true;
+    }
+
+    fprintf(file, "{\n  \"caches\": {");
+    for (i = 0; i < m_stats_caches.size(); i++, sep = ",")
+    {
+        const struct cache_stats& stats = m_stats_caches[i].second->stats;
+
+        fprintf(file, "%s\n    \"%s\": {\"hits\": %llu, \"misses\": %llu, \"linefills\": %llu, "
+                "\"evictions\": %llu, \"write_backs\": %llu}", sep, m_stats_caches[i].first,
+                (unsigned long long)stats.hits, (unsigned long long)stats.misses,
+                (unsigned long long)stats.linefills, (unsigned long long)stats.evictions,
+                (unsigned long long)stats.write_backs);
+    }
+    fprintf(file, "\n  },\n  \"tlbs\": {");
+    for (i = 0, sep = ""; i < m_stats_tlbs.size(); i++, sep = ",")
+    {
+        const struct tlb_stats& stats = m_stats_tlbs[i].second->stats;
+
+        fprintf(file, "%s\n    \"%s\": {\"hits\": %llu, \"walks\": %llu}", sep, m_stats_tlbs[i].first,
+                (unsigned long long)stats.hits, (unsigned long long)stats.walks);
+    }
+    fprintf(file, "\n  },\n  \"write_buffers\": {");
+    for (i = 0, sep = ""; i < m_stats_wbs.size(); i++, sep = ",")
+    {
+        const struct wb_stats& stats = m_stats_wbs[i].second->stats;
+
+        fprintf(file, "%s\n    \"%s\": {\"writes\": %llu, \"stalls\": %llu, \"drains\": %llu}", sep,
+                m_stats_wbs[i].first, (unsigned long long)stats.writes, (unsigned long long)stats.stalls,
+                (unsigned long long)stats.drains);
+    }
+    fprintf(file, "\n  },\n  \"faults\": {");
+    for (i = 0, sep = ""; i < 16; i++)
+    {
+        if (fault_names[i] != NULL)
+        {
+            fprintf(file, "%s\n    \"%s\": %llu", sep, fault_names[i], (unsigned long long)m_faults[i]);
+            sep = ",";
+        }
+    }
+    fprintf(file, "\n  }\n}\n");
+    fclose(file);
+    return false;
+}
+
+void
+mmu::mmu_stats_reset()
+{
+    size_t i;
+
+    for (i = 0; i < m_stats_caches.size(); i++)
+    {
+        memset(&m_stats_caches[i].second->stats, 0, sizeof(struct cache_stats));
+    }
+    for (i = 0; i < m_stats_tlbs.size(); i++)
+    {
+        memset(&m_stats_tlbs[i].second->stats, 0, sizeof(struct tlb_stats));
+    }
+    for (i = 0; i < m_stats_wbs.size(); i++)
+    {
+        memset(&m_stats_wbs[i].second->stats, 0, sizeof(struct wb_stats));
+    }
+    memset(m_faults, 0, sizeof(m_faults));
+}
+
+bool
+mmu::gdb_monitor(const char* name, const char* args, std::string& output)
+{
+    if (strcmp(name, "stats") != 0)
+    {
+        return false;
+    }
+
+    if (*args == '\0')
+    {
+        output = this->mmu_stats_text();
+    }
+    else if (strcmp(args, "reset") == 0)
+    {
+        this->mmu_stats_reset();
+        output = "stats cleared\n";
+    }
+    else if ((strncmp(args, "json ", 5) == 0) && (args[5] != '\0'))
+    {
+        if (this->mmu_stats_json(args + 5))
+        {
+            output = std::string("can not create stats file ") + (args + 5) + "\n";
+        }
+        else
+        {
+            output = std::string("stats written to ") + (args + 5) + "\n";
+        }
+    }
+    else
+    {
+        output = "usage: monitor stats [reset|json <file>]\n";
+    }
+    return true;
+}
@@ -136,6 +136,10 @@ mmu::translate(uint32_t virt_addr, struct tlb* tlb, struct tlb_entry** tlb_entry
 {
     // check if the corresponding TLB is already loaded
     *tlb_entry = mmu_tlb_search(tlb, virt_addr);
+    if (*tlb_entry)
+    {
+        tlb->stats.hits++;
+    }
 
     // if the entry is not found, then fetch it
     if (!*tlb_entry)
@@ -144,6 +148,8 @@ mmu::translate(uint32_t virt_addr, struct tlb* tlb, struct tlb_entry** tlb_entry
         uint32_t l1addr, l1desc;
         struct tlb_entry entry;
 
+        tlb->stats.walks++;
+
         // retrieve the first level descriptor
         l1addr = translation_table_base & 0xFFFFC000;
         l1addr = (l1addr | (virt_addr >> 18)) & ~3;
@@ -275,6 +281,7 @@ mmu::mmu_tlb_init(struct tlb* tlb, int num)
     // save the TLB list
     tlb->cycle = 0;
     tlb->num = num;
+    memset(&tlb->stats, 0, sizeof(tlb->stats));
     return 0;
 
 tlb_malloc_error:
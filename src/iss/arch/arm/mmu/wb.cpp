@@ -31,6 +31,7 @@ mmu::mmu_wb_init(struct wb* wb, int num, int nb)
     wb->num = num;
     wb->nb = nb;
     wb->entries = wb_entries;
+    memset(&wb->stats, 0, sizeof(wb->stats));
     return 0;
 
 };
@@ -64,6 +65,8 @@ mmu::mmu_wb_write_bytes(struct wb* wb, uint32_t pa, uint8_t* data, uint32_t n)
             // flush the last write buffer entry
             uint32_t t;
 
+            wb->stats.stalls++;
+
             // retrieve the last element
             wb_entry = &wb->entries[wb->last];
             // get its physical address
@@ -116,6 +119,7 @@ mmu::mmu_wb_write_bytes(struct wb* wb, uint32_t pa, uint8_t* data, uint32_t n)
         }
         // increment the number of used wb
         wb->used++;
+        wb->stats.writes++;
     };
 }
 
@@ -126,6 +130,11 @@ mmu::mmu_wb_drain_all(struct wb* wb)
     struct wb_entry *wb_entry;
     uint32_t i;
 
+    if (wb->used)
+    {
+        wb->stats.drains++;
+    }
+
     // loop on all used entries
     while (wb->used)
     {
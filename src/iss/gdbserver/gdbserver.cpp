@@ -10,12 +10,15 @@
 #include <stdarg.h>
 #include <errno.h>
 #include <fcntl.h>
+#include <unistd.h>
 #include <signal.h>
 #include <sys/socket.h>
 #include <netinet/tcp.h>
 #include <netinet/in.h>
 #include <assert.h>
 
+#include <vector>
+
 #include "gdbserver.h"
 
 
@@ -33,6 +36,17 @@ enum {
     GDB_SYS_DISABLED,
 } gdb_syscall_mode;
 
+/// Command of the remote GDB "monitor" command
+struct monitor_command
+{
+    const char* name;
+    gdbserver::monitor_cb cb;
+    void* opaque;
+};
+
+/// Registered monitor commands
+static std::vector<monitor_command> monitor_commands;
+
 static inline int fromhex(int v)
 {
     if (v >= '0' && v <= '9')
@@ -305,6 +319,15 @@ gdbserver::RSState gdbserver::handle_packet(const char *line_buf)
         this->put_packet("E22");
         }
         break;
+    case 'q':
+        if (strncmp(p, "Rcmd,", 5) == 0) {
+            this->monitor(p + 5);
+            break;
+        }
+        /* put empty packet */
+        buf[0] = '\0';
+        this->put_packet(buf);
+        break;
     case 'z':
         type = strtoul(p, (char **)&p, 16);
         if (*p == ',')
@@ -334,6 +357,64 @@ gdbserver::RSState gdbserver::handle_packet(const char *line_buf)
 }
 
 
+void gdbserver::add_monitor(const char* name, monitor_cb cb, void* opaque)
+{
+    monitor_command command;
+
+    command.name = name;
+    command.cb = cb;
+    command.opaque = opaque;
+    monitor_commands.push_back(command);
+}
+
+void gdbserver::monitor(const char *hex)
+{
+    char line[2048];
+    char buf[4096];
+    std::string output;
+    size_t len, i;
+    char *args;
+
+    // decode the command line
+    len = strlen(hex) / 2;
+    if (len >= sizeof(line))
+        len = sizeof(line) - 1;
+    hextomem((uint8_t *)line, hex, len);
+    line[len] = '\0';
+
+    // split the name of the command from its arguments
+    args = line;
+    while ((*args != '\0') && (*args != ' '))
+        args++;
+    if (*args != '\0')
+        *args++ = '\0';
+    while (*args == ' ')
+        args++;
+
+    output = "unknown monitor command, available:";
+    output += this->gdb_monitor_names();
+    for (i = 0; i < monitor_commands.size(); i++)
+        output += std::string(" ") + monitor_commands[i].name;
+    output += "\n";
+    if (!this->gdb_monitor(line, args, output)) {
+        for (i = 0; i < monitor_commands.size(); i++) {
+            if (strcmp(line, monitor_commands[i].name) == 0) {
+                output = monitor_commands[i].cb(monitor_commands[i].opaque, args);
+                break;
+            }
+        }
+    }
+
+    // send the output as console packets, then the end of the command
+    for (i = 0; i < output.size(); i += 1024) {
+        len = (output.size() - i < 1024) ? output.size() - i : 1024;
+        buf[0] = 'O';
+        memtohex(buf + 1, (const uint8_t *)output.data() + i, len);
+        this->put_packet(buf);
+    }
+    this->put_packet("OK");
+}
+
 void gdbserver::do_syscall(syscall_complete_cb cb, char *fmt, ...)
 {
     va_list va;
@@ -585,6 +666,18 @@ void gdbserver::start(int port, bool enabled, bool blocking)
     }
 }
 
+gdbserver::~gdbserver()
+{
+    if (m_clientfd >= 0)
+    {
+        ::close(m_clientfd);
+    }
+    if (m_serverfd >= 0)
+    {
+        ::close(m_serverfd);
+    }
+}
+
 void gdbserver::end(int code)
 {
     char buf[4];
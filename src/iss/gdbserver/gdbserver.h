@@ -8,6 +8,7 @@
 #define GDBSERVER_H_
 
 #include <iostream>
+#include <string>
 #include <stdint.h>
 #include "signal.h"
 
@@ -16,12 +17,22 @@ struct gdbserver
     /// Define the syscall callback type
     typedef void (*syscall_complete_cb)(int, int);
 
+    /** Define the monitor command callback type
+     * @param[in] opaque Pointer registered with the command
+     * @param[in] args Arguments following the command name
+     * @return The text printed by the remote GDB
+     */
+    typedef std::string (*monitor_cb)(void* opaque, const char* args);
+
     /// Constructor
-    gdbserver(): m_serverfd(-1)
+    gdbserver(): m_clientfd(-1), m_serverfd(-1)
     {
 
     }
 
+    /// Destructor: close the connection and release the server port
+    virtual ~gdbserver();
+
     /** Configure GDB server to support syscalls
      * If gdb is connected when the first semihosting syscall occurs then use
      * remote gdb syscalls.  Otherwise use native file IO.
@@ -73,6 +84,32 @@ struct gdbserver
      */
     void do_syscall(syscall_complete_cb cb, char *fmt, ...);
 
+    /** Register a command of the remote GDB "monitor" command (shared by all the servers)
+     * @param[in] name Name of the command
+     * @param[in] cb Callback executing the command
+     * @param[in] opaque Pointer passed to the callback
+     */
+    static void add_monitor(const char* name, monitor_cb cb, void* opaque);
+
+    /** Execute a "monitor" command of this server (before the shared ones)
+     * @param[in] name Name of the command
+     * @param[in] args Arguments following the command name
+     * @param[out] output The text printed by the remote GDB
+     * @return true if the command was executed, false if it is unknown
+     */
+    virtual bool gdb_monitor(const char* name, const char* args, std::string& output)
+    {
+        return false;
+    }
+
+    /** Get the names of the "monitor" commands of this server
+     * @return The names, each preceded by a space
+     */
+    virtual const char* gdb_monitor_names()
+    {
+        return "";
+    }
+
     /** Indicate to the ISS that the next run cycle has to last only one instruction
      * @param yesno If 0, step mode disabled, otherwise enabled
      */
@@ -217,6 +254,11 @@ private:
      */
     bool cpu_gdb_rw_memory(uint32_t addr, uint8_t* buf, uint32_t len, uint8_t rw);
 
+    /** Execute a monitor command and send its output to the remote GDB
+     * @param[in] hex Command line, hex encoded
+     */
+    void monitor(const char* hex);
+
     /// Remote GDB received char parsing state
     enum RSState m_state;
     /// Packet buffer
@@ -1,21 +1,36 @@
 #include <vector>
 
+#include <unistd.h>
+#include <sys/wait.h>
+
 #include "Top/Top.h"
 #include "Bob/Bob.h"
 #include "At91sam9261/At91sam9261.h"
 #include "Mc13224v/Mc13224v.h"
 #include "B2070/B2070.h"
+#include "Bench/Bench.h"
+#include "Link/Link.h"
 
 void usage(void)
 {
     printf("\n"
             "Synopsis:\n"
-            "    open-socemu [-d] (configfile)\n\n"
+            "    open-socemu [-d] [-n count] [-t time] [-s stop] [-x address]\n"
+            "        [-w seconds] (configfile) [configfile...]\n\n"
             "Parameters:\n"
             "    - -d : indicates that the connection to the debugger should\n"
             "        be polled on before starting the execution\n\n"
+            "    - -n count : stops once a core executed count instructions\n\n"
+            "    - -t time : stops after a simulated time (s, ms, us or ns\n"
+            "        suffix, seconds by default)\n\n"
+            "    - -s stop : stops once a core executed the instruction at a\n"
+            "        symbol of its ELF file or an address, exit code in r0\n\n"
+            "    - -x address : stops when the firmware writes the word at\n"
+            "        address, exit code written\n\n"
+            "    - -w seconds : stops after a wall time, exit code 124\n\n"
             "    - configfile : XML file containing the configuration of the\n"
-            "        plateform.\n\n");
+            "        plateform. With several files, each platform is simulated\n"
+            "        by its own process (joined by a link domain).\n\n");
 
 }
 
@@ -32,6 +47,47 @@ void recurse_parameters(int level, MSP *children)
     }
 }
 
+/** Simulate each platform in its own process
+ * @param[in] configfiles Configuration files of the platforms
+ * @param[out] status Exit status of the first platform that failed (0 if none)
+ * @return The index of the configuration file in the child processes, -1 in the parent
+ *  process once all the children have ended
+ */
+int run_platforms(std::vector<char*>& configfiles, int& status)
+{
+    std::vector<pid_t> children;
+    size_t i;
+    int child;
+
+    for (i = 0; i < configfiles.size(); i++)
+    {
+        pid_t pid = fork();
+
+        if (pid == 0)
+        {
+            return i;
+        }
+        if (pid < 0)
+        {
+            printf("\nERROR: can not create the process of %s\n", configfiles[i]);
+            status = -1;
+            break;
+        }
+        children.push_back(pid);
+    }
+
+    // the simulation ends with the first failure of a platform
+    for (i = 0; i < children.size(); i++)
+    {
+        waitpid(children[i], &child, 0);
+        if ((status == 0) && (!WIFEXITED(child) || (WEXITSTATUS(child) != 0)))
+        {
+            status = WIFEXITED(child) ? WEXITSTATUS(child) : -1;
+        }
+    }
+    return -1;
+}
+
 /// Main SystemC entry point to our environment
 int sc_main(int argc, char* argv[])
 {
@@ -41,6 +97,7 @@ int sc_main(int argc, char* argv[])
     char *configfile, *opt, *buf;
     char line[4096];
     std::vector<MSP*> stack;
+    std::vector<char*> configfiles;
     int i;
     FILE* fp;
     size_t pos;
@@ -49,23 +106,13 @@ int sc_main(int argc, char* argv[])
     // initialize the parameters
     parameters.gdb_wait.set_string("FALSE");
 
-    // initialize the configuration file
-    configfile = NULL;
-
     for (i = 1; i < argc; i++)
     {
         // retrieve the current option
         opt = argv[i];
         if (opt[0] != '-')
         {
-            // check if another configuration file was not specified
-            if (configfile != NULL)
-            {
-                usage();
-                printf("\nERROR: configuration file (%s) already provided, (%s) is extra\n", configfile, opt);
-                return -1;
-            }
-            configfile = opt;
+            configfiles.push_back(opt);
         }
         else
         {
@@ -78,6 +125,30 @@ int sc_main(int argc, char* argv[])
             case 'd':
                 parameters.gdb_wait.set_string("TRUE");
                 break;
+            case 'n':
+            case 't':
+            case 's':
+            case 'x':
+            case 'w':
+                // option followed by its value
+                if (i + 1 == argc)
+                {
+                    usage();
+                    printf("\nERROR: value missing (%s)\n", opt);
+                    return -1;
+                }
+                i++;
+                if (opt[1] == 'n')
+                    parameters.instructions.set_string(argv[i]);
+                else if (opt[1] == 't')
+                    parameters.time.set_string(argv[i]);
+                else if (opt[1] == 's')
+                    parameters.stop.set_string(argv[i]);
+                else if (opt[1] == 'x')
+                    parameters.exitword.set_string(argv[i]);
+                else
+                    parameters.watchdog.set_string(argv[i]);
+                break;
             default:
                 usage();
                 printf("\nERROR: unsupported parameter (%s)\n", opt);
@@ -89,13 +160,31 @@ int sc_main(int argc, char* argv[])
     }
 
     // check that at least a configuration file was provided
-    if (configfile == NULL)
+    if (configfiles.empty())
     {
         usage();
         printf("\nERROR: configuration file not provided\n");
         return -1;
     }
 
+    // several platforms: one process each, the parent only waits for them
+    parameters.platforms = configfiles.size();
+    if (configfiles.size() > 1)
+    {
+        int status = 0;
+
+        i = run_platforms(configfiles, status);
+        if (i < 0)
+        {
+            return status;
+        }
+        configfile = configfiles[i];
+    }
+    else
+    {
+        configfile = configfiles[0];
+    }
+
     // save the configfile in the parameters structure
     parameters.configfile.assign(configfile);
 
@@ -262,6 +351,45 @@ int sc_main(int argc, char* argv[])
     }
     parameter = parameters.config["platform"];
 
+    // start the runtime trace if requested
+    if (parameters.config.count("trace") == 1)
+    {
+        Trace::configure(parameters, *parameters.config["trace"]);
+    }
+
+    // report the simulator performance if requested
+    if (parameters.config.count("perf") == 1)
+    {
+        Perf::configure(parameters, *parameters.config["perf"]);
+    }
+
+    // record the timeline of the process activity if requested
+    if (parameters.config.count("timeline") == 1)
+    {
+        Timeline::configure(parameters, *parameters.config["timeline"]);
+    }
+
+    // count the memory accesses if requested
+    if (parameters.config.count("heatmap") == 1)
+    {
+        Heatmap::configure(parameters, *parameters.config["heatmap"]);
+    }
+
+    // count the peripheral register accesses if requested
+    if (parameters.config.count("regstats") == 1)
+    {
+        RegStats::configure(parameters, *parameters.config["regstats"]);
+    }
+
+    // stop conditions of the command line
+    RunControl::configure(parameters);
+
+    // join the processes simulating the other platforms if requested
+    if (parameters.config.count("link") == 1)
+    {
+        Link::configure(parameters, *parameters.config["link"]);
+    }
+
     // check if it is an AT91SAM9261 platform that is requested
     if (*parameter == "at91sam9261")
     {
@@ -285,14 +413,18 @@ int sc_main(int argc, char* argv[])
         // create the Top level system
         Bob bob("top", parameters, *parameter);
     }
+    else if (*parameter == "bench")
+    {
+        // create the benchmarks platform (kept alive until the simulation stops)
+        new Bench("bench", parameters, *parameter);
+    }
     else
     {
         printf("\nERROR: unknown platform %s\n", parameter->c_str());
         return -1;
     }
 
-    // start the simulation
-    sc_core::sc_start();
-    return 0;
+    // start the simulation, until a stop condition is met
+    return RunControl::start();
 }
 
@@ -268,7 +268,7 @@ private:
             else
             {
                 // othewise wait for an event to wake it up
-                sc_core::wait(m_dma_event);
+                TIMELINE_WAIT(m_dma_event);
             }
         }
     }
@@ -431,7 +431,7 @@ private:
             {
                 m_dma[dmach].state = SANITYCHECK;
                 // wake up the DMA thread
-                m_dma_event.notify();
+                TIMELINE_NOTIFY(m_dma_event);
             }
             break;
             
@@ -480,7 +480,7 @@ private:
     master_invalidate_direct_mem_ptr(sc_dt::uint64 start_range,
                                      sc_dt::uint64 end_range)
     {
-        SC_REPORT_FATAL("TLM-2", "DMI not implemented");
+        // no direct memory pointer is kept, nothing to drop
     }
 };
 
@@ -58,6 +58,7 @@ struct Pl190 : Peripheral<REG_PL190_COUNT>
         for (int i = 0; i < NUM_INT; i++)
         {
             this->vicintsource[i].init(this, &Pl190::int_set_cb, &Pl190::int_clr_cb, (void*)i);
+            m_vectslots[i] = 0;
         }
 
         // initialize the registers content
@@ -140,6 +141,13 @@ private:
             m_reg[REG_PL190_SOFTINT] &= ~value;
             break;
 
+        case REG_PL190_INTSELECT:
+        case REG_PL190_INTENABLE:
+        case REG_PL190_SOFTINT:
+        case REG_PL190_DEFVECTADDR:
+            m_reg[index] = value;
+            break;
+
         case REG_PL190_IRQSTATUS:
         case REG_PL190_FIQSTATUS:
         case REG_PL190_RAWINTR:
@@ -152,16 +160,49 @@ private:
         case REG_PL190_PCELLID2:
         case REG_PL190_PCELLID3:
             TLM_ERR("write access to read-only register (%d)", index);
-            break;
+            return;
             
         default:
             m_reg[index] = value;
+
+            // vector control change the source to slot mapping
+            if ((index >= REG_PL190_VECTCNTL0) && (index < (REG_PL190_VECTCNTL0 + 16)))
+            {
+                this->update_vectslots();
+            }
+            // other registers than the vector addresses (the current one being the end
+            // of interrupt) do not change the interrupt lines
+            else if ((index != REG_PL190_VECTADDR) &&
+                     ((index < REG_PL190_VECTADDR0) || (index >= (REG_PL190_VECTADDR0 + 16))))
+            {
+                return;
+            }
             break;
         }
-        // always update the interrupts after a write access
+        // update the interrupts after a configuration change
         this->update_int();
     }
 
+    /// Rebuild the vector slots enabled for each interrupt source
+    void
+    update_vectslots(void)
+    {
+        int i;
+
+        for (i = 0; i < NUM_INT; i++)
+        {
+            m_vectslots[i] = 0;
+        }
+        for (i = 0; i < 16; i++)
+        {
+            // check if it is enabled
+            if (m_reg[REG_PL190_VECTCNTL0 + i] & (1 << 5))
+            {
+                m_vectslots[m_reg[REG_PL190_VECTCNTL0 + i] & 0x1F] |= (1 << i);
+            }
+        }
+    }
+
     /// Interrupt set callback
     /// @param[in] opaque Pointer passed in parameter when registering
     void
@@ -174,6 +215,13 @@ private:
         // set the interrupt
         m_vicintsource |= 1 << i;
         
+        // a disabled source only changes the raw status
+        if ((m_reg[REG_PL190_INTENABLE] & (1 << i)) == 0)
+        {
+            m_reg[REG_PL190_RAWINTR] = m_vicintsource | m_reg[REG_PL190_SOFTINT];
+            return;
+        }
+
         // update the interrupt
         this->update_int();
     }
@@ -190,6 +238,13 @@ private:
         // clear the interrupt
         m_vicintsource &= ~(1 << i);
 
+        // a disabled source only changes the raw status
+        if ((m_reg[REG_PL190_INTENABLE] & (1 << i)) == 0)
+        {
+            m_reg[REG_PL190_RAWINTR] = m_vicintsource | m_reg[REG_PL190_SOFTINT];
+            return;
+        }
+
         // update the interrupt
         this->update_int();
     }
@@ -197,7 +252,8 @@ private:
     void
     update_int(void)
     {
-        int i;
+        uint32_t pending;
+        uint32_t slots;
         
         // OR with the soft interrupt sources
         m_reg[REG_PL190_RAWINTR] = m_vicintsource | m_reg[REG_PL190_SOFTINT];
@@ -208,24 +264,17 @@ private:
         m_reg[REG_PL190_FIQSTATUS] = m_reg[REG_PL190_RAWINTR] & m_reg[REG_PL190_INTENABLE] & 
                 m_reg[REG_PL190_INTSELECT];
         
-        // Vector block operation
-        for (i = 0; i < 16; i++)
+        // Vector block operation: slots of the pending sources, lowest slot first
+        slots = 0;
+        for (pending = m_reg[REG_PL190_IRQSTATUS]; pending != 0; pending &= pending - 1)
         {
-            // check if it is enabled
-            if (m_reg[REG_PL190_VECTCNTL0 + i] & (1 << 5))
-            {
-                // check if the selected interrupt is set
-                if (m_reg[REG_PL190_IRQSTATUS] & (1 << (m_reg[REG_PL190_VECTCNTL0 + i] & 0x1F)))
-                {
-                    break;
-                }
-            }
+            slots |= m_vectslots[BIT_LSB(pending)];
         }
 
         // check if a vectored interrupt was found
-        if (i < 16)
+        if (slots != 0)
         {
-            m_reg[REG_PL190_VECTADDR] = m_reg[REG_PL190_VECTADDR0 + i];
+            m_reg[REG_PL190_VECTADDR] = m_reg[REG_PL190_VECTADDR0 + BIT_LSB(slots)];
         }
         else
         {
@@ -271,6 +320,9 @@ private:
     }
     
     uint32_t m_vicintsource;
+
+    /// Mask of the enabled vector slots assigned to each interrupt source
+    uint32_t m_vectslots[NUM_INT];
 };
 
 #endif /*PL190_H_*/
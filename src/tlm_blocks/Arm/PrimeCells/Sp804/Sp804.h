@@ -161,7 +161,7 @@ private:
             
             PERIPHERAL_DBG("start t1 value = 0x%08X", m_reg[REG_SP804_TIMER1_VALUE]);
             // restart the event
-            m_t1event.notify(m_t1ckperiod * m_reg[REG_SP804_TIMER1_VALUE] * 
+            TIMELINE_NOTIFY(m_t1event, m_t1ckperiod * m_reg[REG_SP804_TIMER1_VALUE] * 
                     (1 << (GETF(m_reg[REG_SP804_TIMER1_CONTROL], 0xc, 2) * 4)));
         }
     }
@@ -202,7 +202,7 @@ private:
             
             PERIPHERAL_DBG("start t2 value = 0x%08X", m_reg[REG_SP804_TIMER2_VALUE]);
             // restart the event
-            m_t2event.notify(m_t2ckperiod * m_reg[REG_SP804_TIMER2_VALUE] * 
+            TIMELINE_NOTIFY(m_t2event, m_t2ckperiod * m_reg[REG_SP804_TIMER2_VALUE] * 
                     (1 << (GETF(m_reg[REG_SP804_TIMER2_CONTROL], 0xc, 2) * 4)));
         }
     }
@@ -230,7 +230,7 @@ private:
         while (true)
         {
             // wait for an event
-            sc_core::wait(m_t1event);
+            TIMELINE_WAIT(m_t1event);
             
             PERIPHERAL_DBG("t1 expired");
 
@@ -270,7 +270,7 @@ private:
         while (true)
         {
             // wait for an event
-            sc_core::wait(m_t2event);
+            TIMELINE_WAIT(m_t2event);
 
             PERIPHERAL_DBG("t2 expired");
 
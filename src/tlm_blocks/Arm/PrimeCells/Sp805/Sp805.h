@@ -119,7 +119,7 @@ private:
         }
         
         // restart the event
-        m_event.notify(m_ckperiod * m_reg[REG_SP805_WDOGLOAD]);
+        TIMELINE_NOTIFY(m_event, m_ckperiod * m_reg[REG_SP805_WDOGLOAD]);
     }
 
     /// Stop the counter
@@ -144,7 +144,7 @@ private:
         while (true)
         {
             // wait for an event
-            sc_core::wait(m_event);
+            TIMELINE_WAIT(m_event);
 
             // check if this is the first time
             if (!m_inted)
@@ -4,100 +4,93 @@
 /// Used to select debugging (0 = OFF, 1 = ON)
 #define DEBUG_AIC 0
 
-// Used to make direct register access
-uint32_t* reg_aic;
-
 // using this namespace to simplify streaming
 using namespace std;
 
-/** Register read function
- * @param[in] offset Offset of the register to read
- * @return The value read
- */
-uint32_t
-Aic::reg_rd(uint32_t offset)
+void
+Aic::aic_smr_wr(uint32_t idx, uint32_t value)
 {
-    // retrieve the required parameters
-    uint32_t index = offset/4;
+    // move the source to its new priority level
+    m_prio[aic_smr_prior_getf(idx)] &= ~(1 << idx);
+    aic_smr_set(idx, value);
+    m_prio[aic_smr_prior_getf(idx)] |= (1 << idx);
+
+    // the interrupt configuration has changed
+    check_int();
+}
 
-    // sanity check
-    assert(index < REG_AIC_COUNT);
+void
+Aic::aic_svr_wr(uint32_t idx, uint32_t value)
+{
+    // vector may be the one currently presented
+    aic_svr_set(idx, value);
 
-    return m_reg[index];
+    // the interrupt configuration has changed
+    check_int();
 }
 
-/** Register write function
- * @param[in] offset Offset of the register to read
- */
 void
-Aic::reg_wr(uint32_t offset, uint32_t value)
+Aic::aic_iecr_wr(uint32_t value)
 {
-    // retrieve the required parameters
-    uint32_t index = offset/4;
+    aic_imr_set(aic_imr_get() | value);
 
-    // sanity check
-    assert(index < REG_AIC_COUNT);
+    // the interrupt configuration has changed
+    check_int();
+}
 
-    switch (index)
-    {
-    case AIC_IECR_INDEX:
-        // when writing to this register
-        aic_imr_set(aic_imr_get() | value);
-        break;
-    case AIC_IDCR_INDEX:
-        aic_imr_set(aic_imr_get() & (~value));
-        break;
-    case AIC_IMR_INDEX:
-        // read only register
-        break;
-    case AIC_FFER_INDEX:
-        aic_ffsr_set(aic_ffsr_get() | value);
-        break;
-    case AIC_FFDR_INDEX:
-        aic_ffsr_set(aic_ffsr_get() & (~value));
-        break;
-    case AIC_FFSR_INDEX:
-        // read only register
-        break;
-    default:
-        m_reg[index] = value;
-        break;
-    }
+void
+Aic::aic_idcr_wr(uint32_t value)
+{
+    aic_imr_set(aic_imr_get() & (~value));
+
+    // the interrupt configuration has changed
+    check_int();
+}
+
+void
+Aic::aic_ffer_wr(uint32_t value)
+{
+    aic_ffsr_set(aic_ffsr_get() | value);
+
+    // the interrupt configuration has changed
+    check_int();
+}
+
+void
+Aic::aic_ffdr_wr(uint32_t value)
+{
+    aic_ffsr_set(aic_ffsr_get() & (~value));
 
-    // check if interrupt configuration has changed
+    // the interrupt configuration has changed
     check_int();
 }
 
 void
 Aic::check_int()
 {
-    // find the highest interrupt pending
-    unsigned i;
     uint32_t mask;
+    uint32_t fiq_mask;
+    uint32_t irq_mask;
 
     mask = aic_ipr_get() & aic_imr_get();
 
+    // source 0 is always a FIQ, others only if fast forced
+    fiq_mask = mask & (aic_ffsr_get() | 1);
+    irq_mask = mask & ~(aic_ffsr_get() | 1);
+
     // by default clear all IRQ and FIQ
     aic_cisr_set(0);
 
-    // generate the FIQ
-    for (i = 0; i < 32; i++)
+    // generate the FIQ (lowest source number first)
+    if (fiq_mask != 0)
     {
-        // check if FIQ is pending (special case for PID0 = FIQ)
-        if (((i == 0) && (mask & 1)) || (aic_ffsr_get() & mask & (1 << i)))
-        {
-            // the current interrupt source number
-            aic_isr_set(i);
-            // FIQ pending
-            aic_cisr_set(aic_cisr_get() | NFIQ_BIT);
-            // FIQ vector
-            aic_fvr_set(aic_svr_get(0));
+        // the current interrupt source number
+        aic_isr_set(BIT_LSB(fiq_mask));
+        // FIQ pending
+        aic_cisr_set(NFIQ_BIT);
+        // FIQ vector
+        aic_fvr_set(aic_svr_get(0));
 
-            break;
-        }
-    }
-    if (aic_cisr_nfiq_getf())
-    {
         // set the FIQ
         this->fiq.set();
     }
@@ -107,28 +100,31 @@ Aic::check_int()
         this->fiq.clear();
     }
 
-    // generate the IRQ
-    for (i = 1; i < 32; i++)
+    // generate the IRQ (highest priority level, then lowest source number)
+    if (irq_mask != 0)
     {
-        // check if IRQ is pending (special case for PID0 = FIQ)
-        if ((~aic_ffsr_get()) & mask & (1 << i))
+        uint32_t i;
+        int level;
+
+        // look for the highest level with a pending source
+        level = 7;
+        while ((irq_mask & m_prio[level]) == 0)
         {
-            // update the ISR except if there is already an FIQ pending
-            if (aic_cisr_nfiq_getf() == 0)
-            {
-                // the current interrupt source number
-                aic_isr_set(i);
-            }
-            // IRQ pending
-            aic_cisr_set(aic_cisr_get() | NIRQ_BIT);
-            // FIQ vector
-            aic_ivr_set(m_reg[AIC_SVR_INDEX+i]);
-
-            break;
+            level--;
         }
-    }
-    if (aic_cisr_nirq_getf())
-    {
+        i = BIT_LSB(irq_mask & m_prio[level]);
+
+        // update the ISR except if there is already an FIQ pending
+        if (fiq_mask == 0)
+        {
+            // the current interrupt source number
+            aic_isr_set(i);
+        }
+        // IRQ pending
+        aic_cisr_set(aic_cisr_get() | NIRQ_BIT);
+        // IRQ vector
+        aic_ivr_set(aic_svr_get(i));
+
         // set the IRQ
         this->irq.set();
     }
@@ -147,8 +143,11 @@ Aic::interrupt_set(void* opaque)
     // set the register value
     aic_ipr_set(aic_ipr_get() | (1 << id));
 
-    // check if interrupt configuration has changed
-    check_int();
+    // a masked source does not change the interrupt lines
+    if (aic_imr_get() & (1 << id))
+    {
+        check_int();
+    }
 }
 
 void
@@ -159,6 +158,9 @@ Aic::interrupt_clr(void* opaque)
     // clear the register value
     aic_ipr_set(aic_ipr_get() & (~(1 << id)));
 
-    // check if interrupt configuration has changed
-    check_int();
+    // a masked source does not change the interrupt lines
+    if (aic_imr_get() & (1 << id))
+    {
+        check_int();
+    }
 }
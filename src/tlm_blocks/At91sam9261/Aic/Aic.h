@@ -1,29 +1,30 @@
 #ifndef AIC_H_
 #define AIC_H_
 
-// this is a peripheral
-#include "Generic/Peripheral/Peripheral.h"
-
 // with 2 interrupt masters
 #include "Generic/IntMaster/IntMaster.h"
 
 // and 32 int slaves
 #include "Generic/IntSlave/IntSlave.h"
 
-// include the registers definition
+// this is a peripheral with the registers definition
 #include "reg_aic.h"
 
 /// Advanced Interrupt Controller block model
-struct Aic : Peripheral<REG_AIC_COUNT>
+struct Aic : RegAic<Aic>
 {
     /// Constructor
     Aic(sc_core::sc_module_name name)
-    : Peripheral<REG_AIC_COUNT>(name)
+    : RegAic<Aic>(name)
     , irq("irq")
     , fiq("fiq")
     {
-        // initialize the register access
-        reg_aic = &(m_reg[0]);
+        // all the sources are at the lowest priority after reset
+        m_prio[0] = 0xFFFFFFFF;
+        for (int i = 1; i < 8; i++)
+        {
+            m_prio[i] = 0;
+        }
 
         // initialize the slave interrupt
         for (int i = 0; i < 32; i++)
@@ -48,19 +49,61 @@ struct Aic : Peripheral<REG_AIC_COUNT>
     void check_int();
 
 private:
-    /** Register read function
-     * @param[in] offset Offset of the register to read
-     * @return The value read
+    // the register map dispatches the accesses to the register hooks
+    friend struct RegAic<Aic>;
+
+    /// Mask of the interrupt sources for each of the 8 priority levels
+    uint32_t m_prio[8];
+
+    /** AIC_SMR register write hook: move the source to its new priority level
+     * @param[in] idx Number of the interrupt source
+     * @param[in] value Value written in the register
+     */
+    void
+    aic_smr_wr(uint32_t idx, uint32_t value);
+
+    /** AIC_SVR register write hook: the vector may be the one currently presented
+     * @param[in] idx Number of the interrupt source
+     * @param[in] value Value written in the register
+     */
+    void
+    aic_svr_wr(uint32_t idx, uint32_t value);
+
+    /** AIC_IECR register write hook: enable the interrupts written to 1
+     * @param[in] value Value written in the register
+     */
+    void
+    aic_iecr_wr(uint32_t value);
+
+    /** AIC_IDCR register write hook: disable the interrupts written to 1
+     * @param[in] value Value written in the register
      */
-    uint32_t
-    reg_rd(uint32_t offset);
+    void
+    aic_idcr_wr(uint32_t value);
 
-    /** Register write function
-     * @param[in] offset Offset of the register to read
-     * @param[in] offset Value to write in the register
+    /** AIC_FFER register write hook: force the interrupts written to 1 to FIQ
+     * @param[in] value Value written in the register
      */
     void
-    reg_wr(uint32_t offset, uint32_t value);
+    aic_ffer_wr(uint32_t value);
+
+    /** AIC_FFDR register write hook: stop forcing the interrupts written to 1
+     * @param[in] value Value written in the register
+     */
+    void
+    aic_ffdr_wr(uint32_t value);
+
+    /// AIC_IMR register write hook: read only register, the write is ignored
+    void
+    aic_imr_wr(uint32_t value)
+    {
+    }
+
+    /// AIC_FFSR register write hook: read only register, the write is ignored
+    void
+    aic_ffsr_wr(uint32_t value)
+    {
+    }
 
     /** Interrupt set handler
      * @param[in] opaque Pointer passed in parameter when registering
@@ -5,6 +5,9 @@
 #define SRAM_BASE_ADDR (0x00000000)
 #define SRAM_SIZE (0x28000)
 
+// AIC source of the external interrupt IRQ0 (IRQ1 and IRQ2 follow)
+#define IRQ0_SOURCE (29)
+
 At91sam9261::At91sam9261(sc_core::sc_module_name name, Parameters& parameters, MSP& config)
 {
     Parameter *cpu_parameter;
@@ -65,6 +68,33 @@ At91sam9261::At91sam9261(sc_core::sc_module_name name, Parameters& parameters, M
     this->aic->irq.bind(this->cpu->irq);
     this->aic->fiq.bind(this->cpu->fiq);
 
+    // IRQ0 to IRQ2:
+    //   - driven by other platforms through link channels, if any
+    for (int i = 0; i < 3; i++)
+    {
+        tlm_utils::simple_initiator_socket<At91sam9261>* dummy_m_socket;
+        char key[8];
+        char dummy[24];
+
+        sprintf(key, "irq%d", i);
+        this->irq[i] = NULL;
+        if (config.count(key) == 0)
+        {
+            continue;
+        }
+        if (*config[key]->get_lowercase() != "link")
+        {
+            TLM_ERR("unknown %s connection %s (link)", key, config[key]->c_str());
+            return;
+        }
+        this->irq[i] = new IntLink(key, Link::channel(key, *config[key], "irq"));
+        this->irq[i]->output.bind(this->aic->interrupts[IRQ0_SOURCE + i]);
+        //   - no local source on the pins
+        sprintf(dummy, "dummy_irq%d_m_socket", i);
+        dummy_m_socket = new tlm_utils::simple_initiator_socket<At91sam9261>(dummy);
+        dummy_m_socket->bind(this->irq[i]->input);
+    }
+
 #if 0
     // create a trace file
     sc_trace_file* Tf;
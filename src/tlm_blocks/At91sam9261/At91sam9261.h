@@ -14,6 +14,7 @@
 #include "Generic/AddrDec/AddrDec.h"
 #include "Cpu/Cpu.h"
 #include "Generic/Memory/Memory.h"
+#include "Generic/IntLink/IntLink.h"
 // system specific blocks
 #include "At91sam9261/Aic/Aic.h"
 #include "At91sam9261/Smc/Smc.h"
@@ -34,6 +35,8 @@ struct At91sam9261 : sc_core::sc_module
     Smc* smc;
     /// Embedded SRAM
     Memory* sram;
+    /// External interrupt lines IRQ0 to IRQ2 driven by other platforms (NULL if not linked)
+    IntLink* irq[3];
 
     /** Constructor of the module
      * @param[in] name Name of the module
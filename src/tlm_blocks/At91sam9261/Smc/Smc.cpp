@@ -4,64 +4,9 @@
 /// Used to select debugging (0 = OFF, 1 = ON)
 #define DEBUG_SMC 0
 
-// Used to make direct register access
-uint32_t* reg_smc;
-
 // using this namespace to simplify streaming
 using namespace std;
 
-/** Register read function
- * @param[in] offset Offset of the register to read
- * @return The value read
- */
-uint32_t
-Smc::reg_rd(uint32_t offset)
-{
-    uint32_t result;
-    // retrieve the required parameters
-    uint32_t index = offset/4;
-
-    // sanity check
-    assert(index < REG_SMC_COUNT);
-
-    // internal delay
-    this->delay();
-
-    switch (index)
-    {
-    default:
-        // read the register value
-        result = m_reg[index];
-        break;
-    }
-
-    return result;
-
-}
-
-/** Register write function
- * @param[in] offset Offset of the register to read
- */
-void
-Smc::reg_wr(uint32_t offset, uint32_t value)
-{
-    // retrieve the required parameters
-    uint32_t index = offset/4;
-
-    // sanity check
-    assert(index < REG_SMC_COUNT);
-
-    // internal delay
-    this->delay();
-
-    switch (index)
-    {
-    default:
-        m_reg[index] = value;
-        break;
-    }
-}
-
 void
 Smc::bus_s_b_transport(tlm::tlm_generic_payload& trans, sc_core::sc_time& delay)
 {
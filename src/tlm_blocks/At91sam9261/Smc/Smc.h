@@ -1,25 +1,24 @@
 #ifndef SMC_H_
 #define SMC_H_
 
-// this is a peripheral
-#include "Generic/Peripheral/Peripheral.h"
-
 // with a bus master
 #include "tlm_utils/simple_initiator_socket.h"
 
-// include the registers definition
+// this is a peripheral with the registers definition
 #include "reg_smc.h"
 
 /// Static Memory Controller block model
-struct Smc : Peripheral<REG_SMC_COUNT>
+struct Smc : RegSmc<Smc>
 {
     /// Constructor
     Smc(sc_core::sc_module_name name)
-    : Peripheral<REG_SMC_COUNT>(name)
+    : RegSmc<Smc>(name)
     , bus_s_socket("bus_s_socket")
     {
-        // initialized the register access
-        reg_smc = &(m_reg[0]);
+        // registers without side effects are served directly: the model has no hook, the
+        // chip selects timings are plain storage
+        this->set_reg_access(SMC_SETUP0_INDEX, SMC_MODE7_INDEX - SMC_SETUP0_INDEX + 1,
+                             REG_ACCESS_PLAIN);
 
         bus_s_socket.register_b_transport(this, &Smc::bus_s_b_transport);
         bus_s_socket.register_nb_transport_fw(this, &Smc::bus_s_nb_transport_fw);
@@ -30,20 +29,6 @@ struct Smc : Peripheral<REG_SMC_COUNT>
     tlm_utils::simple_target_socket<Smc> bus_s_socket;
 
 protected:
-    /** Register read function
-     * @param[in] offset Offset of the register to read
-     * @return The value read
-     */
-    uint32_t
-    reg_rd(uint32_t offset);
-
-    /** Register write function
-     * @param[in] offset Offset of the register to read
-     * @param[in] offset Value to write in the register
-     */
-    void
-    reg_wr(uint32_t offset, uint32_t value);
-
     /// TLM-2 master socket to forward bus accesses
     tlm_utils::simple_initiator_socket<Smc> bus_m_socket;
 
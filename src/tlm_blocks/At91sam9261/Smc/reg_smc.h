@@ -4,7 +4,7 @@
 #include <stdint.h>
 #include "compiler.h"
 #include "arch.h"
-#include "reg_sim.h"
+#include "Generic/Peripheral/Peripheral.h"
 
 #define REG_SMC_BASE_ADDR 0xFFFFEC00
 
@@ -25,16 +25,6 @@
  */
 #define SMC_SETUP0_INDEX  0x00000000
 
-__INLINE uint32_t smc_setup0_get(void)
-{
-    return sim_reg_smc_rd(SMC_SETUP0_INDEX);
-}
-
-__INLINE void smc_setup0_set(uint32_t value)
-{
-    sim_reg_smc_wr(SMC_SETUP0_INDEX, value);
-}
-
 // field definitions
 #define NCS_RD_SETUP_MASK   0x3F000000
 #define NCS_RD_SETUP_LSB    24
@@ -54,73 +44,6 @@ __INLINE void smc_setup0_set(uint32_t value)
 #define NCS_WR_SETUP_RST    0x0
 #define NWE_SETUP_RST       0x0
 
-__INLINE void smc_setup0_pack(uint8_t ncsrdsetup, uint8_t nrdsetup, uint8_t ncswrsetup, uint8_t nwesetup)
-{
-    ASSERT_ERR(((ncsrdsetup << 24) & ~0x3F000000) == 0);
-    ASSERT_ERR(((nrdsetup << 16) & ~0x003F0000) == 0);
-    ASSERT_ERR(((ncswrsetup << 8) & ~0x00003F00) == 0);
-    ASSERT_ERR(((nwesetup << 0) & ~0x0000003F) == 0);
-    sim_reg_smc_wr(SMC_SETUP0_INDEX,  (ncsrdsetup << 24) | (nrdsetup << 16) | (ncswrsetup << 8) | (nwesetup << 0));
-}
-
-__INLINE void smc_setup0_unpack(uint8_t* ncsrdsetup, uint8_t* nrdsetup, uint8_t* ncswrsetup, uint8_t* nwesetup)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP0_INDEX);
-
-    *ncsrdsetup = (localVal & 0x3F000000) >> 24;
-    *nrdsetup = (localVal & 0x003F0000) >> 16;
-    *ncswrsetup = (localVal & 0x00003F00) >> 8;
-    *nwesetup = (localVal & 0x0000003F) >> 0;
-}
-
-__INLINE uint8_t smc_setup0_ncs_rd_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP0_INDEX);
-    return ((localVal & 0x3F000000) >> 24);
-}
-
-__INLINE void smc_setup0_ncs_rd_setup_setf(uint8_t ncsrdsetup)
-{
-    ASSERT_ERR(((ncsrdsetup << 24) & ~0x3F000000) == 0);
-    sim_reg_smc_wr(SMC_SETUP0_INDEX, (sim_reg_smc_rd(SMC_SETUP0_INDEX) & ~0x3F000000) | (ncsrdsetup << 24));
-}
-
-__INLINE uint8_t smc_setup0_nrd_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP0_INDEX);
-    return ((localVal & 0x003F0000) >> 16);
-}
-
-__INLINE void smc_setup0_nrd_setup_setf(uint8_t nrdsetup)
-{
-    ASSERT_ERR(((nrdsetup << 16) & ~0x003F0000) == 0);
-    sim_reg_smc_wr(SMC_SETUP0_INDEX, (sim_reg_smc_rd(SMC_SETUP0_INDEX) & ~0x003F0000) | (nrdsetup << 16));
-}
-
-__INLINE uint8_t smc_setup0_ncs_wr_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP0_INDEX);
-    return ((localVal & 0x00003F00) >> 8);
-}
-
-__INLINE void smc_setup0_ncs_wr_setup_setf(uint8_t ncswrsetup)
-{
-    ASSERT_ERR(((ncswrsetup << 8) & ~0x00003F00) == 0);
-    sim_reg_smc_wr(SMC_SETUP0_INDEX, (sim_reg_smc_rd(SMC_SETUP0_INDEX) & ~0x00003F00) | (ncswrsetup << 8));
-}
-
-__INLINE uint8_t smc_setup0_nwe_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP0_INDEX);
-    return ((localVal & 0x0000003F) >> 0);
-}
-
-__INLINE void smc_setup0_nwe_setup_setf(uint8_t nwesetup)
-{
-    ASSERT_ERR(((nwesetup << 0) & ~0x0000003F) == 0);
-    sim_reg_smc_wr(SMC_SETUP0_INDEX, (sim_reg_smc_rd(SMC_SETUP0_INDEX) & ~0x0000003F) | (nwesetup << 0));
-}
-
 /**
  * @brief SMC_PULSE0 register definition
  * <pre>
@@ -134,16 +57,6 @@ __INLINE void smc_setup0_nwe_setup_setf(uint8_t nwesetup)
  */
 #define SMC_PULSE0_INDEX  0x00000001
 
-__INLINE uint32_t smc_pulse0_get(void)
-{
-    return sim_reg_smc_rd(SMC_PULSE0_INDEX);
-}
-
-__INLINE void smc_pulse0_set(uint32_t value)
-{
-    sim_reg_smc_wr(SMC_PULSE0_INDEX, value);
-}
-
 // field definitions
 #define NCS_RD_PULSE_MASK   0x7F000000
 #define NCS_RD_PULSE_LSB    24
@@ -163,73 +76,6 @@ __INLINE void smc_pulse0_set(uint32_t value)
 #define NCS_WR_PULSE_RST    0x0
 #define NWE_PULSE_RST       0x0
 
-__INLINE void smc_pulse0_pack(uint8_t ncsrdpulse, uint8_t nrdpulse, uint8_t ncswrpulse, uint8_t nwepulse)
-{
-    ASSERT_ERR(((ncsrdpulse << 24) & ~0x7F000000) == 0);
-    ASSERT_ERR(((nrdpulse << 16) & ~0x007F0000) == 0);
-    ASSERT_ERR(((ncswrpulse << 8) & ~0x00007F00) == 0);
-    ASSERT_ERR(((nwepulse << 0) & ~0x0000007F) == 0);
-    sim_reg_smc_wr(SMC_PULSE0_INDEX,  (ncsrdpulse << 24) | (nrdpulse << 16) | (ncswrpulse << 8) | (nwepulse << 0));
-}
-
-__INLINE void smc_pulse0_unpack(uint8_t* ncsrdpulse, uint8_t* nrdpulse, uint8_t* ncswrpulse, uint8_t* nwepulse)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE0_INDEX);
-
-    *ncsrdpulse = (localVal & 0x7F000000) >> 24;
-    *nrdpulse = (localVal & 0x007F0000) >> 16;
-    *ncswrpulse = (localVal & 0x00007F00) >> 8;
-    *nwepulse = (localVal & 0x0000007F) >> 0;
-}
-
-__INLINE uint8_t smc_pulse0_ncs_rd_pulse_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE0_INDEX);
-    return ((localVal & 0x7F000000) >> 24);
-}
-
-__INLINE void smc_pulse0_ncs_rd_pulse_setf(uint8_t ncsrdpulse)
-{
-    ASSERT_ERR(((ncsrdpulse << 24) & ~0x7F000000) == 0);
-    sim_reg_smc_wr(SMC_PULSE0_INDEX, (sim_reg_smc_rd(SMC_PULSE0_INDEX) & ~0x7F000000) | (ncsrdpulse << 24));
-}
-
-__INLINE uint8_t smc_pulse0_nrd_pulse_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE0_INDEX);
-    return ((localVal & 0x007F0000) >> 16);
-}
-
-__INLINE void smc_pulse0_nrd_pulse_setf(uint8_t nrdpulse)
-{
-    ASSERT_ERR(((nrdpulse << 16) & ~0x007F0000) == 0);
-    sim_reg_smc_wr(SMC_PULSE0_INDEX, (sim_reg_smc_rd(SMC_PULSE0_INDEX) & ~0x007F0000) | (nrdpulse << 16));
-}
-
-__INLINE uint8_t smc_pulse0_ncs_wr_pulse_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE0_INDEX);
-    return ((localVal & 0x00007F00) >> 8);
-}
-
-__INLINE void smc_pulse0_ncs_wr_pulse_setf(uint8_t ncswrpulse)
-{
-    ASSERT_ERR(((ncswrpulse << 8) & ~0x00007F00) == 0);
-    sim_reg_smc_wr(SMC_PULSE0_INDEX, (sim_reg_smc_rd(SMC_PULSE0_INDEX) & ~0x00007F00) | (ncswrpulse << 8));
-}
-
-__INLINE uint8_t smc_pulse0_nwe_pulse_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE0_INDEX);
-    return ((localVal & 0x0000007F) >> 0);
-}
-
-__INLINE void smc_pulse0_nwe_pulse_setf(uint8_t nwepulse)
-{
-    ASSERT_ERR(((nwepulse << 0) & ~0x0000007F) == 0);
-    sim_reg_smc_wr(SMC_PULSE0_INDEX, (sim_reg_smc_rd(SMC_PULSE0_INDEX) & ~0x0000007F) | (nwepulse << 0));
-}
-
 /**
  * @brief SMC_CYCLE0 register definition
  * <pre>
@@ -241,16 +87,6 @@ __INLINE void smc_pulse0_nwe_pulse_setf(uint8_t nwepulse)
  */
 #define SMC_CYCLE0_INDEX  0x00000002
 
-__INLINE uint32_t smc_cycle0_get(void)
-{
-    return sim_reg_smc_rd(SMC_CYCLE0_INDEX);
-}
-
-__INLINE void smc_cycle0_set(uint32_t value)
-{
-    sim_reg_smc_wr(SMC_CYCLE0_INDEX, value);
-}
-
 // field definitions
 #define NRD_CYCLE_MASK   0x01FF0000
 #define NRD_CYCLE_LSB    16
@@ -262,45 +98,6 @@ __INLINE void smc_cycle0_set(uint32_t value)
 #define NRD_CYCLE_RST    0x0
 #define NWE_CYCLE_RST    0x0
 
-__INLINE void smc_cycle0_pack(uint16_t nrdcycle, uint16_t nwecycle)
-{
-    ASSERT_ERR(((nrdcycle << 16) & ~0x01FF0000) == 0);
-    ASSERT_ERR(((nwecycle << 0) & ~0x000001FF) == 0);
-    sim_reg_smc_wr(SMC_CYCLE0_INDEX,  (nrdcycle << 16) | (nwecycle << 0));
-}
-
-__INLINE void smc_cycle0_unpack(uint16_t* nrdcycle, uint16_t* nwecycle)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_CYCLE0_INDEX);
-
-    *nrdcycle = (localVal & 0x01FF0000) >> 16;
-    *nwecycle = (localVal & 0x000001FF) >> 0;
-}
-
-__INLINE uint16_t smc_cycle0_nrd_cycle_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_CYCLE0_INDEX);
-    return ((localVal & 0x01FF0000) >> 16);
-}
-
-__INLINE void smc_cycle0_nrd_cycle_setf(uint16_t nrdcycle)
-{
-    ASSERT_ERR(((nrdcycle << 16) & ~0x01FF0000) == 0);
-    sim_reg_smc_wr(SMC_CYCLE0_INDEX, (sim_reg_smc_rd(SMC_CYCLE0_INDEX) & ~0x01FF0000) | (nrdcycle << 16));
-}
-
-__INLINE uint16_t smc_cycle0_nwe_cycle_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_CYCLE0_INDEX);
-    return ((localVal & 0x000001FF) >> 0);
-}
-
-__INLINE void smc_cycle0_nwe_cycle_setf(uint16_t nwecycle)
-{
-    ASSERT_ERR(((nwecycle << 0) & ~0x000001FF) == 0);
-    sim_reg_smc_wr(SMC_CYCLE0_INDEX, (sim_reg_smc_rd(SMC_CYCLE0_INDEX) & ~0x000001FF) | (nwecycle << 0));
-}
-
 /**
  * @brief SMC_MODE0 register definition
  * <pre>
@@ -319,16 +116,6 @@ __INLINE void smc_cycle0_nwe_cycle_setf(uint16_t nwecycle)
  */
 #define SMC_MODE0_INDEX  0x00000003
 
-__INLINE uint32_t smc_mode0_get(void)
-{
-    return sim_reg_smc_rd(SMC_MODE0_INDEX);
-}
-
-__INLINE void smc_mode0_set(uint32_t value)
-{
-    sim_reg_smc_wr(SMC_MODE0_INDEX, value);
-}
-
 // field definitions
 #define PS_MASK           0x30000000
 #define PS_LSB            28
@@ -363,143 +150,6 @@ __INLINE void smc_mode0_set(uint32_t value)
 #define WRITE_MODE_RST    0x0
 #define READ_MODE_RST     0x0
 
-__INLINE void smc_mode0_pack(uint8_t ps, uint8_t pmen, uint8_t tdfmode, uint8_t tdfcycles, uint8_t dbw, uint8_t bat, uint8_t exnwmode, uint8_t writemode, uint8_t readmode)
-{
-    ASSERT_ERR(((ps << 28) & ~0x30000000) == 0);
-    ASSERT_ERR(((pmen << 24) & ~0x01000000) == 0);
-    ASSERT_ERR(((tdfmode << 20) & ~0x00100000) == 0);
-    ASSERT_ERR(((tdfcycles << 16) & ~0x000F0000) == 0);
-    ASSERT_ERR(((dbw << 12) & ~0x00003000) == 0);
-    ASSERT_ERR(((bat << 8) & ~0x00000100) == 0);
-    ASSERT_ERR(((exnwmode << 4) & ~0x00000030) == 0);
-    ASSERT_ERR(((writemode << 1) & ~0x00000002) == 0);
-    ASSERT_ERR(((readmode << 0) & ~0x00000001) == 0);
-    sim_reg_smc_wr(SMC_MODE0_INDEX,  (ps << 28) | (pmen << 24) | (tdfmode << 20) | (tdfcycles << 16) | (dbw << 12) | (bat << 8) | (exnwmode << 4) | (writemode << 1) | (readmode << 0));
-}
-
-__INLINE void smc_mode0_unpack(uint8_t* ps, uint8_t* pmen, uint8_t* tdfmode, uint8_t* tdfcycles, uint8_t* dbw, uint8_t* bat, uint8_t* exnwmode, uint8_t* writemode, uint8_t* readmode)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE0_INDEX);
-
-    *ps = (localVal & 0x30000000) >> 28;
-    *pmen = (localVal & 0x01000000) >> 24;
-    *tdfmode = (localVal & 0x00100000) >> 20;
-    *tdfcycles = (localVal & 0x000F0000) >> 16;
-    *dbw = (localVal & 0x00003000) >> 12;
-    *bat = (localVal & 0x00000100) >> 8;
-    *exnwmode = (localVal & 0x00000030) >> 4;
-    *writemode = (localVal & 0x00000002) >> 1;
-    *readmode = (localVal & 0x00000001) >> 0;
-}
-
-__INLINE uint8_t smc_mode0_ps_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE0_INDEX);
-    return ((localVal & 0x30000000) >> 28);
-}
-
-__INLINE void smc_mode0_ps_setf(uint8_t ps)
-{
-    ASSERT_ERR(((ps << 28) & ~0x30000000) == 0);
-    sim_reg_smc_wr(SMC_MODE0_INDEX, (sim_reg_smc_rd(SMC_MODE0_INDEX) & ~0x30000000) | (ps << 28));
-}
-
-__INLINE uint8_t smc_mode0_pmen_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE0_INDEX);
-    return ((localVal & 0x01000000) >> 24);
-}
-
-__INLINE void smc_mode0_pmen_setf(uint8_t pmen)
-{
-    ASSERT_ERR(((pmen << 24) & ~0x01000000) == 0);
-    sim_reg_smc_wr(SMC_MODE0_INDEX, (sim_reg_smc_rd(SMC_MODE0_INDEX) & ~0x01000000) | (pmen << 24));
-}
-
-__INLINE uint8_t smc_mode0_tdf_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE0_INDEX);
-    return ((localVal & 0x00100000) >> 20);
-}
-
-__INLINE void smc_mode0_tdf_mode_setf(uint8_t tdfmode)
-{
-    ASSERT_ERR(((tdfmode << 20) & ~0x00100000) == 0);
-    sim_reg_smc_wr(SMC_MODE0_INDEX, (sim_reg_smc_rd(SMC_MODE0_INDEX) & ~0x00100000) | (tdfmode << 20));
-}
-
-__INLINE uint8_t smc_mode0_tdf_cycles_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE0_INDEX);
-    return ((localVal & 0x000F0000) >> 16);
-}
-
-__INLINE void smc_mode0_tdf_cycles_setf(uint8_t tdfcycles)
-{
-    ASSERT_ERR(((tdfcycles << 16) & ~0x000F0000) == 0);
-    sim_reg_smc_wr(SMC_MODE0_INDEX, (sim_reg_smc_rd(SMC_MODE0_INDEX) & ~0x000F0000) | (tdfcycles << 16));
-}
-
-__INLINE uint8_t smc_mode0_dbw_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE0_INDEX);
-    return ((localVal & 0x00003000) >> 12);
-}
-
-__INLINE void smc_mode0_dbw_setf(uint8_t dbw)
-{
-    ASSERT_ERR(((dbw << 12) & ~0x00003000) == 0);
-    sim_reg_smc_wr(SMC_MODE0_INDEX, (sim_reg_smc_rd(SMC_MODE0_INDEX) & ~0x00003000) | (dbw << 12));
-}
-
-__INLINE uint8_t smc_mode0_bat_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE0_INDEX);
-    return ((localVal & 0x00000100) >> 8);
-}
-
-__INLINE void smc_mode0_bat_setf(uint8_t bat)
-{
-    ASSERT_ERR(((bat << 8) & ~0x00000100) == 0);
-    sim_reg_smc_wr(SMC_MODE0_INDEX, (sim_reg_smc_rd(SMC_MODE0_INDEX) & ~0x00000100) | (bat << 8));
-}
-
-__INLINE uint8_t smc_mode0_exnw_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE0_INDEX);
-    return ((localVal & 0x00000030) >> 4);
-}
-
-__INLINE void smc_mode0_exnw_mode_setf(uint8_t exnwmode)
-{
-    ASSERT_ERR(((exnwmode << 4) & ~0x00000030) == 0);
-    sim_reg_smc_wr(SMC_MODE0_INDEX, (sim_reg_smc_rd(SMC_MODE0_INDEX) & ~0x00000030) | (exnwmode << 4));
-}
-
-__INLINE uint8_t smc_mode0_write_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE0_INDEX);
-    return ((localVal & 0x00000002) >> 1);
-}
-
-__INLINE void smc_mode0_write_mode_setf(uint8_t writemode)
-{
-    ASSERT_ERR(((writemode << 1) & ~0x00000002) == 0);
-    sim_reg_smc_wr(SMC_MODE0_INDEX, (sim_reg_smc_rd(SMC_MODE0_INDEX) & ~0x00000002) | (writemode << 1));
-}
-
-__INLINE uint8_t smc_mode0_read_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE0_INDEX);
-    return ((localVal & 0x00000001) >> 0);
-}
-
-__INLINE void smc_mode0_read_mode_setf(uint8_t readmode)
-{
-    ASSERT_ERR(((readmode << 0) & ~0x00000001) == 0);
-    sim_reg_smc_wr(SMC_MODE0_INDEX, (sim_reg_smc_rd(SMC_MODE0_INDEX) & ~0x00000001) | (readmode << 0));
-}
-
 /**
  * @brief SMC_SETUP1 register definition
  * <pre>
@@ -513,16 +163,6 @@ __INLINE void smc_mode0_read_mode_setf(uint8_t readmode)
  */
 #define SMC_SETUP1_INDEX  0x00000004
 
-__INLINE uint32_t smc_setup1_get(void)
-{
-    return sim_reg_smc_rd(SMC_SETUP1_INDEX);
-}
-
-__INLINE void smc_setup1_set(uint32_t value)
-{
-    sim_reg_smc_wr(SMC_SETUP1_INDEX, value);
-}
-
 // field definitions
 #define NCS_RD_SETUP_MASK   0x3F000000
 #define NCS_RD_SETUP_LSB    24
@@ -542,73 +182,6 @@ __INLINE void smc_setup1_set(uint32_t value)
 #define NCS_WR_SETUP_RST    0x0
 #define NWE_SETUP_RST       0x0
 
-__INLINE void smc_setup1_pack(uint8_t ncsrdsetup, uint8_t nrdsetup, uint8_t ncswrsetup, uint8_t nwesetup)
-{
-    ASSERT_ERR(((ncsrdsetup << 24) & ~0x3F000000) == 0);
-    ASSERT_ERR(((nrdsetup << 16) & ~0x003F0000) == 0);
-    ASSERT_ERR(((ncswrsetup << 8) & ~0x00003F00) == 0);
-    ASSERT_ERR(((nwesetup << 0) & ~0x0000003F) == 0);
-    sim_reg_smc_wr(SMC_SETUP1_INDEX,  (ncsrdsetup << 24) | (nrdsetup << 16) | (ncswrsetup << 8) | (nwesetup << 0));
-}
-
-__INLINE void smc_setup1_unpack(uint8_t* ncsrdsetup, uint8_t* nrdsetup, uint8_t* ncswrsetup, uint8_t* nwesetup)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP1_INDEX);
-
-    *ncsrdsetup = (localVal & 0x3F000000) >> 24;
-    *nrdsetup = (localVal & 0x003F0000) >> 16;
-    *ncswrsetup = (localVal & 0x00003F00) >> 8;
-    *nwesetup = (localVal & 0x0000003F) >> 0;
-}
-
-__INLINE uint8_t smc_setup1_ncs_rd_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP1_INDEX);
-    return ((localVal & 0x3F000000) >> 24);
-}
-
-__INLINE void smc_setup1_ncs_rd_setup_setf(uint8_t ncsrdsetup)
-{
-    ASSERT_ERR(((ncsrdsetup << 24) & ~0x3F000000) == 0);
-    sim_reg_smc_wr(SMC_SETUP1_INDEX, (sim_reg_smc_rd(SMC_SETUP1_INDEX) & ~0x3F000000) | (ncsrdsetup << 24));
-}
-
-__INLINE uint8_t smc_setup1_nrd_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP1_INDEX);
-    return ((localVal & 0x003F0000) >> 16);
-}
-
-__INLINE void smc_setup1_nrd_setup_setf(uint8_t nrdsetup)
-{
-    ASSERT_ERR(((nrdsetup << 16) & ~0x003F0000) == 0);
-    sim_reg_smc_wr(SMC_SETUP1_INDEX, (sim_reg_smc_rd(SMC_SETUP1_INDEX) & ~0x003F0000) | (nrdsetup << 16));
-}
-
-__INLINE uint8_t smc_setup1_ncs_wr_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP1_INDEX);
-    return ((localVal & 0x00003F00) >> 8);
-}
-
-__INLINE void smc_setup1_ncs_wr_setup_setf(uint8_t ncswrsetup)
-{
-    ASSERT_ERR(((ncswrsetup << 8) & ~0x00003F00) == 0);
-    sim_reg_smc_wr(SMC_SETUP1_INDEX, (sim_reg_smc_rd(SMC_SETUP1_INDEX) & ~0x00003F00) | (ncswrsetup << 8));
-}
-
-__INLINE uint8_t smc_setup1_nwe_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP1_INDEX);
-    return ((localVal & 0x0000003F) >> 0);
-}
-
-__INLINE void smc_setup1_nwe_setup_setf(uint8_t nwesetup)
-{
-    ASSERT_ERR(((nwesetup << 0) & ~0x0000003F) == 0);
-    sim_reg_smc_wr(SMC_SETUP1_INDEX, (sim_reg_smc_rd(SMC_SETUP1_INDEX) & ~0x0000003F) | (nwesetup << 0));
-}
-
 /**
  * @brief SMC_PULSE1 register definition
  * <pre>
@@ -622,16 +195,6 @@ __INLINE void smc_setup1_nwe_setup_setf(uint8_t nwesetup)
  */
 #define SMC_PULSE1_INDEX  0x00000005
 
-__INLINE uint32_t smc_pulse1_get(void)
-{
-    return sim_reg_smc_rd(SMC_PULSE1_INDEX);
-}
-
-__INLINE void smc_pulse1_set(uint32_t value)
-{
-    sim_reg_smc_wr(SMC_PULSE1_INDEX, value);
-}
-
 // field definitions
 #define NCS_RD_PULSE_MASK   0x7F000000
 #define NCS_RD_PULSE_LSB    24
@@ -651,73 +214,6 @@ __INLINE void smc_pulse1_set(uint32_t value)
 #define NCS_WR_PULSE_RST    0x0
 #define NWE_PULSE_RST       0x0
 
-__INLINE void smc_pulse1_pack(uint8_t ncsrdpulse, uint8_t nrdpulse, uint8_t ncswrpulse, uint8_t nwepulse)
-{
-    ASSERT_ERR(((ncsrdpulse << 24) & ~0x7F000000) == 0);
-    ASSERT_ERR(((nrdpulse << 16) & ~0x007F0000) == 0);
-    ASSERT_ERR(((ncswrpulse << 8) & ~0x00007F00) == 0);
-    ASSERT_ERR(((nwepulse << 0) & ~0x0000007F) == 0);
-    sim_reg_smc_wr(SMC_PULSE1_INDEX,  (ncsrdpulse << 24) | (nrdpulse << 16) | (ncswrpulse << 8) | (nwepulse << 0));
-}
-
-__INLINE void smc_pulse1_unpack(uint8_t* ncsrdpulse, uint8_t* nrdpulse, uint8_t* ncswrpulse, uint8_t* nwepulse)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE1_INDEX);
-
-    *ncsrdpulse = (localVal & 0x7F000000) >> 24;
-    *nrdpulse = (localVal & 0x007F0000) >> 16;
-    *ncswrpulse = (localVal & 0x00007F00) >> 8;
-    *nwepulse = (localVal & 0x0000007F) >> 0;
-}
-
-__INLINE uint8_t smc_pulse1_ncs_rd_pulse_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE1_INDEX);
-    return ((localVal & 0x7F000000) >> 24);
-}
-
-__INLINE void smc_pulse1_ncs_rd_pulse_setf(uint8_t ncsrdpulse)
-{
-    ASSERT_ERR(((ncsrdpulse << 24) & ~0x7F000000) == 0);
-    sim_reg_smc_wr(SMC_PULSE1_INDEX, (sim_reg_smc_rd(SMC_PULSE1_INDEX) & ~0x7F000000) | (ncsrdpulse << 24));
-}
-
-__INLINE uint8_t smc_pulse1_nrd_pulse_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE1_INDEX);
-    return ((localVal & 0x007F0000) >> 16);
-}
-
-__INLINE void smc_pulse1_nrd_pulse_setf(uint8_t nrdpulse)
-{
-    ASSERT_ERR(((nrdpulse << 16) & ~0x007F0000) == 0);
-    sim_reg_smc_wr(SMC_PULSE1_INDEX, (sim_reg_smc_rd(SMC_PULSE1_INDEX) & ~0x007F0000) | (nrdpulse << 16));
-}
-
-__INLINE uint8_t smc_pulse1_ncs_wr_pulse_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE1_INDEX);
-    return ((localVal & 0x00007F00) >> 8);
-}
-
-__INLINE void smc_pulse1_ncs_wr_pulse_setf(uint8_t ncswrpulse)
-{
-    ASSERT_ERR(((ncswrpulse << 8) & ~0x00007F00) == 0);
-    sim_reg_smc_wr(SMC_PULSE1_INDEX, (sim_reg_smc_rd(SMC_PULSE1_INDEX) & ~0x00007F00) | (ncswrpulse << 8));
-}
-
-__INLINE uint8_t smc_pulse1_nwe_pulse_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE1_INDEX);
-    return ((localVal & 0x0000007F) >> 0);
-}
-
-__INLINE void smc_pulse1_nwe_pulse_setf(uint8_t nwepulse)
-{
-    ASSERT_ERR(((nwepulse << 0) & ~0x0000007F) == 0);
-    sim_reg_smc_wr(SMC_PULSE1_INDEX, (sim_reg_smc_rd(SMC_PULSE1_INDEX) & ~0x0000007F) | (nwepulse << 0));
-}
-
 /**
  * @brief SMC_CYCLE1 register definition
  * <pre>
@@ -729,16 +225,6 @@ __INLINE void smc_pulse1_nwe_pulse_setf(uint8_t nwepulse)
  */
 #define SMC_CYCLE1_INDEX  0x00000006
 
-__INLINE uint32_t smc_cycle1_get(void)
-{
-    return sim_reg_smc_rd(SMC_CYCLE1_INDEX);
-}
-
-__INLINE void smc_cycle1_set(uint32_t value)
-{
-    sim_reg_smc_wr(SMC_CYCLE1_INDEX, value);
-}
-
 // field definitions
 #define NRD_CYCLE_MASK   0x01FF0000
 #define NRD_CYCLE_LSB    16
@@ -750,45 +236,6 @@ __INLINE void smc_cycle1_set(uint32_t value)
 #define NRD_CYCLE_RST    0x0
 #define NWE_CYCLE_RST    0x0
 
-__INLINE void smc_cycle1_pack(uint16_t nrdcycle, uint16_t nwecycle)
-{
-    ASSERT_ERR(((nrdcycle << 16) & ~0x01FF0000) == 0);
-    ASSERT_ERR(((nwecycle << 0) & ~0x000001FF) == 0);
-    sim_reg_smc_wr(SMC_CYCLE1_INDEX,  (nrdcycle << 16) | (nwecycle << 0));
-}
-
-__INLINE void smc_cycle1_unpack(uint16_t* nrdcycle, uint16_t* nwecycle)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_CYCLE1_INDEX);
-
-    *nrdcycle = (localVal & 0x01FF0000) >> 16;
-    *nwecycle = (localVal & 0x000001FF) >> 0;
-}
-
-__INLINE uint16_t smc_cycle1_nrd_cycle_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_CYCLE1_INDEX);
-    return ((localVal & 0x01FF0000) >> 16);
-}
-
-__INLINE void smc_cycle1_nrd_cycle_setf(uint16_t nrdcycle)
-{
-    ASSERT_ERR(((nrdcycle << 16) & ~0x01FF0000) == 0);
-    sim_reg_smc_wr(SMC_CYCLE1_INDEX, (sim_reg_smc_rd(SMC_CYCLE1_INDEX) & ~0x01FF0000) | (nrdcycle << 16));
-}
-
-__INLINE uint16_t smc_cycle1_nwe_cycle_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_CYCLE1_INDEX);
-    return ((localVal & 0x000001FF) >> 0);
-}
-
-__INLINE void smc_cycle1_nwe_cycle_setf(uint16_t nwecycle)
-{
-    ASSERT_ERR(((nwecycle << 0) & ~0x000001FF) == 0);
-    sim_reg_smc_wr(SMC_CYCLE1_INDEX, (sim_reg_smc_rd(SMC_CYCLE1_INDEX) & ~0x000001FF) | (nwecycle << 0));
-}
-
 /**
  * @brief SMC_MODE1 register definition
  * <pre>
@@ -807,16 +254,6 @@ __INLINE void smc_cycle1_nwe_cycle_setf(uint16_t nwecycle)
  */
 #define SMC_MODE1_INDEX  0x00000007
 
-__INLINE uint32_t smc_mode1_get(void)
-{
-    return sim_reg_smc_rd(SMC_MODE1_INDEX);
-}
-
-__INLINE void smc_mode1_set(uint32_t value)
-{
-    sim_reg_smc_wr(SMC_MODE1_INDEX, value);
-}
-
 // field definitions
 #define PS_MASK           0x30000000
 #define PS_LSB            28
@@ -851,143 +288,6 @@ __INLINE void smc_mode1_set(uint32_t value)
 #define WRITE_MODE_RST    0x0
 #define READ_MODE_RST     0x0
 
-__INLINE void smc_mode1_pack(uint8_t ps, uint8_t pmen, uint8_t tdfmode, uint8_t tdfcycles, uint8_t dbw, uint8_t bat, uint8_t exnwmode, uint8_t writemode, uint8_t readmode)
-{
-    ASSERT_ERR(((ps << 28) & ~0x30000000) == 0);
-    ASSERT_ERR(((pmen << 24) & ~0x01000000) == 0);
-    ASSERT_ERR(((tdfmode << 20) & ~0x00100000) == 0);
-    ASSERT_ERR(((tdfcycles << 16) & ~0x000F0000) == 0);
-    ASSERT_ERR(((dbw << 12) & ~0x00003000) == 0);
-    ASSERT_ERR(((bat << 8) & ~0x00000100) == 0);
-    ASSERT_ERR(((exnwmode << 4) & ~0x00000030) == 0);
-    ASSERT_ERR(((writemode << 1) & ~0x00000002) == 0);
-    ASSERT_ERR(((readmode << 0) & ~0x00000001) == 0);
-    sim_reg_smc_wr(SMC_MODE1_INDEX,  (ps << 28) | (pmen << 24) | (tdfmode << 20) | (tdfcycles << 16) | (dbw << 12) | (bat << 8) | (exnwmode << 4) | (writemode << 1) | (readmode << 0));
-}
-
-__INLINE void smc_mode1_unpack(uint8_t* ps, uint8_t* pmen, uint8_t* tdfmode, uint8_t* tdfcycles, uint8_t* dbw, uint8_t* bat, uint8_t* exnwmode, uint8_t* writemode, uint8_t* readmode)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE1_INDEX);
-
-    *ps = (localVal & 0x30000000) >> 28;
-    *pmen = (localVal & 0x01000000) >> 24;
-    *tdfmode = (localVal & 0x00100000) >> 20;
-    *tdfcycles = (localVal & 0x000F0000) >> 16;
-    *dbw = (localVal & 0x00003000) >> 12;
-    *bat = (localVal & 0x00000100) >> 8;
-    *exnwmode = (localVal & 0x00000030) >> 4;
-    *writemode = (localVal & 0x00000002) >> 1;
-    *readmode = (localVal & 0x00000001) >> 0;
-}
-
-__INLINE uint8_t smc_mode1_ps_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE1_INDEX);
-    return ((localVal & 0x30000000) >> 28);
-}
-
-__INLINE void smc_mode1_ps_setf(uint8_t ps)
-{
-    ASSERT_ERR(((ps << 28) & ~0x30000000) == 0);
-    sim_reg_smc_wr(SMC_MODE1_INDEX, (sim_reg_smc_rd(SMC_MODE1_INDEX) & ~0x30000000) | (ps << 28));
-}
-
-__INLINE uint8_t smc_mode1_pmen_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE1_INDEX);
-    return ((localVal & 0x01000000) >> 24);
-}
-
-__INLINE void smc_mode1_pmen_setf(uint8_t pmen)
-{
-    ASSERT_ERR(((pmen << 24) & ~0x01000000) == 0);
-    sim_reg_smc_wr(SMC_MODE1_INDEX, (sim_reg_smc_rd(SMC_MODE1_INDEX) & ~0x01000000) | (pmen << 24));
-}
-
-__INLINE uint8_t smc_mode1_tdf_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE1_INDEX);
-    return ((localVal & 0x00100000) >> 20);
-}
-
-__INLINE void smc_mode1_tdf_mode_setf(uint8_t tdfmode)
-{
-    ASSERT_ERR(((tdfmode << 20) & ~0x00100000) == 0);
-    sim_reg_smc_wr(SMC_MODE1_INDEX, (sim_reg_smc_rd(SMC_MODE1_INDEX) & ~0x00100000) | (tdfmode << 20));
-}
-
-__INLINE uint8_t smc_mode1_tdf_cycles_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE1_INDEX);
-    return ((localVal & 0x000F0000) >> 16);
-}
-
-__INLINE void smc_mode1_tdf_cycles_setf(uint8_t tdfcycles)
-{
-    ASSERT_ERR(((tdfcycles << 16) & ~0x000F0000) == 0);
-    sim_reg_smc_wr(SMC_MODE1_INDEX, (sim_reg_smc_rd(SMC_MODE1_INDEX) & ~0x000F0000) | (tdfcycles << 16));
-}
-
-__INLINE uint8_t smc_mode1_dbw_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE1_INDEX);
-    return ((localVal & 0x00003000) >> 12);
-}
-
-__INLINE void smc_mode1_dbw_setf(uint8_t dbw)
-{
-    ASSERT_ERR(((dbw << 12) & ~0x00003000) == 0);
-    sim_reg_smc_wr(SMC_MODE1_INDEX, (sim_reg_smc_rd(SMC_MODE1_INDEX) & ~0x00003000) | (dbw << 12));
-}
-
-__INLINE uint8_t smc_mode1_bat_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE1_INDEX);
-    return ((localVal & 0x00000100) >> 8);
-}
-
-__INLINE void smc_mode1_bat_setf(uint8_t bat)
-{
-    ASSERT_ERR(((bat << 8) & ~0x00000100) == 0);
-    sim_reg_smc_wr(SMC_MODE1_INDEX, (sim_reg_smc_rd(SMC_MODE1_INDEX) & ~0x00000100) | (bat << 8));
-}
-
-__INLINE uint8_t smc_mode1_exnw_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE1_INDEX);
-    return ((localVal & 0x00000030) >> 4);
-}
-
-__INLINE void smc_mode1_exnw_mode_setf(uint8_t exnwmode)
-{
-    ASSERT_ERR(((exnwmode << 4) & ~0x00000030) == 0);
-    sim_reg_smc_wr(SMC_MODE1_INDEX, (sim_reg_smc_rd(SMC_MODE1_INDEX) & ~0x00000030) | (exnwmode << 4));
-}
-
-__INLINE uint8_t smc_mode1_write_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE1_INDEX);
-    return ((localVal & 0x00000002) >> 1);
-}
-
-__INLINE void smc_mode1_write_mode_setf(uint8_t writemode)
-{
-    ASSERT_ERR(((writemode << 1) & ~0x00000002) == 0);
-    sim_reg_smc_wr(SMC_MODE1_INDEX, (sim_reg_smc_rd(SMC_MODE1_INDEX) & ~0x00000002) | (writemode << 1));
-}
-
-__INLINE uint8_t smc_mode1_read_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE1_INDEX);
-    return ((localVal & 0x00000001) >> 0);
-}
-
-__INLINE void smc_mode1_read_mode_setf(uint8_t readmode)
-{
-    ASSERT_ERR(((readmode << 0) & ~0x00000001) == 0);
-    sim_reg_smc_wr(SMC_MODE1_INDEX, (sim_reg_smc_rd(SMC_MODE1_INDEX) & ~0x00000001) | (readmode << 0));
-}
-
 /**
  * @brief SMC_SETUP2 register definition
  * <pre>
@@ -1001,16 +301,6 @@ __INLINE void smc_mode1_read_mode_setf(uint8_t readmode)
  */
 #define SMC_SETUP2_INDEX  0x00000008
 
-__INLINE uint32_t smc_setup2_get(void)
-{
-    return sim_reg_smc_rd(SMC_SETUP2_INDEX);
-}
-
-__INLINE void smc_setup2_set(uint32_t value)
-{
-    sim_reg_smc_wr(SMC_SETUP2_INDEX, value);
-}
-
 // field definitions
 #define NCS_RD_SETUP_MASK   0x3F000000
 #define NCS_RD_SETUP_LSB    24
@@ -1030,73 +320,6 @@ __INLINE void smc_setup2_set(uint32_t value)
 #define NCS_WR_SETUP_RST    0x0
 #define NWE_SETUP_RST       0x0
 
-__INLINE void smc_setup2_pack(uint8_t ncsrdsetup, uint8_t nrdsetup, uint8_t ncswrsetup, uint8_t nwesetup)
-{
-    ASSERT_ERR(((ncsrdsetup << 24) & ~0x3F000000) == 0);
-    ASSERT_ERR(((nrdsetup << 16) & ~0x003F0000) == 0);
-    ASSERT_ERR(((ncswrsetup << 8) & ~0x00003F00) == 0);
-    ASSERT_ERR(((nwesetup << 0) & ~0x0000003F) == 0);
-    sim_reg_smc_wr(SMC_SETUP2_INDEX,  (ncsrdsetup << 24) | (nrdsetup << 16) | (ncswrsetup << 8) | (nwesetup << 0));
-}
-
-__INLINE void smc_setup2_unpack(uint8_t* ncsrdsetup, uint8_t* nrdsetup, uint8_t* ncswrsetup, uint8_t* nwesetup)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP2_INDEX);
-
-    *ncsrdsetup = (localVal & 0x3F000000) >> 24;
-    *nrdsetup = (localVal & 0x003F0000) >> 16;
-    *ncswrsetup = (localVal & 0x00003F00) >> 8;
-    *nwesetup = (localVal & 0x0000003F) >> 0;
-}
-
-__INLINE uint8_t smc_setup2_ncs_rd_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP2_INDEX);
-    return ((localVal & 0x3F000000) >> 24);
-}
-
-__INLINE void smc_setup2_ncs_rd_setup_setf(uint8_t ncsrdsetup)
-{
-    ASSERT_ERR(((ncsrdsetup << 24) & ~0x3F000000) == 0);
-    sim_reg_smc_wr(SMC_SETUP2_INDEX, (sim_reg_smc_rd(SMC_SETUP2_INDEX) & ~0x3F000000) | (ncsrdsetup << 24));
-}
-
-__INLINE uint8_t smc_setup2_nrd_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP2_INDEX);
-    return ((localVal & 0x003F0000) >> 16);
-}
-
-__INLINE void smc_setup2_nrd_setup_setf(uint8_t nrdsetup)
-{
-    ASSERT_ERR(((nrdsetup << 16) & ~0x003F0000) == 0);
-    sim_reg_smc_wr(SMC_SETUP2_INDEX, (sim_reg_smc_rd(SMC_SETUP2_INDEX) & ~0x003F0000) | (nrdsetup << 16));
-}
-
-__INLINE uint8_t smc_setup2_ncs_wr_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP2_INDEX);
-    return ((localVal & 0x00003F00) >> 8);
-}
-
-__INLINE void smc_setup2_ncs_wr_setup_setf(uint8_t ncswrsetup)
-{
-    ASSERT_ERR(((ncswrsetup << 8) & ~0x00003F00) == 0);
-    sim_reg_smc_wr(SMC_SETUP2_INDEX, (sim_reg_smc_rd(SMC_SETUP2_INDEX) & ~0x00003F00) | (ncswrsetup << 8));
-}
-
-__INLINE uint8_t smc_setup2_nwe_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP2_INDEX);
-    return ((localVal & 0x0000003F) >> 0);
-}
-
-__INLINE void smc_setup2_nwe_setup_setf(uint8_t nwesetup)
-{
-    ASSERT_ERR(((nwesetup << 0) & ~0x0000003F) == 0);
-    sim_reg_smc_wr(SMC_SETUP2_INDEX, (sim_reg_smc_rd(SMC_SETUP2_INDEX) & ~0x0000003F) | (nwesetup << 0));
-}
-
 /**
  * @brief SMC_PULSE2 register definition
  * <pre>
@@ -1110,16 +333,6 @@ __INLINE void smc_setup2_nwe_setup_setf(uint8_t nwesetup)
  */
 #define SMC_PULSE2_INDEX  0x00000009
 
-__INLINE uint32_t smc_pulse2_get(void)
-{
-    return sim_reg_smc_rd(SMC_PULSE2_INDEX);
-}
-
-__INLINE void smc_pulse2_set(uint32_t value)
-{
-    sim_reg_smc_wr(SMC_PULSE2_INDEX, value);
-}
-
 // field definitions
 #define NCS_RD_PULSE_MASK   0x7F000000
 #define NCS_RD_PULSE_LSB    24
@@ -1139,93 +352,16 @@ __INLINE void smc_pulse2_set(uint32_t value)
 #define NCS_WR_PULSE_RST    0x0
 #define NWE_PULSE_RST       0x0
 
-__INLINE void smc_pulse2_pack(uint8_t ncsrdpulse, uint8_t nrdpulse, uint8_t ncswrpulse, uint8_t nwepulse)
-{
-    ASSERT_ERR(((ncsrdpulse << 24) & ~0x7F000000) == 0);
-    ASSERT_ERR(((nrdpulse << 16) & ~0x007F0000) == 0);
-    ASSERT_ERR(((ncswrpulse << 8) & ~0x00007F00) == 0);
-    ASSERT_ERR(((nwepulse << 0) & ~0x0000007F) == 0);
-    sim_reg_smc_wr(SMC_PULSE2_INDEX,  (ncsrdpulse << 24) | (nrdpulse << 16) | (ncswrpulse << 8) | (nwepulse << 0));
-}
-
-__INLINE void smc_pulse2_unpack(uint8_t* ncsrdpulse, uint8_t* nrdpulse, uint8_t* ncswrpulse, uint8_t* nwepulse)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE2_INDEX);
-
-    *ncsrdpulse = (localVal & 0x7F000000) >> 24;
-    *nrdpulse = (localVal & 0x007F0000) >> 16;
-    *ncswrpulse = (localVal & 0x00007F00) >> 8;
-    *nwepulse = (localVal & 0x0000007F) >> 0;
-}
-
-__INLINE uint8_t smc_pulse2_ncs_rd_pulse_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE2_INDEX);
-    return ((localVal & 0x7F000000) >> 24);
-}
-
-__INLINE void smc_pulse2_ncs_rd_pulse_setf(uint8_t ncsrdpulse)
-{
-    ASSERT_ERR(((ncsrdpulse << 24) & ~0x7F000000) == 0);
-    sim_reg_smc_wr(SMC_PULSE2_INDEX, (sim_reg_smc_rd(SMC_PULSE2_INDEX) & ~0x7F000000) | (ncsrdpulse << 24));
-}
-
-__INLINE uint8_t smc_pulse2_nrd_pulse_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE2_INDEX);
-    return ((localVal & 0x007F0000) >> 16);
-}
-
-__INLINE void smc_pulse2_nrd_pulse_setf(uint8_t nrdpulse)
-{
-    ASSERT_ERR(((nrdpulse << 16) & ~0x007F0000) == 0);
-    sim_reg_smc_wr(SMC_PULSE2_INDEX, (sim_reg_smc_rd(SMC_PULSE2_INDEX) & ~0x007F0000) | (nrdpulse << 16));
-}
-
-__INLINE uint8_t smc_pulse2_ncs_wr_pulse_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE2_INDEX);
-    return ((localVal & 0x00007F00) >> 8);
-}
-
-__INLINE void smc_pulse2_ncs_wr_pulse_setf(uint8_t ncswrpulse)
-{
-    ASSERT_ERR(((ncswrpulse << 8) & ~0x00007F00) == 0);
-    sim_reg_smc_wr(SMC_PULSE2_INDEX, (sim_reg_smc_rd(SMC_PULSE2_INDEX) & ~0x00007F00) | (ncswrpulse << 8));
-}
-
-__INLINE uint8_t smc_pulse2_nwe_pulse_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE2_INDEX);
-    return ((localVal & 0x0000007F) >> 0);
-}
-
-__INLINE void smc_pulse2_nwe_pulse_setf(uint8_t nwepulse)
-{
-    ASSERT_ERR(((nwepulse << 0) & ~0x0000007F) == 0);
-    sim_reg_smc_wr(SMC_PULSE2_INDEX, (sim_reg_smc_rd(SMC_PULSE2_INDEX) & ~0x0000007F) | (nwepulse << 0));
-}
-
-/**
- * @brief SMC_CYCLE2 register definition
- * <pre>
- *   Bits           Field Name   Reset Value
- *  -----   ------------------   -----------
- *  24:16            NRD_CYCLE   0x0
- *  08:00            NWE_CYCLE   0x0
- * </pre>
- */
-#define SMC_CYCLE2_INDEX  0x0000000A
-
-__INLINE uint32_t smc_cycle2_get(void)
-{
-    return sim_reg_smc_rd(SMC_CYCLE2_INDEX);
-}
-
-__INLINE void smc_cycle2_set(uint32_t value)
-{
-    sim_reg_smc_wr(SMC_CYCLE2_INDEX, value);
-}
+/**
+ * @brief SMC_CYCLE2 register definition
+ * <pre>
+ *   Bits           Field Name   Reset Value
+ *  -----   ------------------   -----------
+ *  24:16            NRD_CYCLE   0x0
+ *  08:00            NWE_CYCLE   0x0
+ * </pre>
+ */
+#define SMC_CYCLE2_INDEX  0x0000000A
 
 // field definitions
 #define NRD_CYCLE_MASK   0x01FF0000
@@ -1238,45 +374,6 @@ __INLINE void smc_cycle2_set(uint32_t value)
 #define NRD_CYCLE_RST    0x0
 #define NWE_CYCLE_RST    0x0
 
-__INLINE void smc_cycle2_pack(uint16_t nrdcycle, uint16_t nwecycle)
-{
-    ASSERT_ERR(((nrdcycle << 16) & ~0x01FF0000) == 0);
-    ASSERT_ERR(((nwecycle << 0) & ~0x000001FF) == 0);
-    sim_reg_smc_wr(SMC_CYCLE2_INDEX,  (nrdcycle << 16) | (nwecycle << 0));
-}
-
-__INLINE void smc_cycle2_unpack(uint16_t* nrdcycle, uint16_t* nwecycle)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_CYCLE2_INDEX);
-
-    *nrdcycle = (localVal & 0x01FF0000) >> 16;
-    *nwecycle = (localVal & 0x000001FF) >> 0;
-}
-
-__INLINE uint16_t smc_cycle2_nrd_cycle_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_CYCLE2_INDEX);
-    return ((localVal & 0x01FF0000) >> 16);
-}
-
-__INLINE void smc_cycle2_nrd_cycle_setf(uint16_t nrdcycle)
-{
-    ASSERT_ERR(((nrdcycle << 16) & ~0x01FF0000) == 0);
-    sim_reg_smc_wr(SMC_CYCLE2_INDEX, (sim_reg_smc_rd(SMC_CYCLE2_INDEX) & ~0x01FF0000) | (nrdcycle << 16));
-}
-
-__INLINE uint16_t smc_cycle2_nwe_cycle_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_CYCLE2_INDEX);
-    return ((localVal & 0x000001FF) >> 0);
-}
-
-__INLINE void smc_cycle2_nwe_cycle_setf(uint16_t nwecycle)
-{
-    ASSERT_ERR(((nwecycle << 0) & ~0x000001FF) == 0);
-    sim_reg_smc_wr(SMC_CYCLE2_INDEX, (sim_reg_smc_rd(SMC_CYCLE2_INDEX) & ~0x000001FF) | (nwecycle << 0));
-}
-
 /**
  * @brief SMC_MODE2 register definition
  * <pre>
@@ -1295,16 +392,6 @@ __INLINE void smc_cycle2_nwe_cycle_setf(uint16_t nwecycle)
  */
 #define SMC_MODE2_INDEX  0x0000000B
 
-__INLINE uint32_t smc_mode2_get(void)
-{
-    return sim_reg_smc_rd(SMC_MODE2_INDEX);
-}
-
-__INLINE void smc_mode2_set(uint32_t value)
-{
-    sim_reg_smc_wr(SMC_MODE2_INDEX, value);
-}
-
 // field definitions
 #define PS_MASK           0x30000000
 #define PS_LSB            28
@@ -1339,143 +426,6 @@ __INLINE void smc_mode2_set(uint32_t value)
 #define WRITE_MODE_RST    0x0
 #define READ_MODE_RST     0x0
 
-__INLINE void smc_mode2_pack(uint8_t ps, uint8_t pmen, uint8_t tdfmode, uint8_t tdfcycles, uint8_t dbw, uint8_t bat, uint8_t exnwmode, uint8_t writemode, uint8_t readmode)
-{
-    ASSERT_ERR(((ps << 28) & ~0x30000000) == 0);
-    ASSERT_ERR(((pmen << 24) & ~0x01000000) == 0);
-    ASSERT_ERR(((tdfmode << 20) & ~0x00100000) == 0);
-    ASSERT_ERR(((tdfcycles << 16) & ~0x000F0000) == 0);
-    ASSERT_ERR(((dbw << 12) & ~0x00003000) == 0);
-    ASSERT_ERR(((bat << 8) & ~0x00000100) == 0);
-    ASSERT_ERR(((exnwmode << 4) & ~0x00000030) == 0);
-    ASSERT_ERR(((writemode << 1) & ~0x00000002) == 0);
-    ASSERT_ERR(((readmode << 0) & ~0x00000001) == 0);
-    sim_reg_smc_wr(SMC_MODE2_INDEX,  (ps << 28) | (pmen << 24) | (tdfmode << 20) | (tdfcycles << 16) | (dbw << 12) | (bat << 8) | (exnwmode << 4) | (writemode << 1) | (readmode << 0));
-}
-
-__INLINE void smc_mode2_unpack(uint8_t* ps, uint8_t* pmen, uint8_t* tdfmode, uint8_t* tdfcycles, uint8_t* dbw, uint8_t* bat, uint8_t* exnwmode, uint8_t* writemode, uint8_t* readmode)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE2_INDEX);
-
-    *ps = (localVal & 0x30000000) >> 28;
-    *pmen = (localVal & 0x01000000) >> 24;
-    *tdfmode = (localVal & 0x00100000) >> 20;
-    *tdfcycles = (localVal & 0x000F0000) >> 16;
-    *dbw = (localVal & 0x00003000) >> 12;
-    *bat = (localVal & 0x00000100) >> 8;
-    *exnwmode = (localVal & 0x00000030) >> 4;
-    *writemode = (localVal & 0x00000002) >> 1;
-    *readmode = (localVal & 0x00000001) >> 0;
-}
-
-__INLINE uint8_t smc_mode2_ps_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE2_INDEX);
-    return ((localVal & 0x30000000) >> 28);
-}
-
-__INLINE void smc_mode2_ps_setf(uint8_t ps)
-{
-    ASSERT_ERR(((ps << 28) & ~0x30000000) == 0);
-    sim_reg_smc_wr(SMC_MODE2_INDEX, (sim_reg_smc_rd(SMC_MODE2_INDEX) & ~0x30000000) | (ps << 28));
-}
-
-__INLINE uint8_t smc_mode2_pmen_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE2_INDEX);
-    return ((localVal & 0x01000000) >> 24);
-}
-
-__INLINE void smc_mode2_pmen_setf(uint8_t pmen)
-{
-    ASSERT_ERR(((pmen << 24) & ~0x01000000) == 0);
-    sim_reg_smc_wr(SMC_MODE2_INDEX, (sim_reg_smc_rd(SMC_MODE2_INDEX) & ~0x01000000) | (pmen << 24));
-}
-
-__INLINE uint8_t smc_mode2_tdf_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE2_INDEX);
-    return ((localVal & 0x00100000) >> 20);
-}
-
-__INLINE void smc_mode2_tdf_mode_setf(uint8_t tdfmode)
-{
-    ASSERT_ERR(((tdfmode << 20) & ~0x00100000) == 0);
-    sim_reg_smc_wr(SMC_MODE2_INDEX, (sim_reg_smc_rd(SMC_MODE2_INDEX) & ~0x00100000) | (tdfmode << 20));
-}
-
-__INLINE uint8_t smc_mode2_tdf_cycles_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE2_INDEX);
-    return ((localVal & 0x000F0000) >> 16);
-}
-
-__INLINE void smc_mode2_tdf_cycles_setf(uint8_t tdfcycles)
-{
-    ASSERT_ERR(((tdfcycles << 16) & ~0x000F0000) == 0);
-    sim_reg_smc_wr(SMC_MODE2_INDEX, (sim_reg_smc_rd(SMC_MODE2_INDEX) & ~0x000F0000) | (tdfcycles << 16));
-}
-
-__INLINE uint8_t smc_mode2_dbw_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE2_INDEX);
-    return ((localVal & 0x00003000) >> 12);
-}
-
-__INLINE void smc_mode2_dbw_setf(uint8_t dbw)
-{
-    ASSERT_ERR(((dbw << 12) & ~0x00003000) == 0);
-    sim_reg_smc_wr(SMC_MODE2_INDEX, (sim_reg_smc_rd(SMC_MODE2_INDEX) & ~0x00003000) | (dbw << 12));
-}
-
-__INLINE uint8_t smc_mode2_bat_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE2_INDEX);
-    return ((localVal & 0x00000100) >> 8);
-}
-
-__INLINE void smc_mode2_bat_setf(uint8_t bat)
-{
-    ASSERT_ERR(((bat << 8) & ~0x00000100) == 0);
-    sim_reg_smc_wr(SMC_MODE2_INDEX, (sim_reg_smc_rd(SMC_MODE2_INDEX) & ~0x00000100) | (bat << 8));
-}
-
-__INLINE uint8_t smc_mode2_exnw_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE2_INDEX);
-    return ((localVal & 0x00000030) >> 4);
-}
-
-__INLINE void smc_mode2_exnw_mode_setf(uint8_t exnwmode)
-{
-    ASSERT_ERR(((exnwmode << 4) & ~0x00000030) == 0);
-    sim_reg_smc_wr(SMC_MODE2_INDEX, (sim_reg_smc_rd(SMC_MODE2_INDEX) & ~0x00000030) | (exnwmode << 4));
-}
-
-__INLINE uint8_t smc_mode2_write_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE2_INDEX);
-    return ((localVal & 0x00000002) >> 1);
-}
-
-__INLINE void smc_mode2_write_mode_setf(uint8_t writemode)
-{
-    ASSERT_ERR(((writemode << 1) & ~0x00000002) == 0);
-    sim_reg_smc_wr(SMC_MODE2_INDEX, (sim_reg_smc_rd(SMC_MODE2_INDEX) & ~0x00000002) | (writemode << 1));
-}
-
-__INLINE uint8_t smc_mode2_read_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE2_INDEX);
-    return ((localVal & 0x00000001) >> 0);
-}
-
-__INLINE void smc_mode2_read_mode_setf(uint8_t readmode)
-{
-    ASSERT_ERR(((readmode << 0) & ~0x00000001) == 0);
-    sim_reg_smc_wr(SMC_MODE2_INDEX, (sim_reg_smc_rd(SMC_MODE2_INDEX) & ~0x00000001) | (readmode << 0));
-}
-
 /**
  * @brief SMC_SETUP3 register definition
  * <pre>
@@ -1489,16 +439,6 @@ __INLINE void smc_mode2_read_mode_setf(uint8_t readmode)
  */
 #define SMC_SETUP3_INDEX  0x0000000C
 
-__INLINE uint32_t smc_setup3_get(void)
-{
-    return sim_reg_smc_rd(SMC_SETUP3_INDEX);
-}
-
-__INLINE void smc_setup3_set(uint32_t value)
-{
-    sim_reg_smc_wr(SMC_SETUP3_INDEX, value);
-}
-
 // field definitions
 #define NCS_RD_SETUP_MASK   0x3F000000
 #define NCS_RD_SETUP_LSB    24
@@ -1518,73 +458,6 @@ __INLINE void smc_setup3_set(uint32_t value)
 #define NCS_WR_SETUP_RST    0x0
 #define NWE_SETUP_RST       0x0
 
-__INLINE void smc_setup3_pack(uint8_t ncsrdsetup, uint8_t nrdsetup, uint8_t ncswrsetup, uint8_t nwesetup)
-{
-    ASSERT_ERR(((ncsrdsetup << 24) & ~0x3F000000) == 0);
-    ASSERT_ERR(((nrdsetup << 16) & ~0x003F0000) == 0);
-    ASSERT_ERR(((ncswrsetup << 8) & ~0x00003F00) == 0);
-    ASSERT_ERR(((nwesetup << 0) & ~0x0000003F) == 0);
-    sim_reg_smc_wr(SMC_SETUP3_INDEX,  (ncsrdsetup << 24) | (nrdsetup << 16) | (ncswrsetup << 8) | (nwesetup << 0));
-}
-
-__INLINE void smc_setup3_unpack(uint8_t* ncsrdsetup, uint8_t* nrdsetup, uint8_t* ncswrsetup, uint8_t* nwesetup)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP3_INDEX);
-
-    *ncsrdsetup = (localVal & 0x3F000000) >> 24;
-    *nrdsetup = (localVal & 0x003F0000) >> 16;
-    *ncswrsetup = (localVal & 0x00003F00) >> 8;
-    *nwesetup = (localVal & 0x0000003F) >> 0;
-}
-
-__INLINE uint8_t smc_setup3_ncs_rd_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP3_INDEX);
-    return ((localVal & 0x3F000000) >> 24);
-}
-
-__INLINE void smc_setup3_ncs_rd_setup_setf(uint8_t ncsrdsetup)
-{
-    ASSERT_ERR(((ncsrdsetup << 24) & ~0x3F000000) == 0);
-    sim_reg_smc_wr(SMC_SETUP3_INDEX, (sim_reg_smc_rd(SMC_SETUP3_INDEX) & ~0x3F000000) | (ncsrdsetup << 24));
-}
-
-__INLINE uint8_t smc_setup3_nrd_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP3_INDEX);
-    return ((localVal & 0x003F0000) >> 16);
-}
-
-__INLINE void smc_setup3_nrd_setup_setf(uint8_t nrdsetup)
-{
-    ASSERT_ERR(((nrdsetup << 16) & ~0x003F0000) == 0);
-    sim_reg_smc_wr(SMC_SETUP3_INDEX, (sim_reg_smc_rd(SMC_SETUP3_INDEX) & ~0x003F0000) | (nrdsetup << 16));
-}
-
-__INLINE uint8_t smc_setup3_ncs_wr_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP3_INDEX);
-    return ((localVal & 0x00003F00) >> 8);
-}
-
-__INLINE void smc_setup3_ncs_wr_setup_setf(uint8_t ncswrsetup)
-{
-    ASSERT_ERR(((ncswrsetup << 8) & ~0x00003F00) == 0);
-    sim_reg_smc_wr(SMC_SETUP3_INDEX, (sim_reg_smc_rd(SMC_SETUP3_INDEX) & ~0x00003F00) | (ncswrsetup << 8));
-}
-
-__INLINE uint8_t smc_setup3_nwe_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP3_INDEX);
-    return ((localVal & 0x0000003F) >> 0);
-}
-
-__INLINE void smc_setup3_nwe_setup_setf(uint8_t nwesetup)
-{
-    ASSERT_ERR(((nwesetup << 0) & ~0x0000003F) == 0);
-    sim_reg_smc_wr(SMC_SETUP3_INDEX, (sim_reg_smc_rd(SMC_SETUP3_INDEX) & ~0x0000003F) | (nwesetup << 0));
-}
-
 /**
  * @brief SMC_PULSE3 register definition
  * <pre>
@@ -1598,16 +471,6 @@ __INLINE void smc_setup3_nwe_setup_setf(uint8_t nwesetup)
  */
 #define SMC_PULSE3_INDEX  0x0000000D
 
-__INLINE uint32_t smc_pulse3_get(void)
-{
-    return sim_reg_smc_rd(SMC_PULSE3_INDEX);
-}
-
-__INLINE void smc_pulse3_set(uint32_t value)
-{
-    sim_reg_smc_wr(SMC_PULSE3_INDEX, value);
-}
-
 // field definitions
 #define NCS_RD_PULSE_MASK   0x7F000000
 #define NCS_RD_PULSE_LSB    24
@@ -1627,73 +490,6 @@ __INLINE void smc_pulse3_set(uint32_t value)
 #define NCS_WR_PULSE_RST    0x0
 #define NWE_PULSE_RST       0x0
 
-__INLINE void smc_pulse3_pack(uint8_t ncsrdpulse, uint8_t nrdpulse, uint8_t ncswrpulse, uint8_t nwepulse)
-{
-    ASSERT_ERR(((ncsrdpulse << 24) & ~0x7F000000) == 0);
-    ASSERT_ERR(((nrdpulse << 16) & ~0x007F0000) == 0);
-    ASSERT_ERR(((ncswrpulse << 8) & ~0x00007F00) == 0);
-    ASSERT_ERR(((nwepulse << 0) & ~0x0000007F) == 0);
-    sim_reg_smc_wr(SMC_PULSE3_INDEX,  (ncsrdpulse << 24) | (nrdpulse << 16) | (ncswrpulse << 8) | (nwepulse << 0));
-}
-
-__INLINE void smc_pulse3_unpack(uint8_t* ncsrdpulse, uint8_t* nrdpulse, uint8_t* ncswrpulse, uint8_t* nwepulse)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE3_INDEX);
-
-    *ncsrdpulse = (localVal & 0x7F000000) >> 24;
-    *nrdpulse = (localVal & 0x007F0000) >> 16;
-    *ncswrpulse = (localVal & 0x00007F00) >> 8;
-    *nwepulse = (localVal & 0x0000007F) >> 0;
-}
-
-__INLINE uint8_t smc_pulse3_ncs_rd_pulse_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE3_INDEX);
-    return ((localVal & 0x7F000000) >> 24);
-}
-
-__INLINE void smc_pulse3_ncs_rd_pulse_setf(uint8_t ncsrdpulse)
-{
-    ASSERT_ERR(((ncsrdpulse << 24) & ~0x7F000000) == 0);
-    sim_reg_smc_wr(SMC_PULSE3_INDEX, (sim_reg_smc_rd(SMC_PULSE3_INDEX) & ~0x7F000000) | (ncsrdpulse << 24));
-}
-
-__INLINE uint8_t smc_pulse3_nrd_pulse_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE3_INDEX);
-    return ((localVal & 0x007F0000) >> 16);
-}
-
-__INLINE void smc_pulse3_nrd_pulse_setf(uint8_t nrdpulse)
-{
-    ASSERT_ERR(((nrdpulse << 16) & ~0x007F0000) == 0);
-    sim_reg_smc_wr(SMC_PULSE3_INDEX, (sim_reg_smc_rd(SMC_PULSE3_INDEX) & ~0x007F0000) | (nrdpulse << 16));
-}
-
-__INLINE uint8_t smc_pulse3_ncs_wr_pulse_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE3_INDEX);
-    return ((localVal & 0x00007F00) >> 8);
-}
-
-__INLINE void smc_pulse3_ncs_wr_pulse_setf(uint8_t ncswrpulse)
-{
-    ASSERT_ERR(((ncswrpulse << 8) & ~0x00007F00) == 0);
-    sim_reg_smc_wr(SMC_PULSE3_INDEX, (sim_reg_smc_rd(SMC_PULSE3_INDEX) & ~0x00007F00) | (ncswrpulse << 8));
-}
-
-__INLINE uint8_t smc_pulse3_nwe_pulse_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE3_INDEX);
-    return ((localVal & 0x0000007F) >> 0);
-}
-
-__INLINE void smc_pulse3_nwe_pulse_setf(uint8_t nwepulse)
-{
-    ASSERT_ERR(((nwepulse << 0) & ~0x0000007F) == 0);
-    sim_reg_smc_wr(SMC_PULSE3_INDEX, (sim_reg_smc_rd(SMC_PULSE3_INDEX) & ~0x0000007F) | (nwepulse << 0));
-}
-
 /**
  * @brief SMC_CYCLE3 register definition
  * <pre>
@@ -1705,16 +501,6 @@ __INLINE void smc_pulse3_nwe_pulse_setf(uint8_t nwepulse)
  */
 #define SMC_CYCLE3_INDEX  0x0000000E
 
-__INLINE uint32_t smc_cycle3_get(void)
-{
-    return sim_reg_smc_rd(SMC_CYCLE3_INDEX);
-}
-
-__INLINE void smc_cycle3_set(uint32_t value)
-{
-    sim_reg_smc_wr(SMC_CYCLE3_INDEX, value);
-}
-
 // field definitions
 #define NRD_CYCLE_MASK   0x01FF0000
 #define NRD_CYCLE_LSB    16
@@ -1726,45 +512,6 @@ __INLINE void smc_cycle3_set(uint32_t value)
 #define NRD_CYCLE_RST    0x0
 #define NWE_CYCLE_RST    0x0
 
-__INLINE void smc_cycle3_pack(uint16_t nrdcycle, uint16_t nwecycle)
-{
-    ASSERT_ERR(((nrdcycle << 16) & ~0x01FF0000) == 0);
-    ASSERT_ERR(((nwecycle << 0) & ~0x000001FF) == 0);
-    sim_reg_smc_wr(SMC_CYCLE3_INDEX,  (nrdcycle << 16) | (nwecycle << 0));
-}
-
-__INLINE void smc_cycle3_unpack(uint16_t* nrdcycle, uint16_t* nwecycle)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_CYCLE3_INDEX);
-
-    *nrdcycle = (localVal & 0x01FF0000) >> 16;
-    *nwecycle = (localVal & 0x000001FF) >> 0;
-}
-
-__INLINE uint16_t smc_cycle3_nrd_cycle_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_CYCLE3_INDEX);
-    return ((localVal & 0x01FF0000) >> 16);
-}
-
-__INLINE void smc_cycle3_nrd_cycle_setf(uint16_t nrdcycle)
-{
-    ASSERT_ERR(((nrdcycle << 16) & ~0x01FF0000) == 0);
-    sim_reg_smc_wr(SMC_CYCLE3_INDEX, (sim_reg_smc_rd(SMC_CYCLE3_INDEX) & ~0x01FF0000) | (nrdcycle << 16));
-}
-
-__INLINE uint16_t smc_cycle3_nwe_cycle_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_CYCLE3_INDEX);
-    return ((localVal & 0x000001FF) >> 0);
-}
-
-__INLINE void smc_cycle3_nwe_cycle_setf(uint16_t nwecycle)
-{
-    ASSERT_ERR(((nwecycle << 0) & ~0x000001FF) == 0);
-    sim_reg_smc_wr(SMC_CYCLE3_INDEX, (sim_reg_smc_rd(SMC_CYCLE3_INDEX) & ~0x000001FF) | (nwecycle << 0));
-}
-
 /**
  * @brief SMC_MODE3 register definition
  * <pre>
@@ -1783,16 +530,6 @@ __INLINE void smc_cycle3_nwe_cycle_setf(uint16_t nwecycle)
  */
 #define SMC_MODE3_INDEX  0x0000000F
 
-__INLINE uint32_t smc_mode3_get(void)
-{
-    return sim_reg_smc_rd(SMC_MODE3_INDEX);
-}
-
-__INLINE void smc_mode3_set(uint32_t value)
-{
-    sim_reg_smc_wr(SMC_MODE3_INDEX, value);
-}
-
 // field definitions
 #define PS_MASK           0x30000000
 #define PS_LSB            28
@@ -1827,143 +564,6 @@ __INLINE void smc_mode3_set(uint32_t value)
 #define WRITE_MODE_RST    0x0
 #define READ_MODE_RST     0x0
 
-__INLINE void smc_mode3_pack(uint8_t ps, uint8_t pmen, uint8_t tdfmode, uint8_t tdfcycles, uint8_t dbw, uint8_t bat, uint8_t exnwmode, uint8_t writemode, uint8_t readmode)
-{
-    ASSERT_ERR(((ps << 28) & ~0x30000000) == 0);
-    ASSERT_ERR(((pmen << 24) & ~0x01000000) == 0);
-    ASSERT_ERR(((tdfmode << 20) & ~0x00100000) == 0);
-    ASSERT_ERR(((tdfcycles << 16) & ~0x000F0000) == 0);
-    ASSERT_ERR(((dbw << 12) & ~0x00003000) == 0);
-    ASSERT_ERR(((bat << 8) & ~0x00000100) == 0);
-    ASSERT_ERR(((exnwmode << 4) & ~0x00000030) == 0);
-    ASSERT_ERR(((writemode << 1) & ~0x00000002) == 0);
-    ASSERT_ERR(((readmode << 0) & ~0x00000001) == 0);
-    sim_reg_smc_wr(SMC_MODE3_INDEX,  (ps << 28) | (pmen << 24) | (tdfmode << 20) | (tdfcycles << 16) | (dbw << 12) | (bat << 8) | (exnwmode << 4) | (writemode << 1) | (readmode << 0));
-}
-
-__INLINE void smc_mode3_unpack(uint8_t* ps, uint8_t* pmen, uint8_t* tdfmode, uint8_t* tdfcycles, uint8_t* dbw, uint8_t* bat, uint8_t* exnwmode, uint8_t* writemode, uint8_t* readmode)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE3_INDEX);
-
-    *ps = (localVal & 0x30000000) >> 28;
-    *pmen = (localVal & 0x01000000) >> 24;
-    *tdfmode = (localVal & 0x00100000) >> 20;
-    *tdfcycles = (localVal & 0x000F0000) >> 16;
-    *dbw = (localVal & 0x00003000) >> 12;
-    *bat = (localVal & 0x00000100) >> 8;
-    *exnwmode = (localVal & 0x00000030) >> 4;
-    *writemode = (localVal & 0x00000002) >> 1;
-    *readmode = (localVal & 0x00000001) >> 0;
-}
-
-__INLINE uint8_t smc_mode3_ps_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE3_INDEX);
-    return ((localVal & 0x30000000) >> 28);
-}
-
-__INLINE void smc_mode3_ps_setf(uint8_t ps)
-{
-    ASSERT_ERR(((ps << 28) & ~0x30000000) == 0);
-    sim_reg_smc_wr(SMC_MODE3_INDEX, (sim_reg_smc_rd(SMC_MODE3_INDEX) & ~0x30000000) | (ps << 28));
-}
-
-__INLINE uint8_t smc_mode3_pmen_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE3_INDEX);
-    return ((localVal & 0x01000000) >> 24);
-}
-
-__INLINE void smc_mode3_pmen_setf(uint8_t pmen)
-{
-    ASSERT_ERR(((pmen << 24) & ~0x01000000) == 0);
-    sim_reg_smc_wr(SMC_MODE3_INDEX, (sim_reg_smc_rd(SMC_MODE3_INDEX) & ~0x01000000) | (pmen << 24));
-}
-
-__INLINE uint8_t smc_mode3_tdf_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE3_INDEX);
-    return ((localVal & 0x00100000) >> 20);
-}
-
-__INLINE void smc_mode3_tdf_mode_setf(uint8_t tdfmode)
-{
-    ASSERT_ERR(((tdfmode << 20) & ~0x00100000) == 0);
-    sim_reg_smc_wr(SMC_MODE3_INDEX, (sim_reg_smc_rd(SMC_MODE3_INDEX) & ~0x00100000) | (tdfmode << 20));
-}
-
-__INLINE uint8_t smc_mode3_tdf_cycles_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE3_INDEX);
-    return ((localVal & 0x000F0000) >> 16);
-}
-
-__INLINE void smc_mode3_tdf_cycles_setf(uint8_t tdfcycles)
-{
-    ASSERT_ERR(((tdfcycles << 16) & ~0x000F0000) == 0);
-    sim_reg_smc_wr(SMC_MODE3_INDEX, (sim_reg_smc_rd(SMC_MODE3_INDEX) & ~0x000F0000) | (tdfcycles << 16));
-}
-
-__INLINE uint8_t smc_mode3_dbw_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE3_INDEX);
-    return ((localVal & 0x00003000) >> 12);
-}
-
-__INLINE void smc_mode3_dbw_setf(uint8_t dbw)
-{
-    ASSERT_ERR(((dbw << 12) & ~0x00003000) == 0);
-    sim_reg_smc_wr(SMC_MODE3_INDEX, (sim_reg_smc_rd(SMC_MODE3_INDEX) & ~0x00003000) | (dbw << 12));
-}
-
-__INLINE uint8_t smc_mode3_bat_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE3_INDEX);
-    return ((localVal & 0x00000100) >> 8);
-}
-
-__INLINE void smc_mode3_bat_setf(uint8_t bat)
-{
-    ASSERT_ERR(((bat << 8) & ~0x00000100) == 0);
-    sim_reg_smc_wr(SMC_MODE3_INDEX, (sim_reg_smc_rd(SMC_MODE3_INDEX) & ~0x00000100) | (bat << 8));
-}
-
-__INLINE uint8_t smc_mode3_exnw_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE3_INDEX);
-    return ((localVal & 0x00000030) >> 4);
-}
-
-__INLINE void smc_mode3_exnw_mode_setf(uint8_t exnwmode)
-{
-    ASSERT_ERR(((exnwmode << 4) & ~0x00000030) == 0);
-    sim_reg_smc_wr(SMC_MODE3_INDEX, (sim_reg_smc_rd(SMC_MODE3_INDEX) & ~0x00000030) | (exnwmode << 4));
-}
-
-__INLINE uint8_t smc_mode3_write_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE3_INDEX);
-    return ((localVal & 0x00000002) >> 1);
-}
-
-__INLINE void smc_mode3_write_mode_setf(uint8_t writemode)
-{
-    ASSERT_ERR(((writemode << 1) & ~0x00000002) == 0);
-    sim_reg_smc_wr(SMC_MODE3_INDEX, (sim_reg_smc_rd(SMC_MODE3_INDEX) & ~0x00000002) | (writemode << 1));
-}
-
-__INLINE uint8_t smc_mode3_read_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE3_INDEX);
-    return ((localVal & 0x00000001) >> 0);
-}
-
-__INLINE void smc_mode3_read_mode_setf(uint8_t readmode)
-{
-    ASSERT_ERR(((readmode << 0) & ~0x00000001) == 0);
-    sim_reg_smc_wr(SMC_MODE3_INDEX, (sim_reg_smc_rd(SMC_MODE3_INDEX) & ~0x00000001) | (readmode << 0));
-}
-
 /**
  * @brief SMC_SETUP4 register definition
  * <pre>
@@ -1977,16 +577,6 @@ __INLINE void smc_mode3_read_mode_setf(uint8_t readmode)
  */
 #define SMC_SETUP4_INDEX  0x00000010
 
-__INLINE uint32_t smc_setup4_get(void)
-{
-    return sim_reg_smc_rd(SMC_SETUP4_INDEX);
-}
-
-__INLINE void smc_setup4_set(uint32_t value)
-{
-    sim_reg_smc_wr(SMC_SETUP4_INDEX, value);
-}
-
 // field definitions
 #define NCS_RD_SETUP_MASK   0x3F000000
 #define NCS_RD_SETUP_LSB    24
@@ -2006,73 +596,6 @@ __INLINE void smc_setup4_set(uint32_t value)
 #define NCS_WR_SETUP_RST    0x0
 #define NWE_SETUP_RST       0x0
 
-__INLINE void smc_setup4_pack(uint8_t ncsrdsetup, uint8_t nrdsetup, uint8_t ncswrsetup, uint8_t nwesetup)
-{
-    ASSERT_ERR(((ncsrdsetup << 24) & ~0x3F000000) == 0);
-    ASSERT_ERR(((nrdsetup << 16) & ~0x003F0000) == 0);
-    ASSERT_ERR(((ncswrsetup << 8) & ~0x00003F00) == 0);
-    ASSERT_ERR(((nwesetup << 0) & ~0x0000003F) == 0);
-    sim_reg_smc_wr(SMC_SETUP4_INDEX,  (ncsrdsetup << 24) | (nrdsetup << 16) | (ncswrsetup << 8) | (nwesetup << 0));
-}
-
-__INLINE void smc_setup4_unpack(uint8_t* ncsrdsetup, uint8_t* nrdsetup, uint8_t* ncswrsetup, uint8_t* nwesetup)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP4_INDEX);
-
-    *ncsrdsetup = (localVal & 0x3F000000) >> 24;
-    *nrdsetup = (localVal & 0x003F0000) >> 16;
-    *ncswrsetup = (localVal & 0x00003F00) >> 8;
-    *nwesetup = (localVal & 0x0000003F) >> 0;
-}
-
-__INLINE uint8_t smc_setup4_ncs_rd_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP4_INDEX);
-    return ((localVal & 0x3F000000) >> 24);
-}
-
-__INLINE void smc_setup4_ncs_rd_setup_setf(uint8_t ncsrdsetup)
-{
-    ASSERT_ERR(((ncsrdsetup << 24) & ~0x3F000000) == 0);
-    sim_reg_smc_wr(SMC_SETUP4_INDEX, (sim_reg_smc_rd(SMC_SETUP4_INDEX) & ~0x3F000000) | (ncsrdsetup << 24));
-}
-
-__INLINE uint8_t smc_setup4_nrd_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP4_INDEX);
-    return ((localVal & 0x003F0000) >> 16);
-}
-
-__INLINE void smc_setup4_nrd_setup_setf(uint8_t nrdsetup)
-{
-    ASSERT_ERR(((nrdsetup << 16) & ~0x003F0000) == 0);
-    sim_reg_smc_wr(SMC_SETUP4_INDEX, (sim_reg_smc_rd(SMC_SETUP4_INDEX) & ~0x003F0000) | (nrdsetup << 16));
-}
-
-__INLINE uint8_t smc_setup4_ncs_wr_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP4_INDEX);
-    return ((localVal & 0x00003F00) >> 8);
-}
-
-__INLINE void smc_setup4_ncs_wr_setup_setf(uint8_t ncswrsetup)
-{
-    ASSERT_ERR(((ncswrsetup << 8) & ~0x00003F00) == 0);
-    sim_reg_smc_wr(SMC_SETUP4_INDEX, (sim_reg_smc_rd(SMC_SETUP4_INDEX) & ~0x00003F00) | (ncswrsetup << 8));
-}
-
-__INLINE uint8_t smc_setup4_nwe_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP4_INDEX);
-    return ((localVal & 0x0000003F) >> 0);
-}
-
-__INLINE void smc_setup4_nwe_setup_setf(uint8_t nwesetup)
-{
-    ASSERT_ERR(((nwesetup << 0) & ~0x0000003F) == 0);
-    sim_reg_smc_wr(SMC_SETUP4_INDEX, (sim_reg_smc_rd(SMC_SETUP4_INDEX) & ~0x0000003F) | (nwesetup << 0));
-}
-
 /**
  * @brief SMC_PULSE4 register definition
  * <pre>
@@ -2086,16 +609,6 @@ __INLINE void smc_setup4_nwe_setup_setf(uint8_t nwesetup)
  */
 #define SMC_PULSE4_INDEX  0x00000011
 
-__INLINE uint32_t smc_pulse4_get(void)
-{
-    return sim_reg_smc_rd(SMC_PULSE4_INDEX);
-}
-
-__INLINE void smc_pulse4_set(uint32_t value)
-{
-    sim_reg_smc_wr(SMC_PULSE4_INDEX, value);
-}
-
 // field definitions
 #define NCS_RD_PULSE_MASK   0x7F000000
 #define NCS_RD_PULSE_LSB    24
@@ -2115,73 +628,6 @@ __INLINE void smc_pulse4_set(uint32_t value)
 #define NCS_WR_PULSE_RST    0x0
 #define NWE_PULSE_RST       0x0
 
-__INLINE void smc_pulse4_pack(uint8_t ncsrdpulse, uint8_t nrdpulse, uint8_t ncswrpulse, uint8_t nwepulse)
-{
-    ASSERT_ERR(((ncsrdpulse << 24) & ~0x7F000000) == 0);
-    ASSERT_ERR(((nrdpulse << 16) & ~0x007F0000) == 0);
-    ASSERT_ERR(((ncswrpulse << 8) & ~0x00007F00) == 0);
-    ASSERT_ERR(((nwepulse << 0) & ~0x0000007F) == 0);
-    sim_reg_smc_wr(SMC_PULSE4_INDEX,  (ncsrdpulse << 24) | (nrdpulse << 16) | (ncswrpulse << 8) | (nwepulse << 0));
-}
-
-__INLINE void smc_pulse4_unpack(uint8_t* ncsrdpulse, uint8_t* nrdpulse, uint8_t* ncswrpulse, uint8_t* nwepulse)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE4_INDEX);
-
-    *ncsrdpulse = (localVal & 0x7F000000) >> 24;
-    *nrdpulse = (localVal & 0x007F0000) >> 16;
-    *ncswrpulse = (localVal & 0x00007F00) >> 8;
-    *nwepulse = (localVal & 0x0000007F) >> 0;
-}
-
-__INLINE uint8_t smc_pulse4_ncs_rd_pulse_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE4_INDEX);
-    return ((localVal & 0x7F000000) >> 24);
-}
-
-__INLINE void smc_pulse4_ncs_rd_pulse_setf(uint8_t ncsrdpulse)
-{
-    ASSERT_ERR(((ncsrdpulse << 24) & ~0x7F000000) == 0);
-    sim_reg_smc_wr(SMC_PULSE4_INDEX, (sim_reg_smc_rd(SMC_PULSE4_INDEX) & ~0x7F000000) | (ncsrdpulse << 24));
-}
-
-__INLINE uint8_t smc_pulse4_nrd_pulse_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE4_INDEX);
-    return ((localVal & 0x007F0000) >> 16);
-}
-
-__INLINE void smc_pulse4_nrd_pulse_setf(uint8_t nrdpulse)
-{
-    ASSERT_ERR(((nrdpulse << 16) & ~0x007F0000) == 0);
-    sim_reg_smc_wr(SMC_PULSE4_INDEX, (sim_reg_smc_rd(SMC_PULSE4_INDEX) & ~0x007F0000) | (nrdpulse << 16));
-}
-
-__INLINE uint8_t smc_pulse4_ncs_wr_pulse_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE4_INDEX);
-    return ((localVal & 0x00007F00) >> 8);
-}
-
-__INLINE void smc_pulse4_ncs_wr_pulse_setf(uint8_t ncswrpulse)
-{
-    ASSERT_ERR(((ncswrpulse << 8) & ~0x00007F00) == 0);
-    sim_reg_smc_wr(SMC_PULSE4_INDEX, (sim_reg_smc_rd(SMC_PULSE4_INDEX) & ~0x00007F00) | (ncswrpulse << 8));
-}
-
-__INLINE uint8_t smc_pulse4_nwe_pulse_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE4_INDEX);
-    return ((localVal & 0x0000007F) >> 0);
-}
-
-__INLINE void smc_pulse4_nwe_pulse_setf(uint8_t nwepulse)
-{
-    ASSERT_ERR(((nwepulse << 0) & ~0x0000007F) == 0);
-    sim_reg_smc_wr(SMC_PULSE4_INDEX, (sim_reg_smc_rd(SMC_PULSE4_INDEX) & ~0x0000007F) | (nwepulse << 0));
-}
-
 /**
  * @brief SMC_CYCLE4 register definition
  * <pre>
@@ -2193,16 +639,6 @@ __INLINE void smc_pulse4_nwe_pulse_setf(uint8_t nwepulse)
  */
 #define SMC_CYCLE4_INDEX  0x00000012
 
-__INLINE uint32_t smc_cycle4_get(void)
-{
-    return sim_reg_smc_rd(SMC_CYCLE4_INDEX);
-}
-
-__INLINE void smc_cycle4_set(uint32_t value)
-{
-    sim_reg_smc_wr(SMC_CYCLE4_INDEX, value);
-}
-
 // field definitions
 #define NRD_CYCLE_MASK   0x01FF0000
 #define NRD_CYCLE_LSB    16
@@ -2214,45 +650,6 @@ __INLINE void smc_cycle4_set(uint32_t value)
 #define NRD_CYCLE_RST    0x0
 #define NWE_CYCLE_RST    0x0
 
-__INLINE void smc_cycle4_pack(uint16_t nrdcycle, uint16_t nwecycle)
-{
-    ASSERT_ERR(((nrdcycle << 16) & ~0x01FF0000) == 0);
-    ASSERT_ERR(((nwecycle << 0) & ~0x000001FF) == 0);
-    sim_reg_smc_wr(SMC_CYCLE4_INDEX,  (nrdcycle << 16) | (nwecycle << 0));
-}
-
-__INLINE void smc_cycle4_unpack(uint16_t* nrdcycle, uint16_t* nwecycle)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_CYCLE4_INDEX);
-
-    *nrdcycle = (localVal & 0x01FF0000) >> 16;
-    *nwecycle = (localVal & 0x000001FF) >> 0;
-}
-
-__INLINE uint16_t smc_cycle4_nrd_cycle_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_CYCLE4_INDEX);
-    return ((localVal & 0x01FF0000) >> 16);
-}
-
-__INLINE void smc_cycle4_nrd_cycle_setf(uint16_t nrdcycle)
-{
-    ASSERT_ERR(((nrdcycle << 16) & ~0x01FF0000) == 0);
-    sim_reg_smc_wr(SMC_CYCLE4_INDEX, (sim_reg_smc_rd(SMC_CYCLE4_INDEX) & ~0x01FF0000) | (nrdcycle << 16));
-}
-
-__INLINE uint16_t smc_cycle4_nwe_cycle_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_CYCLE4_INDEX);
-    return ((localVal & 0x000001FF) >> 0);
-}
-
-__INLINE void smc_cycle4_nwe_cycle_setf(uint16_t nwecycle)
-{
-    ASSERT_ERR(((nwecycle << 0) & ~0x000001FF) == 0);
-    sim_reg_smc_wr(SMC_CYCLE4_INDEX, (sim_reg_smc_rd(SMC_CYCLE4_INDEX) & ~0x000001FF) | (nwecycle << 0));
-}
-
 /**
  * @brief SMC_MODE4 register definition
  * <pre>
@@ -2271,16 +668,6 @@ __INLINE void smc_cycle4_nwe_cycle_setf(uint16_t nwecycle)
  */
 #define SMC_MODE4_INDEX  0x00000013
 
-__INLINE uint32_t smc_mode4_get(void)
-{
-    return sim_reg_smc_rd(SMC_MODE4_INDEX);
-}
-
-__INLINE void smc_mode4_set(uint32_t value)
-{
-    sim_reg_smc_wr(SMC_MODE4_INDEX, value);
-}
-
 // field definitions
 #define PS_MASK           0x30000000
 #define PS_LSB            28
@@ -2315,143 +702,6 @@ __INLINE void smc_mode4_set(uint32_t value)
 #define WRITE_MODE_RST    0x0
 #define READ_MODE_RST     0x0
 
-__INLINE void smc_mode4_pack(uint8_t ps, uint8_t pmen, uint8_t tdfmode, uint8_t tdfcycles, uint8_t dbw, uint8_t bat, uint8_t exnwmode, uint8_t writemode, uint8_t readmode)
-{
-    ASSERT_ERR(((ps << 28) & ~0x30000000) == 0);
-    ASSERT_ERR(((pmen << 24) & ~0x01000000) == 0);
-    ASSERT_ERR(((tdfmode << 20) & ~0x00100000) == 0);
-    ASSERT_ERR(((tdfcycles << 16) & ~0x000F0000) == 0);
-    ASSERT_ERR(((dbw << 12) & ~0x00003000) == 0);
-    ASSERT_ERR(((bat << 8) & ~0x00000100) == 0);
-    ASSERT_ERR(((exnwmode << 4) & ~0x00000030) == 0);
-    ASSERT_ERR(((writemode << 1) & ~0x00000002) == 0);
-    ASSERT_ERR(((readmode << 0) & ~0x00000001) == 0);
-    sim_reg_smc_wr(SMC_MODE4_INDEX,  (ps << 28) | (pmen << 24) | (tdfmode << 20) | (tdfcycles << 16) | (dbw << 12) | (bat << 8) | (exnwmode << 4) | (writemode << 1) | (readmode << 0));
-}
-
-__INLINE void smc_mode4_unpack(uint8_t* ps, uint8_t* pmen, uint8_t* tdfmode, uint8_t* tdfcycles, uint8_t* dbw, uint8_t* bat, uint8_t* exnwmode, uint8_t* writemode, uint8_t* readmode)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE4_INDEX);
-
-    *ps = (localVal & 0x30000000) >> 28;
-    *pmen = (localVal & 0x01000000) >> 24;
-    *tdfmode = (localVal & 0x00100000) >> 20;
-    *tdfcycles = (localVal & 0x000F0000) >> 16;
-    *dbw = (localVal & 0x00003000) >> 12;
-    *bat = (localVal & 0x00000100) >> 8;
-    *exnwmode = (localVal & 0x00000030) >> 4;
-    *writemode = (localVal & 0x00000002) >> 1;
-    *readmode = (localVal & 0x00000001) >> 0;
-}
-
-__INLINE uint8_t smc_mode4_ps_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE4_INDEX);
-    return ((localVal & 0x30000000) >> 28);
-}
-
-__INLINE void smc_mode4_ps_setf(uint8_t ps)
-{
-    ASSERT_ERR(((ps << 28) & ~0x30000000) == 0);
-    sim_reg_smc_wr(SMC_MODE4_INDEX, (sim_reg_smc_rd(SMC_MODE4_INDEX) & ~0x30000000) | (ps << 28));
-}
-
-__INLINE uint8_t smc_mode4_pmen_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE4_INDEX);
-    return ((localVal & 0x01000000) >> 24);
-}
-
-__INLINE void smc_mode4_pmen_setf(uint8_t pmen)
-{
-    ASSERT_ERR(((pmen << 24) & ~0x01000000) == 0);
-    sim_reg_smc_wr(SMC_MODE4_INDEX, (sim_reg_smc_rd(SMC_MODE4_INDEX) & ~0x01000000) | (pmen << 24));
-}
-
-__INLINE uint8_t smc_mode4_tdf_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE4_INDEX);
-    return ((localVal & 0x00100000) >> 20);
-}
-
-__INLINE void smc_mode4_tdf_mode_setf(uint8_t tdfmode)
-{
-    ASSERT_ERR(((tdfmode << 20) & ~0x00100000) == 0);
-    sim_reg_smc_wr(SMC_MODE4_INDEX, (sim_reg_smc_rd(SMC_MODE4_INDEX) & ~0x00100000) | (tdfmode << 20));
-}
-
-__INLINE uint8_t smc_mode4_tdf_cycles_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE4_INDEX);
-    return ((localVal & 0x000F0000) >> 16);
-}
-
-__INLINE void smc_mode4_tdf_cycles_setf(uint8_t tdfcycles)
-{
-    ASSERT_ERR(((tdfcycles << 16) & ~0x000F0000) == 0);
-    sim_reg_smc_wr(SMC_MODE4_INDEX, (sim_reg_smc_rd(SMC_MODE4_INDEX) & ~0x000F0000) | (tdfcycles << 16));
-}
-
-__INLINE uint8_t smc_mode4_dbw_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE4_INDEX);
-    return ((localVal & 0x00003000) >> 12);
-}
-
-__INLINE void smc_mode4_dbw_setf(uint8_t dbw)
-{
-    ASSERT_ERR(((dbw << 12) & ~0x00003000) == 0);
-    sim_reg_smc_wr(SMC_MODE4_INDEX, (sim_reg_smc_rd(SMC_MODE4_INDEX) & ~0x00003000) | (dbw << 12));
-}
-
-__INLINE uint8_t smc_mode4_bat_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE4_INDEX);
-    return ((localVal & 0x00000100) >> 8);
-}
-
-__INLINE void smc_mode4_bat_setf(uint8_t bat)
-{
-    ASSERT_ERR(((bat << 8) & ~0x00000100) == 0);
-    sim_reg_smc_wr(SMC_MODE4_INDEX, (sim_reg_smc_rd(SMC_MODE4_INDEX) & ~0x00000100) | (bat << 8));
-}
-
-__INLINE uint8_t smc_mode4_exnw_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE4_INDEX);
-    return ((localVal & 0x00000030) >> 4);
-}
-
-__INLINE void smc_mode4_exnw_mode_setf(uint8_t exnwmode)
-{
-    ASSERT_ERR(((exnwmode << 4) & ~0x00000030) == 0);
-    sim_reg_smc_wr(SMC_MODE4_INDEX, (sim_reg_smc_rd(SMC_MODE4_INDEX) & ~0x00000030) | (exnwmode << 4));
-}
-
-__INLINE uint8_t smc_mode4_write_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE4_INDEX);
-    return ((localVal & 0x00000002) >> 1);
-}
-
-__INLINE void smc_mode4_write_mode_setf(uint8_t writemode)
-{
-    ASSERT_ERR(((writemode << 1) & ~0x00000002) == 0);
-    sim_reg_smc_wr(SMC_MODE4_INDEX, (sim_reg_smc_rd(SMC_MODE4_INDEX) & ~0x00000002) | (writemode << 1));
-}
-
-__INLINE uint8_t smc_mode4_read_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE4_INDEX);
-    return ((localVal & 0x00000001) >> 0);
-}
-
-__INLINE void smc_mode4_read_mode_setf(uint8_t readmode)
-{
-    ASSERT_ERR(((readmode << 0) & ~0x00000001) == 0);
-    sim_reg_smc_wr(SMC_MODE4_INDEX, (sim_reg_smc_rd(SMC_MODE4_INDEX) & ~0x00000001) | (readmode << 0));
-}
-
 /**
  * @brief SMC_SETUP5 register definition
  * <pre>
@@ -2465,16 +715,6 @@ __INLINE void smc_mode4_read_mode_setf(uint8_t readmode)
  */
 #define SMC_SETUP5_INDEX  0x00000014
 
-__INLINE uint32_t smc_setup5_get(void)
-{
-    return sim_reg_smc_rd(SMC_SETUP5_INDEX);
-}
-
-__INLINE void smc_setup5_set(uint32_t value)
-{
-    sim_reg_smc_wr(SMC_SETUP5_INDEX, value);
-}
-
 // field definitions
 #define NCS_RD_SETUP_MASK   0x3F000000
 #define NCS_RD_SETUP_LSB    24
@@ -2494,73 +734,6 @@ __INLINE void smc_setup5_set(uint32_t value)
 #define NCS_WR_SETUP_RST    0x0
 #define NWE_SETUP_RST       0x0
 
-__INLINE void smc_setup5_pack(uint8_t ncsrdsetup, uint8_t nrdsetup, uint8_t ncswrsetup, uint8_t nwesetup)
-{
-    ASSERT_ERR(((ncsrdsetup << 24) & ~0x3F000000) == 0);
-    ASSERT_ERR(((nrdsetup << 16) & ~0x003F0000) == 0);
-    ASSERT_ERR(((ncswrsetup << 8) & ~0x00003F00) == 0);
-    ASSERT_ERR(((nwesetup << 0) & ~0x0000003F) == 0);
-    sim_reg_smc_wr(SMC_SETUP5_INDEX,  (ncsrdsetup << 24) | (nrdsetup << 16) | (ncswrsetup << 8) | (nwesetup << 0));
-}
-
-__INLINE void smc_setup5_unpack(uint8_t* ncsrdsetup, uint8_t* nrdsetup, uint8_t* ncswrsetup, uint8_t* nwesetup)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP5_INDEX);
-
-    *ncsrdsetup = (localVal & 0x3F000000) >> 24;
-    *nrdsetup = (localVal & 0x003F0000) >> 16;
-    *ncswrsetup = (localVal & 0x00003F00) >> 8;
-    *nwesetup = (localVal & 0x0000003F) >> 0;
-}
-
-__INLINE uint8_t smc_setup5_ncs_rd_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP5_INDEX);
-    return ((localVal & 0x3F000000) >> 24);
-}
-
-__INLINE void smc_setup5_ncs_rd_setup_setf(uint8_t ncsrdsetup)
-{
-    ASSERT_ERR(((ncsrdsetup << 24) & ~0x3F000000) == 0);
-    sim_reg_smc_wr(SMC_SETUP5_INDEX, (sim_reg_smc_rd(SMC_SETUP5_INDEX) & ~0x3F000000) | (ncsrdsetup << 24));
-}
-
-__INLINE uint8_t smc_setup5_nrd_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP5_INDEX);
-    return ((localVal & 0x003F0000) >> 16);
-}
-
-__INLINE void smc_setup5_nrd_setup_setf(uint8_t nrdsetup)
-{
-    ASSERT_ERR(((nrdsetup << 16) & ~0x003F0000) == 0);
-    sim_reg_smc_wr(SMC_SETUP5_INDEX, (sim_reg_smc_rd(SMC_SETUP5_INDEX) & ~0x003F0000) | (nrdsetup << 16));
-}
-
-__INLINE uint8_t smc_setup5_ncs_wr_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP5_INDEX);
-    return ((localVal & 0x00003F00) >> 8);
-}
-
-__INLINE void smc_setup5_ncs_wr_setup_setf(uint8_t ncswrsetup)
-{
-    ASSERT_ERR(((ncswrsetup << 8) & ~0x00003F00) == 0);
-    sim_reg_smc_wr(SMC_SETUP5_INDEX, (sim_reg_smc_rd(SMC_SETUP5_INDEX) & ~0x00003F00) | (ncswrsetup << 8));
-}
-
-__INLINE uint8_t smc_setup5_nwe_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP5_INDEX);
-    return ((localVal & 0x0000003F) >> 0);
-}
-
-__INLINE void smc_setup5_nwe_setup_setf(uint8_t nwesetup)
-{
-    ASSERT_ERR(((nwesetup << 0) & ~0x0000003F) == 0);
-    sim_reg_smc_wr(SMC_SETUP5_INDEX, (sim_reg_smc_rd(SMC_SETUP5_INDEX) & ~0x0000003F) | (nwesetup << 0));
-}
-
 /**
  * @brief SMC_PULSE5 register definition
  * <pre>
@@ -2574,16 +747,6 @@ __INLINE void smc_setup5_nwe_setup_setf(uint8_t nwesetup)
  */
 #define SMC_PULSE5_INDEX  0x00000015
 
-__INLINE uint32_t smc_pulse5_get(void)
-{
-    return sim_reg_smc_rd(SMC_PULSE5_INDEX);
-}
-
-__INLINE void smc_pulse5_set(uint32_t value)
-{
-    sim_reg_smc_wr(SMC_PULSE5_INDEX, value);
-}
-
 // field definitions
 #define NCS_RD_PULSE_MASK   0x7F000000
 #define NCS_RD_PULSE_LSB    24
@@ -2603,73 +766,6 @@ __INLINE void smc_pulse5_set(uint32_t value)
 #define NCS_WR_PULSE_RST    0x0
 #define NWE_PULSE_RST       0x0
 
-__INLINE void smc_pulse5_pack(uint8_t ncsrdpulse, uint8_t nrdpulse, uint8_t ncswrpulse, uint8_t nwepulse)
-{
-    ASSERT_ERR(((ncsrdpulse << 24) & ~0x7F000000) == 0);
-    ASSERT_ERR(((nrdpulse << 16) & ~0x007F0000) == 0);
-    ASSERT_ERR(((ncswrpulse << 8) & ~0x00007F00) == 0);
-    ASSERT_ERR(((nwepulse << 0) & ~0x0000007F) == 0);
-    sim_reg_smc_wr(SMC_PULSE5_INDEX,  (ncsrdpulse << 24) | (nrdpulse << 16) | (ncswrpulse << 8) | (nwepulse << 0));
-}
-
-__INLINE void smc_pulse5_unpack(uint8_t* ncsrdpulse, uint8_t* nrdpulse, uint8_t* ncswrpulse, uint8_t* nwepulse)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE5_INDEX);
-
-    *ncsrdpulse = (localVal & 0x7F000000) >> 24;
-    *nrdpulse = (localVal & 0x007F0000) >> 16;
-    *ncswrpulse = (localVal & 0x00007F00) >> 8;
-    *nwepulse = (localVal & 0x0000007F) >> 0;
-}
-
-__INLINE uint8_t smc_pulse5_ncs_rd_pulse_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE5_INDEX);
-    return ((localVal & 0x7F000000) >> 24);
-}
-
-__INLINE void smc_pulse5_ncs_rd_pulse_setf(uint8_t ncsrdpulse)
-{
-    ASSERT_ERR(((ncsrdpulse << 24) & ~0x7F000000) == 0);
-    sim_reg_smc_wr(SMC_PULSE5_INDEX, (sim_reg_smc_rd(SMC_PULSE5_INDEX) & ~0x7F000000) | (ncsrdpulse << 24));
-}
-
-__INLINE uint8_t smc_pulse5_nrd_pulse_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE5_INDEX);
-    return ((localVal & 0x007F0000) >> 16);
-}
-
-__INLINE void smc_pulse5_nrd_pulse_setf(uint8_t nrdpulse)
-{
-    ASSERT_ERR(((nrdpulse << 16) & ~0x007F0000) == 0);
-    sim_reg_smc_wr(SMC_PULSE5_INDEX, (sim_reg_smc_rd(SMC_PULSE5_INDEX) & ~0x007F0000) | (nrdpulse << 16));
-}
-
-__INLINE uint8_t smc_pulse5_ncs_wr_pulse_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE5_INDEX);
-    return ((localVal & 0x00007F00) >> 8);
-}
-
-__INLINE void smc_pulse5_ncs_wr_pulse_setf(uint8_t ncswrpulse)
-{
-    ASSERT_ERR(((ncswrpulse << 8) & ~0x00007F00) == 0);
-    sim_reg_smc_wr(SMC_PULSE5_INDEX, (sim_reg_smc_rd(SMC_PULSE5_INDEX) & ~0x00007F00) | (ncswrpulse << 8));
-}
-
-__INLINE uint8_t smc_pulse5_nwe_pulse_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE5_INDEX);
-    return ((localVal & 0x0000007F) >> 0);
-}
-
-__INLINE void smc_pulse5_nwe_pulse_setf(uint8_t nwepulse)
-{
-    ASSERT_ERR(((nwepulse << 0) & ~0x0000007F) == 0);
-    sim_reg_smc_wr(SMC_PULSE5_INDEX, (sim_reg_smc_rd(SMC_PULSE5_INDEX) & ~0x0000007F) | (nwepulse << 0));
-}
-
 /**
  * @brief SMC_CYCLE5 register definition
  * <pre>
@@ -2681,16 +777,6 @@ __INLINE void smc_pulse5_nwe_pulse_setf(uint8_t nwepulse)
  */
 #define SMC_CYCLE5_INDEX  0x00000016
 
-__INLINE uint32_t smc_cycle5_get(void)
-{
-    return sim_reg_smc_rd(SMC_CYCLE5_INDEX);
-}
-
-__INLINE void smc_cycle5_set(uint32_t value)
-{
-    sim_reg_smc_wr(SMC_CYCLE5_INDEX, value);
-}
-
 // field definitions
 #define NRD_CYCLE_MASK   0x01FF0000
 #define NRD_CYCLE_LSB    16
@@ -2702,45 +788,6 @@ __INLINE void smc_cycle5_set(uint32_t value)
 #define NRD_CYCLE_RST    0x0
 #define NWE_CYCLE_RST    0x0
 
-__INLINE void smc_cycle5_pack(uint16_t nrdcycle, uint16_t nwecycle)
-{
-    ASSERT_ERR(((nrdcycle << 16) & ~0x01FF0000) == 0);
-    ASSERT_ERR(((nwecycle << 0) & ~0x000001FF) == 0);
-    sim_reg_smc_wr(SMC_CYCLE5_INDEX,  (nrdcycle << 16) | (nwecycle << 0));
-}
-
-__INLINE void smc_cycle5_unpack(uint16_t* nrdcycle, uint16_t* nwecycle)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_CYCLE5_INDEX);
-
-    *nrdcycle = (localVal & 0x01FF0000) >> 16;
-    *nwecycle = (localVal & 0x000001FF) >> 0;
-}
-
-__INLINE uint16_t smc_cycle5_nrd_cycle_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_CYCLE5_INDEX);
-    return ((localVal & 0x01FF0000) >> 16);
-}
-
-__INLINE void smc_cycle5_nrd_cycle_setf(uint16_t nrdcycle)
-{
-    ASSERT_ERR(((nrdcycle << 16) & ~0x01FF0000) == 0);
-    sim_reg_smc_wr(SMC_CYCLE5_INDEX, (sim_reg_smc_rd(SMC_CYCLE5_INDEX) & ~0x01FF0000) | (nrdcycle << 16));
-}
-
-__INLINE uint16_t smc_cycle5_nwe_cycle_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_CYCLE5_INDEX);
-    return ((localVal & 0x000001FF) >> 0);
-}
-
-__INLINE void smc_cycle5_nwe_cycle_setf(uint16_t nwecycle)
-{
-    ASSERT_ERR(((nwecycle << 0) & ~0x000001FF) == 0);
-    sim_reg_smc_wr(SMC_CYCLE5_INDEX, (sim_reg_smc_rd(SMC_CYCLE5_INDEX) & ~0x000001FF) | (nwecycle << 0));
-}
-
 /**
  * @brief SMC_MODE5 register definition
  * <pre>
@@ -2756,18 +803,8 @@ __INLINE void smc_cycle5_nwe_cycle_setf(uint16_t nwecycle)
  *     01           WRITE_MODE   0
  *     00            READ_MODE   0
  * </pre>
- */
-#define SMC_MODE5_INDEX  0x00000017
-
-__INLINE uint32_t smc_mode5_get(void)
-{
-    return sim_reg_smc_rd(SMC_MODE5_INDEX);
-}
-
-__INLINE void smc_mode5_set(uint32_t value)
-{
-    sim_reg_smc_wr(SMC_MODE5_INDEX, value);
-}
+ */
+#define SMC_MODE5_INDEX  0x00000017
 
 // field definitions
 #define PS_MASK           0x30000000
@@ -2803,143 +840,6 @@ __INLINE void smc_mode5_set(uint32_t value)
 #define WRITE_MODE_RST    0x0
 #define READ_MODE_RST     0x0
 
-__INLINE void smc_mode5_pack(uint8_t ps, uint8_t pmen, uint8_t tdfmode, uint8_t tdfcycles, uint8_t dbw, uint8_t bat, uint8_t exnwmode, uint8_t writemode, uint8_t readmode)
-{
-    ASSERT_ERR(((ps << 28) & ~0x30000000) == 0);
-    ASSERT_ERR(((pmen << 24) & ~0x01000000) == 0);
-    ASSERT_ERR(((tdfmode << 20) & ~0x00100000) == 0);
-    ASSERT_ERR(((tdfcycles << 16) & ~0x000F0000) == 0);
-    ASSERT_ERR(((dbw << 12) & ~0x00003000) == 0);
-    ASSERT_ERR(((bat << 8) & ~0x00000100) == 0);
-    ASSERT_ERR(((exnwmode << 4) & ~0x00000030) == 0);
-    ASSERT_ERR(((writemode << 1) & ~0x00000002) == 0);
-    ASSERT_ERR(((readmode << 0) & ~0x00000001) == 0);
-    sim_reg_smc_wr(SMC_MODE5_INDEX,  (ps << 28) | (pmen << 24) | (tdfmode << 20) | (tdfcycles << 16) | (dbw << 12) | (bat << 8) | (exnwmode << 4) | (writemode << 1) | (readmode << 0));
-}
-
-__INLINE void smc_mode5_unpack(uint8_t* ps, uint8_t* pmen, uint8_t* tdfmode, uint8_t* tdfcycles, uint8_t* dbw, uint8_t* bat, uint8_t* exnwmode, uint8_t* writemode, uint8_t* readmode)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE5_INDEX);
-
-    *ps = (localVal & 0x30000000) >> 28;
-    *pmen = (localVal & 0x01000000) >> 24;
-    *tdfmode = (localVal & 0x00100000) >> 20;
-    *tdfcycles = (localVal & 0x000F0000) >> 16;
-    *dbw = (localVal & 0x00003000) >> 12;
-    *bat = (localVal & 0x00000100) >> 8;
-    *exnwmode = (localVal & 0x00000030) >> 4;
-    *writemode = (localVal & 0x00000002) >> 1;
-    *readmode = (localVal & 0x00000001) >> 0;
-}
-
-__INLINE uint8_t smc_mode5_ps_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE5_INDEX);
-    return ((localVal & 0x30000000) >> 28);
-}
-
-__INLINE void smc_mode5_ps_setf(uint8_t ps)
-{
-    ASSERT_ERR(((ps << 28) & ~0x30000000) == 0);
-    sim_reg_smc_wr(SMC_MODE5_INDEX, (sim_reg_smc_rd(SMC_MODE5_INDEX) & ~0x30000000) | (ps << 28));
-}
-
-__INLINE uint8_t smc_mode5_pmen_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE5_INDEX);
-    return ((localVal & 0x01000000) >> 24);
-}
-
-__INLINE void smc_mode5_pmen_setf(uint8_t pmen)
-{
-    ASSERT_ERR(((pmen << 24) & ~0x01000000) == 0);
-    sim_reg_smc_wr(SMC_MODE5_INDEX, (sim_reg_smc_rd(SMC_MODE5_INDEX) & ~0x01000000) | (pmen << 24));
-}
-
-__INLINE uint8_t smc_mode5_tdf_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE5_INDEX);
-    return ((localVal & 0x00100000) >> 20);
-}
-
-__INLINE void smc_mode5_tdf_mode_setf(uint8_t tdfmode)
-{
-    ASSERT_ERR(((tdfmode << 20) & ~0x00100000) == 0);
-    sim_reg_smc_wr(SMC_MODE5_INDEX, (sim_reg_smc_rd(SMC_MODE5_INDEX) & ~0x00100000) | (tdfmode << 20));
-}
-
-__INLINE uint8_t smc_mode5_tdf_cycles_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE5_INDEX);
-    return ((localVal & 0x000F0000) >> 16);
-}
-
-__INLINE void smc_mode5_tdf_cycles_setf(uint8_t tdfcycles)
-{
-    ASSERT_ERR(((tdfcycles << 16) & ~0x000F0000) == 0);
-    sim_reg_smc_wr(SMC_MODE5_INDEX, (sim_reg_smc_rd(SMC_MODE5_INDEX) & ~0x000F0000) | (tdfcycles << 16));
-}
-
-__INLINE uint8_t smc_mode5_dbw_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE5_INDEX);
-    return ((localVal & 0x00003000) >> 12);
-}
-
-__INLINE void smc_mode5_dbw_setf(uint8_t dbw)
-{
-    ASSERT_ERR(((dbw << 12) & ~0x00003000) == 0);
-    sim_reg_smc_wr(SMC_MODE5_INDEX, (sim_reg_smc_rd(SMC_MODE5_INDEX) & ~0x00003000) | (dbw << 12));
-}
-
-__INLINE uint8_t smc_mode5_bat_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE5_INDEX);
-    return ((localVal & 0x00000100) >> 8);
-}
-
-__INLINE void smc_mode5_bat_setf(uint8_t bat)
-{
-    ASSERT_ERR(((bat << 8) & ~0x00000100) == 0);
-    sim_reg_smc_wr(SMC_MODE5_INDEX, (sim_reg_smc_rd(SMC_MODE5_INDEX) & ~0x00000100) | (bat << 8));
-}
-
-__INLINE uint8_t smc_mode5_exnw_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE5_INDEX);
-    return ((localVal & 0x00000030) >> 4);
-}
-
-__INLINE void smc_mode5_exnw_mode_setf(uint8_t exnwmode)
-{
-    ASSERT_ERR(((exnwmode << 4) & ~0x00000030) == 0);
-    sim_reg_smc_wr(SMC_MODE5_INDEX, (sim_reg_smc_rd(SMC_MODE5_INDEX) & ~0x00000030) | (exnwmode << 4));
-}
-
-__INLINE uint8_t smc_mode5_write_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE5_INDEX);
-    return ((localVal & 0x00000002) >> 1);
-}
-
-__INLINE void smc_mode5_write_mode_setf(uint8_t writemode)
-{
-    ASSERT_ERR(((writemode << 1) & ~0x00000002) == 0);
-    sim_reg_smc_wr(SMC_MODE5_INDEX, (sim_reg_smc_rd(SMC_MODE5_INDEX) & ~0x00000002) | (writemode << 1));
-}
-
-__INLINE uint8_t smc_mode5_read_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE5_INDEX);
-    return ((localVal & 0x00000001) >> 0);
-}
-
-__INLINE void smc_mode5_read_mode_setf(uint8_t readmode)
-{
-    ASSERT_ERR(((readmode << 0) & ~0x00000001) == 0);
-    sim_reg_smc_wr(SMC_MODE5_INDEX, (sim_reg_smc_rd(SMC_MODE5_INDEX) & ~0x00000001) | (readmode << 0));
-}
-
 /**
  * @brief SMC_SETUP6 register definition
  * <pre>
@@ -2953,16 +853,6 @@ __INLINE void smc_mode5_read_mode_setf(uint8_t readmode)
  */
 #define SMC_SETUP6_INDEX  0x00000018
 
-__INLINE uint32_t smc_setup6_get(void)
-{
-    return sim_reg_smc_rd(SMC_SETUP6_INDEX);
-}
-
-__INLINE void smc_setup6_set(uint32_t value)
-{
-    sim_reg_smc_wr(SMC_SETUP6_INDEX, value);
-}
-
 // field definitions
 #define NCS_RD_SETUP_MASK   0x3F000000
 #define NCS_RD_SETUP_LSB    24
@@ -2982,73 +872,6 @@ __INLINE void smc_setup6_set(uint32_t value)
 #define NCS_WR_SETUP_RST    0x0
 #define NWE_SETUP_RST       0x0
 
-__INLINE void smc_setup6_pack(uint8_t ncsrdsetup, uint8_t nrdsetup, uint8_t ncswrsetup, uint8_t nwesetup)
-{
-    ASSERT_ERR(((ncsrdsetup << 24) & ~0x3F000000) == 0);
-    ASSERT_ERR(((nrdsetup << 16) & ~0x003F0000) == 0);
-    ASSERT_ERR(((ncswrsetup << 8) & ~0x00003F00) == 0);
-    ASSERT_ERR(((nwesetup << 0) & ~0x0000003F) == 0);
-    sim_reg_smc_wr(SMC_SETUP6_INDEX,  (ncsrdsetup << 24) | (nrdsetup << 16) | (ncswrsetup << 8) | (nwesetup << 0));
-}
-
-__INLINE void smc_setup6_unpack(uint8_t* ncsrdsetup, uint8_t* nrdsetup, uint8_t* ncswrsetup, uint8_t* nwesetup)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP6_INDEX);
-
-    *ncsrdsetup = (localVal & 0x3F000000) >> 24;
-    *nrdsetup = (localVal & 0x003F0000) >> 16;
-    *ncswrsetup = (localVal & 0x00003F00) >> 8;
-    *nwesetup = (localVal & 0x0000003F) >> 0;
-}
-
-__INLINE uint8_t smc_setup6_ncs_rd_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP6_INDEX);
-    return ((localVal & 0x3F000000) >> 24);
-}
-
-__INLINE void smc_setup6_ncs_rd_setup_setf(uint8_t ncsrdsetup)
-{
-    ASSERT_ERR(((ncsrdsetup << 24) & ~0x3F000000) == 0);
-    sim_reg_smc_wr(SMC_SETUP6_INDEX, (sim_reg_smc_rd(SMC_SETUP6_INDEX) & ~0x3F000000) | (ncsrdsetup << 24));
-}
-
-__INLINE uint8_t smc_setup6_nrd_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP6_INDEX);
-    return ((localVal & 0x003F0000) >> 16);
-}
-
-__INLINE void smc_setup6_nrd_setup_setf(uint8_t nrdsetup)
-{
-    ASSERT_ERR(((nrdsetup << 16) & ~0x003F0000) == 0);
-    sim_reg_smc_wr(SMC_SETUP6_INDEX, (sim_reg_smc_rd(SMC_SETUP6_INDEX) & ~0x003F0000) | (nrdsetup << 16));
-}
-
-__INLINE uint8_t smc_setup6_ncs_wr_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP6_INDEX);
-    return ((localVal & 0x00003F00) >> 8);
-}
-
-__INLINE void smc_setup6_ncs_wr_setup_setf(uint8_t ncswrsetup)
-{
-    ASSERT_ERR(((ncswrsetup << 8) & ~0x00003F00) == 0);
-    sim_reg_smc_wr(SMC_SETUP6_INDEX, (sim_reg_smc_rd(SMC_SETUP6_INDEX) & ~0x00003F00) | (ncswrsetup << 8));
-}
-
-__INLINE uint8_t smc_setup6_nwe_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP6_INDEX);
-    return ((localVal & 0x0000003F) >> 0);
-}
-
-__INLINE void smc_setup6_nwe_setup_setf(uint8_t nwesetup)
-{
-    ASSERT_ERR(((nwesetup << 0) & ~0x0000003F) == 0);
-    sim_reg_smc_wr(SMC_SETUP6_INDEX, (sim_reg_smc_rd(SMC_SETUP6_INDEX) & ~0x0000003F) | (nwesetup << 0));
-}
-
 /**
  * @brief SMC_PULSE6 register definition
  * <pre>
@@ -3062,16 +885,6 @@ __INLINE void smc_setup6_nwe_setup_setf(uint8_t nwesetup)
  */
 #define SMC_PULSE6_INDEX  0x00000019
 
-__INLINE uint32_t smc_pulse6_get(void)
-{
-    return sim_reg_smc_rd(SMC_PULSE6_INDEX);
-}
-
-__INLINE void smc_pulse6_set(uint32_t value)
-{
-    sim_reg_smc_wr(SMC_PULSE6_INDEX, value);
-}
-
 // field definitions
 #define NCS_RD_PULSE_MASK   0x7F000000
 #define NCS_RD_PULSE_LSB    24
@@ -3091,73 +904,6 @@ __INLINE void smc_pulse6_set(uint32_t value)
 #define NCS_WR_PULSE_RST    0x0
 #define NWE_PULSE_RST       0x0
 
-__INLINE void smc_pulse6_pack(uint8_t ncsrdpulse, uint8_t nrdpulse, uint8_t ncswrpulse, uint8_t nwepulse)
-{
-    ASSERT_ERR(((ncsrdpulse << 24) & ~0x7F000000) == 0);
-    ASSERT_ERR(((nrdpulse << 16) & ~0x007F0000) == 0);
-    ASSERT_ERR(((ncswrpulse << 8) & ~0x00007F00) == 0);
-    ASSERT_ERR(((nwepulse << 0) & ~0x0000007F) == 0);
-    sim_reg_smc_wr(SMC_PULSE6_INDEX,  (ncsrdpulse << 24) | (nrdpulse << 16) | (ncswrpulse << 8) | (nwepulse << 0));
-}
-
-__INLINE void smc_pulse6_unpack(uint8_t* ncsrdpulse, uint8_t* nrdpulse, uint8_t* ncswrpulse, uint8_t* nwepulse)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE6_INDEX);
-
-    *ncsrdpulse = (localVal & 0x7F000000) >> 24;
-    *nrdpulse = (localVal & 0x007F0000) >> 16;
-    *ncswrpulse = (localVal & 0x00007F00) >> 8;
-    *nwepulse = (localVal & 0x0000007F) >> 0;
-}
-
-__INLINE uint8_t smc_pulse6_ncs_rd_pulse_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE6_INDEX);
-    return ((localVal & 0x7F000000) >> 24);
-}
-
-__INLINE void smc_pulse6_ncs_rd_pulse_setf(uint8_t ncsrdpulse)
-{
-    ASSERT_ERR(((ncsrdpulse << 24) & ~0x7F000000) == 0);
-    sim_reg_smc_wr(SMC_PULSE6_INDEX, (sim_reg_smc_rd(SMC_PULSE6_INDEX) & ~0x7F000000) | (ncsrdpulse << 24));
-}
-
-__INLINE uint8_t smc_pulse6_nrd_pulse_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE6_INDEX);
-    return ((localVal & 0x007F0000) >> 16);
-}
-
-__INLINE void smc_pulse6_nrd_pulse_setf(uint8_t nrdpulse)
-{
-    ASSERT_ERR(((nrdpulse << 16) & ~0x007F0000) == 0);
-    sim_reg_smc_wr(SMC_PULSE6_INDEX, (sim_reg_smc_rd(SMC_PULSE6_INDEX) & ~0x007F0000) | (nrdpulse << 16));
-}
-
-__INLINE uint8_t smc_pulse6_ncs_wr_pulse_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE6_INDEX);
-    return ((localVal & 0x00007F00) >> 8);
-}
-
-__INLINE void smc_pulse6_ncs_wr_pulse_setf(uint8_t ncswrpulse)
-{
-    ASSERT_ERR(((ncswrpulse << 8) & ~0x00007F00) == 0);
-    sim_reg_smc_wr(SMC_PULSE6_INDEX, (sim_reg_smc_rd(SMC_PULSE6_INDEX) & ~0x00007F00) | (ncswrpulse << 8));
-}
-
-__INLINE uint8_t smc_pulse6_nwe_pulse_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE6_INDEX);
-    return ((localVal & 0x0000007F) >> 0);
-}
-
-__INLINE void smc_pulse6_nwe_pulse_setf(uint8_t nwepulse)
-{
-    ASSERT_ERR(((nwepulse << 0) & ~0x0000007F) == 0);
-    sim_reg_smc_wr(SMC_PULSE6_INDEX, (sim_reg_smc_rd(SMC_PULSE6_INDEX) & ~0x0000007F) | (nwepulse << 0));
-}
-
 /**
  * @brief SMC_CYCLE6 register definition
  * <pre>
@@ -3169,16 +915,6 @@ __INLINE void smc_pulse6_nwe_pulse_setf(uint8_t nwepulse)
  */
 #define SMC_CYCLE6_INDEX  0x0000001A
 
-__INLINE uint32_t smc_cycle6_get(void)
-{
-    return sim_reg_smc_rd(SMC_CYCLE6_INDEX);
-}
-
-__INLINE void smc_cycle6_set(uint32_t value)
-{
-    sim_reg_smc_wr(SMC_CYCLE6_INDEX, value);
-}
-
 // field definitions
 #define NRD_CYCLE_MASK   0x01FF0000
 #define NRD_CYCLE_LSB    16
@@ -3190,45 +926,6 @@ __INLINE void smc_cycle6_set(uint32_t value)
 #define NRD_CYCLE_RST    0x0
 #define NWE_CYCLE_RST    0x0
 
-__INLINE void smc_cycle6_pack(uint16_t nrdcycle, uint16_t nwecycle)
-{
-    ASSERT_ERR(((nrdcycle << 16) & ~0x01FF0000) == 0);
-    ASSERT_ERR(((nwecycle << 0) & ~0x000001FF) == 0);
-    sim_reg_smc_wr(SMC_CYCLE6_INDEX,  (nrdcycle << 16) | (nwecycle << 0));
-}
-
-__INLINE void smc_cycle6_unpack(uint16_t* nrdcycle, uint16_t* nwecycle)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_CYCLE6_INDEX);
-
-    *nrdcycle = (localVal & 0x01FF0000) >> 16;
-    *nwecycle = (localVal & 0x000001FF) >> 0;
-}
-
-__INLINE uint16_t smc_cycle6_nrd_cycle_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_CYCLE6_INDEX);
-    return ((localVal & 0x01FF0000) >> 16);
-}
-
-__INLINE void smc_cycle6_nrd_cycle_setf(uint16_t nrdcycle)
-{
-    ASSERT_ERR(((nrdcycle << 16) & ~0x01FF0000) == 0);
-    sim_reg_smc_wr(SMC_CYCLE6_INDEX, (sim_reg_smc_rd(SMC_CYCLE6_INDEX) & ~0x01FF0000) | (nrdcycle << 16));
-}
-
-__INLINE uint16_t smc_cycle6_nwe_cycle_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_CYCLE6_INDEX);
-    return ((localVal & 0x000001FF) >> 0);
-}
-
-__INLINE void smc_cycle6_nwe_cycle_setf(uint16_t nwecycle)
-{
-    ASSERT_ERR(((nwecycle << 0) & ~0x000001FF) == 0);
-    sim_reg_smc_wr(SMC_CYCLE6_INDEX, (sim_reg_smc_rd(SMC_CYCLE6_INDEX) & ~0x000001FF) | (nwecycle << 0));
-}
-
 /**
  * @brief SMC_MODE6 register definition
  * <pre>
@@ -3247,16 +944,6 @@ __INLINE void smc_cycle6_nwe_cycle_setf(uint16_t nwecycle)
  */
 #define SMC_MODE6_INDEX  0x0000001B
 
-__INLINE uint32_t smc_mode6_get(void)
-{
-    return sim_reg_smc_rd(SMC_MODE6_INDEX);
-}
-
-__INLINE void smc_mode6_set(uint32_t value)
-{
-    sim_reg_smc_wr(SMC_MODE6_INDEX, value);
-}
-
 // field definitions
 #define PS_MASK           0x30000000
 #define PS_LSB            28
@@ -3291,143 +978,6 @@ __INLINE void smc_mode6_set(uint32_t value)
 #define WRITE_MODE_RST    0x0
 #define READ_MODE_RST     0x0
 
-__INLINE void smc_mode6_pack(uint8_t ps, uint8_t pmen, uint8_t tdfmode, uint8_t tdfcycles, uint8_t dbw, uint8_t bat, uint8_t exnwmode, uint8_t writemode, uint8_t readmode)
-{
-    ASSERT_ERR(((ps << 28) & ~0x30000000) == 0);
-    ASSERT_ERR(((pmen << 24) & ~0x01000000) == 0);
-    ASSERT_ERR(((tdfmode << 20) & ~0x00100000) == 0);
-    ASSERT_ERR(((tdfcycles << 16) & ~0x000F0000) == 0);
-    ASSERT_ERR(((dbw << 12) & ~0x00003000) == 0);
-    ASSERT_ERR(((bat << 8) & ~0x00000100) == 0);
-    ASSERT_ERR(((exnwmode << 4) & ~0x00000030) == 0);
-    ASSERT_ERR(((writemode << 1) & ~0x00000002) == 0);
-    ASSERT_ERR(((readmode << 0) & ~0x00000001) == 0);
-    sim_reg_smc_wr(SMC_MODE6_INDEX,  (ps << 28) | (pmen << 24) | (tdfmode << 20) | (tdfcycles << 16) | (dbw << 12) | (bat << 8) | (exnwmode << 4) | (writemode << 1) | (readmode << 0));
-}
-
-__INLINE void smc_mode6_unpack(uint8_t* ps, uint8_t* pmen, uint8_t* tdfmode, uint8_t* tdfcycles, uint8_t* dbw, uint8_t* bat, uint8_t* exnwmode, uint8_t* writemode, uint8_t* readmode)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE6_INDEX);
-
-    *ps = (localVal & 0x30000000) >> 28;
-    *pmen = (localVal & 0x01000000) >> 24;
-    *tdfmode = (localVal & 0x00100000) >> 20;
-    *tdfcycles = (localVal & 0x000F0000) >> 16;
-    *dbw = (localVal & 0x00003000) >> 12;
-    *bat = (localVal & 0x00000100) >> 8;
-    *exnwmode = (localVal & 0x00000030) >> 4;
-    *writemode = (localVal & 0x00000002) >> 1;
-    *readmode = (localVal & 0x00000001) >> 0;
-}
-
-__INLINE uint8_t smc_mode6_ps_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE6_INDEX);
-    return ((localVal & 0x30000000) >> 28);
-}
-
-__INLINE void smc_mode6_ps_setf(uint8_t ps)
-{
-    ASSERT_ERR(((ps << 28) & ~0x30000000) == 0);
-    sim_reg_smc_wr(SMC_MODE6_INDEX, (sim_reg_smc_rd(SMC_MODE6_INDEX) & ~0x30000000) | (ps << 28));
-}
-
-__INLINE uint8_t smc_mode6_pmen_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE6_INDEX);
-    return ((localVal & 0x01000000) >> 24);
-}
-
-__INLINE void smc_mode6_pmen_setf(uint8_t pmen)
-{
-    ASSERT_ERR(((pmen << 24) & ~0x01000000) == 0);
-    sim_reg_smc_wr(SMC_MODE6_INDEX, (sim_reg_smc_rd(SMC_MODE6_INDEX) & ~0x01000000) | (pmen << 24));
-}
-
-__INLINE uint8_t smc_mode6_tdf_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE6_INDEX);
-    return ((localVal & 0x00100000) >> 20);
-}
-
-__INLINE void smc_mode6_tdf_mode_setf(uint8_t tdfmode)
-{
-    ASSERT_ERR(((tdfmode << 20) & ~0x00100000) == 0);
-    sim_reg_smc_wr(SMC_MODE6_INDEX, (sim_reg_smc_rd(SMC_MODE6_INDEX) & ~0x00100000) | (tdfmode << 20));
-}
-
-__INLINE uint8_t smc_mode6_tdf_cycles_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE6_INDEX);
-    return ((localVal & 0x000F0000) >> 16);
-}
-
-__INLINE void smc_mode6_tdf_cycles_setf(uint8_t tdfcycles)
-{
-    ASSERT_ERR(((tdfcycles << 16) & ~0x000F0000) == 0);
-    sim_reg_smc_wr(SMC_MODE6_INDEX, (sim_reg_smc_rd(SMC_MODE6_INDEX) & ~0x000F0000) | (tdfcycles << 16));
-}
-
-__INLINE uint8_t smc_mode6_dbw_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE6_INDEX);
-    return ((localVal & 0x00003000) >> 12);
-}
-
-__INLINE void smc_mode6_dbw_setf(uint8_t dbw)
-{
-    ASSERT_ERR(((dbw << 12) & ~0x00003000) == 0);
-    sim_reg_smc_wr(SMC_MODE6_INDEX, (sim_reg_smc_rd(SMC_MODE6_INDEX) & ~0x00003000) | (dbw << 12));
-}
-
-__INLINE uint8_t smc_mode6_bat_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE6_INDEX);
-    return ((localVal & 0x00000100) >> 8);
-}
-
-__INLINE void smc_mode6_bat_setf(uint8_t bat)
-{
-    ASSERT_ERR(((bat << 8) & ~0x00000100) == 0);
-    sim_reg_smc_wr(SMC_MODE6_INDEX, (sim_reg_smc_rd(SMC_MODE6_INDEX) & ~0x00000100) | (bat << 8));
-}
-
-__INLINE uint8_t smc_mode6_exnw_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE6_INDEX);
-    return ((localVal & 0x00000030) >> 4);
-}
-
-__INLINE void smc_mode6_exnw_mode_setf(uint8_t exnwmode)
-{
-    ASSERT_ERR(((exnwmode << 4) & ~0x00000030) == 0);
-    sim_reg_smc_wr(SMC_MODE6_INDEX, (sim_reg_smc_rd(SMC_MODE6_INDEX) & ~0x00000030) | (exnwmode << 4));
-}
-
-__INLINE uint8_t smc_mode6_write_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE6_INDEX);
-    return ((localVal & 0x00000002) >> 1);
-}
-
-__INLINE void smc_mode6_write_mode_setf(uint8_t writemode)
-{
-    ASSERT_ERR(((writemode << 1) & ~0x00000002) == 0);
-    sim_reg_smc_wr(SMC_MODE6_INDEX, (sim_reg_smc_rd(SMC_MODE6_INDEX) & ~0x00000002) | (writemode << 1));
-}
-
-__INLINE uint8_t smc_mode6_read_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE6_INDEX);
-    return ((localVal & 0x00000001) >> 0);
-}
-
-__INLINE void smc_mode6_read_mode_setf(uint8_t readmode)
-{
-    ASSERT_ERR(((readmode << 0) & ~0x00000001) == 0);
-    sim_reg_smc_wr(SMC_MODE6_INDEX, (sim_reg_smc_rd(SMC_MODE6_INDEX) & ~0x00000001) | (readmode << 0));
-}
-
 /**
  * @brief SMC_SETUP7 register definition
  * <pre>
@@ -3441,16 +991,6 @@ __INLINE void smc_mode6_read_mode_setf(uint8_t readmode)
  */
 #define SMC_SETUP7_INDEX  0x0000001C
 
-__INLINE uint32_t smc_setup7_get(void)
-{
-    return sim_reg_smc_rd(SMC_SETUP7_INDEX);
-}
-
-__INLINE void smc_setup7_set(uint32_t value)
-{
-    sim_reg_smc_wr(SMC_SETUP7_INDEX, value);
-}
-
 // field definitions
 #define NCS_RD_SETUP_MASK   0x3F000000
 #define NCS_RD_SETUP_LSB    24
@@ -3470,73 +1010,6 @@ __INLINE void smc_setup7_set(uint32_t value)
 #define NCS_WR_SETUP_RST    0x0
 #define NWE_SETUP_RST       0x0
 
-__INLINE void smc_setup7_pack(uint8_t ncsrdsetup, uint8_t nrdsetup, uint8_t ncswrsetup, uint8_t nwesetup)
-{
-    ASSERT_ERR(((ncsrdsetup << 24) & ~0x3F000000) == 0);
-    ASSERT_ERR(((nrdsetup << 16) & ~0x003F0000) == 0);
-    ASSERT_ERR(((ncswrsetup << 8) & ~0x00003F00) == 0);
-    ASSERT_ERR(((nwesetup << 0) & ~0x0000003F) == 0);
-    sim_reg_smc_wr(SMC_SETUP7_INDEX,  (ncsrdsetup << 24) | (nrdsetup << 16) | (ncswrsetup << 8) | (nwesetup << 0));
-}
-
-__INLINE void smc_setup7_unpack(uint8_t* ncsrdsetup, uint8_t* nrdsetup, uint8_t* ncswrsetup, uint8_t* nwesetup)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP7_INDEX);
-
-    *ncsrdsetup = (localVal & 0x3F000000) >> 24;
-    *nrdsetup = (localVal & 0x003F0000) >> 16;
-    *ncswrsetup = (localVal & 0x00003F00) >> 8;
-    *nwesetup = (localVal & 0x0000003F) >> 0;
-}
-
-__INLINE uint8_t smc_setup7_ncs_rd_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP7_INDEX);
-    return ((localVal & 0x3F000000) >> 24);
-}
-
-__INLINE void smc_setup7_ncs_rd_setup_setf(uint8_t ncsrdsetup)
-{
-    ASSERT_ERR(((ncsrdsetup << 24) & ~0x3F000000) == 0);
-    sim_reg_smc_wr(SMC_SETUP7_INDEX, (sim_reg_smc_rd(SMC_SETUP7_INDEX) & ~0x3F000000) | (ncsrdsetup << 24));
-}
-
-__INLINE uint8_t smc_setup7_nrd_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP7_INDEX);
-    return ((localVal & 0x003F0000) >> 16);
-}
-
-__INLINE void smc_setup7_nrd_setup_setf(uint8_t nrdsetup)
-{
-    ASSERT_ERR(((nrdsetup << 16) & ~0x003F0000) == 0);
-    sim_reg_smc_wr(SMC_SETUP7_INDEX, (sim_reg_smc_rd(SMC_SETUP7_INDEX) & ~0x003F0000) | (nrdsetup << 16));
-}
-
-__INLINE uint8_t smc_setup7_ncs_wr_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP7_INDEX);
-    return ((localVal & 0x00003F00) >> 8);
-}
-
-__INLINE void smc_setup7_ncs_wr_setup_setf(uint8_t ncswrsetup)
-{
-    ASSERT_ERR(((ncswrsetup << 8) & ~0x00003F00) == 0);
-    sim_reg_smc_wr(SMC_SETUP7_INDEX, (sim_reg_smc_rd(SMC_SETUP7_INDEX) & ~0x00003F00) | (ncswrsetup << 8));
-}
-
-__INLINE uint8_t smc_setup7_nwe_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_SETUP7_INDEX);
-    return ((localVal & 0x0000003F) >> 0);
-}
-
-__INLINE void smc_setup7_nwe_setup_setf(uint8_t nwesetup)
-{
-    ASSERT_ERR(((nwesetup << 0) & ~0x0000003F) == 0);
-    sim_reg_smc_wr(SMC_SETUP7_INDEX, (sim_reg_smc_rd(SMC_SETUP7_INDEX) & ~0x0000003F) | (nwesetup << 0));
-}
-
 /**
  * @brief SMC_PULSE7 register definition
  * <pre>
@@ -3550,16 +1023,6 @@ __INLINE void smc_setup7_nwe_setup_setf(uint8_t nwesetup)
  */
 #define SMC_PULSE7_INDEX  0x0000001D
 
-__INLINE uint32_t smc_pulse7_get(void)
-{
-    return sim_reg_smc_rd(SMC_PULSE7_INDEX);
-}
-
-__INLINE void smc_pulse7_set(uint32_t value)
-{
-    sim_reg_smc_wr(SMC_PULSE7_INDEX, value);
-}
-
 // field definitions
 #define NCS_RD_PULSE_MASK   0x7F000000
 #define NCS_RD_PULSE_LSB    24
@@ -3579,73 +1042,6 @@ __INLINE void smc_pulse7_set(uint32_t value)
 #define NCS_WR_PULSE_RST    0x0
 #define NWE_PULSE_RST       0x0
 
-__INLINE void smc_pulse7_pack(uint8_t ncsrdpulse, uint8_t nrdpulse, uint8_t ncswrpulse, uint8_t nwepulse)
-{
-    ASSERT_ERR(((ncsrdpulse << 24) & ~0x7F000000) == 0);
-    ASSERT_ERR(((nrdpulse << 16) & ~0x007F0000) == 0);
-    ASSERT_ERR(((ncswrpulse << 8) & ~0x00007F00) == 0);
-    ASSERT_ERR(((nwepulse << 0) & ~0x0000007F) == 0);
-    sim_reg_smc_wr(SMC_PULSE7_INDEX,  (ncsrdpulse << 24) | (nrdpulse << 16) | (ncswrpulse << 8) | (nwepulse << 0));
-}
-
-__INLINE void smc_pulse7_unpack(uint8_t* ncsrdpulse, uint8_t* nrdpulse, uint8_t* ncswrpulse, uint8_t* nwepulse)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE7_INDEX);
-
-    *ncsrdpulse = (localVal & 0x7F000000) >> 24;
-    *nrdpulse = (localVal & 0x007F0000) >> 16;
-    *ncswrpulse = (localVal & 0x00007F00) >> 8;
-    *nwepulse = (localVal & 0x0000007F) >> 0;
-}
-
-__INLINE uint8_t smc_pulse7_ncs_rd_pulse_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE7_INDEX);
-    return ((localVal & 0x7F000000) >> 24);
-}
-
-__INLINE void smc_pulse7_ncs_rd_pulse_setf(uint8_t ncsrdpulse)
-{
-    ASSERT_ERR(((ncsrdpulse << 24) & ~0x7F000000) == 0);
-    sim_reg_smc_wr(SMC_PULSE7_INDEX, (sim_reg_smc_rd(SMC_PULSE7_INDEX) & ~0x7F000000) | (ncsrdpulse << 24));
-}
-
-__INLINE uint8_t smc_pulse7_nrd_pulse_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE7_INDEX);
-    return ((localVal & 0x007F0000) >> 16);
-}
-
-__INLINE void smc_pulse7_nrd_pulse_setf(uint8_t nrdpulse)
-{
-    ASSERT_ERR(((nrdpulse << 16) & ~0x007F0000) == 0);
-    sim_reg_smc_wr(SMC_PULSE7_INDEX, (sim_reg_smc_rd(SMC_PULSE7_INDEX) & ~0x007F0000) | (nrdpulse << 16));
-}
-
-__INLINE uint8_t smc_pulse7_ncs_wr_pulse_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE7_INDEX);
-    return ((localVal & 0x00007F00) >> 8);
-}
-
-__INLINE void smc_pulse7_ncs_wr_pulse_setf(uint8_t ncswrpulse)
-{
-    ASSERT_ERR(((ncswrpulse << 8) & ~0x00007F00) == 0);
-    sim_reg_smc_wr(SMC_PULSE7_INDEX, (sim_reg_smc_rd(SMC_PULSE7_INDEX) & ~0x00007F00) | (ncswrpulse << 8));
-}
-
-__INLINE uint8_t smc_pulse7_nwe_pulse_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_PULSE7_INDEX);
-    return ((localVal & 0x0000007F) >> 0);
-}
-
-__INLINE void smc_pulse7_nwe_pulse_setf(uint8_t nwepulse)
-{
-    ASSERT_ERR(((nwepulse << 0) & ~0x0000007F) == 0);
-    sim_reg_smc_wr(SMC_PULSE7_INDEX, (sim_reg_smc_rd(SMC_PULSE7_INDEX) & ~0x0000007F) | (nwepulse << 0));
-}
-
 /**
  * @brief SMC_CYCLE7 register definition
  * <pre>
@@ -3657,16 +1053,6 @@ __INLINE void smc_pulse7_nwe_pulse_setf(uint8_t nwepulse)
  */
 #define SMC_CYCLE7_INDEX  0x0000001E
 
-__INLINE uint32_t smc_cycle7_get(void)
-{
-    return sim_reg_smc_rd(SMC_CYCLE7_INDEX);
-}
-
-__INLINE void smc_cycle7_set(uint32_t value)
-{
-    sim_reg_smc_wr(SMC_CYCLE7_INDEX, value);
-}
-
 // field definitions
 #define NRD_CYCLE_MASK   0x01FF0000
 #define NRD_CYCLE_LSB    16
@@ -3678,45 +1064,6 @@ __INLINE void smc_cycle7_set(uint32_t value)
 #define NRD_CYCLE_RST    0x0
 #define NWE_CYCLE_RST    0x0
 
-__INLINE void smc_cycle7_pack(uint16_t nrdcycle, uint16_t nwecycle)
-{
-    ASSERT_ERR(((nrdcycle << 16) & ~0x01FF0000) == 0);
-    ASSERT_ERR(((nwecycle << 0) & ~0x000001FF) == 0);
-    sim_reg_smc_wr(SMC_CYCLE7_INDEX,  (nrdcycle << 16) | (nwecycle << 0));
-}
-
-__INLINE void smc_cycle7_unpack(uint16_t* nrdcycle, uint16_t* nwecycle)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_CYCLE7_INDEX);
-
-    *nrdcycle = (localVal & 0x01FF0000) >> 16;
-    *nwecycle = (localVal & 0x000001FF) >> 0;
-}
-
-__INLINE uint16_t smc_cycle7_nrd_cycle_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_CYCLE7_INDEX);
-    return ((localVal & 0x01FF0000) >> 16);
-}
-
-__INLINE void smc_cycle7_nrd_cycle_setf(uint16_t nrdcycle)
-{
-    ASSERT_ERR(((nrdcycle << 16) & ~0x01FF0000) == 0);
-    sim_reg_smc_wr(SMC_CYCLE7_INDEX, (sim_reg_smc_rd(SMC_CYCLE7_INDEX) & ~0x01FF0000) | (nrdcycle << 16));
-}
-
-__INLINE uint16_t smc_cycle7_nwe_cycle_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_CYCLE7_INDEX);
-    return ((localVal & 0x000001FF) >> 0);
-}
-
-__INLINE void smc_cycle7_nwe_cycle_setf(uint16_t nwecycle)
-{
-    ASSERT_ERR(((nwecycle << 0) & ~0x000001FF) == 0);
-    sim_reg_smc_wr(SMC_CYCLE7_INDEX, (sim_reg_smc_rd(SMC_CYCLE7_INDEX) & ~0x000001FF) | (nwecycle << 0));
-}
-
 /**
  * @brief SMC_MODE7 register definition
  * <pre>
@@ -3735,16 +1082,6 @@ __INLINE void smc_cycle7_nwe_cycle_setf(uint16_t nwecycle)
  */
 #define SMC_MODE7_INDEX  0x0000001F
 
-__INLINE uint32_t smc_mode7_get(void)
-{
-    return sim_reg_smc_rd(SMC_MODE7_INDEX);
-}
-
-__INLINE void smc_mode7_set(uint32_t value)
-{
-    sim_reg_smc_wr(SMC_MODE7_INDEX, value);
-}
-
 // field definitions
 #define PS_MASK           0x30000000
 #define PS_LSB            28
@@ -3779,143 +1116,3714 @@ __INLINE void smc_mode7_set(uint32_t value)
 #define WRITE_MODE_RST    0x0
 #define READ_MODE_RST     0x0
 
-__INLINE void smc_mode7_pack(uint8_t ps, uint8_t pmen, uint8_t tdfmode, uint8_t tdfcycles, uint8_t dbw, uint8_t bat, uint8_t exnwmode, uint8_t writemode, uint8_t readmode)
-{
-    ASSERT_ERR(((ps << 28) & ~0x30000000) == 0);
-    ASSERT_ERR(((pmen << 24) & ~0x01000000) == 0);
-    ASSERT_ERR(((tdfmode << 20) & ~0x00100000) == 0);
-    ASSERT_ERR(((tdfcycles << 16) & ~0x000F0000) == 0);
-    ASSERT_ERR(((dbw << 12) & ~0x00003000) == 0);
-    ASSERT_ERR(((bat << 8) & ~0x00000100) == 0);
-    ASSERT_ERR(((exnwmode << 4) & ~0x00000030) == 0);
-    ASSERT_ERR(((writemode << 1) & ~0x00000002) == 0);
-    ASSERT_ERR(((readmode << 0) & ~0x00000001) == 0);
-    sim_reg_smc_wr(SMC_MODE7_INDEX,  (ps << 28) | (pmen << 24) | (tdfmode << 20) | (tdfcycles << 16) | (dbw << 12) | (bat << 8) | (exnwmode << 4) | (writemode << 1) | (readmode << 0));
-}
-
-__INLINE void smc_mode7_unpack(uint8_t* ps, uint8_t* pmen, uint8_t* tdfmode, uint8_t* tdfcycles, uint8_t* dbw, uint8_t* bat, uint8_t* exnwmode, uint8_t* writemode, uint8_t* readmode)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE7_INDEX);
-
-    *ps = (localVal & 0x30000000) >> 28;
-    *pmen = (localVal & 0x01000000) >> 24;
-    *tdfmode = (localVal & 0x00100000) >> 20;
-    *tdfcycles = (localVal & 0x000F0000) >> 16;
-    *dbw = (localVal & 0x00003000) >> 12;
-    *bat = (localVal & 0x00000100) >> 8;
-    *exnwmode = (localVal & 0x00000030) >> 4;
-    *writemode = (localVal & 0x00000002) >> 1;
-    *readmode = (localVal & 0x00000001) >> 0;
-}
-
-__INLINE uint8_t smc_mode7_ps_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE7_INDEX);
-    return ((localVal & 0x30000000) >> 28);
-}
-
-__INLINE void smc_mode7_ps_setf(uint8_t ps)
-{
-    ASSERT_ERR(((ps << 28) & ~0x30000000) == 0);
-    sim_reg_smc_wr(SMC_MODE7_INDEX, (sim_reg_smc_rd(SMC_MODE7_INDEX) & ~0x30000000) | (ps << 28));
-}
-
-__INLINE uint8_t smc_mode7_pmen_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE7_INDEX);
-    return ((localVal & 0x01000000) >> 24);
-}
-
-__INLINE void smc_mode7_pmen_setf(uint8_t pmen)
-{
-    ASSERT_ERR(((pmen << 24) & ~0x01000000) == 0);
-    sim_reg_smc_wr(SMC_MODE7_INDEX, (sim_reg_smc_rd(SMC_MODE7_INDEX) & ~0x01000000) | (pmen << 24));
-}
-
-__INLINE uint8_t smc_mode7_tdf_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE7_INDEX);
-    return ((localVal & 0x00100000) >> 20);
-}
-
-__INLINE void smc_mode7_tdf_mode_setf(uint8_t tdfmode)
-{
-    ASSERT_ERR(((tdfmode << 20) & ~0x00100000) == 0);
-    sim_reg_smc_wr(SMC_MODE7_INDEX, (sim_reg_smc_rd(SMC_MODE7_INDEX) & ~0x00100000) | (tdfmode << 20));
-}
-
-__INLINE uint8_t smc_mode7_tdf_cycles_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE7_INDEX);
-    return ((localVal & 0x000F0000) >> 16);
-}
-
-__INLINE void smc_mode7_tdf_cycles_setf(uint8_t tdfcycles)
-{
-    ASSERT_ERR(((tdfcycles << 16) & ~0x000F0000) == 0);
-    sim_reg_smc_wr(SMC_MODE7_INDEX, (sim_reg_smc_rd(SMC_MODE7_INDEX) & ~0x000F0000) | (tdfcycles << 16));
-}
-
-__INLINE uint8_t smc_mode7_dbw_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE7_INDEX);
-    return ((localVal & 0x00003000) >> 12);
-}
-
-__INLINE void smc_mode7_dbw_setf(uint8_t dbw)
-{
-    ASSERT_ERR(((dbw << 12) & ~0x00003000) == 0);
-    sim_reg_smc_wr(SMC_MODE7_INDEX, (sim_reg_smc_rd(SMC_MODE7_INDEX) & ~0x00003000) | (dbw << 12));
-}
-
-__INLINE uint8_t smc_mode7_bat_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE7_INDEX);
-    return ((localVal & 0x00000100) >> 8);
-}
-
-__INLINE void smc_mode7_bat_setf(uint8_t bat)
-{
-    ASSERT_ERR(((bat << 8) & ~0x00000100) == 0);
-    sim_reg_smc_wr(SMC_MODE7_INDEX, (sim_reg_smc_rd(SMC_MODE7_INDEX) & ~0x00000100) | (bat << 8));
-}
-
-__INLINE uint8_t smc_mode7_exnw_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE7_INDEX);
-    return ((localVal & 0x00000030) >> 4);
-}
-
-__INLINE void smc_mode7_exnw_mode_setf(uint8_t exnwmode)
-{
-    ASSERT_ERR(((exnwmode << 4) & ~0x00000030) == 0);
-    sim_reg_smc_wr(SMC_MODE7_INDEX, (sim_reg_smc_rd(SMC_MODE7_INDEX) & ~0x00000030) | (exnwmode << 4));
-}
-
-__INLINE uint8_t smc_mode7_write_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE7_INDEX);
-    return ((localVal & 0x00000002) >> 1);
-}
-
-__INLINE void smc_mode7_write_mode_setf(uint8_t writemode)
-{
-    ASSERT_ERR(((writemode << 1) & ~0x00000002) == 0);
-    sim_reg_smc_wr(SMC_MODE7_INDEX, (sim_reg_smc_rd(SMC_MODE7_INDEX) & ~0x00000002) | (writemode << 1));
-}
-
-__INLINE uint8_t smc_mode7_read_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_smc_rd(SMC_MODE7_INDEX);
-    return ((localVal & 0x00000001) >> 0);
-}
-
-__INLINE void smc_mode7_read_mode_setf(uint8_t readmode)
-{
-    ASSERT_ERR(((readmode << 0) & ~0x00000001) == 0);
-    sim_reg_smc_wr(SMC_MODE7_INDEX, (sim_reg_smc_rd(SMC_MODE7_INDEX) & ~0x00000001) | (readmode << 0));
-}
-
+/**
+ * @brief Register map of the REG_SMC block, to be derived by the block model
+ *
+ * The register accesses are dispatched at compile time to the register hooks
+ * {regname}_rd() and {regname}_wr(value) of the model, which only redefines the
+ * hooks of the registers having side effects.
+ * @param MODEL Block model deriving from this class
+ */
+template <typename MODEL>
+struct RegSmc : Peripheral<REG_SMC_COUNT>
+{
+    /** Constructor
+     * @param[in] name Name of the module
+     */
+    RegSmc(sc_core::sc_module_name name)
+    : Peripheral<REG_SMC_COUNT>(name)
+    {
+        this->set_reg_names(&reg_name);
+    }
+
+    /** Name of a register
+     * @param[in] index Index of the register
+     * @return The name of the register, NULL if there is no register at this index
+     */
+    static const char*
+    reg_name(uint32_t index)
+    {
+        static const char* const names[REG_SMC_COUNT] =
+        {
+            "SMC_SETUP0",
+            "SMC_PULSE0",
+            "SMC_CYCLE0",
+            "SMC_MODE0",
+            "SMC_SETUP1",
+            "SMC_PULSE1",
+            "SMC_CYCLE1",
+            "SMC_MODE1",
+            "SMC_SETUP2",
+            "SMC_PULSE2",
+            "SMC_CYCLE2",
+            "SMC_MODE2",
+            "SMC_SETUP3",
+            "SMC_PULSE3",
+            "SMC_CYCLE3",
+            "SMC_MODE3",
+            "SMC_SETUP4",
+            "SMC_PULSE4",
+            "SMC_CYCLE4",
+            "SMC_MODE4",
+            "SMC_SETUP5",
+            "SMC_PULSE5",
+            "SMC_CYCLE5",
+            "SMC_MODE5",
+            "SMC_SETUP6",
+            "SMC_PULSE6",
+            "SMC_CYCLE6",
+            "SMC_MODE6",
+            "SMC_SETUP7",
+            "SMC_PULSE7",
+            "SMC_CYCLE7",
+            "SMC_MODE7",
+            NULL,
+        };
+
+        return (index < REG_SMC_COUNT) ? names[index] : NULL;
+    }
+
+    uint32_t smc_setup0_get(void)
+    {
+        return this->m_reg[SMC_SETUP0_INDEX];
+    }
+
+    void smc_setup0_set(uint32_t value)
+    {
+        this->m_reg[SMC_SETUP0_INDEX] = value;
+    }
+
+    typedef RegField<SMC_SETUP0_INDEX, 0x3F000000, 24> smc_setup0_ncs_rd_setup_field;
+    typedef RegField<SMC_SETUP0_INDEX, 0x003F0000, 16> smc_setup0_nrd_setup_field;
+    typedef RegField<SMC_SETUP0_INDEX, 0x00003F00, 8> smc_setup0_ncs_wr_setup_field;
+    typedef RegField<SMC_SETUP0_INDEX, 0x0000003F, 0> smc_setup0_nwe_setup_field;
+
+    void smc_setup0_pack(uint8_t ncsrdsetup, uint8_t nrdsetup, uint8_t ncswrsetup, uint8_t nwesetup)
+    {
+        ASSERT_ERR(((ncsrdsetup << 24) & ~0x3F000000) == 0);
+        ASSERT_ERR(((nrdsetup << 16) & ~0x003F0000) == 0);
+        ASSERT_ERR(((ncswrsetup << 8) & ~0x00003F00) == 0);
+        ASSERT_ERR(((nwesetup << 0) & ~0x0000003F) == 0);
+        this->m_reg[SMC_SETUP0_INDEX] =  (ncsrdsetup << 24) | (nrdsetup << 16) | (ncswrsetup << 8) | (nwesetup << 0);
+    }
+
+    void smc_setup0_unpack(uint8_t* ncsrdsetup, uint8_t* nrdsetup, uint8_t* ncswrsetup, uint8_t* nwesetup)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP0_INDEX];
+
+        *ncsrdsetup = (localVal & 0x3F000000) >> 24;
+        *nrdsetup = (localVal & 0x003F0000) >> 16;
+        *ncswrsetup = (localVal & 0x00003F00) >> 8;
+        *nwesetup = (localVal & 0x0000003F) >> 0;
+    }
+
+    uint8_t smc_setup0_ncs_rd_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP0_INDEX];
+        return ((localVal & 0x3F000000) >> 24);
+    }
+
+    void smc_setup0_ncs_rd_setup_setf(uint8_t ncsrdsetup)
+    {
+        ASSERT_ERR(((ncsrdsetup << 24) & ~0x3F000000) == 0);
+        this->m_reg[SMC_SETUP0_INDEX] = (this->m_reg[SMC_SETUP0_INDEX] & ~0x3F000000) | (ncsrdsetup << 24);
+    }
+
+    uint8_t smc_setup0_nrd_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP0_INDEX];
+        return ((localVal & 0x003F0000) >> 16);
+    }
+
+    void smc_setup0_nrd_setup_setf(uint8_t nrdsetup)
+    {
+        ASSERT_ERR(((nrdsetup << 16) & ~0x003F0000) == 0);
+        this->m_reg[SMC_SETUP0_INDEX] = (this->m_reg[SMC_SETUP0_INDEX] & ~0x003F0000) | (nrdsetup << 16);
+    }
+
+    uint8_t smc_setup0_ncs_wr_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP0_INDEX];
+        return ((localVal & 0x00003F00) >> 8);
+    }
+
+    void smc_setup0_ncs_wr_setup_setf(uint8_t ncswrsetup)
+    {
+        ASSERT_ERR(((ncswrsetup << 8) & ~0x00003F00) == 0);
+        this->m_reg[SMC_SETUP0_INDEX] = (this->m_reg[SMC_SETUP0_INDEX] & ~0x00003F00) | (ncswrsetup << 8);
+    }
+
+    uint8_t smc_setup0_nwe_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP0_INDEX];
+        return ((localVal & 0x0000003F) >> 0);
+    }
+
+    void smc_setup0_nwe_setup_setf(uint8_t nwesetup)
+    {
+        ASSERT_ERR(((nwesetup << 0) & ~0x0000003F) == 0);
+        this->m_reg[SMC_SETUP0_INDEX] = (this->m_reg[SMC_SETUP0_INDEX] & ~0x0000003F) | (nwesetup << 0);
+    }
+
+    uint32_t smc_pulse0_get(void)
+    {
+        return this->m_reg[SMC_PULSE0_INDEX];
+    }
+
+    void smc_pulse0_set(uint32_t value)
+    {
+        this->m_reg[SMC_PULSE0_INDEX] = value;
+    }
+
+    typedef RegField<SMC_PULSE0_INDEX, 0x7F000000, 24> smc_pulse0_ncs_rd_pulse_field;
+    typedef RegField<SMC_PULSE0_INDEX, 0x007F0000, 16> smc_pulse0_nrd_pulse_field;
+    typedef RegField<SMC_PULSE0_INDEX, 0x00007F00, 8> smc_pulse0_ncs_wr_pulse_field;
+    typedef RegField<SMC_PULSE0_INDEX, 0x0000007F, 0> smc_pulse0_nwe_pulse_field;
+
+    void smc_pulse0_pack(uint8_t ncsrdpulse, uint8_t nrdpulse, uint8_t ncswrpulse, uint8_t nwepulse)
+    {
+        ASSERT_ERR(((ncsrdpulse << 24) & ~0x7F000000) == 0);
+        ASSERT_ERR(((nrdpulse << 16) & ~0x007F0000) == 0);
+        ASSERT_ERR(((ncswrpulse << 8) & ~0x00007F00) == 0);
+        ASSERT_ERR(((nwepulse << 0) & ~0x0000007F) == 0);
+        this->m_reg[SMC_PULSE0_INDEX] =  (ncsrdpulse << 24) | (nrdpulse << 16) | (ncswrpulse << 8) | (nwepulse << 0);
+    }
+
+    void smc_pulse0_unpack(uint8_t* ncsrdpulse, uint8_t* nrdpulse, uint8_t* ncswrpulse, uint8_t* nwepulse)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE0_INDEX];
+
+        *ncsrdpulse = (localVal & 0x7F000000) >> 24;
+        *nrdpulse = (localVal & 0x007F0000) >> 16;
+        *ncswrpulse = (localVal & 0x00007F00) >> 8;
+        *nwepulse = (localVal & 0x0000007F) >> 0;
+    }
+
+    uint8_t smc_pulse0_ncs_rd_pulse_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE0_INDEX];
+        return ((localVal & 0x7F000000) >> 24);
+    }
+
+    void smc_pulse0_ncs_rd_pulse_setf(uint8_t ncsrdpulse)
+    {
+        ASSERT_ERR(((ncsrdpulse << 24) & ~0x7F000000) == 0);
+        this->m_reg[SMC_PULSE0_INDEX] = (this->m_reg[SMC_PULSE0_INDEX] & ~0x7F000000) | (ncsrdpulse << 24);
+    }
+
+    uint8_t smc_pulse0_nrd_pulse_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE0_INDEX];
+        return ((localVal & 0x007F0000) >> 16);
+    }
+
+    void smc_pulse0_nrd_pulse_setf(uint8_t nrdpulse)
+    {
+        ASSERT_ERR(((nrdpulse << 16) & ~0x007F0000) == 0);
+        this->m_reg[SMC_PULSE0_INDEX] = (this->m_reg[SMC_PULSE0_INDEX] & ~0x007F0000) | (nrdpulse << 16);
+    }
+
+    uint8_t smc_pulse0_ncs_wr_pulse_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE0_INDEX];
+        return ((localVal & 0x00007F00) >> 8);
+    }
+
+    void smc_pulse0_ncs_wr_pulse_setf(uint8_t ncswrpulse)
+    {
+        ASSERT_ERR(((ncswrpulse << 8) & ~0x00007F00) == 0);
+        this->m_reg[SMC_PULSE0_INDEX] = (this->m_reg[SMC_PULSE0_INDEX] & ~0x00007F00) | (ncswrpulse << 8);
+    }
+
+    uint8_t smc_pulse0_nwe_pulse_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE0_INDEX];
+        return ((localVal & 0x0000007F) >> 0);
+    }
+
+    void smc_pulse0_nwe_pulse_setf(uint8_t nwepulse)
+    {
+        ASSERT_ERR(((nwepulse << 0) & ~0x0000007F) == 0);
+        this->m_reg[SMC_PULSE0_INDEX] = (this->m_reg[SMC_PULSE0_INDEX] & ~0x0000007F) | (nwepulse << 0);
+    }
+
+    uint32_t smc_cycle0_get(void)
+    {
+        return this->m_reg[SMC_CYCLE0_INDEX];
+    }
+
+    void smc_cycle0_set(uint32_t value)
+    {
+        this->m_reg[SMC_CYCLE0_INDEX] = value;
+    }
+
+    typedef RegField<SMC_CYCLE0_INDEX, 0x01FF0000, 16> smc_cycle0_nrd_cycle_field;
+    typedef RegField<SMC_CYCLE0_INDEX, 0x000001FF, 0> smc_cycle0_nwe_cycle_field;
+
+    void smc_cycle0_pack(uint16_t nrdcycle, uint16_t nwecycle)
+    {
+        ASSERT_ERR(((nrdcycle << 16) & ~0x01FF0000) == 0);
+        ASSERT_ERR(((nwecycle << 0) & ~0x000001FF) == 0);
+        this->m_reg[SMC_CYCLE0_INDEX] =  (nrdcycle << 16) | (nwecycle << 0);
+    }
+
+    void smc_cycle0_unpack(uint16_t* nrdcycle, uint16_t* nwecycle)
+    {
+        uint32_t localVal = this->m_reg[SMC_CYCLE0_INDEX];
+
+        *nrdcycle = (localVal & 0x01FF0000) >> 16;
+        *nwecycle = (localVal & 0x000001FF) >> 0;
+    }
+
+    uint16_t smc_cycle0_nrd_cycle_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_CYCLE0_INDEX];
+        return ((localVal & 0x01FF0000) >> 16);
+    }
+
+    void smc_cycle0_nrd_cycle_setf(uint16_t nrdcycle)
+    {
+        ASSERT_ERR(((nrdcycle << 16) & ~0x01FF0000) == 0);
+        this->m_reg[SMC_CYCLE0_INDEX] = (this->m_reg[SMC_CYCLE0_INDEX] & ~0x01FF0000) | (nrdcycle << 16);
+    }
+
+    uint16_t smc_cycle0_nwe_cycle_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_CYCLE0_INDEX];
+        return ((localVal & 0x000001FF) >> 0);
+    }
+
+    void smc_cycle0_nwe_cycle_setf(uint16_t nwecycle)
+    {
+        ASSERT_ERR(((nwecycle << 0) & ~0x000001FF) == 0);
+        this->m_reg[SMC_CYCLE0_INDEX] = (this->m_reg[SMC_CYCLE0_INDEX] & ~0x000001FF) | (nwecycle << 0);
+    }
+
+    uint32_t smc_mode0_get(void)
+    {
+        return this->m_reg[SMC_MODE0_INDEX];
+    }
+
+    void smc_mode0_set(uint32_t value)
+    {
+        this->m_reg[SMC_MODE0_INDEX] = value;
+    }
+
+    typedef RegField<SMC_MODE0_INDEX, 0x30000000, 28> smc_mode0_ps_field;
+    typedef RegField<SMC_MODE0_INDEX, 0x01000000, 24> smc_mode0_pmen_field;
+    typedef RegField<SMC_MODE0_INDEX, 0x00100000, 20> smc_mode0_tdf_mode_field;
+    typedef RegField<SMC_MODE0_INDEX, 0x000F0000, 16> smc_mode0_tdf_cycles_field;
+    typedef RegField<SMC_MODE0_INDEX, 0x00003000, 12> smc_mode0_dbw_field;
+    typedef RegField<SMC_MODE0_INDEX, 0x00000100, 8> smc_mode0_bat_field;
+    typedef RegField<SMC_MODE0_INDEX, 0x00000030, 4> smc_mode0_exnw_mode_field;
+    typedef RegField<SMC_MODE0_INDEX, 0x00000002, 1> smc_mode0_write_mode_field;
+    typedef RegField<SMC_MODE0_INDEX, 0x00000001, 0> smc_mode0_read_mode_field;
+
+    void smc_mode0_pack(uint8_t ps, uint8_t pmen, uint8_t tdfmode, uint8_t tdfcycles, uint8_t dbw, uint8_t bat, uint8_t exnwmode, uint8_t writemode, uint8_t readmode)
+    {
+        ASSERT_ERR(((ps << 28) & ~0x30000000) == 0);
+        ASSERT_ERR(((pmen << 24) & ~0x01000000) == 0);
+        ASSERT_ERR(((tdfmode << 20) & ~0x00100000) == 0);
+        ASSERT_ERR(((tdfcycles << 16) & ~0x000F0000) == 0);
+        ASSERT_ERR(((dbw << 12) & ~0x00003000) == 0);
+        ASSERT_ERR(((bat << 8) & ~0x00000100) == 0);
+        ASSERT_ERR(((exnwmode << 4) & ~0x00000030) == 0);
+        ASSERT_ERR(((writemode << 1) & ~0x00000002) == 0);
+        ASSERT_ERR(((readmode << 0) & ~0x00000001) == 0);
+        this->m_reg[SMC_MODE0_INDEX] =  (ps << 28) | (pmen << 24) | (tdfmode << 20) | (tdfcycles << 16) | (dbw << 12) | (bat << 8) | (exnwmode << 4) | (writemode << 1) | (readmode << 0);
+    }
+
+    void smc_mode0_unpack(uint8_t* ps, uint8_t* pmen, uint8_t* tdfmode, uint8_t* tdfcycles, uint8_t* dbw, uint8_t* bat, uint8_t* exnwmode, uint8_t* writemode, uint8_t* readmode)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE0_INDEX];
+
+        *ps = (localVal & 0x30000000) >> 28;
+        *pmen = (localVal & 0x01000000) >> 24;
+        *tdfmode = (localVal & 0x00100000) >> 20;
+        *tdfcycles = (localVal & 0x000F0000) >> 16;
+        *dbw = (localVal & 0x00003000) >> 12;
+        *bat = (localVal & 0x00000100) >> 8;
+        *exnwmode = (localVal & 0x00000030) >> 4;
+        *writemode = (localVal & 0x00000002) >> 1;
+        *readmode = (localVal & 0x00000001) >> 0;
+    }
+
+    uint8_t smc_mode0_ps_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE0_INDEX];
+        return ((localVal & 0x30000000) >> 28);
+    }
+
+    void smc_mode0_ps_setf(uint8_t ps)
+    {
+        ASSERT_ERR(((ps << 28) & ~0x30000000) == 0);
+        this->m_reg[SMC_MODE0_INDEX] = (this->m_reg[SMC_MODE0_INDEX] & ~0x30000000) | (ps << 28);
+    }
+
+    uint8_t smc_mode0_pmen_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE0_INDEX];
+        return ((localVal & 0x01000000) >> 24);
+    }
+
+    void smc_mode0_pmen_setf(uint8_t pmen)
+    {
+        ASSERT_ERR(((pmen << 24) & ~0x01000000) == 0);
+        this->m_reg[SMC_MODE0_INDEX] = (this->m_reg[SMC_MODE0_INDEX] & ~0x01000000) | (pmen << 24);
+    }
+
+    uint8_t smc_mode0_tdf_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE0_INDEX];
+        return ((localVal & 0x00100000) >> 20);
+    }
+
+    void smc_mode0_tdf_mode_setf(uint8_t tdfmode)
+    {
+        ASSERT_ERR(((tdfmode << 20) & ~0x00100000) == 0);
+        this->m_reg[SMC_MODE0_INDEX] = (this->m_reg[SMC_MODE0_INDEX] & ~0x00100000) | (tdfmode << 20);
+    }
+
+    uint8_t smc_mode0_tdf_cycles_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE0_INDEX];
+        return ((localVal & 0x000F0000) >> 16);
+    }
+
+    void smc_mode0_tdf_cycles_setf(uint8_t tdfcycles)
+    {
+        ASSERT_ERR(((tdfcycles << 16) & ~0x000F0000) == 0);
+        this->m_reg[SMC_MODE0_INDEX] = (this->m_reg[SMC_MODE0_INDEX] & ~0x000F0000) | (tdfcycles << 16);
+    }
+
+    uint8_t smc_mode0_dbw_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE0_INDEX];
+        return ((localVal & 0x00003000) >> 12);
+    }
+
+    void smc_mode0_dbw_setf(uint8_t dbw)
+    {
+        ASSERT_ERR(((dbw << 12) & ~0x00003000) == 0);
+        this->m_reg[SMC_MODE0_INDEX] = (this->m_reg[SMC_MODE0_INDEX] & ~0x00003000) | (dbw << 12);
+    }
+
+    uint8_t smc_mode0_bat_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE0_INDEX];
+        return ((localVal & 0x00000100) >> 8);
+    }
+
+    void smc_mode0_bat_setf(uint8_t bat)
+    {
+        ASSERT_ERR(((bat << 8) & ~0x00000100) == 0);
+        this->m_reg[SMC_MODE0_INDEX] = (this->m_reg[SMC_MODE0_INDEX] & ~0x00000100) | (bat << 8);
+    }
+
+    uint8_t smc_mode0_exnw_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE0_INDEX];
+        return ((localVal & 0x00000030) >> 4);
+    }
+
+    void smc_mode0_exnw_mode_setf(uint8_t exnwmode)
+    {
+        ASSERT_ERR(((exnwmode << 4) & ~0x00000030) == 0);
+        this->m_reg[SMC_MODE0_INDEX] = (this->m_reg[SMC_MODE0_INDEX] & ~0x00000030) | (exnwmode << 4);
+    }
+
+    uint8_t smc_mode0_write_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE0_INDEX];
+        return ((localVal & 0x00000002) >> 1);
+    }
+
+    void smc_mode0_write_mode_setf(uint8_t writemode)
+    {
+        ASSERT_ERR(((writemode << 1) & ~0x00000002) == 0);
+        this->m_reg[SMC_MODE0_INDEX] = (this->m_reg[SMC_MODE0_INDEX] & ~0x00000002) | (writemode << 1);
+    }
+
+    uint8_t smc_mode0_read_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE0_INDEX];
+        return ((localVal & 0x00000001) >> 0);
+    }
+
+    void smc_mode0_read_mode_setf(uint8_t readmode)
+    {
+        ASSERT_ERR(((readmode << 0) & ~0x00000001) == 0);
+        this->m_reg[SMC_MODE0_INDEX] = (this->m_reg[SMC_MODE0_INDEX] & ~0x00000001) | (readmode << 0);
+    }
+
+    uint32_t smc_setup1_get(void)
+    {
+        return this->m_reg[SMC_SETUP1_INDEX];
+    }
+
+    void smc_setup1_set(uint32_t value)
+    {
+        this->m_reg[SMC_SETUP1_INDEX] = value;
+    }
+
+    typedef RegField<SMC_SETUP1_INDEX, 0x3F000000, 24> smc_setup1_ncs_rd_setup_field;
+    typedef RegField<SMC_SETUP1_INDEX, 0x003F0000, 16> smc_setup1_nrd_setup_field;
+    typedef RegField<SMC_SETUP1_INDEX, 0x00003F00, 8> smc_setup1_ncs_wr_setup_field;
+    typedef RegField<SMC_SETUP1_INDEX, 0x0000003F, 0> smc_setup1_nwe_setup_field;
+
+    void smc_setup1_pack(uint8_t ncsrdsetup, uint8_t nrdsetup, uint8_t ncswrsetup, uint8_t nwesetup)
+    {
+        ASSERT_ERR(((ncsrdsetup << 24) & ~0x3F000000) == 0);
+        ASSERT_ERR(((nrdsetup << 16) & ~0x003F0000) == 0);
+        ASSERT_ERR(((ncswrsetup << 8) & ~0x00003F00) == 0);
+        ASSERT_ERR(((nwesetup << 0) & ~0x0000003F) == 0);
+        this->m_reg[SMC_SETUP1_INDEX] =  (ncsrdsetup << 24) | (nrdsetup << 16) | (ncswrsetup << 8) | (nwesetup << 0);
+    }
+
+    void smc_setup1_unpack(uint8_t* ncsrdsetup, uint8_t* nrdsetup, uint8_t* ncswrsetup, uint8_t* nwesetup)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP1_INDEX];
+
+        *ncsrdsetup = (localVal & 0x3F000000) >> 24;
+        *nrdsetup = (localVal & 0x003F0000) >> 16;
+        *ncswrsetup = (localVal & 0x00003F00) >> 8;
+        *nwesetup = (localVal & 0x0000003F) >> 0;
+    }
+
+    uint8_t smc_setup1_ncs_rd_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP1_INDEX];
+        return ((localVal & 0x3F000000) >> 24);
+    }
+
+    void smc_setup1_ncs_rd_setup_setf(uint8_t ncsrdsetup)
+    {
+        ASSERT_ERR(((ncsrdsetup << 24) & ~0x3F000000) == 0);
+        this->m_reg[SMC_SETUP1_INDEX] = (this->m_reg[SMC_SETUP1_INDEX] & ~0x3F000000) | (ncsrdsetup << 24);
+    }
+
+    uint8_t smc_setup1_nrd_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP1_INDEX];
+        return ((localVal & 0x003F0000) >> 16);
+    }
+
+    void smc_setup1_nrd_setup_setf(uint8_t nrdsetup)
+    {
+        ASSERT_ERR(((nrdsetup << 16) & ~0x003F0000) == 0);
+        this->m_reg[SMC_SETUP1_INDEX] = (this->m_reg[SMC_SETUP1_INDEX] & ~0x003F0000) | (nrdsetup << 16);
+    }
+
+    uint8_t smc_setup1_ncs_wr_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP1_INDEX];
+        return ((localVal & 0x00003F00) >> 8);
+    }
+
+    void smc_setup1_ncs_wr_setup_setf(uint8_t ncswrsetup)
+    {
+        ASSERT_ERR(((ncswrsetup << 8) & ~0x00003F00) == 0);
+        this->m_reg[SMC_SETUP1_INDEX] = (this->m_reg[SMC_SETUP1_INDEX] & ~0x00003F00) | (ncswrsetup << 8);
+    }
+
+    uint8_t smc_setup1_nwe_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP1_INDEX];
+        return ((localVal & 0x0000003F) >> 0);
+    }
+
+    void smc_setup1_nwe_setup_setf(uint8_t nwesetup)
+    {
+        ASSERT_ERR(((nwesetup << 0) & ~0x0000003F) == 0);
+        this->m_reg[SMC_SETUP1_INDEX] = (this->m_reg[SMC_SETUP1_INDEX] & ~0x0000003F) | (nwesetup << 0);
+    }
+
+    uint32_t smc_pulse1_get(void)
+    {
+        return this->m_reg[SMC_PULSE1_INDEX];
+    }
+
+    void smc_pulse1_set(uint32_t value)
+    {
+        this->m_reg[SMC_PULSE1_INDEX] = value;
+    }
+
+    typedef RegField<SMC_PULSE1_INDEX, 0x7F000000, 24> smc_pulse1_ncs_rd_pulse_field;
+    typedef RegField<SMC_PULSE1_INDEX, 0x007F0000, 16> smc_pulse1_nrd_pulse_field;
+    typedef RegField<SMC_PULSE1_INDEX, 0x00007F00, 8> smc_pulse1_ncs_wr_pulse_field;
+    typedef RegField<SMC_PULSE1_INDEX, 0x0000007F, 0> smc_pulse1_nwe_pulse_field;
+
+    void smc_pulse1_pack(uint8_t ncsrdpulse, uint8_t nrdpulse, uint8_t ncswrpulse, uint8_t nwepulse)
+    {
+        ASSERT_ERR(((ncsrdpulse << 24) & ~0x7F000000) == 0);
+        ASSERT_ERR(((nrdpulse << 16) & ~0x007F0000) == 0);
+        ASSERT_ERR(((ncswrpulse << 8) & ~0x00007F00) == 0);
+        ASSERT_ERR(((nwepulse << 0) & ~0x0000007F) == 0);
+        this->m_reg[SMC_PULSE1_INDEX] =  (ncsrdpulse << 24) | (nrdpulse << 16) | (ncswrpulse << 8) | (nwepulse << 0);
+    }
+
+    void smc_pulse1_unpack(uint8_t* ncsrdpulse, uint8_t* nrdpulse, uint8_t* ncswrpulse, uint8_t* nwepulse)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE1_INDEX];
+
+        *ncsrdpulse = (localVal & 0x7F000000) >> 24;
+        *nrdpulse = (localVal & 0x007F0000) >> 16;
+        *ncswrpulse = (localVal & 0x00007F00) >> 8;
+        *nwepulse = (localVal & 0x0000007F) >> 0;
+    }
+
+    uint8_t smc_pulse1_ncs_rd_pulse_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE1_INDEX];
+        return ((localVal & 0x7F000000) >> 24);
+    }
+
+    void smc_pulse1_ncs_rd_pulse_setf(uint8_t ncsrdpulse)
+    {
+        ASSERT_ERR(((ncsrdpulse << 24) & ~0x7F000000) == 0);
+        this->m_reg[SMC_PULSE1_INDEX] = (this->m_reg[SMC_PULSE1_INDEX] & ~0x7F000000) | (ncsrdpulse << 24);
+    }
+
+    uint8_t smc_pulse1_nrd_pulse_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE1_INDEX];
+        return ((localVal & 0x007F0000) >> 16);
+    }
+
+    void smc_pulse1_nrd_pulse_setf(uint8_t nrdpulse)
+    {
+        ASSERT_ERR(((nrdpulse << 16) & ~0x007F0000) == 0);
+        this->m_reg[SMC_PULSE1_INDEX] = (this->m_reg[SMC_PULSE1_INDEX] & ~0x007F0000) | (nrdpulse << 16);
+    }
+
+    uint8_t smc_pulse1_ncs_wr_pulse_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE1_INDEX];
+        return ((localVal & 0x00007F00) >> 8);
+    }
+
+    void smc_pulse1_ncs_wr_pulse_setf(uint8_t ncswrpulse)
+    {
+        ASSERT_ERR(((ncswrpulse << 8) & ~0x00007F00) == 0);
+        this->m_reg[SMC_PULSE1_INDEX] = (this->m_reg[SMC_PULSE1_INDEX] & ~0x00007F00) | (ncswrpulse << 8);
+    }
+
+    uint8_t smc_pulse1_nwe_pulse_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE1_INDEX];
+        return ((localVal & 0x0000007F) >> 0);
+    }
+
+    void smc_pulse1_nwe_pulse_setf(uint8_t nwepulse)
+    {
+        ASSERT_ERR(((nwepulse << 0) & ~0x0000007F) == 0);
+        this->m_reg[SMC_PULSE1_INDEX] = (this->m_reg[SMC_PULSE1_INDEX] & ~0x0000007F) | (nwepulse << 0);
+    }
+
+    uint32_t smc_cycle1_get(void)
+    {
+        return this->m_reg[SMC_CYCLE1_INDEX];
+    }
+
+    void smc_cycle1_set(uint32_t value)
+    {
+        this->m_reg[SMC_CYCLE1_INDEX] = value;
+    }
+
+    typedef RegField<SMC_CYCLE1_INDEX, 0x01FF0000, 16> smc_cycle1_nrd_cycle_field;
+    typedef RegField<SMC_CYCLE1_INDEX, 0x000001FF, 0> smc_cycle1_nwe_cycle_field;
+
+    void smc_cycle1_pack(uint16_t nrdcycle, uint16_t nwecycle)
+    {
+        ASSERT_ERR(((nrdcycle << 16) & ~0x01FF0000) == 0);
+        ASSERT_ERR(((nwecycle << 0) & ~0x000001FF) == 0);
+        this->m_reg[SMC_CYCLE1_INDEX] =  (nrdcycle << 16) | (nwecycle << 0);
+    }
+
+    void smc_cycle1_unpack(uint16_t* nrdcycle, uint16_t* nwecycle)
+    {
+        uint32_t localVal = this->m_reg[SMC_CYCLE1_INDEX];
+
+        *nrdcycle = (localVal & 0x01FF0000) >> 16;
+        *nwecycle = (localVal & 0x000001FF) >> 0;
+    }
+
+    uint16_t smc_cycle1_nrd_cycle_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_CYCLE1_INDEX];
+        return ((localVal & 0x01FF0000) >> 16);
+    }
+
+    void smc_cycle1_nrd_cycle_setf(uint16_t nrdcycle)
+    {
+        ASSERT_ERR(((nrdcycle << 16) & ~0x01FF0000) == 0);
+        this->m_reg[SMC_CYCLE1_INDEX] = (this->m_reg[SMC_CYCLE1_INDEX] & ~0x01FF0000) | (nrdcycle << 16);
+    }
+
+    uint16_t smc_cycle1_nwe_cycle_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_CYCLE1_INDEX];
+        return ((localVal & 0x000001FF) >> 0);
+    }
+
+    void smc_cycle1_nwe_cycle_setf(uint16_t nwecycle)
+    {
+        ASSERT_ERR(((nwecycle << 0) & ~0x000001FF) == 0);
+        this->m_reg[SMC_CYCLE1_INDEX] = (this->m_reg[SMC_CYCLE1_INDEX] & ~0x000001FF) | (nwecycle << 0);
+    }
+
+    uint32_t smc_mode1_get(void)
+    {
+        return this->m_reg[SMC_MODE1_INDEX];
+    }
+
+    void smc_mode1_set(uint32_t value)
+    {
+        this->m_reg[SMC_MODE1_INDEX] = value;
+    }
+
+    typedef RegField<SMC_MODE1_INDEX, 0x30000000, 28> smc_mode1_ps_field;
+    typedef RegField<SMC_MODE1_INDEX, 0x01000000, 24> smc_mode1_pmen_field;
+    typedef RegField<SMC_MODE1_INDEX, 0x00100000, 20> smc_mode1_tdf_mode_field;
+    typedef RegField<SMC_MODE1_INDEX, 0x000F0000, 16> smc_mode1_tdf_cycles_field;
+    typedef RegField<SMC_MODE1_INDEX, 0x00003000, 12> smc_mode1_dbw_field;
+    typedef RegField<SMC_MODE1_INDEX, 0x00000100, 8> smc_mode1_bat_field;
+    typedef RegField<SMC_MODE1_INDEX, 0x00000030, 4> smc_mode1_exnw_mode_field;
+    typedef RegField<SMC_MODE1_INDEX, 0x00000002, 1> smc_mode1_write_mode_field;
+    typedef RegField<SMC_MODE1_INDEX, 0x00000001, 0> smc_mode1_read_mode_field;
+
+    void smc_mode1_pack(uint8_t ps, uint8_t pmen, uint8_t tdfmode, uint8_t tdfcycles, uint8_t dbw, uint8_t bat, uint8_t exnwmode, uint8_t writemode, uint8_t readmode)
+    {
+        ASSERT_ERR(((ps << 28) & ~0x30000000) == 0);
+        ASSERT_ERR(((pmen << 24) & ~0x01000000) == 0);
+        ASSERT_ERR(((tdfmode << 20) & ~0x00100000) == 0);
+        ASSERT_ERR(((tdfcycles << 16) & ~0x000F0000) == 0);
+        ASSERT_ERR(((dbw << 12) & ~0x00003000) == 0);
+        ASSERT_ERR(((bat << 8) & ~0x00000100) == 0);
+        ASSERT_ERR(((exnwmode << 4) & ~0x00000030) == 0);
+        ASSERT_ERR(((writemode << 1) & ~0x00000002) == 0);
+        ASSERT_ERR(((readmode << 0) & ~0x00000001) == 0);
+        this->m_reg[SMC_MODE1_INDEX] =  (ps << 28) | (pmen << 24) | (tdfmode << 20) | (tdfcycles << 16) | (dbw << 12) | (bat << 8) | (exnwmode << 4) | (writemode << 1) | (readmode << 0);
+    }
+
+    void smc_mode1_unpack(uint8_t* ps, uint8_t* pmen, uint8_t* tdfmode, uint8_t* tdfcycles, uint8_t* dbw, uint8_t* bat, uint8_t* exnwmode, uint8_t* writemode, uint8_t* readmode)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE1_INDEX];
+
+        *ps = (localVal & 0x30000000) >> 28;
+        *pmen = (localVal & 0x01000000) >> 24;
+        *tdfmode = (localVal & 0x00100000) >> 20;
+        *tdfcycles = (localVal & 0x000F0000) >> 16;
+        *dbw = (localVal & 0x00003000) >> 12;
+        *bat = (localVal & 0x00000100) >> 8;
+        *exnwmode = (localVal & 0x00000030) >> 4;
+        *writemode = (localVal & 0x00000002) >> 1;
+        *readmode = (localVal & 0x00000001) >> 0;
+    }
+
+    uint8_t smc_mode1_ps_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE1_INDEX];
+        return ((localVal & 0x30000000) >> 28);
+    }
+
+    void smc_mode1_ps_setf(uint8_t ps)
+    {
+        ASSERT_ERR(((ps << 28) & ~0x30000000) == 0);
+        this->m_reg[SMC_MODE1_INDEX] = (this->m_reg[SMC_MODE1_INDEX] & ~0x30000000) | (ps << 28);
+    }
+
+    uint8_t smc_mode1_pmen_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE1_INDEX];
+        return ((localVal & 0x01000000) >> 24);
+    }
+
+    void smc_mode1_pmen_setf(uint8_t pmen)
+    {
+        ASSERT_ERR(((pmen << 24) & ~0x01000000) == 0);
+        this->m_reg[SMC_MODE1_INDEX] = (this->m_reg[SMC_MODE1_INDEX] & ~0x01000000) | (pmen << 24);
+    }
+
+    uint8_t smc_mode1_tdf_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE1_INDEX];
+        return ((localVal & 0x00100000) >> 20);
+    }
+
+    void smc_mode1_tdf_mode_setf(uint8_t tdfmode)
+    {
+        ASSERT_ERR(((tdfmode << 20) & ~0x00100000) == 0);
+        this->m_reg[SMC_MODE1_INDEX] = (this->m_reg[SMC_MODE1_INDEX] & ~0x00100000) | (tdfmode << 20);
+    }
+
+    uint8_t smc_mode1_tdf_cycles_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE1_INDEX];
+        return ((localVal & 0x000F0000) >> 16);
+    }
+
+    void smc_mode1_tdf_cycles_setf(uint8_t tdfcycles)
+    {
+        ASSERT_ERR(((tdfcycles << 16) & ~0x000F0000) == 0);
+        this->m_reg[SMC_MODE1_INDEX] = (this->m_reg[SMC_MODE1_INDEX] & ~0x000F0000) | (tdfcycles << 16);
+    }
+
+    uint8_t smc_mode1_dbw_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE1_INDEX];
+        return ((localVal & 0x00003000) >> 12);
+    }
+
+    void smc_mode1_dbw_setf(uint8_t dbw)
+    {
+        ASSERT_ERR(((dbw << 12) & ~0x00003000) == 0);
+        this->m_reg[SMC_MODE1_INDEX] = (this->m_reg[SMC_MODE1_INDEX] & ~0x00003000) | (dbw << 12);
+    }
+
+    uint8_t smc_mode1_bat_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE1_INDEX];
+        return ((localVal & 0x00000100) >> 8);
+    }
+
+    void smc_mode1_bat_setf(uint8_t bat)
+    {
+        ASSERT_ERR(((bat << 8) & ~0x00000100) == 0);
+        this->m_reg[SMC_MODE1_INDEX] = (this->m_reg[SMC_MODE1_INDEX] & ~0x00000100) | (bat << 8);
+    }
+
+    uint8_t smc_mode1_exnw_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE1_INDEX];
+        return ((localVal & 0x00000030) >> 4);
+    }
+
+    void smc_mode1_exnw_mode_setf(uint8_t exnwmode)
+    {
+        ASSERT_ERR(((exnwmode << 4) & ~0x00000030) == 0);
+        this->m_reg[SMC_MODE1_INDEX] = (this->m_reg[SMC_MODE1_INDEX] & ~0x00000030) | (exnwmode << 4);
+    }
+
+    uint8_t smc_mode1_write_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE1_INDEX];
+        return ((localVal & 0x00000002) >> 1);
+    }
+
+    void smc_mode1_write_mode_setf(uint8_t writemode)
+    {
+        ASSERT_ERR(((writemode << 1) & ~0x00000002) == 0);
+        this->m_reg[SMC_MODE1_INDEX] = (this->m_reg[SMC_MODE1_INDEX] & ~0x00000002) | (writemode << 1);
+    }
+
+    uint8_t smc_mode1_read_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE1_INDEX];
+        return ((localVal & 0x00000001) >> 0);
+    }
+
+    void smc_mode1_read_mode_setf(uint8_t readmode)
+    {
+        ASSERT_ERR(((readmode << 0) & ~0x00000001) == 0);
+        this->m_reg[SMC_MODE1_INDEX] = (this->m_reg[SMC_MODE1_INDEX] & ~0x00000001) | (readmode << 0);
+    }
+
+    uint32_t smc_setup2_get(void)
+    {
+        return this->m_reg[SMC_SETUP2_INDEX];
+    }
+
+    void smc_setup2_set(uint32_t value)
+    {
+        this->m_reg[SMC_SETUP2_INDEX] = value;
+    }
+
+    typedef RegField<SMC_SETUP2_INDEX, 0x3F000000, 24> smc_setup2_ncs_rd_setup_field;
+    typedef RegField<SMC_SETUP2_INDEX, 0x003F0000, 16> smc_setup2_nrd_setup_field;
+    typedef RegField<SMC_SETUP2_INDEX, 0x00003F00, 8> smc_setup2_ncs_wr_setup_field;
+    typedef RegField<SMC_SETUP2_INDEX, 0x0000003F, 0> smc_setup2_nwe_setup_field;
+
+    void smc_setup2_pack(uint8_t ncsrdsetup, uint8_t nrdsetup, uint8_t ncswrsetup, uint8_t nwesetup)
+    {
+        ASSERT_ERR(((ncsrdsetup << 24) & ~0x3F000000) == 0);
+        ASSERT_ERR(((nrdsetup << 16) & ~0x003F0000) == 0);
+        ASSERT_ERR(((ncswrsetup << 8) & ~0x00003F00) == 0);
+        ASSERT_ERR(((nwesetup << 0) & ~0x0000003F) == 0);
+        this->m_reg[SMC_SETUP2_INDEX] =  (ncsrdsetup << 24) | (nrdsetup << 16) | (ncswrsetup << 8) | (nwesetup << 0);
+    }
+
+    void smc_setup2_unpack(uint8_t* ncsrdsetup, uint8_t* nrdsetup, uint8_t* ncswrsetup, uint8_t* nwesetup)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP2_INDEX];
+
+        *ncsrdsetup = (localVal & 0x3F000000) >> 24;
+        *nrdsetup = (localVal & 0x003F0000) >> 16;
+        *ncswrsetup = (localVal & 0x00003F00) >> 8;
+        *nwesetup = (localVal & 0x0000003F) >> 0;
+    }
+
+    uint8_t smc_setup2_ncs_rd_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP2_INDEX];
+        return ((localVal & 0x3F000000) >> 24);
+    }
+
+    void smc_setup2_ncs_rd_setup_setf(uint8_t ncsrdsetup)
+    {
+        ASSERT_ERR(((ncsrdsetup << 24) & ~0x3F000000) == 0);
+        this->m_reg[SMC_SETUP2_INDEX] = (this->m_reg[SMC_SETUP2_INDEX] & ~0x3F000000) | (ncsrdsetup << 24);
+    }
+
+    uint8_t smc_setup2_nrd_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP2_INDEX];
+        return ((localVal & 0x003F0000) >> 16);
+    }
+
+    void smc_setup2_nrd_setup_setf(uint8_t nrdsetup)
+    {
+        ASSERT_ERR(((nrdsetup << 16) & ~0x003F0000) == 0);
+        this->m_reg[SMC_SETUP2_INDEX] = (this->m_reg[SMC_SETUP2_INDEX] & ~0x003F0000) | (nrdsetup << 16);
+    }
+
+    uint8_t smc_setup2_ncs_wr_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP2_INDEX];
+        return ((localVal & 0x00003F00) >> 8);
+    }
+
+    void smc_setup2_ncs_wr_setup_setf(uint8_t ncswrsetup)
+    {
+        ASSERT_ERR(((ncswrsetup << 8) & ~0x00003F00) == 0);
+        this->m_reg[SMC_SETUP2_INDEX] = (this->m_reg[SMC_SETUP2_INDEX] & ~0x00003F00) | (ncswrsetup << 8);
+    }
+
+    uint8_t smc_setup2_nwe_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP2_INDEX];
+        return ((localVal & 0x0000003F) >> 0);
+    }
+
+    void smc_setup2_nwe_setup_setf(uint8_t nwesetup)
+    {
+        ASSERT_ERR(((nwesetup << 0) & ~0x0000003F) == 0);
+        this->m_reg[SMC_SETUP2_INDEX] = (this->m_reg[SMC_SETUP2_INDEX] & ~0x0000003F) | (nwesetup << 0);
+    }
+
+    uint32_t smc_pulse2_get(void)
+    {
+        return this->m_reg[SMC_PULSE2_INDEX];
+    }
+
+    void smc_pulse2_set(uint32_t value)
+    {
+        this->m_reg[SMC_PULSE2_INDEX] = value;
+    }
+
+    typedef RegField<SMC_PULSE2_INDEX, 0x7F000000, 24> smc_pulse2_ncs_rd_pulse_field;
+    typedef RegField<SMC_PULSE2_INDEX, 0x007F0000, 16> smc_pulse2_nrd_pulse_field;
+    typedef RegField<SMC_PULSE2_INDEX, 0x00007F00, 8> smc_pulse2_ncs_wr_pulse_field;
+    typedef RegField<SMC_PULSE2_INDEX, 0x0000007F, 0> smc_pulse2_nwe_pulse_field;
+
+    void smc_pulse2_pack(uint8_t ncsrdpulse, uint8_t nrdpulse, uint8_t ncswrpulse, uint8_t nwepulse)
+    {
+        ASSERT_ERR(((ncsrdpulse << 24) & ~0x7F000000) == 0);
+        ASSERT_ERR(((nrdpulse << 16) & ~0x007F0000) == 0);
+        ASSERT_ERR(((ncswrpulse << 8) & ~0x00007F00) == 0);
+        ASSERT_ERR(((nwepulse << 0) & ~0x0000007F) == 0);
+        this->m_reg[SMC_PULSE2_INDEX] =  (ncsrdpulse << 24) | (nrdpulse << 16) | (ncswrpulse << 8) | (nwepulse << 0);
+    }
+
+    void smc_pulse2_unpack(uint8_t* ncsrdpulse, uint8_t* nrdpulse, uint8_t* ncswrpulse, uint8_t* nwepulse)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE2_INDEX];
+
+        *ncsrdpulse = (localVal & 0x7F000000) >> 24;
+        *nrdpulse = (localVal & 0x007F0000) >> 16;
+        *ncswrpulse = (localVal & 0x00007F00) >> 8;
+        *nwepulse = (localVal & 0x0000007F) >> 0;
+    }
+
+    uint8_t smc_pulse2_ncs_rd_pulse_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE2_INDEX];
+        return ((localVal & 0x7F000000) >> 24);
+    }
+
+    void smc_pulse2_ncs_rd_pulse_setf(uint8_t ncsrdpulse)
+    {
+        ASSERT_ERR(((ncsrdpulse << 24) & ~0x7F000000) == 0);
+        this->m_reg[SMC_PULSE2_INDEX] = (this->m_reg[SMC_PULSE2_INDEX] & ~0x7F000000) | (ncsrdpulse << 24);
+    }
+
+    uint8_t smc_pulse2_nrd_pulse_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE2_INDEX];
+        return ((localVal & 0x007F0000) >> 16);
+    }
+
+    void smc_pulse2_nrd_pulse_setf(uint8_t nrdpulse)
+    {
+        ASSERT_ERR(((nrdpulse << 16) & ~0x007F0000) == 0);
+        this->m_reg[SMC_PULSE2_INDEX] = (this->m_reg[SMC_PULSE2_INDEX] & ~0x007F0000) | (nrdpulse << 16);
+    }
+
+    uint8_t smc_pulse2_ncs_wr_pulse_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE2_INDEX];
+        return ((localVal & 0x00007F00) >> 8);
+    }
+
+    void smc_pulse2_ncs_wr_pulse_setf(uint8_t ncswrpulse)
+    {
+        ASSERT_ERR(((ncswrpulse << 8) & ~0x00007F00) == 0);
+        this->m_reg[SMC_PULSE2_INDEX] = (this->m_reg[SMC_PULSE2_INDEX] & ~0x00007F00) | (ncswrpulse << 8);
+    }
+
+    uint8_t smc_pulse2_nwe_pulse_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE2_INDEX];
+        return ((localVal & 0x0000007F) >> 0);
+    }
+
+    void smc_pulse2_nwe_pulse_setf(uint8_t nwepulse)
+    {
+        ASSERT_ERR(((nwepulse << 0) & ~0x0000007F) == 0);
+        this->m_reg[SMC_PULSE2_INDEX] = (this->m_reg[SMC_PULSE2_INDEX] & ~0x0000007F) | (nwepulse << 0);
+    }
+
+    uint32_t smc_cycle2_get(void)
+    {
+        return this->m_reg[SMC_CYCLE2_INDEX];
+    }
+
+    void smc_cycle2_set(uint32_t value)
+    {
+        this->m_reg[SMC_CYCLE2_INDEX] = value;
+    }
+
+    typedef RegField<SMC_CYCLE2_INDEX, 0x01FF0000, 16> smc_cycle2_nrd_cycle_field;
+    typedef RegField<SMC_CYCLE2_INDEX, 0x000001FF, 0> smc_cycle2_nwe_cycle_field;
+
+    void smc_cycle2_pack(uint16_t nrdcycle, uint16_t nwecycle)
+    {
+        ASSERT_ERR(((nrdcycle << 16) & ~0x01FF0000) == 0);
+        ASSERT_ERR(((nwecycle << 0) & ~0x000001FF) == 0);
+        this->m_reg[SMC_CYCLE2_INDEX] =  (nrdcycle << 16) | (nwecycle << 0);
+    }
+
+    void smc_cycle2_unpack(uint16_t* nrdcycle, uint16_t* nwecycle)
+    {
+        uint32_t localVal = this->m_reg[SMC_CYCLE2_INDEX];
+
+        *nrdcycle = (localVal & 0x01FF0000) >> 16;
+        *nwecycle = (localVal & 0x000001FF) >> 0;
+    }
+
+    uint16_t smc_cycle2_nrd_cycle_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_CYCLE2_INDEX];
+        return ((localVal & 0x01FF0000) >> 16);
+    }
+
+    void smc_cycle2_nrd_cycle_setf(uint16_t nrdcycle)
+    {
+        ASSERT_ERR(((nrdcycle << 16) & ~0x01FF0000) == 0);
+        this->m_reg[SMC_CYCLE2_INDEX] = (this->m_reg[SMC_CYCLE2_INDEX] & ~0x01FF0000) | (nrdcycle << 16);
+    }
+
+    uint16_t smc_cycle2_nwe_cycle_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_CYCLE2_INDEX];
+        return ((localVal & 0x000001FF) >> 0);
+    }
+
+    void smc_cycle2_nwe_cycle_setf(uint16_t nwecycle)
+    {
+        ASSERT_ERR(((nwecycle << 0) & ~0x000001FF) == 0);
+        this->m_reg[SMC_CYCLE2_INDEX] = (this->m_reg[SMC_CYCLE2_INDEX] & ~0x000001FF) | (nwecycle << 0);
+    }
+
+    uint32_t smc_mode2_get(void)
+    {
+        return this->m_reg[SMC_MODE2_INDEX];
+    }
+
+    void smc_mode2_set(uint32_t value)
+    {
+        this->m_reg[SMC_MODE2_INDEX] = value;
+    }
+
+    typedef RegField<SMC_MODE2_INDEX, 0x30000000, 28> smc_mode2_ps_field;
+    typedef RegField<SMC_MODE2_INDEX, 0x01000000, 24> smc_mode2_pmen_field;
+    typedef RegField<SMC_MODE2_INDEX, 0x00100000, 20> smc_mode2_tdf_mode_field;
+    typedef RegField<SMC_MODE2_INDEX, 0x000F0000, 16> smc_mode2_tdf_cycles_field;
+    typedef RegField<SMC_MODE2_INDEX, 0x00003000, 12> smc_mode2_dbw_field;
+    typedef RegField<SMC_MODE2_INDEX, 0x00000100, 8> smc_mode2_bat_field;
+    typedef RegField<SMC_MODE2_INDEX, 0x00000030, 4> smc_mode2_exnw_mode_field;
+    typedef RegField<SMC_MODE2_INDEX, 0x00000002, 1> smc_mode2_write_mode_field;
+    typedef RegField<SMC_MODE2_INDEX, 0x00000001, 0> smc_mode2_read_mode_field;
+
+    void smc_mode2_pack(uint8_t ps, uint8_t pmen, uint8_t tdfmode, uint8_t tdfcycles, uint8_t dbw, uint8_t bat, uint8_t exnwmode, uint8_t writemode, uint8_t readmode)
+    {
+        ASSERT_ERR(((ps << 28) & ~0x30000000) == 0);
+        ASSERT_ERR(((pmen << 24) & ~0x01000000) == 0);
+        ASSERT_ERR(((tdfmode << 20) & ~0x00100000) == 0);
+        ASSERT_ERR(((tdfcycles << 16) & ~0x000F0000) == 0);
+        ASSERT_ERR(((dbw << 12) & ~0x00003000) == 0);
+        ASSERT_ERR(((bat << 8) & ~0x00000100) == 0);
+        ASSERT_ERR(((exnwmode << 4) & ~0x00000030) == 0);
+        ASSERT_ERR(((writemode << 1) & ~0x00000002) == 0);
+        ASSERT_ERR(((readmode << 0) & ~0x00000001) == 0);
+        this->m_reg[SMC_MODE2_INDEX] =  (ps << 28) | (pmen << 24) | (tdfmode << 20) | (tdfcycles << 16) | (dbw << 12) | (bat << 8) | (exnwmode << 4) | (writemode << 1) | (readmode << 0);
+    }
+
+    void smc_mode2_unpack(uint8_t* ps, uint8_t* pmen, uint8_t* tdfmode, uint8_t* tdfcycles, uint8_t* dbw, uint8_t* bat, uint8_t* exnwmode, uint8_t* writemode, uint8_t* readmode)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE2_INDEX];
+
+        *ps = (localVal & 0x30000000) >> 28;
+        *pmen = (localVal & 0x01000000) >> 24;
+        *tdfmode = (localVal & 0x00100000) >> 20;
+        *tdfcycles = (localVal & 0x000F0000) >> 16;
+        *dbw = (localVal & 0x00003000) >> 12;
+        *bat = (localVal & 0x00000100) >> 8;
+        *exnwmode = (localVal & 0x00000030) >> 4;
+        *writemode = (localVal & 0x00000002) >> 1;
+        *readmode = (localVal & 0x00000001) >> 0;
+    }
+
+    uint8_t smc_mode2_ps_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE2_INDEX];
+        return ((localVal & 0x30000000) >> 28);
+    }
+
+    void smc_mode2_ps_setf(uint8_t ps)
+    {
+        ASSERT_ERR(((ps << 28) & ~0x30000000) == 0);
+        this->m_reg[SMC_MODE2_INDEX] = (this->m_reg[SMC_MODE2_INDEX] & ~0x30000000) | (ps << 28);
+    }
+
+    uint8_t smc_mode2_pmen_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE2_INDEX];
+        return ((localVal & 0x01000000) >> 24);
+    }
+
+    void smc_mode2_pmen_setf(uint8_t pmen)
+    {
+        ASSERT_ERR(((pmen << 24) & ~0x01000000) == 0);
+        this->m_reg[SMC_MODE2_INDEX] = (this->m_reg[SMC_MODE2_INDEX] & ~0x01000000) | (pmen << 24);
+    }
+
+    uint8_t smc_mode2_tdf_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE2_INDEX];
+        return ((localVal & 0x00100000) >> 20);
+    }
+
+    void smc_mode2_tdf_mode_setf(uint8_t tdfmode)
+    {
+        ASSERT_ERR(((tdfmode << 20) & ~0x00100000) == 0);
+        this->m_reg[SMC_MODE2_INDEX] = (this->m_reg[SMC_MODE2_INDEX] & ~0x00100000) | (tdfmode << 20);
+    }
+
+    uint8_t smc_mode2_tdf_cycles_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE2_INDEX];
+        return ((localVal & 0x000F0000) >> 16);
+    }
+
+    void smc_mode2_tdf_cycles_setf(uint8_t tdfcycles)
+    {
+        ASSERT_ERR(((tdfcycles << 16) & ~0x000F0000) == 0);
+        this->m_reg[SMC_MODE2_INDEX] = (this->m_reg[SMC_MODE2_INDEX] & ~0x000F0000) | (tdfcycles << 16);
+    }
+
+    uint8_t smc_mode2_dbw_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE2_INDEX];
+        return ((localVal & 0x00003000) >> 12);
+    }
+
+    void smc_mode2_dbw_setf(uint8_t dbw)
+    {
+        ASSERT_ERR(((dbw << 12) & ~0x00003000) == 0);
+        this->m_reg[SMC_MODE2_INDEX] = (this->m_reg[SMC_MODE2_INDEX] & ~0x00003000) | (dbw << 12);
+    }
+
+    uint8_t smc_mode2_bat_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE2_INDEX];
+        return ((localVal & 0x00000100) >> 8);
+    }
+
+    void smc_mode2_bat_setf(uint8_t bat)
+    {
+        ASSERT_ERR(((bat << 8) & ~0x00000100) == 0);
+        this->m_reg[SMC_MODE2_INDEX] = (this->m_reg[SMC_MODE2_INDEX] & ~0x00000100) | (bat << 8);
+    }
+
+    uint8_t smc_mode2_exnw_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE2_INDEX];
+        return ((localVal & 0x00000030) >> 4);
+    }
+
+    void smc_mode2_exnw_mode_setf(uint8_t exnwmode)
+    {
+        ASSERT_ERR(((exnwmode << 4) & ~0x00000030) == 0);
+        this->m_reg[SMC_MODE2_INDEX] = (this->m_reg[SMC_MODE2_INDEX] & ~0x00000030) | (exnwmode << 4);
+    }
+
+    uint8_t smc_mode2_write_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE2_INDEX];
+        return ((localVal & 0x00000002) >> 1);
+    }
+
+    void smc_mode2_write_mode_setf(uint8_t writemode)
+    {
+        ASSERT_ERR(((writemode << 1) & ~0x00000002) == 0);
+        this->m_reg[SMC_MODE2_INDEX] = (this->m_reg[SMC_MODE2_INDEX] & ~0x00000002) | (writemode << 1);
+    }
+
+    uint8_t smc_mode2_read_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE2_INDEX];
+        return ((localVal & 0x00000001) >> 0);
+    }
+
+    void smc_mode2_read_mode_setf(uint8_t readmode)
+    {
+        ASSERT_ERR(((readmode << 0) & ~0x00000001) == 0);
+        this->m_reg[SMC_MODE2_INDEX] = (this->m_reg[SMC_MODE2_INDEX] & ~0x00000001) | (readmode << 0);
+    }
+
+    uint32_t smc_setup3_get(void)
+    {
+        return this->m_reg[SMC_SETUP3_INDEX];
+    }
+
+    void smc_setup3_set(uint32_t value)
+    {
+        this->m_reg[SMC_SETUP3_INDEX] = value;
+    }
+
+    typedef RegField<SMC_SETUP3_INDEX, 0x3F000000, 24> smc_setup3_ncs_rd_setup_field;
+    typedef RegField<SMC_SETUP3_INDEX, 0x003F0000, 16> smc_setup3_nrd_setup_field;
+    typedef RegField<SMC_SETUP3_INDEX, 0x00003F00, 8> smc_setup3_ncs_wr_setup_field;
+    typedef RegField<SMC_SETUP3_INDEX, 0x0000003F, 0> smc_setup3_nwe_setup_field;
+
+    void smc_setup3_pack(uint8_t ncsrdsetup, uint8_t nrdsetup, uint8_t ncswrsetup, uint8_t nwesetup)
+    {
+        ASSERT_ERR(((ncsrdsetup << 24) & ~0x3F000000) == 0);
+        ASSERT_ERR(((nrdsetup << 16) & ~0x003F0000) == 0);
+        ASSERT_ERR(((ncswrsetup << 8) & ~0x00003F00) == 0);
+        ASSERT_ERR(((nwesetup << 0) & ~0x0000003F) == 0);
+        this->m_reg[SMC_SETUP3_INDEX] =  (ncsrdsetup << 24) | (nrdsetup << 16) | (ncswrsetup << 8) | (nwesetup << 0);
+    }
+
+    void smc_setup3_unpack(uint8_t* ncsrdsetup, uint8_t* nrdsetup, uint8_t* ncswrsetup, uint8_t* nwesetup)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP3_INDEX];
+
+        *ncsrdsetup = (localVal & 0x3F000000) >> 24;
+        *nrdsetup = (localVal & 0x003F0000) >> 16;
+        *ncswrsetup = (localVal & 0x00003F00) >> 8;
+        *nwesetup = (localVal & 0x0000003F) >> 0;
+    }
+
+    uint8_t smc_setup3_ncs_rd_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP3_INDEX];
+        return ((localVal & 0x3F000000) >> 24);
+    }
+
+    void smc_setup3_ncs_rd_setup_setf(uint8_t ncsrdsetup)
+    {
+        ASSERT_ERR(((ncsrdsetup << 24) & ~0x3F000000) == 0);
+        this->m_reg[SMC_SETUP3_INDEX] = (this->m_reg[SMC_SETUP3_INDEX] & ~0x3F000000) | (ncsrdsetup << 24);
+    }
+
+    uint8_t smc_setup3_nrd_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP3_INDEX];
+        return ((localVal & 0x003F0000) >> 16);
+    }
+
+    void smc_setup3_nrd_setup_setf(uint8_t nrdsetup)
+    {
+        ASSERT_ERR(((nrdsetup << 16) & ~0x003F0000) == 0);
+        this->m_reg[SMC_SETUP3_INDEX] = (this->m_reg[SMC_SETUP3_INDEX] & ~0x003F0000) | (nrdsetup << 16);
+    }
+
+    uint8_t smc_setup3_ncs_wr_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP3_INDEX];
+        return ((localVal & 0x00003F00) >> 8);
+    }
+
+    void smc_setup3_ncs_wr_setup_setf(uint8_t ncswrsetup)
+    {
+        ASSERT_ERR(((ncswrsetup << 8) & ~0x00003F00) == 0);
+        this->m_reg[SMC_SETUP3_INDEX] = (this->m_reg[SMC_SETUP3_INDEX] & ~0x00003F00) | (ncswrsetup << 8);
+    }
+
+    uint8_t smc_setup3_nwe_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP3_INDEX];
+        return ((localVal & 0x0000003F) >> 0);
+    }
+
+    void smc_setup3_nwe_setup_setf(uint8_t nwesetup)
+    {
+        ASSERT_ERR(((nwesetup << 0) & ~0x0000003F) == 0);
+        this->m_reg[SMC_SETUP3_INDEX] = (this->m_reg[SMC_SETUP3_INDEX] & ~0x0000003F) | (nwesetup << 0);
+    }
+
+    uint32_t smc_pulse3_get(void)
+    {
+        return this->m_reg[SMC_PULSE3_INDEX];
+    }
+
+    void smc_pulse3_set(uint32_t value)
+    {
+        this->m_reg[SMC_PULSE3_INDEX] = value;
+    }
+
+    typedef RegField<SMC_PULSE3_INDEX, 0x7F000000, 24> smc_pulse3_ncs_rd_pulse_field;
+    typedef RegField<SMC_PULSE3_INDEX, 0x007F0000, 16> smc_pulse3_nrd_pulse_field;
+    typedef RegField<SMC_PULSE3_INDEX, 0x00007F00, 8> smc_pulse3_ncs_wr_pulse_field;
+    typedef RegField<SMC_PULSE3_INDEX, 0x0000007F, 0> smc_pulse3_nwe_pulse_field;
+
+    void smc_pulse3_pack(uint8_t ncsrdpulse, uint8_t nrdpulse, uint8_t ncswrpulse, uint8_t nwepulse)
+    {
+        ASSERT_ERR(((ncsrdpulse << 24) & ~0x7F000000) == 0);
+        ASSERT_ERR(((nrdpulse << 16) & ~0x007F0000) == 0);
+        ASSERT_ERR(((ncswrpulse << 8) & ~0x00007F00) == 0);
+        ASSERT_ERR(((nwepulse << 0) & ~0x0000007F) == 0);
+        this->m_reg[SMC_PULSE3_INDEX] =  (ncsrdpulse << 24) | (nrdpulse << 16) | (ncswrpulse << 8) | (nwepulse << 0);
+    }
+
+    void smc_pulse3_unpack(uint8_t* ncsrdpulse, uint8_t* nrdpulse, uint8_t* ncswrpulse, uint8_t* nwepulse)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE3_INDEX];
+
+        *ncsrdpulse = (localVal & 0x7F000000) >> 24;
+        *nrdpulse = (localVal & 0x007F0000) >> 16;
+        *ncswrpulse = (localVal & 0x00007F00) >> 8;
+        *nwepulse = (localVal & 0x0000007F) >> 0;
+    }
+
+    uint8_t smc_pulse3_ncs_rd_pulse_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE3_INDEX];
+        return ((localVal & 0x7F000000) >> 24);
+    }
+
+    void smc_pulse3_ncs_rd_pulse_setf(uint8_t ncsrdpulse)
+    {
+        ASSERT_ERR(((ncsrdpulse << 24) & ~0x7F000000) == 0);
+        this->m_reg[SMC_PULSE3_INDEX] = (this->m_reg[SMC_PULSE3_INDEX] & ~0x7F000000) | (ncsrdpulse << 24);
+    }
+
+    uint8_t smc_pulse3_nrd_pulse_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE3_INDEX];
+        return ((localVal & 0x007F0000) >> 16);
+    }
+
+    void smc_pulse3_nrd_pulse_setf(uint8_t nrdpulse)
+    {
+        ASSERT_ERR(((nrdpulse << 16) & ~0x007F0000) == 0);
+        this->m_reg[SMC_PULSE3_INDEX] = (this->m_reg[SMC_PULSE3_INDEX] & ~0x007F0000) | (nrdpulse << 16);
+    }
+
+    uint8_t smc_pulse3_ncs_wr_pulse_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE3_INDEX];
+        return ((localVal & 0x00007F00) >> 8);
+    }
+
+    void smc_pulse3_ncs_wr_pulse_setf(uint8_t ncswrpulse)
+    {
+        ASSERT_ERR(((ncswrpulse << 8) & ~0x00007F00) == 0);
+        this->m_reg[SMC_PULSE3_INDEX] = (this->m_reg[SMC_PULSE3_INDEX] & ~0x00007F00) | (ncswrpulse << 8);
+    }
+
+    uint8_t smc_pulse3_nwe_pulse_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE3_INDEX];
+        return ((localVal & 0x0000007F) >> 0);
+    }
+
+    void smc_pulse3_nwe_pulse_setf(uint8_t nwepulse)
+    {
+        ASSERT_ERR(((nwepulse << 0) & ~0x0000007F) == 0);
+        this->m_reg[SMC_PULSE3_INDEX] = (this->m_reg[SMC_PULSE3_INDEX] & ~0x0000007F) | (nwepulse << 0);
+    }
+
+    uint32_t smc_cycle3_get(void)
+    {
+        return this->m_reg[SMC_CYCLE3_INDEX];
+    }
+
+    void smc_cycle3_set(uint32_t value)
+    {
+        this->m_reg[SMC_CYCLE3_INDEX] = value;
+    }
+
+    typedef RegField<SMC_CYCLE3_INDEX, 0x01FF0000, 16> smc_cycle3_nrd_cycle_field;
+    typedef RegField<SMC_CYCLE3_INDEX, 0x000001FF, 0> smc_cycle3_nwe_cycle_field;
+
+    void smc_cycle3_pack(uint16_t nrdcycle, uint16_t nwecycle)
+    {
+        ASSERT_ERR(((nrdcycle << 16) & ~0x01FF0000) == 0);
+        ASSERT_ERR(((nwecycle << 0) & ~0x000001FF) == 0);
+        this->m_reg[SMC_CYCLE3_INDEX] =  (nrdcycle << 16) | (nwecycle << 0);
+    }
+
+    void smc_cycle3_unpack(uint16_t* nrdcycle, uint16_t* nwecycle)
+    {
+        uint32_t localVal = this->m_reg[SMC_CYCLE3_INDEX];
+
+        *nrdcycle = (localVal & 0x01FF0000) >> 16;
+        *nwecycle = (localVal & 0x000001FF) >> 0;
+    }
+
+    uint16_t smc_cycle3_nrd_cycle_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_CYCLE3_INDEX];
+        return ((localVal & 0x01FF0000) >> 16);
+    }
+
+    void smc_cycle3_nrd_cycle_setf(uint16_t nrdcycle)
+    {
+        ASSERT_ERR(((nrdcycle << 16) & ~0x01FF0000) == 0);
+        this->m_reg[SMC_CYCLE3_INDEX] = (this->m_reg[SMC_CYCLE3_INDEX] & ~0x01FF0000) | (nrdcycle << 16);
+    }
+
+    uint16_t smc_cycle3_nwe_cycle_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_CYCLE3_INDEX];
+        return ((localVal & 0x000001FF) >> 0);
+    }
+
+    void smc_cycle3_nwe_cycle_setf(uint16_t nwecycle)
+    {
+        ASSERT_ERR(((nwecycle << 0) & ~0x000001FF) == 0);
+        this->m_reg[SMC_CYCLE3_INDEX] = (this->m_reg[SMC_CYCLE3_INDEX] & ~0x000001FF) | (nwecycle << 0);
+    }
+
+    uint32_t smc_mode3_get(void)
+    {
+        return this->m_reg[SMC_MODE3_INDEX];
+    }
+
+    void smc_mode3_set(uint32_t value)
+    {
+        this->m_reg[SMC_MODE3_INDEX] = value;
+    }
+
+    typedef RegField<SMC_MODE3_INDEX, 0x30000000, 28> smc_mode3_ps_field;
+    typedef RegField<SMC_MODE3_INDEX, 0x01000000, 24> smc_mode3_pmen_field;
+    typedef RegField<SMC_MODE3_INDEX, 0x00100000, 20> smc_mode3_tdf_mode_field;
+    typedef RegField<SMC_MODE3_INDEX, 0x000F0000, 16> smc_mode3_tdf_cycles_field;
+    typedef RegField<SMC_MODE3_INDEX, 0x00003000, 12> smc_mode3_dbw_field;
+    typedef RegField<SMC_MODE3_INDEX, 0x00000100, 8> smc_mode3_bat_field;
+    typedef RegField<SMC_MODE3_INDEX, 0x00000030, 4> smc_mode3_exnw_mode_field;
+    typedef RegField<SMC_MODE3_INDEX, 0x00000002, 1> smc_mode3_write_mode_field;
+    typedef RegField<SMC_MODE3_INDEX, 0x00000001, 0> smc_mode3_read_mode_field;
+
+    void smc_mode3_pack(uint8_t ps, uint8_t pmen, uint8_t tdfmode, uint8_t tdfcycles, uint8_t dbw, uint8_t bat, uint8_t exnwmode, uint8_t writemode, uint8_t readmode)
+    {
+        ASSERT_ERR(((ps << 28) & ~0x30000000) == 0);
+        ASSERT_ERR(((pmen << 24) & ~0x01000000) == 0);
+        ASSERT_ERR(((tdfmode << 20) & ~0x00100000) == 0);
+        ASSERT_ERR(((tdfcycles << 16) & ~0x000F0000) == 0);
+        ASSERT_ERR(((dbw << 12) & ~0x00003000) == 0);
+        ASSERT_ERR(((bat << 8) & ~0x00000100) == 0);
+        ASSERT_ERR(((exnwmode << 4) & ~0x00000030) == 0);
+        ASSERT_ERR(((writemode << 1) & ~0x00000002) == 0);
+        ASSERT_ERR(((readmode << 0) & ~0x00000001) == 0);
+        this->m_reg[SMC_MODE3_INDEX] =  (ps << 28) | (pmen << 24) | (tdfmode << 20) | (tdfcycles << 16) | (dbw << 12) | (bat << 8) | (exnwmode << 4) | (writemode << 1) | (readmode << 0);
+    }
+
+    void smc_mode3_unpack(uint8_t* ps, uint8_t* pmen, uint8_t* tdfmode, uint8_t* tdfcycles, uint8_t* dbw, uint8_t* bat, uint8_t* exnwmode, uint8_t* writemode, uint8_t* readmode)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE3_INDEX];
+
+        *ps = (localVal & 0x30000000) >> 28;
+        *pmen = (localVal & 0x01000000) >> 24;
+        *tdfmode = (localVal & 0x00100000) >> 20;
+        *tdfcycles = (localVal & 0x000F0000) >> 16;
+        *dbw = (localVal & 0x00003000) >> 12;
+        *bat = (localVal & 0x00000100) >> 8;
+        *exnwmode = (localVal & 0x00000030) >> 4;
+        *writemode = (localVal & 0x00000002) >> 1;
+        *readmode = (localVal & 0x00000001) >> 0;
+    }
+
+    uint8_t smc_mode3_ps_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE3_INDEX];
+        return ((localVal & 0x30000000) >> 28);
+    }
+
+    void smc_mode3_ps_setf(uint8_t ps)
+    {
+        ASSERT_ERR(((ps << 28) & ~0x30000000) == 0);
+        this->m_reg[SMC_MODE3_INDEX] = (this->m_reg[SMC_MODE3_INDEX] & ~0x30000000) | (ps << 28);
+    }
+
+    uint8_t smc_mode3_pmen_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE3_INDEX];
+        return ((localVal & 0x01000000) >> 24);
+    }
+
+    void smc_mode3_pmen_setf(uint8_t pmen)
+    {
+        ASSERT_ERR(((pmen << 24) & ~0x01000000) == 0);
+        this->m_reg[SMC_MODE3_INDEX] = (this->m_reg[SMC_MODE3_INDEX] & ~0x01000000) | (pmen << 24);
+    }
+
+    uint8_t smc_mode3_tdf_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE3_INDEX];
+        return ((localVal & 0x00100000) >> 20);
+    }
+
+    void smc_mode3_tdf_mode_setf(uint8_t tdfmode)
+    {
+        ASSERT_ERR(((tdfmode << 20) & ~0x00100000) == 0);
+        this->m_reg[SMC_MODE3_INDEX] = (this->m_reg[SMC_MODE3_INDEX] & ~0x00100000) | (tdfmode << 20);
+    }
+
+    uint8_t smc_mode3_tdf_cycles_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE3_INDEX];
+        return ((localVal & 0x000F0000) >> 16);
+    }
+
+    void smc_mode3_tdf_cycles_setf(uint8_t tdfcycles)
+    {
+        ASSERT_ERR(((tdfcycles << 16) & ~0x000F0000) == 0);
+        this->m_reg[SMC_MODE3_INDEX] = (this->m_reg[SMC_MODE3_INDEX] & ~0x000F0000) | (tdfcycles << 16);
+    }
+
+    uint8_t smc_mode3_dbw_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE3_INDEX];
+        return ((localVal & 0x00003000) >> 12);
+    }
+
+    void smc_mode3_dbw_setf(uint8_t dbw)
+    {
+        ASSERT_ERR(((dbw << 12) & ~0x00003000) == 0);
+        this->m_reg[SMC_MODE3_INDEX] = (this->m_reg[SMC_MODE3_INDEX] & ~0x00003000) | (dbw << 12);
+    }
+
+    uint8_t smc_mode3_bat_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE3_INDEX];
+        return ((localVal & 0x00000100) >> 8);
+    }
+
+    void smc_mode3_bat_setf(uint8_t bat)
+    {
+        ASSERT_ERR(((bat << 8) & ~0x00000100) == 0);
+        this->m_reg[SMC_MODE3_INDEX] = (this->m_reg[SMC_MODE3_INDEX] & ~0x00000100) | (bat << 8);
+    }
+
+    uint8_t smc_mode3_exnw_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE3_INDEX];
+        return ((localVal & 0x00000030) >> 4);
+    }
+
+    void smc_mode3_exnw_mode_setf(uint8_t exnwmode)
+    {
+        ASSERT_ERR(((exnwmode << 4) & ~0x00000030) == 0);
+        this->m_reg[SMC_MODE3_INDEX] = (this->m_reg[SMC_MODE3_INDEX] & ~0x00000030) | (exnwmode << 4);
+    }
+
+    uint8_t smc_mode3_write_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE3_INDEX];
+        return ((localVal & 0x00000002) >> 1);
+    }
+
+    void smc_mode3_write_mode_setf(uint8_t writemode)
+    {
+        ASSERT_ERR(((writemode << 1) & ~0x00000002) == 0);
+        this->m_reg[SMC_MODE3_INDEX] = (this->m_reg[SMC_MODE3_INDEX] & ~0x00000002) | (writemode << 1);
+    }
+
+    uint8_t smc_mode3_read_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE3_INDEX];
+        return ((localVal & 0x00000001) >> 0);
+    }
+
+    void smc_mode3_read_mode_setf(uint8_t readmode)
+    {
+        ASSERT_ERR(((readmode << 0) & ~0x00000001) == 0);
+        this->m_reg[SMC_MODE3_INDEX] = (this->m_reg[SMC_MODE3_INDEX] & ~0x00000001) | (readmode << 0);
+    }
+
+    uint32_t smc_setup4_get(void)
+    {
+        return this->m_reg[SMC_SETUP4_INDEX];
+    }
+
+    void smc_setup4_set(uint32_t value)
+    {
+        this->m_reg[SMC_SETUP4_INDEX] = value;
+    }
+
+    typedef RegField<SMC_SETUP4_INDEX, 0x3F000000, 24> smc_setup4_ncs_rd_setup_field;
+    typedef RegField<SMC_SETUP4_INDEX, 0x003F0000, 16> smc_setup4_nrd_setup_field;
+    typedef RegField<SMC_SETUP4_INDEX, 0x00003F00, 8> smc_setup4_ncs_wr_setup_field;
+    typedef RegField<SMC_SETUP4_INDEX, 0x0000003F, 0> smc_setup4_nwe_setup_field;
+
+    void smc_setup4_pack(uint8_t ncsrdsetup, uint8_t nrdsetup, uint8_t ncswrsetup, uint8_t nwesetup)
+    {
+        ASSERT_ERR(((ncsrdsetup << 24) & ~0x3F000000) == 0);
+        ASSERT_ERR(((nrdsetup << 16) & ~0x003F0000) == 0);
+        ASSERT_ERR(((ncswrsetup << 8) & ~0x00003F00) == 0);
+        ASSERT_ERR(((nwesetup << 0) & ~0x0000003F) == 0);
+        this->m_reg[SMC_SETUP4_INDEX] =  (ncsrdsetup << 24) | (nrdsetup << 16) | (ncswrsetup << 8) | (nwesetup << 0);
+    }
+
+    void smc_setup4_unpack(uint8_t* ncsrdsetup, uint8_t* nrdsetup, uint8_t* ncswrsetup, uint8_t* nwesetup)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP4_INDEX];
+
+        *ncsrdsetup = (localVal & 0x3F000000) >> 24;
+        *nrdsetup = (localVal & 0x003F0000) >> 16;
+        *ncswrsetup = (localVal & 0x00003F00) >> 8;
+        *nwesetup = (localVal & 0x0000003F) >> 0;
+    }
+
+    uint8_t smc_setup4_ncs_rd_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP4_INDEX];
+        return ((localVal & 0x3F000000) >> 24);
+    }
+
+    void smc_setup4_ncs_rd_setup_setf(uint8_t ncsrdsetup)
+    {
+        ASSERT_ERR(((ncsrdsetup << 24) & ~0x3F000000) == 0);
+        this->m_reg[SMC_SETUP4_INDEX] = (this->m_reg[SMC_SETUP4_INDEX] & ~0x3F000000) | (ncsrdsetup << 24);
+    }
+
+    uint8_t smc_setup4_nrd_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP4_INDEX];
+        return ((localVal & 0x003F0000) >> 16);
+    }
+
+    void smc_setup4_nrd_setup_setf(uint8_t nrdsetup)
+    {
+        ASSERT_ERR(((nrdsetup << 16) & ~0x003F0000) == 0);
+        this->m_reg[SMC_SETUP4_INDEX] = (this->m_reg[SMC_SETUP4_INDEX] & ~0x003F0000) | (nrdsetup << 16);
+    }
+
+    uint8_t smc_setup4_ncs_wr_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP4_INDEX];
+        return ((localVal & 0x00003F00) >> 8);
+    }
+
+    void smc_setup4_ncs_wr_setup_setf(uint8_t ncswrsetup)
+    {
+        ASSERT_ERR(((ncswrsetup << 8) & ~0x00003F00) == 0);
+        this->m_reg[SMC_SETUP4_INDEX] = (this->m_reg[SMC_SETUP4_INDEX] & ~0x00003F00) | (ncswrsetup << 8);
+    }
+
+    uint8_t smc_setup4_nwe_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP4_INDEX];
+        return ((localVal & 0x0000003F) >> 0);
+    }
+
+    void smc_setup4_nwe_setup_setf(uint8_t nwesetup)
+    {
+        ASSERT_ERR(((nwesetup << 0) & ~0x0000003F) == 0);
+        this->m_reg[SMC_SETUP4_INDEX] = (this->m_reg[SMC_SETUP4_INDEX] & ~0x0000003F) | (nwesetup << 0);
+    }
+
+    uint32_t smc_pulse4_get(void)
+    {
+        return this->m_reg[SMC_PULSE4_INDEX];
+    }
+
+    void smc_pulse4_set(uint32_t value)
+    {
+        this->m_reg[SMC_PULSE4_INDEX] = value;
+    }
+
+    typedef RegField<SMC_PULSE4_INDEX, 0x7F000000, 24> smc_pulse4_ncs_rd_pulse_field;
+    typedef RegField<SMC_PULSE4_INDEX, 0x007F0000, 16> smc_pulse4_nrd_pulse_field;
+    typedef RegField<SMC_PULSE4_INDEX, 0x00007F00, 8> smc_pulse4_ncs_wr_pulse_field;
+    typedef RegField<SMC_PULSE4_INDEX, 0x0000007F, 0> smc_pulse4_nwe_pulse_field;
+
+    void smc_pulse4_pack(uint8_t ncsrdpulse, uint8_t nrdpulse, uint8_t ncswrpulse, uint8_t nwepulse)
+    {
+        ASSERT_ERR(((ncsrdpulse << 24) & ~0x7F000000) == 0);
+        ASSERT_ERR(((nrdpulse << 16) & ~0x007F0000) == 0);
+        ASSERT_ERR(((ncswrpulse << 8) & ~0x00007F00) == 0);
+        ASSERT_ERR(((nwepulse << 0) & ~0x0000007F) == 0);
+        this->m_reg[SMC_PULSE4_INDEX] =  (ncsrdpulse << 24) | (nrdpulse << 16) | (ncswrpulse << 8) | (nwepulse << 0);
+    }
+
+    void smc_pulse4_unpack(uint8_t* ncsrdpulse, uint8_t* nrdpulse, uint8_t* ncswrpulse, uint8_t* nwepulse)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE4_INDEX];
+
+        *ncsrdpulse = (localVal & 0x7F000000) >> 24;
+        *nrdpulse = (localVal & 0x007F0000) >> 16;
+        *ncswrpulse = (localVal & 0x00007F00) >> 8;
+        *nwepulse = (localVal & 0x0000007F) >> 0;
+    }
+
+    uint8_t smc_pulse4_ncs_rd_pulse_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE4_INDEX];
+        return ((localVal & 0x7F000000) >> 24);
+    }
+
+    void smc_pulse4_ncs_rd_pulse_setf(uint8_t ncsrdpulse)
+    {
+        ASSERT_ERR(((ncsrdpulse << 24) & ~0x7F000000) == 0);
+        this->m_reg[SMC_PULSE4_INDEX] = (this->m_reg[SMC_PULSE4_INDEX] & ~0x7F000000) | (ncsrdpulse << 24);
+    }
+
+    uint8_t smc_pulse4_nrd_pulse_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE4_INDEX];
+        return ((localVal & 0x007F0000) >> 16);
+    }
+
+    void smc_pulse4_nrd_pulse_setf(uint8_t nrdpulse)
+    {
+        ASSERT_ERR(((nrdpulse << 16) & ~0x007F0000) == 0);
+        this->m_reg[SMC_PULSE4_INDEX] = (this->m_reg[SMC_PULSE4_INDEX] & ~0x007F0000) | (nrdpulse << 16);
+    }
+
+    uint8_t smc_pulse4_ncs_wr_pulse_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE4_INDEX];
+        return ((localVal & 0x00007F00) >> 8);
+    }
+
+    void smc_pulse4_ncs_wr_pulse_setf(uint8_t ncswrpulse)
+    {
+        ASSERT_ERR(((ncswrpulse << 8) & ~0x00007F00) == 0);
+        this->m_reg[SMC_PULSE4_INDEX] = (this->m_reg[SMC_PULSE4_INDEX] & ~0x00007F00) | (ncswrpulse << 8);
+    }
+
+    uint8_t smc_pulse4_nwe_pulse_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE4_INDEX];
+        return ((localVal & 0x0000007F) >> 0);
+    }
+
+    void smc_pulse4_nwe_pulse_setf(uint8_t nwepulse)
+    {
+        ASSERT_ERR(((nwepulse << 0) & ~0x0000007F) == 0);
+        this->m_reg[SMC_PULSE4_INDEX] = (this->m_reg[SMC_PULSE4_INDEX] & ~0x0000007F) | (nwepulse << 0);
+    }
+
+    uint32_t smc_cycle4_get(void)
+    {
+        return this->m_reg[SMC_CYCLE4_INDEX];
+    }
+
+    void smc_cycle4_set(uint32_t value)
+    {
+        this->m_reg[SMC_CYCLE4_INDEX] = value;
+    }
+
+    typedef RegField<SMC_CYCLE4_INDEX, 0x01FF0000, 16> smc_cycle4_nrd_cycle_field;
+    typedef RegField<SMC_CYCLE4_INDEX, 0x000001FF, 0> smc_cycle4_nwe_cycle_field;
+
+    void smc_cycle4_pack(uint16_t nrdcycle, uint16_t nwecycle)
+    {
+        ASSERT_ERR(((nrdcycle << 16) & ~0x01FF0000) == 0);
+        ASSERT_ERR(((nwecycle << 0) & ~0x000001FF) == 0);
+        this->m_reg[SMC_CYCLE4_INDEX] =  (nrdcycle << 16) | (nwecycle << 0);
+    }
+
+    void smc_cycle4_unpack(uint16_t* nrdcycle, uint16_t* nwecycle)
+    {
+        uint32_t localVal = this->m_reg[SMC_CYCLE4_INDEX];
+
+        *nrdcycle = (localVal & 0x01FF0000) >> 16;
+        *nwecycle = (localVal & 0x000001FF) >> 0;
+    }
+
+    uint16_t smc_cycle4_nrd_cycle_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_CYCLE4_INDEX];
+        return ((localVal & 0x01FF0000) >> 16);
+    }
+
+    void smc_cycle4_nrd_cycle_setf(uint16_t nrdcycle)
+    {
+        ASSERT_ERR(((nrdcycle << 16) & ~0x01FF0000) == 0);
+        this->m_reg[SMC_CYCLE4_INDEX] = (this->m_reg[SMC_CYCLE4_INDEX] & ~0x01FF0000) | (nrdcycle << 16);
+    }
+
+    uint16_t smc_cycle4_nwe_cycle_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_CYCLE4_INDEX];
+        return ((localVal & 0x000001FF) >> 0);
+    }
+
+    void smc_cycle4_nwe_cycle_setf(uint16_t nwecycle)
+    {
+        ASSERT_ERR(((nwecycle << 0) & ~0x000001FF) == 0);
+        this->m_reg[SMC_CYCLE4_INDEX] = (this->m_reg[SMC_CYCLE4_INDEX] & ~0x000001FF) | (nwecycle << 0);
+    }
+
+    uint32_t smc_mode4_get(void)
+    {
+        return this->m_reg[SMC_MODE4_INDEX];
+    }
+
+    void smc_mode4_set(uint32_t value)
+    {
+        this->m_reg[SMC_MODE4_INDEX] = value;
+    }
+
+    typedef RegField<SMC_MODE4_INDEX, 0x30000000, 28> smc_mode4_ps_field;
+    typedef RegField<SMC_MODE4_INDEX, 0x01000000, 24> smc_mode4_pmen_field;
+    typedef RegField<SMC_MODE4_INDEX, 0x00100000, 20> smc_mode4_tdf_mode_field;
+    typedef RegField<SMC_MODE4_INDEX, 0x000F0000, 16> smc_mode4_tdf_cycles_field;
+    typedef RegField<SMC_MODE4_INDEX, 0x00003000, 12> smc_mode4_dbw_field;
+    typedef RegField<SMC_MODE4_INDEX, 0x00000100, 8> smc_mode4_bat_field;
+    typedef RegField<SMC_MODE4_INDEX, 0x00000030, 4> smc_mode4_exnw_mode_field;
+    typedef RegField<SMC_MODE4_INDEX, 0x00000002, 1> smc_mode4_write_mode_field;
+    typedef RegField<SMC_MODE4_INDEX, 0x00000001, 0> smc_mode4_read_mode_field;
+
+    void smc_mode4_pack(uint8_t ps, uint8_t pmen, uint8_t tdfmode, uint8_t tdfcycles, uint8_t dbw, uint8_t bat, uint8_t exnwmode, uint8_t writemode, uint8_t readmode)
+    {
+        ASSERT_ERR(((ps << 28) & ~0x30000000) == 0);
+        ASSERT_ERR(((pmen << 24) & ~0x01000000) == 0);
+        ASSERT_ERR(((tdfmode << 20) & ~0x00100000) == 0);
+        ASSERT_ERR(((tdfcycles << 16) & ~0x000F0000) == 0);
+        ASSERT_ERR(((dbw << 12) & ~0x00003000) == 0);
+        ASSERT_ERR(((bat << 8) & ~0x00000100) == 0);
+        ASSERT_ERR(((exnwmode << 4) & ~0x00000030) == 0);
+        ASSERT_ERR(((writemode << 1) & ~0x00000002) == 0);
+        ASSERT_ERR(((readmode << 0) & ~0x00000001) == 0);
+        this->m_reg[SMC_MODE4_INDEX] =  (ps << 28) | (pmen << 24) | (tdfmode << 20) | (tdfcycles << 16) | (dbw << 12) | (bat << 8) | (exnwmode << 4) | (writemode << 1) | (readmode << 0);
+    }
+
+    void smc_mode4_unpack(uint8_t* ps, uint8_t* pmen, uint8_t* tdfmode, uint8_t* tdfcycles, uint8_t* dbw, uint8_t* bat, uint8_t* exnwmode, uint8_t* writemode, uint8_t* readmode)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE4_INDEX];
+
+        *ps = (localVal & 0x30000000) >> 28;
+        *pmen = (localVal & 0x01000000) >> 24;
+        *tdfmode = (localVal & 0x00100000) >> 20;
+        *tdfcycles = (localVal & 0x000F0000) >> 16;
+        *dbw = (localVal & 0x00003000) >> 12;
+        *bat = (localVal & 0x00000100) >> 8;
+        *exnwmode = (localVal & 0x00000030) >> 4;
+        *writemode = (localVal & 0x00000002) >> 1;
+        *readmode = (localVal & 0x00000001) >> 0;
+    }
+
+    uint8_t smc_mode4_ps_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE4_INDEX];
+        return ((localVal & 0x30000000) >> 28);
+    }
+
+    void smc_mode4_ps_setf(uint8_t ps)
+    {
+        ASSERT_ERR(((ps << 28) & ~0x30000000) == 0);
+        this->m_reg[SMC_MODE4_INDEX] = (this->m_reg[SMC_MODE4_INDEX] & ~0x30000000) | (ps << 28);
+    }
+
+    uint8_t smc_mode4_pmen_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE4_INDEX];
+        return ((localVal & 0x01000000) >> 24);
+    }
+
+    void smc_mode4_pmen_setf(uint8_t pmen)
+    {
+        ASSERT_ERR(((pmen << 24) & ~0x01000000) == 0);
+        this->m_reg[SMC_MODE4_INDEX] = (this->m_reg[SMC_MODE4_INDEX] & ~0x01000000) | (pmen << 24);
+    }
+
+    uint8_t smc_mode4_tdf_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE4_INDEX];
+        return ((localVal & 0x00100000) >> 20);
+    }
+
+    void smc_mode4_tdf_mode_setf(uint8_t tdfmode)
+    {
+        ASSERT_ERR(((tdfmode << 20) & ~0x00100000) == 0);
+        this->m_reg[SMC_MODE4_INDEX] = (this->m_reg[SMC_MODE4_INDEX] & ~0x00100000) | (tdfmode << 20);
+    }
+
+    uint8_t smc_mode4_tdf_cycles_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE4_INDEX];
+        return ((localVal & 0x000F0000) >> 16);
+    }
+
+    void smc_mode4_tdf_cycles_setf(uint8_t tdfcycles)
+    {
+        ASSERT_ERR(((tdfcycles << 16) & ~0x000F0000) == 0);
+        this->m_reg[SMC_MODE4_INDEX] = (this->m_reg[SMC_MODE4_INDEX] & ~0x000F0000) | (tdfcycles << 16);
+    }
+
+    uint8_t smc_mode4_dbw_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE4_INDEX];
+        return ((localVal & 0x00003000) >> 12);
+    }
+
+    void smc_mode4_dbw_setf(uint8_t dbw)
+    {
+        ASSERT_ERR(((dbw << 12) & ~0x00003000) == 0);
+        this->m_reg[SMC_MODE4_INDEX] = (this->m_reg[SMC_MODE4_INDEX] & ~0x00003000) | (dbw << 12);
+    }
+
+    uint8_t smc_mode4_bat_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE4_INDEX];
+        return ((localVal & 0x00000100) >> 8);
+    }
+
+    void smc_mode4_bat_setf(uint8_t bat)
+    {
+        ASSERT_ERR(((bat << 8) & ~0x00000100) == 0);
+        this->m_reg[SMC_MODE4_INDEX] = (this->m_reg[SMC_MODE4_INDEX] & ~0x00000100) | (bat << 8);
+    }
+
+    uint8_t smc_mode4_exnw_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE4_INDEX];
+        return ((localVal & 0x00000030) >> 4);
+    }
+
+    void smc_mode4_exnw_mode_setf(uint8_t exnwmode)
+    {
+        ASSERT_ERR(((exnwmode << 4) & ~0x00000030) == 0);
+        this->m_reg[SMC_MODE4_INDEX] = (this->m_reg[SMC_MODE4_INDEX] & ~0x00000030) | (exnwmode << 4);
+    }
+
+    uint8_t smc_mode4_write_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE4_INDEX];
+        return ((localVal & 0x00000002) >> 1);
+    }
+
+    void smc_mode4_write_mode_setf(uint8_t writemode)
+    {
+        ASSERT_ERR(((writemode << 1) & ~0x00000002) == 0);
+        this->m_reg[SMC_MODE4_INDEX] = (this->m_reg[SMC_MODE4_INDEX] & ~0x00000002) | (writemode << 1);
+    }
+
+    uint8_t smc_mode4_read_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE4_INDEX];
+        return ((localVal & 0x00000001) >> 0);
+    }
+
+    void smc_mode4_read_mode_setf(uint8_t readmode)
+    {
+        ASSERT_ERR(((readmode << 0) & ~0x00000001) == 0);
+        this->m_reg[SMC_MODE4_INDEX] = (this->m_reg[SMC_MODE4_INDEX] & ~0x00000001) | (readmode << 0);
+    }
+
+    uint32_t smc_setup5_get(void)
+    {
+        return this->m_reg[SMC_SETUP5_INDEX];
+    }
+
+    void smc_setup5_set(uint32_t value)
+    {
+        this->m_reg[SMC_SETUP5_INDEX] = value;
+    }
+
+    typedef RegField<SMC_SETUP5_INDEX, 0x3F000000, 24> smc_setup5_ncs_rd_setup_field;
+    typedef RegField<SMC_SETUP5_INDEX, 0x003F0000, 16> smc_setup5_nrd_setup_field;
+    typedef RegField<SMC_SETUP5_INDEX, 0x00003F00, 8> smc_setup5_ncs_wr_setup_field;
+    typedef RegField<SMC_SETUP5_INDEX, 0x0000003F, 0> smc_setup5_nwe_setup_field;
+
+    void smc_setup5_pack(uint8_t ncsrdsetup, uint8_t nrdsetup, uint8_t ncswrsetup, uint8_t nwesetup)
+    {
+        ASSERT_ERR(((ncsrdsetup << 24) & ~0x3F000000) == 0);
+        ASSERT_ERR(((nrdsetup << 16) & ~0x003F0000) == 0);
+        ASSERT_ERR(((ncswrsetup << 8) & ~0x00003F00) == 0);
+        ASSERT_ERR(((nwesetup << 0) & ~0x0000003F) == 0);
+        this->m_reg[SMC_SETUP5_INDEX] =  (ncsrdsetup << 24) | (nrdsetup << 16) | (ncswrsetup << 8) | (nwesetup << 0);
+    }
+
+    void smc_setup5_unpack(uint8_t* ncsrdsetup, uint8_t* nrdsetup, uint8_t* ncswrsetup, uint8_t* nwesetup)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP5_INDEX];
+
+        *ncsrdsetup = (localVal & 0x3F000000) >> 24;
+        *nrdsetup = (localVal & 0x003F0000) >> 16;
+        *ncswrsetup = (localVal & 0x00003F00) >> 8;
+        *nwesetup = (localVal & 0x0000003F) >> 0;
+    }
+
+    uint8_t smc_setup5_ncs_rd_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP5_INDEX];
+        return ((localVal & 0x3F000000) >> 24);
+    }
+
+    void smc_setup5_ncs_rd_setup_setf(uint8_t ncsrdsetup)
+    {
+        ASSERT_ERR(((ncsrdsetup << 24) & ~0x3F000000) == 0);
+        this->m_reg[SMC_SETUP5_INDEX] = (this->m_reg[SMC_SETUP5_INDEX] & ~0x3F000000) | (ncsrdsetup << 24);
+    }
+
+    uint8_t smc_setup5_nrd_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP5_INDEX];
+        return ((localVal & 0x003F0000) >> 16);
+    }
+
+    void smc_setup5_nrd_setup_setf(uint8_t nrdsetup)
+    {
+        ASSERT_ERR(((nrdsetup << 16) & ~0x003F0000) == 0);
+        this->m_reg[SMC_SETUP5_INDEX] = (this->m_reg[SMC_SETUP5_INDEX] & ~0x003F0000) | (nrdsetup << 16);
+    }
+
+    uint8_t smc_setup5_ncs_wr_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP5_INDEX];
+        return ((localVal & 0x00003F00) >> 8);
+    }
+
+    void smc_setup5_ncs_wr_setup_setf(uint8_t ncswrsetup)
+    {
+        ASSERT_ERR(((ncswrsetup << 8) & ~0x00003F00) == 0);
+        this->m_reg[SMC_SETUP5_INDEX] = (this->m_reg[SMC_SETUP5_INDEX] & ~0x00003F00) | (ncswrsetup << 8);
+    }
+
+    uint8_t smc_setup5_nwe_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP5_INDEX];
+        return ((localVal & 0x0000003F) >> 0);
+    }
+
+    void smc_setup5_nwe_setup_setf(uint8_t nwesetup)
+    {
+        ASSERT_ERR(((nwesetup << 0) & ~0x0000003F) == 0);
+        this->m_reg[SMC_SETUP5_INDEX] = (this->m_reg[SMC_SETUP5_INDEX] & ~0x0000003F) | (nwesetup << 0);
+    }
+
+    uint32_t smc_pulse5_get(void)
+    {
+        return this->m_reg[SMC_PULSE5_INDEX];
+    }
+
+    void smc_pulse5_set(uint32_t value)
+    {
+        this->m_reg[SMC_PULSE5_INDEX] = value;
+    }
+
+    typedef RegField<SMC_PULSE5_INDEX, 0x7F000000, 24> smc_pulse5_ncs_rd_pulse_field;
+    typedef RegField<SMC_PULSE5_INDEX, 0x007F0000, 16> smc_pulse5_nrd_pulse_field;
+    typedef RegField<SMC_PULSE5_INDEX, 0x00007F00, 8> smc_pulse5_ncs_wr_pulse_field;
+    typedef RegField<SMC_PULSE5_INDEX, 0x0000007F, 0> smc_pulse5_nwe_pulse_field;
+
+    void smc_pulse5_pack(uint8_t ncsrdpulse, uint8_t nrdpulse, uint8_t ncswrpulse, uint8_t nwepulse)
+    {
+        ASSERT_ERR(((ncsrdpulse << 24) & ~0x7F000000) == 0);
+        ASSERT_ERR(((nrdpulse << 16) & ~0x007F0000) == 0);
+        ASSERT_ERR(((ncswrpulse << 8) & ~0x00007F00) == 0);
+        ASSERT_ERR(((nwepulse << 0) & ~0x0000007F) == 0);
+        this->m_reg[SMC_PULSE5_INDEX] =  (ncsrdpulse << 24) | (nrdpulse << 16) | (ncswrpulse << 8) | (nwepulse << 0);
+    }
+
+    void smc_pulse5_unpack(uint8_t* ncsrdpulse, uint8_t* nrdpulse, uint8_t* ncswrpulse, uint8_t* nwepulse)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE5_INDEX];
+
+        *ncsrdpulse = (localVal & 0x7F000000) >> 24;
+        *nrdpulse = (localVal & 0x007F0000) >> 16;
+        *ncswrpulse = (localVal & 0x00007F00) >> 8;
+        *nwepulse = (localVal & 0x0000007F) >> 0;
+    }
+
+    uint8_t smc_pulse5_ncs_rd_pulse_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE5_INDEX];
+        return ((localVal & 0x7F000000) >> 24);
+    }
+
+    void smc_pulse5_ncs_rd_pulse_setf(uint8_t ncsrdpulse)
+    {
+        ASSERT_ERR(((ncsrdpulse << 24) & ~0x7F000000) == 0);
+        this->m_reg[SMC_PULSE5_INDEX] = (this->m_reg[SMC_PULSE5_INDEX] & ~0x7F000000) | (ncsrdpulse << 24);
+    }
+
+    uint8_t smc_pulse5_nrd_pulse_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE5_INDEX];
+        return ((localVal & 0x007F0000) >> 16);
+    }
+
+    void smc_pulse5_nrd_pulse_setf(uint8_t nrdpulse)
+    {
+        ASSERT_ERR(((nrdpulse << 16) & ~0x007F0000) == 0);
+        this->m_reg[SMC_PULSE5_INDEX] = (this->m_reg[SMC_PULSE5_INDEX] & ~0x007F0000) | (nrdpulse << 16);
+    }
+
+    uint8_t smc_pulse5_ncs_wr_pulse_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE5_INDEX];
+        return ((localVal & 0x00007F00) >> 8);
+    }
+
+    void smc_pulse5_ncs_wr_pulse_setf(uint8_t ncswrpulse)
+    {
+        ASSERT_ERR(((ncswrpulse << 8) & ~0x00007F00) == 0);
+        this->m_reg[SMC_PULSE5_INDEX] = (this->m_reg[SMC_PULSE5_INDEX] & ~0x00007F00) | (ncswrpulse << 8);
+    }
+
+    uint8_t smc_pulse5_nwe_pulse_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE5_INDEX];
+        return ((localVal & 0x0000007F) >> 0);
+    }
+
+    void smc_pulse5_nwe_pulse_setf(uint8_t nwepulse)
+    {
+        ASSERT_ERR(((nwepulse << 0) & ~0x0000007F) == 0);
+        this->m_reg[SMC_PULSE5_INDEX] = (this->m_reg[SMC_PULSE5_INDEX] & ~0x0000007F) | (nwepulse << 0);
+    }
+
+    uint32_t smc_cycle5_get(void)
+    {
+        return this->m_reg[SMC_CYCLE5_INDEX];
+    }
+
+    void smc_cycle5_set(uint32_t value)
+    {
+        this->m_reg[SMC_CYCLE5_INDEX] = value;
+    }
+
+    typedef RegField<SMC_CYCLE5_INDEX, 0x01FF0000, 16> smc_cycle5_nrd_cycle_field;
+    typedef RegField<SMC_CYCLE5_INDEX, 0x000001FF, 0> smc_cycle5_nwe_cycle_field;
+
+    void smc_cycle5_pack(uint16_t nrdcycle, uint16_t nwecycle)
+    {
+        ASSERT_ERR(((nrdcycle << 16) & ~0x01FF0000) == 0);
+        ASSERT_ERR(((nwecycle << 0) & ~0x000001FF) == 0);
+        this->m_reg[SMC_CYCLE5_INDEX] =  (nrdcycle << 16) | (nwecycle << 0);
+    }
+
+    void smc_cycle5_unpack(uint16_t* nrdcycle, uint16_t* nwecycle)
+    {
+        uint32_t localVal = this->m_reg[SMC_CYCLE5_INDEX];
+
+        *nrdcycle = (localVal & 0x01FF0000) >> 16;
+        *nwecycle = (localVal & 0x000001FF) >> 0;
+    }
+
+    uint16_t smc_cycle5_nrd_cycle_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_CYCLE5_INDEX];
+        return ((localVal & 0x01FF0000) >> 16);
+    }
+
+    void smc_cycle5_nrd_cycle_setf(uint16_t nrdcycle)
+    {
+        ASSERT_ERR(((nrdcycle << 16) & ~0x01FF0000) == 0);
+        this->m_reg[SMC_CYCLE5_INDEX] = (this->m_reg[SMC_CYCLE5_INDEX] & ~0x01FF0000) | (nrdcycle << 16);
+    }
+
+    uint16_t smc_cycle5_nwe_cycle_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_CYCLE5_INDEX];
+        return ((localVal & 0x000001FF) >> 0);
+    }
+
+    void smc_cycle5_nwe_cycle_setf(uint16_t nwecycle)
+    {
+        ASSERT_ERR(((nwecycle << 0) & ~0x000001FF) == 0);
+        this->m_reg[SMC_CYCLE5_INDEX] = (this->m_reg[SMC_CYCLE5_INDEX] & ~0x000001FF) | (nwecycle << 0);
+    }
+
+    uint32_t smc_mode5_get(void)
+    {
+        return this->m_reg[SMC_MODE5_INDEX];
+    }
+
+    void smc_mode5_set(uint32_t value)
+    {
+        this->m_reg[SMC_MODE5_INDEX] = value;
+    }
+
+    typedef RegField<SMC_MODE5_INDEX, 0x30000000, 28> smc_mode5_ps_field;
+    typedef RegField<SMC_MODE5_INDEX, 0x01000000, 24> smc_mode5_pmen_field;
+    typedef RegField<SMC_MODE5_INDEX, 0x00100000, 20> smc_mode5_tdf_mode_field;
+    typedef RegField<SMC_MODE5_INDEX, 0x000F0000, 16> smc_mode5_tdf_cycles_field;
+    typedef RegField<SMC_MODE5_INDEX, 0x00003000, 12> smc_mode5_dbw_field;
+    typedef RegField<SMC_MODE5_INDEX, 0x00000100, 8> smc_mode5_bat_field;
+    typedef RegField<SMC_MODE5_INDEX, 0x00000030, 4> smc_mode5_exnw_mode_field;
+    typedef RegField<SMC_MODE5_INDEX, 0x00000002, 1> smc_mode5_write_mode_field;
+    typedef RegField<SMC_MODE5_INDEX, 0x00000001, 0> smc_mode5_read_mode_field;
+
+    void smc_mode5_pack(uint8_t ps, uint8_t pmen, uint8_t tdfmode, uint8_t tdfcycles, uint8_t dbw, uint8_t bat, uint8_t exnwmode, uint8_t writemode, uint8_t readmode)
+    {
+        ASSERT_ERR(((ps << 28) & ~0x30000000) == 0);
+        ASSERT_ERR(((pmen << 24) & ~0x01000000) == 0);
+        ASSERT_ERR(((tdfmode << 20) & ~0x00100000) == 0);
+        ASSERT_ERR(((tdfcycles << 16) & ~0x000F0000) == 0);
+        ASSERT_ERR(((dbw << 12) & ~0x00003000) == 0);
+        ASSERT_ERR(((bat << 8) & ~0x00000100) == 0);
+        ASSERT_ERR(((exnwmode << 4) & ~0x00000030) == 0);
+        ASSERT_ERR(((writemode << 1) & ~0x00000002) == 0);
+        ASSERT_ERR(((readmode << 0) & ~0x00000001) == 0);
+        this->m_reg[SMC_MODE5_INDEX] =  (ps << 28) | (pmen << 24) | (tdfmode << 20) | (tdfcycles << 16) | (dbw << 12) | (bat << 8) | (exnwmode << 4) | (writemode << 1) | (readmode << 0);
+    }
+
+    void smc_mode5_unpack(uint8_t* ps, uint8_t* pmen, uint8_t* tdfmode, uint8_t* tdfcycles, uint8_t* dbw, uint8_t* bat, uint8_t* exnwmode, uint8_t* writemode, uint8_t* readmode)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE5_INDEX];
+
+        *ps = (localVal & 0x30000000) >> 28;
+        *pmen = (localVal & 0x01000000) >> 24;
+        *tdfmode = (localVal & 0x00100000) >> 20;
+        *tdfcycles = (localVal & 0x000F0000) >> 16;
+        *dbw = (localVal & 0x00003000) >> 12;
+        *bat = (localVal & 0x00000100) >> 8;
+        *exnwmode = (localVal & 0x00000030) >> 4;
+        *writemode = (localVal & 0x00000002) >> 1;
+        *readmode = (localVal & 0x00000001) >> 0;
+    }
+
+    uint8_t smc_mode5_ps_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE5_INDEX];
+        return ((localVal & 0x30000000) >> 28);
+    }
+
+    void smc_mode5_ps_setf(uint8_t ps)
+    {
+        ASSERT_ERR(((ps << 28) & ~0x30000000) == 0);
+        this->m_reg[SMC_MODE5_INDEX] = (this->m_reg[SMC_MODE5_INDEX] & ~0x30000000) | (ps << 28);
+    }
+
+    uint8_t smc_mode5_pmen_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE5_INDEX];
+        return ((localVal & 0x01000000) >> 24);
+    }
+
+    void smc_mode5_pmen_setf(uint8_t pmen)
+    {
+        ASSERT_ERR(((pmen << 24) & ~0x01000000) == 0);
+        this->m_reg[SMC_MODE5_INDEX] = (this->m_reg[SMC_MODE5_INDEX] & ~0x01000000) | (pmen << 24);
+    }
+
+    uint8_t smc_mode5_tdf_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE5_INDEX];
+        return ((localVal & 0x00100000) >> 20);
+    }
+
+    void smc_mode5_tdf_mode_setf(uint8_t tdfmode)
+    {
+        ASSERT_ERR(((tdfmode << 20) & ~0x00100000) == 0);
+        this->m_reg[SMC_MODE5_INDEX] = (this->m_reg[SMC_MODE5_INDEX] & ~0x00100000) | (tdfmode << 20);
+    }
+
+    uint8_t smc_mode5_tdf_cycles_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE5_INDEX];
+        return ((localVal & 0x000F0000) >> 16);
+    }
+
+    void smc_mode5_tdf_cycles_setf(uint8_t tdfcycles)
+    {
+        ASSERT_ERR(((tdfcycles << 16) & ~0x000F0000) == 0);
+        this->m_reg[SMC_MODE5_INDEX] = (this->m_reg[SMC_MODE5_INDEX] & ~0x000F0000) | (tdfcycles << 16);
+    }
+
+    uint8_t smc_mode5_dbw_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE5_INDEX];
+        return ((localVal & 0x00003000) >> 12);
+    }
+
+    void smc_mode5_dbw_setf(uint8_t dbw)
+    {
+        ASSERT_ERR(((dbw << 12) & ~0x00003000) == 0);
+        this->m_reg[SMC_MODE5_INDEX] = (this->m_reg[SMC_MODE5_INDEX] & ~0x00003000) | (dbw << 12);
+    }
+
+    uint8_t smc_mode5_bat_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE5_INDEX];
+        return ((localVal & 0x00000100) >> 8);
+    }
+
+    void smc_mode5_bat_setf(uint8_t bat)
+    {
+        ASSERT_ERR(((bat << 8) & ~0x00000100) == 0);
+        this->m_reg[SMC_MODE5_INDEX] = (this->m_reg[SMC_MODE5_INDEX] & ~0x00000100) | (bat << 8);
+    }
+
+    uint8_t smc_mode5_exnw_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE5_INDEX];
+        return ((localVal & 0x00000030) >> 4);
+    }
+
+    void smc_mode5_exnw_mode_setf(uint8_t exnwmode)
+    {
+        ASSERT_ERR(((exnwmode << 4) & ~0x00000030) == 0);
+        this->m_reg[SMC_MODE5_INDEX] = (this->m_reg[SMC_MODE5_INDEX] & ~0x00000030) | (exnwmode << 4);
+    }
+
+    uint8_t smc_mode5_write_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE5_INDEX];
+        return ((localVal & 0x00000002) >> 1);
+    }
+
+    void smc_mode5_write_mode_setf(uint8_t writemode)
+    {
+        ASSERT_ERR(((writemode << 1) & ~0x00000002) == 0);
+        this->m_reg[SMC_MODE5_INDEX] = (this->m_reg[SMC_MODE5_INDEX] & ~0x00000002) | (writemode << 1);
+    }
+
+    uint8_t smc_mode5_read_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE5_INDEX];
+        return ((localVal & 0x00000001) >> 0);
+    }
+
+    void smc_mode5_read_mode_setf(uint8_t readmode)
+    {
+        ASSERT_ERR(((readmode << 0) & ~0x00000001) == 0);
+        this->m_reg[SMC_MODE5_INDEX] = (this->m_reg[SMC_MODE5_INDEX] & ~0x00000001) | (readmode << 0);
+    }
+
+    uint32_t smc_setup6_get(void)
+    {
+        return this->m_reg[SMC_SETUP6_INDEX];
+    }
+
+    void smc_setup6_set(uint32_t value)
+    {
+        this->m_reg[SMC_SETUP6_INDEX] = value;
+    }
+
+    typedef RegField<SMC_SETUP6_INDEX, 0x3F000000, 24> smc_setup6_ncs_rd_setup_field;
+    typedef RegField<SMC_SETUP6_INDEX, 0x003F0000, 16> smc_setup6_nrd_setup_field;
+    typedef RegField<SMC_SETUP6_INDEX, 0x00003F00, 8> smc_setup6_ncs_wr_setup_field;
+    typedef RegField<SMC_SETUP6_INDEX, 0x0000003F, 0> smc_setup6_nwe_setup_field;
+
+    void smc_setup6_pack(uint8_t ncsrdsetup, uint8_t nrdsetup, uint8_t ncswrsetup, uint8_t nwesetup)
+    {
+        ASSERT_ERR(((ncsrdsetup << 24) & ~0x3F000000) == 0);
+        ASSERT_ERR(((nrdsetup << 16) & ~0x003F0000) == 0);
+        ASSERT_ERR(((ncswrsetup << 8) & ~0x00003F00) == 0);
+        ASSERT_ERR(((nwesetup << 0) & ~0x0000003F) == 0);
+        this->m_reg[SMC_SETUP6_INDEX] =  (ncsrdsetup << 24) | (nrdsetup << 16) | (ncswrsetup << 8) | (nwesetup << 0);
+    }
+
+    void smc_setup6_unpack(uint8_t* ncsrdsetup, uint8_t* nrdsetup, uint8_t* ncswrsetup, uint8_t* nwesetup)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP6_INDEX];
+
+        *ncsrdsetup = (localVal & 0x3F000000) >> 24;
+        *nrdsetup = (localVal & 0x003F0000) >> 16;
+        *ncswrsetup = (localVal & 0x00003F00) >> 8;
+        *nwesetup = (localVal & 0x0000003F) >> 0;
+    }
+
+    uint8_t smc_setup6_ncs_rd_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP6_INDEX];
+        return ((localVal & 0x3F000000) >> 24);
+    }
+
+    void smc_setup6_ncs_rd_setup_setf(uint8_t ncsrdsetup)
+    {
+        ASSERT_ERR(((ncsrdsetup << 24) & ~0x3F000000) == 0);
+        this->m_reg[SMC_SETUP6_INDEX] = (this->m_reg[SMC_SETUP6_INDEX] & ~0x3F000000) | (ncsrdsetup << 24);
+    }
+
+    uint8_t smc_setup6_nrd_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP6_INDEX];
+        return ((localVal & 0x003F0000) >> 16);
+    }
+
+    void smc_setup6_nrd_setup_setf(uint8_t nrdsetup)
+    {
+        ASSERT_ERR(((nrdsetup << 16) & ~0x003F0000) == 0);
+        this->m_reg[SMC_SETUP6_INDEX] = (this->m_reg[SMC_SETUP6_INDEX] & ~0x003F0000) | (nrdsetup << 16);
+    }
+
+    uint8_t smc_setup6_ncs_wr_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP6_INDEX];
+        return ((localVal & 0x00003F00) >> 8);
+    }
+
+    void smc_setup6_ncs_wr_setup_setf(uint8_t ncswrsetup)
+    {
+        ASSERT_ERR(((ncswrsetup << 8) & ~0x00003F00) == 0);
+        this->m_reg[SMC_SETUP6_INDEX] = (this->m_reg[SMC_SETUP6_INDEX] & ~0x00003F00) | (ncswrsetup << 8);
+    }
+
+    uint8_t smc_setup6_nwe_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP6_INDEX];
+        return ((localVal & 0x0000003F) >> 0);
+    }
+
+    void smc_setup6_nwe_setup_setf(uint8_t nwesetup)
+    {
+        ASSERT_ERR(((nwesetup << 0) & ~0x0000003F) == 0);
+        this->m_reg[SMC_SETUP6_INDEX] = (this->m_reg[SMC_SETUP6_INDEX] & ~0x0000003F) | (nwesetup << 0);
+    }
+
+    uint32_t smc_pulse6_get(void)
+    {
+        return this->m_reg[SMC_PULSE6_INDEX];
+    }
+
+    void smc_pulse6_set(uint32_t value)
+    {
+        this->m_reg[SMC_PULSE6_INDEX] = value;
+    }
+
+    typedef RegField<SMC_PULSE6_INDEX, 0x7F000000, 24> smc_pulse6_ncs_rd_pulse_field;
+    typedef RegField<SMC_PULSE6_INDEX, 0x007F0000, 16> smc_pulse6_nrd_pulse_field;
+    typedef RegField<SMC_PULSE6_INDEX, 0x00007F00, 8> smc_pulse6_ncs_wr_pulse_field;
+    typedef RegField<SMC_PULSE6_INDEX, 0x0000007F, 0> smc_pulse6_nwe_pulse_field;
+
+    void smc_pulse6_pack(uint8_t ncsrdpulse, uint8_t nrdpulse, uint8_t ncswrpulse, uint8_t nwepulse)
+    {
+        ASSERT_ERR(((ncsrdpulse << 24) & ~0x7F000000) == 0);
+        ASSERT_ERR(((nrdpulse << 16) & ~0x007F0000) == 0);
+        ASSERT_ERR(((ncswrpulse << 8) & ~0x00007F00) == 0);
+        ASSERT_ERR(((nwepulse << 0) & ~0x0000007F) == 0);
+        this->m_reg[SMC_PULSE6_INDEX] =  (ncsrdpulse << 24) | (nrdpulse << 16) | (ncswrpulse << 8) | (nwepulse << 0);
+    }
+
+    void smc_pulse6_unpack(uint8_t* ncsrdpulse, uint8_t* nrdpulse, uint8_t* ncswrpulse, uint8_t* nwepulse)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE6_INDEX];
+
+        *ncsrdpulse = (localVal & 0x7F000000) >> 24;
+        *nrdpulse = (localVal & 0x007F0000) >> 16;
+        *ncswrpulse = (localVal & 0x00007F00) >> 8;
+        *nwepulse = (localVal & 0x0000007F) >> 0;
+    }
+
+    uint8_t smc_pulse6_ncs_rd_pulse_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE6_INDEX];
+        return ((localVal & 0x7F000000) >> 24);
+    }
+
+    void smc_pulse6_ncs_rd_pulse_setf(uint8_t ncsrdpulse)
+    {
+        ASSERT_ERR(((ncsrdpulse << 24) & ~0x7F000000) == 0);
+        this->m_reg[SMC_PULSE6_INDEX] = (this->m_reg[SMC_PULSE6_INDEX] & ~0x7F000000) | (ncsrdpulse << 24);
+    }
+
+    uint8_t smc_pulse6_nrd_pulse_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE6_INDEX];
+        return ((localVal & 0x007F0000) >> 16);
+    }
+
+    void smc_pulse6_nrd_pulse_setf(uint8_t nrdpulse)
+    {
+        ASSERT_ERR(((nrdpulse << 16) & ~0x007F0000) == 0);
+        this->m_reg[SMC_PULSE6_INDEX] = (this->m_reg[SMC_PULSE6_INDEX] & ~0x007F0000) | (nrdpulse << 16);
+    }
+
+    uint8_t smc_pulse6_ncs_wr_pulse_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE6_INDEX];
+        return ((localVal & 0x00007F00) >> 8);
+    }
+
+    void smc_pulse6_ncs_wr_pulse_setf(uint8_t ncswrpulse)
+    {
+        ASSERT_ERR(((ncswrpulse << 8) & ~0x00007F00) == 0);
+        this->m_reg[SMC_PULSE6_INDEX] = (this->m_reg[SMC_PULSE6_INDEX] & ~0x00007F00) | (ncswrpulse << 8);
+    }
+
+    uint8_t smc_pulse6_nwe_pulse_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE6_INDEX];
+        return ((localVal & 0x0000007F) >> 0);
+    }
+
+    void smc_pulse6_nwe_pulse_setf(uint8_t nwepulse)
+    {
+        ASSERT_ERR(((nwepulse << 0) & ~0x0000007F) == 0);
+        this->m_reg[SMC_PULSE6_INDEX] = (this->m_reg[SMC_PULSE6_INDEX] & ~0x0000007F) | (nwepulse << 0);
+    }
+
+    uint32_t smc_cycle6_get(void)
+    {
+        return this->m_reg[SMC_CYCLE6_INDEX];
+    }
+
+    void smc_cycle6_set(uint32_t value)
+    {
+        this->m_reg[SMC_CYCLE6_INDEX] = value;
+    }
+
+    typedef RegField<SMC_CYCLE6_INDEX, 0x01FF0000, 16> smc_cycle6_nrd_cycle_field;
+    typedef RegField<SMC_CYCLE6_INDEX, 0x000001FF, 0> smc_cycle6_nwe_cycle_field;
+
+    void smc_cycle6_pack(uint16_t nrdcycle, uint16_t nwecycle)
+    {
+        ASSERT_ERR(((nrdcycle << 16) & ~0x01FF0000) == 0);
+        ASSERT_ERR(((nwecycle << 0) & ~0x000001FF) == 0);
+        this->m_reg[SMC_CYCLE6_INDEX] =  (nrdcycle << 16) | (nwecycle << 0);
+    }
+
+    void smc_cycle6_unpack(uint16_t* nrdcycle, uint16_t* nwecycle)
+    {
+        uint32_t localVal = this->m_reg[SMC_CYCLE6_INDEX];
+
+        *nrdcycle = (localVal & 0x01FF0000) >> 16;
+        *nwecycle = (localVal & 0x000001FF) >> 0;
+    }
+
+    uint16_t smc_cycle6_nrd_cycle_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_CYCLE6_INDEX];
+        return ((localVal & 0x01FF0000) >> 16);
+    }
+
+    void smc_cycle6_nrd_cycle_setf(uint16_t nrdcycle)
+    {
+        ASSERT_ERR(((nrdcycle << 16) & ~0x01FF0000) == 0);
+        this->m_reg[SMC_CYCLE6_INDEX] = (this->m_reg[SMC_CYCLE6_INDEX] & ~0x01FF0000) | (nrdcycle << 16);
+    }
+
+    uint16_t smc_cycle6_nwe_cycle_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_CYCLE6_INDEX];
+        return ((localVal & 0x000001FF) >> 0);
+    }
+
+    void smc_cycle6_nwe_cycle_setf(uint16_t nwecycle)
+    {
+        ASSERT_ERR(((nwecycle << 0) & ~0x000001FF) == 0);
+        this->m_reg[SMC_CYCLE6_INDEX] = (this->m_reg[SMC_CYCLE6_INDEX] & ~0x000001FF) | (nwecycle << 0);
+    }
+
+    uint32_t smc_mode6_get(void)
+    {
+        return this->m_reg[SMC_MODE6_INDEX];
+    }
+
+    void smc_mode6_set(uint32_t value)
+    {
+        this->m_reg[SMC_MODE6_INDEX] = value;
+    }
+
+    typedef RegField<SMC_MODE6_INDEX, 0x30000000, 28> smc_mode6_ps_field;
+    typedef RegField<SMC_MODE6_INDEX, 0x01000000, 24> smc_mode6_pmen_field;
+    typedef RegField<SMC_MODE6_INDEX, 0x00100000, 20> smc_mode6_tdf_mode_field;
+    typedef RegField<SMC_MODE6_INDEX, 0x000F0000, 16> smc_mode6_tdf_cycles_field;
+    typedef RegField<SMC_MODE6_INDEX, 0x00003000, 12> smc_mode6_dbw_field;
+    typedef RegField<SMC_MODE6_INDEX, 0x00000100, 8> smc_mode6_bat_field;
+    typedef RegField<SMC_MODE6_INDEX, 0x00000030, 4> smc_mode6_exnw_mode_field;
+    typedef RegField<SMC_MODE6_INDEX, 0x00000002, 1> smc_mode6_write_mode_field;
+    typedef RegField<SMC_MODE6_INDEX, 0x00000001, 0> smc_mode6_read_mode_field;
+
+    void smc_mode6_pack(uint8_t ps, uint8_t pmen, uint8_t tdfmode, uint8_t tdfcycles, uint8_t dbw, uint8_t bat, uint8_t exnwmode, uint8_t writemode, uint8_t readmode)
+    {
+        ASSERT_ERR(((ps << 28) & ~0x30000000) == 0);
+        ASSERT_ERR(((pmen << 24) & ~0x01000000) == 0);
+        ASSERT_ERR(((tdfmode << 20) & ~0x00100000) == 0);
+        ASSERT_ERR(((tdfcycles << 16) & ~0x000F0000) == 0);
+        ASSERT_ERR(((dbw << 12) & ~0x00003000) == 0);
+        ASSERT_ERR(((bat << 8) & ~0x00000100) == 0);
+        ASSERT_ERR(((exnwmode << 4) & ~0x00000030) == 0);
+        ASSERT_ERR(((writemode << 1) & ~0x00000002) == 0);
+        ASSERT_ERR(((readmode << 0) & ~0x00000001) == 0);
+        this->m_reg[SMC_MODE6_INDEX] =  (ps << 28) | (pmen << 24) | (tdfmode << 20) | (tdfcycles << 16) | (dbw << 12) | (bat << 8) | (exnwmode << 4) | (writemode << 1) | (readmode << 0);
+    }
+
+    void smc_mode6_unpack(uint8_t* ps, uint8_t* pmen, uint8_t* tdfmode, uint8_t* tdfcycles, uint8_t* dbw, uint8_t* bat, uint8_t* exnwmode, uint8_t* writemode, uint8_t* readmode)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE6_INDEX];
+
+        *ps = (localVal & 0x30000000) >> 28;
+        *pmen = (localVal & 0x01000000) >> 24;
+        *tdfmode = (localVal & 0x00100000) >> 20;
+        *tdfcycles = (localVal & 0x000F0000) >> 16;
+        *dbw = (localVal & 0x00003000) >> 12;
+        *bat = (localVal & 0x00000100) >> 8;
+        *exnwmode = (localVal & 0x00000030) >> 4;
+        *writemode = (localVal & 0x00000002) >> 1;
+        *readmode = (localVal & 0x00000001) >> 0;
+    }
+
+    uint8_t smc_mode6_ps_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE6_INDEX];
+        return ((localVal & 0x30000000) >> 28);
+    }
+
+    void smc_mode6_ps_setf(uint8_t ps)
+    {
+        ASSERT_ERR(((ps << 28) & ~0x30000000) == 0);
+        this->m_reg[SMC_MODE6_INDEX] = (this->m_reg[SMC_MODE6_INDEX] & ~0x30000000) | (ps << 28);
+    }
+
+    uint8_t smc_mode6_pmen_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE6_INDEX];
+        return ((localVal & 0x01000000) >> 24);
+    }
+
+    void smc_mode6_pmen_setf(uint8_t pmen)
+    {
+        ASSERT_ERR(((pmen << 24) & ~0x01000000) == 0);
+        this->m_reg[SMC_MODE6_INDEX] = (this->m_reg[SMC_MODE6_INDEX] & ~0x01000000) | (pmen << 24);
+    }
+
+    uint8_t smc_mode6_tdf_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE6_INDEX];
+        return ((localVal & 0x00100000) >> 20);
+    }
+
+    void smc_mode6_tdf_mode_setf(uint8_t tdfmode)
+    {
+        ASSERT_ERR(((tdfmode << 20) & ~0x00100000) == 0);
+        this->m_reg[SMC_MODE6_INDEX] = (this->m_reg[SMC_MODE6_INDEX] & ~0x00100000) | (tdfmode << 20);
+    }
+
+    uint8_t smc_mode6_tdf_cycles_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE6_INDEX];
+        return ((localVal & 0x000F0000) >> 16);
+    }
+
+    void smc_mode6_tdf_cycles_setf(uint8_t tdfcycles)
+    {
+        ASSERT_ERR(((tdfcycles << 16) & ~0x000F0000) == 0);
+        this->m_reg[SMC_MODE6_INDEX] = (this->m_reg[SMC_MODE6_INDEX] & ~0x000F0000) | (tdfcycles << 16);
+    }
+
+    uint8_t smc_mode6_dbw_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE6_INDEX];
+        return ((localVal & 0x00003000) >> 12);
+    }
+
+    void smc_mode6_dbw_setf(uint8_t dbw)
+    {
+        ASSERT_ERR(((dbw << 12) & ~0x00003000) == 0);
+        this->m_reg[SMC_MODE6_INDEX] = (this->m_reg[SMC_MODE6_INDEX] & ~0x00003000) | (dbw << 12);
+    }
+
+    uint8_t smc_mode6_bat_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE6_INDEX];
+        return ((localVal & 0x00000100) >> 8);
+    }
+
+    void smc_mode6_bat_setf(uint8_t bat)
+    {
+        ASSERT_ERR(((bat << 8) & ~0x00000100) == 0);
+        this->m_reg[SMC_MODE6_INDEX] = (this->m_reg[SMC_MODE6_INDEX] & ~0x00000100) | (bat << 8);
+    }
+
+    uint8_t smc_mode6_exnw_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE6_INDEX];
+        return ((localVal & 0x00000030) >> 4);
+    }
+
+    void smc_mode6_exnw_mode_setf(uint8_t exnwmode)
+    {
+        ASSERT_ERR(((exnwmode << 4) & ~0x00000030) == 0);
+        this->m_reg[SMC_MODE6_INDEX] = (this->m_reg[SMC_MODE6_INDEX] & ~0x00000030) | (exnwmode << 4);
+    }
+
+    uint8_t smc_mode6_write_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE6_INDEX];
+        return ((localVal & 0x00000002) >> 1);
+    }
+
+    void smc_mode6_write_mode_setf(uint8_t writemode)
+    {
+        ASSERT_ERR(((writemode << 1) & ~0x00000002) == 0);
+        this->m_reg[SMC_MODE6_INDEX] = (this->m_reg[SMC_MODE6_INDEX] & ~0x00000002) | (writemode << 1);
+    }
+
+    uint8_t smc_mode6_read_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE6_INDEX];
+        return ((localVal & 0x00000001) >> 0);
+    }
+
+    void smc_mode6_read_mode_setf(uint8_t readmode)
+    {
+        ASSERT_ERR(((readmode << 0) & ~0x00000001) == 0);
+        this->m_reg[SMC_MODE6_INDEX] = (this->m_reg[SMC_MODE6_INDEX] & ~0x00000001) | (readmode << 0);
+    }
+
+    uint32_t smc_setup7_get(void)
+    {
+        return this->m_reg[SMC_SETUP7_INDEX];
+    }
+
+    void smc_setup7_set(uint32_t value)
+    {
+        this->m_reg[SMC_SETUP7_INDEX] = value;
+    }
+
+    typedef RegField<SMC_SETUP7_INDEX, 0x3F000000, 24> smc_setup7_ncs_rd_setup_field;
+    typedef RegField<SMC_SETUP7_INDEX, 0x003F0000, 16> smc_setup7_nrd_setup_field;
+    typedef RegField<SMC_SETUP7_INDEX, 0x00003F00, 8> smc_setup7_ncs_wr_setup_field;
+    typedef RegField<SMC_SETUP7_INDEX, 0x0000003F, 0> smc_setup7_nwe_setup_field;
+
+    void smc_setup7_pack(uint8_t ncsrdsetup, uint8_t nrdsetup, uint8_t ncswrsetup, uint8_t nwesetup)
+    {
+        ASSERT_ERR(((ncsrdsetup << 24) & ~0x3F000000) == 0);
+        ASSERT_ERR(((nrdsetup << 16) & ~0x003F0000) == 0);
+        ASSERT_ERR(((ncswrsetup << 8) & ~0x00003F00) == 0);
+        ASSERT_ERR(((nwesetup << 0) & ~0x0000003F) == 0);
+        this->m_reg[SMC_SETUP7_INDEX] =  (ncsrdsetup << 24) | (nrdsetup << 16) | (ncswrsetup << 8) | (nwesetup << 0);
+    }
+
+    void smc_setup7_unpack(uint8_t* ncsrdsetup, uint8_t* nrdsetup, uint8_t* ncswrsetup, uint8_t* nwesetup)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP7_INDEX];
+
+        *ncsrdsetup = (localVal & 0x3F000000) >> 24;
+        *nrdsetup = (localVal & 0x003F0000) >> 16;
+        *ncswrsetup = (localVal & 0x00003F00) >> 8;
+        *nwesetup = (localVal & 0x0000003F) >> 0;
+    }
+
+    uint8_t smc_setup7_ncs_rd_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP7_INDEX];
+        return ((localVal & 0x3F000000) >> 24);
+    }
+
+    void smc_setup7_ncs_rd_setup_setf(uint8_t ncsrdsetup)
+    {
+        ASSERT_ERR(((ncsrdsetup << 24) & ~0x3F000000) == 0);
+        this->m_reg[SMC_SETUP7_INDEX] = (this->m_reg[SMC_SETUP7_INDEX] & ~0x3F000000) | (ncsrdsetup << 24);
+    }
+
+    uint8_t smc_setup7_nrd_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP7_INDEX];
+        return ((localVal & 0x003F0000) >> 16);
+    }
+
+    void smc_setup7_nrd_setup_setf(uint8_t nrdsetup)
+    {
+        ASSERT_ERR(((nrdsetup << 16) & ~0x003F0000) == 0);
+        this->m_reg[SMC_SETUP7_INDEX] = (this->m_reg[SMC_SETUP7_INDEX] & ~0x003F0000) | (nrdsetup << 16);
+    }
+
+    uint8_t smc_setup7_ncs_wr_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP7_INDEX];
+        return ((localVal & 0x00003F00) >> 8);
+    }
+
+    void smc_setup7_ncs_wr_setup_setf(uint8_t ncswrsetup)
+    {
+        ASSERT_ERR(((ncswrsetup << 8) & ~0x00003F00) == 0);
+        this->m_reg[SMC_SETUP7_INDEX] = (this->m_reg[SMC_SETUP7_INDEX] & ~0x00003F00) | (ncswrsetup << 8);
+    }
+
+    uint8_t smc_setup7_nwe_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_SETUP7_INDEX];
+        return ((localVal & 0x0000003F) >> 0);
+    }
+
+    void smc_setup7_nwe_setup_setf(uint8_t nwesetup)
+    {
+        ASSERT_ERR(((nwesetup << 0) & ~0x0000003F) == 0);
+        this->m_reg[SMC_SETUP7_INDEX] = (this->m_reg[SMC_SETUP7_INDEX] & ~0x0000003F) | (nwesetup << 0);
+    }
+
+    uint32_t smc_pulse7_get(void)
+    {
+        return this->m_reg[SMC_PULSE7_INDEX];
+    }
+
+    void smc_pulse7_set(uint32_t value)
+    {
+        this->m_reg[SMC_PULSE7_INDEX] = value;
+    }
+
+    typedef RegField<SMC_PULSE7_INDEX, 0x7F000000, 24> smc_pulse7_ncs_rd_pulse_field;
+    typedef RegField<SMC_PULSE7_INDEX, 0x007F0000, 16> smc_pulse7_nrd_pulse_field;
+    typedef RegField<SMC_PULSE7_INDEX, 0x00007F00, 8> smc_pulse7_ncs_wr_pulse_field;
+    typedef RegField<SMC_PULSE7_INDEX, 0x0000007F, 0> smc_pulse7_nwe_pulse_field;
+
+    void smc_pulse7_pack(uint8_t ncsrdpulse, uint8_t nrdpulse, uint8_t ncswrpulse, uint8_t nwepulse)
+    {
+        ASSERT_ERR(((ncsrdpulse << 24) & ~0x7F000000) == 0);
+        ASSERT_ERR(((nrdpulse << 16) & ~0x007F0000) == 0);
+        ASSERT_ERR(((ncswrpulse << 8) & ~0x00007F00) == 0);
+        ASSERT_ERR(((nwepulse << 0) & ~0x0000007F) == 0);
+        this->m_reg[SMC_PULSE7_INDEX] =  (ncsrdpulse << 24) | (nrdpulse << 16) | (ncswrpulse << 8) | (nwepulse << 0);
+    }
+
+    void smc_pulse7_unpack(uint8_t* ncsrdpulse, uint8_t* nrdpulse, uint8_t* ncswrpulse, uint8_t* nwepulse)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE7_INDEX];
+
+        *ncsrdpulse = (localVal & 0x7F000000) >> 24;
+        *nrdpulse = (localVal & 0x007F0000) >> 16;
+        *ncswrpulse = (localVal & 0x00007F00) >> 8;
+        *nwepulse = (localVal & 0x0000007F) >> 0;
+    }
+
+    uint8_t smc_pulse7_ncs_rd_pulse_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE7_INDEX];
+        return ((localVal & 0x7F000000) >> 24);
+    }
+
+    void smc_pulse7_ncs_rd_pulse_setf(uint8_t ncsrdpulse)
+    {
+        ASSERT_ERR(((ncsrdpulse << 24) & ~0x7F000000) == 0);
+        this->m_reg[SMC_PULSE7_INDEX] = (this->m_reg[SMC_PULSE7_INDEX] & ~0x7F000000) | (ncsrdpulse << 24);
+    }
+
+    uint8_t smc_pulse7_nrd_pulse_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE7_INDEX];
+        return ((localVal & 0x007F0000) >> 16);
+    }
+
+    void smc_pulse7_nrd_pulse_setf(uint8_t nrdpulse)
+    {
+        ASSERT_ERR(((nrdpulse << 16) & ~0x007F0000) == 0);
+        this->m_reg[SMC_PULSE7_INDEX] = (this->m_reg[SMC_PULSE7_INDEX] & ~0x007F0000) | (nrdpulse << 16);
+    }
+
+    uint8_t smc_pulse7_ncs_wr_pulse_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE7_INDEX];
+        return ((localVal & 0x00007F00) >> 8);
+    }
+
+    void smc_pulse7_ncs_wr_pulse_setf(uint8_t ncswrpulse)
+    {
+        ASSERT_ERR(((ncswrpulse << 8) & ~0x00007F00) == 0);
+        this->m_reg[SMC_PULSE7_INDEX] = (this->m_reg[SMC_PULSE7_INDEX] & ~0x00007F00) | (ncswrpulse << 8);
+    }
+
+    uint8_t smc_pulse7_nwe_pulse_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_PULSE7_INDEX];
+        return ((localVal & 0x0000007F) >> 0);
+    }
+
+    void smc_pulse7_nwe_pulse_setf(uint8_t nwepulse)
+    {
+        ASSERT_ERR(((nwepulse << 0) & ~0x0000007F) == 0);
+        this->m_reg[SMC_PULSE7_INDEX] = (this->m_reg[SMC_PULSE7_INDEX] & ~0x0000007F) | (nwepulse << 0);
+    }
+
+    uint32_t smc_cycle7_get(void)
+    {
+        return this->m_reg[SMC_CYCLE7_INDEX];
+    }
+
+    void smc_cycle7_set(uint32_t value)
+    {
+        this->m_reg[SMC_CYCLE7_INDEX] = value;
+    }
+
+    typedef RegField<SMC_CYCLE7_INDEX, 0x01FF0000, 16> smc_cycle7_nrd_cycle_field;
+    typedef RegField<SMC_CYCLE7_INDEX, 0x000001FF, 0> smc_cycle7_nwe_cycle_field;
+
+    void smc_cycle7_pack(uint16_t nrdcycle, uint16_t nwecycle)
+    {
+        ASSERT_ERR(((nrdcycle << 16) & ~0x01FF0000) == 0);
+        ASSERT_ERR(((nwecycle << 0) & ~0x000001FF) == 0);
+        this->m_reg[SMC_CYCLE7_INDEX] =  (nrdcycle << 16) | (nwecycle << 0);
+    }
+
+    void smc_cycle7_unpack(uint16_t* nrdcycle, uint16_t* nwecycle)
+    {
+        uint32_t localVal = this->m_reg[SMC_CYCLE7_INDEX];
+
+        *nrdcycle = (localVal & 0x01FF0000) >> 16;
+        *nwecycle = (localVal & 0x000001FF) >> 0;
+    }
+
+    uint16_t smc_cycle7_nrd_cycle_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_CYCLE7_INDEX];
+        return ((localVal & 0x01FF0000) >> 16);
+    }
+
+    void smc_cycle7_nrd_cycle_setf(uint16_t nrdcycle)
+    {
+        ASSERT_ERR(((nrdcycle << 16) & ~0x01FF0000) == 0);
+        this->m_reg[SMC_CYCLE7_INDEX] = (this->m_reg[SMC_CYCLE7_INDEX] & ~0x01FF0000) | (nrdcycle << 16);
+    }
+
+    uint16_t smc_cycle7_nwe_cycle_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_CYCLE7_INDEX];
+        return ((localVal & 0x000001FF) >> 0);
+    }
+
+    void smc_cycle7_nwe_cycle_setf(uint16_t nwecycle)
+    {
+        ASSERT_ERR(((nwecycle << 0) & ~0x000001FF) == 0);
+        this->m_reg[SMC_CYCLE7_INDEX] = (this->m_reg[SMC_CYCLE7_INDEX] & ~0x000001FF) | (nwecycle << 0);
+    }
+
+    uint32_t smc_mode7_get(void)
+    {
+        return this->m_reg[SMC_MODE7_INDEX];
+    }
+
+    void smc_mode7_set(uint32_t value)
+    {
+        this->m_reg[SMC_MODE7_INDEX] = value;
+    }
+
+    typedef RegField<SMC_MODE7_INDEX, 0x30000000, 28> smc_mode7_ps_field;
+    typedef RegField<SMC_MODE7_INDEX, 0x01000000, 24> smc_mode7_pmen_field;
+    typedef RegField<SMC_MODE7_INDEX, 0x00100000, 20> smc_mode7_tdf_mode_field;
+    typedef RegField<SMC_MODE7_INDEX, 0x000F0000, 16> smc_mode7_tdf_cycles_field;
+    typedef RegField<SMC_MODE7_INDEX, 0x00003000, 12> smc_mode7_dbw_field;
+    typedef RegField<SMC_MODE7_INDEX, 0x00000100, 8> smc_mode7_bat_field;
+    typedef RegField<SMC_MODE7_INDEX, 0x00000030, 4> smc_mode7_exnw_mode_field;
+    typedef RegField<SMC_MODE7_INDEX, 0x00000002, 1> smc_mode7_write_mode_field;
+    typedef RegField<SMC_MODE7_INDEX, 0x00000001, 0> smc_mode7_read_mode_field;
+
+    void smc_mode7_pack(uint8_t ps, uint8_t pmen, uint8_t tdfmode, uint8_t tdfcycles, uint8_t dbw, uint8_t bat, uint8_t exnwmode, uint8_t writemode, uint8_t readmode)
+    {
+        ASSERT_ERR(((ps << 28) & ~0x30000000) == 0);
+        ASSERT_ERR(((pmen << 24) & ~0x01000000) == 0);
+        ASSERT_ERR(((tdfmode << 20) & ~0x00100000) == 0);
+        ASSERT_ERR(((tdfcycles << 16) & ~0x000F0000) == 0);
+        ASSERT_ERR(((dbw << 12) & ~0x00003000) == 0);
+        ASSERT_ERR(((bat << 8) & ~0x00000100) == 0);
+        ASSERT_ERR(((exnwmode << 4) & ~0x00000030) == 0);
+        ASSERT_ERR(((writemode << 1) & ~0x00000002) == 0);
+        ASSERT_ERR(((readmode << 0) & ~0x00000001) == 0);
+        this->m_reg[SMC_MODE7_INDEX] =  (ps << 28) | (pmen << 24) | (tdfmode << 20) | (tdfcycles << 16) | (dbw << 12) | (bat << 8) | (exnwmode << 4) | (writemode << 1) | (readmode << 0);
+    }
+
+    void smc_mode7_unpack(uint8_t* ps, uint8_t* pmen, uint8_t* tdfmode, uint8_t* tdfcycles, uint8_t* dbw, uint8_t* bat, uint8_t* exnwmode, uint8_t* writemode, uint8_t* readmode)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE7_INDEX];
+
+        *ps = (localVal & 0x30000000) >> 28;
+        *pmen = (localVal & 0x01000000) >> 24;
+        *tdfmode = (localVal & 0x00100000) >> 20;
+        *tdfcycles = (localVal & 0x000F0000) >> 16;
+        *dbw = (localVal & 0x00003000) >> 12;
+        *bat = (localVal & 0x00000100) >> 8;
+        *exnwmode = (localVal & 0x00000030) >> 4;
+        *writemode = (localVal & 0x00000002) >> 1;
+        *readmode = (localVal & 0x00000001) >> 0;
+    }
+
+    uint8_t smc_mode7_ps_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE7_INDEX];
+        return ((localVal & 0x30000000) >> 28);
+    }
+
+    void smc_mode7_ps_setf(uint8_t ps)
+    {
+        ASSERT_ERR(((ps << 28) & ~0x30000000) == 0);
+        this->m_reg[SMC_MODE7_INDEX] = (this->m_reg[SMC_MODE7_INDEX] & ~0x30000000) | (ps << 28);
+    }
+
+    uint8_t smc_mode7_pmen_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE7_INDEX];
+        return ((localVal & 0x01000000) >> 24);
+    }
+
+    void smc_mode7_pmen_setf(uint8_t pmen)
+    {
+        ASSERT_ERR(((pmen << 24) & ~0x01000000) == 0);
+        this->m_reg[SMC_MODE7_INDEX] = (this->m_reg[SMC_MODE7_INDEX] & ~0x01000000) | (pmen << 24);
+    }
+
+    uint8_t smc_mode7_tdf_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE7_INDEX];
+        return ((localVal & 0x00100000) >> 20);
+    }
+
+    void smc_mode7_tdf_mode_setf(uint8_t tdfmode)
+    {
+        ASSERT_ERR(((tdfmode << 20) & ~0x00100000) == 0);
+        this->m_reg[SMC_MODE7_INDEX] = (this->m_reg[SMC_MODE7_INDEX] & ~0x00100000) | (tdfmode << 20);
+    }
+
+    uint8_t smc_mode7_tdf_cycles_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE7_INDEX];
+        return ((localVal & 0x000F0000) >> 16);
+    }
+
+    void smc_mode7_tdf_cycles_setf(uint8_t tdfcycles)
+    {
+        ASSERT_ERR(((tdfcycles << 16) & ~0x000F0000) == 0);
+        this->m_reg[SMC_MODE7_INDEX] = (this->m_reg[SMC_MODE7_INDEX] & ~0x000F0000) | (tdfcycles << 16);
+    }
+
+    uint8_t smc_mode7_dbw_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE7_INDEX];
+        return ((localVal & 0x00003000) >> 12);
+    }
+
+    void smc_mode7_dbw_setf(uint8_t dbw)
+    {
+        ASSERT_ERR(((dbw << 12) & ~0x00003000) == 0);
+        this->m_reg[SMC_MODE7_INDEX] = (this->m_reg[SMC_MODE7_INDEX] & ~0x00003000) | (dbw << 12);
+    }
+
+    uint8_t smc_mode7_bat_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE7_INDEX];
+        return ((localVal & 0x00000100) >> 8);
+    }
+
+    void smc_mode7_bat_setf(uint8_t bat)
+    {
+        ASSERT_ERR(((bat << 8) & ~0x00000100) == 0);
+        this->m_reg[SMC_MODE7_INDEX] = (this->m_reg[SMC_MODE7_INDEX] & ~0x00000100) | (bat << 8);
+    }
+
+    uint8_t smc_mode7_exnw_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE7_INDEX];
+        return ((localVal & 0x00000030) >> 4);
+    }
+
+    void smc_mode7_exnw_mode_setf(uint8_t exnwmode)
+    {
+        ASSERT_ERR(((exnwmode << 4) & ~0x00000030) == 0);
+        this->m_reg[SMC_MODE7_INDEX] = (this->m_reg[SMC_MODE7_INDEX] & ~0x00000030) | (exnwmode << 4);
+    }
+
+    uint8_t smc_mode7_write_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE7_INDEX];
+        return ((localVal & 0x00000002) >> 1);
+    }
+
+    void smc_mode7_write_mode_setf(uint8_t writemode)
+    {
+        ASSERT_ERR(((writemode << 1) & ~0x00000002) == 0);
+        this->m_reg[SMC_MODE7_INDEX] = (this->m_reg[SMC_MODE7_INDEX] & ~0x00000002) | (writemode << 1);
+    }
+
+    uint8_t smc_mode7_read_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SMC_MODE7_INDEX];
+        return ((localVal & 0x00000001) >> 0);
+    }
+
+    void smc_mode7_read_mode_setf(uint8_t readmode)
+    {
+        ASSERT_ERR(((readmode << 0) & ~0x00000001) == 0);
+        this->m_reg[SMC_MODE7_INDEX] = (this->m_reg[SMC_MODE7_INDEX] & ~0x00000001) | (readmode << 0);
+    }
+
+
+protected:
+    /// SMC_SETUP0 register read hook
+    uint32_t
+    smc_setup0_rd()
+    {
+        return this->m_reg[SMC_SETUP0_INDEX];
+    }
+
+    /// SMC_SETUP0 register write hook
+    void
+    smc_setup0_wr(uint32_t value)
+    {
+        this->m_reg[SMC_SETUP0_INDEX] = value;
+    }
+
+    /// SMC_PULSE0 register read hook
+    uint32_t
+    smc_pulse0_rd()
+    {
+        return this->m_reg[SMC_PULSE0_INDEX];
+    }
+
+    /// SMC_PULSE0 register write hook
+    void
+    smc_pulse0_wr(uint32_t value)
+    {
+        this->m_reg[SMC_PULSE0_INDEX] = value;
+    }
+
+    /// SMC_CYCLE0 register read hook
+    uint32_t
+    smc_cycle0_rd()
+    {
+        return this->m_reg[SMC_CYCLE0_INDEX];
+    }
+
+    /// SMC_CYCLE0 register write hook
+    void
+    smc_cycle0_wr(uint32_t value)
+    {
+        this->m_reg[SMC_CYCLE0_INDEX] = value;
+    }
+
+    /// SMC_MODE0 register read hook
+    uint32_t
+    smc_mode0_rd()
+    {
+        return this->m_reg[SMC_MODE0_INDEX];
+    }
+
+    /// SMC_MODE0 register write hook
+    void
+    smc_mode0_wr(uint32_t value)
+    {
+        this->m_reg[SMC_MODE0_INDEX] = value;
+    }
+
+    /// SMC_SETUP1 register read hook
+    uint32_t
+    smc_setup1_rd()
+    {
+        return this->m_reg[SMC_SETUP1_INDEX];
+    }
+
+    /// SMC_SETUP1 register write hook
+    void
+    smc_setup1_wr(uint32_t value)
+    {
+        this->m_reg[SMC_SETUP1_INDEX] = value;
+    }
+
+    /// SMC_PULSE1 register read hook
+    uint32_t
+    smc_pulse1_rd()
+    {
+        return this->m_reg[SMC_PULSE1_INDEX];
+    }
+
+    /// SMC_PULSE1 register write hook
+    void
+    smc_pulse1_wr(uint32_t value)
+    {
+        this->m_reg[SMC_PULSE1_INDEX] = value;
+    }
+
+    /// SMC_CYCLE1 register read hook
+    uint32_t
+    smc_cycle1_rd()
+    {
+        return this->m_reg[SMC_CYCLE1_INDEX];
+    }
+
+    /// SMC_CYCLE1 register write hook
+    void
+    smc_cycle1_wr(uint32_t value)
+    {
+        this->m_reg[SMC_CYCLE1_INDEX] = value;
+    }
+
+    /// SMC_MODE1 register read hook
+    uint32_t
+    smc_mode1_rd()
+    {
+        return this->m_reg[SMC_MODE1_INDEX];
+    }
+
+    /// SMC_MODE1 register write hook
+    void
+    smc_mode1_wr(uint32_t value)
+    {
+        this->m_reg[SMC_MODE1_INDEX] = value;
+    }
+
+    /// SMC_SETUP2 register read hook
+    uint32_t
+    smc_setup2_rd()
+    {
+        return this->m_reg[SMC_SETUP2_INDEX];
+    }
+
+    /// SMC_SETUP2 register write hook
+    void
+    smc_setup2_wr(uint32_t value)
+    {
+        this->m_reg[SMC_SETUP2_INDEX] = value;
+    }
+
+    /// SMC_PULSE2 register read hook
+    uint32_t
+    smc_pulse2_rd()
+    {
+        return this->m_reg[SMC_PULSE2_INDEX];
+    }
+
+    /// SMC_PULSE2 register write hook
+    void
+    smc_pulse2_wr(uint32_t value)
+    {
+        this->m_reg[SMC_PULSE2_INDEX] = value;
+    }
+
+    /// SMC_CYCLE2 register read hook
+    uint32_t
+    smc_cycle2_rd()
+    {
+        return this->m_reg[SMC_CYCLE2_INDEX];
+    }
+
+    /// SMC_CYCLE2 register write hook
+    void
+    smc_cycle2_wr(uint32_t value)
+    {
+        this->m_reg[SMC_CYCLE2_INDEX] = value;
+    }
+
+    /// SMC_MODE2 register read hook
+    uint32_t
+    smc_mode2_rd()
+    {
+        return this->m_reg[SMC_MODE2_INDEX];
+    }
+
+    /// SMC_MODE2 register write hook
+    void
+    smc_mode2_wr(uint32_t value)
+    {
+        this->m_reg[SMC_MODE2_INDEX] = value;
+    }
+
+    /// SMC_SETUP3 register read hook
+    uint32_t
+    smc_setup3_rd()
+    {
+        return this->m_reg[SMC_SETUP3_INDEX];
+    }
+
+    /// SMC_SETUP3 register write hook
+    void
+    smc_setup3_wr(uint32_t value)
+    {
+        this->m_reg[SMC_SETUP3_INDEX] = value;
+    }
+
+    /// SMC_PULSE3 register read hook
+    uint32_t
+    smc_pulse3_rd()
+    {
+        return this->m_reg[SMC_PULSE3_INDEX];
+    }
+
+    /// SMC_PULSE3 register write hook
+    void
+    smc_pulse3_wr(uint32_t value)
+    {
+        this->m_reg[SMC_PULSE3_INDEX] = value;
+    }
+
+    /// SMC_CYCLE3 register read hook
+    uint32_t
+    smc_cycle3_rd()
+    {
+        return this->m_reg[SMC_CYCLE3_INDEX];
+    }
+
+    /// SMC_CYCLE3 register write hook
+    void
+    smc_cycle3_wr(uint32_t value)
+    {
+        this->m_reg[SMC_CYCLE3_INDEX] = value;
+    }
+
+    /// SMC_MODE3 register read hook
+    uint32_t
+    smc_mode3_rd()
+    {
+        return this->m_reg[SMC_MODE3_INDEX];
+    }
+
+    /// SMC_MODE3 register write hook
+    void
+    smc_mode3_wr(uint32_t value)
+    {
+        this->m_reg[SMC_MODE3_INDEX] = value;
+    }
+
+    /// SMC_SETUP4 register read hook
+    uint32_t
+    smc_setup4_rd()
+    {
+        return this->m_reg[SMC_SETUP4_INDEX];
+    }
+
+    /// SMC_SETUP4 register write hook
+    void
+    smc_setup4_wr(uint32_t value)
+    {
+        this->m_reg[SMC_SETUP4_INDEX] = value;
+    }
+
+    /// SMC_PULSE4 register read hook
+    uint32_t
+    smc_pulse4_rd()
+    {
+        return this->m_reg[SMC_PULSE4_INDEX];
+    }
+
+    /// SMC_PULSE4 register write hook
+    void
+    smc_pulse4_wr(uint32_t value)
+    {
+        this->m_reg[SMC_PULSE4_INDEX] = value;
+    }
+
+    /// SMC_CYCLE4 register read hook
+    uint32_t
+    smc_cycle4_rd()
+    {
+        return this->m_reg[SMC_CYCLE4_INDEX];
+    }
+
+    /// SMC_CYCLE4 register write hook
+    void
+    smc_cycle4_wr(uint32_t value)
+    {
+        this->m_reg[SMC_CYCLE4_INDEX] = value;
+    }
+
+    /// SMC_MODE4 register read hook
+    uint32_t
+    smc_mode4_rd()
+    {
+        return this->m_reg[SMC_MODE4_INDEX];
+    }
+
+    /// SMC_MODE4 register write hook
+    void
+    smc_mode4_wr(uint32_t value)
+    {
+        this->m_reg[SMC_MODE4_INDEX] = value;
+    }
+
+    /// SMC_SETUP5 register read hook
+    uint32_t
+    smc_setup5_rd()
+    {
+        return this->m_reg[SMC_SETUP5_INDEX];
+    }
+
+    /// SMC_SETUP5 register write hook
+    void
+    smc_setup5_wr(uint32_t value)
+    {
+        this->m_reg[SMC_SETUP5_INDEX] = value;
+    }
+
+    /// SMC_PULSE5 register read hook
+    uint32_t
+    smc_pulse5_rd()
+    {
+        return this->m_reg[SMC_PULSE5_INDEX];
+    }
+
+    /// SMC_PULSE5 register write hook
+    void
+    smc_pulse5_wr(uint32_t value)
+    {
+        this->m_reg[SMC_PULSE5_INDEX] = value;
+    }
+
+    /// SMC_CYCLE5 register read hook
+    uint32_t
+    smc_cycle5_rd()
+    {
+        return this->m_reg[SMC_CYCLE5_INDEX];
+    }
+
+    /// SMC_CYCLE5 register write hook
+    void
+    smc_cycle5_wr(uint32_t value)
+    {
+        this->m_reg[SMC_CYCLE5_INDEX] = value;
+    }
+
+    /// SMC_MODE5 register read hook
+    uint32_t
+    smc_mode5_rd()
+    {
+        return this->m_reg[SMC_MODE5_INDEX];
+    }
+
+    /// SMC_MODE5 register write hook
+    void
+    smc_mode5_wr(uint32_t value)
+    {
+        this->m_reg[SMC_MODE5_INDEX] = value;
+    }
+
+    /// SMC_SETUP6 register read hook
+    uint32_t
+    smc_setup6_rd()
+    {
+        return this->m_reg[SMC_SETUP6_INDEX];
+    }
+
+    /// SMC_SETUP6 register write hook
+    void
+    smc_setup6_wr(uint32_t value)
+    {
+        this->m_reg[SMC_SETUP6_INDEX] = value;
+    }
+
+    /// SMC_PULSE6 register read hook
+    uint32_t
+    smc_pulse6_rd()
+    {
+        return this->m_reg[SMC_PULSE6_INDEX];
+    }
+
+    /// SMC_PULSE6 register write hook
+    void
+    smc_pulse6_wr(uint32_t value)
+    {
+        this->m_reg[SMC_PULSE6_INDEX] = value;
+    }
+
+    /// SMC_CYCLE6 register read hook
+    uint32_t
+    smc_cycle6_rd()
+    {
+        return this->m_reg[SMC_CYCLE6_INDEX];
+    }
+
+    /// SMC_CYCLE6 register write hook
+    void
+    smc_cycle6_wr(uint32_t value)
+    {
+        this->m_reg[SMC_CYCLE6_INDEX] = value;
+    }
+
+    /// SMC_MODE6 register read hook
+    uint32_t
+    smc_mode6_rd()
+    {
+        return this->m_reg[SMC_MODE6_INDEX];
+    }
+
+    /// SMC_MODE6 register write hook
+    void
+    smc_mode6_wr(uint32_t value)
+    {
+        this->m_reg[SMC_MODE6_INDEX] = value;
+    }
+
+    /// SMC_SETUP7 register read hook
+    uint32_t
+    smc_setup7_rd()
+    {
+        return this->m_reg[SMC_SETUP7_INDEX];
+    }
+
+    /// SMC_SETUP7 register write hook
+    void
+    smc_setup7_wr(uint32_t value)
+    {
+        this->m_reg[SMC_SETUP7_INDEX] = value;
+    }
+
+    /// SMC_PULSE7 register read hook
+    uint32_t
+    smc_pulse7_rd()
+    {
+        return this->m_reg[SMC_PULSE7_INDEX];
+    }
+
+    /// SMC_PULSE7 register write hook
+    void
+    smc_pulse7_wr(uint32_t value)
+    {
+        this->m_reg[SMC_PULSE7_INDEX] = value;
+    }
+
+    /// SMC_CYCLE7 register read hook
+    uint32_t
+    smc_cycle7_rd()
+    {
+        return this->m_reg[SMC_CYCLE7_INDEX];
+    }
+
+    /// SMC_CYCLE7 register write hook
+    void
+    smc_cycle7_wr(uint32_t value)
+    {
+        this->m_reg[SMC_CYCLE7_INDEX] = value;
+    }
+
+    /// SMC_MODE7 register read hook
+    uint32_t
+    smc_mode7_rd()
+    {
+        return this->m_reg[SMC_MODE7_INDEX];
+    }
+
+    /// SMC_MODE7 register write hook
+    void
+    smc_mode7_wr(uint32_t value)
+    {
+        this->m_reg[SMC_MODE7_INDEX] = value;
+    }
+
+    /** Register read function, dispatched to the register hooks of the model
+     * @param[in] offset Offset of the register to access
+     * @return The value read
+     */
+    virtual uint32_t
+    reg_rd(uint32_t offset)
+    {
+        MODEL* model = static_cast<MODEL*>(this);
+        uint32_t index = offset/4;
+
+        // sanity check
+        assert(index < REG_SMC_COUNT);
+
+        // internal delay
+        this->delay();
+
+        switch (index)
+        {
+        case SMC_SETUP0_INDEX:
+            return model->smc_setup0_rd();
+        case SMC_PULSE0_INDEX:
+            return model->smc_pulse0_rd();
+        case SMC_CYCLE0_INDEX:
+            return model->smc_cycle0_rd();
+        case SMC_MODE0_INDEX:
+            return model->smc_mode0_rd();
+        case SMC_SETUP1_INDEX:
+            return model->smc_setup1_rd();
+        case SMC_PULSE1_INDEX:
+            return model->smc_pulse1_rd();
+        case SMC_CYCLE1_INDEX:
+            return model->smc_cycle1_rd();
+        case SMC_MODE1_INDEX:
+            return model->smc_mode1_rd();
+        case SMC_SETUP2_INDEX:
+            return model->smc_setup2_rd();
+        case SMC_PULSE2_INDEX:
+            return model->smc_pulse2_rd();
+        case SMC_CYCLE2_INDEX:
+            return model->smc_cycle2_rd();
+        case SMC_MODE2_INDEX:
+            return model->smc_mode2_rd();
+        case SMC_SETUP3_INDEX:
+            return model->smc_setup3_rd();
+        case SMC_PULSE3_INDEX:
+            return model->smc_pulse3_rd();
+        case SMC_CYCLE3_INDEX:
+            return model->smc_cycle3_rd();
+        case SMC_MODE3_INDEX:
+            return model->smc_mode3_rd();
+        case SMC_SETUP4_INDEX:
+            return model->smc_setup4_rd();
+        case SMC_PULSE4_INDEX:
+            return model->smc_pulse4_rd();
+        case SMC_CYCLE4_INDEX:
+            return model->smc_cycle4_rd();
+        case SMC_MODE4_INDEX:
+            return model->smc_mode4_rd();
+        case SMC_SETUP5_INDEX:
+            return model->smc_setup5_rd();
+        case SMC_PULSE5_INDEX:
+            return model->smc_pulse5_rd();
+        case SMC_CYCLE5_INDEX:
+            return model->smc_cycle5_rd();
+        case SMC_MODE5_INDEX:
+            return model->smc_mode5_rd();
+        case SMC_SETUP6_INDEX:
+            return model->smc_setup6_rd();
+        case SMC_PULSE6_INDEX:
+            return model->smc_pulse6_rd();
+        case SMC_CYCLE6_INDEX:
+            return model->smc_cycle6_rd();
+        case SMC_MODE6_INDEX:
+            return model->smc_mode6_rd();
+        case SMC_SETUP7_INDEX:
+            return model->smc_setup7_rd();
+        case SMC_PULSE7_INDEX:
+            return model->smc_pulse7_rd();
+        case SMC_CYCLE7_INDEX:
+            return model->smc_cycle7_rd();
+        case SMC_MODE7_INDEX:
+            return model->smc_mode7_rd();
+        default:
+            return this->m_reg[index];
+        }
+    }
+
+    /** Register write function, dispatched to the register hooks of the model
+     * @param[in] offset Offset of the register to access
+     * @param[in] value Value to write in the register
+     */
+    virtual void
+    reg_wr(uint32_t offset, uint32_t value)
+    {
+        MODEL* model = static_cast<MODEL*>(this);
+        uint32_t index = offset/4;
+
+        // sanity check
+        assert(index < REG_SMC_COUNT);
+
+        // internal delay
+        this->delay();
+
+        switch (index)
+        {
+        case SMC_SETUP0_INDEX:
+            model->smc_setup0_wr(value);
+            break;
+        case SMC_PULSE0_INDEX:
+            model->smc_pulse0_wr(value);
+            break;
+        case SMC_CYCLE0_INDEX:
+            model->smc_cycle0_wr(value);
+            break;
+        case SMC_MODE0_INDEX:
+            model->smc_mode0_wr(value);
+            break;
+        case SMC_SETUP1_INDEX:
+            model->smc_setup1_wr(value);
+            break;
+        case SMC_PULSE1_INDEX:
+            model->smc_pulse1_wr(value);
+            break;
+        case SMC_CYCLE1_INDEX:
+            model->smc_cycle1_wr(value);
+            break;
+        case SMC_MODE1_INDEX:
+            model->smc_mode1_wr(value);
+            break;
+        case SMC_SETUP2_INDEX:
+            model->smc_setup2_wr(value);
+            break;
+        case SMC_PULSE2_INDEX:
+            model->smc_pulse2_wr(value);
+            break;
+        case SMC_CYCLE2_INDEX:
+            model->smc_cycle2_wr(value);
+            break;
+        case SMC_MODE2_INDEX:
+            model->smc_mode2_wr(value);
+            break;
+        case SMC_SETUP3_INDEX:
+            model->smc_setup3_wr(value);
+            break;
+        case SMC_PULSE3_INDEX:
+            model->smc_pulse3_wr(value);
+            break;
+        case SMC_CYCLE3_INDEX:
+            model->smc_cycle3_wr(value);
+            break;
+        case SMC_MODE3_INDEX:
+            model->smc_mode3_wr(value);
+            break;
+        case SMC_SETUP4_INDEX:
+            model->smc_setup4_wr(value);
+            break;
+        case SMC_PULSE4_INDEX:
+            model->smc_pulse4_wr(value);
+            break;
+        case SMC_CYCLE4_INDEX:
+            model->smc_cycle4_wr(value);
+            break;
+        case SMC_MODE4_INDEX:
+            model->smc_mode4_wr(value);
+            break;
+        case SMC_SETUP5_INDEX:
+            model->smc_setup5_wr(value);
+            break;
+        case SMC_PULSE5_INDEX:
+            model->smc_pulse5_wr(value);
+            break;
+        case SMC_CYCLE5_INDEX:
+            model->smc_cycle5_wr(value);
+            break;
+        case SMC_MODE5_INDEX:
+            model->smc_mode5_wr(value);
+            break;
+        case SMC_SETUP6_INDEX:
+            model->smc_setup6_wr(value);
+            break;
+        case SMC_PULSE6_INDEX:
+            model->smc_pulse6_wr(value);
+            break;
+        case SMC_CYCLE6_INDEX:
+            model->smc_cycle6_wr(value);
+            break;
+        case SMC_MODE6_INDEX:
+            model->smc_mode6_wr(value);
+            break;
+        case SMC_SETUP7_INDEX:
+            model->smc_setup7_wr(value);
+            break;
+        case SMC_PULSE7_INDEX:
+            model->smc_pulse7_wr(value);
+            break;
+        case SMC_CYCLE7_INDEX:
+            model->smc_cycle7_wr(value);
+            break;
+        case SMC_MODE7_INDEX:
+            model->smc_mode7_wr(value);
+            break;
+        default:
+            this->m_reg[index] = value;
+            break;
+        }
+    }
+};
 
 #endif // _REG_SMC_H_
 
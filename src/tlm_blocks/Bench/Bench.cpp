@@ -0,0 +1,535 @@
+#include "Bench.h"
+
+#include "arm7tdmi.h"
+#include "arm920t.h"
+#include "arm926ejs.h"
+
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+
+/// Address of the benchmark peripheral
+#define BENCH_PERIPHERAL_ADDR 0x00020000
+/// Address of the benchmark memory
+#define BENCH_MEMORY_ADDR 0x00010000
+/// Size of each benchmark slave
+#define BENCH_SLAVE_SIZE 0x1000
+
+/// TCP port of the gdb server of the cores
+#define BENCH_GDB_PORT 12345
+
+/// ARM kernel: reset branches to a load, ALU, multiply, store loop at 0x100
+static const uint32_t bench_arm_reset[] = {
+    0xEA00003E      // b       0x100
+};
+static const uint32_t bench_arm_kernel[] = {
+    0xE3A01902,     // mov     r1, #0x8000
+    0xE3A02000,     // mov     r2, #0
+    0xE7913102,     // ldr     r3, [r1, r2, lsl #2]
+    0xE0833002,     // add     r3, r3, r2
+    0xE0040293,     // mul     r4, r3, r2
+    0xE02331A4,     // eor     r3, r3, r4, lsr #3
+    0xE7813102,     // str     r3, [r1, r2, lsl #2]
+    0xE2822001,     // add     r2, r2, #1
+    0xE20220FF,     // and     r2, r2, #0xff
+    0xE3520000,     // cmp     r2, #0
+    0x1AFFFFF6,     // bne     0x108
+    0xEAFFFFF5      // b       0x108
+};
+
+/// Thumb kernel: reset switches to the same loop in Thumb at 0x8
+static const uint32_t bench_thumb_kernel[] = {
+    0xE28F0001,     // add     r0, pc, #1
+    0xE12FFF10,     // bx      r0
+    0x02092180,     // movs    r1, #0x80           lsls    r1, r1, #8
+    0x00952200,     // movs    r2, #0              lsls    r5, r2, #2
+    0x189B594B,     // ldr     r3, [r1, r5]        adds    r3, r3, r2
+    0x43541C1C,     // adds    r4, r3, #0          muls    r4, r2
+    0x406308E4,     // lsrs    r4, r4, #3          eors    r3, r4
+    0x3201514B,     // str     r3, [r1, r5]        adds    r2, #1
+    0x0E120612,     // lsls    r2, r2, #24         lsrs    r2, r2, #24
+    0xE7F2D1F3      // bne     0xe                 b       0xe
+};
+
+/// Cores of the instruction set simulator benchmarks
+static const char* bench_cores[] = {
+    "arm7tdmi",
+    "arm920t",
+    "arm926ejs"
+};
+
+/// State of the gdb client thread
+struct BenchGdbClient
+{
+    /// Number of packets to send
+    uint64_t packets;
+    /// Wall time of the exchanges
+    double seconds;
+    /// Indicates that all the packets were answered
+    bool ok;
+};
+
+/// Get the wall time in seconds
+static double
+bench_wall()
+{
+    struct timeval now;
+
+    gettimeofday(&now, NULL);
+    return now.tv_sec + now.tv_usec / 1e6;
+}
+
+Bench::Bench(sc_core::sc_module_name name, Parameters& parameters, MSP& config)
+: BusMaster(name)
+, interrupt("interrupt")
+, m_iterations(1000000)
+, m_instructions(20000000)
+, m_edges(0)
+{
+    char txt[20];
+
+    // configuration
+    m_output = "bench.csv";
+    if (config.count("output") != 0)
+    {
+        config["output"]->add_path(parameters.configpath);
+        m_output = *config["output"]->get_string();
+    }
+    if (config.count("iterations") != 0)
+    {
+        m_iterations = config["iterations"]->get_int();
+    }
+    if (config.count("instructions") != 0)
+    {
+        m_instructions = config["instructions"]->get_int();
+    }
+
+    // address decoder with the slaves
+    addrdec = new AddrDec("addrdec");
+    this->bind(*addrdec);
+    for (int i = 0; i < BENCH_NUM_SLAVES; i++)
+    {
+        sprintf(txt, "slave%d", i);
+        slave[i] = new BenchSlave(txt, BENCH_SLAVE_SIZE);
+        if (addrdec->bind(*slave[i], i * BENCH_SLAVE_SIZE))
+        {
+            TLM_ERR("slave %d address range wrong", i);
+        }
+    }
+    memory = new Memory("memory", BENCH_SLAVE_SIZE);
+    if (addrdec->bind(*memory, BENCH_MEMORY_ADDR))
+    {
+        TLM_ERR("memory address range wrong");
+    }
+
+    // peripheral: the first half of the registers is served directly
+    peripheral = new Peripheral<16>("peripheral");
+    peripheral->set_reg_access(0, 8, REG_ACCESS_PLAIN);
+    if (addrdec->bind(*peripheral, BENCH_PERIPHERAL_ADDR))
+    {
+        TLM_ERR("peripheral address range wrong");
+    }
+
+    // interrupt line
+    irq.init(this, &Bench::interrupt_set, &Bench::interrupt_clr, NULL);
+    interrupt.bind(irq);
+}
+
+void
+Bench::thread_process()
+{
+    // bus benchmarks
+    this->bench_bus("addrdec_decode", 0, BENCH_SLAVE_SIZE, BENCH_NUM_SLAVES);
+    this->bench_bus("busslave_nowait", 0, 4, BENCH_SLAVE_SIZE / 4);
+    this->bench_bus("busslave_wait", BENCH_MEMORY_ADDR, 4, BENCH_SLAVE_SIZE / 4);
+    this->bench_bus("peripheral_plain", BENCH_PERIPHERAL_ADDR, 4, 8);
+    this->bench_bus("peripheral_model", BENCH_PERIPHERAL_ADDR + 32, 4, 8);
+    this->bench_interrupt();
+
+    // debugger benchmark
+    this->bench_gdb();
+
+    // instruction set simulators benchmarks
+    for (size_t i = 0; i < sizeof(bench_cores) / sizeof(bench_cores[0]); i++)
+    {
+        this->bench_iss(bench_cores[i], false);
+        this->bench_iss(bench_cores[i], true);
+    }
+
+    this->write_results();
+    sc_core::sc_stop();
+}
+
+void
+Bench::bench_bus(const char* name, uint32_t base, uint32_t stride, uint32_t count)
+{
+    uint32_t data = 0;
+    double start;
+
+    start = bench_wall();
+    for (uint64_t i = 0; i < m_iterations; i++)
+    {
+        uint32_t addr = base + (i % count) * stride;
+
+        // alternate the writes and the reads
+        if (i & 1)
+        {
+            TLM_B_RD_WORD(master_socket, master_b_pl, master_b_delay, addr, data);
+            this->annotate();
+        }
+        else
+        {
+            TLM_B_WR_WORD(master_socket, master_b_pl, master_b_delay, addr, data);
+            this->annotate();
+        }
+    }
+    this->sync();
+    this->add_result(name, m_iterations, bench_wall() - start, "trans");
+}
+
+void
+Bench::bench_interrupt()
+{
+    double start;
+
+    m_edges = 0;
+    start = bench_wall();
+    for (uint64_t i = 0; i < m_iterations; i += 2)
+    {
+        interrupt.set();
+        interrupt.clear();
+    }
+    this->add_result("intslave_edge", m_edges, bench_wall() - start, "edges");
+}
+
+void
+Bench::bench_gdb()
+{
+    BenchGdbClient client;
+    pthread_t thread;
+    mmu* core;
+
+    memset(m_ram, 0, sizeof(m_ram));
+    core = this->create_core(bench_cores[0], true);
+
+    client.packets = (m_iterations / 100 > 0) ? m_iterations / 100 : 1;
+    client.seconds = 0;
+    client.ok = false;
+    if (pthread_create(&thread, NULL, &Bench::gdb_client, &client) != 0)
+    {
+        TLM_ERR("can not create the gdb client thread");
+    }
+
+    // the packets are handled until the client disconnects
+    while (!core->checkremote(true))
+    {
+        usleep(100);
+    }
+    pthread_join(thread, NULL);
+    delete core;
+
+    if (!client.ok)
+    {
+        TLM_ERR("gdb packet benchmark failed");
+    }
+    this->add_result("gdb_packet", client.packets, client.seconds, "packets");
+}
+
+void*
+Bench::gdb_client(void* arg)
+{
+    BenchGdbClient* client = (BenchGdbClient*)arg;
+    const char* packet = "$m8000,100#";
+    struct sockaddr_in sockaddr;
+    char buf[1024];
+    int fd, csum, val;
+    double start;
+
+    // read 256 bytes of memory
+    csum = 0;
+    for (const char* p = packet + 1; *p != '#'; p++)
+    {
+        csum += *p;
+    }
+    snprintf(buf, sizeof(buf), "%s%02x", packet, csum & 0xFF);
+    std::string request(buf);
+
+    fd = socket(PF_INET, SOCK_STREAM, 0);
+    if (fd < 0)
+    {
+        return NULL;
+    }
+    val = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, (char*)&val, sizeof(val));
+    memset(&sockaddr, 0, sizeof(sockaddr));
+    sockaddr.sin_family = AF_INET;
+    sockaddr.sin_port = htons(BENCH_GDB_PORT);
+    sockaddr.sin_addr.s_addr = inet_addr("127.0.0.1");
+    if (connect(fd, (struct sockaddr*)&sockaddr, sizeof(sockaddr)) < 0)
+    {
+        close(fd);
+        return NULL;
+    }
+
+    start = bench_wall();
+    for (uint64_t i = 0; i < client->packets; i++)
+    {
+        int trailer = -1;
+
+        if (send(fd, request.c_str(), request.size(), 0) != (ssize_t)request.size())
+        {
+            close(fd);
+            return NULL;
+        }
+
+        // wait for the reply packet (after the acknowledge) and its checksum
+        while (trailer != 0)
+        {
+            int n = recv(fd, buf, sizeof(buf), 0);
+
+            if (n <= 0)
+            {
+                close(fd);
+                return NULL;
+            }
+            for (int j = 0; (j < n) && (trailer != 0); j++)
+            {
+                if (trailer > 0)
+                {
+                    trailer--;
+                }
+                else if (buf[j] == '#')
+                {
+                    trailer = 2;
+                }
+            }
+        }
+        send(fd, "+", 1, 0);
+    }
+    client->seconds = bench_wall() - start;
+    client->ok = true;
+
+    // the server stops handling the packets when the connection is closed
+    close(fd);
+    return NULL;
+}
+
+mmu*
+Bench::create_core(const char* core, bool gdbserver)
+{
+    struct mmu::bus bus;
+
+    bus.obj = (void*)this;
+    bus.rd_l = &rd_l_cb;
+    bus.rd_s = &rd_s_cb;
+    bus.rd_b = &rd_b_cb;
+    bus.wr_l = &wr_l_cb;
+    bus.wr_s = &wr_s_cb;
+    bus.wr_b = &wr_b_cb;
+    bus.gdb_rd = &gdb_rd_cb;
+    bus.gdb_wr = &gdb_wr_cb;
+    bus.exec_cycles = &exec_cycles_cb;
+    bus.wfi = &wfi_cb;
+    bus.exit = &exit_cb;
+
+    if (strcmp(core, "arm7tdmi") == 0)
+    {
+        return new arm7tdmi(&bus, gdbserver, false);
+    }
+    else if (strcmp(core, "arm920t") == 0)
+    {
+        return new arm920t(&bus, gdbserver, false);
+    }
+    else
+    {
+        return new arm926ejs(&bus, gdbserver, false);
+    }
+}
+
+void
+Bench::bench_iss(const char* core, bool thumb)
+{
+    std::string name;
+    double start;
+    mmu* arm;
+
+    // load the kernel
+    memset(m_ram, 0, sizeof(m_ram));
+    if (thumb)
+    {
+        memcpy(m_ram, bench_thumb_kernel, sizeof(bench_thumb_kernel));
+    }
+    else
+    {
+        memcpy(m_ram, bench_arm_reset, sizeof(bench_arm_reset));
+        memcpy(&m_ram[0x100 / 4], bench_arm_kernel, sizeof(bench_arm_kernel));
+    }
+
+    arm = this->create_core(core, false);
+    start = bench_wall();
+    arm->run(m_instructions);
+    name = std::string("iss_") + core + (thumb ? "_thumb" : "_arm");
+    this->add_result(name, m_instructions, bench_wall() - start, "instrs");
+    delete arm;
+}
+
+void
+Bench::add_result(const std::string& name, uint64_t ops, double seconds, const char* unit)
+{
+    Result result;
+
+    result.name = name;
+    result.ops = ops;
+    result.seconds = seconds;
+    result.unit = unit;
+    m_results.push_back(result);
+
+    printf("bench: %-24s %12llu %-7s %10.3f s %14.0f %s/s\n", name.c_str(), (unsigned long long)ops,
+           unit, seconds, (seconds > 0) ? ops / seconds : 0, unit);
+    fflush(stdout);
+}
+
+void
+Bench::write_results()
+{
+    bool json;
+    FILE* fp;
+
+    fp = fopen(m_output.c_str(), "w");
+    if (fp == NULL)
+    {
+        TLM_ERR("can not create bench file %s", m_output.c_str());
+    }
+    json = (m_output.size() >= 5) && (m_output.compare(m_output.size() - 5, 5, ".json") == 0);
+
+    if (json)
+    {
+        fprintf(fp, "{\"benchmarks\": [");
+    }
+    else
+    {
+        fprintf(fp, "benchmark,operations,unit,seconds,per_second\n");
+    }
+    for (size_t i = 0; i < m_results.size(); i++)
+    {
+        const Result& result = m_results[i];
+        double rate = (result.seconds > 0) ? result.ops / result.seconds : 0;
+
+        if (json)
+        {
+            fprintf(fp, "%s\n    {\"name\": \"%s\", \"operations\": %llu, \"unit\": \"%s\", "
+                    "\"seconds\": %.6f, \"per_second\": %.1f}", (i == 0) ? "" : ",",
+                    result.name.c_str(), (unsigned long long)result.ops, result.unit, result.seconds, rate);
+        }
+        else
+        {
+            fprintf(fp, "%s,%llu,%s,%.6f,%.1f\n", result.name.c_str(), (unsigned long long)result.ops,
+                    result.unit, result.seconds, rate);
+        }
+    }
+    if (json)
+    {
+        fprintf(fp, "\n]}\n");
+    }
+    fclose(fp);
+}
+
+void
+Bench::interrupt_set(void* opaque)
+{
+    m_edges++;
+}
+
+void
+Bench::interrupt_clr(void* opaque)
+{
+    m_edges++;
+}
+
+uint32_t
+Bench::rd_l_cb(void* obj, uint32_t addr)
+{
+    Bench* myself = (Bench*)obj;
+    return myself->m_ram[(addr % BENCH_RAM_SIZE) / 4];
+}
+
+uint32_t
+Bench::rd_s_cb(void* obj, uint32_t addr)
+{
+    return (rd_l_cb(obj, addr) >> ((addr & 2) * 8)) & 0xFFFF;
+}
+
+uint32_t
+Bench::rd_b_cb(void* obj, uint32_t addr)
+{
+    return (rd_l_cb(obj, addr) >> ((addr & 3) * 8)) & 0xFF;
+}
+
+void
+Bench::wr_l_cb(void* obj, uint32_t addr, uint32_t data)
+{
+    Bench* myself = (Bench*)obj;
+    myself->m_ram[(addr % BENCH_RAM_SIZE) / 4] = data;
+}
+
+void
+Bench::wr_s_cb(void* obj, uint32_t addr, uint32_t data)
+{
+    Bench* myself = (Bench*)obj;
+    uint32_t* word = &myself->m_ram[(addr % BENCH_RAM_SIZE) / 4];
+    uint32_t shift = (addr & 2) * 8;
+
+    *word = (*word & ~(0xFFFF << shift)) | ((data & 0xFFFF) << shift);
+}
+
+void
+Bench::wr_b_cb(void* obj, uint32_t addr, uint32_t data)
+{
+    Bench* myself = (Bench*)obj;
+    uint32_t* word = &myself->m_ram[(addr % BENCH_RAM_SIZE) / 4];
+    uint32_t shift = (addr & 3) * 8;
+
+    *word = (*word & ~(0xFF << shift)) | ((data & 0xFF) << shift);
+}
+
+int
+Bench::gdb_rd_cb(void* obj, uint64_t addr, uint8_t* dataptr, uint32_t len)
+{
+    for (uint32_t i = 0; i < len; i++)
+    {
+        dataptr[i] = rd_b_cb(obj, addr + i);
+    }
+    return len;
+}
+
+int
+Bench::gdb_wr_cb(void* obj, uint64_t addr, uint8_t* dataptr, uint32_t len)
+{
+    for (uint32_t i = 0; i < len; i++)
+    {
+        wr_b_cb(obj, addr + i, dataptr[i]);
+    }
+    return len;
+}
+
+void
+Bench::exec_cycles_cb(void* obj, int cycles)
+{
+    // the cores run as fast as possible
+}
+
+void
+Bench::wfi_cb(void* obj)
+{
+    // the kernels never wait for an interrupt
+}
+
+void
+Bench::exit_cb(void* obj, int code)
+{
+    // the kernels never exit through the semihosting
+}
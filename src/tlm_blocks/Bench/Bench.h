@@ -0,0 +1,217 @@
+#ifndef BENCH_H_
+#define BENCH_H_
+
+// necessary define for processes in simple_target_socket
+#define SC_INCLUDE_DYNAMIC_PROCESSES
+
+// obvious include
+#include "systemc"
+
+#include <string>
+#include <vector>
+
+// command line parameters
+#include "Parameters.h"
+
+// generic blocks
+#include "Generic/AddrDec/AddrDec.h"
+#include "Generic/BusMaster/BusMaster.h"
+#include "Generic/Memory/Memory.h"
+#include "Generic/Peripheral/Peripheral.h"
+#include "Generic/IntMaster/IntMaster.h"
+#include "Generic/IntSlave/IntSlave.h"
+
+// instruction set simulators
+#include "mmu.h"
+
+/// Number of slaves behind the address decoder of the decode benchmark
+#define BENCH_NUM_SLAVES 8
+
+/// Size of the memory of the instruction set simulator benchmarks
+#define BENCH_RAM_SIZE 65536
+
+/// Slave answering the accesses without waiting (the access time is annotated)
+struct BenchSlave : BusSlave
+{
+    /** Constructor
+     * @param[in] name Name of the module
+     * @param[in] size Size of the slave in bytes
+     */
+    BenchSlave(sc_core::sc_module_name name, uint32_t size)
+    : BusSlave(name, (uint32_t*)calloc(size, 1), size)
+    {
+    }
+
+protected:
+    /// Specific blocking transport method
+    void
+    slave_b_transport(tlm::tlm_generic_payload& trans, sc_core::sc_time& delay)
+    {
+        uint32_t* ptr = reinterpret_cast<uint32_t*>(trans.get_data_ptr());
+        uint32_t index = trans.get_address() / 4;
+
+        if (trans.get_command() == tlm::TLM_READ_COMMAND)
+        {
+            *ptr = m_data[index];
+        }
+        else
+        {
+            m_data[index] = *ptr;
+        }
+        delay += sc_core::sc_time(m_delay, sc_core::SC_NS);
+        trans.set_response_status(tlm::TLM_OK_RESPONSE);
+    }
+};
+
+/** "Bench" platform: micro-benchmarks of the simulator itself.
+ * The benchmarks measure the wall time of:
+ *  - the address decoding of AddrDec, spread over several slaves
+ *  - a BusSlave transaction, with and without wait
+ *  - a Peripheral register access, served directly or through the model
+ *  - an interrupt edge from IntMaster to IntSlave
+ *  - a gdb memory read packet, over the TCP loopback
+ *  - the instruction set simulators (MIPS) of each core, on ARM and Thumb kernels
+ *    (load, store, ALU, multiply and branches loops)
+ *
+ * The platform is configured from the configuration file:
+ * <pre>
+ * platform bench
+ *     output bench.csv
+ *     iterations 1000000
+ *     instructions 20000000
+ * </pre>
+ * where output gives the result file (CSV, or JSON if the name ends with .json),
+ * iterations the number of transactions of the bus benchmarks (and a hundredth of it
+ * for the gdb packets) and instructions the number of instructions executed by each
+ * core.  The results are also printed, and the simulation stops after the benchmarks.
+ */
+struct Bench : BusMaster
+{
+    /** Constructor of the bench platform
+     * @param[in] name Name of the module
+     * @param[in] parameters Command line parameters
+     * @param[in] config Parameters of the current block (and sub-blocks)
+     */
+    Bench(sc_core::sc_module_name name, Parameters& parameters, MSP& config);
+
+    /// Module thread running the benchmarks
+    void
+    thread_process();
+
+    /// Address decoder instance
+    AddrDec* addrdec;
+    /// Slaves without wait
+    BenchSlave* slave[BENCH_NUM_SLAVES];
+    /// Memory, waiting for each access
+    Memory* memory;
+    /// Peripheral instance
+    Peripheral<16>* peripheral;
+    /// Interrupt source
+    IntMaster interrupt;
+    /// Interrupt destination
+    IntSlave<Bench> irq;
+
+private:
+    /// Result of a benchmark
+    struct Result
+    {
+        /// Name of the benchmark
+        std::string name;
+        /// Number of operations
+        uint64_t ops;
+        /// Wall time in seconds
+        double seconds;
+        /// Name of the operations
+        const char* unit;
+    };
+
+    /** Run the bus benchmark on an address range
+     * @param[in] name Name of the benchmark
+     * @param[in] base Base address of the accesses
+     * @param[in] stride Distance between two accesses
+     * @param[in] count Number of distinct addresses
+     */
+    void
+    bench_bus(const char* name, uint32_t base, uint32_t stride, uint32_t count);
+
+    /// Run the interrupt edge benchmark
+    void
+    bench_interrupt();
+
+    /// Run the gdb packet benchmark
+    void
+    bench_gdb();
+
+    /** Run the instruction set simulator benchmark of a core
+     * @param[in] core Name of the core
+     * @param[in] thumb Run the Thumb kernel instead of the ARM kernel
+     */
+    void
+    bench_iss(const char* core, bool thumb);
+
+    /** Create a core running from the benchmark memory
+     * @param[in] core Name of the core
+     * @param[in] gdbserver Enable the gdb server of the core
+     * @return The core instance
+     */
+    mmu*
+    create_core(const char* core, bool gdbserver);
+
+    /** Record the result of a benchmark
+     * @param[in] name Name of the benchmark
+     * @param[in] ops Number of operations
+     * @param[in] seconds Wall time in seconds
+     * @param[in] unit Name of the operations
+     */
+    void
+    add_result(const std::string& name, uint64_t ops, double seconds, const char* unit);
+
+    /// Write the results in the output file
+    void
+    write_results();
+
+    /// Interrupt set handler
+    void
+    interrupt_set(void* opaque);
+
+    /// Interrupt clear handler
+    void
+    interrupt_clr(void* opaque);
+
+    /** Callbacks of the core bus, accessing the benchmark memory
+     * @{
+     */
+    static uint32_t rd_l_cb(void* obj, uint32_t addr);
+    static uint32_t rd_s_cb(void* obj, uint32_t addr);
+    static uint32_t rd_b_cb(void* obj, uint32_t addr);
+    static void wr_l_cb(void* obj, uint32_t addr, uint32_t data);
+    static void wr_s_cb(void* obj, uint32_t addr, uint32_t data);
+    static void wr_b_cb(void* obj, uint32_t addr, uint32_t data);
+    static int gdb_rd_cb(void* obj, uint64_t addr, uint8_t* dataptr, uint32_t len);
+    static int gdb_wr_cb(void* obj, uint64_t addr, uint8_t* dataptr, uint32_t len);
+    static void exec_cycles_cb(void* obj, int cycles);
+    static void wfi_cb(void* obj);
+    static void exit_cb(void* obj, int code);
+    /// @}
+
+    /// Client side of the gdb packet benchmark
+    static void*
+    gdb_client(void* arg);
+
+    /// Result file
+    std::string m_output;
+    /// Number of transactions of the bus benchmarks
+    uint64_t m_iterations;
+    /// Number of instructions of the instruction set simulator benchmarks
+    uint64_t m_instructions;
+
+    /// Memory of the instruction set simulator benchmarks
+    uint32_t m_ram[BENCH_RAM_SIZE / 4];
+    /// Number of interrupt edges received
+    uint64_t m_edges;
+
+    /// Results of the benchmarks
+    std::vector<Result> m_results;
+};
+
+#endif /*BENCH_H_*/
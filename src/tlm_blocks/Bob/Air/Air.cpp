@@ -0,0 +1,179 @@
+#include "Air.h"
+#include "utils.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/// Default synchronization period (one Bluetooth slot) in us
+#define AIR_DEFAULT_LOOKAHEAD 625
+
+std::vector<Air*> Air::s_nodes;
+
+Air::Air(sc_core::sc_module_name name, Parameters& parameters, Parameter& config)
+: sc_core::sc_module(name)
+, m_medium(NULL)
+, m_tail(0)
+, m_lost(0)
+{
+    MSP& options = *config.get_config();
+
+    m_lookahead = sc_core::sc_time(AIR_DEFAULT_LOOKAHEAD, sc_core::SC_US);
+    if (options.count("lookahead") != 0)
+    {
+        if (options["lookahead"]->get_int() <= 0)
+        {
+            TLM_ERR("invalid lookahead %s", options["lookahead"]->c_str());
+        }
+        m_lookahead = sc_core::sc_time(options["lookahead"]->get_int(), sc_core::SC_US);
+    }
+
+    // join the nodes of the medium
+    m_medium = (AirMedium*)m_shm.open(this->name(), "/socemu-air-" + *config.get_string(),
+                                      sizeof(AirMedium), AIR_MAGIC,
+                                      SyncShm::nodes(this->name(), parameters, config));
+    m_node = m_shm.node();
+    m_tail = m_medium->head;
+
+    // the node leaves whatever the way the simulation ends
+    if (s_nodes.empty())
+    {
+        atexit(&Air::close);
+    }
+    s_nodes.push_back(this);
+
+    TLM_DBG("node %d on medium %s", m_node, config.c_str());
+
+    SC_THREAD(thread_process);
+}
+
+void
+Air::transmit(uint32_t channel, const uint8_t* data, uint32_t length, const sc_core::sc_time& duration)
+{
+    uint64_t seq;
+    AirPacket* packet;
+
+    if (length > AIR_MAX_PAYLOAD)
+    {
+        TLM_ERR("packet too long (%d bytes)", length);
+    }
+
+    // reserve an entry, fill it and publish it
+    seq = __sync_fetch_and_add(&m_medium->head, 1);
+    packet = &m_medium->ring[seq & (AIR_RING_SIZE - 1)];
+    packet->seq = 0;
+    __sync_synchronize();
+    packet->start = sc_core::sc_time_stamp().value();
+    packet->duration = duration.value();
+    packet->node = m_node;
+    packet->channel = channel;
+    packet->length = length;
+    memcpy(packet->data, data, length);
+    __sync_synchronize();
+    packet->seq = seq + 1;
+}
+
+void
+Air::collect()
+{
+    uint64_t head = m_medium->head;
+
+    // the oldest packets are overwritten if the node is too late
+    if ((head - m_tail) > AIR_RING_SIZE)
+    {
+        m_lost += head - m_tail - AIR_RING_SIZE;
+        m_tail = head - AIR_RING_SIZE;
+    }
+
+    while (m_tail != head)
+    {
+        AirPacket& packet = m_medium->ring[m_tail & (AIR_RING_SIZE - 1)];
+        uint64_t seq = packet.seq;
+
+        // not yet published: collected at the next call
+        if ((seq == 0) || (seq < m_tail + 1))
+        {
+            break;
+        }
+        if ((seq == m_tail + 1) && (packet.node != m_node))
+        {
+            m_pending.push_back(packet);
+            __sync_synchronize();
+
+            // overwritten while copied
+            if (packet.seq != seq)
+            {
+                m_pending.pop_back();
+                seq = 0;
+            }
+        }
+        if (seq != m_tail + 1)
+        {
+            m_lost++;
+        }
+        m_tail++;
+    }
+}
+
+bool
+Air::receive(uint32_t channel, const sc_core::sc_time& start, const sc_core::sc_time& end,
+             std::vector<uint8_t>& data, sc_core::sc_time& time)
+{
+    std::vector<AirPacket>::iterator it;
+
+    this->collect();
+
+    it = m_pending.begin();
+    while (it != m_pending.end())
+    {
+        // ended before the window: can no longer be received
+        if ((it->start + it->duration) <= start.value())
+        {
+            it = m_pending.erase(it);
+        }
+        else if ((it->channel == channel) && (it->start < end.value()))
+        {
+            data.assign(it->data, it->data + it->length);
+            time = sc_core::sc_time((sc_dt::uint64)it->start, false);
+            m_pending.erase(it);
+            return true;
+        }
+        else
+        {
+            it++;
+        }
+    }
+    return false;
+}
+
+void
+Air::sync()
+{
+    m_shm.sync();
+}
+
+void
+Air::thread_process()
+{
+    while (true)
+    {
+        this->sync();
+        TIMELINE_WAIT(m_lookahead);
+    }
+}
+
+void
+Air::close()
+{
+    for (size_t i = 0; i < s_nodes.size(); i++)
+    {
+        Air* node = s_nodes[i];
+
+        if (node->m_lost != 0)
+        {
+            SYS_DBG(node->name(), "%llu packets lost (node too late)", (unsigned long long)node->m_lost);
+        }
+
+        node->m_shm.close();
+    }
+    s_nodes.clear();
+}
@@ -0,0 +1,162 @@
+#ifndef AIR_H_
+#define AIR_H_
+
+/// Radio medium shared by the platforms of several simulator processes
+
+#include "systemc"
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+// command line parameters
+#include "Parameters.h"
+
+// shared memory of the medium
+#include "SyncShm/SyncShm.h"
+
+/// Number of packets of the medium ring (must be a power of 2)
+#define AIR_RING_SIZE 1024
+
+/// Maximum size of a packet
+#define AIR_MAX_PAYLOAD 1024
+
+/// Magic number of an initialized medium ("AIR1")
+#define AIR_MAGIC 0x41495231
+
+/// Packet sent over the medium
+struct AirPacket
+{
+    /// Sequence number + 1 of the packet in this entry (0 while being written)
+    volatile uint64_t seq;
+    /// Start of the transmission (time resolution units)
+    uint64_t start;
+    /// Duration of the transmission (time resolution units)
+    uint64_t duration;
+    /// Sender node
+    uint32_t node;
+    /// Radio channel
+    uint32_t channel;
+    /// Length of the payload
+    uint32_t length;
+    /// Payload
+    uint8_t data[AIR_MAX_PAYLOAD];
+};
+
+/// Medium content, in the shared memory
+struct AirMedium
+{
+    /// Nodes of the medium
+    SyncShmHeader sync;
+    /// Number of packets sent
+    volatile uint64_t head;
+    /// Last packets sent
+    AirPacket ring[AIR_RING_SIZE];
+};
+
+/** Node on a radio medium shared by several simulator processes.
+ * The packets sent by each node (channel, start time and payload) are published in a
+ * lock-free ring in shared memory, the other nodes receive those overlapping their
+ * receive window on the same channel.
+ *
+ * The simulated times of the nodes are kept together by a conservative synchronization
+ * (see SyncShm): a node only goes past the time T + lookahead once all the other nodes
+ * have reached T,
+ * so all the packets started before T are published. The lookahead defaults to a Bluetooth
+ * slot (625 us): the packets are sent at slot boundaries, so a node never receives a
+ * packet late.
+ *
+ * The packets are sent and received by the Phy of the platform.
+ *
+ * The medium is configured from the platform configuration file:
+ * <pre>
+ * air piconet
+ *     lookahead 625
+ *     nodes 2
+ * </pre>
+ * where the value gives the name of the medium shared by the processes, the optional
+ * lookahead the synchronization period in us and the optional nodes the number of nodes
+ * to wait for before starting (by default, the number of configuration files of the
+ * command line). The nodes leave the medium at exit, the shared memory is removed when the
+ * last one leaves.
+ */
+struct Air : sc_core::sc_module
+{
+    // Module has a thread
+    SC_HAS_PROCESS(Air);
+
+    /** Constructor: join the medium
+     * @param[in] name Name of the module
+     * @param[in] parameters Command line parameters
+     * @param[in] config Air parameter of the configuration file
+     */
+    Air(sc_core::sc_module_name name, Parameters& parameters, Parameter& config);
+
+    /** Send a packet, starting at the current time
+     * @param[in] channel Radio channel
+     * @param[in] data Payload
+     * @param[in] length Length of the payload
+     * @param[in] duration Duration of the transmission
+     */
+    void
+    transmit(uint32_t channel, const uint8_t* data, uint32_t length, const sc_core::sc_time& duration);
+
+    /** Receive a packet sent by another node
+     * The packets older than the window are discarded.
+     * @param[in] channel Radio channel listened
+     * @param[in] start Start of the receive window
+     * @param[in] end End of the receive window (at most the current time)
+     * @param[out] data Payload of the first packet overlapping the window
+     * @param[out] time Start of the transmission of the packet
+     * @return true if a packet was received, false otherwise
+     */
+    bool
+    receive(uint32_t channel, const sc_core::sc_time& start, const sc_core::sc_time& end,
+            std::vector<uint8_t>& data, sc_core::sc_time& time);
+
+    /** Wait for the other nodes to reach the current time
+     * The packets started before the current time are then all published.
+     */
+    void
+    sync();
+
+    /// Leave the medium (at exit)
+    static void
+    close();
+
+private:
+    /// Synchronization thread
+    void
+    thread_process();
+
+    /// Copy the packets published by the other nodes in the pending list
+    void
+    collect();
+
+    /// Node of the platform in the shared memory
+    SyncShm m_shm;
+
+    /// Shared medium
+    AirMedium* m_medium;
+
+    /// Node of this platform
+    uint32_t m_node;
+
+    /// Synchronization period
+    sc_core::sc_time m_lookahead;
+
+    /// Sequence number of the next packet to collect
+    uint64_t m_tail;
+
+    /// Nodes joined by this process (left at exit)
+    static std::vector<Air*> s_nodes;
+
+    /// Number of packets lost (ring overrun)
+    uint64_t m_lost;
+
+    /// Packets of the other nodes not yet received or expired
+    std::vector<AirPacket> m_pending;
+};
+
+#endif /*AIR_H_*/
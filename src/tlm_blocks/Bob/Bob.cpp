@@ -1,5 +1,8 @@
 #include "Bob.h"
 
+// cycles executed by each core before letting the other one run (dual core)
+#define CORE_QUANTUM (1000)
+
 #define ROM_BASE_ADDR (0x00000000)
 #define ROM_SIZE (352*1024)
 
@@ -40,7 +43,7 @@ Bob::Bob(sc_core::sc_module_name name, Parameters& parameters, MSP& config)
     cpu_config = cpu_parameter->get_config();
     
     // create the multi port arbiter
-    this->mpa = new Mpa<2>("mpa");
+    this->mpa = new Mpa<3>("mpa");
 
     // create the address decoder instance
     this->addrdec = new AddrDec("addrdec");
@@ -49,6 +52,24 @@ Bob::Bob(sc_core::sc_module_name name, Parameters& parameters, MSP& config)
     //   - create instance
     this->cpu = new Cpu("cpu", *cpu_parameter->get_string(), parameters, *cpu_config);
 
+    // CPU1:
+    //   - create instance if configured (its own firmware, sharing the bus)
+    this->cpu1 = NULL;
+    if (config.count("cpu1") != 0)
+    {
+        this->cpu1 = new Cpu("cpu1", *config["cpu1"]->get_string(), parameters, *config["cpu1"]->get_config());
+
+        //   - interleave the cores (unless configured)
+        if (this->cpu->get_quantum() == 0)
+        {
+            this->cpu->set_quantum(CORE_QUANTUM);
+        }
+        if (this->cpu1->get_quantum() == 0)
+        {
+            this->cpu1->set_quantum(CORE_QUANTUM);
+        }
+    }
+
     // ROM:
     //   - create the instance
     this->rom = new Rom("rom", ROM_SIZE);
@@ -148,6 +169,8 @@ Bob::Bob(sc_core::sc_module_name name, Parameters& parameters, MSP& config)
         TLM_ERR("PRC address range wrong");
         return;
     }
+    //   - patch the ROM
+    this->prc->set_rom(this->rom, ROM_BASE_ADDR);
 
     // FM:
     //   - create the instance
@@ -189,6 +212,14 @@ Bob::Bob(sc_core::sc_module_name name, Parameters& parameters, MSP& config)
         TLM_ERR("RMP address range wrong");
         return;
     }
+    //   - remap the SRAM at address 0 (boot remap)
+    this->rmp->set_remap(this->addrdec, this->addrdec->add_remap(*this->sram, 0));
+    //   - the PAUSE register gates the clock of the core writing it
+    this->rmp->add_cpu(this->cpu);
+    if (this->cpu1 != NULL)
+    {
+        this->rmp->add_cpu(this->cpu1);
+    }
 
     // WDOG:
     //   - create the instance
@@ -224,16 +255,36 @@ Bob::Bob(sc_core::sc_module_name name, Parameters& parameters, MSP& config)
     }
     this->dmac->set_debug(true);
 
+    // AIR:
+    //   - join the radio medium shared with the other simulations, if any
+    this->air = NULL;
+    if (config.count("air") != 0)
+    {
+        this->air = new Air("air", parameters, *config["air"]);
+    }
+    this->phy->set_air(this->air);
+
     // hook the bus connections
     this->cpu->bind(*this->mpa->get_slave(0));
     this->dmac->bind(*this->mpa->get_slave(1));
+    if (this->cpu1 != NULL)
+    {
+        this->cpu1->bind(*this->mpa->get_slave(2));
+    }
+    else
+    {
+        tlm_utils::simple_initiator_socket<Bob>* dummy_m_socket;
+
+        dummy_m_socket = new tlm_utils::simple_initiator_socket<Bob>("dummy_cpu1_m_socket");
+        dummy_m_socket->bind(*this->mpa->get_slave(2));
+    }
     this->mpa->bind(*this->addrdec);
 
     // hook the interrupts
-    this->dmac->intr.bind(*this->ic->vicintsource[5]);
-    this->timer->t1int.bind(*this->ic->vicintsource[6]);
-    this->timer->t2int.bind(*this->ic->vicintsource[7]);
-    this->wdog->intsource.bind(*this->ic->vicintsource[14]);
+    this->dmac->intr.bind(this->ic->vicintsource[5]);
+    this->timer->t1int.bind(this->ic->vicintsource[6]);
+    this->timer->t2int.bind(this->ic->vicintsource[7]);
+    this->wdog->intsource.bind(this->ic->vicintsource[14]);
     this->ic->fiq.bind(this->cpu->fiq);
     this->ic->irq.bind(this->cpu->irq);
     
@@ -252,6 +303,16 @@ Bob::Bob(sc_core::sc_module_name name, Parameters& parameters, MSP& config)
         dummy_m_socket = new tlm_utils::simple_initiator_socket<Bob>("dummy_irq_m_socket");
         dummy_m_socket->bind(this->cpu->irq);
     }
+    // the second core has no interrupt controller
+    if (this->cpu1 != NULL)
+    {
+        tlm_utils::simple_initiator_socket<Bob>* dummy_m_socket;
+
+        dummy_m_socket = new tlm_utils::simple_initiator_socket<Bob>("dummy_cpu1_fiq_m_socket");
+        dummy_m_socket->bind(this->cpu1->fiq);
+        dummy_m_socket = new tlm_utils::simple_initiator_socket<Bob>("dummy_cpu1_irq_m_socket");
+        dummy_m_socket->bind(this->cpu1->irq);
+    }
 
     // create the module thread
     SC_THREAD(thread_process);
@@ -265,7 +326,7 @@ Bob::thread_process()
         TLM_DBG("tick");
 
         // wait for 1 second
-        sc_core::wait(sc_core::sc_time(50, sc_core::SC_MS));
+        TIMELINE_WAIT(sc_core::sc_time(50, sc_core::SC_MS));
     }
 }
 
@@ -29,6 +29,7 @@
 #include "Bob/Fm/Fm.h"
 #include "Bob/Rmp/Rmp.h"
 #include "Bob/Rf/Rf.h"
+#include "Bob/Air/Air.h"
 
 /// Bob level platform module
 struct Bob : sc_core::sc_module
@@ -40,12 +41,14 @@ struct Bob : sc_core::sc_module
     void
     thread_process();
 
-    /// Multi port arbiter
-    Mpa<2>* mpa;
+    /// Multi port arbiter (application core, DMA controller, radio core)
+    Mpa<3>* mpa;
     /// Address decoder instance pointer
     AddrDec* addrdec;
     /// CPU instance pointer
     Cpu* cpu;
+    /// Second CPU instance pointer (AMP, NULL if not configured)
+    Cpu* cpu1;
     /// ROM instance pointer
     Rom* rom;
     /// SRAM instance pointer
@@ -80,6 +83,8 @@ struct Bob : sc_core::sc_module
     Rf* rf;
     /// DMA controller peripheral
     Pl081* dmac;
+    /// Radio medium shared with other platforms (NULL if not configured)
+    Air* air;
 
     /** Constructor of the top level module
      * @param[in] name Name of the module
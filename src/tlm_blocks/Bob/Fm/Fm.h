@@ -506,6 +506,9 @@ struct Fm : Peripheral<REG_FM_COUNT>
     : Peripheral<REG_FM_COUNT>(name)
     {
         // initialize the registers content
+
+        // all the registers are plain storage
+        this->set_reg_access(0, REG_FM_COUNT, REG_ACCESS_PLAIN);
     }
 
 private:
@@ -1,9 +1,21 @@
 #include "Phy.h"
+#include "Bob/Air/Air.h"
 #include "utils.h"
 
+#include <string.h>
+
 /// Used to select debugging
 #define DEBUG_PHY 0
 
+/// Access code and header of a basic rate packet in us (1 Mbps)
+#define PHY_PACKET_OVERHEAD_US (72 + 54)
+
+/// Default receive window (one slot) in us
+#define PHY_SLOT_US 625
+
+/// Size of the APU FIFO in bytes
+#define PHY_FIFO_SIZE ((REG_PHY_APU_FIFO_RST - REG_PHY_APU_FIFO_BASE) * 4)
+
 // using this namespace to simplify streaming
 using namespace std;
 
@@ -71,7 +83,20 @@ Phy::reg_wr(uint32_t offset, uint32_t value)
         }
         else if (value & 1)
         {
-            m_srievent.notify();
+            TIMELINE_NOTIFY(m_srievent);
+        }
+        m_reg[index] = value;
+        break;
+    case REG_PHY_CR0:
+        // check if it is a start
+        if (m_reg[REG_PHY_CR0] & (PHY_CR0_TX | PHY_CR0_RX))
+        {
+            TLM_DBG("writing to CR0 while radio operation ongoing 0x%x", value);
+        }
+        else if (value & (PHY_CR0_TX | PHY_CR0_RX))
+        {
+            m_reg[REG_PHY_STATUS] &= ~(PHY_STATUS_TX_DONE | PHY_STATUS_RX_DONE | PHY_STATUS_RX_TIMEOUT);
+            TIMELINE_NOTIFY(m_radioevent);
         }
         m_reg[index] = value;
         break;
@@ -87,11 +112,81 @@ Phy::sri_process()
     while (true)
     {
         // wait for an event
-        sc_core::wait(m_srievent);
+        TIMELINE_WAIT(m_srievent);
 
         // wait for some time
-        sc_core::wait(10, sc_core::SC_US);
+        TIMELINE_WAIT(10, sc_core::SC_US);
         m_sriwrite = false;
         m_reg[REG_PHY_DC_SRI_JTAG_ACCESS] &= ~1;
     }
 }
+
+void
+Phy::radio_process()
+{
+    uint8_t* fifo = reinterpret_cast<uint8_t*>(&m_reg[REG_PHY_APU_FIFO_BASE]);
+
+    while (true)
+    {
+        uint32_t channel;
+
+        // wait for an event
+        TIMELINE_WAIT(m_radioevent);
+
+        channel = m_reg[REG_PHY_DC_HOPST] & 0x7F;
+        if (m_reg[REG_PHY_CR0] & PHY_CR0_TX)
+        {
+            uint32_t length = (m_reg[REG_PHY_CR0] >> PHY_CR0_LEN_SHIFT) & PHY_CR0_LEN_MASK;
+            sc_core::sc_time duration;
+
+            // sanity check
+            if ((length > PHY_FIFO_SIZE) || (length > AIR_MAX_PAYLOAD))
+            {
+                TLM_ERR("packet too long (%d bytes)", length);
+            }
+
+            // the packet is on the air for its whole duration
+            duration = sc_core::sc_time(PHY_PACKET_OVERHEAD_US + 8 * length, sc_core::SC_US);
+            PERIPHERAL_DBG("TX channel %d, %d bytes", channel, length);
+            if (m_air != NULL)
+            {
+                m_air->transmit(channel, fifo, length, duration);
+            }
+            TIMELINE_WAIT(duration);
+            m_reg[REG_PHY_STATUS] |= PHY_STATUS_TX_DONE;
+        }
+        else
+        {
+            sc_core::sc_time start = sc_core::sc_time_stamp();
+            uint32_t window = m_reg[REG_PHY_DC_WIN_PKT0];
+            std::vector<uint8_t> data;
+            sc_core::sc_time time;
+
+            // listen until the end of the window
+            TIMELINE_WAIT((window != 0) ? window : PHY_SLOT_US, sc_core::SC_US);
+
+            // all the packets started in the window must be published before receiving
+            if (m_air != NULL)
+            {
+                m_air->sync();
+            }
+            if ((m_air != NULL) &&
+                m_air->receive(channel, start, sc_core::sc_time_stamp(), data, time))
+            {
+                if (data.size() > PHY_FIFO_SIZE)
+                {
+                    data.resize(PHY_FIFO_SIZE);
+                }
+                PERIPHERAL_DBG("RX channel %d, %d bytes", channel, (int)data.size());
+                memcpy(fifo, &data[0], data.size());
+                m_reg[REG_PHY_SR_STATUS0] = data.size();
+                m_reg[REG_PHY_STATUS] |= PHY_STATUS_RX_DONE;
+            }
+            else
+            {
+                m_reg[REG_PHY_STATUS] |= PHY_STATUS_RX_TIMEOUT;
+            }
+        }
+        m_reg[REG_PHY_CR0] &= ~(PHY_CR0_TX | PHY_CR0_RX);
+    }
+}
@@ -5,6 +5,9 @@
 
 #include "Generic/Peripheral/Peripheral.h"
 
+// radio medium shared with the other platforms
+struct Air;
+
 /// Registers definition
 enum
 {
@@ -326,6 +329,27 @@ enum
     REG_PHY_COUNT
 };
 
+/// CR0: start the transmission of the payload in the APU FIFO
+#define PHY_CR0_TX (1 << 0)
+/// CR0: open a receive window
+#define PHY_CR0_RX (1 << 1)
+/// CR0: position of the length of the payload to transmit in bytes
+#define PHY_CR0_LEN_SHIFT 16
+/// CR0: mask of the length of the payload to transmit
+#define PHY_CR0_LEN_MASK 0x7FF
+
+/// STATUS: the transmission is completed
+#define PHY_STATUS_TX_DONE (1 << 0)
+/// STATUS: a packet was received (length in SR_STATUS0, payload in the APU FIFO)
+#define PHY_STATUS_RX_DONE (1 << 1)
+/// STATUS: the receive window ended without packet
+#define PHY_STATUS_RX_TIMEOUT (1 << 2)
+
+/** The baseband datapath is reduced to a packet interface to the radio medium (Air):
+ * writing PHY_CR0_TX in CR0 sends the payload of the APU FIFO on the channel of
+ * DC_HOPST (7 LSBs) and PHY_CR0_RX listens to that channel for DC_WIN_PKT0 us (one
+ * slot if 0). The end of the operations is reported in STATUS.
+ */
 struct Phy : Peripheral<REG_PHY_COUNT>
 {
     // Module has a thread
@@ -334,17 +358,38 @@ struct Phy : Peripheral<REG_PHY_COUNT>
     /// Constructor
     Phy(sc_core::sc_module_name name)
     : Peripheral<REG_PHY_COUNT>(name)
+    , m_air(NULL)
     {
         // initialize the registers content
 
+        // registers are plain storage except the timers and the SRI access
+        this->set_reg_access(0, REG_PHY_COUNT, REG_ACCESS_PLAIN);
+        this->set_reg_access(REG_PHY_DC_NBTC_CLK, REG_ACCESS_SIDE_EFFECT);
+        this->set_reg_access(REG_PHY_DC_NBTC_PCLK, REG_ACCESS_SIDE_EFFECT);
+        this->set_reg_access(REG_PHY_DC_SRI_DS0, REG_ACCESS_SIDE_EFFECT);
+        this->set_reg_access(REG_PHY_DC_SRI_JTAG_ACCESS, REG_ACCESS_SIDE_EFFECT);
+        this->set_reg_access(REG_PHY_CR0, REG_ACCESS_SIDE_EFFECT);
+
         // create the module threads
         SC_THREAD(sri_process);
+        SC_THREAD(radio_process);
+    }
+
+    /** Set the radio medium of the packets
+     * @param[in] air Radio medium (NULL if the platform is alone)
+     */
+    void
+    set_air(Air* air)
+    {
+        m_air = air;
     }
 
 private:
     /// Module threads
     void
     sri_process();
+    void
+    radio_process();
 
     /** Register read function
      * @param[in] offset Offset of the register to read
@@ -365,6 +410,12 @@ private:
 
     /// Event used to wake up the SRI thread
     sc_core::sc_event m_srievent;
+
+    /// Radio medium (NULL if the platform is alone)
+    Air* m_air;
+
+    /// Event used to wake up the radio thread
+    sc_core::sc_event m_radioevent;
 };
 
 #endif /*PHY_H_*/
@@ -59,7 +59,7 @@ Pmu::reg_wr(uint32_t offset, uint32_t value)
         {
             TLM_ERR("Unsupported value in CR_ERR_EN %d", value);
         }
-        m_event.notify();
+        TIMELINE_NOTIFY(m_event);
         break;
     default:
         m_reg[index] = value;
@@ -73,20 +73,20 @@ Pmu::thread_process()
     while (true)
     {
         // wait for an event
-        sc_core::wait(m_event);
+        TIMELINE_WAIT(m_event);
 
         if (m_reg[REG_CR_ERR_EN] == 1)
         {
             // start measurement
             // wait for some time
-            sc_core::wait(10, sc_core::SC_US);
+            TIMELINE_WAIT(10, sc_core::SC_US);
             m_reg[REG_CR_ERR_RESULT] = 1000;
         }
         else if (m_reg[REG_CR_ERR_EN] == 0)
         {
             // prepare for next measurement
             // wait for some time
-            sc_core::wait(10, sc_core::SC_US);
+            TIMELINE_WAIT(10, sc_core::SC_US);
             m_reg[REG_CR_ERR_EN] = 1;
         }
     }
@@ -84,6 +84,10 @@ struct Pmu : Peripheral<REG_PMU_COUNT>
         m_reg[REG_CR_MEM_CTL] = 0x1E;
         m_reg[REG_XTAL_STRAP] = 8 | 0x30 | 0x80;
 
+        // registers are plain storage except the error measurement trigger
+        this->set_reg_access(0, REG_PMU_COUNT, REG_ACCESS_PLAIN);
+        this->set_reg_access(REG_CR_ERR_EN, REG_ACCESS_SIDE_EFFECT);
+
         // create the module thread
         SC_THREAD(thread_process);
     }
@@ -46,8 +46,47 @@ Prc::reg_wr(uint32_t offset, uint32_t value)
     switch (index)
     {
     default:
-        m_reg[index] = value;
+        if (index < REG_PRC_PROTECTION)
+        {
+            uint32_t brk = m_reg[index & ~1];
+
+            // update the words patched by the register pair before and after the write
+            m_reg[index] = value;
+            this->update(brk);
+            this->update(m_reg[index & ~1]);
+        }
+        else
+        {
+            m_reg[index] = value;
+        }
         break;
     }
 }
 
+void
+Prc::update(uint32_t brk)
+{
+    uint32_t offset = (brk & ~3) - m_rom_base;
+
+    // check if the word is in the ROM
+    if ((m_rom == NULL) || (offset >= m_rom->get_size()))
+    {
+        return;
+    }
+
+    // several pairs can patch the same word, the lowest enabled one applies
+    for (uint32_t patch = 0; patch < PRC_NUM_PATCHES; patch++)
+    {
+        uint32_t other = m_reg[REG_PRC_BRK_OUT0 + 2 * patch];
+
+        if (((other & PRC_BRK_ENABLE) != 0) && ((other & ~3) == (brk & ~3)))
+        {
+            PERIPHERAL_DBG("patch %d: 0x%08X = 0x%08X", patch, brk & ~3, m_reg[REG_PRC_PATCH_IN0 + 2 * patch]);
+            m_rom->patch(offset, m_reg[REG_PRC_PATCH_IN0 + 2 * patch]);
+            return;
+        }
+    }
+
+    // no enabled pair left on the word
+    m_rom->unpatch(offset);
+}
@@ -4,6 +4,13 @@
 /// Patch RAM Controller (PRC)
 
 #include "Generic/Peripheral/Peripheral.h"
+#include "Generic/Rom/Rom.h"
+
+/// Number of patches (BRK_OUT / PATCH_IN register pairs)
+#define PRC_NUM_PATCHES (REG_PRC_PROTECTION / 2)
+
+/// Enable bit of the BRK_OUT registers (the other bits give the address of the patched word)
+#define PRC_BRK_ENABLE (1 << 0)
 
 /// Registers definition
 enum
@@ -148,16 +155,49 @@ enum
     REG_PRC_COUNT
 };
 
+/** The PRC replaces words of the ROM: a patch is enabled by writing the address of the
+ * word with PRC_BRK_ENABLE in a BRK_OUT register, the word then reads as the value of
+ * the PATCH_IN register of the pair (the lowest enabled pair if several patch the word).
+ * The patches are installed in the overlay of the Rom.
+ */
 struct Prc : Peripheral<REG_PRC_COUNT>
 {
     /// Constructor
     Prc(sc_core::sc_module_name name)
     : Peripheral<REG_PRC_COUNT>(name)
+    , m_rom(NULL)
+    , m_rom_base(0)
     {
         // initialize the registers content
+
+        // the registers are plain storage, except the patches installed when written
+        this->set_reg_access(0, REG_PRC_COUNT, REG_ACCESS_PLAIN);
+        this->set_reg_access(0, REG_PRC_PROTECTION, REG_ACCESS_RO);
+    }
+
+    /** Set the ROM patched by the controller
+     * @param[in, out] rom ROM to patch
+     * @param[in] base Base address of the ROM in the CPU address space
+     */
+    void
+    set_rom(Rom* rom, uint32_t base)
+    {
+        m_rom = rom;
+        m_rom_base = base;
     }
 
 private:
+    /// Patched ROM (NULL if none)
+    Rom* m_rom;
+    /// Base address of the patched ROM
+    uint32_t m_rom_base;
+
+    /** Update the patch of a ROM word from the enabled register pairs
+     * @param[in] brk BRK_OUT value giving the address of the word
+     */
+    void
+    update(uint32_t brk);
+
     /** Register read function
      * @param[in] offset Offset of the register to read
      * @return The value read
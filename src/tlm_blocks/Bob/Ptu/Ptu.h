@@ -249,6 +249,9 @@ struct Ptu : Peripheral<REG_PTU_COUNT>
     : Peripheral<REG_PTU_COUNT>(name)
     {
         // initialize the registers content
+
+        // all the registers are plain storage
+        this->set_reg_access(0, REG_PTU_COUNT, REG_ACCESS_PLAIN);
     }
 
 protected:
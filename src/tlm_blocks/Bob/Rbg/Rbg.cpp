@@ -43,7 +43,7 @@ Rbg::reg_rd(uint32_t offset)
             return 0;
         }
         // indicate to re-count the bit generation
-        m_event.notify();
+        TIMELINE_NOTIFY(m_event);
         // return a random number from the sequence
         return m_last_random++;
     default:
@@ -83,7 +83,7 @@ Rbg::reg_wr(uint32_t offset, uint32_t value)
             // check if this is an enable command
             if (value & 1)
             {
-                m_event.notify();
+                TIMELINE_NOTIFY(m_event);
             }
         }
         else
@@ -96,7 +96,7 @@ Rbg::reg_wr(uint32_t offset, uint32_t value)
                     TLM_DBG("WARNING: disabling peripheral while count did not reach 32 (0x%X)",
                             GETF(m_reg[REG_RBG_STATUS], 0xFF000000, 24));
                 }
-                m_event.notify();
+                TIMELINE_NOTIFY(m_event);
             }
         }
         m_reg[index] = value;
@@ -114,7 +114,7 @@ Rbg::thread_process()
     {
         // here we should be in disabled
         // wait for the event to start downcounting the warmup time
-        sc_core::wait(m_event);
+        TIMELINE_WAIT(m_event);
 
         // update the register status
         m_reg[REG_RBG_STATUS] = 0x40000;
@@ -122,7 +122,7 @@ Rbg::thread_process()
         // count the warmup time
         while (m_reg[REG_RBG_STATUS] != 0xFFFFF)
         {
-            sc_core::wait(635, sc_core::SC_NS);
+            TIMELINE_WAIT(635, sc_core::SC_NS);
             m_reg[REG_RBG_STATUS]++;
         }
 
@@ -133,11 +133,11 @@ Rbg::thread_process()
             m_reg[REG_RBG_STATUS] = 0xFFFFF;
             while (m_reg[REG_RBG_STATUS] != 0x200FFFFF)
             {
-                sc_core::wait(1, sc_core::SC_US);
+                TIMELINE_WAIT(1, sc_core::SC_US);
                 m_reg[REG_RBG_STATUS] += 0x01000000;
             }
             // wait for an event
-            sc_core::wait(m_event);
+            TIMELINE_WAIT(m_event);
         }
     }
 }
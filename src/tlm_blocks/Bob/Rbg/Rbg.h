@@ -23,6 +23,9 @@ struct Rbg : Peripheral<REG_RBG_COUNT>
     {
         m_last_random = 0;
 
+        // only the status is plain storage
+        this->set_reg_access(REG_RBG_STATUS, REG_ACCESS_PLAIN);
+
         // create the module thread
         SC_THREAD(thread_process);
     }
@@ -438,6 +438,9 @@ struct Rf : Peripheral<REG_RF_COUNT>
     : Peripheral<REG_RF_COUNT>(name)
     {
         // initialize the registers content
+
+        // all the registers are plain storage
+        this->set_reg_access(0, REG_RF_COUNT, REG_ACCESS_PLAIN);
     }
 
 private:
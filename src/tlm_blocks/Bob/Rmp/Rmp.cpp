@@ -36,6 +36,7 @@ Rmp::reg_wr(uint32_t offset, uint32_t value)
 {
     // retrieve the required parameters
     uint32_t index = offset/4;
+    Cpu* cpu;
 
     // sanity check
     assert(index < REG_RMP_COUNT);
@@ -45,9 +46,60 @@ Rmp::reg_wr(uint32_t offset, uint32_t value)
 
     switch (index)
     {
+    case REG_RMP_PAUSE:
+        m_reg[index] = value;
+        // the core clock is gated at the end of the writing instruction, until a wake event
+        cpu = this->writer();
+        if (cpu != NULL)
+        {
+            cpu->pause();
+        }
+        break;
+    case REG_RMP_REMAP:
+        m_reg[index] = value;
+        // the window is switched once the writing access is completed, so that the core can
+        // write its cached window content back to the previous target
+        cpu = this->writer();
+        if (cpu != NULL)
+        {
+            cpu->defer(&Rmp::remap_cb, this);
+        }
+        else
+        {
+            this->remap();
+        }
+        break;
     default:
         m_reg[index] = value;
         break;
     }
 }
 
+void
+Rmp::remap()
+{
+    if (m_addrdec != NULL)
+    {
+        m_addrdec->remap(m_window, (m_reg[REG_RMP_REMAP] & RMP_REMAP_SRAM) != 0);
+    }
+}
+
+void
+Rmp::remap_cb(void* obj)
+{
+    struct Rmp* myself = (struct Rmp*)obj;
+    myself->remap();
+}
+
+Cpu*
+Rmp::writer()
+{
+    for (size_t i = 0; i < m_cpus.size(); i++)
+    {
+        if (m_cpus[i]->current())
+        {
+            return m_cpus[i];
+        }
+    }
+    return NULL;
+}
@@ -4,6 +4,13 @@
 /// Remap and Pause block
 
 #include "Generic/Peripheral/Peripheral.h"
+#include "Generic/AddrDec/AddrDec.h"
+#include "Cpu/Cpu.h"
+
+#include <vector>
+
+/// Remap bit of the REMAP register (SRAM decoded at address 0)
+#define RMP_REMAP_SRAM (1 << 0)
 
 /// Registers definition
 enum
@@ -28,11 +35,62 @@ struct Rmp : Peripheral<REG_RMP_COUNT>
     /// Constructor
     Rmp(sc_core::sc_module_name name)
     : Peripheral<REG_RMP_COUNT>(name)
+    , m_addrdec(NULL)
+    , m_window(-1)
     {
         // initialize the registers content
+
+        // the registers are plain storage, except the pause and remap applied when written
+        this->set_reg_access(0, REG_RMP_COUNT, REG_ACCESS_PLAIN);
+        this->set_reg_access(REG_RMP_PAUSE, REG_ACCESS_RO);
+        this->set_reg_access(REG_RMP_REMAP, REG_ACCESS_RO);
+    }
+
+    /** Set the remap window switched by the REMAP register
+     * @param[in, out] addrdec Address decoder of the window
+     * @param[in] window Window identifier in the address decoder
+     */
+    void
+    set_remap(AddrDec* addrdec, int window)
+    {
+        m_addrdec = addrdec;
+        m_window = window;
+    }
+
+    /** Add a core accessing the registers, paused by the PAUSE register it writes
+     * @param[in, out] cpu Core whose clock is gated
+     */
+    void
+    add_cpu(Cpu* cpu)
+    {
+        m_cpus.push_back(cpu);
     }
 
 private:
+    /// Address decoder of the remap window (NULL if none)
+    AddrDec* m_addrdec;
+    /// Remap window
+    int m_window;
+    /// Cores accessing the registers
+    std::vector<Cpu*> m_cpus;
+
+    /// Switch the remap window as given by the REMAP register
+    void
+    remap();
+
+    /** Callback switching the remap window at the end of the instruction writing REMAP
+     * @warning This function is static because it is used as a callback
+     * @param[in, out] obj Pointer to the instance to use
+     */
+    static void
+    remap_cb(void* obj);
+
+    /** Get the core issuing the current access
+     * @return The core, NULL if the access does not come from a core (debugger)
+     */
+    Cpu*
+    writer();
+
     /** Register read function
      * @param[in] offset Offset of the register to read
      * @return The value read
@@ -26,6 +26,9 @@ struct Rpc : Peripheral<REG_RPC_COUNT>
     : Peripheral<REG_RPC_COUNT>(name)
     {
         // initialize the registers content
+
+        // all the registers are plain storage
+        this->set_reg_access(0, REG_RPC_COUNT, REG_ACCESS_PLAIN);
     }
 
 private:
@@ -1931,7 +1931,7 @@ Arm::irq_s_b_transport(tlm::tlm_generic_payload& trans, sc_core::sc_time& delay)
     {
 //        m_arm->irq_set();
         // notify the interrupt (after setting the interrupt in processor)
-        m_interrupt.notify();
+        TIMELINE_NOTIFY(m_interrupt);
     }
     else
     {
@@ -1957,7 +1957,7 @@ Arm::fiq_s_b_transport(tlm::tlm_generic_payload& trans, sc_core::sc_time& delay)
     {
 //        m_arm->fiq_set();
         // notify the interrupt (after setting the interrupt in arm)
-        m_interrupt.notify();
+        TIMELINE_NOTIFY(m_interrupt);
     }
     else
     {
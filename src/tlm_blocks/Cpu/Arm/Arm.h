@@ -105,6 +105,7 @@ struct Arm : CpuBase
 
         // read the word at the word aligned address
         TLM_B_RD_WORD(master_socket, master_b_pl, master_b_delay, addr & (~3), data);
+        this->annotate();
 
         // check the alignment
         if (addr & 2)
@@ -129,6 +130,7 @@ struct Arm : CpuBase
         ARM_TLM_DBG(3, "rd L addr=0x%08X", addr);
 
         TLM_B_RD_WORD(master_socket, master_b_pl, master_b_delay, addr, data);
+        this->annotate();
 
         ARM_TLM_DBG(2, "rd L addr=0x%08X data=0x%08X", addr, data);
         return data;
@@ -143,6 +145,7 @@ struct Arm : CpuBase
     {
         uint32_t data;
         TLM_B_RD_HALFWORD(master_socket, master_b_pl, master_b_delay, addr, data);
+        this->annotate();
 
         ARM_TLM_DBG(2, "rd H addr=0x%08X data=0x%08X", addr, data);
         return data;
@@ -157,6 +160,7 @@ struct Arm : CpuBase
     {
         uint32_t data;
         TLM_B_RD_BYTE(master_socket, master_b_pl, master_b_delay, addr, data);
+        this->annotate();
 
         ARM_TLM_DBG(2, "rd B addr=0x%08X data=0x%08X", addr, data);
         return data;
@@ -172,6 +176,7 @@ struct Arm : CpuBase
         ARM_TLM_DBG(2, "wr W addr=0x%08X data=0x%08X", addr, data);
 
         TLM_B_WR_WORD(master_socket, master_b_pl, master_b_delay, addr, data);
+        this->annotate();
     }
 
     /** Function to write a short into the system, going through the timing process
@@ -184,6 +189,7 @@ struct Arm : CpuBase
         ARM_TLM_DBG(2, "wr H addr=0x%08X data=0x%08X", addr, data);
 
         TLM_B_WR_HALFWORD(master_socket, master_b_pl, master_b_delay, addr, data);
+        this->annotate();
     }
 
     /** Function to write a byte into the system, going through the timing process
@@ -196,6 +202,7 @@ struct Arm : CpuBase
         ARM_TLM_DBG(2, "wr B addr=0x%08X data=0x%08X", addr, data);
 
         TLM_B_WR_BYTE(master_socket, master_b_pl, master_b_delay, addr, data);
+        this->annotate();
     }
 
 
@@ -209,7 +216,9 @@ struct Arm : CpuBase
 
         // for example, it is possible to wait for the time to execute
         // sc_core::wait(100*cycles, sc_core::SC_NS);
-        return;
+
+        // wait for the time annotated by the accesses of the instruction
+        this->sync();
     }
 
     /// Wait for an interrupt to happen
@@ -223,7 +232,7 @@ struct Arm : CpuBase
         while ((!m_arm->irq_get()) && (!m_arm->fiq_get()))
         {
             // wait for an interrupt (timeout to poll on debugger activity)
-            sc_core::wait(1, sc_core::SC_MS, m_interrupt);
+            TIMELINE_WAIT(1, sc_core::SC_MS, m_interrupt);
 
             // check if there is a remote connection (or a request)
             if (m_arm->checkremote(true))
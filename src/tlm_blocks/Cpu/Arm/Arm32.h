@@ -4,14 +4,16 @@
 #define ARM32_DEBUG_LEVEL 0
 
 
-/// Macro to print debug messages
+/// Macro to print debug messages (the levels above ARM32_DEBUG_LEVEL go to the runtime trace)
 /// @param __l level of debug message (0 means always printed)
 /// @param __f format of the debug string
 /// @param ... variable arguments
 #define ARM32_TLM_DBG(__l, __f, ...)                                                    \
     do {                                                                                \
         if (ARM32_DEBUG_LEVEL >= __l) {                                                 \
-            TLM_DBG(__f, __VA_ARGS__);                                                  \
+            TLM_DBG(__f, ##__VA_ARGS__);                                                \
+        } else {                                                                        \
+            TLM_TRACE(__l, __f, ##__VA_ARGS__);                                         \
         }                                                                               \
     } while (false)
 
@@ -8,8 +8,6 @@
 // using this namespace to simplify streaming
 using namespace std;
 
-uint64_t *g_numinstr;
-
 Cpu::Cpu(sc_core::sc_module_name name, const std::string& cpuname, Parameters& parameters, MSP& config)
 : BusMaster(name)
 {
@@ -17,6 +15,7 @@ Cpu::Cpu(sc_core::sc_module_name name, const std::string& cpuname, Parameters& p
     struct mmu::bus bus;
     Parameter* gdbserver;
     Parameter* elffile;
+    int gdbport;
 
     // sanity check
     if (config.count("gdbserver") != 1)
@@ -37,6 +36,17 @@ Cpu::Cpu(sc_core::sc_module_name name, const std::string& cpuname, Parameters& p
     }
     gdbserver = config["gdbserver"];
 
+    // each core of a platform has its own debugger connection
+    gdbport = ARM_GDB_PORT;
+    if (gdbserver->get_config()->count("port") != 0)
+    {
+        gdbport = (*gdbserver->get_config())["port"]->get_int();
+        if (gdbport <= 0)
+        {
+            TLM_ERR("invalid gdbserver port %s", (*gdbserver->get_config())["port"]->c_str());
+        }
+    }
+
     // only blocking calls supported by IRQ and FIQ sockets
     this->irq.init(this, &Cpu::interrupt_set, &Cpu::interrupt_clr, (void*)0);
     this->fiq.init(this, &Cpu::interrupt_set, &Cpu::interrupt_clr, (void*)1);
@@ -52,24 +62,87 @@ Cpu::Cpu(sc_core::sc_module_name name, const std::string& cpuname, Parameters& p
     bus.gdb_wr = &gdb_wr_cb;
     bus.exec_cycles = &exec_cycles_cb;
     bus.wfi = &wfi_cb;
+    bus.exit = &exit_cb;
 
     TLM_DBG("CPU: gdbserver = %s", gdbserver->get_bool()?"TRUE":"FALSE");
     TLM_DBG("CPU: gdbwait = %s", parameters.gdb_wait.get_bool()?"TRUE":"FALSE");
     if (cpuname == "ARM926EJ-S")
     {
-        m_arm = new arm926ejs(&bus, gdbserver->get_bool(), parameters.gdb_wait.get_bool());
+        m_arm = new arm926ejs(&bus, gdbserver->get_bool(), parameters.gdb_wait.get_bool(), false, gdbport);
     }
     else if (cpuname == "ARM7TDMI")
     {
-        m_arm = new arm7tdmi(&bus, gdbserver->get_bool(), parameters.gdb_wait.get_bool());
+        m_arm = new arm7tdmi(&bus, gdbserver->get_bool(), parameters.gdb_wait.get_bool(), false, gdbport);
     }
     else
     {
         TLM_ERR("Unsupported CPU name(%s)", cpuname.c_str());
     }
 
-    // save the reference to the number of instructions executed
-    g_numinstr = &(m_arm->m_NumInstrs);
+    // core clock, used to account the cycles spent paused
+    m_paused = false;
+    m_accessing = false;
+    m_invalidate = false;
+    m_invalidate_start = 0;
+    m_invalidate_end = 0;
+    m_frequency = 0;
+    m_paused_cycles = 0;
+    if (config.count("frequency") != 0)
+    {
+        m_frequency = config["frequency"]->get_int();
+        if (m_frequency <= 0)
+        {
+            TLM_ERR("invalid frequency %s", config["frequency"]->c_str());
+        }
+    }
+
+    // the cores of a platform are interleaved every quantum of cycles
+    m_quantum = 0;
+    m_quantum_start = 0;
+    if (config.count("quantum") != 0)
+    {
+        if (config["quantum"]->get_int() <= 0)
+        {
+            TLM_ERR("invalid quantum %s", config["quantum"]->c_str());
+        }
+        m_quantum = config["quantum"]->get_int();
+    }
+
+    // report the number of instructions executed
+    Perf::add_instructions(this->name(), &m_arm->m_NumInstrs, &m_paused_cycles);
+
+    // check if the semihosting calls must be executed by the host
+    if (config.count("semihosting") != 0)
+    {
+        m_arm->set_semihosting(config["semihosting"]->get_bool());
+    }
+
+    // check if the firmware must be profiled
+    m_profiler = NULL;
+    if (config.count("profile") != 0)
+    {
+        if (m_elfpath == NULL)
+        {
+            TLM_ERR("profile requires an elffile");
+        }
+        m_profiler = new Profiler(*m_elfpath, parameters, *config["profile"]);
+        m_arm->set_observer(m_profiler, m_profiler->period());
+    }
+
+    // check if the code coverage must be collected
+    m_coverage = NULL;
+    if (config.count("coverage") != 0)
+    {
+        if (m_elfpath == NULL)
+        {
+            TLM_ERR("coverage requires an elffile");
+        }
+        m_coverage = new Coverage(*m_elfpath, parameters, *config["coverage"]);
+        m_arm->set_coverage(m_coverage);
+    }
+
+    // instruction stopping the simulation, if requested on the command line
+    m_stop = RunControl::stop_address(this->name(), m_elfpath);
 
 }
 
@@ -79,6 +152,9 @@ Cpu::thread_process()
     // create an instance of ElfReader
     ElfReader ElfReader;
 
+    // the accesses issued by this thread are the accesses of the core
+    m_process = sc_core::sc_get_current_process_handle();
+
     // check if there was an ELF file specified for this CPU
     if (m_elfpath != NULL)
     {
@@ -95,11 +171,21 @@ Cpu::thread_process()
         }
     }
 
-    // run armulator (should never return)
-    m_arm->run();
+    // run armulator (should never return without a stop condition)
+    if ((RunControl::instructions() == RUN_UNLIMITED) && (m_stop == RUN_NO_ADDRESS))
+    {
+        m_arm->run();
+
+        // should never reach here
+        assert(0);
+    }
 
-    // should never reach here
-    assert(0);
+    // the exit code of a stop address is the first argument of the function
+    if (m_arm->run_until(RunControl::instructions(), m_stop))
+    {
+        RunControl::finish(this->name(), "stop address reached", m_arm->get_reg(0));
+    }
+    RunControl::finish(this->name(), "instruction limit reached", 0);
 }
 
 void
@@ -114,7 +200,7 @@ Cpu::interrupt_set(void* opaque)
         m_arm->fiq_set();
     }
     // notify the interrupt (after setting the interrupt in processor)
-    m_interrupt.notify();
+    TIMELINE_NOTIFY(m_interrupt);
 }
 
 void
@@ -129,7 +215,7 @@ Cpu::interrupt_clr(void* opaque)
         m_arm->fiq_clear();
     }
     // notify the interrupt (after setting the interrupt in processor)
-    m_interrupt.notify();
+    TIMELINE_NOTIFY(m_interrupt);
 }
 
 uint32_t
@@ -202,3 +288,10 @@ Cpu::wfi_cb(void *obj)
     myself->wfi();
 }
 
+void
+Cpu::exit_cb(void *obj, int code)
+{
+    struct Cpu* myself = (struct Cpu*)obj;
+    RunControl::finish(myself->name(), "semihosting exit", code);
+}
+
@@ -9,11 +9,17 @@
 
 // other objects
 #include "mmu.h"
+#include "Profiler/Profiler.h"
+#include "Coverage/Coverage.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
 
 /// debug level
 #define CPU_DEBUG_LEVEL 0
 
-/// Macro to print debug messages
+/// Macro to print debug messages (the levels above CPU_DEBUG_LEVEL go to the runtime trace)
 /// @param __l level of debug message (0 means always printed)
 /// @param __f format of the debug string
 /// @param ... variable arguments
@@ -21,6 +27,8 @@
     do {                                                                                \
         if (CPU_DEBUG_LEVEL >= __l) {                                                   \
             TLM_DBG(__f, ##__VA_ARGS__);                                                \
+        } else {                                                                        \
+            TLM_TRACE(__l, __f, ##__VA_ARGS__);                                         \
         }                                                                               \
     } while (false)
 
@@ -57,7 +65,10 @@ struct Cpu : BusMaster
 
         CPU_TLM_DBG(3, "rd L addr=0x%08X", addr);
 
+        m_accessing = true;
         TLM_B_RD_WORD(master_socket, master_b_pl, master_b_delay, addr, data);
+        m_accessing = false;
+        this->annotate();
 
         CPU_TLM_DBG(2, "rd L addr=0x%08X data=0x%08X", addr, data);
         return data;
@@ -71,7 +82,10 @@ struct Cpu : BusMaster
     rd_s(uint32_t addr)
     {
         uint32_t data;
+        m_accessing = true;
         TLM_B_RD_HALFWORD(master_socket, master_b_pl, master_b_delay, addr, data);
+        m_accessing = false;
+        this->annotate();
 
         CPU_TLM_DBG(2, "rd H addr=0x%08X data=0x%08X", addr, data);
         return data;
@@ -85,7 +99,10 @@ struct Cpu : BusMaster
     rd_b(uint32_t addr)
     {
         uint32_t data;
+        m_accessing = true;
         TLM_B_RD_BYTE(master_socket, master_b_pl, master_b_delay, addr, data);
+        m_accessing = false;
+        this->annotate();
 
         CPU_TLM_DBG(2, "rd B addr=0x%08X data=0x%08X", addr, data);
         return data;
@@ -100,7 +117,13 @@ struct Cpu : BusMaster
     {
         CPU_TLM_DBG(2, "wr W addr=0x%08X data=0x%08X", addr, data);
 
+        m_accessing = true;
         TLM_B_WR_WORD(master_socket, master_b_pl, master_b_delay, addr, data);
+        m_accessing = false;
+        this->annotate();
+
+        // the firmware ends the simulation with the test finished word
+        RunControl::check_write(this->name(), addr, data);
     }
 
     /** Function to write a short into the system, going through the timing process
@@ -112,7 +135,10 @@ struct Cpu : BusMaster
     {
         CPU_TLM_DBG(2, "wr H addr=0x%08X data=0x%08X", addr, data);
 
+        m_accessing = true;
         TLM_B_WR_HALFWORD(master_socket, master_b_pl, master_b_delay, addr, data);
+        m_accessing = false;
+        this->annotate();
     }
 
     /** Function to write a byte into the system, going through the timing process
@@ -124,7 +150,10 @@ struct Cpu : BusMaster
     {
         CPU_TLM_DBG(2, "wr B addr=0x%08X data=0x%08X", addr, data);
 
+        m_accessing = true;
         TLM_B_WR_BYTE(master_socket, master_b_pl, master_b_delay, addr, data);
+        m_accessing = false;
+        this->annotate();
     }
 
     /** Function to make a debug read access into the system
@@ -165,7 +194,74 @@ struct Cpu : BusMaster
 
         // for example, it is possible to wait for the time to execute
         // sc_core::wait(100*cycles, sc_core::SC_NS);
-        return;
+
+        // periodic performance report
+        Perf::poll();
+
+        // wall time limit
+        RunControl::poll();
+
+        // let the other cores of the platform run
+        // (the cycles argument only holds the internal cycles, so that the
+        // instructions without I-cycles, like branches, would never yield)
+        // (the time annotated by the accesses is waited with the quantum, or at once without)
+        if (m_quantum != 0)
+        {
+            if ((uint32_t)(m_arm->get_cycles() - m_quantum_start) >= m_quantum)
+            {
+                this->yield();
+            }
+        }
+        else
+        {
+            this->sync();
+        }
+
+        // apply the requests of the instruction once its accesses are completed
+        if (__builtin_expect(!m_deferred.empty(), 0))
+        {
+            this->run_deferred();
+        }
+        if (__builtin_expect(m_invalidate, 0))
+        {
+            m_invalidate = false;
+            m_arm->mmu_invalidate_phys(m_invalidate_start, m_invalidate_end);
+        }
+
+        // gate the clock once the instruction requesting the pause is completed
+        if (__builtin_expect(m_paused, 0))
+        {
+            this->gate();
+        }
+    }
+
+    /** Drop the content of the system cached by the core (patched or remapped memory)
+     * @param[in] start_range Start address of the memory invalidate command
+     * @param[in] end_range End address of the memory invalidate command
+     */
+    void
+    master_invalidate_direct_mem_ptr(sc_dt::uint64 start_range, sc_dt::uint64 end_range)
+    {
+        CPU_TLM_DBG(1, "invalidate 0x%08llX-0x%08llX", start_range, end_range);
+
+        // the dirty lines are written back through the bus: while an access of the core is
+        // in flight (payload in use), the range is dropped at the end of the instruction
+        if (m_accessing)
+        {
+            if (!m_invalidate)
+            {
+                m_invalidate = true;
+                m_invalidate_start = start_range;
+                m_invalidate_end = end_range;
+            }
+            else
+            {
+                m_invalidate_start = std::min(m_invalidate_start, start_range);
+                m_invalidate_end = std::max(m_invalidate_end, end_range);
+            }
+            return;
+        }
+        m_arm->mmu_invalidate_phys(start_range, end_range);
     }
 
     /// Wait for an interrupt to happen
@@ -174,11 +270,16 @@ struct Cpu : BusMaster
     {
         CPU_TLM_DBG(1, "WFI: enter");
 
+        // catch up with the time annotated by the accesses
+        this->sync();
+
         // check if neither the IRQ nor the FIQ is asserted
         while ((!m_arm->irq_get()) && (!m_arm->fiq_get()))
         {
             // wait for an interrupt (timeout to poll on debugger activity)
-            sc_core::wait(1, sc_core::SC_MS, m_interrupt);
+            TIMELINE_WAIT(1, sc_core::SC_MS, m_interrupt);
+            Perf::poll();
+            RunControl::poll();
 
             // check if there is a remote connection (or a request)
             if (m_arm->checkremote(true))
@@ -194,6 +295,64 @@ struct Cpu : BusMaster
         CPU_TLM_DBG(1, "WFI: exit");
     }
 
+    /** Set the number of cycles executed before letting the other cores run
+     * @param[in] quantum Number of cycles (0 to run until the core waits)
+     */
+    void
+    set_quantum(uint32_t quantum)
+    {
+        m_quantum = quantum;
+    }
+
+    /** Get the number of cycles executed before letting the other cores run
+     * @return The number of cycles (0 if the core runs until it waits)
+     */
+    uint32_t
+    get_quantum(void)
+    {
+        return m_quantum;
+    }
+
+    /** Check if the calling process is the thread of the core (access issued by the core)
+     * @return true if the core thread is running
+     */
+    bool
+    current(void)
+    {
+        return sc_core::sc_get_current_process_handle() == m_process;
+    }
+
+    /** Run a function at the end of the current instruction, once its accesses are completed
+     * @param[in] func Function to call
+     * @param[in, out] obj Pointer passed to the function
+     */
+    void
+    defer(void (*func)(void* obj), void* obj)
+    {
+        m_deferred.push_back(std::make_pair(func, obj));
+    }
+
+    /** Gate the core clock until a wake event (interrupt asserted or wake() called)
+     * @note The clock is gated at the end of the current instruction, so that the bus
+     * access requesting the pause is completed first
+     */
+    void
+    pause(void)
+    {
+        m_paused = true;
+    }
+
+    /// End a pause of the core (wake event of a block other than the interrupts)
+    void
+    wake(void)
+    {
+        if (m_paused)
+        {
+            m_paused = false;
+            TIMELINE_NOTIFY(m_interrupt);
+        }
+    }
+
     /** Callback to read a word from the system, going through timing process
      * @warning This function is static because it is used as a callback
      * @param[in, out] obj Pointer to the instance to use
@@ -285,16 +444,137 @@ struct Cpu : BusMaster
     static void
     wfi_cb(void* obj);
 
+    /** Callback to end the simulation when the firmware exits
+     * @warning This function is static because it is used as a callback
+     * @param[in, out] obj Pointer to the instance to use
+     * @param[in] code Exit code of the firmware
+     */
+    static void
+    exit_cb(void* obj, int code);
+
 private:
     /// ELF file name and path
     std::string* m_elfpath;
 
+    /// Address of the instruction stopping the simulation (RUN_NO_ADDRESS if none)
+    uint32_t m_stop;
+
     /// MMU class (can be any kind of ARM)
     struct mmu* m_arm;
 
+    /// Guest profiler (NULL if not profiled)
+    Profiler* m_profiler;
+
+    /// Code coverage (NULL if not collected)
+    Coverage* m_coverage;
+
     /// Event used to wait for an interrupt
     sc_core::sc_event m_interrupt;
 
+    /// Thread of the core
+    sc_core::sc_process_handle m_process;
+
+    /// Indicates that a bus access of the core is in flight
+    bool m_accessing;
+
+    /// Indicates that a range is invalidated at the end of the instruction
+    bool m_invalidate;
+
+    /// Range invalidated at the end of the instruction
+    sc_dt::uint64 m_invalidate_start, m_invalidate_end;
+
+    /// Functions called at the end of the instruction, with their pointer
+    std::vector<std::pair<void (*)(void*), void*> > m_deferred;
+
+    /// Call the functions deferred to the end of the instruction
+    void
+    run_deferred(void)
+    {
+        std::vector<std::pair<void (*)(void*), void*> > deferred;
+
+        // the functions may defer others
+        deferred.swap(m_deferred);
+        for (size_t i = 0; i < deferred.size(); i++)
+        {
+            deferred[i].first(deferred[i].second);
+        }
+    }
+
+    /// Indicates that the core clock is gated
+    bool m_paused;
+
+    /// Core clock frequency in Hz (0 if not configured, no paused cycles accounted)
+    double m_frequency;
+
+    /// Total time spent paused
+    sc_core::sc_time m_paused_time;
+
+    /// Total core cycles spent paused
+    uint64_t m_paused_cycles;
+
+    /// Number of cycles executed before letting the other cores run (0 if never)
+    uint32_t m_quantum;
+
+    /// Core cycles counter when the core last let the other cores run
+    uint32_t m_quantum_start;
+
+    /// Let the other cores run, for the time of the quantum if the clock is known
+    void
+    yield(void)
+    {
+        uint32_t cycles = m_arm->get_cycles();
+
+        // the time annotated by the accesses of the quantum is waited at once with it
+        if (m_frequency != 0)
+        {
+            TIMELINE_WAIT(sc_core::sc_time((uint32_t)(cycles - m_quantum_start) / m_frequency, sc_core::SC_SEC) + m_annotated);
+        }
+        else
+        {
+            TIMELINE_WAIT(m_annotated);
+        }
+        m_annotated = sc_core::SC_ZERO_TIME;
+        m_quantum_start = cycles;
+    }
+
+    /// Block the core thread until a wake event
+    void
+    gate(void)
+    {
+        // catch up with the time annotated by the accesses (not accounted as paused)
+        this->sync();
+
+        sc_core::sc_time start = sc_core::sc_time_stamp();
+
+        CPU_TLM_DBG(1, "pause: enter");
+
+        // the thread is blocked on the event, the host is not executing anything
+        while (m_paused && (!m_arm->irq_get()) && (!m_arm->fiq_get()))
+        {
+            // wait for a wake event (timeout to poll on debugger activity)
+            TIMELINE_WAIT(1, sc_core::SC_MS, m_interrupt);
+            Perf::poll();
+            RunControl::poll();
+
+            // check if there is a remote connection (or a request)
+            if (m_arm->checkremote(true))
+            {
+                // check if ctrl-c (stop request) was received
+                if (m_arm->checkctrlc())
+                {
+                    // send signal to debugger
+                    m_arm->handlesig(SIGTRAP);
+                }
+            }
+        }
+        m_paused = false;
+
+        // account the gated cycles
+        m_paused_time += sc_core::sc_time_stamp() - start;
+        m_paused_cycles = (uint64_t)(m_paused_time.to_seconds() * m_frequency);
+        CPU_TLM_DBG(1, "pause: exit after %s", (sc_core::sc_time_stamp() - start).to_string().c_str());
+    }
+
     /** Interrupt set handler
      * @param[in] opaque Pointer passed in parameter when registering
      */
@@ -13,14 +13,16 @@
 /// debug level
 #define CPUBASE_DEBUG_LEVEL 0
 
-/// Macro to print debug messages
+/// Macro to print debug messages (the levels above CPUBASE_DEBUG_LEVEL go to the runtime trace)
 /// @param __l level of debug message (0 means always printed)
 /// @param __f format of the debug string
 /// @param ... variable arguments
 #define CPUBASE_TLM_DBG(__l, __f, ...)                                                  \
     do {                                                                                \
         if (CPUBASE_DEBUG_LEVEL >= __l) {                                               \
-            TLM_DBG(__f, __VA_ARGS__);                                                  \
+            TLM_DBG(__f, ##__VA_ARGS__);                                                \
+        } else {                                                                        \
+            TLM_TRACE(__l, __f, ##__VA_ARGS__);                                         \
         }                                                                               \
     } while (false)
 
@@ -222,6 +224,9 @@ struct CpuBase: BusMaster
                 // execute the instruction
                 this->exec_insn(insn);
             }
+
+            // wait for the time annotated by the accesses of the instruction
+            this->sync();
         }
     }
 
@@ -246,12 +251,15 @@ struct CpuBase: BusMaster
 
             addrm = addr & (~3);
             TLM_B_RD_WORD(master_socket, master_b_pl, master_b_delay, addrm, datal);
+            this->annotate();
             TLM_B_RD_WORD(master_socket, master_b_pl, master_b_delay, addrm + 4, datah);
+            this->annotate();
             data = (datah << 16) | (datal >> 16);
         }
         else
         {
             TLM_B_RD_WORD(master_socket, master_b_pl, master_b_delay, addr, data);
+            this->annotate();
         }
 
         CPUBASE_TLM_DBG(2, "rd L unaligned addr=0x%08llX data=0x%08X", addr, data);
@@ -272,6 +280,7 @@ struct CpuBase: BusMaster
         // sanity check: byte aligned accesses not supported
         assert((addr & 3) == 0);
         TLM_B_RD_WORD(master_socket, master_b_pl, master_b_delay, addr, data);
+        this->annotate();
 
         CPUBASE_TLM_DBG(2, "rd L aligned addr=0x%08llX data=0x%08X", addr, data);
         return data;
@@ -287,6 +296,7 @@ struct CpuBase: BusMaster
         CPUBASE_TLM_DBG(2, "wr W addr=0x%08llX data=0x%08X", addr, data);
 
         TLM_B_WR_WORD(master_socket, master_b_pl, master_b_delay, addr, data);
+        this->annotate();
     }
 
     /** Change the program counter location
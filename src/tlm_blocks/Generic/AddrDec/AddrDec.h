@@ -5,23 +5,30 @@
 
 #include "tlm_utils/simple_initiator_socket.h"
 
+#include <vector>
+
 /// debug level
 #define ADDRDEC_DEBUG_LEVEL 0
 
-/// Macro to print debug messages
+/// Macro to print debug messages (the levels above ADDRDEC_DEBUG_LEVEL go to the runtime trace)
 /// @param __l level of debug message (0 means always printed)
 /// @param __f format of the debug string
 /// @param ... variable arguments
 #define ADDRDEC_TLM_DBG(__l, __f, ...)                                                  \
     do {                                                                                \
         if (ADDRDEC_DEBUG_LEVEL >= __l) {                                               \
-            TLM_DBG(__f, __VA_ARGS__);                                                  \
+            TLM_DBG(__f, ##__VA_ARGS__);                                                \
+        } else {                                                                        \
+            TLM_TRACE(__l, __f, ##__VA_ARGS__);                                         \
         }                                                                               \
     } while (false)
 
 
 /** AddrDec model is an address decoder to demux accesses from a single initiator to
  * several slaves
+ *
+ * The slaves can also be reached through remap windows (boot remap): when enabled, a
+ * window decodes its addresses to a slave already bound, hiding the slaves bound there.
  */
 struct AddrDec : BusSlave
 {
@@ -35,7 +42,11 @@ struct AddrDec : BusSlave
     , m_head(NULL)
     , m_mask(mask)
     , m_num_slaves(0)
+    , m_num_remapped(0)
+    , m_transactions(0)
     {
+        Perf::add_transactions(this->name(), &m_transactions);
+        m_heatmap = Heatmap::add_table(this->name());
     }
 
     /** Bind a slave socket to the next available master socket
@@ -58,6 +69,7 @@ struct AddrDec : BusSlave
         new_range = (struct range*)malloc(sizeof(struct range));
         new_range->start = start;
         new_range->end = end;
+        new_range->slave = &slave;
         new_range->master_socket = new tlm_utils::simple_initiator_socket_tagged<AddrDec>("addrdec_m_socket");
 
         // hook the master callbacks
@@ -67,6 +79,14 @@ struct AddrDec : BusSlave
         // hook the slave socket
         new_range->master_socket->bind(slave);
 
+        // count the accesses of the slave (named after its module)
+        if (m_heatmap != NULL)
+        {
+            sc_core::sc_object* parent = slave.get_parent_object();
+            new_range->heat = m_heatmap->add_target((parent != NULL) ? parent->name() : slave.name(),
+                                                    start, end - start);
+        }
+
         // increment the number of slaves
         m_num_slaves++;
 
@@ -88,6 +108,78 @@ struct AddrDec : BusSlave
         return this->bind(slave, start, start + slave.get_size());
     }
 
+    /** Add a remap window to a bound slave (disabled until remap() is called)
+     * @param[in] slave Slave socket already bound
+     * @param[in] start Start address of the window
+     * @param[in] end First address after the window
+     * @param[in] offset Address in the slave of the window start
+     * @return The window identifier, -1 if the slave is not bound
+     */
+    int
+    add_remap(tlm::tlm_target_socket<>& slave, sc_dt::uint64 start, sc_dt::uint64 end,
+              sc_dt::uint64 offset = 0)
+    {
+        struct range* rover;
+        struct remap window;
+
+        // sanity checks
+        assert(start < end);
+        assert((start & (~m_mask)) == 0);
+        assert((end & (~m_mask)) == 0);
+
+        for (rover = m_head; rover != NULL; rover = rover->next)
+        {
+            if (rover->slave == &slave)
+            {
+                window.start = start;
+                window.end = end;
+                window.offset = offset;
+                window.target = rover;
+                window.enabled = false;
+                m_remaps.push_back(window);
+                return m_remaps.size() - 1;
+            }
+        }
+        return -1;
+    }
+
+    /** Add a remap window to a bound simple slave, covering the whole slave
+     * @param[in] slave BusSlave instance already bound
+     * @param[in] start Start address of the window
+     * @return The window identifier, -1 if the slave is not bound
+     */
+    int
+    add_remap(BusSlave& slave, sc_dt::uint64 start)
+    {
+        return this->add_remap(slave, start, start + slave.get_size());
+    }
+
+    /** Enable or disable a remap window at run time
+     * Only the window is invalidated in the initiator (cached content or DMI pointers),
+     * the other ranges are untouched.
+     * @param[in] window Window identifier
+     * @param[in] enable Enable the window if true, disable it otherwise
+     */
+    void
+    remap(int window, bool enable)
+    {
+        struct remap& w = m_remaps[window];
+
+        if (w.enabled == enable)
+        {
+            return;
+        }
+        ADDRDEC_TLM_DBG(1, "remap 0x%08llX-0x%08llX %s", w.start, w.end - 1, enable ? "on" : "off");
+
+        // the initiator drops the window content before the switch (written back to the
+        // previous targets), the switch must not be requested while an access of the
+        // initiator is in flight (the cores delay the invalidation to the end of it)
+        slave_socket->invalidate_direct_mem_ptr(w.start, w.end - 1);
+
+        w.enabled = enable;
+        m_num_remapped += enable ? 1 : -1;
+    }
+
 private:
     /// Array of structures containing the address ranges of the targets
     struct range {
@@ -97,16 +189,46 @@ private:
         sc_dt::uint64 end;
         /// Pointer to the socket allocated for this range access
         tlm_utils::simple_initiator_socket_tagged<AddrDec>* master_socket;
+        /// Slave socket bound
+        tlm::tlm_target_socket<>* slave;
+        /// Target identifier in the access counters
+        int heat;
         /// Pointer to the next slave in the chained list
         struct range* next;
     }* m_head;
 
+    /// Remap window
+    struct remap {
+        /// Start address of the window (included)
+        sc_dt::uint64 start;
+        /// End address of the window (not included)
+        sc_dt::uint64 end;
+        /// Address in the slave of the window start
+        sc_dt::uint64 offset;
+        /// Range of the slave
+        struct range* target;
+        /// Indicates if the window is decoded
+        bool enabled;
+    };
+
+    /// Remap windows
+    std::vector<struct remap> m_remaps;
+
     /// Decoder global address mask
     sc_dt::uint64 m_mask;
 
     /// Number of slave socket connections (equals number of internal master sockets)
     int m_num_slaves;
 
+    /// Number of enabled remap windows
+    int m_num_remapped;
+
+    /// Number of transactions forwarded
+    uint64_t m_transactions;
+
+    /// Access counters of the heatmap (NULL if not configured)
+    HeatmapTable* m_heatmap;
+
     /** slave_socket blocking transport method
      * @param[in, out] trans Transaction payload object, allocated by initiator, filled here
      * @param[in, out] delay Time object, allocated by initiator, filled here
@@ -121,13 +243,15 @@ private:
 
         // forward path
         sc_dt::uint64 address = trans.get_address();
-        struct range* match = this->find_range(address & m_mask);
+        sc_dt::uint64 offset;
+        struct range* match = this->decode(address & m_mask, offset);
 
         // check that the address is correct
         if (match != NULL)
         {
             // modify address within transaction
-            trans.set_address(address - match->start);
+            trans.set_address(offset);
+            m_transactions++;
 
             // mark the bus as busy
             #if BUSSLAVE_DEBUG_LEVEL
@@ -135,7 +259,19 @@ private:
             #endif
 
             // forward transaction to appropriate target
-            (*match->master_socket)->b_transport(trans, delay);
+            if (m_heatmap == NULL)
+            {
+                (*match->master_socket)->b_transport(trans, delay);
+            }
+            else
+            {
+                sc_core::sc_time start = sc_core::sc_time_stamp() + delay;
+
+                (*match->master_socket)->b_transport(trans, delay);
+                m_heatmap->record(m_heatmap->current(), match->heat, offset,
+                                  trans.is_write(), trans.get_data_length(),
+                                  (sc_core::sc_time_stamp() + delay - start).value());
+            }
 
             // replace original address
             trans.set_address(address);
@@ -161,21 +297,29 @@ private:
                              tlm::tlm_dmi& dmi_data)
     {
         sc_dt::uint64 address = trans.get_address();
-        struct range* match = this->find_range(address & m_mask);
+        sc_dt::uint64 offset;
+        struct range* match = this->decode(address & m_mask, offset);
+        sc_dt::uint64 base = (address & m_mask) - offset;
 
         // check address is correct
         if (unlikely(match == NULL))
             return false;
 
-        trans.set_address(address - match->start);
+        trans.set_address(offset);
 
         bool status = (*match->master_socket)->get_direct_mem_ptr(trans, dmi_data);
 
         trans.set_address(address);
 
         // calculate DMI address of target in system address space
-        dmi_data.set_start_address(match->start + dmi_data.get_start_address());
-        dmi_data.set_end_address(match->start + dmi_data.get_end_address());
+        dmi_data.set_start_address(base + dmi_data.get_start_address());
+        dmi_data.set_end_address(base + dmi_data.get_end_address());
+
+        // the pointer must not give access to the memory hidden by a remap window
+        if (unlikely(m_num_remapped != 0))
+        {
+            this->clip_dmi(address & m_mask, dmi_data);
+        }
 
         return status;
     }
@@ -197,16 +341,24 @@ private:
         while (curr_len > 0)
         {
             uint32_t read_len;
+            uint32_t len = curr_len;
+            sc_dt::uint64 offset;
             struct range* match;
 
             // find the next range
-            match = find_range(curr_addr);
+            match = this->decode(curr_addr, offset);
 
             if (likely(match != NULL))
             {
+                // stop at the boundaries of the remap windows
+                if (unlikely(m_num_remapped != 0))
+                {
+                    len = this->window_limit(curr_addr, curr_len);
+                }
+
                 // target was found
-                trans.set_address(curr_addr - match->start);
-                trans.set_data_length(curr_len);
+                trans.set_address(offset);
+                trans.set_data_length(len);
                 trans.set_data_ptr(curr_ptr);
 
                 // Forward debug transaction to appropriate target
@@ -227,6 +379,11 @@ private:
                     read_len = (curr_len < (closest->start - curr_addr))?
                                 curr_len:(closest->start - curr_addr);
                 }
+                // stop at the start of a remap window
+                if (unlikely(m_num_remapped != 0))
+                {
+                    read_len = this->window_limit(curr_addr, read_len);
+                }
                 // set to 0xFF the remaining
                 memset(curr_ptr, 0xFF, read_len);
             }
@@ -279,6 +436,21 @@ private:
 
         // propagate call backward to initiator
         slave_socket->invalidate_direct_mem_ptr(bw_start_range, bw_end_range);
+
+        // and for the enabled remap windows of the slave
+        for (size_t i = 0; i < m_remaps.size(); i++)
+        {
+            const struct remap& w = m_remaps[i];
+            sc_dt::uint64 last = w.offset + (w.end - w.start) - 1;
+
+            if (w.enabled && (w.target == match) && (start_range <= last) && (end_range >= w.offset))
+            {
+                bw_start_range = (start_range > w.offset) ? start_range : w.offset;
+                bw_end_range = (end_range < last) ? end_range : last;
+                slave_socket->invalidate_direct_mem_ptr(w.start + bw_start_range - w.offset,
+                                                        w.start + bw_end_range - w.offset);
+            }
+        }
     }
 
     /** Set a target's address range
@@ -328,6 +500,119 @@ private:
         return false;
     }
 
+    /** Decode an address, in the enabled remap windows first
+     * @param[in] address Input address
+     * @param[out] offset Address in the target
+     * @return The pointer to the range of the target or NULL if not found
+     */
+    inline struct range*
+    decode(sc_dt::uint64 address, sc_dt::uint64& offset)
+    {
+        struct range* match;
+
+        if (unlikely(m_num_remapped != 0))
+        {
+            for (size_t i = 0; i < m_remaps.size(); i++)
+            {
+                const struct remap& w = m_remaps[i];
+
+                if (w.enabled && (address >= w.start) && (address < w.end))
+                {
+                    offset = address - w.start + w.offset;
+                    return w.target;
+                }
+            }
+        }
+
+        match = this->find_range(address);
+        if (match != NULL)
+        {
+            offset = address - match->start;
+        }
+        return match;
+    }
+
+    /** Limit a debug access to the addresses decoded like its start address
+     * The access stops at the end of the enabled remap window it starts in, and at the
+     * start of the next enabled window.
+     * @param[in] address Start address of the access
+     * @param[in] len Length of the access
+     * @return The length up to the first window boundary
+     */
+    uint32_t
+    window_limit(sc_dt::uint64 address, uint32_t len)
+    {
+        for (size_t i = 0; i < m_remaps.size(); i++)
+        {
+            const struct remap& w = m_remaps[i];
+
+            if (!w.enabled)
+            {
+                continue;
+            }
+
+            if ((address >= w.start) && (address < w.end))
+            {
+                // the access is in the window, stop at its end
+                len = ((w.end - address) < len) ? (w.end - address) : len;
+            }
+            else if (w.start > address)
+            {
+                // the window is above the access, stop at its start
+                len = ((w.start - address) < len) ? (w.start - address) : len;
+            }
+        }
+        return len;
+    }
+
+    /** Clip a DMI range to the addresses decoded like the requested one
+     * The range is limited to the enabled remap windows containing the address, and
+     * excludes the other enabled windows.
+     * @param[in] address Address of the DMI request
+     * @param[in, out] dmi_data Direct Memory Interface object, in the system address space
+     */
+    void
+    clip_dmi(sc_dt::uint64 address, tlm::tlm_dmi& dmi_data)
+    {
+        sc_dt::uint64 start = dmi_data.get_start_address();
+        sc_dt::uint64 end = dmi_data.get_end_address();
+
+        for (size_t i = 0; i < m_remaps.size(); i++)
+        {
+            const struct remap& w = m_remaps[i];
+
+            if (!w.enabled)
+            {
+                continue;
+            }
+
+            if ((address >= w.start) && (address < w.end))
+            {
+                // the access is in the window, stay in it
+                start = (start > w.start) ? start : w.start;
+                end = (end < (w.end - 1)) ? end : (w.end - 1);
+            }
+            else if (w.end <= address)
+            {
+                // the window is below the access
+                start = (start > w.end) ? start : w.end;
+            }
+            else
+            {
+                // the window is above the access
+                end = (end < (w.start - 1)) ? end : (w.start - 1);
+            }
+        }
+
+        // the pointer addresses the start of the range
+        if (dmi_data.get_dmi_ptr() != NULL)
+        {
+            dmi_data.set_dmi_ptr(dmi_data.get_dmi_ptr() + (start - dmi_data.get_start_address()));
+        }
+        dmi_data.set_start_address(start);
+        dmi_data.set_end_address(end);
+    }
+
     /** Find the range to which the input address belongs
      * @param[in] address Input address
      * @return The pointer to the found range or NULL if not found
@@ -20,14 +20,16 @@
 /// debug level
 #define BUSMASTER_DEBUG_LEVEL 0
 
-/// Macro to print debug messages
+/// Macro to print debug messages (the levels above BUSMASTER_DEBUG_LEVEL go to the runtime trace)
 /// @param __l level of debug message (0 means always printed)
 /// @param __f format of the debug string
 /// @param ... variable arguments
 #define BUSMASTER_TLM_DBG(__l, __f, ...)                                                \
     do {                                                                                \
         if (BUSMASTER_DEBUG_LEVEL >= __l) {                                             \
-            TLM_DBG(__f, __VA_ARGS__);                                                  \
+            TLM_DBG(__f, ##__VA_ARGS__);                                                \
+        } else {                                                                        \
+            TLM_TRACE(__l, __f, ##__VA_ARGS__);                                         \
         }                                                                               \
     } while (false)
 
@@ -42,6 +44,8 @@ struct BusMaster : sc_core::sc_module
      */
     BusMaster(sc_core::sc_module_name name)
     : master_socket("master_socket")
+    , m_trace_module(Trace::module(this->name()))
+    , m_annotated(sc_core::SC_ZERO_TIME)
     {
         // force the default values of the BUS transaction
         master_b_pl.set_streaming_width(4);
@@ -60,7 +64,7 @@ struct BusMaster : sc_core::sc_module
     thread_process()
     {
         // wait forever
-        sc_core::wait();
+        TIMELINE_WAIT();
     }
 
     /** Bind a slave socket to the local master socket
@@ -101,6 +105,30 @@ protected:
      */
     sc_core::sc_time master_b_delay;
 
+    /// Trace identifier of the module, resolved once for all the trace sites
+    uint16_t m_trace_module;
+
+    /// Delay annotated by the targets of the blocking accesses and not waited yet
+    sc_core::sc_time m_annotated;
+
+    /// Accumulate the delay annotated by the target of the last blocking access
+    void
+    annotate(void)
+    {
+        m_annotated += master_b_delay;
+    }
+
+    /// Wait for the accumulated annotated delay
+    void
+    sync(void)
+    {
+        if (m_annotated != sc_core::SC_ZERO_TIME)
+        {
+            TIMELINE_WAIT(m_annotated);
+            m_annotated = sc_core::SC_ZERO_TIME;
+        }
+    }
+
     /** slave_socket non-blocking forward transport method (default behavior, can be overridden)
      * @param[in, out] trans Transaction payload object, allocated here, filled by target
      * @param[in, out] phase Phase payload object, allocated here
@@ -122,7 +150,7 @@ protected:
     master_invalidate_direct_mem_ptr(sc_dt::uint64 start_range,
                                         sc_dt::uint64 end_range)
     {
-        SC_REPORT_FATAL("TLM-2", "DMI not implemented");
+        // no direct memory pointer is kept, nothing to drop
     }
 
 };
@@ -20,14 +20,16 @@
 /// debug level
 #define BUSMASTERSLAVE_DEBUG_LEVEL 0
 
-/// Macro to print debug messages
+/// Macro to print debug messages (the levels above BUSMASTERSLAVE_DEBUG_LEVEL go to the runtime trace)
 /// @param __l level of debug message (0 means always printed)
 /// @param __f format of the debug string
 /// @param ... variable arguments
 #define BUSMASTERSLAVE_TLM_DBG(__l, __f, ...)                                           \
     do {                                                                                \
         if (BUSMASTERSLAVE_DEBUG_LEVEL >= __l) {                                        \
-            TLM_DBG(__f, __VA_ARGS__);                                                  \
+            TLM_DBG(__f, ##__VA_ARGS__);                                                \
+        } else {                                                                        \
+            TLM_TRACE(__l, __f, ##__VA_ARGS__);                                         \
         }                                                                               \
     } while (false)
 
@@ -114,7 +116,7 @@ protected:
     master_invalidate_direct_mem_ptr(sc_dt::uint64 start_range,
                                      sc_dt::uint64 end_range)
     {
-        SC_REPORT_FATAL("TLM-2", "DMI not implemented");
+        // no direct memory pointer is kept, nothing to drop
     }
 
 };
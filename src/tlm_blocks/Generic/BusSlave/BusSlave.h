@@ -20,14 +20,16 @@
 /// debug level
 #define BUSSLAVE_DEBUG_LEVEL 0
 
-/// Macro to print debug messages
+/// Macro to print debug messages (the levels above BUSSLAVE_DEBUG_LEVEL go to the runtime trace)
 /// @param __l level of debug message (0 means always printed)
 /// @param __f format of the debug string
 /// @param ... variable arguments
 #define BUSSLAVE_TLM_DBG(__l, __f, ...)                                                 \
     do {                                                                                \
         if (BUSSLAVE_DEBUG_LEVEL >= __l) {                                              \
-            TLM_DBG(__f, __VA_ARGS__);                                                  \
+            TLM_DBG(__f, ##__VA_ARGS__);                                                \
+        } else {                                                                        \
+            TLM_TRACE(__l, __f, ##__VA_ARGS__);                                         \
         }                                                                               \
     } while (false)
 
@@ -41,6 +43,7 @@ struct BusSlave : sc_core::sc_module
      */
     BusSlave(sc_core::sc_module_name name, uint32_t* data = NULL, uint32_t size = 0)
     : slave_socket("slave_socket")
+    , m_trace_module(Trace::module(this->name()))
     #if BUSSLAVE_DEBUG_LEVEL
     , m_free(true)
     #endif
@@ -65,7 +68,16 @@ struct BusSlave : sc_core::sc_module
     delay(void)
     {
         // internal delay
-        sc_core::wait(m_delay, sc_core::SC_NS);
+        TIMELINE_WAIT(m_delay, sc_core::SC_NS);
+    }
+
+    /** Annotate the configured time into the delay of a blocking access
+     * @param[in, out] delay Time object of the access, waited by the initiator
+     */
+    void
+    annotate(sc_core::sc_time& delay)
+    {
+        delay += sc_core::sc_time(m_delay, sc_core::SC_NS);
     }
 
     /** Get the internal delay of the module in nanoseconds
@@ -145,6 +157,9 @@ protected:
     /// Internal delay for each operation
     double m_delay;
 
+    /// Trace identifier of the module, resolved once for all the trace sites
+    uint16_t m_trace_module;
+
     // Indicate that device is free for a new request, used for validation
     #if BUSSLAVE_DEBUG_LEVEL
     bool m_free;
@@ -0,0 +1 @@
+#include "Generic/IntLink/IntLink.h"
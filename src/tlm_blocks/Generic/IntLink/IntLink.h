@@ -0,0 +1,113 @@
+#ifndef INTLINK_H_
+#define INTLINK_H_
+
+// with master and slave interrupts
+#include "Generic/IntMaster/IntMaster.h"
+#include "Generic/IntSlave/IntSlave.h"
+
+// the lines go through a link channel
+#include "Link/Link.h"
+
+/** Interrupt line between two platforms simulated by different processes.
+ * The edges of the input are sent to the peer, the edges sent by the peer arrive at their
+ * time (at most one link quantum late). The output is asserted while the input or the
+ * line of the peer is asserted, so a link end can be inserted on a local interrupt line.
+ */
+struct IntLink : sc_core::sc_module
+{
+    // Module has a thread
+    SC_HAS_PROCESS(IntLink);
+
+    /** Constructor
+     * @param[in] name Name of the module
+     * @param[in, out] channel End of the "irq" channel
+     */
+    IntLink(sc_core::sc_module_name name, LinkChannel* channel)
+    : sc_core::sc_module(name)
+    , input(this, &IntLink::input_set, &IntLink::input_clear, NULL)
+    , output("output")
+    , m_channel(channel)
+    , m_local(false)
+    , m_remote(false)
+    {
+        SC_THREAD(thread_process);
+    }
+
+    /// Local line sent to the peer
+    IntSlave<IntLink> input;
+
+    /// Line driven by the peer
+    IntMaster output;
+
+private:
+    /// End of the channel
+    LinkChannel* m_channel;
+
+    /// Level of the input
+    bool m_local;
+
+    /// Level of the line of the peer
+    bool m_remote;
+
+    /// Input assertion callback
+    void
+    input_set(void* opaque)
+    {
+        m_local = true;
+        m_channel->send(1);
+        this->update();
+    }
+
+    /// Input de-assertion callback
+    void
+    input_clear(void* opaque)
+    {
+        m_local = false;
+        m_channel->send(0);
+        this->update();
+    }
+
+    /// Drive the output from the input and the line of the peer
+    void
+    update()
+    {
+        if (m_local || m_remote)
+        {
+            this->output.set();
+        }
+        else
+        {
+            this->output.clear();
+        }
+    }
+
+    /// Module thread: apply the edges sent by the peer
+    void
+    thread_process()
+    {
+        sc_core::sc_time time;
+        uint32_t level;
+
+        while (true)
+        {
+            while (m_channel->receive(level))
+            {
+                m_remote = (level != 0);
+                this->update();
+            }
+
+            // wait for the next edge, or poll the peer again at the next synchronization
+            if (m_channel->pending(time) && (time > sc_core::sc_time_stamp()) &&
+                ((time - sc_core::sc_time_stamp()) < Link::quantum()))
+            {
+                TIMELINE_WAIT(time - sc_core::sc_time_stamp());
+            }
+            else
+            {
+                TIMELINE_WAIT(Link::quantum());
+            }
+        }
+    }
+};
+
+#endif /*INTLINK_H_*/
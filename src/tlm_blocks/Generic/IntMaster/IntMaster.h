@@ -15,6 +15,12 @@
 // for the helper macros
 #include "utils.h"
 
+// for the direct call interface
+#include "Generic/IntSlave/IntSlave.h"
+
+/// Set to 0 to force all the interrupt edges through the TLM-2 payload (compatibility)
+#define INTMASTER_DIRECT_CALL 1
+
 struct IntMaster : sc_core::sc_module
 {
     /** Constructor
@@ -22,6 +28,8 @@ struct IntMaster : sc_core::sc_module
     */
     IntMaster(sc_core::sc_module_name name)
     : master_socket("int_master")
+    , m_slave(NULL)
+    , m_state(false)
     {
         // force the default values of the BUS transaction
         master_b_pl.set_streaming_width(4);
@@ -32,18 +40,53 @@ struct IntMaster : sc_core::sc_module
         master_socket.register_invalidate_direct_mem_ptr(this, &IntMaster::master_invalidate_direct_mem_ptr);
     }
 
-    /// Assert the interrupt
+    /// Assert the interrupt (nothing is sent if already asserted)
     void
     set()
     {
-        TLM_INT_SET(master_socket, master_b_pl, master_b_delay);
+        if (m_state)
+        {
+            return;
+        }
+        m_state = true;
+
+        if (m_slave != NULL)
+        {
+            m_slave->int_set();
+        }
+        else
+        {
+            TLM_INT_SET(master_socket, master_b_pl, master_b_delay);
+        }
     }
 
-    /// De-assert the interrupt
+    /// De-assert the interrupt (nothing is sent if already de-asserted)
     void
     clear()
     {
-        TLM_INT_CLR(master_socket, master_b_pl, master_b_delay);
+        if (!m_state)
+        {
+            return;
+        }
+        m_state = false;
+
+        if (m_slave != NULL)
+        {
+            m_slave->int_clear();
+        }
+        else
+        {
+            TLM_INT_CLR(master_socket, master_b_pl, master_b_delay);
+        }
+    }
+
+    /** Get the current interrupt state
+     * @return True if interrupt is set, false otherwise
+     */
+    bool
+    get_state()
+    {
+        return m_state;
     }
 
     /** Bind a slave socket to the local master socket
@@ -56,6 +99,22 @@ struct IntMaster : sc_core::sc_module
         this->master_socket.bind(slave_socket);
     }
 
+    /** Bind an interrupt slave to the local master, edges are then delivered by
+     * direct call instead of TLM-2 transactions
+     * @param[in, out] slave Interrupt slave to bind to the master
+     */
+    void
+    bind(IntSlaveIf& slave)
+    {
+        // hook the slave socket anyway so that both sides are seen as bound
+        this->master_socket.bind(slave.int_socket());
+
+#if INTMASTER_DIRECT_CALL
+        // and keep the slave to bypass the payload
+        m_slave = &slave;
+#endif
+    }
+
 protected:
     /// TLM-2 master socket, defaults to 32-bits wide, base protocol
     tlm_utils::simple_initiator_socket<IntMaster> master_socket;
@@ -74,6 +133,12 @@ protected:
      */
     sc_core::sc_time master_b_delay;
 
+    /// Interrupt slave called directly (NULL if the edges go through the socket)
+    IntSlaveIf* m_slave;
+
+    /// Current state of the interrupt line
+    bool m_state;
+
     /** slave_socket non-blocking forward transport method (default behavior, can be overridden)
      * @param[in, out] trans Transaction payload object, allocated here, filled by target
      * @param[in, out] phase Phase payload object, allocated here
@@ -6,6 +6,10 @@
 // not so obvious inclusions
 #include "tlm_utils/simple_target_socket.h"
 
+// with master and slave interrupts
+#include "Generic/IntMaster/IntMaster.h"
+#include "Generic/IntSlave/IntSlave.h"
+
 /// Class to OR several interrupts into a single one
 struct IntOr: BusMaster
 {
@@ -15,6 +19,7 @@ struct IntOr: BusMaster
     IntOr(sc_core::sc_module_name name)
     : BusMaster(name)
     , m_or(0)
+    , m_out(false)
     , m_master_num(0)
     {
     }
@@ -34,27 +39,8 @@ struct IntOr: BusMaster
         // fetch the required values
         uint32_t* ptr = reinterpret_cast<uint32_t*>((trans).get_data_ptr());
 
-        // check if it is an interrupt set
-        if (*ptr == 1)
-        {
-            // set the bit in the mask
-            m_or |= (1 << id);
-        }
-        else
-        {
-            // clear the bit in the mask
-            m_or &= ~(1 << id);
-        }
-
-        // set or clear the interrupt
-        if (m_or != 0)
-        {
-            TLM_INT_SET(master_socket, master_b_pl, master_b_delay);
-        }
-        else
-        {
-            TLM_INT_CLR(master_socket, master_b_pl, master_b_delay);
-        }
+        // update the output
+        this->update(id, *ptr == 1);
 
         // mark the transaction correctly handled
         trans.set_response_status(tlm::TLM_OK_RESPONSE);
@@ -86,9 +72,88 @@ struct IntOr: BusMaster
         m_master_num++;
     }
 
+    /** Add a new interrupt master to OR in the output master_socket of the IntOr,
+     * the edges of this master are received by direct call
+     * @param[in, out] master Interrupt master to OR with other masters
+     */
+    void
+    add(IntMaster& master)
+    {
+        IntSlave<IntOr>* int_slave;
+
+        // sanity check
+        assert(m_master_num < 32);
+
+        // create the interrupt slave dynamically
+        int_slave = new IntSlave<IntOr>(this, &IntOr::int_set, &IntOr::int_clr,
+                                        (void*)(intptr_t)m_master_num);
+
+        // hook the master
+        master.bind(*int_slave);
+
+        // increment the number of masters
+        m_master_num++;
+    }
+
 protected:
+    /** Update one input line and propagate the output if it changed
+     * @param[in] id Number of the input line
+     * @param[in] state New state of the input line
+     */
+    void
+    update(int id, bool state)
+    {
+        if (state)
+        {
+            // set the bit in the mask
+            m_or |= (1 << id);
+        }
+        else
+        {
+            // clear the bit in the mask
+            m_or &= ~(1 << id);
+        }
+
+        // only forward the edges of the output
+        if ((m_or != 0) == m_out)
+        {
+            return;
+        }
+        m_out = (m_or != 0);
+
+        // set or clear the interrupt
+        if (m_out)
+        {
+            TLM_INT_SET(master_socket, master_b_pl, master_b_delay);
+        }
+        else
+        {
+            TLM_INT_CLR(master_socket, master_b_pl, master_b_delay);
+        }
+    }
+
+    /** Interrupt set handler of the directly called inputs
+     * @param[in] opaque Number of the input line
+     */
+    void
+    int_set(void* opaque)
+    {
+        this->update((int)(intptr_t)opaque, true);
+    }
+
+    /** Interrupt clear handler of the directly called inputs
+     * @param[in] opaque Number of the input line
+     */
+    void
+    int_clr(void* opaque)
+    {
+        this->update((int)(intptr_t)opaque, false);
+    }
+
     /// Or'ed value of all the interrupt lines
     uint32_t m_or;
+    /// Current state of the output line
+    bool m_out;
     /// Number of masters
     int m_master_num;
 };
@@ -27,8 +27,32 @@
         }                                                                               \
     } while (false)
 
+/// Direct call interface of an interrupt slave, used by IntMaster to bypass the TLM-2 payload
+struct IntSlaveIf
+{
+    /// Destructor
+    virtual
+    ~IntSlaveIf()
+    {
+    }
+
+    /// Assert the interrupt line
+    virtual void
+    int_set() = 0;
+
+    /// De-assert the interrupt line
+    virtual void
+    int_clear() = 0;
+
+    /** Get the TLM-2 socket of the interrupt slave
+     * @return The reference to the slave socket
+     */
+    virtual tlm::tlm_target_socket<>&
+    int_socket() = 0;
+};
+
 template <typename MODULE>
-struct IntSlave
+struct IntSlave : IntSlaveIf
 {
     /** Constructor
      */
@@ -112,7 +136,42 @@ struct IntSlave
     bool
     get_state()
     {
-        return this->state;
+        return m_state;
+    }
+
+    /// Assert the interrupt line (redundant edges are filtered out)
+    void
+    int_set()
+    {
+        if (m_state)
+        {
+            return;
+        }
+
+        m_state = true;
+        (m_owner->*m_set_cb)(m_opaque);
+    }
+
+    /// De-assert the interrupt line (redundant edges are filtered out)
+    void
+    int_clear()
+    {
+        if (!m_state)
+        {
+            return;
+        }
+
+        m_state = false;
+        (m_owner->*m_clear_cb)(m_opaque);
+    }
+
+    /** Get the TLM-2 socket of the interrupt slave
+     * @return The reference to the slave socket
+     */
+    tlm::tlm_target_socket<>&
+    int_socket()
+    {
+        return this->slave_socket;
     }
 
 protected:
@@ -149,13 +208,11 @@ protected:
 
         if (*ptr)
         {
-            m_state = true;
-            (m_owner->*m_set_cb)(m_opaque);
+            this->int_set();
         }
         else
         {
-            m_state = false;
-            (m_owner->*m_clear_cb)(m_opaque);
+            this->int_clear();
         }
 
         // there was no error in the processing
@@ -48,6 +48,9 @@ struct Mpa : sc_core::sc_module
             // set the initiator as unused
             m_pending[i].is_pending = false;
         }
+
+        // the invalidations of the targets are broadcast to all the initiators
+        bus_m_socket.register_invalidate_direct_mem_ptr(this, &Mpa::bus_m_invalidate_direct_mem_ptr);
     }
 
     /** Bind the master socket to a slave
@@ -111,7 +114,7 @@ protected:
             m_pending[id].is_pending = true;
 
             // wait to get re-scheduled
-            wait(m_pending[id].event);
+            TIMELINE_WAIT(m_pending[id].event);
 
             // mark the initiator as not pending anymore
             m_pending[id].is_pending = false;
@@ -142,7 +145,7 @@ protected:
             {
                 if (m_pending[i].is_pending)
                 {
-                    m_pending[i].event.notify();
+                    TIMELINE_NOTIFY(m_pending[i].event);
                     break;
                 }
             }
@@ -201,6 +204,20 @@ protected:
         return bus_m_socket->transport_dbg(trans);
     }
 
+    /** bus_m_socket backward direct memory invalidate method
+     * @param[in] start_range Start address of the memory invalidate command
+     * @param[in] end_range End address of the memory invalidate command
+     */
+    void
+    bus_m_invalidate_direct_mem_ptr(sc_dt::uint64 start_range, sc_dt::uint64 end_range)
+    {
+        // the address map is the same on both sides, propagate as is to all initiators
+        for (int i = 0; i < N_MASTERS; i++)
+        {
+            (*bus_s_socket[i])->invalidate_direct_mem_ptr(start_range, end_range);
+        }
+    }
+
 private:
     /// Array of structures containing the pending requests description
     struct 
@@ -11,6 +11,52 @@ do {                                                                        \
     }                                                                       \
 } while (0)
 
+/// Register access kinds, selecting how the accesses to a register are served
+enum
+{
+    /// register with side effects: all the accesses go through reg_rd/reg_wr
+    REG_ACCESS_SIDE_EFFECT = 0,
+    /// plain storage: reads and writes are served directly
+    REG_ACCESS_PLAIN,
+    /// read-only: reads are served directly, writes go through reg_wr
+    REG_ACCESS_RO,
+    /// write 1 to clear: reads are served directly, bits written to 1 are cleared
+    REG_ACCESS_W1C
+};
+
+/** Compile time descriptor of a register field (as generated by reg_xls2h --class)
+ * @param INDEX Index of the register containing the field
+ * @param MASK Mask of the field in the register
+ * @param LSB Position of the least significant bit of the field
+ */
+template <uint32_t INDEX, uint32_t MASK, uint32_t LSB>
+struct RegField
+{
+    static const uint32_t index = INDEX;
+    static const uint32_t mask = MASK;
+    static const uint32_t lsb = LSB;
+
+    /** Extract the field from a register image
+     * @param[in] reg Register image
+     * @return The value of the field
+     */
+    static uint32_t
+    get(const uint32_t* reg)
+    {
+        return (reg[INDEX] & MASK) >> LSB;
+    }
+
+    /** Update the field in a register image
+     * @param[in] reg Register image
+     * @param[in] value New value of the field
+     */
+    static void
+    set(uint32_t* reg, uint32_t value)
+    {
+        reg[INDEX] = (reg[INDEX] & ~MASK) | ((value << LSB) & MASK);
+    }
+};
+
 template <int REG_COUNT>
 struct Peripheral : BusSlave
 {
@@ -18,9 +64,18 @@ struct Peripheral : BusSlave
     Peripheral(sc_core::sc_module_name name) 
     : BusSlave(name, m_reg, sizeof(m_reg))
     , m_debug(false)
+    , m_reg_names(NULL)
     {
         // clear all registers
         memset(m_reg, 0, sizeof(m_reg));
+
+        // by default every register goes through the model
+        memset(m_reg_access, REG_ACCESS_SIDE_EFFECT, sizeof(m_reg_access));
+
+        // count the accesses of each register
+        memset(m_reg_reads, 0, sizeof(m_reg_reads));
+        memset(m_reg_writes, 0, sizeof(m_reg_writes));
+        RegStats::add_block(this->name(), REG_COUNT, m_reg_reads, m_reg_writes, &m_reg_names);
     }
     
     /// Configure the debug mode
@@ -30,6 +85,39 @@ struct Peripheral : BusSlave
         m_debug = debug;
     }
 
+    /** Set the access kind of a range of registers
+     * @param[in] index Index of the first register
+     * @param[in] count Number of registers
+     * @param[in] access Access kind (REG_ACCESS_xxx)
+     */
+    void
+    set_reg_access(uint32_t index, uint32_t count, uint8_t access)
+    {
+        // sanity check
+        assert((index + count) <= REG_COUNT);
+
+        memset(&m_reg_access[index], access, count);
+    }
+
+    /** Set the access kind of a single register
+     * @param[in] index Index of the register
+     * @param[in] access Access kind (REG_ACCESS_xxx)
+     */
+    void
+    set_reg_access(uint32_t index, uint8_t access)
+    {
+        this->set_reg_access(index, 1, access);
+    }
+
+    /** Set the function naming the registers in the statistics (reg_name() of the register maps)
+     * @param[in] names Function giving the name of a register from its index
+     */
+    void
+    set_reg_names(RegNameFunc names)
+    {
+        m_reg_names = names;
+    }
+
 protected:
     /// Specific blocking transport method
     virtual void
@@ -39,6 +127,50 @@ protected:
 
         // retrieve the required parameters
         uint32_t* ptr = reinterpret_cast<uint32_t*>(trans.get_data_ptr());
+        uint32_t index = trans.get_address()/4;
+
+        // sanity check
+        assert(index < REG_COUNT);
+
+        // access statistics
+        if (trans.get_command() == tlm::TLM_READ_COMMAND)
+        {
+            m_reg_reads[index]++;
+        }
+        else
+        {
+            m_reg_writes[index]++;
+        }
+
+        // registers without side effects are served without calling the model
+        // (the access time is annotated, the initiator waits for it with the next synchronization)
+        if (m_reg_access[index] != REG_ACCESS_SIDE_EFFECT)
+        {
+            if (trans.get_command() == tlm::TLM_READ_COMMAND)
+            {
+                *ptr = m_reg[index];
+                PERIPHERAL_DBG("RD[%X] <= %X", (uint32_t)trans.get_address(), *ptr);
+                this->annotate(delay);
+                trans.set_response_status(tlm::TLM_OK_RESPONSE);
+                return;
+            }
+            else if (m_reg_access[index] == REG_ACCESS_PLAIN)
+            {
+                PERIPHERAL_DBG("WR[%X] <= %X", (uint32_t)trans.get_address(), *ptr);
+                m_reg[index] = *ptr;
+                this->annotate(delay);
+                trans.set_response_status(tlm::TLM_OK_RESPONSE);
+                return;
+            }
+            else if (m_reg_access[index] == REG_ACCESS_W1C)
+            {
+                PERIPHERAL_DBG("WR[%X] <= %X", (uint32_t)trans.get_address(), *ptr);
+                m_reg[index] &= ~(*ptr);
+                this->annotate(delay);
+                trans.set_response_status(tlm::TLM_OK_RESPONSE);
+                return;
+            }
+        }
 
         // sanity check
         #if BUSSLAVE_DEBUG_LEVEL
@@ -126,9 +258,21 @@ protected:
 
     /// Registers content
     uint32_t m_reg[REG_COUNT];
+
+    /// Access kind of each register (REG_ACCESS_xxx)
+    uint8_t m_reg_access[REG_COUNT];
     
     /// Debug mode
     bool m_debug;
+
+    /// Number of reads of each register
+    uint64_t m_reg_reads[REG_COUNT];
+
+    /// Number of writes of each register
+    uint64_t m_reg_writes[REG_COUNT];
+
+    /// Function giving the name of the registers (NULL if not named)
+    RegNameFunc m_reg_names;
 };
 
 #endif /*PERIPHERAL_H_*/
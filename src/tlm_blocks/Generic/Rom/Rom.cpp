@@ -1,2 +1,84 @@
 #include "Rom.h"
 
+void
+Rom::patch(uint32_t offset, uint32_t value)
+{
+    offset &= ~3;
+    if (offset >= this->get_size())
+    {
+        TLM_ERR("ROM patch out of range (0x%08X)", offset);
+    }
+
+    if (m_patches.find(offset) == m_patches.end())
+    {
+        m_patch_pages[offset >> ROM_PATCH_PAGE_SHIFT]++;
+    }
+    m_patches[offset] = value;
+    this->invalidate(offset);
+}
+
+void
+Rom::unpatch(uint32_t offset)
+{
+    std::map<uint32_t, uint32_t>::iterator patch = m_patches.find(offset & ~3);
+
+    if (patch == m_patches.end())
+    {
+        return;
+    }
+    m_patch_pages[patch->first >> ROM_PATCH_PAGE_SHIFT]--;
+    m_patches.erase(patch);
+    this->invalidate(offset);
+}
+
+void
+Rom::patch_read(tlm::tlm_generic_payload& trans)
+{
+    uint32_t addr = trans.get_address();
+    uint32_t length = trans.get_data_length();
+    uint32_t* ptr = reinterpret_cast<uint32_t*>(trans.get_data_ptr());
+    std::map<uint32_t, uint32_t>::const_iterator patch = m_patches.find(addr & ~3);
+
+    if (patch != m_patches.end())
+    {
+        uint32_t mask = (length == 4) ? 0xFFFFFFFF : ((1 << (length * 8)) - 1);
+
+        *ptr = (patch->second >> ((addr & 3) * 8)) & mask;
+    }
+}
+
+unsigned int
+Rom::slave_dbg_transport(tlm::tlm_generic_payload& trans)
+{
+    unsigned int length = BusSlave::slave_dbg_transport(trans);
+    uint32_t addr = trans.get_address();
+    uint8_t* ptr = trans.get_data_ptr();
+    std::map<uint32_t, uint32_t>::const_iterator patch;
+
+    // the debugger reads what the CPU reads (the loads write the ROM content)
+    if (trans.is_read())
+    {
+        for (patch = m_patches.lower_bound(addr & ~3);
+             (patch != m_patches.end()) && (patch->first < (addr + length)); patch++)
+        {
+            const uint8_t* value = reinterpret_cast<const uint8_t*>(&patch->second);
+
+            for (uint32_t i = 0; i < 4; i++)
+            {
+                if (((patch->first + i) >= addr) && ((patch->first + i) < (addr + length)))
+                {
+                    ptr[patch->first + i - addr] = value[i];
+                }
+            }
+        }
+    }
+    return length;
+}
+
+void
+Rom::invalidate(uint32_t offset)
+{
+    sc_dt::uint64 start = offset & ~((1 << ROM_PATCH_PAGE_SHIFT) - 1);
+
+    slave_socket->invalidate_direct_mem_ptr(start, start + (1 << ROM_PATCH_PAGE_SHIFT) - 1);
+}
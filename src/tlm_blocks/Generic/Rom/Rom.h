@@ -3,7 +3,16 @@
 
 #include "Generic/BusSlave/BusSlave.h"
 
-/// Generic Rom TLM module, deriving the simple slave
+#include <map>
+#include <vector>
+
+/// Size of the pages of the patch overlay (log2, 1 KiB pages)
+#define ROM_PATCH_PAGE_SHIFT 10
+
+/** Generic Rom TLM module, deriving the simple slave
+ * The words of the ROM can be patched (see Prc): the patched values are kept in an
+ * overlay and only the reads in a page containing a patch look it up.
+ */
 struct Rom : BusSlave
 {
     /** Rom class constructor
@@ -13,6 +22,7 @@ struct Rom : BusSlave
      */
     Rom(sc_core::sc_module_name name, uint32_t* data, uint32_t size)
     : BusSlave(name, data, size)
+    , m_patch_pages(((size - 1) >> ROM_PATCH_PAGE_SHIFT) + 1, 0)
     {
     }
 
@@ -22,9 +32,23 @@ struct Rom : BusSlave
      */
     Rom(sc_core::sc_module_name name, uint32_t size)
     : BusSlave(name, (uint32_t*)malloc(size), size)
+    , m_patch_pages(((size - 1) >> ROM_PATCH_PAGE_SHIFT) + 1, 0)
     {
     }
 
+    /** Patch a word: the value is read instead of the ROM content
+     * @param[in] offset Offset of the word in the ROM
+     * @param[in] value Value of the word
+     */
+    void
+    patch(uint32_t offset, uint32_t value);
+
+    /** Remove the patch of a word
+     * @param[in] offset Offset of the word in the ROM
+     */
+    void
+    unpatch(uint32_t offset);
+
     /// Override the virtual function
     void
     slave_b_transport(tlm::tlm_generic_payload& trans, sc_core::sc_time& delay)
@@ -32,6 +56,12 @@ struct Rom : BusSlave
         if (likely(trans.get_command() == tlm::TLM_READ_COMMAND))
         {
             BusSlave::slave_b_transport(trans, delay);
+
+            // only the pages containing a patch take the slow path
+            if (unlikely(m_patch_pages[trans.get_address() >> ROM_PATCH_PAGE_SHIFT] != 0))
+            {
+                this->patch_read(trans);
+            }
         }
         else
         {
@@ -40,6 +70,28 @@ struct Rom : BusSlave
         return;
     }
 
+    /// Override the virtual function
+    unsigned int
+    slave_dbg_transport(tlm::tlm_generic_payload& trans);
+
+private:
+    /** Replace the data of a read by the patched word
+     * @param[in, out] trans Transaction payload object
+     */
+    void
+    patch_read(tlm::tlm_generic_payload& trans);
+
+    /** Invalidate the page of a word in the initiators (cached or decoded content)
+     * @param[in] offset Offset of the word in the ROM
+     */
+    void
+    invalidate(uint32_t offset);
+
+    /// Patched words, indexed by offset
+    std::map<uint32_t, uint32_t> m_patches;
+
+    /// Number of patched words in each page
+    std::vector<uint16_t> m_patch_pages;
 };
 
 #endif /*ROM_H_*/
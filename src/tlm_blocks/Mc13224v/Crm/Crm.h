@@ -1,27 +1,31 @@
 #ifndef CRM_H_
 #define CRM_H_
 
-// this is a peripheral
-#include "Generic/Peripheral/Peripheral.h"
-
 // with an interrupt
 #include "Generic/IntMaster/IntMaster.h"
 
-// include the registers definition
+// this is a peripheral with the registers definition
 #include "reg_crm.h"
 
 /// Interrupt Controller block model
-struct Crm : Peripheral<REG_CRM_COUNT>
+struct Crm : RegCrm<Crm>
 {
     /** Constructor
      * @param[in] name Name of the module
      */
     Crm(sc_core::sc_module_name name)
-    : Peripheral<REG_CRM_COUNT>(name)
+    : RegCrm<Crm>(name)
     , interrupt("interrupt")
     {
-        // initialized the register access
-        reg_crm = &(m_reg[0]);
+        // registers without side effects are served directly, the model only hooks the
+        // status, which clears bits and drives the interrupt
+        this->set_reg_access(0, REG_CRM_COUNT, REG_ACCESS_PLAIN);
+        this->set_reg_access(STATUS_INDEX, REG_ACCESS_SIDE_EFFECT);
+        // the writes to the read-only registers are still reported
+        this->set_reg_access(MOD_STATUS_INDEX, REG_ACCESS_RO);
+        this->set_reg_access(WU_COUNT_INDEX, REG_ACCESS_RO);
+        this->set_reg_access(RTC_COUNT_INDEX, REG_ACCESS_RO);
+        this->set_reg_access(CAL_COUNT_INDEX, REG_ACCESS_RO);
     }
 
     /** Set the status of the block
@@ -37,23 +41,18 @@ struct Crm : Peripheral<REG_CRM_COUNT>
     IntMaster interrupt;
 
 private:
+    // the register map dispatches the accesses to the register hooks
+    friend struct RegCrm<Crm>;
+
     /// Override the virtual function to be able to generate interrupt from debugger
     unsigned int
     reg_s_transport_dbg(tlm::tlm_generic_payload& trans);
 
-    /** Register read function
-     * @param[in] offset Offset of the register to read
-     * @return The value read
-     */
-    uint32_t
-    reg_rd(uint32_t offset);
-
-    /** Register write function
-     * @param[in] offset Offset of the register to read
-     * @param[in] offset Value to write in the register
+    /** STATUS register write hook: clear the events written to 1
+     * @param[in] value Value written in the register
      */
     void
-    reg_wr(uint32_t offset, uint32_t value);
+    status_wr(uint32_t value);
 
     /// Check that interrupt status
     void check_int();
@@ -4,7 +4,7 @@
 #include <stdint.h>
 #include "compiler.h"
 #include "arch.h"
-#include "reg_sim.h"
+#include "Generic/Peripheral/Peripheral.h"
 
 #define REG_CRM_BASE_ADDR 0x80003000
 
@@ -27,16 +27,6 @@
  */
 #define SYS_CNTL_INDEX  0x00000000
 
-__INLINE uint32_t sys_cntl_get(void)
-{
-    return sim_reg_crm_rd(SYS_CNTL_INDEX);
-}
-
-__INLINE void sys_cntl_set(uint32_t value)
-{
-    sim_reg_crm_wr(SYS_CNTL_INDEX, value);
-}
-
 // field definitions
 #define XTAL_CLKDIV_MASK     0x00003F00
 #define XTAL_CLKDIV_LSB      8
@@ -60,101 +50,6 @@ __INLINE void sys_cntl_set(uint32_t value)
 #define PADS_1P8V_SEL_RST    0x0
 #define PWR_SOURCE_RST       0x0
 
-__INLINE void sys_cntl_pack(uint8_t xtalclkdiv, uint8_t xtal32exists, uint8_t jtagsecuoff, uint8_t spif1p8vsel, uint8_t pads1p8vsel, uint8_t pwrsource)
-{
-    ASSERT_ERR(((xtalclkdiv << 8) & ~0x00003F00) == 0);
-    ASSERT_ERR(((xtal32exists << 5) & ~0x00000020) == 0);
-    ASSERT_ERR(((jtagsecuoff << 4) & ~0x00000010) == 0);
-    ASSERT_ERR(((spif1p8vsel << 3) & ~0x00000008) == 0);
-    ASSERT_ERR(((pads1p8vsel << 2) & ~0x00000004) == 0);
-    ASSERT_ERR(((pwrsource << 0) & ~0x00000003) == 0);
-    sim_reg_crm_wr(SYS_CNTL_INDEX,  (xtalclkdiv << 8) | (xtal32exists << 5) | (jtagsecuoff << 4) | (spif1p8vsel << 3) | (pads1p8vsel << 2) | (pwrsource << 0));
-}
-
-__INLINE void sys_cntl_unpack(uint8_t* xtalclkdiv, uint8_t* xtal32exists, uint8_t* jtagsecuoff, uint8_t* spif1p8vsel, uint8_t* pads1p8vsel, uint8_t* pwrsource)
-{
-    uint32_t localVal = sim_reg_crm_rd(SYS_CNTL_INDEX);
-
-    *xtalclkdiv = (localVal & 0x00003F00) >> 8;
-    *xtal32exists = (localVal & 0x00000020) >> 5;
-    *jtagsecuoff = (localVal & 0x00000010) >> 4;
-    *spif1p8vsel = (localVal & 0x00000008) >> 3;
-    *pads1p8vsel = (localVal & 0x00000004) >> 2;
-    *pwrsource = (localVal & 0x00000003) >> 0;
-}
-
-__INLINE uint8_t xtal_clkdiv_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(SYS_CNTL_INDEX);
-    return ((localVal & 0x00003F00) >> 8);
-}
-
-__INLINE void xtal_clkdiv_setf(uint8_t xtalclkdiv)
-{
-    ASSERT_ERR(((xtalclkdiv << 8) & ~0x00003F00) == 0);
-    sim_reg_crm_wr(SYS_CNTL_INDEX, (sim_reg_crm_rd(SYS_CNTL_INDEX) & ~0x00003F00) | (xtalclkdiv << 8));
-}
-
-__INLINE uint8_t xtal32_exists_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(SYS_CNTL_INDEX);
-    return ((localVal & 0x00000020) >> 5);
-}
-
-__INLINE void xtal32_exists_setf(uint8_t xtal32exists)
-{
-    ASSERT_ERR(((xtal32exists << 5) & ~0x00000020) == 0);
-    sim_reg_crm_wr(SYS_CNTL_INDEX, (sim_reg_crm_rd(SYS_CNTL_INDEX) & ~0x00000020) | (xtal32exists << 5));
-}
-
-__INLINE uint8_t jtag_secu_off_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(SYS_CNTL_INDEX);
-    return ((localVal & 0x00000010) >> 4);
-}
-
-__INLINE void jtag_secu_off_setf(uint8_t jtagsecuoff)
-{
-    ASSERT_ERR(((jtagsecuoff << 4) & ~0x00000010) == 0);
-    sim_reg_crm_wr(SYS_CNTL_INDEX, (sim_reg_crm_rd(SYS_CNTL_INDEX) & ~0x00000010) | (jtagsecuoff << 4));
-}
-
-__INLINE uint8_t spif_1p8v_sel_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(SYS_CNTL_INDEX);
-    return ((localVal & 0x00000008) >> 3);
-}
-
-__INLINE void spif_1p8v_sel_setf(uint8_t spif1p8vsel)
-{
-    ASSERT_ERR(((spif1p8vsel << 3) & ~0x00000008) == 0);
-    sim_reg_crm_wr(SYS_CNTL_INDEX, (sim_reg_crm_rd(SYS_CNTL_INDEX) & ~0x00000008) | (spif1p8vsel << 3));
-}
-
-__INLINE uint8_t pads_1p8v_sel_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(SYS_CNTL_INDEX);
-    return ((localVal & 0x00000004) >> 2);
-}
-
-__INLINE void pads_1p8v_sel_setf(uint8_t pads1p8vsel)
-{
-    ASSERT_ERR(((pads1p8vsel << 2) & ~0x00000004) == 0);
-    sim_reg_crm_wr(SYS_CNTL_INDEX, (sim_reg_crm_rd(SYS_CNTL_INDEX) & ~0x00000004) | (pads1p8vsel << 2));
-}
-
-__INLINE uint8_t pwr_source_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(SYS_CNTL_INDEX);
-    return ((localVal & 0x00000003) >> 0);
-}
-
-__INLINE void pwr_source_setf(uint8_t pwrsource)
-{
-    ASSERT_ERR(((pwrsource << 0) & ~0x00000003) == 0);
-    sim_reg_crm_wr(SYS_CNTL_INDEX, (sim_reg_crm_rd(SYS_CNTL_INDEX) & ~0x00000003) | (pwrsource << 0));
-}
-
 /**
  * @brief WU_CNTL register definition
  * <pre>
@@ -175,16 +70,6 @@ __INLINE void pwr_source_setf(uint8_t pwrsource)
  */
 #define WU_CNTL_INDEX  0x00000001
 
-__INLINE uint32_t wu_cntl_get(void)
-{
-    return sim_reg_crm_rd(WU_CNTL_INDEX);
-}
-
-__INLINE void wu_cntl_set(uint32_t value)
-{
-    sim_reg_crm_wr(WU_CNTL_INDEX, value);
-}
-
 // field definitions
 #define EXT_OUT_POL_MASK    0xF0000000
 #define EXT_OUT_POL_LSB     28
@@ -226,171 +111,6 @@ __INLINE void wu_cntl_set(uint32_t value)
 #define RTC_WU_EN_RST       0x0
 #define TIMER_WU_EN_RST     0x0
 
-__INLINE void wu_cntl_pack(uint8_t extoutpol, uint8_t extwuien, uint8_t rtcwuien, uint8_t timerwuien, uint8_t extwupol, uint8_t extwuedge, uint8_t extwuen, uint8_t autoadc, uint8_t hostwake, uint8_t rtcwuen, uint8_t timerwuen)
-{
-    ASSERT_ERR(((extoutpol << 28) & ~0xF0000000) == 0);
-    ASSERT_ERR(((extwuien << 20) & ~0x00F00000) == 0);
-    ASSERT_ERR(((rtcwuien << 17) & ~0x00020000) == 0);
-    ASSERT_ERR(((timerwuien << 16) & ~0x00010000) == 0);
-    ASSERT_ERR(((extwupol << 12) & ~0x0000F000) == 0);
-    ASSERT_ERR(((extwuedge << 8) & ~0x00000F00) == 0);
-    ASSERT_ERR(((extwuen << 4) & ~0x000000F0) == 0);
-    ASSERT_ERR(((autoadc << 3) & ~0x00000008) == 0);
-    ASSERT_ERR(((hostwake << 2) & ~0x00000004) == 0);
-    ASSERT_ERR(((rtcwuen << 1) & ~0x00000002) == 0);
-    ASSERT_ERR(((timerwuen << 0) & ~0x00000001) == 0);
-    sim_reg_crm_wr(WU_CNTL_INDEX,  (extoutpol << 28) | (extwuien << 20) | (rtcwuien << 17) | (timerwuien << 16) | (extwupol << 12) | (extwuedge << 8) | (extwuen << 4) | (autoadc << 3) | (hostwake << 2) | (rtcwuen << 1) | (timerwuen << 0));
-}
-
-__INLINE void wu_cntl_unpack(uint8_t* extoutpol, uint8_t* extwuien, uint8_t* rtcwuien, uint8_t* timerwuien, uint8_t* extwupol, uint8_t* extwuedge, uint8_t* extwuen, uint8_t* autoadc, uint8_t* hostwake, uint8_t* rtcwuen, uint8_t* timerwuen)
-{
-    uint32_t localVal = sim_reg_crm_rd(WU_CNTL_INDEX);
-
-    *extoutpol = (localVal & 0xF0000000) >> 28;
-    *extwuien = (localVal & 0x00F00000) >> 20;
-    *rtcwuien = (localVal & 0x00020000) >> 17;
-    *timerwuien = (localVal & 0x00010000) >> 16;
-    *extwupol = (localVal & 0x0000F000) >> 12;
-    *extwuedge = (localVal & 0x00000F00) >> 8;
-    *extwuen = (localVal & 0x000000F0) >> 4;
-    *autoadc = (localVal & 0x00000008) >> 3;
-    *hostwake = (localVal & 0x00000004) >> 2;
-    *rtcwuen = (localVal & 0x00000002) >> 1;
-    *timerwuen = (localVal & 0x00000001) >> 0;
-}
-
-__INLINE uint8_t ext_out_pol_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(WU_CNTL_INDEX);
-    return ((localVal & 0xF0000000) >> 28);
-}
-
-__INLINE void ext_out_pol_setf(uint8_t extoutpol)
-{
-    ASSERT_ERR(((extoutpol << 28) & ~0xF0000000) == 0);
-    sim_reg_crm_wr(WU_CNTL_INDEX, (sim_reg_crm_rd(WU_CNTL_INDEX) & ~0xF0000000) | (extoutpol << 28));
-}
-
-__INLINE uint8_t ext_wu_ien_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(WU_CNTL_INDEX);
-    return ((localVal & 0x00F00000) >> 20);
-}
-
-__INLINE void ext_wu_ien_setf(uint8_t extwuien)
-{
-    ASSERT_ERR(((extwuien << 20) & ~0x00F00000) == 0);
-    sim_reg_crm_wr(WU_CNTL_INDEX, (sim_reg_crm_rd(WU_CNTL_INDEX) & ~0x00F00000) | (extwuien << 20));
-}
-
-__INLINE uint8_t rtc_wu_ien_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(WU_CNTL_INDEX);
-    return ((localVal & 0x00020000) >> 17);
-}
-
-__INLINE void rtc_wu_ien_setf(uint8_t rtcwuien)
-{
-    ASSERT_ERR(((rtcwuien << 17) & ~0x00020000) == 0);
-    sim_reg_crm_wr(WU_CNTL_INDEX, (sim_reg_crm_rd(WU_CNTL_INDEX) & ~0x00020000) | (rtcwuien << 17));
-}
-
-__INLINE uint8_t timer_wu_ien_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(WU_CNTL_INDEX);
-    return ((localVal & 0x00010000) >> 16);
-}
-
-__INLINE void timer_wu_ien_setf(uint8_t timerwuien)
-{
-    ASSERT_ERR(((timerwuien << 16) & ~0x00010000) == 0);
-    sim_reg_crm_wr(WU_CNTL_INDEX, (sim_reg_crm_rd(WU_CNTL_INDEX) & ~0x00010000) | (timerwuien << 16));
-}
-
-__INLINE uint8_t ext_wu_pol_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(WU_CNTL_INDEX);
-    return ((localVal & 0x0000F000) >> 12);
-}
-
-__INLINE void ext_wu_pol_setf(uint8_t extwupol)
-{
-    ASSERT_ERR(((extwupol << 12) & ~0x0000F000) == 0);
-    sim_reg_crm_wr(WU_CNTL_INDEX, (sim_reg_crm_rd(WU_CNTL_INDEX) & ~0x0000F000) | (extwupol << 12));
-}
-
-__INLINE uint8_t ext_wu_edge_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(WU_CNTL_INDEX);
-    return ((localVal & 0x00000F00) >> 8);
-}
-
-__INLINE void ext_wu_edge_setf(uint8_t extwuedge)
-{
-    ASSERT_ERR(((extwuedge << 8) & ~0x00000F00) == 0);
-    sim_reg_crm_wr(WU_CNTL_INDEX, (sim_reg_crm_rd(WU_CNTL_INDEX) & ~0x00000F00) | (extwuedge << 8));
-}
-
-__INLINE uint8_t ext_wu_en_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(WU_CNTL_INDEX);
-    return ((localVal & 0x000000F0) >> 4);
-}
-
-__INLINE void ext_wu_en_setf(uint8_t extwuen)
-{
-    ASSERT_ERR(((extwuen << 4) & ~0x000000F0) == 0);
-    sim_reg_crm_wr(WU_CNTL_INDEX, (sim_reg_crm_rd(WU_CNTL_INDEX) & ~0x000000F0) | (extwuen << 4));
-}
-
-__INLINE uint8_t auto_adc_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(WU_CNTL_INDEX);
-    return ((localVal & 0x00000008) >> 3);
-}
-
-__INLINE void auto_adc_setf(uint8_t autoadc)
-{
-    ASSERT_ERR(((autoadc << 3) & ~0x00000008) == 0);
-    sim_reg_crm_wr(WU_CNTL_INDEX, (sim_reg_crm_rd(WU_CNTL_INDEX) & ~0x00000008) | (autoadc << 3));
-}
-
-__INLINE uint8_t host_wake_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(WU_CNTL_INDEX);
-    return ((localVal & 0x00000004) >> 2);
-}
-
-__INLINE void host_wake_setf(uint8_t hostwake)
-{
-    ASSERT_ERR(((hostwake << 2) & ~0x00000004) == 0);
-    sim_reg_crm_wr(WU_CNTL_INDEX, (sim_reg_crm_rd(WU_CNTL_INDEX) & ~0x00000004) | (hostwake << 2));
-}
-
-__INLINE uint8_t rtc_wu_en_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(WU_CNTL_INDEX);
-    return ((localVal & 0x00000002) >> 1);
-}
-
-__INLINE void rtc_wu_en_setf(uint8_t rtcwuen)
-{
-    ASSERT_ERR(((rtcwuen << 1) & ~0x00000002) == 0);
-    sim_reg_crm_wr(WU_CNTL_INDEX, (sim_reg_crm_rd(WU_CNTL_INDEX) & ~0x00000002) | (rtcwuen << 1));
-}
-
-__INLINE uint8_t timer_wu_en_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(WU_CNTL_INDEX);
-    return ((localVal & 0x00000001) >> 0);
-}
-
-__INLINE void timer_wu_en_setf(uint8_t timerwuen)
-{
-    ASSERT_ERR(((timerwuen << 0) & ~0x00000001) == 0);
-    sim_reg_crm_wr(WU_CNTL_INDEX, (sim_reg_crm_rd(WU_CNTL_INDEX) & ~0x00000001) | (timerwuen << 0));
-}
-
 /**
  * @brief SLEEP_CNTL register definition
  * <pre>
@@ -405,16 +125,6 @@ __INLINE void timer_wu_en_setf(uint8_t timerwuen)
  */
 #define SLEEP_CNTL_INDEX  0x00000002
 
-__INLINE uint32_t sleep_cntl_get(void)
-{
-    return sim_reg_crm_rd(SLEEP_CNTL_INDEX);
-}
-
-__INLINE void sleep_cntl_set(uint32_t value)
-{
-    sim_reg_crm_wr(SLEEP_CNTL_INDEX, value);
-}
-
 // field definitions
 #define DIG_PAD_EN_BIT    0x00000080
 #define DIG_PAD_EN_POS    7
@@ -434,87 +144,6 @@ __INLINE void sleep_cntl_set(uint32_t value)
 #define DOZE_RST          0x0
 #define HIB_RST           0x0
 
-__INLINE void sleep_cntl_pack(uint8_t digpaden, uint8_t mcuret, uint8_t ramret, uint8_t doze, uint8_t hib)
-{
-    ASSERT_ERR(((digpaden << 7) & ~0x00000080) == 0);
-    ASSERT_ERR(((mcuret << 6) & ~0x00000040) == 0);
-    ASSERT_ERR(((ramret << 4) & ~0x00000030) == 0);
-    ASSERT_ERR(((doze << 1) & ~0x00000002) == 0);
-    ASSERT_ERR(((hib << 0) & ~0x00000001) == 0);
-    sim_reg_crm_wr(SLEEP_CNTL_INDEX,  (digpaden << 7) | (mcuret << 6) | (ramret << 4) | (doze << 1) | (hib << 0));
-}
-
-__INLINE void sleep_cntl_unpack(uint8_t* digpaden, uint8_t* mcuret, uint8_t* ramret, uint8_t* doze, uint8_t* hib)
-{
-    uint32_t localVal = sim_reg_crm_rd(SLEEP_CNTL_INDEX);
-
-    *digpaden = (localVal & 0x00000080) >> 7;
-    *mcuret = (localVal & 0x00000040) >> 6;
-    *ramret = (localVal & 0x00000030) >> 4;
-    *doze = (localVal & 0x00000002) >> 1;
-    *hib = (localVal & 0x00000001) >> 0;
-}
-
-__INLINE uint8_t dig_pad_en_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(SLEEP_CNTL_INDEX);
-    return ((localVal & 0x00000080) >> 7);
-}
-
-__INLINE void dig_pad_en_setf(uint8_t digpaden)
-{
-    ASSERT_ERR(((digpaden << 7) & ~0x00000080) == 0);
-    sim_reg_crm_wr(SLEEP_CNTL_INDEX, (sim_reg_crm_rd(SLEEP_CNTL_INDEX) & ~0x00000080) | (digpaden << 7));
-}
-
-__INLINE uint8_t mcu_ret_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(SLEEP_CNTL_INDEX);
-    return ((localVal & 0x00000040) >> 6);
-}
-
-__INLINE void mcu_ret_setf(uint8_t mcuret)
-{
-    ASSERT_ERR(((mcuret << 6) & ~0x00000040) == 0);
-    sim_reg_crm_wr(SLEEP_CNTL_INDEX, (sim_reg_crm_rd(SLEEP_CNTL_INDEX) & ~0x00000040) | (mcuret << 6));
-}
-
-__INLINE uint8_t ram_ret_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(SLEEP_CNTL_INDEX);
-    return ((localVal & 0x00000030) >> 4);
-}
-
-__INLINE void ram_ret_setf(uint8_t ramret)
-{
-    ASSERT_ERR(((ramret << 4) & ~0x00000030) == 0);
-    sim_reg_crm_wr(SLEEP_CNTL_INDEX, (sim_reg_crm_rd(SLEEP_CNTL_INDEX) & ~0x00000030) | (ramret << 4));
-}
-
-__INLINE uint8_t doze_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(SLEEP_CNTL_INDEX);
-    return ((localVal & 0x00000002) >> 1);
-}
-
-__INLINE void doze_setf(uint8_t doze)
-{
-    ASSERT_ERR(((doze << 1) & ~0x00000002) == 0);
-    sim_reg_crm_wr(SLEEP_CNTL_INDEX, (sim_reg_crm_rd(SLEEP_CNTL_INDEX) & ~0x00000002) | (doze << 1));
-}
-
-__INLINE uint8_t hib_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(SLEEP_CNTL_INDEX);
-    return ((localVal & 0x00000001) >> 0);
-}
-
-__INLINE void hib_setf(uint8_t hib)
-{
-    ASSERT_ERR(((hib << 0) & ~0x00000001) == 0);
-    sim_reg_crm_wr(SLEEP_CNTL_INDEX, (sim_reg_crm_rd(SLEEP_CNTL_INDEX) & ~0x00000001) | (hib << 0));
-}
-
 /**
  * @brief BS_CNTL register definition
  * <pre>
@@ -528,16 +157,6 @@ __INLINE void hib_setf(uint8_t hib)
  */
 #define BS_CNTL_INDEX  0x00000003
 
-__INLINE uint32_t bs_cntl_get(void)
-{
-    return sim_reg_crm_rd(BS_CNTL_INDEX);
-}
-
-__INLINE void bs_cntl_set(uint32_t value)
-{
-    sim_reg_crm_wr(BS_CNTL_INDEX, value);
-}
-
 // field definitions
 #define ARM_OFF_TIME_MASK   0x00003F00
 #define ARM_OFF_TIME_LSB    8
@@ -554,73 +173,6 @@ __INLINE void bs_cntl_set(uint32_t value)
 #define WAIT4IRQ_RST        0x0
 #define BS_EN_RST           0x0
 
-__INLINE void bs_cntl_pack(uint8_t armofftime, uint8_t bsmanen, uint8_t wait4irq, uint8_t bsen)
-{
-    ASSERT_ERR(((armofftime << 8) & ~0x00003F00) == 0);
-    ASSERT_ERR(((bsmanen << 2) & ~0x00000004) == 0);
-    ASSERT_ERR(((wait4irq << 1) & ~0x00000002) == 0);
-    ASSERT_ERR(((bsen << 0) & ~0x00000001) == 0);
-    sim_reg_crm_wr(BS_CNTL_INDEX,  (armofftime << 8) | (bsmanen << 2) | (wait4irq << 1) | (bsen << 0));
-}
-
-__INLINE void bs_cntl_unpack(uint8_t* armofftime, uint8_t* bsmanen, uint8_t* wait4irq, uint8_t* bsen)
-{
-    uint32_t localVal = sim_reg_crm_rd(BS_CNTL_INDEX);
-
-    *armofftime = (localVal & 0x00003F00) >> 8;
-    *bsmanen = (localVal & 0x00000004) >> 2;
-    *wait4irq = (localVal & 0x00000002) >> 1;
-    *bsen = (localVal & 0x00000001) >> 0;
-}
-
-__INLINE uint8_t arm_off_time_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(BS_CNTL_INDEX);
-    return ((localVal & 0x00003F00) >> 8);
-}
-
-__INLINE void arm_off_time_setf(uint8_t armofftime)
-{
-    ASSERT_ERR(((armofftime << 8) & ~0x00003F00) == 0);
-    sim_reg_crm_wr(BS_CNTL_INDEX, (sim_reg_crm_rd(BS_CNTL_INDEX) & ~0x00003F00) | (armofftime << 8));
-}
-
-__INLINE uint8_t bs_man_en_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(BS_CNTL_INDEX);
-    return ((localVal & 0x00000004) >> 2);
-}
-
-__INLINE void bs_man_en_setf(uint8_t bsmanen)
-{
-    ASSERT_ERR(((bsmanen << 2) & ~0x00000004) == 0);
-    sim_reg_crm_wr(BS_CNTL_INDEX, (sim_reg_crm_rd(BS_CNTL_INDEX) & ~0x00000004) | (bsmanen << 2));
-}
-
-__INLINE uint8_t wait4irq_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(BS_CNTL_INDEX);
-    return ((localVal & 0x00000002) >> 1);
-}
-
-__INLINE void wait4irq_setf(uint8_t wait4irq)
-{
-    ASSERT_ERR(((wait4irq << 1) & ~0x00000002) == 0);
-    sim_reg_crm_wr(BS_CNTL_INDEX, (sim_reg_crm_rd(BS_CNTL_INDEX) & ~0x00000002) | (wait4irq << 1));
-}
-
-__INLINE uint8_t bs_en_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(BS_CNTL_INDEX);
-    return ((localVal & 0x00000001) >> 0);
-}
-
-__INLINE void bs_en_setf(uint8_t bsen)
-{
-    ASSERT_ERR(((bsen << 0) & ~0x00000001) == 0);
-    sim_reg_crm_wr(BS_CNTL_INDEX, (sim_reg_crm_rd(BS_CNTL_INDEX) & ~0x00000001) | (bsen << 0));
-}
-
 /**
  * @brief COP_CNTL register definition
  * <pre>
@@ -635,16 +187,6 @@ __INLINE void bs_en_setf(uint8_t bsen)
  */
 #define COP_CNTL_INDEX  0x00000004
 
-__INLINE uint32_t cop_cntl_get(void)
-{
-    return sim_reg_crm_rd(COP_CNTL_INDEX);
-}
-
-__INLINE void cop_cntl_set(uint32_t value)
-{
-    sim_reg_crm_wr(COP_CNTL_INDEX, value);
-}
-
 // field definitions
 #define COP_COUNT_MASK     0x007F0000
 #define COP_COUNT_LSB      16
@@ -665,87 +207,6 @@ __INLINE void cop_cntl_set(uint32_t value)
 #define COP_OUT_RST        0x0
 #define COP_EN_RST         0x0
 
-__INLINE void cop_cntl_pack(uint8_t copcount, uint8_t coptimeout, uint8_t copwp, uint8_t copout, uint8_t copen)
-{
-    ASSERT_ERR(((copcount << 16) & ~0x007F0000) == 0);
-    ASSERT_ERR(((coptimeout << 8) & ~0x00007F00) == 0);
-    ASSERT_ERR(((copwp << 2) & ~0x00000004) == 0);
-    ASSERT_ERR(((copout << 1) & ~0x00000002) == 0);
-    ASSERT_ERR(((copen << 0) & ~0x00000001) == 0);
-    sim_reg_crm_wr(COP_CNTL_INDEX,  (copcount << 16) | (coptimeout << 8) | (copwp << 2) | (copout << 1) | (copen << 0));
-}
-
-__INLINE void cop_cntl_unpack(uint8_t* copcount, uint8_t* coptimeout, uint8_t* copwp, uint8_t* copout, uint8_t* copen)
-{
-    uint32_t localVal = sim_reg_crm_rd(COP_CNTL_INDEX);
-
-    *copcount = (localVal & 0x007F0000) >> 16;
-    *coptimeout = (localVal & 0x00007F00) >> 8;
-    *copwp = (localVal & 0x00000004) >> 2;
-    *copout = (localVal & 0x00000002) >> 1;
-    *copen = (localVal & 0x00000001) >> 0;
-}
-
-__INLINE uint8_t cop_count_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(COP_CNTL_INDEX);
-    return ((localVal & 0x007F0000) >> 16);
-}
-
-__INLINE void cop_count_setf(uint8_t copcount)
-{
-    ASSERT_ERR(((copcount << 16) & ~0x007F0000) == 0);
-    sim_reg_crm_wr(COP_CNTL_INDEX, (sim_reg_crm_rd(COP_CNTL_INDEX) & ~0x007F0000) | (copcount << 16));
-}
-
-__INLINE uint8_t cop_timeout_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(COP_CNTL_INDEX);
-    return ((localVal & 0x00007F00) >> 8);
-}
-
-__INLINE void cop_timeout_setf(uint8_t coptimeout)
-{
-    ASSERT_ERR(((coptimeout << 8) & ~0x00007F00) == 0);
-    sim_reg_crm_wr(COP_CNTL_INDEX, (sim_reg_crm_rd(COP_CNTL_INDEX) & ~0x00007F00) | (coptimeout << 8));
-}
-
-__INLINE uint8_t cop_wp_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(COP_CNTL_INDEX);
-    return ((localVal & 0x00000004) >> 2);
-}
-
-__INLINE void cop_wp_setf(uint8_t copwp)
-{
-    ASSERT_ERR(((copwp << 2) & ~0x00000004) == 0);
-    sim_reg_crm_wr(COP_CNTL_INDEX, (sim_reg_crm_rd(COP_CNTL_INDEX) & ~0x00000004) | (copwp << 2));
-}
-
-__INLINE uint8_t cop_out_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(COP_CNTL_INDEX);
-    return ((localVal & 0x00000002) >> 1);
-}
-
-__INLINE void cop_out_setf(uint8_t copout)
-{
-    ASSERT_ERR(((copout << 1) & ~0x00000002) == 0);
-    sim_reg_crm_wr(COP_CNTL_INDEX, (sim_reg_crm_rd(COP_CNTL_INDEX) & ~0x00000002) | (copout << 1));
-}
-
-__INLINE uint8_t cop_en_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(COP_CNTL_INDEX);
-    return ((localVal & 0x00000001) >> 0);
-}
-
-__INLINE void cop_en_setf(uint8_t copen)
-{
-    ASSERT_ERR(((copen << 0) & ~0x00000001) == 0);
-    sim_reg_crm_wr(COP_CNTL_INDEX, (sim_reg_crm_rd(COP_CNTL_INDEX) & ~0x00000001) | (copen << 0));
-}
-
 /**
  * @brief COP_SERVICE register definition
  * <pre>
@@ -756,16 +217,6 @@ __INLINE void cop_en_setf(uint8_t copen)
  */
 #define COP_SERVICE_INDEX  0x00000005
 
-__INLINE uint32_t cop_service_get(void)
-{
-    return sim_reg_crm_rd(COP_SERVICE_INDEX);
-}
-
-__INLINE void cop_service_set(uint32_t value)
-{
-    sim_reg_crm_wr(COP_SERVICE_INDEX, value);
-}
-
 // field definitions
 #define COP_SERVICE_MASK   0xFFFFFFFF
 #define COP_SERVICE_LSB    0
@@ -773,19 +224,6 @@ __INLINE void cop_service_set(uint32_t value)
 
 #define COP_SERVICE_RST    0x0
 
-__INLINE uint32_t cop_service_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(COP_SERVICE_INDEX);
-    ASSERT_ERR((localVal & ~0xFFFFFFFF) == 0);
-    return (localVal >> 0);
-}
-
-__INLINE void cop_service_setf(uint32_t copservice)
-{
-    ASSERT_ERR(((copservice << 0) & ~0xFFFFFFFF) == 0);
-    sim_reg_crm_wr(COP_SERVICE_INDEX, copservice << 0);
-}
-
 /**
  * @brief STATUS register definition
  * <pre>
@@ -805,16 +243,6 @@ __INLINE void cop_service_setf(uint32_t copservice)
  */
 #define STATUS_INDEX  0x00000006
 
-__INLINE uint32_t status_get(void)
-{
-    return sim_reg_crm_rd(STATUS_INDEX);
-}
-
-__INLINE void status_set(uint32_t value)
-{
-    sim_reg_crm_wr(STATUS_INDEX, value);
-}
-
 // field definitions
 #define VREG_1P5V_RDY_BIT    0x00080000
 #define VREG_1P5V_RDY_POS    19
@@ -849,129 +277,6 @@ __INLINE void status_set(uint32_t value)
 #define HIB_WU_EVT_RST       0x0
 #define SLEEP_SYNC_RST       0x0
 
-__INLINE void status_pack(uint8_t caldone, uint8_t extwuevt, uint8_t rtcwuevt, uint8_t dozewuevt, uint8_t hibwuevt, uint8_t sleepsync)
-{
-    ASSERT_ERR(((caldone << 9) & ~0x00000200) == 0);
-    ASSERT_ERR(((extwuevt << 4) & ~0x000000F0) == 0);
-    ASSERT_ERR(((rtcwuevt << 3) & ~0x00000008) == 0);
-    ASSERT_ERR(((dozewuevt << 2) & ~0x00000004) == 0);
-    ASSERT_ERR(((hibwuevt << 1) & ~0x00000002) == 0);
-    ASSERT_ERR(((sleepsync << 0) & ~0x00000001) == 0);
-    sim_reg_crm_wr(STATUS_INDEX,  (caldone << 9) | (extwuevt << 4) | (rtcwuevt << 3) | (dozewuevt << 2) | (hibwuevt << 1) | (sleepsync << 0));
-}
-
-__INLINE void status_unpack(uint8_t* vreg1p5vrdy, uint8_t* vreg1p8vrdy, uint8_t* vregbuckrdy, uint8_t* copevt, uint8_t* caldone, uint8_t* extwuevt, uint8_t* rtcwuevt, uint8_t* dozewuevt, uint8_t* hibwuevt, uint8_t* sleepsync)
-{
-    uint32_t localVal = sim_reg_crm_rd(STATUS_INDEX);
-
-    *vreg1p5vrdy = (localVal & 0x00080000) >> 19;
-    *vreg1p8vrdy = (localVal & 0x00040000) >> 18;
-    *vregbuckrdy = (localVal & 0x00020000) >> 17;
-    *copevt = (localVal & 0x00000400) >> 10;
-    *caldone = (localVal & 0x00000200) >> 9;
-    *extwuevt = (localVal & 0x000000F0) >> 4;
-    *rtcwuevt = (localVal & 0x00000008) >> 3;
-    *dozewuevt = (localVal & 0x00000004) >> 2;
-    *hibwuevt = (localVal & 0x00000002) >> 1;
-    *sleepsync = (localVal & 0x00000001) >> 0;
-}
-
-__INLINE uint8_t vreg_1p5v_rdy_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(STATUS_INDEX);
-    return ((localVal & 0x00080000) >> 19);
-}
-
-__INLINE uint8_t vreg_1p8v_rdy_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(STATUS_INDEX);
-    return ((localVal & 0x00040000) >> 18);
-}
-
-__INLINE uint8_t vreg_buck_rdy_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(STATUS_INDEX);
-    return ((localVal & 0x00020000) >> 17);
-}
-
-__INLINE uint8_t cop_evt_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(STATUS_INDEX);
-    return ((localVal & 0x00000400) >> 10);
-}
-
-__INLINE uint8_t cal_done_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(STATUS_INDEX);
-    return ((localVal & 0x00000200) >> 9);
-}
-
-__INLINE void cal_done_setf(uint8_t caldone)
-{
-    ASSERT_ERR(((caldone << 9) & ~0x00000200) == 0);
-    sim_reg_crm_wr(STATUS_INDEX, (sim_reg_crm_rd(STATUS_INDEX) & ~0x00000200) | (caldone << 9));
-}
-
-__INLINE uint8_t ext_wu_evt_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(STATUS_INDEX);
-    return ((localVal & 0x000000F0) >> 4);
-}
-
-__INLINE void ext_wu_evt_setf(uint8_t extwuevt)
-{
-    ASSERT_ERR(((extwuevt << 4) & ~0x000000F0) == 0);
-    sim_reg_crm_wr(STATUS_INDEX, (sim_reg_crm_rd(STATUS_INDEX) & ~0x000000F0) | (extwuevt << 4));
-}
-
-__INLINE uint8_t rtc_wu_evt_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(STATUS_INDEX);
-    return ((localVal & 0x00000008) >> 3);
-}
-
-__INLINE void rtc_wu_evt_setf(uint8_t rtcwuevt)
-{
-    ASSERT_ERR(((rtcwuevt << 3) & ~0x00000008) == 0);
-    sim_reg_crm_wr(STATUS_INDEX, (sim_reg_crm_rd(STATUS_INDEX) & ~0x00000008) | (rtcwuevt << 3));
-}
-
-__INLINE uint8_t doze_wu_evt_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(STATUS_INDEX);
-    return ((localVal & 0x00000004) >> 2);
-}
-
-__INLINE void doze_wu_evt_setf(uint8_t dozewuevt)
-{
-    ASSERT_ERR(((dozewuevt << 2) & ~0x00000004) == 0);
-    sim_reg_crm_wr(STATUS_INDEX, (sim_reg_crm_rd(STATUS_INDEX) & ~0x00000004) | (dozewuevt << 2));
-}
-
-__INLINE uint8_t hib_wu_evt_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(STATUS_INDEX);
-    return ((localVal & 0x00000002) >> 1);
-}
-
-__INLINE void hib_wu_evt_setf(uint8_t hibwuevt)
-{
-    ASSERT_ERR(((hibwuevt << 1) & ~0x00000002) == 0);
-    sim_reg_crm_wr(STATUS_INDEX, (sim_reg_crm_rd(STATUS_INDEX) & ~0x00000002) | (hibwuevt << 1));
-}
-
-__INLINE uint8_t sleep_sync_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(STATUS_INDEX);
-    return ((localVal & 0x00000001) >> 0);
-}
-
-__INLINE void sleep_sync_setf(uint8_t sleepsync)
-{
-    ASSERT_ERR(((sleepsync << 0) & ~0x00000001) == 0);
-    sim_reg_crm_wr(STATUS_INDEX, (sim_reg_crm_rd(STATUS_INDEX) & ~0x00000001) | (sleepsync << 0));
-}
-
 /**
  * @brief MOD_STATUS register definition
  * <pre>
@@ -997,16 +302,6 @@ __INLINE void sleep_sync_setf(uint8_t sleepsync)
  */
 #define MOD_STATUS_INDEX  0x00000007
 
-__INLINE uint32_t mod_status_get(void)
-{
-    return sim_reg_crm_rd(MOD_STATUS_INDEX);
-}
-
-__INLINE void mod_status_set(uint32_t value)
-{
-    sim_reg_crm_wr(MOD_STATUS_INDEX, value);
-}
-
 // field definitions
 #define AIM_EN_BIT      0x00020000
 #define AIM_EN_POS      17
@@ -1058,124 +353,6 @@ __INLINE void mod_status_set(uint32_t value)
 #define MACA_EN_RST     0x0
 #define ARM_EN_RST      0x0
 
-__INLINE void mod_status_unpack(uint8_t* aimen, uint8_t* nexen, uint8_t* jtaen, uint8_t* adcen, uint8_t* spifen, uint8_t* ssien, uint8_t* i2cen, uint8_t* rifen, uint8_t* tmren, uint8_t* uart2en, uint8_t* uart1en, uint8_t* gpioen, uint8_t* spien, uint8_t* asmen, uint8_t* macaen, uint8_t* armen)
-{
-    uint32_t localVal = sim_reg_crm_rd(MOD_STATUS_INDEX);
-
-    *aimen = (localVal & 0x00020000) >> 17;
-    *nexen = (localVal & 0x00008000) >> 15;
-    *jtaen = (localVal & 0x00004000) >> 14;
-    *adcen = (localVal & 0x00001000) >> 12;
-    *spifen = (localVal & 0x00000800) >> 11;
-    *ssien = (localVal & 0x00000400) >> 10;
-    *i2cen = (localVal & 0x00000200) >> 9;
-    *rifen = (localVal & 0x00000100) >> 8;
-    *tmren = (localVal & 0x00000080) >> 7;
-    *uart2en = (localVal & 0x00000040) >> 6;
-    *uart1en = (localVal & 0x00000020) >> 5;
-    *gpioen = (localVal & 0x00000010) >> 4;
-    *spien = (localVal & 0x00000008) >> 3;
-    *asmen = (localVal & 0x00000004) >> 2;
-    *macaen = (localVal & 0x00000002) >> 1;
-    *armen = (localVal & 0x00000001) >> 0;
-}
-
-__INLINE uint8_t aim_en_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(MOD_STATUS_INDEX);
-    return ((localVal & 0x00020000) >> 17);
-}
-
-__INLINE uint8_t nex_en_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(MOD_STATUS_INDEX);
-    return ((localVal & 0x00008000) >> 15);
-}
-
-__INLINE uint8_t jta_en_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(MOD_STATUS_INDEX);
-    return ((localVal & 0x00004000) >> 14);
-}
-
-__INLINE uint8_t adc_en_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(MOD_STATUS_INDEX);
-    return ((localVal & 0x00001000) >> 12);
-}
-
-__INLINE uint8_t spif_en_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(MOD_STATUS_INDEX);
-    return ((localVal & 0x00000800) >> 11);
-}
-
-__INLINE uint8_t ssi_en_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(MOD_STATUS_INDEX);
-    return ((localVal & 0x00000400) >> 10);
-}
-
-__INLINE uint8_t i2c_en_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(MOD_STATUS_INDEX);
-    return ((localVal & 0x00000200) >> 9);
-}
-
-__INLINE uint8_t rif_en_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(MOD_STATUS_INDEX);
-    return ((localVal & 0x00000100) >> 8);
-}
-
-__INLINE uint8_t tmr_en_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(MOD_STATUS_INDEX);
-    return ((localVal & 0x00000080) >> 7);
-}
-
-__INLINE uint8_t uart2_en_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(MOD_STATUS_INDEX);
-    return ((localVal & 0x00000040) >> 6);
-}
-
-__INLINE uint8_t uart1_en_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(MOD_STATUS_INDEX);
-    return ((localVal & 0x00000020) >> 5);
-}
-
-__INLINE uint8_t gpio_en_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(MOD_STATUS_INDEX);
-    return ((localVal & 0x00000010) >> 4);
-}
-
-__INLINE uint8_t spi_en_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(MOD_STATUS_INDEX);
-    return ((localVal & 0x00000008) >> 3);
-}
-
-__INLINE uint8_t asm_en_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(MOD_STATUS_INDEX);
-    return ((localVal & 0x00000004) >> 2);
-}
-
-__INLINE uint8_t maca_en_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(MOD_STATUS_INDEX);
-    return ((localVal & 0x00000002) >> 1);
-}
-
-__INLINE uint8_t arm_en_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(MOD_STATUS_INDEX);
-    return ((localVal & 0x00000001) >> 0);
-}
-
 /**
  * @brief WU_COUNT register definition
  * <pre>
@@ -1186,16 +363,6 @@ __INLINE uint8_t arm_en_getf(void)
  */
 #define WU_COUNT_INDEX  0x00000008
 
-__INLINE uint32_t wu_count_get(void)
-{
-    return sim_reg_crm_rd(WU_COUNT_INDEX);
-}
-
-__INLINE void wu_count_set(uint32_t value)
-{
-    sim_reg_crm_wr(WU_COUNT_INDEX, value);
-}
-
 // field definitions
 #define WU_COUNT_MASK   0xFFFFFFFF
 #define WU_COUNT_LSB    0
@@ -1203,13 +370,6 @@ __INLINE void wu_count_set(uint32_t value)
 
 #define WU_COUNT_RST    0x0
 
-__INLINE uint32_t wu_count_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(WU_COUNT_INDEX);
-    ASSERT_ERR((localVal & ~0xFFFFFFFF) == 0);
-    return (localVal >> 0);
-}
-
 /**
  * @brief WU_TIMEOUT register definition
  * <pre>
@@ -1220,16 +380,6 @@ __INLINE uint32_t wu_count_getf(void)
  */
 #define WU_TIMEOUT_INDEX  0x00000009
 
-__INLINE uint32_t wu_timeout_get(void)
-{
-    return sim_reg_crm_rd(WU_TIMEOUT_INDEX);
-}
-
-__INLINE void wu_timeout_set(uint32_t value)
-{
-    sim_reg_crm_wr(WU_TIMEOUT_INDEX, value);
-}
-
 // field definitions
 #define WU_TIMEOUT_MASK   0xFFFFFFFF
 #define WU_TIMEOUT_LSB    0
@@ -1237,19 +387,6 @@ __INLINE void wu_timeout_set(uint32_t value)
 
 #define WU_TIMEOUT_RST    0x0
 
-__INLINE uint32_t wu_timeout_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(WU_TIMEOUT_INDEX);
-    ASSERT_ERR((localVal & ~0xFFFFFFFF) == 0);
-    return (localVal >> 0);
-}
-
-__INLINE void wu_timeout_setf(uint32_t wutimeout)
-{
-    ASSERT_ERR(((wutimeout << 0) & ~0xFFFFFFFF) == 0);
-    sim_reg_crm_wr(WU_TIMEOUT_INDEX, wutimeout << 0);
-}
-
 /**
  * @brief RTC_COUNT register definition
  * <pre>
@@ -1260,16 +397,6 @@ __INLINE void wu_timeout_setf(uint32_t wutimeout)
  */
 #define RTC_COUNT_INDEX  0x0000000A
 
-__INLINE uint32_t rtc_count_get(void)
-{
-    return sim_reg_crm_rd(RTC_COUNT_INDEX);
-}
-
-__INLINE void rtc_count_set(uint32_t value)
-{
-    sim_reg_crm_wr(RTC_COUNT_INDEX, value);
-}
-
 // field definitions
 #define RTC_COUNT_MASK   0xFFFFFFFF
 #define RTC_COUNT_LSB    0
@@ -1277,13 +404,6 @@ __INLINE void rtc_count_set(uint32_t value)
 
 #define RTC_COUNT_RST    0x0
 
-__INLINE uint32_t rtc_count_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(RTC_COUNT_INDEX);
-    ASSERT_ERR((localVal & ~0xFFFFFFFF) == 0);
-    return (localVal >> 0);
-}
-
 /**
  * @brief RTC_TIMEOUT register definition
  * <pre>
@@ -1294,16 +414,6 @@ __INLINE uint32_t rtc_count_getf(void)
  */
 #define RTC_TIMEOUT_INDEX  0x0000000B
 
-__INLINE uint32_t rtc_timeout_get(void)
-{
-    return sim_reg_crm_rd(RTC_TIMEOUT_INDEX);
-}
-
-__INLINE void rtc_timeout_set(uint32_t value)
-{
-    sim_reg_crm_wr(RTC_TIMEOUT_INDEX, value);
-}
-
 // field definitions
 #define RTC_TIMEOUT_MASK   0xFFFFFFFF
 #define RTC_TIMEOUT_LSB    0
@@ -1311,19 +421,6 @@ __INLINE void rtc_timeout_set(uint32_t value)
 
 #define RTC_TIMEOUT_RST    0x0
 
-__INLINE uint32_t rtc_timeout_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(RTC_TIMEOUT_INDEX);
-    ASSERT_ERR((localVal & ~0xFFFFFFFF) == 0);
-    return (localVal >> 0);
-}
-
-__INLINE void rtc_timeout_setf(uint32_t rtctimeout)
-{
-    ASSERT_ERR(((rtctimeout << 0) & ~0xFFFFFFFF) == 0);
-    sim_reg_crm_wr(RTC_TIMEOUT_INDEX, rtctimeout << 0);
-}
-
 /**
  * @brief CAL_CNTL register definition
  * <pre>
@@ -1336,16 +433,6 @@ __INLINE void rtc_timeout_setf(uint32_t rtctimeout)
  */
 #define CAL_CNTL_INDEX  0x0000000D
 
-__INLINE uint32_t cal_cntl_get(void)
-{
-    return sim_reg_crm_rd(CAL_CNTL_INDEX);
-}
-
-__INLINE void cal_cntl_set(uint32_t value)
-{
-    sim_reg_crm_wr(CAL_CNTL_INDEX, value);
-}
-
 // field definitions
 #define CAL_IEN_BIT        0x00020000
 #define CAL_IEN_POS        17
@@ -1359,59 +446,6 @@ __INLINE void cal_cntl_set(uint32_t value)
 #define CAL_EN_RST         0x0
 #define CAL_TIMEOUT_RST    0x0
 
-__INLINE void cal_cntl_pack(uint8_t calien, uint8_t calen, uint16_t caltimeout)
-{
-    ASSERT_ERR(((calien << 17) & ~0x00020000) == 0);
-    ASSERT_ERR(((calen << 16) & ~0x00010000) == 0);
-    ASSERT_ERR(((caltimeout << 0) & ~0x0000FFFF) == 0);
-    sim_reg_crm_wr(CAL_CNTL_INDEX,  (calien << 17) | (calen << 16) | (caltimeout << 0));
-}
-
-__INLINE void cal_cntl_unpack(uint8_t* calien, uint8_t* calen, uint16_t* caltimeout)
-{
-    uint32_t localVal = sim_reg_crm_rd(CAL_CNTL_INDEX);
-
-    *calien = (localVal & 0x00020000) >> 17;
-    *calen = (localVal & 0x00010000) >> 16;
-    *caltimeout = (localVal & 0x0000FFFF) >> 0;
-}
-
-__INLINE uint8_t cal_ien_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(CAL_CNTL_INDEX);
-    return ((localVal & 0x00020000) >> 17);
-}
-
-__INLINE void cal_ien_setf(uint8_t calien)
-{
-    ASSERT_ERR(((calien << 17) & ~0x00020000) == 0);
-    sim_reg_crm_wr(CAL_CNTL_INDEX, (sim_reg_crm_rd(CAL_CNTL_INDEX) & ~0x00020000) | (calien << 17));
-}
-
-__INLINE uint8_t cal_en_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(CAL_CNTL_INDEX);
-    return ((localVal & 0x00010000) >> 16);
-}
-
-__INLINE void cal_en_setf(uint8_t calen)
-{
-    ASSERT_ERR(((calen << 16) & ~0x00010000) == 0);
-    sim_reg_crm_wr(CAL_CNTL_INDEX, (sim_reg_crm_rd(CAL_CNTL_INDEX) & ~0x00010000) | (calen << 16));
-}
-
-__INLINE uint16_t cal_timeout_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(CAL_CNTL_INDEX);
-    return ((localVal & 0x0000FFFF) >> 0);
-}
-
-__INLINE void cal_timeout_setf(uint16_t caltimeout)
-{
-    ASSERT_ERR(((caltimeout << 0) & ~0x0000FFFF) == 0);
-    sim_reg_crm_wr(CAL_CNTL_INDEX, (sim_reg_crm_rd(CAL_CNTL_INDEX) & ~0x0000FFFF) | (caltimeout << 0));
-}
-
 /**
  * @brief CAL_COUNT register definition
  * <pre>
@@ -1422,16 +456,6 @@ __INLINE void cal_timeout_setf(uint16_t caltimeout)
  */
 #define CAL_COUNT_INDEX  0x0000000E
 
-__INLINE uint32_t cal_count_get(void)
-{
-    return sim_reg_crm_rd(CAL_COUNT_INDEX);
-}
-
-__INLINE void cal_count_set(uint32_t value)
-{
-    sim_reg_crm_wr(CAL_COUNT_INDEX, value);
-}
-
 // field definitions
 #define CAL_COUNT_MASK   0xFFFFFFFF
 #define CAL_COUNT_LSB    0
@@ -1439,13 +463,6 @@ __INLINE void cal_count_set(uint32_t value)
 
 #define CAL_COUNT_RST    0x0
 
-__INLINE uint32_t cal_count_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(CAL_COUNT_INDEX);
-    ASSERT_ERR((localVal & ~0xFFFFFFFF) == 0);
-    return (localVal >> 0);
-}
-
 /**
  * @brief RINGOSC_CNTL register definition
  * <pre>
@@ -1458,16 +475,6 @@ __INLINE uint32_t cal_count_getf(void)
  */
 #define RINGOSC_CNTL_INDEX  0x0000000F
 
-__INLINE uint32_t ringosc_cntl_get(void)
-{
-    return sim_reg_crm_rd(RINGOSC_CNTL_INDEX);
-}
-
-__INLINE void ringosc_cntl_set(uint32_t value)
-{
-    sim_reg_crm_wr(RINGOSC_CNTL_INDEX, value);
-}
-
 // field definitions
 #define ROSC_CTUNE_MASK   0x00001E00
 #define ROSC_CTUNE_LSB    9
@@ -1482,59 +489,6 @@ __INLINE void ringosc_cntl_set(uint32_t value)
 #define ROSC_FTUNE_RST    0x0
 #define ROSC_EN_RST       0x0
 
-__INLINE void ringosc_cntl_pack(uint8_t roscctune, uint8_t roscftune, uint8_t roscen)
-{
-    ASSERT_ERR(((roscctune << 9) & ~0x00001E00) == 0);
-    ASSERT_ERR(((roscftune << 4) & ~0x000001F0) == 0);
-    ASSERT_ERR(((roscen << 0) & ~0x00000001) == 0);
-    sim_reg_crm_wr(RINGOSC_CNTL_INDEX,  (roscctune << 9) | (roscftune << 4) | (roscen << 0));
-}
-
-__INLINE void ringosc_cntl_unpack(uint8_t* roscctune, uint8_t* roscftune, uint8_t* roscen)
-{
-    uint32_t localVal = sim_reg_crm_rd(RINGOSC_CNTL_INDEX);
-
-    *roscctune = (localVal & 0x00001E00) >> 9;
-    *roscftune = (localVal & 0x000001F0) >> 4;
-    *roscen = (localVal & 0x00000001) >> 0;
-}
-
-__INLINE uint8_t rosc_ctune_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(RINGOSC_CNTL_INDEX);
-    return ((localVal & 0x00001E00) >> 9);
-}
-
-__INLINE void rosc_ctune_setf(uint8_t roscctune)
-{
-    ASSERT_ERR(((roscctune << 9) & ~0x00001E00) == 0);
-    sim_reg_crm_wr(RINGOSC_CNTL_INDEX, (sim_reg_crm_rd(RINGOSC_CNTL_INDEX) & ~0x00001E00) | (roscctune << 9));
-}
-
-__INLINE uint8_t rosc_ftune_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(RINGOSC_CNTL_INDEX);
-    return ((localVal & 0x000001F0) >> 4);
-}
-
-__INLINE void rosc_ftune_setf(uint8_t roscftune)
-{
-    ASSERT_ERR(((roscftune << 4) & ~0x000001F0) == 0);
-    sim_reg_crm_wr(RINGOSC_CNTL_INDEX, (sim_reg_crm_rd(RINGOSC_CNTL_INDEX) & ~0x000001F0) | (roscftune << 4));
-}
-
-__INLINE uint8_t rosc_en_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(RINGOSC_CNTL_INDEX);
-    return ((localVal & 0x00000001) >> 0);
-}
-
-__INLINE void rosc_en_setf(uint8_t roscen)
-{
-    ASSERT_ERR(((roscen << 0) & ~0x00000001) == 0);
-    sim_reg_crm_wr(RINGOSC_CNTL_INDEX, (sim_reg_crm_rd(RINGOSC_CNTL_INDEX) & ~0x00000001) | (roscen << 0));
-}
-
 /**
  * @brief XTAL_CNTL register definition
  * <pre>
@@ -1547,16 +501,6 @@ __INLINE void rosc_en_setf(uint8_t roscen)
  */
 #define XTAL_CNTL_INDEX  0x00000010
 
-__INLINE uint32_t xtal_cntl_get(void)
-{
-    return sim_reg_crm_rd(XTAL_CNTL_INDEX);
-}
-
-__INLINE void xtal_cntl_set(uint32_t value)
-{
-    sim_reg_crm_wr(XTAL_CNTL_INDEX, value);
-}
-
 // field definitions
 #define XTAL_CTUNE_MASK       0x03E00000
 #define XTAL_CTUNE_LSB        21
@@ -1572,59 +516,6 @@ __INLINE void xtal_cntl_set(uint32_t value)
 #define XTAL_FTUNE_RST        0x0
 #define XTAL_IBIAS_SEL_RST    0x0
 
-__INLINE void xtal_cntl_pack(uint8_t xtalctune, uint8_t xtalftune, uint8_t xtalibiassel)
-{
-    ASSERT_ERR(((xtalctune << 21) & ~0x03E00000) == 0);
-    ASSERT_ERR(((xtalftune << 16) & ~0x001F0000) == 0);
-    ASSERT_ERR(((xtalibiassel << 8) & ~0x00000F00) == 0);
-    sim_reg_crm_wr(XTAL_CNTL_INDEX,  (xtalctune << 21) | (xtalftune << 16) | (xtalibiassel << 8));
-}
-
-__INLINE void xtal_cntl_unpack(uint8_t* xtalctune, uint8_t* xtalftune, uint8_t* xtalibiassel)
-{
-    uint32_t localVal = sim_reg_crm_rd(XTAL_CNTL_INDEX);
-
-    *xtalctune = (localVal & 0x03E00000) >> 21;
-    *xtalftune = (localVal & 0x001F0000) >> 16;
-    *xtalibiassel = (localVal & 0x00000F00) >> 8;
-}
-
-__INLINE uint8_t xtal_ctune_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(XTAL_CNTL_INDEX);
-    return ((localVal & 0x03E00000) >> 21);
-}
-
-__INLINE void xtal_ctune_setf(uint8_t xtalctune)
-{
-    ASSERT_ERR(((xtalctune << 21) & ~0x03E00000) == 0);
-    sim_reg_crm_wr(XTAL_CNTL_INDEX, (sim_reg_crm_rd(XTAL_CNTL_INDEX) & ~0x03E00000) | (xtalctune << 21));
-}
-
-__INLINE uint8_t xtal_ftune_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(XTAL_CNTL_INDEX);
-    return ((localVal & 0x001F0000) >> 16);
-}
-
-__INLINE void xtal_ftune_setf(uint8_t xtalftune)
-{
-    ASSERT_ERR(((xtalftune << 16) & ~0x001F0000) == 0);
-    sim_reg_crm_wr(XTAL_CNTL_INDEX, (sim_reg_crm_rd(XTAL_CNTL_INDEX) & ~0x001F0000) | (xtalftune << 16));
-}
-
-__INLINE uint8_t xtal_ibias_sel_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(XTAL_CNTL_INDEX);
-    return ((localVal & 0x00000F00) >> 8);
-}
-
-__INLINE void xtal_ibias_sel_setf(uint8_t xtalibiassel)
-{
-    ASSERT_ERR(((xtalibiassel << 8) & ~0x00000F00) == 0);
-    sim_reg_crm_wr(XTAL_CNTL_INDEX, (sim_reg_crm_rd(XTAL_CNTL_INDEX) & ~0x00000F00) | (xtalibiassel << 8));
-}
-
 /**
  * @brief XTAL32_CNTL register definition
  * <pre>
@@ -1636,16 +527,6 @@ __INLINE void xtal_ibias_sel_setf(uint8_t xtalibiassel)
  */
 #define XTAL32_CNTL_INDEX  0x00000011
 
-__INLINE uint32_t xtal32_cntl_get(void)
-{
-    return sim_reg_crm_rd(XTAL32_CNTL_INDEX);
-}
-
-__INLINE void xtal32_cntl_set(uint32_t value)
-{
-    sim_reg_crm_wr(XTAL32_CNTL_INDEX, value);
-}
-
 // field definitions
 #define XTAL32_GAIN_MASK   0x00000030
 #define XTAL32_GAIN_LSB    4
@@ -1656,45 +537,6 @@ __INLINE void xtal32_cntl_set(uint32_t value)
 #define XTAL32_GAIN_RST    0x3
 #define XTAL32_EN_RST      0x0
 
-__INLINE void xtal32_cntl_pack(uint8_t xtal32gain, uint8_t xtal32en)
-{
-    ASSERT_ERR(((xtal32gain << 4) & ~0x00000030) == 0);
-    ASSERT_ERR(((xtal32en << 0) & ~0x00000001) == 0);
-    sim_reg_crm_wr(XTAL32_CNTL_INDEX,  (xtal32gain << 4) | (xtal32en << 0));
-}
-
-__INLINE void xtal32_cntl_unpack(uint8_t* xtal32gain, uint8_t* xtal32en)
-{
-    uint32_t localVal = sim_reg_crm_rd(XTAL32_CNTL_INDEX);
-
-    *xtal32gain = (localVal & 0x00000030) >> 4;
-    *xtal32en = (localVal & 0x00000001) >> 0;
-}
-
-__INLINE uint8_t xtal32_gain_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(XTAL32_CNTL_INDEX);
-    return ((localVal & 0x00000030) >> 4);
-}
-
-__INLINE void xtal32_gain_setf(uint8_t xtal32gain)
-{
-    ASSERT_ERR(((xtal32gain << 4) & ~0x00000030) == 0);
-    sim_reg_crm_wr(XTAL32_CNTL_INDEX, (sim_reg_crm_rd(XTAL32_CNTL_INDEX) & ~0x00000030) | (xtal32gain << 4));
-}
-
-__INLINE uint8_t xtal32_en_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(XTAL32_CNTL_INDEX);
-    return ((localVal & 0x00000001) >> 0);
-}
-
-__INLINE void xtal32_en_setf(uint8_t xtal32en)
-{
-    ASSERT_ERR(((xtal32en << 0) & ~0x00000001) == 0);
-    sim_reg_crm_wr(XTAL32_CNTL_INDEX, (sim_reg_crm_rd(XTAL32_CNTL_INDEX) & ~0x00000001) | (xtal32en << 0));
-}
-
 /**
  * @brief VREG_CNTL register definition
  * <pre>
@@ -1711,16 +553,6 @@ __INLINE void xtal32_en_setf(uint8_t xtal32en)
  */
 #define VREG_CNTL_INDEX  0x00000012
 
-__INLINE uint32_t vreg_cntl_get(void)
-{
-    return sim_reg_crm_rd(VREG_CNTL_INDEX);
-}
-
-__INLINE void vreg_cntl_set(uint32_t value)
-{
-    sim_reg_crm_wr(VREG_CNTL_INDEX, value);
-}
-
 // field definitions
 #define BUCK_CLKDIV_MASK        0x00000F00
 #define BUCK_CLKDIV_LSB         8
@@ -1748,115 +580,6 @@ __INLINE void vreg_cntl_set(uint32_t value)
 #define BUCK_SYNC_REC_EN_RST    0x0
 #define BUCK_EN_RST             0x0
 
-__INLINE void vreg_cntl_pack(uint8_t buckclkdiv, uint8_t vreg1p8ven, uint8_t vreg1p5vsel, uint8_t vreg1p5ven, uint8_t buckbypassen, uint8_t bucksyncrecen, uint8_t bucken)
-{
-    ASSERT_ERR(((buckclkdiv << 8) & ~0x00000F00) == 0);
-    ASSERT_ERR(((vreg1p8ven << 7) & ~0x00000080) == 0);
-    ASSERT_ERR(((vreg1p5vsel << 5) & ~0x00000060) == 0);
-    ASSERT_ERR(((vreg1p5ven << 3) & ~0x00000018) == 0);
-    ASSERT_ERR(((buckbypassen << 2) & ~0x00000004) == 0);
-    ASSERT_ERR(((bucksyncrecen << 1) & ~0x00000002) == 0);
-    ASSERT_ERR(((bucken << 0) & ~0x00000001) == 0);
-    sim_reg_crm_wr(VREG_CNTL_INDEX,  (buckclkdiv << 8) | (vreg1p8ven << 7) | (vreg1p5vsel << 5) | (vreg1p5ven << 3) | (buckbypassen << 2) | (bucksyncrecen << 1) | (bucken << 0));
-}
-
-__INLINE void vreg_cntl_unpack(uint8_t* buckclkdiv, uint8_t* vreg1p8ven, uint8_t* vreg1p5vsel, uint8_t* vreg1p5ven, uint8_t* buckbypassen, uint8_t* bucksyncrecen, uint8_t* bucken)
-{
-    uint32_t localVal = sim_reg_crm_rd(VREG_CNTL_INDEX);
-
-    *buckclkdiv = (localVal & 0x00000F00) >> 8;
-    *vreg1p8ven = (localVal & 0x00000080) >> 7;
-    *vreg1p5vsel = (localVal & 0x00000060) >> 5;
-    *vreg1p5ven = (localVal & 0x00000018) >> 3;
-    *buckbypassen = (localVal & 0x00000004) >> 2;
-    *bucksyncrecen = (localVal & 0x00000002) >> 1;
-    *bucken = (localVal & 0x00000001) >> 0;
-}
-
-__INLINE uint8_t buck_clkdiv_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(VREG_CNTL_INDEX);
-    return ((localVal & 0x00000F00) >> 8);
-}
-
-__INLINE void buck_clkdiv_setf(uint8_t buckclkdiv)
-{
-    ASSERT_ERR(((buckclkdiv << 8) & ~0x00000F00) == 0);
-    sim_reg_crm_wr(VREG_CNTL_INDEX, (sim_reg_crm_rd(VREG_CNTL_INDEX) & ~0x00000F00) | (buckclkdiv << 8));
-}
-
-__INLINE uint8_t vreg_1p8v_en_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(VREG_CNTL_INDEX);
-    return ((localVal & 0x00000080) >> 7);
-}
-
-__INLINE void vreg_1p8v_en_setf(uint8_t vreg1p8ven)
-{
-    ASSERT_ERR(((vreg1p8ven << 7) & ~0x00000080) == 0);
-    sim_reg_crm_wr(VREG_CNTL_INDEX, (sim_reg_crm_rd(VREG_CNTL_INDEX) & ~0x00000080) | (vreg1p8ven << 7));
-}
-
-__INLINE uint8_t vreg_1p5v_sel_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(VREG_CNTL_INDEX);
-    return ((localVal & 0x00000060) >> 5);
-}
-
-__INLINE void vreg_1p5v_sel_setf(uint8_t vreg1p5vsel)
-{
-    ASSERT_ERR(((vreg1p5vsel << 5) & ~0x00000060) == 0);
-    sim_reg_crm_wr(VREG_CNTL_INDEX, (sim_reg_crm_rd(VREG_CNTL_INDEX) & ~0x00000060) | (vreg1p5vsel << 5));
-}
-
-__INLINE uint8_t vreg_1p5v_en_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(VREG_CNTL_INDEX);
-    return ((localVal & 0x00000018) >> 3);
-}
-
-__INLINE void vreg_1p5v_en_setf(uint8_t vreg1p5ven)
-{
-    ASSERT_ERR(((vreg1p5ven << 3) & ~0x00000018) == 0);
-    sim_reg_crm_wr(VREG_CNTL_INDEX, (sim_reg_crm_rd(VREG_CNTL_INDEX) & ~0x00000018) | (vreg1p5ven << 3));
-}
-
-__INLINE uint8_t buck_bypass_en_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(VREG_CNTL_INDEX);
-    return ((localVal & 0x00000004) >> 2);
-}
-
-__INLINE void buck_bypass_en_setf(uint8_t buckbypassen)
-{
-    ASSERT_ERR(((buckbypassen << 2) & ~0x00000004) == 0);
-    sim_reg_crm_wr(VREG_CNTL_INDEX, (sim_reg_crm_rd(VREG_CNTL_INDEX) & ~0x00000004) | (buckbypassen << 2));
-}
-
-__INLINE uint8_t buck_sync_rec_en_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(VREG_CNTL_INDEX);
-    return ((localVal & 0x00000002) >> 1);
-}
-
-__INLINE void buck_sync_rec_en_setf(uint8_t bucksyncrecen)
-{
-    ASSERT_ERR(((bucksyncrecen << 1) & ~0x00000002) == 0);
-    sim_reg_crm_wr(VREG_CNTL_INDEX, (sim_reg_crm_rd(VREG_CNTL_INDEX) & ~0x00000002) | (bucksyncrecen << 1));
-}
-
-__INLINE uint8_t buck_en_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(VREG_CNTL_INDEX);
-    return ((localVal & 0x00000001) >> 0);
-}
-
-__INLINE void buck_en_setf(uint8_t bucken)
-{
-    ASSERT_ERR(((bucken << 0) & ~0x00000001) == 0);
-    sim_reg_crm_wr(VREG_CNTL_INDEX, (sim_reg_crm_rd(VREG_CNTL_INDEX) & ~0x00000001) | (bucken << 0));
-}
-
 /**
  * @brief SW_RST register definition
  * <pre>
@@ -1867,16 +590,6 @@ __INLINE void buck_en_setf(uint8_t bucken)
  */
 #define SW_RST_INDEX  0x00000014
 
-__INLINE uint32_t sw_rst_get(void)
-{
-    return sim_reg_crm_rd(SW_RST_INDEX);
-}
-
-__INLINE void sw_rst_set(uint32_t value)
-{
-    sim_reg_crm_wr(SW_RST_INDEX, value);
-}
-
 // field definitions
 #define SW_RST_MASK   0xFFFFFFFF
 #define SW_RST_LSB    0
@@ -1884,19 +597,1872 @@ __INLINE void sw_rst_set(uint32_t value)
 
 #define SW_RST_RST    0x87651234
 
-__INLINE uint32_t sw_rst_getf(void)
-{
-    uint32_t localVal = sim_reg_crm_rd(SW_RST_INDEX);
-    ASSERT_ERR((localVal & ~0xFFFFFFFF) == 0);
-    return (localVal >> 0);
-}
-
-__INLINE void sw_rst_setf(uint32_t swrst)
-{
-    ASSERT_ERR(((swrst << 0) & ~0xFFFFFFFF) == 0);
-    sim_reg_crm_wr(SW_RST_INDEX, swrst << 0);
-}
-
+/**
+ * @brief Register map of the REG_CRM block, to be derived by the block model
+ *
+ * The register accesses are dispatched at compile time to the register hooks
+ * {regname}_rd() and {regname}_wr(value) of the model, which only redefines the
+ * hooks of the registers having side effects.
+ * @param MODEL Block model deriving from this class
+ */
+template <typename MODEL>
+struct RegCrm : Peripheral<REG_CRM_COUNT>
+{
+    /** Constructor
+     * @param[in] name Name of the module
+     */
+    RegCrm(sc_core::sc_module_name name)
+    : Peripheral<REG_CRM_COUNT>(name)
+    {
+        this->set_reg_names(&reg_name);
+    }
+
+    /** Name of a register
+     * @param[in] index Index of the register
+     * @return The name of the register, NULL if there is no register at this index
+     */
+    static const char*
+    reg_name(uint32_t index)
+    {
+        static const char* const names[REG_CRM_COUNT] =
+        {
+            "SYS_CNTL",
+            "WU_CNTL",
+            "SLEEP_CNTL",
+            "BS_CNTL",
+            "COP_CNTL",
+            "COP_SERVICE",
+            "STATUS",
+            "MOD_STATUS",
+            "WU_COUNT",
+            "WU_TIMEOUT",
+            "RTC_COUNT",
+            "RTC_TIMEOUT",
+            NULL,
+            "CAL_CNTL",
+            "CAL_COUNT",
+            "RINGOSC_CNTL",
+            "XTAL_CNTL",
+            "XTAL32_CNTL",
+            "VREG_CNTL",
+            NULL,
+            "SW_RST",
+        };
+
+        return (index < REG_CRM_COUNT) ? names[index] : NULL;
+    }
+
+    uint32_t sys_cntl_get(void)
+    {
+        return this->m_reg[SYS_CNTL_INDEX];
+    }
+
+    void sys_cntl_set(uint32_t value)
+    {
+        this->m_reg[SYS_CNTL_INDEX] = value;
+    }
+
+    typedef RegField<SYS_CNTL_INDEX, 0x00003F00, 8> xtal_clkdiv_field;
+    typedef RegField<SYS_CNTL_INDEX, 0x00000020, 5> xtal32_exists_field;
+    typedef RegField<SYS_CNTL_INDEX, 0x00000010, 4> jtag_secu_off_field;
+    typedef RegField<SYS_CNTL_INDEX, 0x00000008, 3> spif_1p8v_sel_field;
+    typedef RegField<SYS_CNTL_INDEX, 0x00000004, 2> pads_1p8v_sel_field;
+    typedef RegField<SYS_CNTL_INDEX, 0x00000003, 0> pwr_source_field;
+
+    void sys_cntl_pack(uint8_t xtalclkdiv, uint8_t xtal32exists, uint8_t jtagsecuoff, uint8_t spif1p8vsel, uint8_t pads1p8vsel, uint8_t pwrsource)
+    {
+        ASSERT_ERR(((xtalclkdiv << 8) & ~0x00003F00) == 0);
+        ASSERT_ERR(((xtal32exists << 5) & ~0x00000020) == 0);
+        ASSERT_ERR(((jtagsecuoff << 4) & ~0x00000010) == 0);
+        ASSERT_ERR(((spif1p8vsel << 3) & ~0x00000008) == 0);
+        ASSERT_ERR(((pads1p8vsel << 2) & ~0x00000004) == 0);
+        ASSERT_ERR(((pwrsource << 0) & ~0x00000003) == 0);
+        this->m_reg[SYS_CNTL_INDEX] =  (xtalclkdiv << 8) | (xtal32exists << 5) | (jtagsecuoff << 4) | (spif1p8vsel << 3) | (pads1p8vsel << 2) | (pwrsource << 0);
+    }
+
+    void sys_cntl_unpack(uint8_t* xtalclkdiv, uint8_t* xtal32exists, uint8_t* jtagsecuoff, uint8_t* spif1p8vsel, uint8_t* pads1p8vsel, uint8_t* pwrsource)
+    {
+        uint32_t localVal = this->m_reg[SYS_CNTL_INDEX];
+
+        *xtalclkdiv = (localVal & 0x00003F00) >> 8;
+        *xtal32exists = (localVal & 0x00000020) >> 5;
+        *jtagsecuoff = (localVal & 0x00000010) >> 4;
+        *spif1p8vsel = (localVal & 0x00000008) >> 3;
+        *pads1p8vsel = (localVal & 0x00000004) >> 2;
+        *pwrsource = (localVal & 0x00000003) >> 0;
+    }
+
+    uint8_t xtal_clkdiv_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SYS_CNTL_INDEX];
+        return ((localVal & 0x00003F00) >> 8);
+    }
+
+    void xtal_clkdiv_setf(uint8_t xtalclkdiv)
+    {
+        ASSERT_ERR(((xtalclkdiv << 8) & ~0x00003F00) == 0);
+        this->m_reg[SYS_CNTL_INDEX] = (this->m_reg[SYS_CNTL_INDEX] & ~0x00003F00) | (xtalclkdiv << 8);
+    }
+
+    uint8_t xtal32_exists_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SYS_CNTL_INDEX];
+        return ((localVal & 0x00000020) >> 5);
+    }
+
+    void xtal32_exists_setf(uint8_t xtal32exists)
+    {
+        ASSERT_ERR(((xtal32exists << 5) & ~0x00000020) == 0);
+        this->m_reg[SYS_CNTL_INDEX] = (this->m_reg[SYS_CNTL_INDEX] & ~0x00000020) | (xtal32exists << 5);
+    }
+
+    uint8_t jtag_secu_off_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SYS_CNTL_INDEX];
+        return ((localVal & 0x00000010) >> 4);
+    }
+
+    void jtag_secu_off_setf(uint8_t jtagsecuoff)
+    {
+        ASSERT_ERR(((jtagsecuoff << 4) & ~0x00000010) == 0);
+        this->m_reg[SYS_CNTL_INDEX] = (this->m_reg[SYS_CNTL_INDEX] & ~0x00000010) | (jtagsecuoff << 4);
+    }
+
+    uint8_t spif_1p8v_sel_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SYS_CNTL_INDEX];
+        return ((localVal & 0x00000008) >> 3);
+    }
+
+    void spif_1p8v_sel_setf(uint8_t spif1p8vsel)
+    {
+        ASSERT_ERR(((spif1p8vsel << 3) & ~0x00000008) == 0);
+        this->m_reg[SYS_CNTL_INDEX] = (this->m_reg[SYS_CNTL_INDEX] & ~0x00000008) | (spif1p8vsel << 3);
+    }
+
+    uint8_t pads_1p8v_sel_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SYS_CNTL_INDEX];
+        return ((localVal & 0x00000004) >> 2);
+    }
+
+    void pads_1p8v_sel_setf(uint8_t pads1p8vsel)
+    {
+        ASSERT_ERR(((pads1p8vsel << 2) & ~0x00000004) == 0);
+        this->m_reg[SYS_CNTL_INDEX] = (this->m_reg[SYS_CNTL_INDEX] & ~0x00000004) | (pads1p8vsel << 2);
+    }
+
+    uint8_t pwr_source_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SYS_CNTL_INDEX];
+        return ((localVal & 0x00000003) >> 0);
+    }
+
+    void pwr_source_setf(uint8_t pwrsource)
+    {
+        ASSERT_ERR(((pwrsource << 0) & ~0x00000003) == 0);
+        this->m_reg[SYS_CNTL_INDEX] = (this->m_reg[SYS_CNTL_INDEX] & ~0x00000003) | (pwrsource << 0);
+    }
+
+    uint32_t wu_cntl_get(void)
+    {
+        return this->m_reg[WU_CNTL_INDEX];
+    }
+
+    void wu_cntl_set(uint32_t value)
+    {
+        this->m_reg[WU_CNTL_INDEX] = value;
+    }
+
+    typedef RegField<WU_CNTL_INDEX, 0xF0000000, 28> ext_out_pol_field;
+    typedef RegField<WU_CNTL_INDEX, 0x00F00000, 20> ext_wu_ien_field;
+    typedef RegField<WU_CNTL_INDEX, 0x00020000, 17> rtc_wu_ien_field;
+    typedef RegField<WU_CNTL_INDEX, 0x00010000, 16> timer_wu_ien_field;
+    typedef RegField<WU_CNTL_INDEX, 0x0000F000, 12> ext_wu_pol_field;
+    typedef RegField<WU_CNTL_INDEX, 0x00000F00, 8> ext_wu_edge_field;
+    typedef RegField<WU_CNTL_INDEX, 0x000000F0, 4> ext_wu_en_field;
+    typedef RegField<WU_CNTL_INDEX, 0x00000008, 3> auto_adc_field;
+    typedef RegField<WU_CNTL_INDEX, 0x00000004, 2> host_wake_field;
+    typedef RegField<WU_CNTL_INDEX, 0x00000002, 1> rtc_wu_en_field;
+    typedef RegField<WU_CNTL_INDEX, 0x00000001, 0> timer_wu_en_field;
+
+    void wu_cntl_pack(uint8_t extoutpol, uint8_t extwuien, uint8_t rtcwuien, uint8_t timerwuien, uint8_t extwupol, uint8_t extwuedge, uint8_t extwuen, uint8_t autoadc, uint8_t hostwake, uint8_t rtcwuen, uint8_t timerwuen)
+    {
+        ASSERT_ERR(((extoutpol << 28) & ~0xF0000000) == 0);
+        ASSERT_ERR(((extwuien << 20) & ~0x00F00000) == 0);
+        ASSERT_ERR(((rtcwuien << 17) & ~0x00020000) == 0);
+        ASSERT_ERR(((timerwuien << 16) & ~0x00010000) == 0);
+        ASSERT_ERR(((extwupol << 12) & ~0x0000F000) == 0);
+        ASSERT_ERR(((extwuedge << 8) & ~0x00000F00) == 0);
+        ASSERT_ERR(((extwuen << 4) & ~0x000000F0) == 0);
+        ASSERT_ERR(((autoadc << 3) & ~0x00000008) == 0);
+        ASSERT_ERR(((hostwake << 2) & ~0x00000004) == 0);
+        ASSERT_ERR(((rtcwuen << 1) & ~0x00000002) == 0);
+        ASSERT_ERR(((timerwuen << 0) & ~0x00000001) == 0);
+        this->m_reg[WU_CNTL_INDEX] =  (extoutpol << 28) | (extwuien << 20) | (rtcwuien << 17) | (timerwuien << 16) | (extwupol << 12) | (extwuedge << 8) | (extwuen << 4) | (autoadc << 3) | (hostwake << 2) | (rtcwuen << 1) | (timerwuen << 0);
+    }
+
+    void wu_cntl_unpack(uint8_t* extoutpol, uint8_t* extwuien, uint8_t* rtcwuien, uint8_t* timerwuien, uint8_t* extwupol, uint8_t* extwuedge, uint8_t* extwuen, uint8_t* autoadc, uint8_t* hostwake, uint8_t* rtcwuen, uint8_t* timerwuen)
+    {
+        uint32_t localVal = this->m_reg[WU_CNTL_INDEX];
+
+        *extoutpol = (localVal & 0xF0000000) >> 28;
+        *extwuien = (localVal & 0x00F00000) >> 20;
+        *rtcwuien = (localVal & 0x00020000) >> 17;
+        *timerwuien = (localVal & 0x00010000) >> 16;
+        *extwupol = (localVal & 0x0000F000) >> 12;
+        *extwuedge = (localVal & 0x00000F00) >> 8;
+        *extwuen = (localVal & 0x000000F0) >> 4;
+        *autoadc = (localVal & 0x00000008) >> 3;
+        *hostwake = (localVal & 0x00000004) >> 2;
+        *rtcwuen = (localVal & 0x00000002) >> 1;
+        *timerwuen = (localVal & 0x00000001) >> 0;
+    }
+
+    uint8_t ext_out_pol_getf(void)
+    {
+        uint32_t localVal = this->m_reg[WU_CNTL_INDEX];
+        return ((localVal & 0xF0000000) >> 28);
+    }
+
+    void ext_out_pol_setf(uint8_t extoutpol)
+    {
+        ASSERT_ERR(((extoutpol << 28) & ~0xF0000000) == 0);
+        this->m_reg[WU_CNTL_INDEX] = (this->m_reg[WU_CNTL_INDEX] & ~0xF0000000) | (extoutpol << 28);
+    }
+
+    uint8_t ext_wu_ien_getf(void)
+    {
+        uint32_t localVal = this->m_reg[WU_CNTL_INDEX];
+        return ((localVal & 0x00F00000) >> 20);
+    }
+
+    void ext_wu_ien_setf(uint8_t extwuien)
+    {
+        ASSERT_ERR(((extwuien << 20) & ~0x00F00000) == 0);
+        this->m_reg[WU_CNTL_INDEX] = (this->m_reg[WU_CNTL_INDEX] & ~0x00F00000) | (extwuien << 20);
+    }
+
+    uint8_t rtc_wu_ien_getf(void)
+    {
+        uint32_t localVal = this->m_reg[WU_CNTL_INDEX];
+        return ((localVal & 0x00020000) >> 17);
+    }
+
+    void rtc_wu_ien_setf(uint8_t rtcwuien)
+    {
+        ASSERT_ERR(((rtcwuien << 17) & ~0x00020000) == 0);
+        this->m_reg[WU_CNTL_INDEX] = (this->m_reg[WU_CNTL_INDEX] & ~0x00020000) | (rtcwuien << 17);
+    }
+
+    uint8_t timer_wu_ien_getf(void)
+    {
+        uint32_t localVal = this->m_reg[WU_CNTL_INDEX];
+        return ((localVal & 0x00010000) >> 16);
+    }
+
+    void timer_wu_ien_setf(uint8_t timerwuien)
+    {
+        ASSERT_ERR(((timerwuien << 16) & ~0x00010000) == 0);
+        this->m_reg[WU_CNTL_INDEX] = (this->m_reg[WU_CNTL_INDEX] & ~0x00010000) | (timerwuien << 16);
+    }
+
+    uint8_t ext_wu_pol_getf(void)
+    {
+        uint32_t localVal = this->m_reg[WU_CNTL_INDEX];
+        return ((localVal & 0x0000F000) >> 12);
+    }
+
+    void ext_wu_pol_setf(uint8_t extwupol)
+    {
+        ASSERT_ERR(((extwupol << 12) & ~0x0000F000) == 0);
+        this->m_reg[WU_CNTL_INDEX] = (this->m_reg[WU_CNTL_INDEX] & ~0x0000F000) | (extwupol << 12);
+    }
+
+    uint8_t ext_wu_edge_getf(void)
+    {
+        uint32_t localVal = this->m_reg[WU_CNTL_INDEX];
+        return ((localVal & 0x00000F00) >> 8);
+    }
+
+    void ext_wu_edge_setf(uint8_t extwuedge)
+    {
+        ASSERT_ERR(((extwuedge << 8) & ~0x00000F00) == 0);
+        this->m_reg[WU_CNTL_INDEX] = (this->m_reg[WU_CNTL_INDEX] & ~0x00000F00) | (extwuedge << 8);
+    }
+
+    uint8_t ext_wu_en_getf(void)
+    {
+        uint32_t localVal = this->m_reg[WU_CNTL_INDEX];
+        return ((localVal & 0x000000F0) >> 4);
+    }
+
+    void ext_wu_en_setf(uint8_t extwuen)
+    {
+        ASSERT_ERR(((extwuen << 4) & ~0x000000F0) == 0);
+        this->m_reg[WU_CNTL_INDEX] = (this->m_reg[WU_CNTL_INDEX] & ~0x000000F0) | (extwuen << 4);
+    }
+
+    uint8_t auto_adc_getf(void)
+    {
+        uint32_t localVal = this->m_reg[WU_CNTL_INDEX];
+        return ((localVal & 0x00000008) >> 3);
+    }
+
+    void auto_adc_setf(uint8_t autoadc)
+    {
+        ASSERT_ERR(((autoadc << 3) & ~0x00000008) == 0);
+        this->m_reg[WU_CNTL_INDEX] = (this->m_reg[WU_CNTL_INDEX] & ~0x00000008) | (autoadc << 3);
+    }
+
+    uint8_t host_wake_getf(void)
+    {
+        uint32_t localVal = this->m_reg[WU_CNTL_INDEX];
+        return ((localVal & 0x00000004) >> 2);
+    }
+
+    void host_wake_setf(uint8_t hostwake)
+    {
+        ASSERT_ERR(((hostwake << 2) & ~0x00000004) == 0);
+        this->m_reg[WU_CNTL_INDEX] = (this->m_reg[WU_CNTL_INDEX] & ~0x00000004) | (hostwake << 2);
+    }
+
+    uint8_t rtc_wu_en_getf(void)
+    {
+        uint32_t localVal = this->m_reg[WU_CNTL_INDEX];
+        return ((localVal & 0x00000002) >> 1);
+    }
+
+    void rtc_wu_en_setf(uint8_t rtcwuen)
+    {
+        ASSERT_ERR(((rtcwuen << 1) & ~0x00000002) == 0);
+        this->m_reg[WU_CNTL_INDEX] = (this->m_reg[WU_CNTL_INDEX] & ~0x00000002) | (rtcwuen << 1);
+    }
+
+    uint8_t timer_wu_en_getf(void)
+    {
+        uint32_t localVal = this->m_reg[WU_CNTL_INDEX];
+        return ((localVal & 0x00000001) >> 0);
+    }
+
+    void timer_wu_en_setf(uint8_t timerwuen)
+    {
+        ASSERT_ERR(((timerwuen << 0) & ~0x00000001) == 0);
+        this->m_reg[WU_CNTL_INDEX] = (this->m_reg[WU_CNTL_INDEX] & ~0x00000001) | (timerwuen << 0);
+    }
+
+    uint32_t sleep_cntl_get(void)
+    {
+        return this->m_reg[SLEEP_CNTL_INDEX];
+    }
+
+    void sleep_cntl_set(uint32_t value)
+    {
+        this->m_reg[SLEEP_CNTL_INDEX] = value;
+    }
+
+    typedef RegField<SLEEP_CNTL_INDEX, 0x00000080, 7> dig_pad_en_field;
+    typedef RegField<SLEEP_CNTL_INDEX, 0x00000040, 6> mcu_ret_field;
+    typedef RegField<SLEEP_CNTL_INDEX, 0x00000030, 4> ram_ret_field;
+    typedef RegField<SLEEP_CNTL_INDEX, 0x00000002, 1> doze_field;
+    typedef RegField<SLEEP_CNTL_INDEX, 0x00000001, 0> hib_field;
+
+    void sleep_cntl_pack(uint8_t digpaden, uint8_t mcuret, uint8_t ramret, uint8_t doze, uint8_t hib)
+    {
+        ASSERT_ERR(((digpaden << 7) & ~0x00000080) == 0);
+        ASSERT_ERR(((mcuret << 6) & ~0x00000040) == 0);
+        ASSERT_ERR(((ramret << 4) & ~0x00000030) == 0);
+        ASSERT_ERR(((doze << 1) & ~0x00000002) == 0);
+        ASSERT_ERR(((hib << 0) & ~0x00000001) == 0);
+        this->m_reg[SLEEP_CNTL_INDEX] =  (digpaden << 7) | (mcuret << 6) | (ramret << 4) | (doze << 1) | (hib << 0);
+    }
+
+    void sleep_cntl_unpack(uint8_t* digpaden, uint8_t* mcuret, uint8_t* ramret, uint8_t* doze, uint8_t* hib)
+    {
+        uint32_t localVal = this->m_reg[SLEEP_CNTL_INDEX];
+
+        *digpaden = (localVal & 0x00000080) >> 7;
+        *mcuret = (localVal & 0x00000040) >> 6;
+        *ramret = (localVal & 0x00000030) >> 4;
+        *doze = (localVal & 0x00000002) >> 1;
+        *hib = (localVal & 0x00000001) >> 0;
+    }
+
+    uint8_t dig_pad_en_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SLEEP_CNTL_INDEX];
+        return ((localVal & 0x00000080) >> 7);
+    }
+
+    void dig_pad_en_setf(uint8_t digpaden)
+    {
+        ASSERT_ERR(((digpaden << 7) & ~0x00000080) == 0);
+        this->m_reg[SLEEP_CNTL_INDEX] = (this->m_reg[SLEEP_CNTL_INDEX] & ~0x00000080) | (digpaden << 7);
+    }
+
+    uint8_t mcu_ret_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SLEEP_CNTL_INDEX];
+        return ((localVal & 0x00000040) >> 6);
+    }
+
+    void mcu_ret_setf(uint8_t mcuret)
+    {
+        ASSERT_ERR(((mcuret << 6) & ~0x00000040) == 0);
+        this->m_reg[SLEEP_CNTL_INDEX] = (this->m_reg[SLEEP_CNTL_INDEX] & ~0x00000040) | (mcuret << 6);
+    }
+
+    uint8_t ram_ret_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SLEEP_CNTL_INDEX];
+        return ((localVal & 0x00000030) >> 4);
+    }
+
+    void ram_ret_setf(uint8_t ramret)
+    {
+        ASSERT_ERR(((ramret << 4) & ~0x00000030) == 0);
+        this->m_reg[SLEEP_CNTL_INDEX] = (this->m_reg[SLEEP_CNTL_INDEX] & ~0x00000030) | (ramret << 4);
+    }
+
+    uint8_t doze_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SLEEP_CNTL_INDEX];
+        return ((localVal & 0x00000002) >> 1);
+    }
+
+    void doze_setf(uint8_t doze)
+    {
+        ASSERT_ERR(((doze << 1) & ~0x00000002) == 0);
+        this->m_reg[SLEEP_CNTL_INDEX] = (this->m_reg[SLEEP_CNTL_INDEX] & ~0x00000002) | (doze << 1);
+    }
+
+    uint8_t hib_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SLEEP_CNTL_INDEX];
+        return ((localVal & 0x00000001) >> 0);
+    }
+
+    void hib_setf(uint8_t hib)
+    {
+        ASSERT_ERR(((hib << 0) & ~0x00000001) == 0);
+        this->m_reg[SLEEP_CNTL_INDEX] = (this->m_reg[SLEEP_CNTL_INDEX] & ~0x00000001) | (hib << 0);
+    }
+
+    uint32_t bs_cntl_get(void)
+    {
+        return this->m_reg[BS_CNTL_INDEX];
+    }
+
+    void bs_cntl_set(uint32_t value)
+    {
+        this->m_reg[BS_CNTL_INDEX] = value;
+    }
+
+    typedef RegField<BS_CNTL_INDEX, 0x00003F00, 8> arm_off_time_field;
+    typedef RegField<BS_CNTL_INDEX, 0x00000004, 2> bs_man_en_field;
+    typedef RegField<BS_CNTL_INDEX, 0x00000002, 1> wait4irq_field;
+    typedef RegField<BS_CNTL_INDEX, 0x00000001, 0> bs_en_field;
+
+    void bs_cntl_pack(uint8_t armofftime, uint8_t bsmanen, uint8_t wait4irq, uint8_t bsen)
+    {
+        ASSERT_ERR(((armofftime << 8) & ~0x00003F00) == 0);
+        ASSERT_ERR(((bsmanen << 2) & ~0x00000004) == 0);
+        ASSERT_ERR(((wait4irq << 1) & ~0x00000002) == 0);
+        ASSERT_ERR(((bsen << 0) & ~0x00000001) == 0);
+        this->m_reg[BS_CNTL_INDEX] =  (armofftime << 8) | (bsmanen << 2) | (wait4irq << 1) | (bsen << 0);
+    }
+
+    void bs_cntl_unpack(uint8_t* armofftime, uint8_t* bsmanen, uint8_t* wait4irq, uint8_t* bsen)
+    {
+        uint32_t localVal = this->m_reg[BS_CNTL_INDEX];
+
+        *armofftime = (localVal & 0x00003F00) >> 8;
+        *bsmanen = (localVal & 0x00000004) >> 2;
+        *wait4irq = (localVal & 0x00000002) >> 1;
+        *bsen = (localVal & 0x00000001) >> 0;
+    }
+
+    uint8_t arm_off_time_getf(void)
+    {
+        uint32_t localVal = this->m_reg[BS_CNTL_INDEX];
+        return ((localVal & 0x00003F00) >> 8);
+    }
+
+    void arm_off_time_setf(uint8_t armofftime)
+    {
+        ASSERT_ERR(((armofftime << 8) & ~0x00003F00) == 0);
+        this->m_reg[BS_CNTL_INDEX] = (this->m_reg[BS_CNTL_INDEX] & ~0x00003F00) | (armofftime << 8);
+    }
+
+    uint8_t bs_man_en_getf(void)
+    {
+        uint32_t localVal = this->m_reg[BS_CNTL_INDEX];
+        return ((localVal & 0x00000004) >> 2);
+    }
+
+    void bs_man_en_setf(uint8_t bsmanen)
+    {
+        ASSERT_ERR(((bsmanen << 2) & ~0x00000004) == 0);
+        this->m_reg[BS_CNTL_INDEX] = (this->m_reg[BS_CNTL_INDEX] & ~0x00000004) | (bsmanen << 2);
+    }
+
+    uint8_t wait4irq_getf(void)
+    {
+        uint32_t localVal = this->m_reg[BS_CNTL_INDEX];
+        return ((localVal & 0x00000002) >> 1);
+    }
+
+    void wait4irq_setf(uint8_t wait4irq)
+    {
+        ASSERT_ERR(((wait4irq << 1) & ~0x00000002) == 0);
+        this->m_reg[BS_CNTL_INDEX] = (this->m_reg[BS_CNTL_INDEX] & ~0x00000002) | (wait4irq << 1);
+    }
+
+    uint8_t bs_en_getf(void)
+    {
+        uint32_t localVal = this->m_reg[BS_CNTL_INDEX];
+        return ((localVal & 0x00000001) >> 0);
+    }
+
+    void bs_en_setf(uint8_t bsen)
+    {
+        ASSERT_ERR(((bsen << 0) & ~0x00000001) == 0);
+        this->m_reg[BS_CNTL_INDEX] = (this->m_reg[BS_CNTL_INDEX] & ~0x00000001) | (bsen << 0);
+    }
+
+    uint32_t cop_cntl_get(void)
+    {
+        return this->m_reg[COP_CNTL_INDEX];
+    }
+
+    void cop_cntl_set(uint32_t value)
+    {
+        this->m_reg[COP_CNTL_INDEX] = value;
+    }
+
+    typedef RegField<COP_CNTL_INDEX, 0x007F0000, 16> cop_count_field;
+    typedef RegField<COP_CNTL_INDEX, 0x00007F00, 8> cop_timeout_field;
+    typedef RegField<COP_CNTL_INDEX, 0x00000004, 2> cop_wp_field;
+    typedef RegField<COP_CNTL_INDEX, 0x00000002, 1> cop_out_field;
+    typedef RegField<COP_CNTL_INDEX, 0x00000001, 0> cop_en_field;
+
+    void cop_cntl_pack(uint8_t copcount, uint8_t coptimeout, uint8_t copwp, uint8_t copout, uint8_t copen)
+    {
+        ASSERT_ERR(((copcount << 16) & ~0x007F0000) == 0);
+        ASSERT_ERR(((coptimeout << 8) & ~0x00007F00) == 0);
+        ASSERT_ERR(((copwp << 2) & ~0x00000004) == 0);
+        ASSERT_ERR(((copout << 1) & ~0x00000002) == 0);
+        ASSERT_ERR(((copen << 0) & ~0x00000001) == 0);
+        this->m_reg[COP_CNTL_INDEX] =  (copcount << 16) | (coptimeout << 8) | (copwp << 2) | (copout << 1) | (copen << 0);
+    }
+
+    void cop_cntl_unpack(uint8_t* copcount, uint8_t* coptimeout, uint8_t* copwp, uint8_t* copout, uint8_t* copen)
+    {
+        uint32_t localVal = this->m_reg[COP_CNTL_INDEX];
+
+        *copcount = (localVal & 0x007F0000) >> 16;
+        *coptimeout = (localVal & 0x00007F00) >> 8;
+        *copwp = (localVal & 0x00000004) >> 2;
+        *copout = (localVal & 0x00000002) >> 1;
+        *copen = (localVal & 0x00000001) >> 0;
+    }
+
+    uint8_t cop_count_getf(void)
+    {
+        uint32_t localVal = this->m_reg[COP_CNTL_INDEX];
+        return ((localVal & 0x007F0000) >> 16);
+    }
+
+    void cop_count_setf(uint8_t copcount)
+    {
+        ASSERT_ERR(((copcount << 16) & ~0x007F0000) == 0);
+        this->m_reg[COP_CNTL_INDEX] = (this->m_reg[COP_CNTL_INDEX] & ~0x007F0000) | (copcount << 16);
+    }
+
+    uint8_t cop_timeout_getf(void)
+    {
+        uint32_t localVal = this->m_reg[COP_CNTL_INDEX];
+        return ((localVal & 0x00007F00) >> 8);
+    }
+
+    void cop_timeout_setf(uint8_t coptimeout)
+    {
+        ASSERT_ERR(((coptimeout << 8) & ~0x00007F00) == 0);
+        this->m_reg[COP_CNTL_INDEX] = (this->m_reg[COP_CNTL_INDEX] & ~0x00007F00) | (coptimeout << 8);
+    }
+
+    uint8_t cop_wp_getf(void)
+    {
+        uint32_t localVal = this->m_reg[COP_CNTL_INDEX];
+        return ((localVal & 0x00000004) >> 2);
+    }
+
+    void cop_wp_setf(uint8_t copwp)
+    {
+        ASSERT_ERR(((copwp << 2) & ~0x00000004) == 0);
+        this->m_reg[COP_CNTL_INDEX] = (this->m_reg[COP_CNTL_INDEX] & ~0x00000004) | (copwp << 2);
+    }
+
+    uint8_t cop_out_getf(void)
+    {
+        uint32_t localVal = this->m_reg[COP_CNTL_INDEX];
+        return ((localVal & 0x00000002) >> 1);
+    }
+
+    void cop_out_setf(uint8_t copout)
+    {
+        ASSERT_ERR(((copout << 1) & ~0x00000002) == 0);
+        this->m_reg[COP_CNTL_INDEX] = (this->m_reg[COP_CNTL_INDEX] & ~0x00000002) | (copout << 1);
+    }
+
+    uint8_t cop_en_getf(void)
+    {
+        uint32_t localVal = this->m_reg[COP_CNTL_INDEX];
+        return ((localVal & 0x00000001) >> 0);
+    }
+
+    void cop_en_setf(uint8_t copen)
+    {
+        ASSERT_ERR(((copen << 0) & ~0x00000001) == 0);
+        this->m_reg[COP_CNTL_INDEX] = (this->m_reg[COP_CNTL_INDEX] & ~0x00000001) | (copen << 0);
+    }
+
+    uint32_t cop_service_get(void)
+    {
+        return this->m_reg[COP_SERVICE_INDEX];
+    }
+
+    void cop_service_set(uint32_t value)
+    {
+        this->m_reg[COP_SERVICE_INDEX] = value;
+    }
+
+    typedef RegField<COP_SERVICE_INDEX, 0xFFFFFFFF, 0> cop_service_field;
+
+    uint32_t cop_service_getf(void)
+    {
+        uint32_t localVal = this->m_reg[COP_SERVICE_INDEX];
+        ASSERT_ERR((localVal & ~0xFFFFFFFF) == 0);
+        return (localVal >> 0);
+    }
+
+    void cop_service_setf(uint32_t copservice)
+    {
+        ASSERT_ERR(((copservice << 0) & ~0xFFFFFFFF) == 0);
+        this->m_reg[COP_SERVICE_INDEX] = copservice << 0;
+    }
+
+    uint32_t status_get(void)
+    {
+        return this->m_reg[STATUS_INDEX];
+    }
+
+    void status_set(uint32_t value)
+    {
+        this->m_reg[STATUS_INDEX] = value;
+    }
+
+    typedef RegField<STATUS_INDEX, 0x00080000, 19> vreg_1p5v_rdy_field;
+    typedef RegField<STATUS_INDEX, 0x00040000, 18> vreg_1p8v_rdy_field;
+    typedef RegField<STATUS_INDEX, 0x00020000, 17> vreg_buck_rdy_field;
+    typedef RegField<STATUS_INDEX, 0x00000400, 10> cop_evt_field;
+    typedef RegField<STATUS_INDEX, 0x00000200, 9> cal_done_field;
+    typedef RegField<STATUS_INDEX, 0x000000F0, 4> ext_wu_evt_field;
+    typedef RegField<STATUS_INDEX, 0x00000008, 3> rtc_wu_evt_field;
+    typedef RegField<STATUS_INDEX, 0x00000004, 2> doze_wu_evt_field;
+    typedef RegField<STATUS_INDEX, 0x00000002, 1> hib_wu_evt_field;
+    typedef RegField<STATUS_INDEX, 0x00000001, 0> sleep_sync_field;
+
+    void status_pack(uint8_t caldone, uint8_t extwuevt, uint8_t rtcwuevt, uint8_t dozewuevt, uint8_t hibwuevt, uint8_t sleepsync)
+    {
+        ASSERT_ERR(((caldone << 9) & ~0x00000200) == 0);
+        ASSERT_ERR(((extwuevt << 4) & ~0x000000F0) == 0);
+        ASSERT_ERR(((rtcwuevt << 3) & ~0x00000008) == 0);
+        ASSERT_ERR(((dozewuevt << 2) & ~0x00000004) == 0);
+        ASSERT_ERR(((hibwuevt << 1) & ~0x00000002) == 0);
+        ASSERT_ERR(((sleepsync << 0) & ~0x00000001) == 0);
+        this->m_reg[STATUS_INDEX] =  (caldone << 9) | (extwuevt << 4) | (rtcwuevt << 3) | (dozewuevt << 2) | (hibwuevt << 1) | (sleepsync << 0);
+    }
+
+    void status_unpack(uint8_t* vreg1p5vrdy, uint8_t* vreg1p8vrdy, uint8_t* vregbuckrdy, uint8_t* copevt, uint8_t* caldone, uint8_t* extwuevt, uint8_t* rtcwuevt, uint8_t* dozewuevt, uint8_t* hibwuevt, uint8_t* sleepsync)
+    {
+        uint32_t localVal = this->m_reg[STATUS_INDEX];
+
+        *vreg1p5vrdy = (localVal & 0x00080000) >> 19;
+        *vreg1p8vrdy = (localVal & 0x00040000) >> 18;
+        *vregbuckrdy = (localVal & 0x00020000) >> 17;
+        *copevt = (localVal & 0x00000400) >> 10;
+        *caldone = (localVal & 0x00000200) >> 9;
+        *extwuevt = (localVal & 0x000000F0) >> 4;
+        *rtcwuevt = (localVal & 0x00000008) >> 3;
+        *dozewuevt = (localVal & 0x00000004) >> 2;
+        *hibwuevt = (localVal & 0x00000002) >> 1;
+        *sleepsync = (localVal & 0x00000001) >> 0;
+    }
+
+    uint8_t vreg_1p5v_rdy_getf(void)
+    {
+        uint32_t localVal = this->m_reg[STATUS_INDEX];
+        return ((localVal & 0x00080000) >> 19);
+    }
+
+    uint8_t vreg_1p8v_rdy_getf(void)
+    {
+        uint32_t localVal = this->m_reg[STATUS_INDEX];
+        return ((localVal & 0x00040000) >> 18);
+    }
+
+    uint8_t vreg_buck_rdy_getf(void)
+    {
+        uint32_t localVal = this->m_reg[STATUS_INDEX];
+        return ((localVal & 0x00020000) >> 17);
+    }
+
+    uint8_t cop_evt_getf(void)
+    {
+        uint32_t localVal = this->m_reg[STATUS_INDEX];
+        return ((localVal & 0x00000400) >> 10);
+    }
+
+    uint8_t cal_done_getf(void)
+    {
+        uint32_t localVal = this->m_reg[STATUS_INDEX];
+        return ((localVal & 0x00000200) >> 9);
+    }
+
+    void cal_done_setf(uint8_t caldone)
+    {
+        ASSERT_ERR(((caldone << 9) & ~0x00000200) == 0);
+        this->m_reg[STATUS_INDEX] = (this->m_reg[STATUS_INDEX] & ~0x00000200) | (caldone << 9);
+    }
+
+    uint8_t ext_wu_evt_getf(void)
+    {
+        uint32_t localVal = this->m_reg[STATUS_INDEX];
+        return ((localVal & 0x000000F0) >> 4);
+    }
+
+    void ext_wu_evt_setf(uint8_t extwuevt)
+    {
+        ASSERT_ERR(((extwuevt << 4) & ~0x000000F0) == 0);
+        this->m_reg[STATUS_INDEX] = (this->m_reg[STATUS_INDEX] & ~0x000000F0) | (extwuevt << 4);
+    }
+
+    uint8_t rtc_wu_evt_getf(void)
+    {
+        uint32_t localVal = this->m_reg[STATUS_INDEX];
+        return ((localVal & 0x00000008) >> 3);
+    }
+
+    void rtc_wu_evt_setf(uint8_t rtcwuevt)
+    {
+        ASSERT_ERR(((rtcwuevt << 3) & ~0x00000008) == 0);
+        this->m_reg[STATUS_INDEX] = (this->m_reg[STATUS_INDEX] & ~0x00000008) | (rtcwuevt << 3);
+    }
+
+    uint8_t doze_wu_evt_getf(void)
+    {
+        uint32_t localVal = this->m_reg[STATUS_INDEX];
+        return ((localVal & 0x00000004) >> 2);
+    }
+
+    void doze_wu_evt_setf(uint8_t dozewuevt)
+    {
+        ASSERT_ERR(((dozewuevt << 2) & ~0x00000004) == 0);
+        this->m_reg[STATUS_INDEX] = (this->m_reg[STATUS_INDEX] & ~0x00000004) | (dozewuevt << 2);
+    }
+
+    uint8_t hib_wu_evt_getf(void)
+    {
+        uint32_t localVal = this->m_reg[STATUS_INDEX];
+        return ((localVal & 0x00000002) >> 1);
+    }
+
+    void hib_wu_evt_setf(uint8_t hibwuevt)
+    {
+        ASSERT_ERR(((hibwuevt << 1) & ~0x00000002) == 0);
+        this->m_reg[STATUS_INDEX] = (this->m_reg[STATUS_INDEX] & ~0x00000002) | (hibwuevt << 1);
+    }
+
+    uint8_t sleep_sync_getf(void)
+    {
+        uint32_t localVal = this->m_reg[STATUS_INDEX];
+        return ((localVal & 0x00000001) >> 0);
+    }
+
+    void sleep_sync_setf(uint8_t sleepsync)
+    {
+        ASSERT_ERR(((sleepsync << 0) & ~0x00000001) == 0);
+        this->m_reg[STATUS_INDEX] = (this->m_reg[STATUS_INDEX] & ~0x00000001) | (sleepsync << 0);
+    }
+
+    uint32_t mod_status_get(void)
+    {
+        return this->m_reg[MOD_STATUS_INDEX];
+    }
+
+    void mod_status_set(uint32_t value)
+    {
+        this->m_reg[MOD_STATUS_INDEX] = value;
+    }
+
+    typedef RegField<MOD_STATUS_INDEX, 0x00020000, 17> aim_en_field;
+    typedef RegField<MOD_STATUS_INDEX, 0x00008000, 15> nex_en_field;
+    typedef RegField<MOD_STATUS_INDEX, 0x00004000, 14> jta_en_field;
+    typedef RegField<MOD_STATUS_INDEX, 0x00001000, 12> adc_en_field;
+    typedef RegField<MOD_STATUS_INDEX, 0x00000800, 11> spif_en_field;
+    typedef RegField<MOD_STATUS_INDEX, 0x00000400, 10> ssi_en_field;
+    typedef RegField<MOD_STATUS_INDEX, 0x00000200, 9> i2c_en_field;
+    typedef RegField<MOD_STATUS_INDEX, 0x00000100, 8> rif_en_field;
+    typedef RegField<MOD_STATUS_INDEX, 0x00000080, 7> tmr_en_field;
+    typedef RegField<MOD_STATUS_INDEX, 0x00000040, 6> uart2_en_field;
+    typedef RegField<MOD_STATUS_INDEX, 0x00000020, 5> uart1_en_field;
+    typedef RegField<MOD_STATUS_INDEX, 0x00000010, 4> gpio_en_field;
+    typedef RegField<MOD_STATUS_INDEX, 0x00000008, 3> spi_en_field;
+    typedef RegField<MOD_STATUS_INDEX, 0x00000004, 2> asm_en_field;
+    typedef RegField<MOD_STATUS_INDEX, 0x00000002, 1> maca_en_field;
+    typedef RegField<MOD_STATUS_INDEX, 0x00000001, 0> arm_en_field;
+
+    void mod_status_unpack(uint8_t* aimen, uint8_t* nexen, uint8_t* jtaen, uint8_t* adcen, uint8_t* spifen, uint8_t* ssien, uint8_t* i2cen, uint8_t* rifen, uint8_t* tmren, uint8_t* uart2en, uint8_t* uart1en, uint8_t* gpioen, uint8_t* spien, uint8_t* asmen, uint8_t* macaen, uint8_t* armen)
+    {
+        uint32_t localVal = this->m_reg[MOD_STATUS_INDEX];
+
+        *aimen = (localVal & 0x00020000) >> 17;
+        *nexen = (localVal & 0x00008000) >> 15;
+        *jtaen = (localVal & 0x00004000) >> 14;
+        *adcen = (localVal & 0x00001000) >> 12;
+        *spifen = (localVal & 0x00000800) >> 11;
+        *ssien = (localVal & 0x00000400) >> 10;
+        *i2cen = (localVal & 0x00000200) >> 9;
+        *rifen = (localVal & 0x00000100) >> 8;
+        *tmren = (localVal & 0x00000080) >> 7;
+        *uart2en = (localVal & 0x00000040) >> 6;
+        *uart1en = (localVal & 0x00000020) >> 5;
+        *gpioen = (localVal & 0x00000010) >> 4;
+        *spien = (localVal & 0x00000008) >> 3;
+        *asmen = (localVal & 0x00000004) >> 2;
+        *macaen = (localVal & 0x00000002) >> 1;
+        *armen = (localVal & 0x00000001) >> 0;
+    }
+
+    uint8_t aim_en_getf(void)
+    {
+        uint32_t localVal = this->m_reg[MOD_STATUS_INDEX];
+        return ((localVal & 0x00020000) >> 17);
+    }
+
+    uint8_t nex_en_getf(void)
+    {
+        uint32_t localVal = this->m_reg[MOD_STATUS_INDEX];
+        return ((localVal & 0x00008000) >> 15);
+    }
+
+    uint8_t jta_en_getf(void)
+    {
+        uint32_t localVal = this->m_reg[MOD_STATUS_INDEX];
+        return ((localVal & 0x00004000) >> 14);
+    }
+
+    uint8_t adc_en_getf(void)
+    {
+        uint32_t localVal = this->m_reg[MOD_STATUS_INDEX];
+        return ((localVal & 0x00001000) >> 12);
+    }
+
+    uint8_t spif_en_getf(void)
+    {
+        uint32_t localVal = this->m_reg[MOD_STATUS_INDEX];
+        return ((localVal & 0x00000800) >> 11);
+    }
+
+    uint8_t ssi_en_getf(void)
+    {
+        uint32_t localVal = this->m_reg[MOD_STATUS_INDEX];
+        return ((localVal & 0x00000400) >> 10);
+    }
+
+    uint8_t i2c_en_getf(void)
+    {
+        uint32_t localVal = this->m_reg[MOD_STATUS_INDEX];
+        return ((localVal & 0x00000200) >> 9);
+    }
+
+    uint8_t rif_en_getf(void)
+    {
+        uint32_t localVal = this->m_reg[MOD_STATUS_INDEX];
+        return ((localVal & 0x00000100) >> 8);
+    }
+
+    uint8_t tmr_en_getf(void)
+    {
+        uint32_t localVal = this->m_reg[MOD_STATUS_INDEX];
+        return ((localVal & 0x00000080) >> 7);
+    }
+
+    uint8_t uart2_en_getf(void)
+    {
+        uint32_t localVal = this->m_reg[MOD_STATUS_INDEX];
+        return ((localVal & 0x00000040) >> 6);
+    }
+
+    uint8_t uart1_en_getf(void)
+    {
+        uint32_t localVal = this->m_reg[MOD_STATUS_INDEX];
+        return ((localVal & 0x00000020) >> 5);
+    }
+
+    uint8_t gpio_en_getf(void)
+    {
+        uint32_t localVal = this->m_reg[MOD_STATUS_INDEX];
+        return ((localVal & 0x00000010) >> 4);
+    }
+
+    uint8_t spi_en_getf(void)
+    {
+        uint32_t localVal = this->m_reg[MOD_STATUS_INDEX];
+        return ((localVal & 0x00000008) >> 3);
+    }
+
+    uint8_t asm_en_getf(void)
+    {
+        uint32_t localVal = this->m_reg[MOD_STATUS_INDEX];
+        return ((localVal & 0x00000004) >> 2);
+    }
+
+    uint8_t maca_en_getf(void)
+    {
+        uint32_t localVal = this->m_reg[MOD_STATUS_INDEX];
+        return ((localVal & 0x00000002) >> 1);
+    }
+
+    uint8_t arm_en_getf(void)
+    {
+        uint32_t localVal = this->m_reg[MOD_STATUS_INDEX];
+        return ((localVal & 0x00000001) >> 0);
+    }
+
+    uint32_t wu_count_get(void)
+    {
+        return this->m_reg[WU_COUNT_INDEX];
+    }
+
+    void wu_count_set(uint32_t value)
+    {
+        this->m_reg[WU_COUNT_INDEX] = value;
+    }
+
+    typedef RegField<WU_COUNT_INDEX, 0xFFFFFFFF, 0> wu_count_field;
+
+    uint32_t wu_count_getf(void)
+    {
+        uint32_t localVal = this->m_reg[WU_COUNT_INDEX];
+        ASSERT_ERR((localVal & ~0xFFFFFFFF) == 0);
+        return (localVal >> 0);
+    }
+
+    uint32_t wu_timeout_get(void)
+    {
+        return this->m_reg[WU_TIMEOUT_INDEX];
+    }
+
+    void wu_timeout_set(uint32_t value)
+    {
+        this->m_reg[WU_TIMEOUT_INDEX] = value;
+    }
+
+    typedef RegField<WU_TIMEOUT_INDEX, 0xFFFFFFFF, 0> wu_timeout_field;
+
+    uint32_t wu_timeout_getf(void)
+    {
+        uint32_t localVal = this->m_reg[WU_TIMEOUT_INDEX];
+        ASSERT_ERR((localVal & ~0xFFFFFFFF) == 0);
+        return (localVal >> 0);
+    }
+
+    void wu_timeout_setf(uint32_t wutimeout)
+    {
+        ASSERT_ERR(((wutimeout << 0) & ~0xFFFFFFFF) == 0);
+        this->m_reg[WU_TIMEOUT_INDEX] = wutimeout << 0;
+    }
+
+    uint32_t rtc_count_get(void)
+    {
+        return this->m_reg[RTC_COUNT_INDEX];
+    }
+
+    void rtc_count_set(uint32_t value)
+    {
+        this->m_reg[RTC_COUNT_INDEX] = value;
+    }
+
+    typedef RegField<RTC_COUNT_INDEX, 0xFFFFFFFF, 0> rtc_count_field;
+
+    uint32_t rtc_count_getf(void)
+    {
+        uint32_t localVal = this->m_reg[RTC_COUNT_INDEX];
+        ASSERT_ERR((localVal & ~0xFFFFFFFF) == 0);
+        return (localVal >> 0);
+    }
+
+    uint32_t rtc_timeout_get(void)
+    {
+        return this->m_reg[RTC_TIMEOUT_INDEX];
+    }
+
+    void rtc_timeout_set(uint32_t value)
+    {
+        this->m_reg[RTC_TIMEOUT_INDEX] = value;
+    }
+
+    typedef RegField<RTC_TIMEOUT_INDEX, 0xFFFFFFFF, 0> rtc_timeout_field;
+
+    uint32_t rtc_timeout_getf(void)
+    {
+        uint32_t localVal = this->m_reg[RTC_TIMEOUT_INDEX];
+        ASSERT_ERR((localVal & ~0xFFFFFFFF) == 0);
+        return (localVal >> 0);
+    }
+
+    void rtc_timeout_setf(uint32_t rtctimeout)
+    {
+        ASSERT_ERR(((rtctimeout << 0) & ~0xFFFFFFFF) == 0);
+        this->m_reg[RTC_TIMEOUT_INDEX] = rtctimeout << 0;
+    }
+
+    uint32_t cal_cntl_get(void)
+    {
+        return this->m_reg[CAL_CNTL_INDEX];
+    }
+
+    void cal_cntl_set(uint32_t value)
+    {
+        this->m_reg[CAL_CNTL_INDEX] = value;
+    }
+
+    typedef RegField<CAL_CNTL_INDEX, 0x00020000, 17> cal_ien_field;
+    typedef RegField<CAL_CNTL_INDEX, 0x00010000, 16> cal_en_field;
+    typedef RegField<CAL_CNTL_INDEX, 0x0000FFFF, 0> cal_timeout_field;
+
+    void cal_cntl_pack(uint8_t calien, uint8_t calen, uint16_t caltimeout)
+    {
+        ASSERT_ERR(((calien << 17) & ~0x00020000) == 0);
+        ASSERT_ERR(((calen << 16) & ~0x00010000) == 0);
+        ASSERT_ERR(((caltimeout << 0) & ~0x0000FFFF) == 0);
+        this->m_reg[CAL_CNTL_INDEX] =  (calien << 17) | (calen << 16) | (caltimeout << 0);
+    }
+
+    void cal_cntl_unpack(uint8_t* calien, uint8_t* calen, uint16_t* caltimeout)
+    {
+        uint32_t localVal = this->m_reg[CAL_CNTL_INDEX];
+
+        *calien = (localVal & 0x00020000) >> 17;
+        *calen = (localVal & 0x00010000) >> 16;
+        *caltimeout = (localVal & 0x0000FFFF) >> 0;
+    }
+
+    uint8_t cal_ien_getf(void)
+    {
+        uint32_t localVal = this->m_reg[CAL_CNTL_INDEX];
+        return ((localVal & 0x00020000) >> 17);
+    }
+
+    void cal_ien_setf(uint8_t calien)
+    {
+        ASSERT_ERR(((calien << 17) & ~0x00020000) == 0);
+        this->m_reg[CAL_CNTL_INDEX] = (this->m_reg[CAL_CNTL_INDEX] & ~0x00020000) | (calien << 17);
+    }
+
+    uint8_t cal_en_getf(void)
+    {
+        uint32_t localVal = this->m_reg[CAL_CNTL_INDEX];
+        return ((localVal & 0x00010000) >> 16);
+    }
+
+    void cal_en_setf(uint8_t calen)
+    {
+        ASSERT_ERR(((calen << 16) & ~0x00010000) == 0);
+        this->m_reg[CAL_CNTL_INDEX] = (this->m_reg[CAL_CNTL_INDEX] & ~0x00010000) | (calen << 16);
+    }
+
+    uint16_t cal_timeout_getf(void)
+    {
+        uint32_t localVal = this->m_reg[CAL_CNTL_INDEX];
+        return ((localVal & 0x0000FFFF) >> 0);
+    }
+
+    void cal_timeout_setf(uint16_t caltimeout)
+    {
+        ASSERT_ERR(((caltimeout << 0) & ~0x0000FFFF) == 0);
+        this->m_reg[CAL_CNTL_INDEX] = (this->m_reg[CAL_CNTL_INDEX] & ~0x0000FFFF) | (caltimeout << 0);
+    }
+
+    uint32_t cal_count_get(void)
+    {
+        return this->m_reg[CAL_COUNT_INDEX];
+    }
+
+    void cal_count_set(uint32_t value)
+    {
+        this->m_reg[CAL_COUNT_INDEX] = value;
+    }
+
+    typedef RegField<CAL_COUNT_INDEX, 0xFFFFFFFF, 0> cal_count_field;
+
+    uint32_t cal_count_getf(void)
+    {
+        uint32_t localVal = this->m_reg[CAL_COUNT_INDEX];
+        ASSERT_ERR((localVal & ~0xFFFFFFFF) == 0);
+        return (localVal >> 0);
+    }
+
+    uint32_t ringosc_cntl_get(void)
+    {
+        return this->m_reg[RINGOSC_CNTL_INDEX];
+    }
+
+    void ringosc_cntl_set(uint32_t value)
+    {
+        this->m_reg[RINGOSC_CNTL_INDEX] = value;
+    }
+
+    typedef RegField<RINGOSC_CNTL_INDEX, 0x00001E00, 9> rosc_ctune_field;
+    typedef RegField<RINGOSC_CNTL_INDEX, 0x000001F0, 4> rosc_ftune_field;
+    typedef RegField<RINGOSC_CNTL_INDEX, 0x00000001, 0> rosc_en_field;
+
+    void ringosc_cntl_pack(uint8_t roscctune, uint8_t roscftune, uint8_t roscen)
+    {
+        ASSERT_ERR(((roscctune << 9) & ~0x00001E00) == 0);
+        ASSERT_ERR(((roscftune << 4) & ~0x000001F0) == 0);
+        ASSERT_ERR(((roscen << 0) & ~0x00000001) == 0);
+        this->m_reg[RINGOSC_CNTL_INDEX] =  (roscctune << 9) | (roscftune << 4) | (roscen << 0);
+    }
+
+    void ringosc_cntl_unpack(uint8_t* roscctune, uint8_t* roscftune, uint8_t* roscen)
+    {
+        uint32_t localVal = this->m_reg[RINGOSC_CNTL_INDEX];
+
+        *roscctune = (localVal & 0x00001E00) >> 9;
+        *roscftune = (localVal & 0x000001F0) >> 4;
+        *roscen = (localVal & 0x00000001) >> 0;
+    }
+
+    uint8_t rosc_ctune_getf(void)
+    {
+        uint32_t localVal = this->m_reg[RINGOSC_CNTL_INDEX];
+        return ((localVal & 0x00001E00) >> 9);
+    }
+
+    void rosc_ctune_setf(uint8_t roscctune)
+    {
+        ASSERT_ERR(((roscctune << 9) & ~0x00001E00) == 0);
+        this->m_reg[RINGOSC_CNTL_INDEX] = (this->m_reg[RINGOSC_CNTL_INDEX] & ~0x00001E00) | (roscctune << 9);
+    }
+
+    uint8_t rosc_ftune_getf(void)
+    {
+        uint32_t localVal = this->m_reg[RINGOSC_CNTL_INDEX];
+        return ((localVal & 0x000001F0) >> 4);
+    }
+
+    void rosc_ftune_setf(uint8_t roscftune)
+    {
+        ASSERT_ERR(((roscftune << 4) & ~0x000001F0) == 0);
+        this->m_reg[RINGOSC_CNTL_INDEX] = (this->m_reg[RINGOSC_CNTL_INDEX] & ~0x000001F0) | (roscftune << 4);
+    }
+
+    uint8_t rosc_en_getf(void)
+    {
+        uint32_t localVal = this->m_reg[RINGOSC_CNTL_INDEX];
+        return ((localVal & 0x00000001) >> 0);
+    }
+
+    void rosc_en_setf(uint8_t roscen)
+    {
+        ASSERT_ERR(((roscen << 0) & ~0x00000001) == 0);
+        this->m_reg[RINGOSC_CNTL_INDEX] = (this->m_reg[RINGOSC_CNTL_INDEX] & ~0x00000001) | (roscen << 0);
+    }
+
+    uint32_t xtal_cntl_get(void)
+    {
+        return this->m_reg[XTAL_CNTL_INDEX];
+    }
+
+    void xtal_cntl_set(uint32_t value)
+    {
+        this->m_reg[XTAL_CNTL_INDEX] = value;
+    }
+
+    typedef RegField<XTAL_CNTL_INDEX, 0x03E00000, 21> xtal_ctune_field;
+    typedef RegField<XTAL_CNTL_INDEX, 0x001F0000, 16> xtal_ftune_field;
+    typedef RegField<XTAL_CNTL_INDEX, 0x00000F00, 8> xtal_ibias_sel_field;
+
+    void xtal_cntl_pack(uint8_t xtalctune, uint8_t xtalftune, uint8_t xtalibiassel)
+    {
+        ASSERT_ERR(((xtalctune << 21) & ~0x03E00000) == 0);
+        ASSERT_ERR(((xtalftune << 16) & ~0x001F0000) == 0);
+        ASSERT_ERR(((xtalibiassel << 8) & ~0x00000F00) == 0);
+        this->m_reg[XTAL_CNTL_INDEX] =  (xtalctune << 21) | (xtalftune << 16) | (xtalibiassel << 8);
+    }
+
+    void xtal_cntl_unpack(uint8_t* xtalctune, uint8_t* xtalftune, uint8_t* xtalibiassel)
+    {
+        uint32_t localVal = this->m_reg[XTAL_CNTL_INDEX];
+
+        *xtalctune = (localVal & 0x03E00000) >> 21;
+        *xtalftune = (localVal & 0x001F0000) >> 16;
+        *xtalibiassel = (localVal & 0x00000F00) >> 8;
+    }
+
+    uint8_t xtal_ctune_getf(void)
+    {
+        uint32_t localVal = this->m_reg[XTAL_CNTL_INDEX];
+        return ((localVal & 0x03E00000) >> 21);
+    }
+
+    void xtal_ctune_setf(uint8_t xtalctune)
+    {
+        ASSERT_ERR(((xtalctune << 21) & ~0x03E00000) == 0);
+        this->m_reg[XTAL_CNTL_INDEX] = (this->m_reg[XTAL_CNTL_INDEX] & ~0x03E00000) | (xtalctune << 21);
+    }
+
+    uint8_t xtal_ftune_getf(void)
+    {
+        uint32_t localVal = this->m_reg[XTAL_CNTL_INDEX];
+        return ((localVal & 0x001F0000) >> 16);
+    }
+
+    void xtal_ftune_setf(uint8_t xtalftune)
+    {
+        ASSERT_ERR(((xtalftune << 16) & ~0x001F0000) == 0);
+        this->m_reg[XTAL_CNTL_INDEX] = (this->m_reg[XTAL_CNTL_INDEX] & ~0x001F0000) | (xtalftune << 16);
+    }
+
+    uint8_t xtal_ibias_sel_getf(void)
+    {
+        uint32_t localVal = this->m_reg[XTAL_CNTL_INDEX];
+        return ((localVal & 0x00000F00) >> 8);
+    }
+
+    void xtal_ibias_sel_setf(uint8_t xtalibiassel)
+    {
+        ASSERT_ERR(((xtalibiassel << 8) & ~0x00000F00) == 0);
+        this->m_reg[XTAL_CNTL_INDEX] = (this->m_reg[XTAL_CNTL_INDEX] & ~0x00000F00) | (xtalibiassel << 8);
+    }
+
+    uint32_t xtal32_cntl_get(void)
+    {
+        return this->m_reg[XTAL32_CNTL_INDEX];
+    }
+
+    void xtal32_cntl_set(uint32_t value)
+    {
+        this->m_reg[XTAL32_CNTL_INDEX] = value;
+    }
+
+    typedef RegField<XTAL32_CNTL_INDEX, 0x00000030, 4> xtal32_gain_field;
+    typedef RegField<XTAL32_CNTL_INDEX, 0x00000001, 0> xtal32_en_field;
+
+    void xtal32_cntl_pack(uint8_t xtal32gain, uint8_t xtal32en)
+    {
+        ASSERT_ERR(((xtal32gain << 4) & ~0x00000030) == 0);
+        ASSERT_ERR(((xtal32en << 0) & ~0x00000001) == 0);
+        this->m_reg[XTAL32_CNTL_INDEX] =  (xtal32gain << 4) | (xtal32en << 0);
+    }
+
+    void xtal32_cntl_unpack(uint8_t* xtal32gain, uint8_t* xtal32en)
+    {
+        uint32_t localVal = this->m_reg[XTAL32_CNTL_INDEX];
+
+        *xtal32gain = (localVal & 0x00000030) >> 4;
+        *xtal32en = (localVal & 0x00000001) >> 0;
+    }
+
+    uint8_t xtal32_gain_getf(void)
+    {
+        uint32_t localVal = this->m_reg[XTAL32_CNTL_INDEX];
+        return ((localVal & 0x00000030) >> 4);
+    }
+
+    void xtal32_gain_setf(uint8_t xtal32gain)
+    {
+        ASSERT_ERR(((xtal32gain << 4) & ~0x00000030) == 0);
+        this->m_reg[XTAL32_CNTL_INDEX] = (this->m_reg[XTAL32_CNTL_INDEX] & ~0x00000030) | (xtal32gain << 4);
+    }
+
+    uint8_t xtal32_en_getf(void)
+    {
+        uint32_t localVal = this->m_reg[XTAL32_CNTL_INDEX];
+        return ((localVal & 0x00000001) >> 0);
+    }
+
+    void xtal32_en_setf(uint8_t xtal32en)
+    {
+        ASSERT_ERR(((xtal32en << 0) & ~0x00000001) == 0);
+        this->m_reg[XTAL32_CNTL_INDEX] = (this->m_reg[XTAL32_CNTL_INDEX] & ~0x00000001) | (xtal32en << 0);
+    }
+
+    uint32_t vreg_cntl_get(void)
+    {
+        return this->m_reg[VREG_CNTL_INDEX];
+    }
+
+    void vreg_cntl_set(uint32_t value)
+    {
+        this->m_reg[VREG_CNTL_INDEX] = value;
+    }
+
+    typedef RegField<VREG_CNTL_INDEX, 0x00000F00, 8> buck_clkdiv_field;
+    typedef RegField<VREG_CNTL_INDEX, 0x00000080, 7> vreg_1p8v_en_field;
+    typedef RegField<VREG_CNTL_INDEX, 0x00000060, 5> vreg_1p5v_sel_field;
+    typedef RegField<VREG_CNTL_INDEX, 0x00000018, 3> vreg_1p5v_en_field;
+    typedef RegField<VREG_CNTL_INDEX, 0x00000004, 2> buck_bypass_en_field;
+    typedef RegField<VREG_CNTL_INDEX, 0x00000002, 1> buck_sync_rec_en_field;
+    typedef RegField<VREG_CNTL_INDEX, 0x00000001, 0> buck_en_field;
+
+    void vreg_cntl_pack(uint8_t buckclkdiv, uint8_t vreg1p8ven, uint8_t vreg1p5vsel, uint8_t vreg1p5ven, uint8_t buckbypassen, uint8_t bucksyncrecen, uint8_t bucken)
+    {
+        ASSERT_ERR(((buckclkdiv << 8) & ~0x00000F00) == 0);
+        ASSERT_ERR(((vreg1p8ven << 7) & ~0x00000080) == 0);
+        ASSERT_ERR(((vreg1p5vsel << 5) & ~0x00000060) == 0);
+        ASSERT_ERR(((vreg1p5ven << 3) & ~0x00000018) == 0);
+        ASSERT_ERR(((buckbypassen << 2) & ~0x00000004) == 0);
+        ASSERT_ERR(((bucksyncrecen << 1) & ~0x00000002) == 0);
+        ASSERT_ERR(((bucken << 0) & ~0x00000001) == 0);
+        this->m_reg[VREG_CNTL_INDEX] =  (buckclkdiv << 8) | (vreg1p8ven << 7) | (vreg1p5vsel << 5) | (vreg1p5ven << 3) | (buckbypassen << 2) | (bucksyncrecen << 1) | (bucken << 0);
+    }
+
+    void vreg_cntl_unpack(uint8_t* buckclkdiv, uint8_t* vreg1p8ven, uint8_t* vreg1p5vsel, uint8_t* vreg1p5ven, uint8_t* buckbypassen, uint8_t* bucksyncrecen, uint8_t* bucken)
+    {
+        uint32_t localVal = this->m_reg[VREG_CNTL_INDEX];
+
+        *buckclkdiv = (localVal & 0x00000F00) >> 8;
+        *vreg1p8ven = (localVal & 0x00000080) >> 7;
+        *vreg1p5vsel = (localVal & 0x00000060) >> 5;
+        *vreg1p5ven = (localVal & 0x00000018) >> 3;
+        *buckbypassen = (localVal & 0x00000004) >> 2;
+        *bucksyncrecen = (localVal & 0x00000002) >> 1;
+        *bucken = (localVal & 0x00000001) >> 0;
+    }
+
+    uint8_t buck_clkdiv_getf(void)
+    {
+        uint32_t localVal = this->m_reg[VREG_CNTL_INDEX];
+        return ((localVal & 0x00000F00) >> 8);
+    }
+
+    void buck_clkdiv_setf(uint8_t buckclkdiv)
+    {
+        ASSERT_ERR(((buckclkdiv << 8) & ~0x00000F00) == 0);
+        this->m_reg[VREG_CNTL_INDEX] = (this->m_reg[VREG_CNTL_INDEX] & ~0x00000F00) | (buckclkdiv << 8);
+    }
+
+    uint8_t vreg_1p8v_en_getf(void)
+    {
+        uint32_t localVal = this->m_reg[VREG_CNTL_INDEX];
+        return ((localVal & 0x00000080) >> 7);
+    }
+
+    void vreg_1p8v_en_setf(uint8_t vreg1p8ven)
+    {
+        ASSERT_ERR(((vreg1p8ven << 7) & ~0x00000080) == 0);
+        this->m_reg[VREG_CNTL_INDEX] = (this->m_reg[VREG_CNTL_INDEX] & ~0x00000080) | (vreg1p8ven << 7);
+    }
+
+    uint8_t vreg_1p5v_sel_getf(void)
+    {
+        uint32_t localVal = this->m_reg[VREG_CNTL_INDEX];
+        return ((localVal & 0x00000060) >> 5);
+    }
+
+    void vreg_1p5v_sel_setf(uint8_t vreg1p5vsel)
+    {
+        ASSERT_ERR(((vreg1p5vsel << 5) & ~0x00000060) == 0);
+        this->m_reg[VREG_CNTL_INDEX] = (this->m_reg[VREG_CNTL_INDEX] & ~0x00000060) | (vreg1p5vsel << 5);
+    }
+
+    uint8_t vreg_1p5v_en_getf(void)
+    {
+        uint32_t localVal = this->m_reg[VREG_CNTL_INDEX];
+        return ((localVal & 0x00000018) >> 3);
+    }
+
+    void vreg_1p5v_en_setf(uint8_t vreg1p5ven)
+    {
+        ASSERT_ERR(((vreg1p5ven << 3) & ~0x00000018) == 0);
+        this->m_reg[VREG_CNTL_INDEX] = (this->m_reg[VREG_CNTL_INDEX] & ~0x00000018) | (vreg1p5ven << 3);
+    }
+
+    uint8_t buck_bypass_en_getf(void)
+    {
+        uint32_t localVal = this->m_reg[VREG_CNTL_INDEX];
+        return ((localVal & 0x00000004) >> 2);
+    }
+
+    void buck_bypass_en_setf(uint8_t buckbypassen)
+    {
+        ASSERT_ERR(((buckbypassen << 2) & ~0x00000004) == 0);
+        this->m_reg[VREG_CNTL_INDEX] = (this->m_reg[VREG_CNTL_INDEX] & ~0x00000004) | (buckbypassen << 2);
+    }
+
+    uint8_t buck_sync_rec_en_getf(void)
+    {
+        uint32_t localVal = this->m_reg[VREG_CNTL_INDEX];
+        return ((localVal & 0x00000002) >> 1);
+    }
+
+    void buck_sync_rec_en_setf(uint8_t bucksyncrecen)
+    {
+        ASSERT_ERR(((bucksyncrecen << 1) & ~0x00000002) == 0);
+        this->m_reg[VREG_CNTL_INDEX] = (this->m_reg[VREG_CNTL_INDEX] & ~0x00000002) | (bucksyncrecen << 1);
+    }
+
+    uint8_t buck_en_getf(void)
+    {
+        uint32_t localVal = this->m_reg[VREG_CNTL_INDEX];
+        return ((localVal & 0x00000001) >> 0);
+    }
+
+    void buck_en_setf(uint8_t bucken)
+    {
+        ASSERT_ERR(((bucken << 0) & ~0x00000001) == 0);
+        this->m_reg[VREG_CNTL_INDEX] = (this->m_reg[VREG_CNTL_INDEX] & ~0x00000001) | (bucken << 0);
+    }
+
+    uint32_t sw_rst_get(void)
+    {
+        return this->m_reg[SW_RST_INDEX];
+    }
+
+    void sw_rst_set(uint32_t value)
+    {
+        this->m_reg[SW_RST_INDEX] = value;
+    }
+
+    typedef RegField<SW_RST_INDEX, 0xFFFFFFFF, 0> sw_rst_field;
+
+    uint32_t sw_rst_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SW_RST_INDEX];
+        ASSERT_ERR((localVal & ~0xFFFFFFFF) == 0);
+        return (localVal >> 0);
+    }
+
+    void sw_rst_setf(uint32_t swrst)
+    {
+        ASSERT_ERR(((swrst << 0) & ~0xFFFFFFFF) == 0);
+        this->m_reg[SW_RST_INDEX] = swrst << 0;
+    }
+
+
+protected:
+    /// SYS_CNTL register read hook
+    uint32_t
+    sys_cntl_rd()
+    {
+        return this->m_reg[SYS_CNTL_INDEX];
+    }
+
+    /// SYS_CNTL register write hook
+    void
+    sys_cntl_wr(uint32_t value)
+    {
+        this->m_reg[SYS_CNTL_INDEX] = value;
+    }
+
+    /// WU_CNTL register read hook
+    uint32_t
+    wu_cntl_rd()
+    {
+        return this->m_reg[WU_CNTL_INDEX];
+    }
+
+    /// WU_CNTL register write hook
+    void
+    wu_cntl_wr(uint32_t value)
+    {
+        this->m_reg[WU_CNTL_INDEX] = value;
+    }
+
+    /// SLEEP_CNTL register read hook
+    uint32_t
+    sleep_cntl_rd()
+    {
+        return this->m_reg[SLEEP_CNTL_INDEX];
+    }
+
+    /// SLEEP_CNTL register write hook
+    void
+    sleep_cntl_wr(uint32_t value)
+    {
+        this->m_reg[SLEEP_CNTL_INDEX] = value;
+    }
+
+    /// BS_CNTL register read hook
+    uint32_t
+    bs_cntl_rd()
+    {
+        return this->m_reg[BS_CNTL_INDEX];
+    }
+
+    /// BS_CNTL register write hook
+    void
+    bs_cntl_wr(uint32_t value)
+    {
+        this->m_reg[BS_CNTL_INDEX] = value;
+    }
+
+    /// COP_CNTL register read hook
+    uint32_t
+    cop_cntl_rd()
+    {
+        return this->m_reg[COP_CNTL_INDEX];
+    }
+
+    /// COP_CNTL register write hook
+    void
+    cop_cntl_wr(uint32_t value)
+    {
+        this->m_reg[COP_CNTL_INDEX] = value;
+    }
+
+    /// COP_SERVICE register read hook
+    uint32_t
+    cop_service_rd()
+    {
+        return this->m_reg[COP_SERVICE_INDEX];
+    }
+
+    /// COP_SERVICE register write hook
+    void
+    cop_service_wr(uint32_t value)
+    {
+        this->m_reg[COP_SERVICE_INDEX] = value;
+    }
+
+    /// STATUS register read hook
+    uint32_t
+    status_rd()
+    {
+        return this->m_reg[STATUS_INDEX];
+    }
+
+    /// STATUS register write hook
+    void
+    status_wr(uint32_t value)
+    {
+        this->m_reg[STATUS_INDEX] = value;
+    }
+
+    /// MOD_STATUS register read hook
+    uint32_t
+    mod_status_rd()
+    {
+        return this->m_reg[MOD_STATUS_INDEX];
+    }
+
+    /// MOD_STATUS register write hook
+    void
+    mod_status_wr(uint32_t value)
+    {
+        TLM_ERR("Write to R/O register MOD_STATUS, data = 0x%08X", value);
+    }
+
+    /// WU_COUNT register read hook
+    uint32_t
+    wu_count_rd()
+    {
+        return this->m_reg[WU_COUNT_INDEX];
+    }
+
+    /// WU_COUNT register write hook
+    void
+    wu_count_wr(uint32_t value)
+    {
+        TLM_ERR("Write to R/O register WU_COUNT, data = 0x%08X", value);
+    }
+
+    /// WU_TIMEOUT register read hook
+    uint32_t
+    wu_timeout_rd()
+    {
+        return this->m_reg[WU_TIMEOUT_INDEX];
+    }
+
+    /// WU_TIMEOUT register write hook
+    void
+    wu_timeout_wr(uint32_t value)
+    {
+        this->m_reg[WU_TIMEOUT_INDEX] = value;
+    }
+
+    /// RTC_COUNT register read hook
+    uint32_t
+    rtc_count_rd()
+    {
+        return this->m_reg[RTC_COUNT_INDEX];
+    }
+
+    /// RTC_COUNT register write hook
+    void
+    rtc_count_wr(uint32_t value)
+    {
+        TLM_ERR("Write to R/O register RTC_COUNT, data = 0x%08X", value);
+    }
+
+    /// RTC_TIMEOUT register read hook
+    uint32_t
+    rtc_timeout_rd()
+    {
+        return this->m_reg[RTC_TIMEOUT_INDEX];
+    }
+
+    /// RTC_TIMEOUT register write hook
+    void
+    rtc_timeout_wr(uint32_t value)
+    {
+        this->m_reg[RTC_TIMEOUT_INDEX] = value;
+    }
+
+    /// CAL_CNTL register read hook
+    uint32_t
+    cal_cntl_rd()
+    {
+        return this->m_reg[CAL_CNTL_INDEX];
+    }
+
+    /// CAL_CNTL register write hook
+    void
+    cal_cntl_wr(uint32_t value)
+    {
+        this->m_reg[CAL_CNTL_INDEX] = value;
+    }
+
+    /// CAL_COUNT register read hook
+    uint32_t
+    cal_count_rd()
+    {
+        return this->m_reg[CAL_COUNT_INDEX];
+    }
+
+    /// CAL_COUNT register write hook
+    void
+    cal_count_wr(uint32_t value)
+    {
+        TLM_ERR("Write to R/O register CAL_COUNT, data = 0x%08X", value);
+    }
+
+    /// RINGOSC_CNTL register read hook
+    uint32_t
+    ringosc_cntl_rd()
+    {
+        return this->m_reg[RINGOSC_CNTL_INDEX];
+    }
+
+    /// RINGOSC_CNTL register write hook
+    void
+    ringosc_cntl_wr(uint32_t value)
+    {
+        this->m_reg[RINGOSC_CNTL_INDEX] = value;
+    }
+
+    /// XTAL_CNTL register read hook
+    uint32_t
+    xtal_cntl_rd()
+    {
+        return this->m_reg[XTAL_CNTL_INDEX];
+    }
+
+    /// XTAL_CNTL register write hook
+    void
+    xtal_cntl_wr(uint32_t value)
+    {
+        this->m_reg[XTAL_CNTL_INDEX] = value;
+    }
+
+    /// XTAL32_CNTL register read hook
+    uint32_t
+    xtal32_cntl_rd()
+    {
+        return this->m_reg[XTAL32_CNTL_INDEX];
+    }
+
+    /// XTAL32_CNTL register write hook
+    void
+    xtal32_cntl_wr(uint32_t value)
+    {
+        this->m_reg[XTAL32_CNTL_INDEX] = value;
+    }
+
+    /// VREG_CNTL register read hook
+    uint32_t
+    vreg_cntl_rd()
+    {
+        return this->m_reg[VREG_CNTL_INDEX];
+    }
+
+    /// VREG_CNTL register write hook
+    void
+    vreg_cntl_wr(uint32_t value)
+    {
+        this->m_reg[VREG_CNTL_INDEX] = value;
+    }
+
+    /// SW_RST register read hook
+    uint32_t
+    sw_rst_rd()
+    {
+        return this->m_reg[SW_RST_INDEX];
+    }
+
+    /// SW_RST register write hook
+    void
+    sw_rst_wr(uint32_t value)
+    {
+        this->m_reg[SW_RST_INDEX] = value;
+    }
+
+    /** Register read function, dispatched to the register hooks of the model
+     * @param[in] offset Offset of the register to access
+     * @return The value read
+     */
+    virtual uint32_t
+    reg_rd(uint32_t offset)
+    {
+        MODEL* model = static_cast<MODEL*>(this);
+        uint32_t index = offset/4;
+
+        // sanity check
+        assert(index < REG_CRM_COUNT);
+
+        // internal delay
+        this->delay();
+
+        switch (index)
+        {
+        case SYS_CNTL_INDEX:
+            return model->sys_cntl_rd();
+        case WU_CNTL_INDEX:
+            return model->wu_cntl_rd();
+        case SLEEP_CNTL_INDEX:
+            return model->sleep_cntl_rd();
+        case BS_CNTL_INDEX:
+            return model->bs_cntl_rd();
+        case COP_CNTL_INDEX:
+            return model->cop_cntl_rd();
+        case COP_SERVICE_INDEX:
+            return model->cop_service_rd();
+        case STATUS_INDEX:
+            return model->status_rd();
+        case MOD_STATUS_INDEX:
+            return model->mod_status_rd();
+        case WU_COUNT_INDEX:
+            return model->wu_count_rd();
+        case WU_TIMEOUT_INDEX:
+            return model->wu_timeout_rd();
+        case RTC_COUNT_INDEX:
+            return model->rtc_count_rd();
+        case RTC_TIMEOUT_INDEX:
+            return model->rtc_timeout_rd();
+        case CAL_CNTL_INDEX:
+            return model->cal_cntl_rd();
+        case CAL_COUNT_INDEX:
+            return model->cal_count_rd();
+        case RINGOSC_CNTL_INDEX:
+            return model->ringosc_cntl_rd();
+        case XTAL_CNTL_INDEX:
+            return model->xtal_cntl_rd();
+        case XTAL32_CNTL_INDEX:
+            return model->xtal32_cntl_rd();
+        case VREG_CNTL_INDEX:
+            return model->vreg_cntl_rd();
+        case SW_RST_INDEX:
+            return model->sw_rst_rd();
+        default:
+            return this->m_reg[index];
+        }
+    }
+
+    /** Register write function, dispatched to the register hooks of the model
+     * @param[in] offset Offset of the register to access
+     * @param[in] value Value to write in the register
+     */
+    virtual void
+    reg_wr(uint32_t offset, uint32_t value)
+    {
+        MODEL* model = static_cast<MODEL*>(this);
+        uint32_t index = offset/4;
+
+        // sanity check
+        assert(index < REG_CRM_COUNT);
+
+        // internal delay
+        this->delay();
+
+        switch (index)
+        {
+        case SYS_CNTL_INDEX:
+            model->sys_cntl_wr(value);
+            break;
+        case WU_CNTL_INDEX:
+            model->wu_cntl_wr(value);
+            break;
+        case SLEEP_CNTL_INDEX:
+            model->sleep_cntl_wr(value);
+            break;
+        case BS_CNTL_INDEX:
+            model->bs_cntl_wr(value);
+            break;
+        case COP_CNTL_INDEX:
+            model->cop_cntl_wr(value);
+            break;
+        case COP_SERVICE_INDEX:
+            model->cop_service_wr(value);
+            break;
+        case STATUS_INDEX:
+            model->status_wr(value);
+            break;
+        case MOD_STATUS_INDEX:
+            model->mod_status_wr(value);
+            break;
+        case WU_COUNT_INDEX:
+            model->wu_count_wr(value);
+            break;
+        case WU_TIMEOUT_INDEX:
+            model->wu_timeout_wr(value);
+            break;
+        case RTC_COUNT_INDEX:
+            model->rtc_count_wr(value);
+            break;
+        case RTC_TIMEOUT_INDEX:
+            model->rtc_timeout_wr(value);
+            break;
+        case CAL_CNTL_INDEX:
+            model->cal_cntl_wr(value);
+            break;
+        case CAL_COUNT_INDEX:
+            model->cal_count_wr(value);
+            break;
+        case RINGOSC_CNTL_INDEX:
+            model->ringosc_cntl_wr(value);
+            break;
+        case XTAL_CNTL_INDEX:
+            model->xtal_cntl_wr(value);
+            break;
+        case XTAL32_CNTL_INDEX:
+            model->xtal32_cntl_wr(value);
+            break;
+        case VREG_CNTL_INDEX:
+            model->vreg_cntl_wr(value);
+            break;
+        case SW_RST_INDEX:
+            model->sw_rst_wr(value);
+            break;
+        default:
+            this->m_reg[index] = value;
+            break;
+        }
+    }
+};
 
 #endif // _REG_CRM_H_
 
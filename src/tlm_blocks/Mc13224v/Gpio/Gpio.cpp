@@ -1,55 +0,0 @@
-#include "Gpio.h"
-#include "utils.h"
-
-/// Used to select debugging (0 = OFF, 1 = ON)
-#define DEBUG_GPIO 0
-
-// Used to make direct register access
-uint32_t* reg_gpio;
-
-// using this namespace to simplify streaming
-using namespace std;
-
-uint32_t
-Gpio::reg_rd(uint32_t offset)
-{
-    uint32_t result;
-    // retrieve the required parameters
-    uint32_t index = offset/4;
-
-    // sanity check
-    assert(index < REG_GPIO_COUNT);
-
-    // internal delay
-    this->delay();
-
-    switch (index)
-    {
-    default:
-        // read the register value
-        result = m_reg[index];
-        break;
-    }
-    return result;
-}
-
-void
-Gpio::reg_wr(uint32_t offset, uint32_t value)
-{
-    // retrieve the required parameters
-    uint32_t index = offset/4;
-
-    // sanity check
-    assert(index < REG_GPIO_COUNT);
-
-    // internal delay
-    this->delay();
-
-    switch (index)
-    {
-    default:
-        m_reg[index] = value;
-        break;
-    }
-}
-
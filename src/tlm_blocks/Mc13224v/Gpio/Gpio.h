@@ -1,37 +1,21 @@
 #ifndef GPIO_H_
 #define GPIO_H_
 
-// this is a peripheral
-#include "Generic/Peripheral/Peripheral.h"
-
-// include the registers definition
+// this is a peripheral with the registers definition
 #include "reg_gpio.h"
 
 /// Interrupt Controller block model
-struct Gpio : Peripheral<REG_GPIO_COUNT>
+struct Gpio : RegGpio<Gpio>
 {
     /// Constructor
     Gpio(sc_core::sc_module_name name)
-    : Peripheral<REG_GPIO_COUNT>(name)
+    : RegGpio<Gpio>(name)
     {
-        // initialized the register access
-        reg_gpio = &(m_reg[0]);
+        // registers without side effects are served directly: the model has no hook, the
+        // pads configuration and data are plain storage (not the set and reset registers)
+        this->set_reg_access(GPIO_PAD_DIR0_INDEX, GPIO_PAD_KEEP1_INDEX - GPIO_PAD_DIR0_INDEX + 1,
+                             REG_ACCESS_PLAIN);
     }
-
-private:
-    /** Register read function
-     * @param[in] offset Offset of the register to read
-     * @return The value read
-     */
-    uint32_t
-    reg_rd(uint32_t offset);
-
-    /** Register write function
-     * @param[in] offset Offset of the register to read
-     * @param[in] offset Value to write in the register
-     */
-    void
-    reg_wr(uint32_t offset, uint32_t value);
 };
 
 #endif /*GPIO_H_*/
@@ -4,7 +4,7 @@
 #include <stdint.h>
 #include "compiler.h"
 #include "arch.h"
-#include "reg_sim.h"
+#include "Generic/Peripheral/Peripheral.h"
 
 #define REG_GPIO_BASE_ADDR 0x80000000
 
@@ -17,351 +17,954 @@
  */
 #define GPIO_PAD_DIR0_INDEX  0x00000000
 
-__INLINE uint32_t gpio_pad_dir0_get(void)
-{
-    return sim_reg_gpio_rd(GPIO_PAD_DIR0_INDEX);
-}
-
-__INLINE void gpio_pad_dir0_set(uint32_t value)
-{
-    sim_reg_gpio_wr(GPIO_PAD_DIR0_INDEX, value);
-}
-
 /**
  * @brief GPIO_PAD_DIR1 register definition
  */
 #define GPIO_PAD_DIR1_INDEX  0x00000001
 
-__INLINE uint32_t gpio_pad_dir1_get(void)
-{
-    return sim_reg_gpio_rd(GPIO_PAD_DIR1_INDEX);
-}
-
-__INLINE void gpio_pad_dir1_set(uint32_t value)
-{
-    sim_reg_gpio_wr(GPIO_PAD_DIR1_INDEX, value);
-}
-
 /**
  * @brief GPIO_DATA0 register definition
  */
 #define GPIO_DATA0_INDEX  0x00000002
 
-__INLINE uint32_t gpio_data0_get(void)
-{
-    return sim_reg_gpio_rd(GPIO_DATA0_INDEX);
-}
-
-__INLINE void gpio_data0_set(uint32_t value)
-{
-    sim_reg_gpio_wr(GPIO_DATA0_INDEX, value);
-}
-
 /**
  * @brief GPIO_DATA1 register definition
  */
 #define GPIO_DATA1_INDEX  0x00000003
 
-__INLINE uint32_t gpio_data1_get(void)
-{
-    return sim_reg_gpio_rd(GPIO_DATA1_INDEX);
-}
-
-__INLINE void gpio_data1_set(uint32_t value)
-{
-    sim_reg_gpio_wr(GPIO_DATA1_INDEX, value);
-}
-
 /**
  * @brief GPIO_PAD_PU_EN0 register definition
  */
 #define GPIO_PAD_PU_EN0_INDEX  0x00000004
 
-__INLINE uint32_t gpio_pad_pu_en0_get(void)
-{
-    return sim_reg_gpio_rd(GPIO_PAD_PU_EN0_INDEX);
-}
-
-__INLINE void gpio_pad_pu_en0_set(uint32_t value)
-{
-    sim_reg_gpio_wr(GPIO_PAD_PU_EN0_INDEX, value);
-}
-
 /**
  * @brief GPIO_PAD_PU_EN1 register definition
  */
 #define GPIO_PAD_PU_EN1_INDEX  0x00000005
 
-__INLINE uint32_t gpio_pad_pu_en1_get(void)
-{
-    return sim_reg_gpio_rd(GPIO_PAD_PU_EN1_INDEX);
-}
-
-__INLINE void gpio_pad_pu_en1_set(uint32_t value)
-{
-    sim_reg_gpio_wr(GPIO_PAD_PU_EN1_INDEX, value);
-}
-
 /**
  * @brief GPIO_FUNC_SEL0 register definition
  */
 #define GPIO_FUNC_SEL0_INDEX  0x00000006
 
-__INLINE uint32_t gpio_func_sel0_get(void)
-{
-    return sim_reg_gpio_rd(GPIO_FUNC_SEL0_INDEX);
-}
-
-__INLINE void gpio_func_sel0_set(uint32_t value)
-{
-    sim_reg_gpio_wr(GPIO_FUNC_SEL0_INDEX, value);
-}
-
 /**
  * @brief GPIO_FUNC_SEL1 register definition
  */
 #define GPIO_FUNC_SEL1_INDEX  0x00000007
 
-__INLINE uint32_t gpio_func_sel1_get(void)
-{
-    return sim_reg_gpio_rd(GPIO_FUNC_SEL1_INDEX);
-}
-
-__INLINE void gpio_func_sel1_set(uint32_t value)
-{
-    sim_reg_gpio_wr(GPIO_FUNC_SEL1_INDEX, value);
-}
-
 /**
  * @brief GPIO_FUNC_SEL2 register definition
  */
 #define GPIO_FUNC_SEL2_INDEX  0x00000008
 
-__INLINE uint32_t gpio_func_sel2_get(void)
-{
-    return sim_reg_gpio_rd(GPIO_FUNC_SEL2_INDEX);
-}
-
-__INLINE void gpio_func_sel2_set(uint32_t value)
-{
-    sim_reg_gpio_wr(GPIO_FUNC_SEL2_INDEX, value);
-}
-
 /**
  * @brief GPIO_FUNC_SEL3 register definition
  */
 #define GPIO_FUNC_SEL3_INDEX  0x00000009
 
-__INLINE uint32_t gpio_func_sel3_get(void)
-{
-    return sim_reg_gpio_rd(GPIO_FUNC_SEL3_INDEX);
-}
-
-__INLINE void gpio_func_sel3_set(uint32_t value)
-{
-    sim_reg_gpio_wr(GPIO_FUNC_SEL3_INDEX, value);
-}
-
 /**
  * @brief GPIO_DATA_SEL0 register definition
  */
 #define GPIO_DATA_SEL0_INDEX  0x0000000A
 
-__INLINE uint32_t gpio_data_sel0_get(void)
-{
-    return sim_reg_gpio_rd(GPIO_DATA_SEL0_INDEX);
-}
-
-__INLINE void gpio_data_sel0_set(uint32_t value)
-{
-    sim_reg_gpio_wr(GPIO_DATA_SEL0_INDEX, value);
-}
-
 /**
  * @brief GPIO_DATA_SEL1 register definition
  */
 #define GPIO_DATA_SEL1_INDEX  0x0000000B
 
-__INLINE uint32_t gpio_data_sel1_get(void)
-{
-    return sim_reg_gpio_rd(GPIO_DATA_SEL1_INDEX);
-}
-
-__INLINE void gpio_data_sel1_set(uint32_t value)
-{
-    sim_reg_gpio_wr(GPIO_DATA_SEL1_INDEX, value);
-}
-
 /**
  * @brief GPIO_PAD_PU_SEL0 register definition
  */
 #define GPIO_PAD_PU_SEL0_INDEX  0x0000000C
 
-__INLINE uint32_t gpio_pad_pu_sel0_get(void)
-{
-    return sim_reg_gpio_rd(GPIO_PAD_PU_SEL0_INDEX);
-}
-
-__INLINE void gpio_pad_pu_sel0_set(uint32_t value)
-{
-    sim_reg_gpio_wr(GPIO_PAD_PU_SEL0_INDEX, value);
-}
-
 /**
  * @brief GPIO_PAD_PU_SEL1 register definition
  */
 #define GPIO_PAD_PU_SEL1_INDEX  0x0000000D
 
-__INLINE uint32_t gpio_pad_pu_sel1_get(void)
-{
-    return sim_reg_gpio_rd(GPIO_PAD_PU_SEL1_INDEX);
-}
-
-__INLINE void gpio_pad_pu_sel1_set(uint32_t value)
-{
-    sim_reg_gpio_wr(GPIO_PAD_PU_SEL1_INDEX, value);
-}
-
 /**
  * @brief GPIO_PAD_HYST_EN0 register definition
  */
 #define GPIO_PAD_HYST_EN0_INDEX  0x0000000E
 
-__INLINE uint32_t gpio_pad_hyst_en0_get(void)
-{
-    return sim_reg_gpio_rd(GPIO_PAD_HYST_EN0_INDEX);
-}
-
-__INLINE void gpio_pad_hyst_en0_set(uint32_t value)
-{
-    sim_reg_gpio_wr(GPIO_PAD_HYST_EN0_INDEX, value);
-}
-
 /**
  * @brief GPIO_PAD_HYST_EN1 register definition
  */
 #define GPIO_PAD_HYST_EN1_INDEX  0x0000000F
 
-__INLINE uint32_t gpio_pad_hyst_en1_get(void)
-{
-    return sim_reg_gpio_rd(GPIO_PAD_HYST_EN1_INDEX);
-}
-
-__INLINE void gpio_pad_hyst_en1_set(uint32_t value)
-{
-    sim_reg_gpio_wr(GPIO_PAD_HYST_EN1_INDEX, value);
-}
-
 /**
  * @brief GPIO_PAD_KEEP0 register definition
  */
 #define GPIO_PAD_KEEP0_INDEX  0x00000010
 
-__INLINE uint32_t gpio_pad_keep0_get(void)
-{
-    return sim_reg_gpio_rd(GPIO_PAD_KEEP0_INDEX);
-}
-
-__INLINE void gpio_pad_keep0_set(uint32_t value)
-{
-    sim_reg_gpio_wr(GPIO_PAD_KEEP0_INDEX, value);
-}
-
 /**
  * @brief GPIO_PAD_KEEP1 register definition
  */
 #define GPIO_PAD_KEEP1_INDEX  0x00000011
 
-__INLINE uint32_t gpio_pad_keep1_get(void)
-{
-    return sim_reg_gpio_rd(GPIO_PAD_KEEP1_INDEX);
-}
-
-__INLINE void gpio_pad_keep1_set(uint32_t value)
-{
-    sim_reg_gpio_wr(GPIO_PAD_KEEP1_INDEX, value);
-}
-
 /**
  * @brief GPIO_DATA_SET0 register definition
  */
 #define GPIO_DATA_SET0_INDEX  0x00000012
 
-__INLINE void gpio_data_set0_set(uint32_t value)
-{
-    sim_reg_gpio_wr(GPIO_DATA_SET0_INDEX, value);
-}
-
 /**
  * @brief GPIO_DATA_SET1 register definition
  */
 #define GPIO_DATA_SET1_INDEX  0x00000013
 
-__INLINE void gpio_data_set1_set(uint32_t value)
-{
-    sim_reg_gpio_wr(GPIO_DATA_SET1_INDEX, value);
-}
-
 /**
  * @brief GPIO_DATA_RESET0 register definition
  */
 #define GPIO_DATA_RESET0_INDEX  0x00000014
 
-__INLINE void gpio_data_reset0_set(uint32_t value)
-{
-    sim_reg_gpio_wr(GPIO_DATA_RESET0_INDEX, value);
-}
-
 /**
  * @brief GPIO_DATA_RESET1 register definition
  */
 #define GPIO_DATA_RESET1_INDEX  0x00000015
 
-__INLINE void gpio_data_reset1_set(uint32_t value)
-{
-    sim_reg_gpio_wr(GPIO_DATA_RESET1_INDEX, value);
-}
-
 /**
  * @brief GPIO_PAD_DIR_SET0 register definition
  */
 #define GPIO_PAD_DIR_SET0_INDEX  0x00000016
 
-__INLINE void gpio_pad_dir_set0_set(uint32_t value)
-{
-    sim_reg_gpio_wr(GPIO_PAD_DIR_SET0_INDEX, value);
-}
-
 /**
  * @brief GPIO_PAD_DIR_SET1 register definition
  */
 #define GPIO_PAD_DIR_SET1_INDEX  0x00000017
 
-__INLINE void gpio_pad_dir_set1_set(uint32_t value)
-{
-    sim_reg_gpio_wr(GPIO_PAD_DIR_SET1_INDEX, value);
-}
-
 /**
  * @brief GPIO_PAD_DIR_RESET0 register definition
  */
 #define GPIO_PAD_DIR_RESET0_INDEX  0x00000018
 
-__INLINE void gpio_pad_dir_reset0_set(uint32_t value)
-{
-    sim_reg_gpio_wr(GPIO_PAD_DIR_RESET0_INDEX, value);
-}
-
 /**
  * @brief GPIO_PAD_DIR_RESET1 register definition
  */
 #define GPIO_PAD_DIR_RESET1_INDEX  0x00000019
 
-__INLINE void gpio_pad_dir_reset1_set(uint32_t value)
-{
-    sim_reg_gpio_wr(GPIO_PAD_DIR_RESET1_INDEX, value);
-}
-
+/**
+ * @brief Register map of the REG_GPIO block, to be derived by the block model
+ *
+ * The register accesses are dispatched at compile time to the register hooks
+ * {regname}_rd() and {regname}_wr(value) of the model, which only redefines the
+ * hooks of the registers having side effects.
+ * @param MODEL Block model deriving from this class
+ */
+template <typename MODEL>
+struct RegGpio : Peripheral<REG_GPIO_COUNT>
+{
+    /** Constructor
+     * @param[in] name Name of the module
+     */
+    RegGpio(sc_core::sc_module_name name)
+    : Peripheral<REG_GPIO_COUNT>(name)
+    {
+        this->set_reg_names(&reg_name);
+    }
+
+    /** Name of a register
+     * @param[in] index Index of the register
+     * @return The name of the register, NULL if there is no register at this index
+     */
+    static const char*
+    reg_name(uint32_t index)
+    {
+        static const char* const names[REG_GPIO_COUNT] =
+        {
+            "GPIO_PAD_DIR0",
+            "GPIO_PAD_DIR1",
+            "GPIO_DATA0",
+            "GPIO_DATA1",
+            "GPIO_PAD_PU_EN0",
+            "GPIO_PAD_PU_EN1",
+            "GPIO_FUNC_SEL0",
+            "GPIO_FUNC_SEL1",
+            "GPIO_FUNC_SEL2",
+            "GPIO_FUNC_SEL3",
+            "GPIO_DATA_SEL0",
+            "GPIO_DATA_SEL1",
+            "GPIO_PAD_PU_SEL0",
+            "GPIO_PAD_PU_SEL1",
+            "GPIO_PAD_HYST_EN0",
+            "GPIO_PAD_HYST_EN1",
+            "GPIO_PAD_KEEP0",
+            "GPIO_PAD_KEEP1",
+            "GPIO_DATA_SET0",
+            "GPIO_DATA_SET1",
+            "GPIO_DATA_RESET0",
+            "GPIO_DATA_RESET1",
+            "GPIO_PAD_DIR_SET0",
+            "GPIO_PAD_DIR_SET1",
+            "GPIO_PAD_DIR_RESET0",
+            "GPIO_PAD_DIR_RESET1",
+        };
+
+        return (index < REG_GPIO_COUNT) ? names[index] : NULL;
+    }
+
+    uint32_t gpio_pad_dir0_get(void)
+    {
+        return this->m_reg[GPIO_PAD_DIR0_INDEX];
+    }
+
+    void gpio_pad_dir0_set(uint32_t value)
+    {
+        this->m_reg[GPIO_PAD_DIR0_INDEX] = value;
+    }
+
+    uint32_t gpio_pad_dir1_get(void)
+    {
+        return this->m_reg[GPIO_PAD_DIR1_INDEX];
+    }
+
+    void gpio_pad_dir1_set(uint32_t value)
+    {
+        this->m_reg[GPIO_PAD_DIR1_INDEX] = value;
+    }
+
+    uint32_t gpio_data0_get(void)
+    {
+        return this->m_reg[GPIO_DATA0_INDEX];
+    }
+
+    void gpio_data0_set(uint32_t value)
+    {
+        this->m_reg[GPIO_DATA0_INDEX] = value;
+    }
+
+    uint32_t gpio_data1_get(void)
+    {
+        return this->m_reg[GPIO_DATA1_INDEX];
+    }
+
+    void gpio_data1_set(uint32_t value)
+    {
+        this->m_reg[GPIO_DATA1_INDEX] = value;
+    }
+
+    uint32_t gpio_pad_pu_en0_get(void)
+    {
+        return this->m_reg[GPIO_PAD_PU_EN0_INDEX];
+    }
+
+    void gpio_pad_pu_en0_set(uint32_t value)
+    {
+        this->m_reg[GPIO_PAD_PU_EN0_INDEX] = value;
+    }
+
+    uint32_t gpio_pad_pu_en1_get(void)
+    {
+        return this->m_reg[GPIO_PAD_PU_EN1_INDEX];
+    }
+
+    void gpio_pad_pu_en1_set(uint32_t value)
+    {
+        this->m_reg[GPIO_PAD_PU_EN1_INDEX] = value;
+    }
+
+    uint32_t gpio_func_sel0_get(void)
+    {
+        return this->m_reg[GPIO_FUNC_SEL0_INDEX];
+    }
+
+    void gpio_func_sel0_set(uint32_t value)
+    {
+        this->m_reg[GPIO_FUNC_SEL0_INDEX] = value;
+    }
+
+    uint32_t gpio_func_sel1_get(void)
+    {
+        return this->m_reg[GPIO_FUNC_SEL1_INDEX];
+    }
+
+    void gpio_func_sel1_set(uint32_t value)
+    {
+        this->m_reg[GPIO_FUNC_SEL1_INDEX] = value;
+    }
+
+    uint32_t gpio_func_sel2_get(void)
+    {
+        return this->m_reg[GPIO_FUNC_SEL2_INDEX];
+    }
+
+    void gpio_func_sel2_set(uint32_t value)
+    {
+        this->m_reg[GPIO_FUNC_SEL2_INDEX] = value;
+    }
+
+    uint32_t gpio_func_sel3_get(void)
+    {
+        return this->m_reg[GPIO_FUNC_SEL3_INDEX];
+    }
+
+    void gpio_func_sel3_set(uint32_t value)
+    {
+        this->m_reg[GPIO_FUNC_SEL3_INDEX] = value;
+    }
+
+    uint32_t gpio_data_sel0_get(void)
+    {
+        return this->m_reg[GPIO_DATA_SEL0_INDEX];
+    }
+
+    void gpio_data_sel0_set(uint32_t value)
+    {
+        this->m_reg[GPIO_DATA_SEL0_INDEX] = value;
+    }
+
+    uint32_t gpio_data_sel1_get(void)
+    {
+        return this->m_reg[GPIO_DATA_SEL1_INDEX];
+    }
+
+    void gpio_data_sel1_set(uint32_t value)
+    {
+        this->m_reg[GPIO_DATA_SEL1_INDEX] = value;
+    }
+
+    uint32_t gpio_pad_pu_sel0_get(void)
+    {
+        return this->m_reg[GPIO_PAD_PU_SEL0_INDEX];
+    }
+
+    void gpio_pad_pu_sel0_set(uint32_t value)
+    {
+        this->m_reg[GPIO_PAD_PU_SEL0_INDEX] = value;
+    }
+
+    uint32_t gpio_pad_pu_sel1_get(void)
+    {
+        return this->m_reg[GPIO_PAD_PU_SEL1_INDEX];
+    }
+
+    void gpio_pad_pu_sel1_set(uint32_t value)
+    {
+        this->m_reg[GPIO_PAD_PU_SEL1_INDEX] = value;
+    }
+
+    uint32_t gpio_pad_hyst_en0_get(void)
+    {
+        return this->m_reg[GPIO_PAD_HYST_EN0_INDEX];
+    }
+
+    void gpio_pad_hyst_en0_set(uint32_t value)
+    {
+        this->m_reg[GPIO_PAD_HYST_EN0_INDEX] = value;
+    }
+
+    uint32_t gpio_pad_hyst_en1_get(void)
+    {
+        return this->m_reg[GPIO_PAD_HYST_EN1_INDEX];
+    }
+
+    void gpio_pad_hyst_en1_set(uint32_t value)
+    {
+        this->m_reg[GPIO_PAD_HYST_EN1_INDEX] = value;
+    }
+
+    uint32_t gpio_pad_keep0_get(void)
+    {
+        return this->m_reg[GPIO_PAD_KEEP0_INDEX];
+    }
+
+    void gpio_pad_keep0_set(uint32_t value)
+    {
+        this->m_reg[GPIO_PAD_KEEP0_INDEX] = value;
+    }
+
+    uint32_t gpio_pad_keep1_get(void)
+    {
+        return this->m_reg[GPIO_PAD_KEEP1_INDEX];
+    }
+
+    void gpio_pad_keep1_set(uint32_t value)
+    {
+        this->m_reg[GPIO_PAD_KEEP1_INDEX] = value;
+    }
+
+    void gpio_data_set0_set(uint32_t value)
+    {
+        this->m_reg[GPIO_DATA_SET0_INDEX] = value;
+    }
+
+    void gpio_data_set1_set(uint32_t value)
+    {
+        this->m_reg[GPIO_DATA_SET1_INDEX] = value;
+    }
+
+    void gpio_data_reset0_set(uint32_t value)
+    {
+        this->m_reg[GPIO_DATA_RESET0_INDEX] = value;
+    }
+
+    void gpio_data_reset1_set(uint32_t value)
+    {
+        this->m_reg[GPIO_DATA_RESET1_INDEX] = value;
+    }
+
+    void gpio_pad_dir_set0_set(uint32_t value)
+    {
+        this->m_reg[GPIO_PAD_DIR_SET0_INDEX] = value;
+    }
+
+    void gpio_pad_dir_set1_set(uint32_t value)
+    {
+        this->m_reg[GPIO_PAD_DIR_SET1_INDEX] = value;
+    }
+
+    void gpio_pad_dir_reset0_set(uint32_t value)
+    {
+        this->m_reg[GPIO_PAD_DIR_RESET0_INDEX] = value;
+    }
+
+    void gpio_pad_dir_reset1_set(uint32_t value)
+    {
+        this->m_reg[GPIO_PAD_DIR_RESET1_INDEX] = value;
+    }
+
+
+protected:
+    /// GPIO_PAD_DIR0 register read hook
+    uint32_t
+    gpio_pad_dir0_rd()
+    {
+        return this->m_reg[GPIO_PAD_DIR0_INDEX];
+    }
+
+    /// GPIO_PAD_DIR0 register write hook
+    void
+    gpio_pad_dir0_wr(uint32_t value)
+    {
+        this->m_reg[GPIO_PAD_DIR0_INDEX] = value;
+    }
+
+    /// GPIO_PAD_DIR1 register read hook
+    uint32_t
+    gpio_pad_dir1_rd()
+    {
+        return this->m_reg[GPIO_PAD_DIR1_INDEX];
+    }
+
+    /// GPIO_PAD_DIR1 register write hook
+    void
+    gpio_pad_dir1_wr(uint32_t value)
+    {
+        this->m_reg[GPIO_PAD_DIR1_INDEX] = value;
+    }
+
+    /// GPIO_DATA0 register read hook
+    uint32_t
+    gpio_data0_rd()
+    {
+        return this->m_reg[GPIO_DATA0_INDEX];
+    }
+
+    /// GPIO_DATA0 register write hook
+    void
+    gpio_data0_wr(uint32_t value)
+    {
+        this->m_reg[GPIO_DATA0_INDEX] = value;
+    }
+
+    /// GPIO_DATA1 register read hook
+    uint32_t
+    gpio_data1_rd()
+    {
+        return this->m_reg[GPIO_DATA1_INDEX];
+    }
+
+    /// GPIO_DATA1 register write hook
+    void
+    gpio_data1_wr(uint32_t value)
+    {
+        this->m_reg[GPIO_DATA1_INDEX] = value;
+    }
+
+    /// GPIO_PAD_PU_EN0 register read hook
+    uint32_t
+    gpio_pad_pu_en0_rd()
+    {
+        return this->m_reg[GPIO_PAD_PU_EN0_INDEX];
+    }
+
+    /// GPIO_PAD_PU_EN0 register write hook
+    void
+    gpio_pad_pu_en0_wr(uint32_t value)
+    {
+        this->m_reg[GPIO_PAD_PU_EN0_INDEX] = value;
+    }
+
+    /// GPIO_PAD_PU_EN1 register read hook
+    uint32_t
+    gpio_pad_pu_en1_rd()
+    {
+        return this->m_reg[GPIO_PAD_PU_EN1_INDEX];
+    }
+
+    /// GPIO_PAD_PU_EN1 register write hook
+    void
+    gpio_pad_pu_en1_wr(uint32_t value)
+    {
+        this->m_reg[GPIO_PAD_PU_EN1_INDEX] = value;
+    }
+
+    /// GPIO_FUNC_SEL0 register read hook
+    uint32_t
+    gpio_func_sel0_rd()
+    {
+        return this->m_reg[GPIO_FUNC_SEL0_INDEX];
+    }
+
+    /// GPIO_FUNC_SEL0 register write hook
+    void
+    gpio_func_sel0_wr(uint32_t value)
+    {
+        this->m_reg[GPIO_FUNC_SEL0_INDEX] = value;
+    }
+
+    /// GPIO_FUNC_SEL1 register read hook
+    uint32_t
+    gpio_func_sel1_rd()
+    {
+        return this->m_reg[GPIO_FUNC_SEL1_INDEX];
+    }
+
+    /// GPIO_FUNC_SEL1 register write hook
+    void
+    gpio_func_sel1_wr(uint32_t value)
+    {
+        this->m_reg[GPIO_FUNC_SEL1_INDEX] = value;
+    }
+
+    /// GPIO_FUNC_SEL2 register read hook
+    uint32_t
+    gpio_func_sel2_rd()
+    {
+        return this->m_reg[GPIO_FUNC_SEL2_INDEX];
+    }
+
+    /// GPIO_FUNC_SEL2 register write hook
+    void
+    gpio_func_sel2_wr(uint32_t value)
+    {
+        this->m_reg[GPIO_FUNC_SEL2_INDEX] = value;
+    }
+
+    /// GPIO_FUNC_SEL3 register read hook
+    uint32_t
+    gpio_func_sel3_rd()
+    {
+        return this->m_reg[GPIO_FUNC_SEL3_INDEX];
+    }
+
+    /// GPIO_FUNC_SEL3 register write hook
+    void
+    gpio_func_sel3_wr(uint32_t value)
+    {
+        this->m_reg[GPIO_FUNC_SEL3_INDEX] = value;
+    }
+
+    /// GPIO_DATA_SEL0 register read hook
+    uint32_t
+    gpio_data_sel0_rd()
+    {
+        return this->m_reg[GPIO_DATA_SEL0_INDEX];
+    }
+
+    /// GPIO_DATA_SEL0 register write hook
+    void
+    gpio_data_sel0_wr(uint32_t value)
+    {
+        this->m_reg[GPIO_DATA_SEL0_INDEX] = value;
+    }
+
+    /// GPIO_DATA_SEL1 register read hook
+    uint32_t
+    gpio_data_sel1_rd()
+    {
+        return this->m_reg[GPIO_DATA_SEL1_INDEX];
+    }
+
+    /// GPIO_DATA_SEL1 register write hook
+    void
+    gpio_data_sel1_wr(uint32_t value)
+    {
+        this->m_reg[GPIO_DATA_SEL1_INDEX] = value;
+    }
+
+    /// GPIO_PAD_PU_SEL0 register read hook
+    uint32_t
+    gpio_pad_pu_sel0_rd()
+    {
+        return this->m_reg[GPIO_PAD_PU_SEL0_INDEX];
+    }
+
+    /// GPIO_PAD_PU_SEL0 register write hook
+    void
+    gpio_pad_pu_sel0_wr(uint32_t value)
+    {
+        this->m_reg[GPIO_PAD_PU_SEL0_INDEX] = value;
+    }
+
+    /// GPIO_PAD_PU_SEL1 register read hook
+    uint32_t
+    gpio_pad_pu_sel1_rd()
+    {
+        return this->m_reg[GPIO_PAD_PU_SEL1_INDEX];
+    }
+
+    /// GPIO_PAD_PU_SEL1 register write hook
+    void
+    gpio_pad_pu_sel1_wr(uint32_t value)
+    {
+        this->m_reg[GPIO_PAD_PU_SEL1_INDEX] = value;
+    }
+
+    /// GPIO_PAD_HYST_EN0 register read hook
+    uint32_t
+    gpio_pad_hyst_en0_rd()
+    {
+        return this->m_reg[GPIO_PAD_HYST_EN0_INDEX];
+    }
+
+    /// GPIO_PAD_HYST_EN0 register write hook
+    void
+    gpio_pad_hyst_en0_wr(uint32_t value)
+    {
+        this->m_reg[GPIO_PAD_HYST_EN0_INDEX] = value;
+    }
+
+    /// GPIO_PAD_HYST_EN1 register read hook
+    uint32_t
+    gpio_pad_hyst_en1_rd()
+    {
+        return this->m_reg[GPIO_PAD_HYST_EN1_INDEX];
+    }
+
+    /// GPIO_PAD_HYST_EN1 register write hook
+    void
+    gpio_pad_hyst_en1_wr(uint32_t value)
+    {
+        this->m_reg[GPIO_PAD_HYST_EN1_INDEX] = value;
+    }
+
+    /// GPIO_PAD_KEEP0 register read hook
+    uint32_t
+    gpio_pad_keep0_rd()
+    {
+        return this->m_reg[GPIO_PAD_KEEP0_INDEX];
+    }
+
+    /// GPIO_PAD_KEEP0 register write hook
+    void
+    gpio_pad_keep0_wr(uint32_t value)
+    {
+        this->m_reg[GPIO_PAD_KEEP0_INDEX] = value;
+    }
+
+    /// GPIO_PAD_KEEP1 register read hook
+    uint32_t
+    gpio_pad_keep1_rd()
+    {
+        return this->m_reg[GPIO_PAD_KEEP1_INDEX];
+    }
+
+    /// GPIO_PAD_KEEP1 register write hook
+    void
+    gpio_pad_keep1_wr(uint32_t value)
+    {
+        this->m_reg[GPIO_PAD_KEEP1_INDEX] = value;
+    }
+
+    /// GPIO_DATA_SET0 register read hook
+    uint32_t
+    gpio_data_set0_rd()
+    {
+        return this->m_reg[GPIO_DATA_SET0_INDEX];
+    }
+
+    /// GPIO_DATA_SET0 register write hook
+    void
+    gpio_data_set0_wr(uint32_t value)
+    {
+        this->m_reg[GPIO_DATA_SET0_INDEX] = value;
+    }
+
+    /// GPIO_DATA_SET1 register read hook
+    uint32_t
+    gpio_data_set1_rd()
+    {
+        return this->m_reg[GPIO_DATA_SET1_INDEX];
+    }
+
+    /// GPIO_DATA_SET1 register write hook
+    void
+    gpio_data_set1_wr(uint32_t value)
+    {
+        this->m_reg[GPIO_DATA_SET1_INDEX] = value;
+    }
+
+    /// GPIO_DATA_RESET0 register read hook
+    uint32_t
+    gpio_data_reset0_rd()
+    {
+        return this->m_reg[GPIO_DATA_RESET0_INDEX];
+    }
+
+    /// GPIO_DATA_RESET0 register write hook
+    void
+    gpio_data_reset0_wr(uint32_t value)
+    {
+        this->m_reg[GPIO_DATA_RESET0_INDEX] = value;
+    }
+
+    /// GPIO_DATA_RESET1 register read hook
+    uint32_t
+    gpio_data_reset1_rd()
+    {
+        return this->m_reg[GPIO_DATA_RESET1_INDEX];
+    }
+
+    /// GPIO_DATA_RESET1 register write hook
+    void
+    gpio_data_reset1_wr(uint32_t value)
+    {
+        this->m_reg[GPIO_DATA_RESET1_INDEX] = value;
+    }
+
+    /// GPIO_PAD_DIR_SET0 register read hook
+    uint32_t
+    gpio_pad_dir_set0_rd()
+    {
+        return this->m_reg[GPIO_PAD_DIR_SET0_INDEX];
+    }
+
+    /// GPIO_PAD_DIR_SET0 register write hook
+    void
+    gpio_pad_dir_set0_wr(uint32_t value)
+    {
+        this->m_reg[GPIO_PAD_DIR_SET0_INDEX] = value;
+    }
+
+    /// GPIO_PAD_DIR_SET1 register read hook
+    uint32_t
+    gpio_pad_dir_set1_rd()
+    {
+        return this->m_reg[GPIO_PAD_DIR_SET1_INDEX];
+    }
+
+    /// GPIO_PAD_DIR_SET1 register write hook
+    void
+    gpio_pad_dir_set1_wr(uint32_t value)
+    {
+        this->m_reg[GPIO_PAD_DIR_SET1_INDEX] = value;
+    }
+
+    /// GPIO_PAD_DIR_RESET0 register read hook
+    uint32_t
+    gpio_pad_dir_reset0_rd()
+    {
+        return this->m_reg[GPIO_PAD_DIR_RESET0_INDEX];
+    }
+
+    /// GPIO_PAD_DIR_RESET0 register write hook
+    void
+    gpio_pad_dir_reset0_wr(uint32_t value)
+    {
+        this->m_reg[GPIO_PAD_DIR_RESET0_INDEX] = value;
+    }
+
+    /// GPIO_PAD_DIR_RESET1 register read hook
+    uint32_t
+    gpio_pad_dir_reset1_rd()
+    {
+        return this->m_reg[GPIO_PAD_DIR_RESET1_INDEX];
+    }
+
+    /// GPIO_PAD_DIR_RESET1 register write hook
+    void
+    gpio_pad_dir_reset1_wr(uint32_t value)
+    {
+        this->m_reg[GPIO_PAD_DIR_RESET1_INDEX] = value;
+    }
+
+    /** Register read function, dispatched to the register hooks of the model
+     * @param[in] offset Offset of the register to access
+     * @return The value read
+     */
+    virtual uint32_t
+    reg_rd(uint32_t offset)
+    {
+        MODEL* model = static_cast<MODEL*>(this);
+        uint32_t index = offset/4;
+
+        // sanity check
+        assert(index < REG_GPIO_COUNT);
+
+        // internal delay
+        this->delay();
+
+        switch (index)
+        {
+        case GPIO_PAD_DIR0_INDEX:
+            return model->gpio_pad_dir0_rd();
+        case GPIO_PAD_DIR1_INDEX:
+            return model->gpio_pad_dir1_rd();
+        case GPIO_DATA0_INDEX:
+            return model->gpio_data0_rd();
+        case GPIO_DATA1_INDEX:
+            return model->gpio_data1_rd();
+        case GPIO_PAD_PU_EN0_INDEX:
+            return model->gpio_pad_pu_en0_rd();
+        case GPIO_PAD_PU_EN1_INDEX:
+            return model->gpio_pad_pu_en1_rd();
+        case GPIO_FUNC_SEL0_INDEX:
+            return model->gpio_func_sel0_rd();
+        case GPIO_FUNC_SEL1_INDEX:
+            return model->gpio_func_sel1_rd();
+        case GPIO_FUNC_SEL2_INDEX:
+            return model->gpio_func_sel2_rd();
+        case GPIO_FUNC_SEL3_INDEX:
+            return model->gpio_func_sel3_rd();
+        case GPIO_DATA_SEL0_INDEX:
+            return model->gpio_data_sel0_rd();
+        case GPIO_DATA_SEL1_INDEX:
+            return model->gpio_data_sel1_rd();
+        case GPIO_PAD_PU_SEL0_INDEX:
+            return model->gpio_pad_pu_sel0_rd();
+        case GPIO_PAD_PU_SEL1_INDEX:
+            return model->gpio_pad_pu_sel1_rd();
+        case GPIO_PAD_HYST_EN0_INDEX:
+            return model->gpio_pad_hyst_en0_rd();
+        case GPIO_PAD_HYST_EN1_INDEX:
+            return model->gpio_pad_hyst_en1_rd();
+        case GPIO_PAD_KEEP0_INDEX:
+            return model->gpio_pad_keep0_rd();
+        case GPIO_PAD_KEEP1_INDEX:
+            return model->gpio_pad_keep1_rd();
+        case GPIO_DATA_SET0_INDEX:
+            return model->gpio_data_set0_rd();
+        case GPIO_DATA_SET1_INDEX:
+            return model->gpio_data_set1_rd();
+        case GPIO_DATA_RESET0_INDEX:
+            return model->gpio_data_reset0_rd();
+        case GPIO_DATA_RESET1_INDEX:
+            return model->gpio_data_reset1_rd();
+        case GPIO_PAD_DIR_SET0_INDEX:
+            return model->gpio_pad_dir_set0_rd();
+        case GPIO_PAD_DIR_SET1_INDEX:
+            return model->gpio_pad_dir_set1_rd();
+        case GPIO_PAD_DIR_RESET0_INDEX:
+            return model->gpio_pad_dir_reset0_rd();
+        case GPIO_PAD_DIR_RESET1_INDEX:
+            return model->gpio_pad_dir_reset1_rd();
+        default:
+            return this->m_reg[index];
+        }
+    }
+
+    /** Register write function, dispatched to the register hooks of the model
+     * @param[in] offset Offset of the register to access
+     * @param[in] value Value to write in the register
+     */
+    virtual void
+    reg_wr(uint32_t offset, uint32_t value)
+    {
+        MODEL* model = static_cast<MODEL*>(this);
+        uint32_t index = offset/4;
+
+        // sanity check
+        assert(index < REG_GPIO_COUNT);
+
+        // internal delay
+        this->delay();
+
+        switch (index)
+        {
+        case GPIO_PAD_DIR0_INDEX:
+            model->gpio_pad_dir0_wr(value);
+            break;
+        case GPIO_PAD_DIR1_INDEX:
+            model->gpio_pad_dir1_wr(value);
+            break;
+        case GPIO_DATA0_INDEX:
+            model->gpio_data0_wr(value);
+            break;
+        case GPIO_DATA1_INDEX:
+            model->gpio_data1_wr(value);
+            break;
+        case GPIO_PAD_PU_EN0_INDEX:
+            model->gpio_pad_pu_en0_wr(value);
+            break;
+        case GPIO_PAD_PU_EN1_INDEX:
+            model->gpio_pad_pu_en1_wr(value);
+            break;
+        case GPIO_FUNC_SEL0_INDEX:
+            model->gpio_func_sel0_wr(value);
+            break;
+        case GPIO_FUNC_SEL1_INDEX:
+            model->gpio_func_sel1_wr(value);
+            break;
+        case GPIO_FUNC_SEL2_INDEX:
+            model->gpio_func_sel2_wr(value);
+            break;
+        case GPIO_FUNC_SEL3_INDEX:
+            model->gpio_func_sel3_wr(value);
+            break;
+        case GPIO_DATA_SEL0_INDEX:
+            model->gpio_data_sel0_wr(value);
+            break;
+        case GPIO_DATA_SEL1_INDEX:
+            model->gpio_data_sel1_wr(value);
+            break;
+        case GPIO_PAD_PU_SEL0_INDEX:
+            model->gpio_pad_pu_sel0_wr(value);
+            break;
+        case GPIO_PAD_PU_SEL1_INDEX:
+            model->gpio_pad_pu_sel1_wr(value);
+            break;
+        case GPIO_PAD_HYST_EN0_INDEX:
+            model->gpio_pad_hyst_en0_wr(value);
+            break;
+        case GPIO_PAD_HYST_EN1_INDEX:
+            model->gpio_pad_hyst_en1_wr(value);
+            break;
+        case GPIO_PAD_KEEP0_INDEX:
+            model->gpio_pad_keep0_wr(value);
+            break;
+        case GPIO_PAD_KEEP1_INDEX:
+            model->gpio_pad_keep1_wr(value);
+            break;
+        case GPIO_DATA_SET0_INDEX:
+            model->gpio_data_set0_wr(value);
+            break;
+        case GPIO_DATA_SET1_INDEX:
+            model->gpio_data_set1_wr(value);
+            break;
+        case GPIO_DATA_RESET0_INDEX:
+            model->gpio_data_reset0_wr(value);
+            break;
+        case GPIO_DATA_RESET1_INDEX:
+            model->gpio_data_reset1_wr(value);
+            break;
+        case GPIO_PAD_DIR_SET0_INDEX:
+            model->gpio_pad_dir_set0_wr(value);
+            break;
+        case GPIO_PAD_DIR_SET1_INDEX:
+            model->gpio_pad_dir_set1_wr(value);
+            break;
+        case GPIO_PAD_DIR_RESET0_INDEX:
+            model->gpio_pad_dir_reset0_wr(value);
+            break;
+        case GPIO_PAD_DIR_RESET1_INDEX:
+            model->gpio_pad_dir_reset1_wr(value);
+            break;
+        default:
+            this->m_reg[index] = value;
+            break;
+        }
+    }
+};
 
 #endif // _REG_GPIO_H_
 
@@ -4,91 +4,81 @@
 /// Used to select debugging (0 = OFF, 1 = ON)
 #define DEBUG_ITC 0
 
-// Used to make direct register access
-uint32_t* reg_itc;
-
 // using this namespace to simplify streaming
 using namespace std;
 
 uint32_t
-Itc::reg_rd(uint32_t offset)
+Itc::intennum_rd()
 {
-    uint32_t result;
-    // retrieve the required parameters
-    uint32_t index = offset/4;
+    TLM_ERR("Read to ITC W/O register %02X", INTENNUM_INDEX*4);
+    return 0;
+}
 
-    // sanity check
-    assert(index < REG_ITC_COUNT);
+uint32_t
+Itc::intdisnum_rd()
+{
+    TLM_ERR("Read to ITC W/O register %02X", INTDISNUM_INDEX*4);
+    return 0;
+}
 
-    // internal delay
-    this->delay();
+void
+Itc::intennum_wr(uint32_t value)
+{
+    // enable a single interrupt in the enable mask
+    intenable_set(intenable_get() | (1 << value));
 
-    switch (index)
-    {
-    case INTENNUM_INDEX:
-    case INTDISNUM_INDEX:
-        TLM_ERR("Read to ITC W/O register %02X", offset);
-        result = 0;
-        break;
-
-    default:
-        // read the register value
-        result = m_reg[index];
-        break;
-    }
+    // the configuration of the interrupts changed, update the lines
+    this->check_int();
+}
 
-    return result;
+void
+Itc::intdisnum_wr(uint32_t value)
+{
+    // disable a single interrupt in the enable mask
+    intenable_set(intenable_get() & (~(1 << value)));
+
+    // the configuration of the interrupts changed, update the lines
+    this->check_int();
 }
 
 void
-Itc::reg_wr(uint32_t offset, uint32_t value)
+Itc::nimask_wr(uint32_t value)
 {
-    // retrieve the required parameters
-    uint32_t index = offset/4;
+    nimask_set(value);
 
-    // sanity check
-    assert(index < REG_ITC_COUNT);
+    // the configuration of the interrupts changed, update the lines
+    this->check_int();
+}
 
-    // internal delay
-    this->delay();
+void
+Itc::intenable_wr(uint32_t value)
+{
+    intenable_set(value);
 
-    switch (index)
-    {
-    case NIVECTOR_INDEX:
-    case FIVECTOR_INDEX:
-    case INTSRC_INDEX:
-    case NIPEND_INDEX:
-    case FIPEND_INDEX:
-        TLM_ERR("Write to ITC R/O register %02X, data = 0x%08X", offset, value);
-        break;
-    case INTENNUM_INDEX:
-        // enable a single interrupt in the enable mask
-        intenable_set(intenable_get() | (1 << value));
-        break;
-
-    case INTDISNUM_INDEX:
-        // disable a single interrupt in the enable mask
-        intenable_set(intenable_get() & (~(1 << value)));
-        break;
-
-    default:
-        m_reg[index] = value;
-        break;
-    }
+    // the configuration of the interrupts changed, update the lines
+    this->check_int();
+}
 
-    // after every write, check if there is an interrupt to generate or clear
+void
+Itc::inttype_wr(uint32_t value)
+{
+    inttype_set(value);
+
+    // the configuration of the interrupts changed, update the lines
     this->check_int();
 }
 
 void
 Itc::check_int()
 {
+    uint32_t enabled;
     uint32_t pending_fiq;
     uint32_t pending_irq;
 
     // get the enabled FIQ and IRQ
-    pending_fiq = intsrc_get() & intenable_get() &   inttype_get();
-    pending_irq = intsrc_get() & intenable_get() & (~inttype_get());
+    enabled = intsrc_get() & intenable_get();
+    pending_fiq = enabled &   inttype_get();
+    pending_irq = enabled & (~inttype_get());
 
     // mask the normal interrupt below the nimask
     if (nimask_get() < NUM_INT)
@@ -100,43 +90,12 @@ Itc::check_int()
     fipend_set(pending_fiq);
     nipend_set(pending_irq);
 
-    // set the vector registers
-    if (pending_irq != 0)
-    {
-        for (uint8_t i=10; i != 0; i--)
-        {
-            if (pending_irq & (1<<i))
-            {
-                nivector_set(i);
-                break;
-            }
-        }
-    }
-    else
-    {
-        // set the vector to an invalid value
-        nivector_set(0xF);
-    }
-
-    if (pending_fiq != 0)
-    {
-        for (uint8_t i=10; i != 0; i--)
-        {
-            if (pending_fiq & (1<<i))
-            {
-                fivector_set(i);
-                break;
-            }
-        }
-    }
-    else
-    {
-        // set the vector to an invalid value
-        fivector_set(0xF);
-    }
+    // set the vector registers to the highest pending source (or an invalid value)
+    nivector_set((pending_irq != 0) ? BIT_MSB(pending_irq) : 0xF);
+    fivector_set((pending_fiq != 0) ? BIT_MSB(pending_fiq) : 0xF);
 
     // check if there are pending interrupts
-    if (fipend_get() != 0)
+    if (pending_fiq != 0)
     {
         this->fiq.set();
         this->irq.clear();
@@ -145,7 +104,7 @@ Itc::check_int()
     {
         this->fiq.clear();
 
-        if (nipend_get() != 0)
+        if (pending_irq != 0)
         {
             this->irq.set();
         }
@@ -167,8 +126,11 @@ Itc::interrupt_set(void* opaque)
     // set the register value
     intsrc_set(intsrc_get() | (1 << id));
 
-    // check if interrupt configuration has changed
-    check_int();
+    // a disabled source does not change the interrupt lines
+    if (intenable_get() & (1 << id))
+    {
+        check_int();
+    }
 }
 
 void
@@ -182,6 +144,9 @@ Itc::interrupt_clr(void* opaque)
     // clear the register value
     intsrc_set(intsrc_get() & (~(1 << id)));
 
-    // check if interrupt configuration has changed
-    check_int();
+    // a disabled source does not change the interrupt lines
+    if (intenable_get() & (1 << id))
+    {
+        check_int();
+    }
 }
@@ -1,18 +1,15 @@
 #ifndef ITC_H_
 #define ITC_H_
 
-// this is a peripheral
-#include "Generic/Peripheral/Peripheral.h"
-
 // with slave and master interrupts
 #include "Generic/IntMaster/IntMaster.h"
 #include "Generic/IntSlave/IntSlave.h"
 
-// include the registers definition
+// this is a peripheral with the registers definition
 #include "reg_itc.h"
 
 /// Interrupt Controller block model
-struct Itc : Peripheral<REG_ITC_COUNT>
+struct Itc : RegItc<Itc>
 {
     enum
     {
@@ -20,13 +17,10 @@ struct Itc : Peripheral<REG_ITC_COUNT>
     };
     /// Constructor
     Itc(sc_core::sc_module_name name)
-    : Peripheral<REG_ITC_COUNT>(name)
+    : RegItc<Itc>(name)
     , irq("irq")
     , fiq("fiq")
     {
-        // initialized the register access
-        reg_itc = &(m_reg[0]);
-
         for (int i = 0; i < NUM_INT; i++)
         {
             this->interrupts[i].init(this, &Itc::interrupt_set, &Itc::interrupt_clr, (void*)i);
@@ -43,19 +37,50 @@ struct Itc : Peripheral<REG_ITC_COUNT>
     IntMaster fiq;
 
 private:
-    /** Register read function
-     * @param[in] offset Offset of the register to read
-     * @return The value read
+    // the register map dispatches the accesses to the register hooks
+    friend struct RegItc<Itc>;
+
+    /** INTENNUM register read hook: write only register
+     * @return 0
      */
     uint32_t
-    reg_rd(uint32_t offset);
+    intennum_rd();
+
+    /** INTDISNUM register read hook: write only register
+     * @return 0
+     */
+    uint32_t
+    intdisnum_rd();
+
+    /** INTENNUM register write hook: enable a single interrupt
+     * @param[in] value Number of the interrupt to enable
+     */
+    void
+    intennum_wr(uint32_t value);
+
+    /** INTDISNUM register write hook: disable a single interrupt
+     * @param[in] value Number of the interrupt to disable
+     */
+    void
+    intdisnum_wr(uint32_t value);
+
+    /** NIMASK register write hook: update the interrupt lines
+     * @param[in] value Value written in the register
+     */
+    void
+    nimask_wr(uint32_t value);
+
+    /** INTENABLE register write hook: update the interrupt lines
+     * @param[in] value Value written in the register
+     */
+    void
+    intenable_wr(uint32_t value);
 
-    /** Register write function
-     * @param[in] offset Offset of the register to read
-     * @param[in] offset Value to write in the register
+    /** INTTYPE register write hook: update the interrupt lines
+     * @param[in] value Value written in the register
      */
     void
-    reg_wr(uint32_t offset, uint32_t value);
+    inttype_wr(uint32_t value);
 
     /// Check that interrupt status
     void
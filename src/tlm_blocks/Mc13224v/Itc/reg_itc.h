@@ -4,7 +4,7 @@
 #include <stdint.h>
 #include "compiler.h"
 #include "arch.h"
-#include "reg_sim.h"
+#include "Generic/Peripheral/Peripheral.h"
 
 #define REG_ITC_BASE_ADDR 0x80020000
 
@@ -23,16 +23,6 @@
  */
 #define INTCNTL_INDEX  0x00000000
 
-__INLINE uint32_t intcntl_get(void)
-{
-    return sim_reg_itc_rd(INTCNTL_INDEX);
-}
-
-__INLINE void intcntl_set(uint32_t value)
-{
-    sim_reg_itc_wr(INTCNTL_INDEX, value);
-}
-
 // field definitions
 #define NIAD_BIT    0x00100000
 #define NIAD_POS    20
@@ -42,45 +32,6 @@ __INLINE void intcntl_set(uint32_t value)
 #define NIAD_RST    0x0
 #define FIAD_RST    0x0
 
-__INLINE void intcntl_pack(uint8_t niad, uint8_t fiad)
-{
-    ASSERT_ERR(((niad << 20) & ~0x00100000) == 0);
-    ASSERT_ERR(((fiad << 19) & ~0x00080000) == 0);
-    sim_reg_itc_wr(INTCNTL_INDEX,  (niad << 20) | (fiad << 19));
-}
-
-__INLINE void intcntl_unpack(uint8_t* niad, uint8_t* fiad)
-{
-    uint32_t localVal = sim_reg_itc_rd(INTCNTL_INDEX);
-
-    *niad = (localVal & 0x00100000) >> 20;
-    *fiad = (localVal & 0x00080000) >> 19;
-}
-
-__INLINE uint8_t niad_getf(void)
-{
-    uint32_t localVal = sim_reg_itc_rd(INTCNTL_INDEX);
-    return ((localVal & 0x00100000) >> 20);
-}
-
-__INLINE void niad_setf(uint8_t niad)
-{
-    ASSERT_ERR(((niad << 20) & ~0x00100000) == 0);
-    sim_reg_itc_wr(INTCNTL_INDEX, (sim_reg_itc_rd(INTCNTL_INDEX) & ~0x00100000) | (niad << 20));
-}
-
-__INLINE uint8_t fiad_getf(void)
-{
-    uint32_t localVal = sim_reg_itc_rd(INTCNTL_INDEX);
-    return ((localVal & 0x00080000) >> 19);
-}
-
-__INLINE void fiad_setf(uint8_t fiad)
-{
-    ASSERT_ERR(((fiad << 19) & ~0x00080000) == 0);
-    sim_reg_itc_wr(INTCNTL_INDEX, (sim_reg_itc_rd(INTCNTL_INDEX) & ~0x00080000) | (fiad << 19));
-}
-
 /**
  * @brief NIMASK register definition
  * <pre>
@@ -91,16 +42,6 @@ __INLINE void fiad_setf(uint8_t fiad)
  */
 #define NIMASK_INDEX  0x00000001
 
-__INLINE uint32_t nimask_get(void)
-{
-    return sim_reg_itc_rd(NIMASK_INDEX);
-}
-
-__INLINE void nimask_set(uint32_t value)
-{
-    sim_reg_itc_wr(NIMASK_INDEX, value);
-}
-
 // field definitions
 #define NIMASK_MASK   0x0000001F
 #define NIMASK_LSB    0
@@ -108,19 +49,6 @@ __INLINE void nimask_set(uint32_t value)
 
 #define NIMASK_RST    0x0
 
-__INLINE uint8_t nimask_getf(void)
-{
-    uint32_t localVal = sim_reg_itc_rd(NIMASK_INDEX);
-    ASSERT_ERR((localVal & ~0x0000001F) == 0);
-    return (localVal >> 0);
-}
-
-__INLINE void nimask_setf(uint8_t nimask)
-{
-    ASSERT_ERR(((nimask << 0) & ~0x0000001F) == 0);
-    sim_reg_itc_wr(NIMASK_INDEX, nimask << 0);
-}
-
 /**
  * @brief INTENNUM register definition
  * <pre>
@@ -131,11 +59,6 @@ __INLINE void nimask_setf(uint8_t nimask)
  */
 #define INTENNUM_INDEX  0x00000002
 
-__INLINE void intennum_set(uint32_t value)
-{
-    sim_reg_itc_wr(INTENNUM_INDEX, value);
-}
-
 // field definitions
 #define ENNUM_MASK   0x0000000F
 #define ENNUM_LSB    0
@@ -143,12 +66,6 @@ __INLINE void intennum_set(uint32_t value)
 
 #define ENNUM_RST    0x0
 
-__INLINE void ennum_setf(uint8_t ennum)
-{
-    ASSERT_ERR(((ennum << 0) & ~0x0000000F) == 0);
-    sim_reg_itc_wr(INTENNUM_INDEX, ennum << 0);
-}
-
 /**
  * @brief INTDISNUM register definition
  * <pre>
@@ -159,11 +76,6 @@ __INLINE void ennum_setf(uint8_t ennum)
  */
 #define INTDISNUM_INDEX  0x00000003
 
-__INLINE void intdisnum_set(uint32_t value)
-{
-    sim_reg_itc_wr(INTDISNUM_INDEX, value);
-}
-
 // field definitions
 #define DISNUM_MASK   0x0000000F
 #define DISNUM_LSB    0
@@ -171,12 +83,6 @@ __INLINE void intdisnum_set(uint32_t value)
 
 #define DISNUM_RST    0x0
 
-__INLINE void disnum_setf(uint8_t disnum)
-{
-    ASSERT_ERR(((disnum << 0) & ~0x0000000F) == 0);
-    sim_reg_itc_wr(INTDISNUM_INDEX, disnum << 0);
-}
-
 /**
  * @brief INTENABLE register definition
  * <pre>
@@ -187,16 +93,6 @@ __INLINE void disnum_setf(uint8_t disnum)
  */
 #define INTENABLE_INDEX  0x00000004
 
-__INLINE uint32_t intenable_get(void)
-{
-    return sim_reg_itc_rd(INTENABLE_INDEX);
-}
-
-__INLINE void intenable_set(uint32_t value)
-{
-    sim_reg_itc_wr(INTENABLE_INDEX, value);
-}
-
 // field definitions
 #define INTENABLE_MASK   0x0000FFFF
 #define INTENABLE_LSB    0
@@ -204,19 +100,6 @@ __INLINE void intenable_set(uint32_t value)
 
 #define INTENABLE_RST    0x0
 
-__INLINE uint16_t intenable_getf(void)
-{
-    uint32_t localVal = sim_reg_itc_rd(INTENABLE_INDEX);
-    ASSERT_ERR((localVal & ~0x0000FFFF) == 0);
-    return (localVal >> 0);
-}
-
-__INLINE void intenable_setf(uint16_t intenable)
-{
-    ASSERT_ERR(((intenable << 0) & ~0x0000FFFF) == 0);
-    sim_reg_itc_wr(INTENABLE_INDEX, intenable << 0);
-}
-
 /**
  * @brief INTTYPE register definition
  * <pre>
@@ -227,16 +110,6 @@ __INLINE void intenable_setf(uint16_t intenable)
  */
 #define INTTYPE_INDEX  0x00000005
 
-__INLINE uint32_t inttype_get(void)
-{
-    return sim_reg_itc_rd(INTTYPE_INDEX);
-}
-
-__INLINE void inttype_set(uint32_t value)
-{
-    sim_reg_itc_wr(INTTYPE_INDEX, value);
-}
-
 // field definitions
 #define INTTYPE_MASK   0x0000FFFF
 #define INTTYPE_LSB    0
@@ -244,19 +117,6 @@ __INLINE void inttype_set(uint32_t value)
 
 #define INTTYPE_RST    0x0
 
-__INLINE uint16_t inttype_getf(void)
-{
-    uint32_t localVal = sim_reg_itc_rd(INTTYPE_INDEX);
-    ASSERT_ERR((localVal & ~0x0000FFFF) == 0);
-    return (localVal >> 0);
-}
-
-__INLINE void inttype_setf(uint16_t inttype)
-{
-    ASSERT_ERR(((inttype << 0) & ~0x0000FFFF) == 0);
-    sim_reg_itc_wr(INTTYPE_INDEX, inttype << 0);
-}
-
 /**
  * @brief NIVECTOR register definition
  * <pre>
@@ -267,16 +127,6 @@ __INLINE void inttype_setf(uint16_t inttype)
  */
 #define NIVECTOR_INDEX  0x0000000A
 
-__INLINE uint32_t nivector_get(void)
-{
-    return sim_reg_itc_rd(NIVECTOR_INDEX);
-}
-
-__INLINE void nivector_set(uint32_t value)
-{
-    sim_reg_itc_wr(NIVECTOR_INDEX, value);
-}
-
 // field definitions
 #define NIVECTOR_MASK   0x0000000F
 #define NIVECTOR_LSB    0
@@ -284,13 +134,6 @@ __INLINE void nivector_set(uint32_t value)
 
 #define NIVECTOR_RST    0x0
 
-__INLINE uint8_t nivector_getf(void)
-{
-    uint32_t localVal = sim_reg_itc_rd(NIVECTOR_INDEX);
-    ASSERT_ERR((localVal & ~0x0000000F) == 0);
-    return (localVal >> 0);
-}
-
 /**
  * @brief FIVECTOR register definition
  * <pre>
@@ -301,16 +144,6 @@ __INLINE uint8_t nivector_getf(void)
  */
 #define FIVECTOR_INDEX  0x0000000B
 
-__INLINE uint32_t fivector_get(void)
-{
-    return sim_reg_itc_rd(FIVECTOR_INDEX);
-}
-
-__INLINE void fivector_set(uint32_t value)
-{
-    sim_reg_itc_wr(FIVECTOR_INDEX, value);
-}
-
 // field definitions
 #define FIVECTOR_MASK   0x0000000F
 #define FIVECTOR_LSB    0
@@ -318,13 +151,6 @@ __INLINE void fivector_set(uint32_t value)
 
 #define FIVECTOR_RST    0x0
 
-__INLINE uint8_t fivector_getf(void)
-{
-    uint32_t localVal = sim_reg_itc_rd(FIVECTOR_INDEX);
-    ASSERT_ERR((localVal & ~0x0000000F) == 0);
-    return (localVal >> 0);
-}
-
 /**
  * @brief INTSRC register definition
  * <pre>
@@ -335,16 +161,6 @@ __INLINE uint8_t fivector_getf(void)
  */
 #define INTSRC_INDEX  0x0000000C
 
-__INLINE uint32_t intsrc_get(void)
-{
-    return sim_reg_itc_rd(INTSRC_INDEX);
-}
-
-__INLINE void intsrc_set(uint32_t value)
-{
-    sim_reg_itc_wr(INTSRC_INDEX, value);
-}
-
 // field definitions
 #define INTSRC_MASK   0x0000FFFF
 #define INTSRC_LSB    0
@@ -352,13 +168,6 @@ __INLINE void intsrc_set(uint32_t value)
 
 #define INTSRC_RST    0x0
 
-__INLINE uint16_t intsrc_getf(void)
-{
-    uint32_t localVal = sim_reg_itc_rd(INTSRC_INDEX);
-    ASSERT_ERR((localVal & ~0x0000FFFF) == 0);
-    return (localVal >> 0);
-}
-
 /**
  * @brief INTFRC register definition
  * <pre>
@@ -369,16 +178,6 @@ __INLINE uint16_t intsrc_getf(void)
  */
 #define INTFRC_INDEX  0x0000000D
 
-__INLINE uint32_t intfrc_get(void)
-{
-    return sim_reg_itc_rd(INTFRC_INDEX);
-}
-
-__INLINE void intfrc_set(uint32_t value)
-{
-    sim_reg_itc_wr(INTFRC_INDEX, value);
-}
-
 // field definitions
 #define INTFRC_MASK   0x0000FFFF
 #define INTFRC_LSB    0
@@ -386,19 +185,6 @@ __INLINE void intfrc_set(uint32_t value)
 
 #define INTFRC_RST    0x0
 
-__INLINE uint16_t intfrc_getf(void)
-{
-    uint32_t localVal = sim_reg_itc_rd(INTFRC_INDEX);
-    ASSERT_ERR((localVal & ~0x0000FFFF) == 0);
-    return (localVal >> 0);
-}
-
-__INLINE void intfrc_setf(uint16_t intfrc)
-{
-    ASSERT_ERR(((intfrc << 0) & ~0x0000FFFF) == 0);
-    sim_reg_itc_wr(INTFRC_INDEX, intfrc << 0);
-}
-
 /**
  * @brief NIPEND register definition
  * <pre>
@@ -409,16 +195,6 @@ __INLINE void intfrc_setf(uint16_t intfrc)
  */
 #define NIPEND_INDEX  0x0000000E
 
-__INLINE uint32_t nipend_get(void)
-{
-    return sim_reg_itc_rd(NIPEND_INDEX);
-}
-
-__INLINE void nipend_set(uint32_t value)
-{
-    sim_reg_itc_wr(NIPEND_INDEX, value);
-}
-
 // field definitions
 #define NIPEND_MASK   0x0000FFFF
 #define NIPEND_LSB    0
@@ -426,13 +202,6 @@ __INLINE void nipend_set(uint32_t value)
 
 #define NIPEND_RST    0x0
 
-__INLINE uint16_t nipend_getf(void)
-{
-    uint32_t localVal = sim_reg_itc_rd(NIPEND_INDEX);
-    ASSERT_ERR((localVal & ~0x0000FFFF) == 0);
-    return (localVal >> 0);
-}
-
 /**
  * @brief FIPEND register definition
  * <pre>
@@ -443,16 +212,6 @@ __INLINE uint16_t nipend_getf(void)
  */
 #define FIPEND_INDEX  0x0000000F
 
-__INLINE uint32_t fipend_get(void)
-{
-    return sim_reg_itc_rd(FIPEND_INDEX);
-}
-
-__INLINE void fipend_set(uint32_t value)
-{
-    sim_reg_itc_wr(FIPEND_INDEX, value);
-}
-
 // field definitions
 #define FIPEND_MASK   0x0000FFFF
 #define FIPEND_LSB    0
@@ -460,13 +219,606 @@ __INLINE void fipend_set(uint32_t value)
 
 #define FIPEND_RST    0x0
 
-__INLINE uint16_t fipend_getf(void)
-{
-    uint32_t localVal = sim_reg_itc_rd(FIPEND_INDEX);
-    ASSERT_ERR((localVal & ~0x0000FFFF) == 0);
-    return (localVal >> 0);
-}
-
+/**
+ * @brief Register map of the REG_ITC block, to be derived by the block model
+ *
+ * The register accesses are dispatched at compile time to the register hooks
+ * {regname}_rd() and {regname}_wr(value) of the model, which only redefines the
+ * hooks of the registers having side effects.
+ * @param MODEL Block model deriving from this class
+ */
+template <typename MODEL>
+struct RegItc : Peripheral<REG_ITC_COUNT>
+{
+    /** Constructor
+     * @param[in] name Name of the module
+     */
+    RegItc(sc_core::sc_module_name name)
+    : Peripheral<REG_ITC_COUNT>(name)
+    {
+        this->set_reg_names(&reg_name);
+    }
+
+    /** Name of a register
+     * @param[in] index Index of the register
+     * @return The name of the register, NULL if there is no register at this index
+     */
+    static const char*
+    reg_name(uint32_t index)
+    {
+        static const char* const names[REG_ITC_COUNT] =
+        {
+            "INTCNTL",
+            "NIMASK",
+            "INTENNUM",
+            "INTDISNUM",
+            "INTENABLE",
+            "INTTYPE",
+            NULL,
+            NULL,
+            NULL,
+            NULL,
+            "NIVECTOR",
+            "FIVECTOR",
+            "INTSRC",
+            "INTFRC",
+            "NIPEND",
+            "FIPEND",
+        };
+
+        return (index < REG_ITC_COUNT) ? names[index] : NULL;
+    }
+
+    uint32_t intcntl_get(void)
+    {
+        return this->m_reg[INTCNTL_INDEX];
+    }
+
+    void intcntl_set(uint32_t value)
+    {
+        this->m_reg[INTCNTL_INDEX] = value;
+    }
+
+    typedef RegField<INTCNTL_INDEX, 0x00100000, 20> niad_field;
+    typedef RegField<INTCNTL_INDEX, 0x00080000, 19> fiad_field;
+
+    void intcntl_pack(uint8_t niad, uint8_t fiad)
+    {
+        ASSERT_ERR(((niad << 20) & ~0x00100000) == 0);
+        ASSERT_ERR(((fiad << 19) & ~0x00080000) == 0);
+        this->m_reg[INTCNTL_INDEX] =  (niad << 20) | (fiad << 19);
+    }
+
+    void intcntl_unpack(uint8_t* niad, uint8_t* fiad)
+    {
+        uint32_t localVal = this->m_reg[INTCNTL_INDEX];
+
+        *niad = (localVal & 0x00100000) >> 20;
+        *fiad = (localVal & 0x00080000) >> 19;
+    }
+
+    uint8_t niad_getf(void)
+    {
+        uint32_t localVal = this->m_reg[INTCNTL_INDEX];
+        return ((localVal & 0x00100000) >> 20);
+    }
+
+    void niad_setf(uint8_t niad)
+    {
+        ASSERT_ERR(((niad << 20) & ~0x00100000) == 0);
+        this->m_reg[INTCNTL_INDEX] = (this->m_reg[INTCNTL_INDEX] & ~0x00100000) | (niad << 20);
+    }
+
+    uint8_t fiad_getf(void)
+    {
+        uint32_t localVal = this->m_reg[INTCNTL_INDEX];
+        return ((localVal & 0x00080000) >> 19);
+    }
+
+    void fiad_setf(uint8_t fiad)
+    {
+        ASSERT_ERR(((fiad << 19) & ~0x00080000) == 0);
+        this->m_reg[INTCNTL_INDEX] = (this->m_reg[INTCNTL_INDEX] & ~0x00080000) | (fiad << 19);
+    }
+
+    uint32_t nimask_get(void)
+    {
+        return this->m_reg[NIMASK_INDEX];
+    }
+
+    void nimask_set(uint32_t value)
+    {
+        this->m_reg[NIMASK_INDEX] = value;
+    }
+
+    typedef RegField<NIMASK_INDEX, 0x0000001F, 0> nimask_field;
+
+    uint8_t nimask_getf(void)
+    {
+        uint32_t localVal = this->m_reg[NIMASK_INDEX];
+        ASSERT_ERR((localVal & ~0x0000001F) == 0);
+        return (localVal >> 0);
+    }
+
+    void nimask_setf(uint8_t nimask)
+    {
+        ASSERT_ERR(((nimask << 0) & ~0x0000001F) == 0);
+        this->m_reg[NIMASK_INDEX] = nimask << 0;
+    }
+
+    void intennum_set(uint32_t value)
+    {
+        this->m_reg[INTENNUM_INDEX] = value;
+    }
+
+    typedef RegField<INTENNUM_INDEX, 0x0000000F, 0> ennum_field;
+
+    void ennum_setf(uint8_t ennum)
+    {
+        ASSERT_ERR(((ennum << 0) & ~0x0000000F) == 0);
+        this->m_reg[INTENNUM_INDEX] = ennum << 0;
+    }
+
+    void intdisnum_set(uint32_t value)
+    {
+        this->m_reg[INTDISNUM_INDEX] = value;
+    }
+
+    typedef RegField<INTDISNUM_INDEX, 0x0000000F, 0> disnum_field;
+
+    void disnum_setf(uint8_t disnum)
+    {
+        ASSERT_ERR(((disnum << 0) & ~0x0000000F) == 0);
+        this->m_reg[INTDISNUM_INDEX] = disnum << 0;
+    }
+
+    uint32_t intenable_get(void)
+    {
+        return this->m_reg[INTENABLE_INDEX];
+    }
+
+    void intenable_set(uint32_t value)
+    {
+        this->m_reg[INTENABLE_INDEX] = value;
+    }
+
+    typedef RegField<INTENABLE_INDEX, 0x0000FFFF, 0> intenable_field;
+
+    uint16_t intenable_getf(void)
+    {
+        uint32_t localVal = this->m_reg[INTENABLE_INDEX];
+        ASSERT_ERR((localVal & ~0x0000FFFF) == 0);
+        return (localVal >> 0);
+    }
+
+    void intenable_setf(uint16_t intenable)
+    {
+        ASSERT_ERR(((intenable << 0) & ~0x0000FFFF) == 0);
+        this->m_reg[INTENABLE_INDEX] = intenable << 0;
+    }
+
+    uint32_t inttype_get(void)
+    {
+        return this->m_reg[INTTYPE_INDEX];
+    }
+
+    void inttype_set(uint32_t value)
+    {
+        this->m_reg[INTTYPE_INDEX] = value;
+    }
+
+    typedef RegField<INTTYPE_INDEX, 0x0000FFFF, 0> inttype_field;
+
+    uint16_t inttype_getf(void)
+    {
+        uint32_t localVal = this->m_reg[INTTYPE_INDEX];
+        ASSERT_ERR((localVal & ~0x0000FFFF) == 0);
+        return (localVal >> 0);
+    }
+
+    void inttype_setf(uint16_t inttype)
+    {
+        ASSERT_ERR(((inttype << 0) & ~0x0000FFFF) == 0);
+        this->m_reg[INTTYPE_INDEX] = inttype << 0;
+    }
+
+    uint32_t nivector_get(void)
+    {
+        return this->m_reg[NIVECTOR_INDEX];
+    }
+
+    void nivector_set(uint32_t value)
+    {
+        this->m_reg[NIVECTOR_INDEX] = value;
+    }
+
+    typedef RegField<NIVECTOR_INDEX, 0x0000000F, 0> nivector_field;
+
+    uint8_t nivector_getf(void)
+    {
+        uint32_t localVal = this->m_reg[NIVECTOR_INDEX];
+        ASSERT_ERR((localVal & ~0x0000000F) == 0);
+        return (localVal >> 0);
+    }
+
+    uint32_t fivector_get(void)
+    {
+        return this->m_reg[FIVECTOR_INDEX];
+    }
+
+    void fivector_set(uint32_t value)
+    {
+        this->m_reg[FIVECTOR_INDEX] = value;
+    }
+
+    typedef RegField<FIVECTOR_INDEX, 0x0000000F, 0> fivector_field;
+
+    uint8_t fivector_getf(void)
+    {
+        uint32_t localVal = this->m_reg[FIVECTOR_INDEX];
+        ASSERT_ERR((localVal & ~0x0000000F) == 0);
+        return (localVal >> 0);
+    }
+
+    uint32_t intsrc_get(void)
+    {
+        return this->m_reg[INTSRC_INDEX];
+    }
+
+    void intsrc_set(uint32_t value)
+    {
+        this->m_reg[INTSRC_INDEX] = value;
+    }
+
+    typedef RegField<INTSRC_INDEX, 0x0000FFFF, 0> intsrc_field;
+
+    uint16_t intsrc_getf(void)
+    {
+        uint32_t localVal = this->m_reg[INTSRC_INDEX];
+        ASSERT_ERR((localVal & ~0x0000FFFF) == 0);
+        return (localVal >> 0);
+    }
+
+    uint32_t intfrc_get(void)
+    {
+        return this->m_reg[INTFRC_INDEX];
+    }
+
+    void intfrc_set(uint32_t value)
+    {
+        this->m_reg[INTFRC_INDEX] = value;
+    }
+
+    typedef RegField<INTFRC_INDEX, 0x0000FFFF, 0> intfrc_field;
+
+    uint16_t intfrc_getf(void)
+    {
+        uint32_t localVal = this->m_reg[INTFRC_INDEX];
+        ASSERT_ERR((localVal & ~0x0000FFFF) == 0);
+        return (localVal >> 0);
+    }
+
+    void intfrc_setf(uint16_t intfrc)
+    {
+        ASSERT_ERR(((intfrc << 0) & ~0x0000FFFF) == 0);
+        this->m_reg[INTFRC_INDEX] = intfrc << 0;
+    }
+
+    uint32_t nipend_get(void)
+    {
+        return this->m_reg[NIPEND_INDEX];
+    }
+
+    void nipend_set(uint32_t value)
+    {
+        this->m_reg[NIPEND_INDEX] = value;
+    }
+
+    typedef RegField<NIPEND_INDEX, 0x0000FFFF, 0> nipend_field;
+
+    uint16_t nipend_getf(void)
+    {
+        uint32_t localVal = this->m_reg[NIPEND_INDEX];
+        ASSERT_ERR((localVal & ~0x0000FFFF) == 0);
+        return (localVal >> 0);
+    }
+
+    uint32_t fipend_get(void)
+    {
+        return this->m_reg[FIPEND_INDEX];
+    }
+
+    void fipend_set(uint32_t value)
+    {
+        this->m_reg[FIPEND_INDEX] = value;
+    }
+
+    typedef RegField<FIPEND_INDEX, 0x0000FFFF, 0> fipend_field;
+
+    uint16_t fipend_getf(void)
+    {
+        uint32_t localVal = this->m_reg[FIPEND_INDEX];
+        ASSERT_ERR((localVal & ~0x0000FFFF) == 0);
+        return (localVal >> 0);
+    }
+
+
+protected:
+    /// INTCNTL register read hook
+    uint32_t
+    intcntl_rd()
+    {
+        return this->m_reg[INTCNTL_INDEX];
+    }
+
+    /// INTCNTL register write hook
+    void
+    intcntl_wr(uint32_t value)
+    {
+        this->m_reg[INTCNTL_INDEX] = value;
+    }
+
+    /// NIMASK register read hook
+    uint32_t
+    nimask_rd()
+    {
+        return this->m_reg[NIMASK_INDEX];
+    }
+
+    /// NIMASK register write hook
+    void
+    nimask_wr(uint32_t value)
+    {
+        this->m_reg[NIMASK_INDEX] = value;
+    }
+
+    /// INTENNUM register read hook
+    uint32_t
+    intennum_rd()
+    {
+        return this->m_reg[INTENNUM_INDEX];
+    }
+
+    /// INTENNUM register write hook
+    void
+    intennum_wr(uint32_t value)
+    {
+        this->m_reg[INTENNUM_INDEX] = value;
+    }
+
+    /// INTDISNUM register read hook
+    uint32_t
+    intdisnum_rd()
+    {
+        return this->m_reg[INTDISNUM_INDEX];
+    }
+
+    /// INTDISNUM register write hook
+    void
+    intdisnum_wr(uint32_t value)
+    {
+        this->m_reg[INTDISNUM_INDEX] = value;
+    }
+
+    /// INTENABLE register read hook
+    uint32_t
+    intenable_rd()
+    {
+        return this->m_reg[INTENABLE_INDEX];
+    }
+
+    /// INTENABLE register write hook
+    void
+    intenable_wr(uint32_t value)
+    {
+        this->m_reg[INTENABLE_INDEX] = value;
+    }
+
+    /// INTTYPE register read hook
+    uint32_t
+    inttype_rd()
+    {
+        return this->m_reg[INTTYPE_INDEX];
+    }
+
+    /// INTTYPE register write hook
+    void
+    inttype_wr(uint32_t value)
+    {
+        this->m_reg[INTTYPE_INDEX] = value;
+    }
+
+    /// NIVECTOR register read hook
+    uint32_t
+    nivector_rd()
+    {
+        return this->m_reg[NIVECTOR_INDEX];
+    }
+
+    /// NIVECTOR register write hook
+    void
+    nivector_wr(uint32_t value)
+    {
+        TLM_ERR("Write to R/O register NIVECTOR, data = 0x%08X", value);
+    }
+
+    /// FIVECTOR register read hook
+    uint32_t
+    fivector_rd()
+    {
+        return this->m_reg[FIVECTOR_INDEX];
+    }
+
+    /// FIVECTOR register write hook
+    void
+    fivector_wr(uint32_t value)
+    {
+        TLM_ERR("Write to R/O register FIVECTOR, data = 0x%08X", value);
+    }
+
+    /// INTSRC register read hook
+    uint32_t
+    intsrc_rd()
+    {
+        return this->m_reg[INTSRC_INDEX];
+    }
+
+    /// INTSRC register write hook
+    void
+    intsrc_wr(uint32_t value)
+    {
+        TLM_ERR("Write to R/O register INTSRC, data = 0x%08X", value);
+    }
+
+    /// INTFRC register read hook
+    uint32_t
+    intfrc_rd()
+    {
+        return this->m_reg[INTFRC_INDEX];
+    }
+
+    /// INTFRC register write hook
+    void
+    intfrc_wr(uint32_t value)
+    {
+        this->m_reg[INTFRC_INDEX] = value;
+    }
+
+    /// NIPEND register read hook
+    uint32_t
+    nipend_rd()
+    {
+        return this->m_reg[NIPEND_INDEX];
+    }
+
+    /// NIPEND register write hook
+    void
+    nipend_wr(uint32_t value)
+    {
+        TLM_ERR("Write to R/O register NIPEND, data = 0x%08X", value);
+    }
+
+    /// FIPEND register read hook
+    uint32_t
+    fipend_rd()
+    {
+        return this->m_reg[FIPEND_INDEX];
+    }
+
+    /// FIPEND register write hook
+    void
+    fipend_wr(uint32_t value)
+    {
+        TLM_ERR("Write to R/O register FIPEND, data = 0x%08X", value);
+    }
+
+    /** Register read function, dispatched to the register hooks of the model
+     * @param[in] offset Offset of the register to access
+     * @return The value read
+     */
+    virtual uint32_t
+    reg_rd(uint32_t offset)
+    {
+        MODEL* model = static_cast<MODEL*>(this);
+        uint32_t index = offset/4;
+
+        // sanity check
+        assert(index < REG_ITC_COUNT);
+
+        // internal delay
+        this->delay();
+
+        switch (index)
+        {
+        case INTCNTL_INDEX:
+            return model->intcntl_rd();
+        case NIMASK_INDEX:
+            return model->nimask_rd();
+        case INTENNUM_INDEX:
+            return model->intennum_rd();
+        case INTDISNUM_INDEX:
+            return model->intdisnum_rd();
+        case INTENABLE_INDEX:
+            return model->intenable_rd();
+        case INTTYPE_INDEX:
+            return model->inttype_rd();
+        case NIVECTOR_INDEX:
+            return model->nivector_rd();
+        case FIVECTOR_INDEX:
+            return model->fivector_rd();
+        case INTSRC_INDEX:
+            return model->intsrc_rd();
+        case INTFRC_INDEX:
+            return model->intfrc_rd();
+        case NIPEND_INDEX:
+            return model->nipend_rd();
+        case FIPEND_INDEX:
+            return model->fipend_rd();
+        default:
+            return this->m_reg[index];
+        }
+    }
+
+    /** Register write function, dispatched to the register hooks of the model
+     * @param[in] offset Offset of the register to access
+     * @param[in] value Value to write in the register
+     */
+    virtual void
+    reg_wr(uint32_t offset, uint32_t value)
+    {
+        MODEL* model = static_cast<MODEL*>(this);
+        uint32_t index = offset/4;
+
+        // sanity check
+        assert(index < REG_ITC_COUNT);
+
+        // internal delay
+        this->delay();
+
+        switch (index)
+        {
+        case INTCNTL_INDEX:
+            model->intcntl_wr(value);
+            break;
+        case NIMASK_INDEX:
+            model->nimask_wr(value);
+            break;
+        case INTENNUM_INDEX:
+            model->intennum_wr(value);
+            break;
+        case INTDISNUM_INDEX:
+            model->intdisnum_wr(value);
+            break;
+        case INTENABLE_INDEX:
+            model->intenable_wr(value);
+            break;
+        case INTTYPE_INDEX:
+            model->inttype_wr(value);
+            break;
+        case NIVECTOR_INDEX:
+            model->nivector_wr(value);
+            break;
+        case FIVECTOR_INDEX:
+            model->fivector_wr(value);
+            break;
+        case INTSRC_INDEX:
+            model->intsrc_wr(value);
+            break;
+        case INTFRC_INDEX:
+            model->intfrc_wr(value);
+            break;
+        case NIPEND_INDEX:
+            model->nipend_wr(value);
+            break;
+        case FIPEND_INDEX:
+            model->fipend_wr(value);
+            break;
+        default:
+            this->m_reg[index] = value;
+            break;
+        }
+    }
+};
 
 #endif // _REG_ITC_H_
 
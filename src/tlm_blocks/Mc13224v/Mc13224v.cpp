@@ -4,6 +4,10 @@
 
 #include <stdio.h>
 #include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <vector>
 
 #define ROM_BASE_ADDR (0x00000000)
 #define ROM_SIZE (0x14000)
@@ -102,15 +106,34 @@ Mc13224v::Mc13224v(sc_core::sc_module_name name, Parameters& parameters, MSP& co
         TLM_ERR("CRM address range wrong");
         return;
     }
-    //      -> interrupt hooked to ITC
-    this->crm->interrupt.bind(this->itc->interrupts[3]);
+    //      -> interrupt hooked to ITC, and sent to another platform if linked
+    this->irq = NULL;
+    if (config.count("irq") != 0)
+    {
+        if (*config["irq"]->get_lowercase() != "link")
+        {
+            TLM_ERR("unknown IRQ connection %s (link)", config["irq"]->c_str());
+            return;
+        }
+        this->irq = new IntLink("irq", Link::channel("irq", *config["irq"], "irq"));
+        this->crm->interrupt.bind(this->irq->input);
+        this->irq->output.bind(this->itc->interrupts[3]);
+    }
+    else
+    {
+        this->crm->interrupt.bind(this->itc->interrupts[3]);
+    }
 
     // SPIF:
     //   - create instance
-    //       * allocate the memory needed
-    flashdata = (uint32_t*)malloc(FLASH_SIZE);
+    //       * map the FLASH image
+    flashdata = (uint32_t*)this->map_flash(*flashfile);
     //       * create the flash controller
     this->spif = new Spif("spif", (uint8_t*)flashdata, FLASH_SIZE);
+    if (flashfile->get_config()->count("instant") != 0)
+    {
+        this->spif->set_instant((*flashfile->get_config())["instant"]->get_bool());
+    }
     //   - bind interfaces
     //      -> address decoder
     if (this->addrdec->bind(*this->spif, REG_SPIF_BASE_ADDR))
@@ -119,7 +142,7 @@ Mc13224v::Mc13224v(sc_core::sc_module_name name, Parameters& parameters, MSP& co
         return;
     }
     //      -> interrupt hooked to ITC
-    this->spif->interrupt.bind(*this->itc->interrupts[6]);
+    this->spif->interrupt.bind(this->itc->interrupts[6]);
 
     // SPI:
     //   - create instance
@@ -132,7 +155,17 @@ Mc13224v::Mc13224v(sc_core::sc_module_name name, Parameters& parameters, MSP& co
         return;
     }
     //      -> interrupt hooked to ITC
-    this->spi->interrupt.bind(*this->itc->interrupts[10]);
+    this->spi->interrupt.bind(this->itc->interrupts[10]);
+    //   - connect the bus to another platform, if any
+    if (config.count("spi") != 0)
+    {
+        if (*config["spi"]->get_lowercase() != "link")
+        {
+            TLM_ERR("unknown SPI connection %s (link)", config["spi"]->c_str());
+            return;
+        }
+        this->spi->set_link(Link::channel("spi", *config["spi"], "spi"));
+    }
 
     // GPIO:
     //   - create instance
@@ -156,7 +189,12 @@ Mc13224v::Mc13224v(sc_core::sc_module_name name, Parameters& parameters, MSP& co
         return;
     }
     //      -> interrupt hooked to ITC
-    this->uart1->interrupt.bind(*this->itc->interrupts[1]);
+    this->uart1->interrupt.bind(this->itc->interrupts[1]);
+    //      -> host serial line (if configured)
+    if (config.count("uart1") != 0)
+    {
+        this->uart1->configure(parameters, *config["uart1"]);
+    }
 
     // UART2:
     //   - create instance
@@ -169,7 +207,12 @@ Mc13224v::Mc13224v(sc_core::sc_module_name name, Parameters& parameters, MSP& co
         return;
     }
     //      -> interrupt hooked to ITC
-    this->uart2->interrupt.bind(*this->itc->interrupts[2]);
+    this->uart2->interrupt.bind(this->itc->interrupts[2]);
+    //      -> host serial line (if configured)
+    if (config.count("uart2") != 0)
+    {
+        this->uart2->configure(parameters, *config["uart2"]);
+    }
 
     {
         int fd;
@@ -182,16 +225,6 @@ Mc13224v::Mc13224v(sc_core::sc_module_name name, Parameters& parameters, MSP& co
         read(fd, this->rom->get_data(), ROM_SIZE);
         close(fd);
 
-        // open the FLASH file specified
-        fd = open(flashfile->c_str(), O_RDONLY);
-        if (fd == -1)
-        {
-            TLM_ERR("FLASH file (%s) could not be read\n", flashfile->c_str());
-        }
-
-        // load the FLASH content into the model
-        read(fd, flashdata, FLASH_SIZE);
-
         // if the SRAM was preloaded with the FLASH content
         if (srampreloadedwithflash->get_bool())
         {
@@ -200,8 +233,59 @@ Mc13224v::Mc13224v(sc_core::sc_module_name name, Parameters& parameters, MSP& co
             // initialize the CRM
             this->crm->set_status(3);
         }
-        close(fd);
     }
 }
 
+uint8_t*
+Mc13224v::map_flash(Parameter& flashfile)
+{
+    MSP& options = *flashfile.get_config();
+    bool persistent = (options.count("persistent") != 0) && options["persistent"]->get_bool();
+    struct stat st;
+    void* data;
+    int fd;
+
+    // open the FLASH file specified
+    fd = open(flashfile.c_str(), persistent ? O_RDWR : O_RDONLY);
+    if ((fd == -1) || (fstat(fd, &st) != 0))
+    {
+        TLM_ERR("FLASH file (%s) could not be read\n", flashfile.c_str());
+    }
+
+    // a persistent image is completed with erased bytes to be mapped entirely
+    if (persistent && (st.st_size < FLASH_SIZE))
+    {
+        std::vector<uint8_t> erased(FLASH_SIZE - st.st_size, 0xFF);
+
+        if (pwrite(fd, &erased[0], erased.size(), st.st_size) != (ssize_t)erased.size())
+        {
+            TLM_ERR("FLASH file (%s) could not be extended\n", flashfile.c_str());
+        }
+        st.st_size = FLASH_SIZE;
+    }
+
+    if (st.st_size >= FLASH_SIZE)
+    {
+        // the writes go to the file (persistent) or to a private copy of the pages written
+        data = mmap(NULL, FLASH_SIZE, PROT_READ | PROT_WRITE, persistent ? MAP_SHARED : MAP_PRIVATE, fd, 0);
+    }
+    else
+    {
+        // short image: copy, the rest of the FLASH is erased
+        data = mmap(NULL, FLASH_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (data != MAP_FAILED)
+        {
+            memset(data, 0xFF, FLASH_SIZE);
+            read(fd, data, st.st_size);
+        }
+    }
+    if (data == MAP_FAILED)
+    {
+        TLM_ERR("FLASH file (%s) could not be mapped\n", flashfile.c_str());
+    }
+    close(fd);
+
+    return (uint8_t*)data;
+}
+
 
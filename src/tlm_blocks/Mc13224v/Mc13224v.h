@@ -14,6 +14,7 @@
 #include "Generic/AddrDec/AddrDec.h"
 #include "Cpu/Cpu.h"
 #include "Generic/Memory/Memory.h"
+#include "Generic/IntLink/IntLink.h"
 // system specific blocks
 #include "Mc13224v/Itc/Itc.h"
 #include "Mc13224v/Crm/Crm.h"
@@ -50,6 +51,8 @@ struct Mc13224v : sc_core::sc_module
     Uart* uart1;
     /// UART2
     Uart* uart2;
+    /// CRM interrupt line sent to another platform (NULL if not linked)
+    IntLink* irq;
 
     // Not necessary if this module does not have a thread
     //SC_HAS_PROCESS(Mc13224v);
@@ -60,6 +63,21 @@ struct Mc13224v : sc_core::sc_module
      * @param[in] config Parameters of the current block (and sub-blocks)
      */
     Mc13224v(sc_core::sc_module_name name, Parameters& parameters, MSP& config);
+
+private:
+    /** Map the FLASH image in memory
+     * <pre>
+     * flashfile flash.bin
+     *     persistent true
+     *     instant true
+     * </pre>
+     * The FLASH writes go to the image when persistent (kept across the runs), and the
+     * SPIF transfers are completed without the SPI clock timing when instant.
+     * @param[in] flashfile FLASHFILE parameter of the configuration file
+     * @return The FLASH content
+     */
+    uint8_t*
+    map_flash(Parameter& flashfile);
 };
 
 #endif /*MC13224V_H_*/
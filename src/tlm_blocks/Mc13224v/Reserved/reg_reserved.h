@@ -4,7 +4,7 @@
 #include <stdint.h>
 #include "compiler.h"
 #include "arch.h"
-#include "reg_sim.h"
+#include "Generic/Peripheral/Peripheral.h"
 
 #define REG_RESERVED_BASE_ADDR 0x8000C000
 
@@ -17,136 +17,399 @@
  */
 #define RESERVED0_INDEX  0x00000000
 
-__INLINE uint32_t reserved0_get(void)
-{
-    return sim_reg_reserved_rd(RESERVED0_INDEX);
-}
-
-__INLINE void reserved0_set(uint32_t value)
-{
-    sim_reg_reserved_wr(RESERVED0_INDEX, value);
-}
-
 /**
  * @brief RESERVED1 register definition
  */
 #define RESERVED1_INDEX  0x00000001
 
-__INLINE uint32_t reserved1_get(void)
-{
-    return sim_reg_reserved_rd(RESERVED1_INDEX);
-}
-
-__INLINE void reserved1_set(uint32_t value)
-{
-    sim_reg_reserved_wr(RESERVED1_INDEX, value);
-}
-
 /**
  * @brief RESERVED2 register definition
  */
 #define RESERVED2_INDEX  0x00000002
 
-__INLINE uint32_t reserved2_get(void)
-{
-    return sim_reg_reserved_rd(RESERVED2_INDEX);
-}
-
-__INLINE void reserved2_set(uint32_t value)
-{
-    sim_reg_reserved_wr(RESERVED2_INDEX, value);
-}
-
 /**
  * @brief RESERVED3 register definition
  */
 #define RESERVED3_INDEX  0x00000003
 
-__INLINE uint32_t reserved3_get(void)
-{
-    return sim_reg_reserved_rd(RESERVED3_INDEX);
-}
-
-__INLINE void reserved3_set(uint32_t value)
-{
-    sim_reg_reserved_wr(RESERVED3_INDEX, value);
-}
-
 /**
  * @brief RESERVED4 register definition
  */
 #define RESERVED4_INDEX  0x00000004
 
-__INLINE uint32_t reserved4_get(void)
-{
-    return sim_reg_reserved_rd(RESERVED4_INDEX);
-}
-
-__INLINE void reserved4_set(uint32_t value)
-{
-    sim_reg_reserved_wr(RESERVED4_INDEX, value);
-}
-
 /**
  * @brief RESERVED5 register definition
  */
 #define RESERVED5_INDEX  0x00000005
 
-__INLINE uint32_t reserved5_get(void)
-{
-    return sim_reg_reserved_rd(RESERVED5_INDEX);
-}
-
-__INLINE void reserved5_set(uint32_t value)
-{
-    sim_reg_reserved_wr(RESERVED5_INDEX, value);
-}
-
 /**
  * @brief RESERVED6 register definition
  */
 #define RESERVED6_INDEX  0x00000006
 
-__INLINE uint32_t reserved6_get(void)
-{
-    return sim_reg_reserved_rd(RESERVED6_INDEX);
-}
-
-__INLINE void reserved6_set(uint32_t value)
-{
-    sim_reg_reserved_wr(RESERVED6_INDEX, value);
-}
-
 /**
  * @brief RESERVED7 register definition
  */
 #define RESERVED7_INDEX  0x00000007
 
-__INLINE uint32_t reserved7_get(void)
-{
-    return sim_reg_reserved_rd(RESERVED7_INDEX);
-}
-
-__INLINE void reserved7_set(uint32_t value)
-{
-    sim_reg_reserved_wr(RESERVED7_INDEX, value);
-}
-
 /**
  * @brief RESERVED8 register definition
  */
 #define RESERVED8_INDEX  0x00000008
 
-__INLINE uint32_t reserved8_get(void)
-{
-    return sim_reg_reserved_rd(RESERVED8_INDEX);
-}
-
-__INLINE void reserved8_set(uint32_t value)
+/**
+ * @brief Register map of the REG_RESERVED block, to be derived by the block model
+ *
+ * The register accesses are dispatched at compile time to the register hooks
+ * {regname}_rd() and {regname}_wr(value) of the model, which only redefines the
+ * hooks of the registers having side effects.
+ * @param MODEL Block model deriving from this class
+ */
+template <typename MODEL>
+struct RegReserved : Peripheral<REG_RESERVED_COUNT>
 {
-    sim_reg_reserved_wr(RESERVED8_INDEX, value);
-}
-
+    /** Constructor
+     * @param[in] name Name of the module
+     */
+    RegReserved(sc_core::sc_module_name name)
+    : Peripheral<REG_RESERVED_COUNT>(name)
+    {
+        this->set_reg_names(&reg_name);
+    }
+
+    /** Name of a register
+     * @param[in] index Index of the register
+     * @return The name of the register, NULL if there is no register at this index
+     */
+    static const char*
+    reg_name(uint32_t index)
+    {
+        static const char* const names[REG_RESERVED_COUNT] =
+        {
+            "RESERVED0",
+            "RESERVED1",
+            "RESERVED2",
+            "RESERVED3",
+            "RESERVED4",
+            "RESERVED5",
+            "RESERVED6",
+            "RESERVED7",
+            "RESERVED8",
+        };
+
+        return (index < REG_RESERVED_COUNT) ? names[index] : NULL;
+    }
+
+    uint32_t reserved0_get(void)
+    {
+        return this->m_reg[RESERVED0_INDEX];
+    }
+
+    void reserved0_set(uint32_t value)
+    {
+        this->m_reg[RESERVED0_INDEX] = value;
+    }
+
+    uint32_t reserved1_get(void)
+    {
+        return this->m_reg[RESERVED1_INDEX];
+    }
+
+    void reserved1_set(uint32_t value)
+    {
+        this->m_reg[RESERVED1_INDEX] = value;
+    }
+
+    uint32_t reserved2_get(void)
+    {
+        return this->m_reg[RESERVED2_INDEX];
+    }
+
+    void reserved2_set(uint32_t value)
+    {
+        this->m_reg[RESERVED2_INDEX] = value;
+    }
+
+    uint32_t reserved3_get(void)
+    {
+        return this->m_reg[RESERVED3_INDEX];
+    }
+
+    void reserved3_set(uint32_t value)
+    {
+        this->m_reg[RESERVED3_INDEX] = value;
+    }
+
+    uint32_t reserved4_get(void)
+    {
+        return this->m_reg[RESERVED4_INDEX];
+    }
+
+    void reserved4_set(uint32_t value)
+    {
+        this->m_reg[RESERVED4_INDEX] = value;
+    }
+
+    uint32_t reserved5_get(void)
+    {
+        return this->m_reg[RESERVED5_INDEX];
+    }
+
+    void reserved5_set(uint32_t value)
+    {
+        this->m_reg[RESERVED5_INDEX] = value;
+    }
+
+    uint32_t reserved6_get(void)
+    {
+        return this->m_reg[RESERVED6_INDEX];
+    }
+
+    void reserved6_set(uint32_t value)
+    {
+        this->m_reg[RESERVED6_INDEX] = value;
+    }
+
+    uint32_t reserved7_get(void)
+    {
+        return this->m_reg[RESERVED7_INDEX];
+    }
+
+    void reserved7_set(uint32_t value)
+    {
+        this->m_reg[RESERVED7_INDEX] = value;
+    }
+
+    uint32_t reserved8_get(void)
+    {
+        return this->m_reg[RESERVED8_INDEX];
+    }
+
+    void reserved8_set(uint32_t value)
+    {
+        this->m_reg[RESERVED8_INDEX] = value;
+    }
+
+
+protected:
+    /// RESERVED0 register read hook
+    uint32_t
+    reserved0_rd()
+    {
+        return this->m_reg[RESERVED0_INDEX];
+    }
+
+    /// RESERVED0 register write hook
+    void
+    reserved0_wr(uint32_t value)
+    {
+        this->m_reg[RESERVED0_INDEX] = value;
+    }
+
+    /// RESERVED1 register read hook
+    uint32_t
+    reserved1_rd()
+    {
+        return this->m_reg[RESERVED1_INDEX];
+    }
+
+    /// RESERVED1 register write hook
+    void
+    reserved1_wr(uint32_t value)
+    {
+        this->m_reg[RESERVED1_INDEX] = value;
+    }
+
+    /// RESERVED2 register read hook
+    uint32_t
+    reserved2_rd()
+    {
+        return this->m_reg[RESERVED2_INDEX];
+    }
+
+    /// RESERVED2 register write hook
+    void
+    reserved2_wr(uint32_t value)
+    {
+        this->m_reg[RESERVED2_INDEX] = value;
+    }
+
+    /// RESERVED3 register read hook
+    uint32_t
+    reserved3_rd()
+    {
+        return this->m_reg[RESERVED3_INDEX];
+    }
+
+    /// RESERVED3 register write hook
+    void
+    reserved3_wr(uint32_t value)
+    {
+        this->m_reg[RESERVED3_INDEX] = value;
+    }
+
+    /// RESERVED4 register read hook
+    uint32_t
+    reserved4_rd()
+    {
+        return this->m_reg[RESERVED4_INDEX];
+    }
+
+    /// RESERVED4 register write hook
+    void
+    reserved4_wr(uint32_t value)
+    {
+        this->m_reg[RESERVED4_INDEX] = value;
+    }
+
+    /// RESERVED5 register read hook
+    uint32_t
+    reserved5_rd()
+    {
+        return this->m_reg[RESERVED5_INDEX];
+    }
+
+    /// RESERVED5 register write hook
+    void
+    reserved5_wr(uint32_t value)
+    {
+        this->m_reg[RESERVED5_INDEX] = value;
+    }
+
+    /// RESERVED6 register read hook
+    uint32_t
+    reserved6_rd()
+    {
+        return this->m_reg[RESERVED6_INDEX];
+    }
+
+    /// RESERVED6 register write hook
+    void
+    reserved6_wr(uint32_t value)
+    {
+        this->m_reg[RESERVED6_INDEX] = value;
+    }
+
+    /// RESERVED7 register read hook
+    uint32_t
+    reserved7_rd()
+    {
+        return this->m_reg[RESERVED7_INDEX];
+    }
+
+    /// RESERVED7 register write hook
+    void
+    reserved7_wr(uint32_t value)
+    {
+        this->m_reg[RESERVED7_INDEX] = value;
+    }
+
+    /// RESERVED8 register read hook
+    uint32_t
+    reserved8_rd()
+    {
+        return this->m_reg[RESERVED8_INDEX];
+    }
+
+    /// RESERVED8 register write hook
+    void
+    reserved8_wr(uint32_t value)
+    {
+        this->m_reg[RESERVED8_INDEX] = value;
+    }
+
+    /** Register read function, dispatched to the register hooks of the model
+     * @param[in] offset Offset of the register to access
+     * @return The value read
+     */
+    virtual uint32_t
+    reg_rd(uint32_t offset)
+    {
+        MODEL* model = static_cast<MODEL*>(this);
+        uint32_t index = offset/4;
+
+        // sanity check
+        assert(index < REG_RESERVED_COUNT);
+
+        // internal delay
+        this->delay();
+
+        switch (index)
+        {
+        case RESERVED0_INDEX:
+            return model->reserved0_rd();
+        case RESERVED1_INDEX:
+            return model->reserved1_rd();
+        case RESERVED2_INDEX:
+            return model->reserved2_rd();
+        case RESERVED3_INDEX:
+            return model->reserved3_rd();
+        case RESERVED4_INDEX:
+            return model->reserved4_rd();
+        case RESERVED5_INDEX:
+            return model->reserved5_rd();
+        case RESERVED6_INDEX:
+            return model->reserved6_rd();
+        case RESERVED7_INDEX:
+            return model->reserved7_rd();
+        case RESERVED8_INDEX:
+            return model->reserved8_rd();
+        default:
+            return this->m_reg[index];
+        }
+    }
+
+    /** Register write function, dispatched to the register hooks of the model
+     * @param[in] offset Offset of the register to access
+     * @param[in] value Value to write in the register
+     */
+    virtual void
+    reg_wr(uint32_t offset, uint32_t value)
+    {
+        MODEL* model = static_cast<MODEL*>(this);
+        uint32_t index = offset/4;
+
+        // sanity check
+        assert(index < REG_RESERVED_COUNT);
+
+        // internal delay
+        this->delay();
+
+        switch (index)
+        {
+        case RESERVED0_INDEX:
+            model->reserved0_wr(value);
+            break;
+        case RESERVED1_INDEX:
+            model->reserved1_wr(value);
+            break;
+        case RESERVED2_INDEX:
+            model->reserved2_wr(value);
+            break;
+        case RESERVED3_INDEX:
+            model->reserved3_wr(value);
+            break;
+        case RESERVED4_INDEX:
+            model->reserved4_wr(value);
+            break;
+        case RESERVED5_INDEX:
+            model->reserved5_wr(value);
+            break;
+        case RESERVED6_INDEX:
+            model->reserved6_wr(value);
+            break;
+        case RESERVED7_INDEX:
+            model->reserved7_wr(value);
+            break;
+        case RESERVED8_INDEX:
+            model->reserved8_wr(value);
+            break;
+        default:
+            this->m_reg[index] = value;
+            break;
+        }
+    }
+};
 
 #endif // _REG_RESERVED_H_
 
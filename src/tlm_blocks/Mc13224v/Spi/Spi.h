@@ -1,29 +1,31 @@
 #ifndef SPI_H_
 #define SPI_H_
 
-// this is a peripheral
-#include "Generic/Peripheral/Peripheral.h"
-
 // that generates an interrupt
 #include "Generic/IntMaster/IntMaster.h"
 
-// include the registers definition
+// this is a peripheral with the registers definition
 #include "reg_spi.h"
 
+// the bus can go to another platform
+#include "Link/Link.h"
+
+/// Word received when the other platform sent nothing (MISO idle high)
+#define SPI_IDLE_WORD 0xFFFFFFFF
+
 /// Interrupt Controller block model
-struct Spi : Peripheral<REG_SPI_COUNT>
+struct Spi : RegSpi<Spi>
 {
     // Not necessary if this module does not have a thread
     SC_HAS_PROCESS(Spi);
 
     /// Constructor
     Spi(sc_core::sc_module_name name)
-    : Peripheral<REG_SPI_COUNT>(name)
+    : RegSpi<Spi>(name)
     , interrupt("interrupt")
+    , m_link(NULL)
+    , m_link_word(SPI_IDLE_WORD)
     {
-        // initialized the register access
-        reg_spi = &(m_reg[0]);
-
         // initialize the flash interface
         m_flash.active = false;
 
@@ -34,7 +36,21 @@ struct Spi : Peripheral<REG_SPI_COUNT>
     /// Interrupt
     IntMaster interrupt;
 
+    /** Connect the bus to another platform instead of the FLASH: the TX data of each
+     * transfer is sent to the peer and the RX data is the last word sent by the peer
+     * (a slave loads its answer before the master starts the transfer)
+     * @param[in, out] link End of the "spi" channel
+     */
+    void
+    set_link(LinkChannel* link)
+    {
+        m_link = link;
+    }
+
 private:
+    // the register map dispatches the accesses to the register hooks
+    friend struct RegSpi<Spi>;
+
     /// Structure containing the information for the flash
     struct
     {
@@ -44,25 +60,33 @@ private:
         sc_core::sc_event event;
     } m_flash;
 
+    /// Other platform on the bus (NULL if none)
+    LinkChannel* m_link;
+
+    /// Last word sent by the other platform
+    uint32_t m_link_word;
+
     /// Module thread (responds to read and writes to the FLASH through the SPI)
     void thread_flash(void);
 
+    /// Exchange the words of a transfer with the other platform
+    void
+    exchange();
+
     /// Check that interrupt status
     void check_int();
 
-    /** Register read function
-     * @param[in] offset Offset of the register to read
-     * @return The value read
+    /** SPI_CLK_CTRL register write hook: start the transfer if requested
+     * @param[in] value Value written in the register
      */
-    uint32_t
-    reg_rd(uint32_t offset);
+    void
+    spi_clk_ctrl_wr(uint32_t value);
 
-    /** Register write function
-     * @param[in] offset Offset of the register to read
-     * @param[in] offset Value to write in the register
+    /** SPI_STATUS register write hook: clear the pending status bits
+     * @param[in] value Value written in the register
      */
     void
-    reg_wr(uint32_t offset, uint32_t value);
+    spi_status_wr(uint32_t value);
 };
 
 #endif /*SPI_H_*/
@@ -4,7 +4,7 @@
 #include <stdint.h>
 #include "compiler.h"
 #include "arch.h"
-#include "reg_sim.h"
+#include "Generic/Peripheral/Peripheral.h"
 
 #define REG_SPI_BASE_ADDR 0x80002000
 
@@ -22,16 +22,6 @@
  */
 #define SPI_TX_DATA_INDEX  0x00000000
 
-__INLINE uint32_t spi_tx_data_get(void)
-{
-    return sim_reg_spi_rd(SPI_TX_DATA_INDEX);
-}
-
-__INLINE void spi_tx_data_set(uint32_t value)
-{
-    sim_reg_spi_wr(SPI_TX_DATA_INDEX, value);
-}
-
 // field definitions
 #define SPI_TX_DATA_MASK   0xFFFFFFFF
 #define SPI_TX_DATA_LSB    0
@@ -39,19 +29,6 @@ __INLINE void spi_tx_data_set(uint32_t value)
 
 #define SPI_TX_DATA_RST    0x0
 
-__INLINE uint32_t spi_tx_data_getf(void)
-{
-    uint32_t localVal = sim_reg_spi_rd(SPI_TX_DATA_INDEX);
-    ASSERT_ERR((localVal & ~0xFFFFFFFF) == 0);
-    return (localVal >> 0);
-}
-
-__INLINE void spi_tx_data_setf(uint32_t spitxdata)
-{
-    ASSERT_ERR(((spitxdata << 0) & ~0xFFFFFFFF) == 0);
-    sim_reg_spi_wr(SPI_TX_DATA_INDEX, spitxdata << 0);
-}
-
 /**
  * @brief SPI_RX_DATA register definition
  * <pre>
@@ -62,16 +39,6 @@ __INLINE void spi_tx_data_setf(uint32_t spitxdata)
  */
 #define SPI_RX_DATA_INDEX  0x00000001
 
-__INLINE uint32_t spi_rx_data_get(void)
-{
-    return sim_reg_spi_rd(SPI_RX_DATA_INDEX);
-}
-
-__INLINE void spi_rx_data_set(uint32_t value)
-{
-    sim_reg_spi_wr(SPI_RX_DATA_INDEX, value);
-}
-
 // field definitions
 #define SPI_RX_DATA_MASK   0xFFFFFFFF
 #define SPI_RX_DATA_LSB    0
@@ -79,13 +46,6 @@ __INLINE void spi_rx_data_set(uint32_t value)
 
 #define SPI_RX_DATA_RST    0x0
 
-__INLINE uint32_t spi_rx_data_getf(void)
-{
-    uint32_t localVal = sim_reg_spi_rd(SPI_RX_DATA_INDEX);
-    ASSERT_ERR((localVal & ~0xFFFFFFFF) == 0);
-    return (localVal >> 0);
-}
-
 /**
  * @brief SPI_CLK_CTRL register definition
  * <pre>
@@ -98,16 +58,6 @@ __INLINE uint32_t spi_rx_data_getf(void)
  */
 #define SPI_CLK_CTRL_INDEX  0x00000002
 
-__INLINE uint32_t spi_clk_ctrl_get(void)
-{
-    return sim_reg_spi_rd(SPI_CLK_CTRL_INDEX);
-}
-
-__INLINE void spi_clk_ctrl_set(uint32_t value)
-{
-    sim_reg_spi_wr(SPI_CLK_CTRL_INDEX, value);
-}
-
 // field definitions
 #define SPI_SCK_COUNT_MASK     0x0000FF00
 #define SPI_SCK_COUNT_LSB      8
@@ -122,59 +72,6 @@ __INLINE void spi_clk_ctrl_set(uint32_t value)
 #define SPI_START_RST          0x0
 #define SPI_DATA_LENGTH_RST    0x0
 
-__INLINE void spi_clk_ctrl_pack(uint8_t spisckcount, uint8_t spistart, uint8_t spidatalength)
-{
-    ASSERT_ERR(((spisckcount << 8) & ~0x0000FF00) == 0);
-    ASSERT_ERR(((spistart << 7) & ~0x00000080) == 0);
-    ASSERT_ERR(((spidatalength << 0) & ~0x0000007F) == 0);
-    sim_reg_spi_wr(SPI_CLK_CTRL_INDEX,  (spisckcount << 8) | (spistart << 7) | (spidatalength << 0));
-}
-
-__INLINE void spi_clk_ctrl_unpack(uint8_t* spisckcount, uint8_t* spistart, uint8_t* spidatalength)
-{
-    uint32_t localVal = sim_reg_spi_rd(SPI_CLK_CTRL_INDEX);
-
-    *spisckcount = (localVal & 0x0000FF00) >> 8;
-    *spistart = (localVal & 0x00000080) >> 7;
-    *spidatalength = (localVal & 0x0000007F) >> 0;
-}
-
-__INLINE uint8_t spi_sck_count_getf(void)
-{
-    uint32_t localVal = sim_reg_spi_rd(SPI_CLK_CTRL_INDEX);
-    return ((localVal & 0x0000FF00) >> 8);
-}
-
-__INLINE void spi_sck_count_setf(uint8_t spisckcount)
-{
-    ASSERT_ERR(((spisckcount << 8) & ~0x0000FF00) == 0);
-    sim_reg_spi_wr(SPI_CLK_CTRL_INDEX, (sim_reg_spi_rd(SPI_CLK_CTRL_INDEX) & ~0x0000FF00) | (spisckcount << 8));
-}
-
-__INLINE uint8_t spi_start_getf(void)
-{
-    uint32_t localVal = sim_reg_spi_rd(SPI_CLK_CTRL_INDEX);
-    return ((localVal & 0x00000080) >> 7);
-}
-
-__INLINE void spi_start_setf(uint8_t spistart)
-{
-    ASSERT_ERR(((spistart << 7) & ~0x00000080) == 0);
-    sim_reg_spi_wr(SPI_CLK_CTRL_INDEX, (sim_reg_spi_rd(SPI_CLK_CTRL_INDEX) & ~0x00000080) | (spistart << 7));
-}
-
-__INLINE uint8_t spi_data_length_getf(void)
-{
-    uint32_t localVal = sim_reg_spi_rd(SPI_CLK_CTRL_INDEX);
-    return ((localVal & 0x0000007F) >> 0);
-}
-
-__INLINE void spi_data_length_setf(uint8_t spidatalength)
-{
-    ASSERT_ERR(((spidatalength << 0) & ~0x0000007F) == 0);
-    sim_reg_spi_wr(SPI_CLK_CTRL_INDEX, (sim_reg_spi_rd(SPI_CLK_CTRL_INDEX) & ~0x0000007F) | (spidatalength << 0));
-}
-
 /**
  * @brief SPI_SETUP register definition
  * <pre>
@@ -193,16 +90,6 @@ __INLINE void spi_data_length_setf(uint8_t spidatalength)
  */
 #define SPI_SETUP_INDEX  0x00000003
 
-__INLINE uint32_t spi_setup_get(void)
-{
-    return sim_reg_spi_rd(SPI_SETUP_INDEX);
-}
-
-__INLINE void spi_setup_set(uint32_t value)
-{
-    sim_reg_spi_wr(SPI_SETUP_INDEX, value);
-}
-
 // field definitions
 #define SPI_3WIRE_BIT              0x00020000
 #define SPI_3WIRE_POS              17
@@ -237,143 +124,6 @@ __INLINE void spi_setup_set(uint32_t value)
 #define SPI_SS_DELAY_RST           0x0
 #define SPI_SS_SETUP_RST           0x0
 
-__INLINE void spi_setup_pack(uint8_t spi3wire, uint8_t spimode, uint8_t spisckfreq, uint8_t spimisophase, uint8_t spisckphase, uint8_t spisckpol, uint8_t spisdoinactivest, uint8_t spissdelay, uint8_t spisssetup)
-{
-    ASSERT_ERR(((spi3wire << 17) & ~0x00020000) == 0);
-    ASSERT_ERR(((spimode << 16) & ~0x00010000) == 0);
-    ASSERT_ERR(((spisckfreq << 12) & ~0x00007000) == 0);
-    ASSERT_ERR(((spimisophase << 10) & ~0x00000400) == 0);
-    ASSERT_ERR(((spisckphase << 9) & ~0x00000200) == 0);
-    ASSERT_ERR(((spisckpol << 8) & ~0x00000100) == 0);
-    ASSERT_ERR(((spisdoinactivest << 4) & ~0x00000030) == 0);
-    ASSERT_ERR(((spissdelay << 2) & ~0x0000000C) == 0);
-    ASSERT_ERR(((spisssetup << 0) & ~0x00000003) == 0);
-    sim_reg_spi_wr(SPI_SETUP_INDEX,  (spi3wire << 17) | (spimode << 16) | (spisckfreq << 12) | (spimisophase << 10) | (spisckphase << 9) | (spisckpol << 8) | (spisdoinactivest << 4) | (spissdelay << 2) | (spisssetup << 0));
-}
-
-__INLINE void spi_setup_unpack(uint8_t* spi3wire, uint8_t* spimode, uint8_t* spisckfreq, uint8_t* spimisophase, uint8_t* spisckphase, uint8_t* spisckpol, uint8_t* spisdoinactivest, uint8_t* spissdelay, uint8_t* spisssetup)
-{
-    uint32_t localVal = sim_reg_spi_rd(SPI_SETUP_INDEX);
-
-    *spi3wire = (localVal & 0x00020000) >> 17;
-    *spimode = (localVal & 0x00010000) >> 16;
-    *spisckfreq = (localVal & 0x00007000) >> 12;
-    *spimisophase = (localVal & 0x00000400) >> 10;
-    *spisckphase = (localVal & 0x00000200) >> 9;
-    *spisckpol = (localVal & 0x00000100) >> 8;
-    *spisdoinactivest = (localVal & 0x00000030) >> 4;
-    *spissdelay = (localVal & 0x0000000C) >> 2;
-    *spisssetup = (localVal & 0x00000003) >> 0;
-}
-
-__INLINE uint8_t spi_3wire_getf(void)
-{
-    uint32_t localVal = sim_reg_spi_rd(SPI_SETUP_INDEX);
-    return ((localVal & 0x00020000) >> 17);
-}
-
-__INLINE void spi_3wire_setf(uint8_t spi3wire)
-{
-    ASSERT_ERR(((spi3wire << 17) & ~0x00020000) == 0);
-    sim_reg_spi_wr(SPI_SETUP_INDEX, (sim_reg_spi_rd(SPI_SETUP_INDEX) & ~0x00020000) | (spi3wire << 17));
-}
-
-__INLINE uint8_t spi_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_spi_rd(SPI_SETUP_INDEX);
-    return ((localVal & 0x00010000) >> 16);
-}
-
-__INLINE void spi_mode_setf(uint8_t spimode)
-{
-    ASSERT_ERR(((spimode << 16) & ~0x00010000) == 0);
-    sim_reg_spi_wr(SPI_SETUP_INDEX, (sim_reg_spi_rd(SPI_SETUP_INDEX) & ~0x00010000) | (spimode << 16));
-}
-
-__INLINE uint8_t spi_sck_freq_getf(void)
-{
-    uint32_t localVal = sim_reg_spi_rd(SPI_SETUP_INDEX);
-    return ((localVal & 0x00007000) >> 12);
-}
-
-__INLINE void spi_sck_freq_setf(uint8_t spisckfreq)
-{
-    ASSERT_ERR(((spisckfreq << 12) & ~0x00007000) == 0);
-    sim_reg_spi_wr(SPI_SETUP_INDEX, (sim_reg_spi_rd(SPI_SETUP_INDEX) & ~0x00007000) | (spisckfreq << 12));
-}
-
-__INLINE uint8_t spi_miso_phase_getf(void)
-{
-    uint32_t localVal = sim_reg_spi_rd(SPI_SETUP_INDEX);
-    return ((localVal & 0x00000400) >> 10);
-}
-
-__INLINE void spi_miso_phase_setf(uint8_t spimisophase)
-{
-    ASSERT_ERR(((spimisophase << 10) & ~0x00000400) == 0);
-    sim_reg_spi_wr(SPI_SETUP_INDEX, (sim_reg_spi_rd(SPI_SETUP_INDEX) & ~0x00000400) | (spimisophase << 10));
-}
-
-__INLINE uint8_t spi_sck_phase_getf(void)
-{
-    uint32_t localVal = sim_reg_spi_rd(SPI_SETUP_INDEX);
-    return ((localVal & 0x00000200) >> 9);
-}
-
-__INLINE void spi_sck_phase_setf(uint8_t spisckphase)
-{
-    ASSERT_ERR(((spisckphase << 9) & ~0x00000200) == 0);
-    sim_reg_spi_wr(SPI_SETUP_INDEX, (sim_reg_spi_rd(SPI_SETUP_INDEX) & ~0x00000200) | (spisckphase << 9));
-}
-
-__INLINE uint8_t spi_sck_pol_getf(void)
-{
-    uint32_t localVal = sim_reg_spi_rd(SPI_SETUP_INDEX);
-    return ((localVal & 0x00000100) >> 8);
-}
-
-__INLINE void spi_sck_pol_setf(uint8_t spisckpol)
-{
-    ASSERT_ERR(((spisckpol << 8) & ~0x00000100) == 0);
-    sim_reg_spi_wr(SPI_SETUP_INDEX, (sim_reg_spi_rd(SPI_SETUP_INDEX) & ~0x00000100) | (spisckpol << 8));
-}
-
-__INLINE uint8_t spi_sdo_inactive_st_getf(void)
-{
-    uint32_t localVal = sim_reg_spi_rd(SPI_SETUP_INDEX);
-    return ((localVal & 0x00000030) >> 4);
-}
-
-__INLINE void spi_sdo_inactive_st_setf(uint8_t spisdoinactivest)
-{
-    ASSERT_ERR(((spisdoinactivest << 4) & ~0x00000030) == 0);
-    sim_reg_spi_wr(SPI_SETUP_INDEX, (sim_reg_spi_rd(SPI_SETUP_INDEX) & ~0x00000030) | (spisdoinactivest << 4));
-}
-
-__INLINE uint8_t spi_ss_delay_getf(void)
-{
-    uint32_t localVal = sim_reg_spi_rd(SPI_SETUP_INDEX);
-    return ((localVal & 0x0000000C) >> 2);
-}
-
-__INLINE void spi_ss_delay_setf(uint8_t spissdelay)
-{
-    ASSERT_ERR(((spissdelay << 2) & ~0x0000000C) == 0);
-    sim_reg_spi_wr(SPI_SETUP_INDEX, (sim_reg_spi_rd(SPI_SETUP_INDEX) & ~0x0000000C) | (spissdelay << 2));
-}
-
-__INLINE uint8_t spi_ss_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_spi_rd(SPI_SETUP_INDEX);
-    return ((localVal & 0x00000003) >> 0);
-}
-
-__INLINE void spi_ss_setup_setf(uint8_t spisssetup)
-{
-    ASSERT_ERR(((spisssetup << 0) & ~0x00000003) == 0);
-    sim_reg_spi_wr(SPI_SETUP_INDEX, (sim_reg_spi_rd(SPI_SETUP_INDEX) & ~0x00000003) | (spisssetup << 0));
-}
-
 /**
  * @brief SPI_STATUS register definition
  * <pre>
@@ -386,16 +136,6 @@ __INLINE void spi_ss_setup_setf(uint8_t spisssetup)
  */
 #define SPI_STATUS_INDEX  0x00000004
 
-__INLINE uint32_t spi_status_get(void)
-{
-    return sim_reg_spi_rd(SPI_STATUS_INDEX);
-}
-
-__INLINE void spi_status_set(uint32_t value)
-{
-    sim_reg_spi_wr(SPI_STATUS_INDEX, value);
-}
-
 // field definitions
 #define SPI_FIRST_DATA_BIT    0x00000100
 #define SPI_FIRST_DATA_POS    8
@@ -408,52 +148,517 @@ __INLINE void spi_status_set(uint32_t value)
 #define SPI_OVERFLOW_RST      0x0
 #define SPI_INT_RST           0x0
 
-__INLINE void spi_status_pack(uint8_t spioverflow, uint8_t spiint)
-{
-    ASSERT_ERR(((spioverflow << 4) & ~0x00000010) == 0);
-    ASSERT_ERR(((spiint << 0) & ~0x00000001) == 0);
-    sim_reg_spi_wr(SPI_STATUS_INDEX,  (spioverflow << 4) | (spiint << 0));
-}
-
-__INLINE void spi_status_unpack(uint8_t* spifirstdata, uint8_t* spioverflow, uint8_t* spiint)
-{
-    uint32_t localVal = sim_reg_spi_rd(SPI_STATUS_INDEX);
-
-    *spifirstdata = (localVal & 0x00000100) >> 8;
-    *spioverflow = (localVal & 0x00000010) >> 4;
-    *spiint = (localVal & 0x00000001) >> 0;
-}
-
-__INLINE uint8_t spi_first_data_getf(void)
-{
-    uint32_t localVal = sim_reg_spi_rd(SPI_STATUS_INDEX);
-    return ((localVal & 0x00000100) >> 8);
-}
-
-__INLINE uint8_t spi_overflow_getf(void)
-{
-    uint32_t localVal = sim_reg_spi_rd(SPI_STATUS_INDEX);
-    return ((localVal & 0x00000010) >> 4);
-}
-
-__INLINE void spi_overflow_setf(uint8_t spioverflow)
-{
-    ASSERT_ERR(((spioverflow << 4) & ~0x00000010) == 0);
-    sim_reg_spi_wr(SPI_STATUS_INDEX, (sim_reg_spi_rd(SPI_STATUS_INDEX) & ~0x00000010) | (spioverflow << 4));
-}
-
-__INLINE uint8_t spi_int_getf(void)
-{
-    uint32_t localVal = sim_reg_spi_rd(SPI_STATUS_INDEX);
-    return ((localVal & 0x00000001) >> 0);
-}
-
-__INLINE void spi_int_setf(uint8_t spiint)
-{
-    ASSERT_ERR(((spiint << 0) & ~0x00000001) == 0);
-    sim_reg_spi_wr(SPI_STATUS_INDEX, (sim_reg_spi_rd(SPI_STATUS_INDEX) & ~0x00000001) | (spiint << 0));
-}
-
+/**
+ * @brief Register map of the REG_SPI block, to be derived by the block model
+ *
+ * The register accesses are dispatched at compile time to the register hooks
+ * {regname}_rd() and {regname}_wr(value) of the model, which only redefines the
+ * hooks of the registers having side effects.
+ * @param MODEL Block model deriving from this class
+ */
+template <typename MODEL>
+struct RegSpi : Peripheral<REG_SPI_COUNT>
+{
+    /** Constructor
+     * @param[in] name Name of the module
+     */
+    RegSpi(sc_core::sc_module_name name)
+    : Peripheral<REG_SPI_COUNT>(name)
+    {
+        this->set_reg_names(&reg_name);
+    }
+
+    /** Name of a register
+     * @param[in] index Index of the register
+     * @return The name of the register, NULL if there is no register at this index
+     */
+    static const char*
+    reg_name(uint32_t index)
+    {
+        static const char* const names[REG_SPI_COUNT] =
+        {
+            "SPI_TX_DATA",
+            "SPI_RX_DATA",
+            "SPI_CLK_CTRL",
+            "SPI_SETUP",
+            "SPI_STATUS",
+        };
+
+        return (index < REG_SPI_COUNT) ? names[index] : NULL;
+    }
+
+    uint32_t spi_tx_data_get(void)
+    {
+        return this->m_reg[SPI_TX_DATA_INDEX];
+    }
+
+    void spi_tx_data_set(uint32_t value)
+    {
+        this->m_reg[SPI_TX_DATA_INDEX] = value;
+    }
+
+    typedef RegField<SPI_TX_DATA_INDEX, 0xFFFFFFFF, 0> spi_tx_data_field;
+
+    uint32_t spi_tx_data_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPI_TX_DATA_INDEX];
+        ASSERT_ERR((localVal & ~0xFFFFFFFF) == 0);
+        return (localVal >> 0);
+    }
+
+    void spi_tx_data_setf(uint32_t spitxdata)
+    {
+        ASSERT_ERR(((spitxdata << 0) & ~0xFFFFFFFF) == 0);
+        this->m_reg[SPI_TX_DATA_INDEX] = spitxdata << 0;
+    }
+
+    uint32_t spi_rx_data_get(void)
+    {
+        return this->m_reg[SPI_RX_DATA_INDEX];
+    }
+
+    void spi_rx_data_set(uint32_t value)
+    {
+        this->m_reg[SPI_RX_DATA_INDEX] = value;
+    }
+
+    typedef RegField<SPI_RX_DATA_INDEX, 0xFFFFFFFF, 0> spi_rx_data_field;
+
+    uint32_t spi_rx_data_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPI_RX_DATA_INDEX];
+        ASSERT_ERR((localVal & ~0xFFFFFFFF) == 0);
+        return (localVal >> 0);
+    }
+
+    uint32_t spi_clk_ctrl_get(void)
+    {
+        return this->m_reg[SPI_CLK_CTRL_INDEX];
+    }
+
+    void spi_clk_ctrl_set(uint32_t value)
+    {
+        this->m_reg[SPI_CLK_CTRL_INDEX] = value;
+    }
+
+    typedef RegField<SPI_CLK_CTRL_INDEX, 0x0000FF00, 8> spi_sck_count_field;
+    typedef RegField<SPI_CLK_CTRL_INDEX, 0x00000080, 7> spi_start_field;
+    typedef RegField<SPI_CLK_CTRL_INDEX, 0x0000007F, 0> spi_data_length_field;
+
+    void spi_clk_ctrl_pack(uint8_t spisckcount, uint8_t spistart, uint8_t spidatalength)
+    {
+        ASSERT_ERR(((spisckcount << 8) & ~0x0000FF00) == 0);
+        ASSERT_ERR(((spistart << 7) & ~0x00000080) == 0);
+        ASSERT_ERR(((spidatalength << 0) & ~0x0000007F) == 0);
+        this->m_reg[SPI_CLK_CTRL_INDEX] =  (spisckcount << 8) | (spistart << 7) | (spidatalength << 0);
+    }
+
+    void spi_clk_ctrl_unpack(uint8_t* spisckcount, uint8_t* spistart, uint8_t* spidatalength)
+    {
+        uint32_t localVal = this->m_reg[SPI_CLK_CTRL_INDEX];
+
+        *spisckcount = (localVal & 0x0000FF00) >> 8;
+        *spistart = (localVal & 0x00000080) >> 7;
+        *spidatalength = (localVal & 0x0000007F) >> 0;
+    }
+
+    uint8_t spi_sck_count_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPI_CLK_CTRL_INDEX];
+        return ((localVal & 0x0000FF00) >> 8);
+    }
+
+    void spi_sck_count_setf(uint8_t spisckcount)
+    {
+        ASSERT_ERR(((spisckcount << 8) & ~0x0000FF00) == 0);
+        this->m_reg[SPI_CLK_CTRL_INDEX] = (this->m_reg[SPI_CLK_CTRL_INDEX] & ~0x0000FF00) | (spisckcount << 8);
+    }
+
+    uint8_t spi_start_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPI_CLK_CTRL_INDEX];
+        return ((localVal & 0x00000080) >> 7);
+    }
+
+    void spi_start_setf(uint8_t spistart)
+    {
+        ASSERT_ERR(((spistart << 7) & ~0x00000080) == 0);
+        this->m_reg[SPI_CLK_CTRL_INDEX] = (this->m_reg[SPI_CLK_CTRL_INDEX] & ~0x00000080) | (spistart << 7);
+    }
+
+    uint8_t spi_data_length_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPI_CLK_CTRL_INDEX];
+        return ((localVal & 0x0000007F) >> 0);
+    }
+
+    void spi_data_length_setf(uint8_t spidatalength)
+    {
+        ASSERT_ERR(((spidatalength << 0) & ~0x0000007F) == 0);
+        this->m_reg[SPI_CLK_CTRL_INDEX] = (this->m_reg[SPI_CLK_CTRL_INDEX] & ~0x0000007F) | (spidatalength << 0);
+    }
+
+    uint32_t spi_setup_get(void)
+    {
+        return this->m_reg[SPI_SETUP_INDEX];
+    }
+
+    void spi_setup_set(uint32_t value)
+    {
+        this->m_reg[SPI_SETUP_INDEX] = value;
+    }
+
+    typedef RegField<SPI_SETUP_INDEX, 0x00020000, 17> spi_3wire_field;
+    typedef RegField<SPI_SETUP_INDEX, 0x00010000, 16> spi_mode_field;
+    typedef RegField<SPI_SETUP_INDEX, 0x00007000, 12> spi_sck_freq_field;
+    typedef RegField<SPI_SETUP_INDEX, 0x00000400, 10> spi_miso_phase_field;
+    typedef RegField<SPI_SETUP_INDEX, 0x00000200, 9> spi_sck_phase_field;
+    typedef RegField<SPI_SETUP_INDEX, 0x00000100, 8> spi_sck_pol_field;
+    typedef RegField<SPI_SETUP_INDEX, 0x00000030, 4> spi_sdo_inactive_st_field;
+    typedef RegField<SPI_SETUP_INDEX, 0x0000000C, 2> spi_ss_delay_field;
+    typedef RegField<SPI_SETUP_INDEX, 0x00000003, 0> spi_ss_setup_field;
+
+    void spi_setup_pack(uint8_t spi3wire, uint8_t spimode, uint8_t spisckfreq, uint8_t spimisophase, uint8_t spisckphase, uint8_t spisckpol, uint8_t spisdoinactivest, uint8_t spissdelay, uint8_t spisssetup)
+    {
+        ASSERT_ERR(((spi3wire << 17) & ~0x00020000) == 0);
+        ASSERT_ERR(((spimode << 16) & ~0x00010000) == 0);
+        ASSERT_ERR(((spisckfreq << 12) & ~0x00007000) == 0);
+        ASSERT_ERR(((spimisophase << 10) & ~0x00000400) == 0);
+        ASSERT_ERR(((spisckphase << 9) & ~0x00000200) == 0);
+        ASSERT_ERR(((spisckpol << 8) & ~0x00000100) == 0);
+        ASSERT_ERR(((spisdoinactivest << 4) & ~0x00000030) == 0);
+        ASSERT_ERR(((spissdelay << 2) & ~0x0000000C) == 0);
+        ASSERT_ERR(((spisssetup << 0) & ~0x00000003) == 0);
+        this->m_reg[SPI_SETUP_INDEX] =  (spi3wire << 17) | (spimode << 16) | (spisckfreq << 12) | (spimisophase << 10) | (spisckphase << 9) | (spisckpol << 8) | (spisdoinactivest << 4) | (spissdelay << 2) | (spisssetup << 0);
+    }
+
+    void spi_setup_unpack(uint8_t* spi3wire, uint8_t* spimode, uint8_t* spisckfreq, uint8_t* spimisophase, uint8_t* spisckphase, uint8_t* spisckpol, uint8_t* spisdoinactivest, uint8_t* spissdelay, uint8_t* spisssetup)
+    {
+        uint32_t localVal = this->m_reg[SPI_SETUP_INDEX];
+
+        *spi3wire = (localVal & 0x00020000) >> 17;
+        *spimode = (localVal & 0x00010000) >> 16;
+        *spisckfreq = (localVal & 0x00007000) >> 12;
+        *spimisophase = (localVal & 0x00000400) >> 10;
+        *spisckphase = (localVal & 0x00000200) >> 9;
+        *spisckpol = (localVal & 0x00000100) >> 8;
+        *spisdoinactivest = (localVal & 0x00000030) >> 4;
+        *spissdelay = (localVal & 0x0000000C) >> 2;
+        *spisssetup = (localVal & 0x00000003) >> 0;
+    }
+
+    uint8_t spi_3wire_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPI_SETUP_INDEX];
+        return ((localVal & 0x00020000) >> 17);
+    }
+
+    void spi_3wire_setf(uint8_t spi3wire)
+    {
+        ASSERT_ERR(((spi3wire << 17) & ~0x00020000) == 0);
+        this->m_reg[SPI_SETUP_INDEX] = (this->m_reg[SPI_SETUP_INDEX] & ~0x00020000) | (spi3wire << 17);
+    }
+
+    uint8_t spi_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPI_SETUP_INDEX];
+        return ((localVal & 0x00010000) >> 16);
+    }
+
+    void spi_mode_setf(uint8_t spimode)
+    {
+        ASSERT_ERR(((spimode << 16) & ~0x00010000) == 0);
+        this->m_reg[SPI_SETUP_INDEX] = (this->m_reg[SPI_SETUP_INDEX] & ~0x00010000) | (spimode << 16);
+    }
+
+    uint8_t spi_sck_freq_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPI_SETUP_INDEX];
+        return ((localVal & 0x00007000) >> 12);
+    }
+
+    void spi_sck_freq_setf(uint8_t spisckfreq)
+    {
+        ASSERT_ERR(((spisckfreq << 12) & ~0x00007000) == 0);
+        this->m_reg[SPI_SETUP_INDEX] = (this->m_reg[SPI_SETUP_INDEX] & ~0x00007000) | (spisckfreq << 12);
+    }
+
+    uint8_t spi_miso_phase_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPI_SETUP_INDEX];
+        return ((localVal & 0x00000400) >> 10);
+    }
+
+    void spi_miso_phase_setf(uint8_t spimisophase)
+    {
+        ASSERT_ERR(((spimisophase << 10) & ~0x00000400) == 0);
+        this->m_reg[SPI_SETUP_INDEX] = (this->m_reg[SPI_SETUP_INDEX] & ~0x00000400) | (spimisophase << 10);
+    }
+
+    uint8_t spi_sck_phase_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPI_SETUP_INDEX];
+        return ((localVal & 0x00000200) >> 9);
+    }
+
+    void spi_sck_phase_setf(uint8_t spisckphase)
+    {
+        ASSERT_ERR(((spisckphase << 9) & ~0x00000200) == 0);
+        this->m_reg[SPI_SETUP_INDEX] = (this->m_reg[SPI_SETUP_INDEX] & ~0x00000200) | (spisckphase << 9);
+    }
+
+    uint8_t spi_sck_pol_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPI_SETUP_INDEX];
+        return ((localVal & 0x00000100) >> 8);
+    }
+
+    void spi_sck_pol_setf(uint8_t spisckpol)
+    {
+        ASSERT_ERR(((spisckpol << 8) & ~0x00000100) == 0);
+        this->m_reg[SPI_SETUP_INDEX] = (this->m_reg[SPI_SETUP_INDEX] & ~0x00000100) | (spisckpol << 8);
+    }
+
+    uint8_t spi_sdo_inactive_st_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPI_SETUP_INDEX];
+        return ((localVal & 0x00000030) >> 4);
+    }
+
+    void spi_sdo_inactive_st_setf(uint8_t spisdoinactivest)
+    {
+        ASSERT_ERR(((spisdoinactivest << 4) & ~0x00000030) == 0);
+        this->m_reg[SPI_SETUP_INDEX] = (this->m_reg[SPI_SETUP_INDEX] & ~0x00000030) | (spisdoinactivest << 4);
+    }
+
+    uint8_t spi_ss_delay_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPI_SETUP_INDEX];
+        return ((localVal & 0x0000000C) >> 2);
+    }
+
+    void spi_ss_delay_setf(uint8_t spissdelay)
+    {
+        ASSERT_ERR(((spissdelay << 2) & ~0x0000000C) == 0);
+        this->m_reg[SPI_SETUP_INDEX] = (this->m_reg[SPI_SETUP_INDEX] & ~0x0000000C) | (spissdelay << 2);
+    }
+
+    uint8_t spi_ss_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPI_SETUP_INDEX];
+        return ((localVal & 0x00000003) >> 0);
+    }
+
+    void spi_ss_setup_setf(uint8_t spisssetup)
+    {
+        ASSERT_ERR(((spisssetup << 0) & ~0x00000003) == 0);
+        this->m_reg[SPI_SETUP_INDEX] = (this->m_reg[SPI_SETUP_INDEX] & ~0x00000003) | (spisssetup << 0);
+    }
+
+    uint32_t spi_status_get(void)
+    {
+        return this->m_reg[SPI_STATUS_INDEX];
+    }
+
+    void spi_status_set(uint32_t value)
+    {
+        this->m_reg[SPI_STATUS_INDEX] = value;
+    }
+
+    typedef RegField<SPI_STATUS_INDEX, 0x00000100, 8> spi_first_data_field;
+    typedef RegField<SPI_STATUS_INDEX, 0x00000010, 4> spi_overflow_field;
+    typedef RegField<SPI_STATUS_INDEX, 0x00000001, 0> spi_int_field;
+
+    void spi_status_pack(uint8_t spioverflow, uint8_t spiint)
+    {
+        ASSERT_ERR(((spioverflow << 4) & ~0x00000010) == 0);
+        ASSERT_ERR(((spiint << 0) & ~0x00000001) == 0);
+        this->m_reg[SPI_STATUS_INDEX] =  (spioverflow << 4) | (spiint << 0);
+    }
+
+    void spi_status_unpack(uint8_t* spifirstdata, uint8_t* spioverflow, uint8_t* spiint)
+    {
+        uint32_t localVal = this->m_reg[SPI_STATUS_INDEX];
+
+        *spifirstdata = (localVal & 0x00000100) >> 8;
+        *spioverflow = (localVal & 0x00000010) >> 4;
+        *spiint = (localVal & 0x00000001) >> 0;
+    }
+
+    uint8_t spi_first_data_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPI_STATUS_INDEX];
+        return ((localVal & 0x00000100) >> 8);
+    }
+
+    uint8_t spi_overflow_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPI_STATUS_INDEX];
+        return ((localVal & 0x00000010) >> 4);
+    }
+
+    void spi_overflow_setf(uint8_t spioverflow)
+    {
+        ASSERT_ERR(((spioverflow << 4) & ~0x00000010) == 0);
+        this->m_reg[SPI_STATUS_INDEX] = (this->m_reg[SPI_STATUS_INDEX] & ~0x00000010) | (spioverflow << 4);
+    }
+
+    uint8_t spi_int_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPI_STATUS_INDEX];
+        return ((localVal & 0x00000001) >> 0);
+    }
+
+    void spi_int_setf(uint8_t spiint)
+    {
+        ASSERT_ERR(((spiint << 0) & ~0x00000001) == 0);
+        this->m_reg[SPI_STATUS_INDEX] = (this->m_reg[SPI_STATUS_INDEX] & ~0x00000001) | (spiint << 0);
+    }
+
+
+protected:
+    /// SPI_TX_DATA register read hook
+    uint32_t
+    spi_tx_data_rd()
+    {
+        return this->m_reg[SPI_TX_DATA_INDEX];
+    }
+
+    /// SPI_TX_DATA register write hook
+    void
+    spi_tx_data_wr(uint32_t value)
+    {
+        this->m_reg[SPI_TX_DATA_INDEX] = value;
+    }
+
+    /// SPI_RX_DATA register read hook
+    uint32_t
+    spi_rx_data_rd()
+    {
+        return this->m_reg[SPI_RX_DATA_INDEX];
+    }
+
+    /// SPI_RX_DATA register write hook
+    void
+    spi_rx_data_wr(uint32_t value)
+    {
+        TLM_ERR("Write to R/O register SPI_RX_DATA, data = 0x%08X", value);
+    }
+
+    /// SPI_CLK_CTRL register read hook
+    uint32_t
+    spi_clk_ctrl_rd()
+    {
+        return this->m_reg[SPI_CLK_CTRL_INDEX];
+    }
+
+    /// SPI_CLK_CTRL register write hook
+    void
+    spi_clk_ctrl_wr(uint32_t value)
+    {
+        this->m_reg[SPI_CLK_CTRL_INDEX] = value;
+    }
+
+    /// SPI_SETUP register read hook
+    uint32_t
+    spi_setup_rd()
+    {
+        return this->m_reg[SPI_SETUP_INDEX];
+    }
+
+    /// SPI_SETUP register write hook
+    void
+    spi_setup_wr(uint32_t value)
+    {
+        this->m_reg[SPI_SETUP_INDEX] = value;
+    }
+
+    /// SPI_STATUS register read hook
+    uint32_t
+    spi_status_rd()
+    {
+        return this->m_reg[SPI_STATUS_INDEX];
+    }
+
+    /// SPI_STATUS register write hook
+    void
+    spi_status_wr(uint32_t value)
+    {
+        this->m_reg[SPI_STATUS_INDEX] = value;
+    }
+
+    /** Register read function, dispatched to the register hooks of the model
+     * @param[in] offset Offset of the register to access
+     * @return The value read
+     */
+    virtual uint32_t
+    reg_rd(uint32_t offset)
+    {
+        MODEL* model = static_cast<MODEL*>(this);
+        uint32_t index = offset/4;
+
+        // sanity check
+        assert(index < REG_SPI_COUNT);
+
+        // internal delay
+        this->delay();
+
+        switch (index)
+        {
+        case SPI_TX_DATA_INDEX:
+            return model->spi_tx_data_rd();
+        case SPI_RX_DATA_INDEX:
+            return model->spi_rx_data_rd();
+        case SPI_CLK_CTRL_INDEX:
+            return model->spi_clk_ctrl_rd();
+        case SPI_SETUP_INDEX:
+            return model->spi_setup_rd();
+        case SPI_STATUS_INDEX:
+            return model->spi_status_rd();
+        default:
+            return this->m_reg[index];
+        }
+    }
+
+    /** Register write function, dispatched to the register hooks of the model
+     * @param[in] offset Offset of the register to access
+     * @param[in] value Value to write in the register
+     */
+    virtual void
+    reg_wr(uint32_t offset, uint32_t value)
+    {
+        MODEL* model = static_cast<MODEL*>(this);
+        uint32_t index = offset/4;
+
+        // sanity check
+        assert(index < REG_SPI_COUNT);
+
+        // internal delay
+        this->delay();
+
+        switch (index)
+        {
+        case SPI_TX_DATA_INDEX:
+            model->spi_tx_data_wr(value);
+            break;
+        case SPI_RX_DATA_INDEX:
+            model->spi_rx_data_wr(value);
+            break;
+        case SPI_CLK_CTRL_INDEX:
+            model->spi_clk_ctrl_wr(value);
+            break;
+        case SPI_SETUP_INDEX:
+            model->spi_setup_wr(value);
+            break;
+        case SPI_STATUS_INDEX:
+            model->spi_status_wr(value);
+            break;
+        default:
+            this->m_reg[index] = value;
+            break;
+        }
+    }
+};
 
 #endif // _REG_SPI_H_
 
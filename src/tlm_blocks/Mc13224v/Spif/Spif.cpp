@@ -1,14 +1,11 @@
 #include "Spif.h"
 #include "utils.h"
 
-// for the htonl byte swapping operation
-#include <arpa/inet.h>
-
 
 /// Used to select debugging
 #define SPIF_DEBUG_LEVEL 0
 
-/// Macro to print debug messages
+/// Macro to print debug messages (the levels above SPIF_DEBUG_LEVEL go to the runtime trace)
 /// @param __l level of debug message (0 means always printed)
 /// @param __f format of the debug string
 /// @param ... variable arguments
@@ -16,12 +13,11 @@
     do {                                                                                \
         if (SPIF_DEBUG_LEVEL >= __l) {                                                  \
             TLM_DBG(__f, ##__VA_ARGS__);                                                \
+        } else {                                                                        \
+            TLM_TRACE(__l, __f, ##__VA_ARGS__);                                         \
         }                                                                               \
     } while (false)
 
-// Used to make direct register access
-uint32_t* reg_spif;
-
 // using this namespace to simplify streaming
 using namespace std;
 
@@ -31,207 +27,304 @@ Spif::thread_flash(void)
 {
     while (true)
     {
-        int32_t bitcount;
-
         // wait for the action on the radio controller to be over
-        sc_core::wait(m_flash.event);
+        TIMELINE_WAIT(m_flash.event);
 
-        // check if the opcode was previously received
-        if (m_flash.opcode == 0)
-        {
-            // retrieve the opcode
-            m_flash.opcode = (uint8_t)(spif_tx_data_get() >> 24);
-
-            SPIF_TLM_DBG(2, "new flash opcode received: 0x%02X", m_flash.opcode);
-            // depending on the opcode, the verification is not the same
-            switch (m_flash.opcode)
-            {
-            case 0x90:
-            case 0xAB:
-                // check that the right number of bits were transfered for the opcode
-                if (spif_data_length_getf() != 32)
-                {
-                    TLM_ERR("READ ID command not correctly sent 0x%X",
-                            spif_data_length_getf());
-                }
-                SPIF_TLM_DBG(1, "flash read ID");
-                break;
-
-            case 0x03:
-                // check that the right number of bits were transfered for the opcode
-                if (spif_data_length_getf() != 32)
-                {
-                    TLM_ERR("READ command not correctly written 0x%X",
-                            spif_data_length_getf());
-                }
-                m_flash.curaddr = spif_tx_data_get() & 0x00FFFFFF;
-
-                if (m_flash.curaddr & 3)
-                {
-                    TLM_ERR("Read address not aligned 0x%08X", m_flash.curaddr);
-                }
-                SPIF_TLM_DBG(1, "flash read from address 0x%08X", m_flash.curaddr);
-                break;
-            default:
-                TLM_DBG("Unknown FLASH opcode 0x%02X", m_flash.opcode);
-                break;
-            }
-            // compute the number of extra bits after TX
-            bitcount = spif_sck_count_getf() + 1 - spif_data_length_getf();
-        }
-        else
-        {
-            bitcount = spif_sck_count_getf() + 1;
-        }
+        this->transfer();
+    }
+}
 
-        if (bitcount > 32)
-        {
-            TLM_ERR("RX bitcount larger than 32 (%u)", bitcount);
-        }
+void
+Spif::transfer(void)
+{
+    int32_t bitcount;
 
-        SPIF_TLM_DBG(1, "flash access bitcount = %u", bitcount);
+    // check if the opcode was previously received
+    if (m_flash.opcode == 0)
+    {
+        // retrieve the opcode
+        m_flash.opcode = (uint8_t)(spif_tx_data_get() >> 24);
 
-        // depend on the command type
+        SPIF_TLM_DBG(2, "new flash opcode received: 0x%02X", m_flash.opcode);
+        // depending on the opcode, the verification is not the same
         switch (m_flash.opcode)
         {
-        case 0x90:
-        case 0xAB:
-            // set the response
-            spif_rx_data_set(0xBF02BF02 >> (32-bitcount));
+        case SPIF_OP_READ_ID:
+        case SPIF_OP_READ_ID2:
+            // check that the right number of bits were transfered for the opcode
+            this->check_length("READ ID", 32);
+            SPIF_TLM_DBG(1, "flash read ID");
+            break;
+
+        case SPIF_OP_READ:
+        case SPIF_OP_FAST_READ:
+            this->check_length("READ", 32);
+            m_flash.curaddr = (spif_tx_data_get() & 0x00FFFFFF) % m_flash.size;
+
+            // the fast read has a dummy byte before the data
+            m_flash.dummy = (m_flash.opcode == SPIF_OP_FAST_READ) ? 8 : 0;
+            SPIF_TLM_DBG(1, "flash read from address 0x%08X", m_flash.curaddr);
+            break;
+
+        case SPIF_OP_PROGRAM:
+            this->check_length("PROGRAM", 32);
+            m_flash.curaddr = (spif_tx_data_get() & 0x00FFFFFF) % m_flash.size;
+            SPIF_TLM_DBG(1, "flash program at address 0x%08X", m_flash.curaddr);
+            break;
+
+        case SPIF_OP_SECTOR_ERASE:
+            this->check_length("SECTOR ERASE", 32);
+            this->erase(spif_tx_data_get() & 0x00FFFFFF, SPIF_SECTOR_SIZE);
+            break;
+
+        case SPIF_OP_BLOCK_ERASE:
+            this->check_length("BLOCK ERASE", 32);
+            this->erase(spif_tx_data_get() & 0x00FFFFFF, SPIF_BLOCK_SIZE);
+            break;
+
+        case SPIF_OP_CHIP_ERASE:
+            this->check_length("CHIP ERASE", 8);
+            this->erase(0, m_flash.size);
+            break;
+
+        case SPIF_OP_WRITE_ENABLE:
+            this->check_length("WRITE ENABLE", 8);
+            m_flash.status |= SPIF_STATUS_WEL;
+            break;
+
+        case SPIF_OP_WRITE_DISABLE:
+            this->check_length("WRITE DISABLE", 8);
+            m_flash.status &= ~SPIF_STATUS_WEL;
             break;
 
-        case 0x03:
-            // set the response (since architecture is LE, swap the word to start with
-            // the lowest address
-            spif_rx_data_set((bitcount==0)?0:htonl(U32(m_flash.data[m_flash.curaddr])) >> (32-bitcount));
-            SPIF_TLM_DBG(2, "read @%06X -> 0x%08X", m_flash.curaddr, spif_rx_data_get());
-            m_flash.curaddr += bitcount/8;
+        case SPIF_OP_READ_STATUS:
+            this->check_length("READ STATUS", 8);
             break;
 
         default:
-            TLM_DBG("Unsupported access (opcode=0x%02X)", m_flash.opcode);
+            TLM_DBG("Unknown FLASH opcode 0x%02X", m_flash.opcode);
             break;
         }
+        // compute the number of extra bits after TX
+        bitcount = spif_sck_count_getf() + 1 - spif_data_length_getf();
+    }
+    else if (m_flash.opcode == SPIF_OP_PROGRAM)
+    {
+        // data to program, then extra bits (ignored)
+        this->program(spif_tx_data_get(), spif_data_length_getf());
+        bitcount = spif_sck_count_getf() + 1 - spif_data_length_getf();
+    }
+    else
+    {
+        bitcount = spif_sck_count_getf() + 1;
+    }
 
-        // save that there is no more access
-        m_flash.active = false;
+    if (bitcount > 32)
+    {
+        TLM_ERR("RX bitcount larger than 32 (%u)", bitcount);
+    }
+
+    SPIF_TLM_DBG(1, "flash access bitcount = %u", bitcount);
+
+    // depend on the command type
+    switch (m_flash.opcode)
+    {
+    case SPIF_OP_READ_ID:
+    case SPIF_OP_READ_ID2:
+        // set the response
+        spif_rx_data_set((bitcount==0)?0:0xBF02BF02 >> (32-bitcount));
+        break;
+
+    case SPIF_OP_READ:
+    case SPIF_OP_FAST_READ:
+    {
+        // skip the dummy bits of the fast read
+        int32_t dummy = ((int32_t)m_flash.dummy < bitcount) ? m_flash.dummy : bitcount;
 
-        // if the slave is automatically unselected, it falls back in reset
-        if (spif_ss_setup_getf() < 2)
+        m_flash.dummy -= dummy;
+        bitcount -= dummy;
+
+        // set the response (starting with the lowest address in the first bits received)
+        spif_rx_data_set(this->read(bitcount));
+        SPIF_TLM_DBG(2, "read @%06X -> 0x%08X", m_flash.curaddr, spif_rx_data_get());
+        m_flash.curaddr = (m_flash.curaddr + bitcount/8) % m_flash.size;
+        break;
+    }
+
+    case SPIF_OP_READ_STATUS:
+        // the status is sent continuously (operations are instantaneous: never busy)
+        spif_rx_data_set((bitcount==0)?0:(m_flash.status * 0x01010101) >> (32-bitcount));
+        break;
+
+    default:
+        if (bitcount != 0)
         {
-            m_flash.opcode = 0;
+            TLM_DBG("Unsupported access (opcode=0x%02X)", m_flash.opcode);
         }
+        break;
+    }
 
-        // set the SPI interrupt bit
-        spif_int_setf(1);
+    // save that there is no more access
+    m_flash.active = false;
 
-        // check the interrupt status
-        this->check_int();
+    // if the slave is automatically unselected, it falls back in reset
+    if (spif_ss_setup_getf() < 2)
+    {
+        this->deselect();
     }
+
+    // set the SPI interrupt bit
+    spif_int_setf(1);
+
+    // check the interrupt status
+    this->check_int();
 }
 
-uint32_t
-Spif::reg_rd(uint32_t offset)
+void
+Spif::check_length(const char* name, uint32_t length)
 {
-    uint32_t result;
-    // retrieve the required parameters
-    uint32_t index = offset/4;
+    if (spif_data_length_getf() != length)
+    {
+        TLM_ERR("%s command not correctly sent 0x%X", name, spif_data_length_getf());
+    }
+}
 
-    // sanity check
-    assert(index < REG_SPIF_COUNT);
+uint32_t
+Spif::read(int32_t bitcount)
+{
+    uint32_t data = 0;
 
-    // internal delay
-    this->delay();
+    if (bitcount == 0)
+    {
+        return 0;
+    }
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        data = (data << 8) | m_flash.data[(m_flash.curaddr + i) % m_flash.size];
+    }
+    return data >> (32-bitcount);
+}
 
-    switch (index)
+void
+Spif::program(uint32_t data, int32_t bitcount)
+{
+    if (!(m_flash.status & SPIF_STATUS_WEL))
     {
-    default:
-        // read the register value
-        result = m_reg[index];
-        break;
+        TLM_DBG("Program at 0x%06X ignored, write not enabled", m_flash.curaddr);
+        return;
     }
 
-    return result;
+    // the address wraps in the page
+    for (int32_t i = 0; i < bitcount/8; i++)
+    {
+        m_flash.data[m_flash.curaddr] &= (uint8_t)(data >> (24 - 8*i));
+        m_flash.curaddr = (m_flash.curaddr & ~(SPIF_PAGE_SIZE-1)) |
+                          ((m_flash.curaddr + 1) & (SPIF_PAGE_SIZE-1));
+    }
 }
 
 void
-Spif::reg_wr(uint32_t offset, uint32_t value)
+Spif::erase(uint32_t addr, uint32_t size)
 {
-    // retrieve the required parameters
-    uint32_t index = offset/4;
+    if (!(m_flash.status & SPIF_STATUS_WEL))
+    {
+        TLM_DBG("Erase at 0x%06X ignored, write not enabled", addr);
+        return;
+    }
 
-    // sanity check
-    assert(index < REG_SPIF_COUNT);
+    if (size > m_flash.size)
+    {
+        size = m_flash.size;
+    }
+    addr = (addr % m_flash.size) & ~(size-1);
+    SPIF_TLM_DBG(1, "flash erase 0x%06X-0x%06X", addr, addr + size - 1);
+    memset(&m_flash.data[addr], 0xFF, size);
 
-    // internal delay
-    this->delay();
+    // the write enable latch is reset at the end of the operation
+    m_flash.status &= ~SPIF_STATUS_WEL;
+}
 
-    switch (index)
+void
+Spif::deselect()
+{
+    // the write enable latch is reset at the end of the program operation
+    if (m_flash.opcode == SPIF_OP_PROGRAM)
     {
-    case SPIF_RX_DATA_INDEX:
-        TLM_ERR("Write to SPIF R/O register 0x%02X, data = 0x%08X", offset, value);
-        break;
+        m_flash.status &= ~SPIF_STATUS_WEL;
+    }
+    m_flash.opcode = 0;
+}
 
-    case SPIF_CLK_CTRL_INDEX:
-        // save the register value except the START bit
-        m_reg[index] = value & ~(SPIF_START_BIT);
+void
+Spif::spif_clk_ctrl_wr(uint32_t value)
+{
+    // save the register value except the START bit
+    spif_clk_ctrl_set(value & ~(SPIF_START_BIT));
 
-        // check if there was a start request
-        if (value & SPIF_START_BIT)
+    // check if there was a start request
+    if (value & SPIF_START_BIT)
+    {
+        // sanity check that there is no other ongoing access
+        if (m_flash.active)
         {
-            // sanity check that there is no other ongoing access
-            if (m_flash.active)
-            {
-                TLM_ERR("Starting SPIF access while previous not over 0x%08X", value);
-            }
-
-            // make sure that the flash is selected (either forced low or auto low)
-            if (spif_ss_setup_getf() != 1 && spif_ss_setup_getf() != 2)
-            {
-                TLM_ERR("Starting SPIF access while FLASH not selected 0x%08X", value);
-            }
-
-            // make sure that the number of clock cycles is enough
-            if ((spif_sck_count_getf()+1) < spif_data_length_getf())
-            {
-                TLM_ERR("Starting SPIF access without enough CLK for the TX DATA %d < %d",
-                        spif_sck_count_getf(), spif_data_length_getf());
-            }
-
-            // clear the pending interrupt done bit
-            spif_int_setf(0);
-
-            // save that there is an active access request
-            m_flash.active = true;
-
-            // set the event to wake up the thread at the end of the access
-            m_flash.event.notify(spif_sck_count_getf() * 83, sc_core::SC_NS);
+            TLM_ERR("Starting SPIF access while previous not over 0x%08X", value);
         }
-        break;
 
-    case SPIF_SETUP_INDEX:
-        m_reg[index] = value;
+        // make sure that the flash is selected (either forced low or auto low)
+        if (spif_ss_setup_getf() != 1 && spif_ss_setup_getf() != 2)
+        {
+            TLM_ERR("Starting SPIF access while FLASH not selected 0x%08X", value);
+        }
 
-        // if the SS is forced deasserted, the opcode is reset
-        if (spif_ss_setup_getf() == 3)
+        // make sure that the number of clock cycles is enough
+        if ((spif_sck_count_getf()+1) < spif_data_length_getf())
         {
-            m_flash.opcode = 0;
+            TLM_ERR("Starting SPIF access without enough CLK for the TX DATA %d < %d",
+                    spif_sck_count_getf(), spif_data_length_getf());
         }
-        break;
 
-    case SPIF_STATUS_INDEX:
-        // clear the pending status bits
-        m_reg[index] &= ~(value & (SPIF_INT_BIT | SPIF_OVERFLOW_BIT));
-        break;
+        // clear the pending interrupt done bit
+        spif_int_setf(0);
 
-    default:
-        m_reg[index] = value;
-        break;
+        // save that there is an active access request
+        m_flash.active = true;
+
+        // set the event to wake up the thread at the end of the access (or complete it
+        // right away in instant mode)
+        if (m_instant)
+        {
+            this->transfer();
+        }
+        else
+        {
+            TIMELINE_NOTIFY(m_flash.event, spif_sck_count_getf() * 83, sc_core::SC_NS);
+        }
     }
 
     // check the interrupt status
     this->check_int();
+}
+
+void
+Spif::spif_setup_wr(uint32_t value)
+{
+    spif_setup_set(value);
+
+    // if the SS is forced deasserted, the opcode is reset
+    if (spif_ss_setup_getf() == 3)
+    {
+        this->deselect();
+    }
+}
 
+void
+Spif::spif_status_wr(uint32_t value)
+{
+    // clear the pending status bits
+    spif_status_set(spif_status_get() & ~(value & (SPIF_INT_BIT | SPIF_OVERFLOW_BIT)));
+
+    // check the interrupt status
+    this->check_int();
 }
 
 void
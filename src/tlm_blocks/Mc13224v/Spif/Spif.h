@@ -1,34 +1,59 @@
 #ifndef SPIF_H_
 #define SPIF_H_
 
-// this is a peripheral
-#include "Generic/Peripheral/Peripheral.h"
-
 // that generates an interrupt
 #include "Generic/IntMaster/IntMaster.h"
 
-// include the registers definition
+// this is a peripheral with the registers definition
 #include "reg_spif.h"
 
+/// Flash opcodes
+enum
+{
+    SPIF_OP_PROGRAM = 0x02,
+    SPIF_OP_READ = 0x03,
+    SPIF_OP_WRITE_DISABLE = 0x04,
+    SPIF_OP_READ_STATUS = 0x05,
+    SPIF_OP_WRITE_ENABLE = 0x06,
+    SPIF_OP_FAST_READ = 0x0B,
+    SPIF_OP_SECTOR_ERASE = 0x20,
+    SPIF_OP_READ_ID = 0x90,
+    SPIF_OP_READ_ID2 = 0xAB,
+    SPIF_OP_CHIP_ERASE = 0xC7,
+    SPIF_OP_BLOCK_ERASE = 0xD8
+};
+
+/// Write enable latch of the flash status register
+#define SPIF_STATUS_WEL 0x02
+
+/// Size of the flash sectors (erase 0x20)
+#define SPIF_SECTOR_SIZE 0x1000
+
+/// Size of the flash blocks (erase 0xD8)
+#define SPIF_BLOCK_SIZE 0x10000
+
+/// Size of the flash pages (program 0x02 wraps in the page)
+#define SPIF_PAGE_SIZE 0x100
+
 /// Interrupt Controller block model
-struct Spif : Peripheral<REG_SPIF_COUNT>
+struct Spif : RegSpif<Spif>
 {
     // Not necessary if this module does not have a thread
     SC_HAS_PROCESS(Spif);
 
     /// Constructor
     Spif(sc_core::sc_module_name name, uint8_t *flashdata, uint32_t flashsize)
-    : Peripheral<REG_SPIF_COUNT>(name)
+    : RegSpif<Spif>(name)
     , interrupt("interrupt")
+    , m_instant(false)
     {
-        // initialized the register access
-        reg_spif = &(m_reg[0]);
-
         // initialize the flash
         m_flash.data = flashdata;
         m_flash.size = flashsize;
         m_flash.opcode = 0x00;
         m_flash.active = false;
+        m_flash.status = 0x00;
+        m_flash.dummy = 0;
 
         // create threads
         SC_THREAD(thread_flash);
@@ -37,7 +62,19 @@ struct Spif : Peripheral<REG_SPIF_COUNT>
     /// Source interrupt
     IntMaster interrupt;
 
+    /** Complete the transfers when started, without the SPI clock timing (boot from flash)
+     * @param[in] instant True to complete the transfers instantly
+     */
+    void
+    set_instant(bool instant)
+    {
+        m_instant = instant;
+    }
+
 private:
+    // the register map dispatches the accesses to the register hooks
+    friend struct RegSpif<Spif>;
+
     /// Structure containing the information for the flash
     struct
     {
@@ -54,27 +91,73 @@ private:
         sc_core::sc_event event;
         /// Current address
         uint32_t curaddr;
+        /// Status register
+        uint8_t status;
+        /// Number of dummy bits left before the data (fast read)
+        uint32_t dummy;
     } m_flash;
 
+    /// Indicate that the transfers are completed when started
+    bool m_instant;
+
     /// Module thread (responds to read and writes to the FLASH through the SPIF)
     void thread_flash(void);
 
+    /// Execute the transfer programmed in the registers
+    void transfer(void);
+
+    /** Check the number of bits of a command
+     * @param[in] name Name of the command
+     * @param[in] length Number of bits expected
+     */
+    void
+    check_length(const char* name, uint32_t length);
+
+    /** Read data from the flash at the current address
+     * @param[in] bitcount Number of bits to read (up to 32)
+     * @return The data, the first byte in the most significant bits
+     */
+    uint32_t
+    read(int32_t bitcount);
+
+    /** Program data in the flash at the current address (bits can only be cleared)
+     * @param[in] data Data, the first byte in the most significant bits
+     * @param[in] bitcount Number of bits to program (up to 32)
+     */
+    void
+    program(uint32_t data, int32_t bitcount);
+
+    /** Erase an area of the flash
+     * @param[in] addr Address in the area
+     * @param[in] size Size of the area (power of 2)
+     */
+    void
+    erase(uint32_t addr, uint32_t size);
+
+    /// End the current command (the slave is deselected)
+    void
+    deselect();
+
     /// Check that interrupt status
     void check_int();
 
-    /** Register read function
-     * @param[in] offset Offset of the register to read
-     * @return The value read
+    /** SPIF_CLK_CTRL register write hook: start the transfer if requested
+     * @param[in] value Value written in the register
      */
-    uint32_t
-    reg_rd(uint32_t offset);
+    void
+    spif_clk_ctrl_wr(uint32_t value);
+
+    /** SPIF_SETUP register write hook: reset the opcode when the SS is deasserted
+     * @param[in] value Value written in the register
+     */
+    void
+    spif_setup_wr(uint32_t value);
 
-    /** Register write function
-     * @param[in] offset Offset of the register to read
-     * @param[in] offset Value to write in the register
+    /** SPIF_STATUS register write hook: clear the pending status bits
+     * @param[in] value Value written in the register
      */
     void
-    reg_wr(uint32_t offset, uint32_t value);
+    spif_status_wr(uint32_t value);
 };
 
 #endif /*SPIF_H_*/
@@ -4,7 +4,7 @@
 #include <stdint.h>
 #include "compiler.h"
 #include "arch.h"
-#include "reg_sim.h"
+#include "Generic/Peripheral/Peripheral.h"
 
 #define REG_SPIF_BASE_ADDR 0x8000C000
 
@@ -22,16 +22,6 @@
  */
 #define SPIF_TX_DATA_INDEX  0x00000000
 
-__INLINE uint32_t spif_tx_data_get(void)
-{
-    return sim_reg_spif_rd(SPIF_TX_DATA_INDEX);
-}
-
-__INLINE void spif_tx_data_set(uint32_t value)
-{
-    sim_reg_spif_wr(SPIF_TX_DATA_INDEX, value);
-}
-
 // field definitions
 #define SPIF_TX_DATA_MASK   0xFFFFFFFF
 #define SPIF_TX_DATA_LSB    0
@@ -39,19 +29,6 @@ __INLINE void spif_tx_data_set(uint32_t value)
 
 #define SPIF_TX_DATA_RST    0x0
 
-__INLINE uint32_t spif_tx_data_getf(void)
-{
-    uint32_t localVal = sim_reg_spif_rd(SPIF_TX_DATA_INDEX);
-    ASSERT_ERR((localVal & ~0xFFFFFFFF) == 0);
-    return (localVal >> 0);
-}
-
-__INLINE void spif_tx_data_setf(uint32_t spiftxdata)
-{
-    ASSERT_ERR(((spiftxdata << 0) & ~0xFFFFFFFF) == 0);
-    sim_reg_spif_wr(SPIF_TX_DATA_INDEX, spiftxdata << 0);
-}
-
 /**
  * @brief SPIF_RX_DATA register definition
  * <pre>
@@ -62,16 +39,6 @@ __INLINE void spif_tx_data_setf(uint32_t spiftxdata)
  */
 #define SPIF_RX_DATA_INDEX  0x00000001
 
-__INLINE uint32_t spif_rx_data_get(void)
-{
-    return sim_reg_spif_rd(SPIF_RX_DATA_INDEX);
-}
-
-__INLINE void spif_rx_data_set(uint32_t value)
-{
-    sim_reg_spif_wr(SPIF_RX_DATA_INDEX, value);
-}
-
 // field definitions
 #define SPIF_RX_DATA_MASK   0xFFFFFFFF
 #define SPIF_RX_DATA_LSB    0
@@ -79,13 +46,6 @@ __INLINE void spif_rx_data_set(uint32_t value)
 
 #define SPIF_RX_DATA_RST    0x0
 
-__INLINE uint32_t spif_rx_data_getf(void)
-{
-    uint32_t localVal = sim_reg_spif_rd(SPIF_RX_DATA_INDEX);
-    ASSERT_ERR((localVal & ~0xFFFFFFFF) == 0);
-    return (localVal >> 0);
-}
-
 /**
  * @brief SPIF_CLK_CTRL register definition
  * <pre>
@@ -98,16 +58,6 @@ __INLINE uint32_t spif_rx_data_getf(void)
  */
 #define SPIF_CLK_CTRL_INDEX  0x00000002
 
-__INLINE uint32_t spif_clk_ctrl_get(void)
-{
-    return sim_reg_spif_rd(SPIF_CLK_CTRL_INDEX);
-}
-
-__INLINE void spif_clk_ctrl_set(uint32_t value)
-{
-    sim_reg_spif_wr(SPIF_CLK_CTRL_INDEX, value);
-}
-
 // field definitions
 #define SPIF_SCK_COUNT_MASK     0x0000FF00
 #define SPIF_SCK_COUNT_LSB      8
@@ -122,59 +72,6 @@ __INLINE void spif_clk_ctrl_set(uint32_t value)
 #define SPIF_START_RST          0x0
 #define SPIF_DATA_LENGTH_RST    0x0
 
-__INLINE void spif_clk_ctrl_pack(uint8_t spifsckcount, uint8_t spifstart, uint8_t spifdatalength)
-{
-    ASSERT_ERR(((spifsckcount << 8) & ~0x0000FF00) == 0);
-    ASSERT_ERR(((spifstart << 7) & ~0x00000080) == 0);
-    ASSERT_ERR(((spifdatalength << 0) & ~0x0000007F) == 0);
-    sim_reg_spif_wr(SPIF_CLK_CTRL_INDEX,  (spifsckcount << 8) | (spifstart << 7) | (spifdatalength << 0));
-}
-
-__INLINE void spif_clk_ctrl_unpack(uint8_t* spifsckcount, uint8_t* spifstart, uint8_t* spifdatalength)
-{
-    uint32_t localVal = sim_reg_spif_rd(SPIF_CLK_CTRL_INDEX);
-
-    *spifsckcount = (localVal & 0x0000FF00) >> 8;
-    *spifstart = (localVal & 0x00000080) >> 7;
-    *spifdatalength = (localVal & 0x0000007F) >> 0;
-}
-
-__INLINE uint8_t spif_sck_count_getf(void)
-{
-    uint32_t localVal = sim_reg_spif_rd(SPIF_CLK_CTRL_INDEX);
-    return ((localVal & 0x0000FF00) >> 8);
-}
-
-__INLINE void spif_sck_count_setf(uint8_t spifsckcount)
-{
-    ASSERT_ERR(((spifsckcount << 8) & ~0x0000FF00) == 0);
-    sim_reg_spif_wr(SPIF_CLK_CTRL_INDEX, (sim_reg_spif_rd(SPIF_CLK_CTRL_INDEX) & ~0x0000FF00) | (spifsckcount << 8));
-}
-
-__INLINE uint8_t spif_start_getf(void)
-{
-    uint32_t localVal = sim_reg_spif_rd(SPIF_CLK_CTRL_INDEX);
-    return ((localVal & 0x00000080) >> 7);
-}
-
-__INLINE void spif_start_setf(uint8_t spifstart)
-{
-    ASSERT_ERR(((spifstart << 7) & ~0x00000080) == 0);
-    sim_reg_spif_wr(SPIF_CLK_CTRL_INDEX, (sim_reg_spif_rd(SPIF_CLK_CTRL_INDEX) & ~0x00000080) | (spifstart << 7));
-}
-
-__INLINE uint8_t spif_data_length_getf(void)
-{
-    uint32_t localVal = sim_reg_spif_rd(SPIF_CLK_CTRL_INDEX);
-    return ((localVal & 0x0000007F) >> 0);
-}
-
-__INLINE void spif_data_length_setf(uint8_t spifdatalength)
-{
-    ASSERT_ERR(((spifdatalength << 0) & ~0x0000007F) == 0);
-    sim_reg_spif_wr(SPIF_CLK_CTRL_INDEX, (sim_reg_spif_rd(SPIF_CLK_CTRL_INDEX) & ~0x0000007F) | (spifdatalength << 0));
-}
-
 /**
  * @brief SPIF_SETUP register definition
  * <pre>
@@ -193,16 +90,6 @@ __INLINE void spif_data_length_setf(uint8_t spifdatalength)
  */
 #define SPIF_SETUP_INDEX  0x00000003
 
-__INLINE uint32_t spif_setup_get(void)
-{
-    return sim_reg_spif_rd(SPIF_SETUP_INDEX);
-}
-
-__INLINE void spif_setup_set(uint32_t value)
-{
-    sim_reg_spif_wr(SPIF_SETUP_INDEX, value);
-}
-
 // field definitions
 #define SPIF_3WIRE_BIT              0x00020000
 #define SPIF_3WIRE_POS              17
@@ -237,143 +124,6 @@ __INLINE void spif_setup_set(uint32_t value)
 #define SPIF_SS_DELAY_RST           0x0
 #define SPIF_SS_SETUP_RST           0x0
 
-__INLINE void spif_setup_pack(uint8_t spif3wire, uint8_t spifmode, uint8_t spifsckfreq, uint8_t spifmisophase, uint8_t spifsckphase, uint8_t spifsckpol, uint8_t spifsdoinactivest, uint8_t spifssdelay, uint8_t spifsssetup)
-{
-    ASSERT_ERR(((spif3wire << 17) & ~0x00020000) == 0);
-    ASSERT_ERR(((spifmode << 16) & ~0x00010000) == 0);
-    ASSERT_ERR(((spifsckfreq << 12) & ~0x00007000) == 0);
-    ASSERT_ERR(((spifmisophase << 10) & ~0x00000400) == 0);
-    ASSERT_ERR(((spifsckphase << 9) & ~0x00000200) == 0);
-    ASSERT_ERR(((spifsckpol << 8) & ~0x00000100) == 0);
-    ASSERT_ERR(((spifsdoinactivest << 4) & ~0x00000030) == 0);
-    ASSERT_ERR(((spifssdelay << 2) & ~0x0000000C) == 0);
-    ASSERT_ERR(((spifsssetup << 0) & ~0x00000003) == 0);
-    sim_reg_spif_wr(SPIF_SETUP_INDEX,  (spif3wire << 17) | (spifmode << 16) | (spifsckfreq << 12) | (spifmisophase << 10) | (spifsckphase << 9) | (spifsckpol << 8) | (spifsdoinactivest << 4) | (spifssdelay << 2) | (spifsssetup << 0));
-}
-
-__INLINE void spif_setup_unpack(uint8_t* spif3wire, uint8_t* spifmode, uint8_t* spifsckfreq, uint8_t* spifmisophase, uint8_t* spifsckphase, uint8_t* spifsckpol, uint8_t* spifsdoinactivest, uint8_t* spifssdelay, uint8_t* spifsssetup)
-{
-    uint32_t localVal = sim_reg_spif_rd(SPIF_SETUP_INDEX);
-
-    *spif3wire = (localVal & 0x00020000) >> 17;
-    *spifmode = (localVal & 0x00010000) >> 16;
-    *spifsckfreq = (localVal & 0x00007000) >> 12;
-    *spifmisophase = (localVal & 0x00000400) >> 10;
-    *spifsckphase = (localVal & 0x00000200) >> 9;
-    *spifsckpol = (localVal & 0x00000100) >> 8;
-    *spifsdoinactivest = (localVal & 0x00000030) >> 4;
-    *spifssdelay = (localVal & 0x0000000C) >> 2;
-    *spifsssetup = (localVal & 0x00000003) >> 0;
-}
-
-__INLINE uint8_t spif_3wire_getf(void)
-{
-    uint32_t localVal = sim_reg_spif_rd(SPIF_SETUP_INDEX);
-    return ((localVal & 0x00020000) >> 17);
-}
-
-__INLINE void spif_3wire_setf(uint8_t spif3wire)
-{
-    ASSERT_ERR(((spif3wire << 17) & ~0x00020000) == 0);
-    sim_reg_spif_wr(SPIF_SETUP_INDEX, (sim_reg_spif_rd(SPIF_SETUP_INDEX) & ~0x00020000) | (spif3wire << 17));
-}
-
-__INLINE uint8_t spif_mode_getf(void)
-{
-    uint32_t localVal = sim_reg_spif_rd(SPIF_SETUP_INDEX);
-    return ((localVal & 0x00010000) >> 16);
-}
-
-__INLINE void spif_mode_setf(uint8_t spifmode)
-{
-    ASSERT_ERR(((spifmode << 16) & ~0x00010000) == 0);
-    sim_reg_spif_wr(SPIF_SETUP_INDEX, (sim_reg_spif_rd(SPIF_SETUP_INDEX) & ~0x00010000) | (spifmode << 16));
-}
-
-__INLINE uint8_t spif_sck_freq_getf(void)
-{
-    uint32_t localVal = sim_reg_spif_rd(SPIF_SETUP_INDEX);
-    return ((localVal & 0x00007000) >> 12);
-}
-
-__INLINE void spif_sck_freq_setf(uint8_t spifsckfreq)
-{
-    ASSERT_ERR(((spifsckfreq << 12) & ~0x00007000) == 0);
-    sim_reg_spif_wr(SPIF_SETUP_INDEX, (sim_reg_spif_rd(SPIF_SETUP_INDEX) & ~0x00007000) | (spifsckfreq << 12));
-}
-
-__INLINE uint8_t spif_miso_phase_getf(void)
-{
-    uint32_t localVal = sim_reg_spif_rd(SPIF_SETUP_INDEX);
-    return ((localVal & 0x00000400) >> 10);
-}
-
-__INLINE void spif_miso_phase_setf(uint8_t spifmisophase)
-{
-    ASSERT_ERR(((spifmisophase << 10) & ~0x00000400) == 0);
-    sim_reg_spif_wr(SPIF_SETUP_INDEX, (sim_reg_spif_rd(SPIF_SETUP_INDEX) & ~0x00000400) | (spifmisophase << 10));
-}
-
-__INLINE uint8_t spif_sck_phase_getf(void)
-{
-    uint32_t localVal = sim_reg_spif_rd(SPIF_SETUP_INDEX);
-    return ((localVal & 0x00000200) >> 9);
-}
-
-__INLINE void spif_sck_phase_setf(uint8_t spifsckphase)
-{
-    ASSERT_ERR(((spifsckphase << 9) & ~0x00000200) == 0);
-    sim_reg_spif_wr(SPIF_SETUP_INDEX, (sim_reg_spif_rd(SPIF_SETUP_INDEX) & ~0x00000200) | (spifsckphase << 9));
-}
-
-__INLINE uint8_t spif_sck_pol_getf(void)
-{
-    uint32_t localVal = sim_reg_spif_rd(SPIF_SETUP_INDEX);
-    return ((localVal & 0x00000100) >> 8);
-}
-
-__INLINE void spif_sck_pol_setf(uint8_t spifsckpol)
-{
-    ASSERT_ERR(((spifsckpol << 8) & ~0x00000100) == 0);
-    sim_reg_spif_wr(SPIF_SETUP_INDEX, (sim_reg_spif_rd(SPIF_SETUP_INDEX) & ~0x00000100) | (spifsckpol << 8));
-}
-
-__INLINE uint8_t spif_sdo_inactive_st_getf(void)
-{
-    uint32_t localVal = sim_reg_spif_rd(SPIF_SETUP_INDEX);
-    return ((localVal & 0x00000030) >> 4);
-}
-
-__INLINE void spif_sdo_inactive_st_setf(uint8_t spifsdoinactivest)
-{
-    ASSERT_ERR(((spifsdoinactivest << 4) & ~0x00000030) == 0);
-    sim_reg_spif_wr(SPIF_SETUP_INDEX, (sim_reg_spif_rd(SPIF_SETUP_INDEX) & ~0x00000030) | (spifsdoinactivest << 4));
-}
-
-__INLINE uint8_t spif_ss_delay_getf(void)
-{
-    uint32_t localVal = sim_reg_spif_rd(SPIF_SETUP_INDEX);
-    return ((localVal & 0x0000000C) >> 2);
-}
-
-__INLINE void spif_ss_delay_setf(uint8_t spifssdelay)
-{
-    ASSERT_ERR(((spifssdelay << 2) & ~0x0000000C) == 0);
-    sim_reg_spif_wr(SPIF_SETUP_INDEX, (sim_reg_spif_rd(SPIF_SETUP_INDEX) & ~0x0000000C) | (spifssdelay << 2));
-}
-
-__INLINE uint8_t spif_ss_setup_getf(void)
-{
-    uint32_t localVal = sim_reg_spif_rd(SPIF_SETUP_INDEX);
-    return ((localVal & 0x00000003) >> 0);
-}
-
-__INLINE void spif_ss_setup_setf(uint8_t spifsssetup)
-{
-    ASSERT_ERR(((spifsssetup << 0) & ~0x00000003) == 0);
-    sim_reg_spif_wr(SPIF_SETUP_INDEX, (sim_reg_spif_rd(SPIF_SETUP_INDEX) & ~0x00000003) | (spifsssetup << 0));
-}
-
 /**
  * @brief SPIF_STATUS register definition
  * <pre>
@@ -386,16 +136,6 @@ __INLINE void spif_ss_setup_setf(uint8_t spifsssetup)
  */
 #define SPIF_STATUS_INDEX  0x00000004
 
-__INLINE uint32_t spif_status_get(void)
-{
-    return sim_reg_spif_rd(SPIF_STATUS_INDEX);
-}
-
-__INLINE void spif_status_set(uint32_t value)
-{
-    sim_reg_spif_wr(SPIF_STATUS_INDEX, value);
-}
-
 // field definitions
 #define SPIF_FIRST_DATA_BIT    0x00000100
 #define SPIF_FIRST_DATA_POS    8
@@ -408,52 +148,517 @@ __INLINE void spif_status_set(uint32_t value)
 #define SPIF_OVERFLOW_RST      0x0
 #define SPIF_INT_RST           0x0
 
-__INLINE void spif_status_pack(uint8_t spifoverflow, uint8_t spifint)
-{
-    ASSERT_ERR(((spifoverflow << 4) & ~0x00000010) == 0);
-    ASSERT_ERR(((spifint << 0) & ~0x00000001) == 0);
-    sim_reg_spif_wr(SPIF_STATUS_INDEX,  (spifoverflow << 4) | (spifint << 0));
-}
-
-__INLINE void spif_status_unpack(uint8_t* spiffirstdata, uint8_t* spifoverflow, uint8_t* spifint)
-{
-    uint32_t localVal = sim_reg_spif_rd(SPIF_STATUS_INDEX);
-
-    *spiffirstdata = (localVal & 0x00000100) >> 8;
-    *spifoverflow = (localVal & 0x00000010) >> 4;
-    *spifint = (localVal & 0x00000001) >> 0;
-}
-
-__INLINE uint8_t spif_first_data_getf(void)
-{
-    uint32_t localVal = sim_reg_spif_rd(SPIF_STATUS_INDEX);
-    return ((localVal & 0x00000100) >> 8);
-}
-
-__INLINE uint8_t spif_overflow_getf(void)
-{
-    uint32_t localVal = sim_reg_spif_rd(SPIF_STATUS_INDEX);
-    return ((localVal & 0x00000010) >> 4);
-}
-
-__INLINE void spif_overflow_setf(uint8_t spifoverflow)
-{
-    ASSERT_ERR(((spifoverflow << 4) & ~0x00000010) == 0);
-    sim_reg_spif_wr(SPIF_STATUS_INDEX, (sim_reg_spif_rd(SPIF_STATUS_INDEX) & ~0x00000010) | (spifoverflow << 4));
-}
-
-__INLINE uint8_t spif_int_getf(void)
-{
-    uint32_t localVal = sim_reg_spif_rd(SPIF_STATUS_INDEX);
-    return ((localVal & 0x00000001) >> 0);
-}
-
-__INLINE void spif_int_setf(uint8_t spifint)
-{
-    ASSERT_ERR(((spifint << 0) & ~0x00000001) == 0);
-    sim_reg_spif_wr(SPIF_STATUS_INDEX, (sim_reg_spif_rd(SPIF_STATUS_INDEX) & ~0x00000001) | (spifint << 0));
-}
-
+/**
+ * @brief Register map of the REG_SPIF block, to be derived by the block model
+ *
+ * The register accesses are dispatched at compile time to the register hooks
+ * {regname}_rd() and {regname}_wr(value) of the model, which only redefines the
+ * hooks of the registers having side effects.
+ * @param MODEL Block model deriving from this class
+ */
+template <typename MODEL>
+struct RegSpif : Peripheral<REG_SPIF_COUNT>
+{
+    /** Constructor
+     * @param[in] name Name of the module
+     */
+    RegSpif(sc_core::sc_module_name name)
+    : Peripheral<REG_SPIF_COUNT>(name)
+    {
+        this->set_reg_names(&reg_name);
+    }
+
+    /** Name of a register
+     * @param[in] index Index of the register
+     * @return The name of the register, NULL if there is no register at this index
+     */
+    static const char*
+    reg_name(uint32_t index)
+    {
+        static const char* const names[REG_SPIF_COUNT] =
+        {
+            "SPIF_TX_DATA",
+            "SPIF_RX_DATA",
+            "SPIF_CLK_CTRL",
+            "SPIF_SETUP",
+            "SPIF_STATUS",
+        };
+
+        return (index < REG_SPIF_COUNT) ? names[index] : NULL;
+    }
+
+    uint32_t spif_tx_data_get(void)
+    {
+        return this->m_reg[SPIF_TX_DATA_INDEX];
+    }
+
+    void spif_tx_data_set(uint32_t value)
+    {
+        this->m_reg[SPIF_TX_DATA_INDEX] = value;
+    }
+
+    typedef RegField<SPIF_TX_DATA_INDEX, 0xFFFFFFFF, 0> spif_tx_data_field;
+
+    uint32_t spif_tx_data_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPIF_TX_DATA_INDEX];
+        ASSERT_ERR((localVal & ~0xFFFFFFFF) == 0);
+        return (localVal >> 0);
+    }
+
+    void spif_tx_data_setf(uint32_t spiftxdata)
+    {
+        ASSERT_ERR(((spiftxdata << 0) & ~0xFFFFFFFF) == 0);
+        this->m_reg[SPIF_TX_DATA_INDEX] = spiftxdata << 0;
+    }
+
+    uint32_t spif_rx_data_get(void)
+    {
+        return this->m_reg[SPIF_RX_DATA_INDEX];
+    }
+
+    void spif_rx_data_set(uint32_t value)
+    {
+        this->m_reg[SPIF_RX_DATA_INDEX] = value;
+    }
+
+    typedef RegField<SPIF_RX_DATA_INDEX, 0xFFFFFFFF, 0> spif_rx_data_field;
+
+    uint32_t spif_rx_data_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPIF_RX_DATA_INDEX];
+        ASSERT_ERR((localVal & ~0xFFFFFFFF) == 0);
+        return (localVal >> 0);
+    }
+
+    uint32_t spif_clk_ctrl_get(void)
+    {
+        return this->m_reg[SPIF_CLK_CTRL_INDEX];
+    }
+
+    void spif_clk_ctrl_set(uint32_t value)
+    {
+        this->m_reg[SPIF_CLK_CTRL_INDEX] = value;
+    }
+
+    typedef RegField<SPIF_CLK_CTRL_INDEX, 0x0000FF00, 8> spif_sck_count_field;
+    typedef RegField<SPIF_CLK_CTRL_INDEX, 0x00000080, 7> spif_start_field;
+    typedef RegField<SPIF_CLK_CTRL_INDEX, 0x0000007F, 0> spif_data_length_field;
+
+    void spif_clk_ctrl_pack(uint8_t spifsckcount, uint8_t spifstart, uint8_t spifdatalength)
+    {
+        ASSERT_ERR(((spifsckcount << 8) & ~0x0000FF00) == 0);
+        ASSERT_ERR(((spifstart << 7) & ~0x00000080) == 0);
+        ASSERT_ERR(((spifdatalength << 0) & ~0x0000007F) == 0);
+        this->m_reg[SPIF_CLK_CTRL_INDEX] =  (spifsckcount << 8) | (spifstart << 7) | (spifdatalength << 0);
+    }
+
+    void spif_clk_ctrl_unpack(uint8_t* spifsckcount, uint8_t* spifstart, uint8_t* spifdatalength)
+    {
+        uint32_t localVal = this->m_reg[SPIF_CLK_CTRL_INDEX];
+
+        *spifsckcount = (localVal & 0x0000FF00) >> 8;
+        *spifstart = (localVal & 0x00000080) >> 7;
+        *spifdatalength = (localVal & 0x0000007F) >> 0;
+    }
+
+    uint8_t spif_sck_count_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPIF_CLK_CTRL_INDEX];
+        return ((localVal & 0x0000FF00) >> 8);
+    }
+
+    void spif_sck_count_setf(uint8_t spifsckcount)
+    {
+        ASSERT_ERR(((spifsckcount << 8) & ~0x0000FF00) == 0);
+        this->m_reg[SPIF_CLK_CTRL_INDEX] = (this->m_reg[SPIF_CLK_CTRL_INDEX] & ~0x0000FF00) | (spifsckcount << 8);
+    }
+
+    uint8_t spif_start_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPIF_CLK_CTRL_INDEX];
+        return ((localVal & 0x00000080) >> 7);
+    }
+
+    void spif_start_setf(uint8_t spifstart)
+    {
+        ASSERT_ERR(((spifstart << 7) & ~0x00000080) == 0);
+        this->m_reg[SPIF_CLK_CTRL_INDEX] = (this->m_reg[SPIF_CLK_CTRL_INDEX] & ~0x00000080) | (spifstart << 7);
+    }
+
+    uint8_t spif_data_length_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPIF_CLK_CTRL_INDEX];
+        return ((localVal & 0x0000007F) >> 0);
+    }
+
+    void spif_data_length_setf(uint8_t spifdatalength)
+    {
+        ASSERT_ERR(((spifdatalength << 0) & ~0x0000007F) == 0);
+        this->m_reg[SPIF_CLK_CTRL_INDEX] = (this->m_reg[SPIF_CLK_CTRL_INDEX] & ~0x0000007F) | (spifdatalength << 0);
+    }
+
+    uint32_t spif_setup_get(void)
+    {
+        return this->m_reg[SPIF_SETUP_INDEX];
+    }
+
+    void spif_setup_set(uint32_t value)
+    {
+        this->m_reg[SPIF_SETUP_INDEX] = value;
+    }
+
+    typedef RegField<SPIF_SETUP_INDEX, 0x00020000, 17> spif_3wire_field;
+    typedef RegField<SPIF_SETUP_INDEX, 0x00010000, 16> spif_mode_field;
+    typedef RegField<SPIF_SETUP_INDEX, 0x00007000, 12> spif_sck_freq_field;
+    typedef RegField<SPIF_SETUP_INDEX, 0x00000400, 10> spif_miso_phase_field;
+    typedef RegField<SPIF_SETUP_INDEX, 0x00000200, 9> spif_sck_phase_field;
+    typedef RegField<SPIF_SETUP_INDEX, 0x00000100, 8> spif_sck_pol_field;
+    typedef RegField<SPIF_SETUP_INDEX, 0x00000030, 4> spif_sdo_inactive_st_field;
+    typedef RegField<SPIF_SETUP_INDEX, 0x0000000C, 2> spif_ss_delay_field;
+    typedef RegField<SPIF_SETUP_INDEX, 0x00000003, 0> spif_ss_setup_field;
+
+    void spif_setup_pack(uint8_t spif3wire, uint8_t spifmode, uint8_t spifsckfreq, uint8_t spifmisophase, uint8_t spifsckphase, uint8_t spifsckpol, uint8_t spifsdoinactivest, uint8_t spifssdelay, uint8_t spifsssetup)
+    {
+        ASSERT_ERR(((spif3wire << 17) & ~0x00020000) == 0);
+        ASSERT_ERR(((spifmode << 16) & ~0x00010000) == 0);
+        ASSERT_ERR(((spifsckfreq << 12) & ~0x00007000) == 0);
+        ASSERT_ERR(((spifmisophase << 10) & ~0x00000400) == 0);
+        ASSERT_ERR(((spifsckphase << 9) & ~0x00000200) == 0);
+        ASSERT_ERR(((spifsckpol << 8) & ~0x00000100) == 0);
+        ASSERT_ERR(((spifsdoinactivest << 4) & ~0x00000030) == 0);
+        ASSERT_ERR(((spifssdelay << 2) & ~0x0000000C) == 0);
+        ASSERT_ERR(((spifsssetup << 0) & ~0x00000003) == 0);
+        this->m_reg[SPIF_SETUP_INDEX] =  (spif3wire << 17) | (spifmode << 16) | (spifsckfreq << 12) | (spifmisophase << 10) | (spifsckphase << 9) | (spifsckpol << 8) | (spifsdoinactivest << 4) | (spifssdelay << 2) | (spifsssetup << 0);
+    }
+
+    void spif_setup_unpack(uint8_t* spif3wire, uint8_t* spifmode, uint8_t* spifsckfreq, uint8_t* spifmisophase, uint8_t* spifsckphase, uint8_t* spifsckpol, uint8_t* spifsdoinactivest, uint8_t* spifssdelay, uint8_t* spifsssetup)
+    {
+        uint32_t localVal = this->m_reg[SPIF_SETUP_INDEX];
+
+        *spif3wire = (localVal & 0x00020000) >> 17;
+        *spifmode = (localVal & 0x00010000) >> 16;
+        *spifsckfreq = (localVal & 0x00007000) >> 12;
+        *spifmisophase = (localVal & 0x00000400) >> 10;
+        *spifsckphase = (localVal & 0x00000200) >> 9;
+        *spifsckpol = (localVal & 0x00000100) >> 8;
+        *spifsdoinactivest = (localVal & 0x00000030) >> 4;
+        *spifssdelay = (localVal & 0x0000000C) >> 2;
+        *spifsssetup = (localVal & 0x00000003) >> 0;
+    }
+
+    uint8_t spif_3wire_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPIF_SETUP_INDEX];
+        return ((localVal & 0x00020000) >> 17);
+    }
+
+    void spif_3wire_setf(uint8_t spif3wire)
+    {
+        ASSERT_ERR(((spif3wire << 17) & ~0x00020000) == 0);
+        this->m_reg[SPIF_SETUP_INDEX] = (this->m_reg[SPIF_SETUP_INDEX] & ~0x00020000) | (spif3wire << 17);
+    }
+
+    uint8_t spif_mode_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPIF_SETUP_INDEX];
+        return ((localVal & 0x00010000) >> 16);
+    }
+
+    void spif_mode_setf(uint8_t spifmode)
+    {
+        ASSERT_ERR(((spifmode << 16) & ~0x00010000) == 0);
+        this->m_reg[SPIF_SETUP_INDEX] = (this->m_reg[SPIF_SETUP_INDEX] & ~0x00010000) | (spifmode << 16);
+    }
+
+    uint8_t spif_sck_freq_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPIF_SETUP_INDEX];
+        return ((localVal & 0x00007000) >> 12);
+    }
+
+    void spif_sck_freq_setf(uint8_t spifsckfreq)
+    {
+        ASSERT_ERR(((spifsckfreq << 12) & ~0x00007000) == 0);
+        this->m_reg[SPIF_SETUP_INDEX] = (this->m_reg[SPIF_SETUP_INDEX] & ~0x00007000) | (spifsckfreq << 12);
+    }
+
+    uint8_t spif_miso_phase_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPIF_SETUP_INDEX];
+        return ((localVal & 0x00000400) >> 10);
+    }
+
+    void spif_miso_phase_setf(uint8_t spifmisophase)
+    {
+        ASSERT_ERR(((spifmisophase << 10) & ~0x00000400) == 0);
+        this->m_reg[SPIF_SETUP_INDEX] = (this->m_reg[SPIF_SETUP_INDEX] & ~0x00000400) | (spifmisophase << 10);
+    }
+
+    uint8_t spif_sck_phase_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPIF_SETUP_INDEX];
+        return ((localVal & 0x00000200) >> 9);
+    }
+
+    void spif_sck_phase_setf(uint8_t spifsckphase)
+    {
+        ASSERT_ERR(((spifsckphase << 9) & ~0x00000200) == 0);
+        this->m_reg[SPIF_SETUP_INDEX] = (this->m_reg[SPIF_SETUP_INDEX] & ~0x00000200) | (spifsckphase << 9);
+    }
+
+    uint8_t spif_sck_pol_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPIF_SETUP_INDEX];
+        return ((localVal & 0x00000100) >> 8);
+    }
+
+    void spif_sck_pol_setf(uint8_t spifsckpol)
+    {
+        ASSERT_ERR(((spifsckpol << 8) & ~0x00000100) == 0);
+        this->m_reg[SPIF_SETUP_INDEX] = (this->m_reg[SPIF_SETUP_INDEX] & ~0x00000100) | (spifsckpol << 8);
+    }
+
+    uint8_t spif_sdo_inactive_st_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPIF_SETUP_INDEX];
+        return ((localVal & 0x00000030) >> 4);
+    }
+
+    void spif_sdo_inactive_st_setf(uint8_t spifsdoinactivest)
+    {
+        ASSERT_ERR(((spifsdoinactivest << 4) & ~0x00000030) == 0);
+        this->m_reg[SPIF_SETUP_INDEX] = (this->m_reg[SPIF_SETUP_INDEX] & ~0x00000030) | (spifsdoinactivest << 4);
+    }
+
+    uint8_t spif_ss_delay_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPIF_SETUP_INDEX];
+        return ((localVal & 0x0000000C) >> 2);
+    }
+
+    void spif_ss_delay_setf(uint8_t spifssdelay)
+    {
+        ASSERT_ERR(((spifssdelay << 2) & ~0x0000000C) == 0);
+        this->m_reg[SPIF_SETUP_INDEX] = (this->m_reg[SPIF_SETUP_INDEX] & ~0x0000000C) | (spifssdelay << 2);
+    }
+
+    uint8_t spif_ss_setup_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPIF_SETUP_INDEX];
+        return ((localVal & 0x00000003) >> 0);
+    }
+
+    void spif_ss_setup_setf(uint8_t spifsssetup)
+    {
+        ASSERT_ERR(((spifsssetup << 0) & ~0x00000003) == 0);
+        this->m_reg[SPIF_SETUP_INDEX] = (this->m_reg[SPIF_SETUP_INDEX] & ~0x00000003) | (spifsssetup << 0);
+    }
+
+    uint32_t spif_status_get(void)
+    {
+        return this->m_reg[SPIF_STATUS_INDEX];
+    }
+
+    void spif_status_set(uint32_t value)
+    {
+        this->m_reg[SPIF_STATUS_INDEX] = value;
+    }
+
+    typedef RegField<SPIF_STATUS_INDEX, 0x00000100, 8> spif_first_data_field;
+    typedef RegField<SPIF_STATUS_INDEX, 0x00000010, 4> spif_overflow_field;
+    typedef RegField<SPIF_STATUS_INDEX, 0x00000001, 0> spif_int_field;
+
+    void spif_status_pack(uint8_t spifoverflow, uint8_t spifint)
+    {
+        ASSERT_ERR(((spifoverflow << 4) & ~0x00000010) == 0);
+        ASSERT_ERR(((spifint << 0) & ~0x00000001) == 0);
+        this->m_reg[SPIF_STATUS_INDEX] =  (spifoverflow << 4) | (spifint << 0);
+    }
+
+    void spif_status_unpack(uint8_t* spiffirstdata, uint8_t* spifoverflow, uint8_t* spifint)
+    {
+        uint32_t localVal = this->m_reg[SPIF_STATUS_INDEX];
+
+        *spiffirstdata = (localVal & 0x00000100) >> 8;
+        *spifoverflow = (localVal & 0x00000010) >> 4;
+        *spifint = (localVal & 0x00000001) >> 0;
+    }
+
+    uint8_t spif_first_data_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPIF_STATUS_INDEX];
+        return ((localVal & 0x00000100) >> 8);
+    }
+
+    uint8_t spif_overflow_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPIF_STATUS_INDEX];
+        return ((localVal & 0x00000010) >> 4);
+    }
+
+    void spif_overflow_setf(uint8_t spifoverflow)
+    {
+        ASSERT_ERR(((spifoverflow << 4) & ~0x00000010) == 0);
+        this->m_reg[SPIF_STATUS_INDEX] = (this->m_reg[SPIF_STATUS_INDEX] & ~0x00000010) | (spifoverflow << 4);
+    }
+
+    uint8_t spif_int_getf(void)
+    {
+        uint32_t localVal = this->m_reg[SPIF_STATUS_INDEX];
+        return ((localVal & 0x00000001) >> 0);
+    }
+
+    void spif_int_setf(uint8_t spifint)
+    {
+        ASSERT_ERR(((spifint << 0) & ~0x00000001) == 0);
+        this->m_reg[SPIF_STATUS_INDEX] = (this->m_reg[SPIF_STATUS_INDEX] & ~0x00000001) | (spifint << 0);
+    }
+
+
+protected:
+    /// SPIF_TX_DATA register read hook
+    uint32_t
+    spif_tx_data_rd()
+    {
+        return this->m_reg[SPIF_TX_DATA_INDEX];
+    }
+
+    /// SPIF_TX_DATA register write hook
+    void
+    spif_tx_data_wr(uint32_t value)
+    {
+        this->m_reg[SPIF_TX_DATA_INDEX] = value;
+    }
+
+    /// SPIF_RX_DATA register read hook
+    uint32_t
+    spif_rx_data_rd()
+    {
+        return this->m_reg[SPIF_RX_DATA_INDEX];
+    }
+
+    /// SPIF_RX_DATA register write hook
+    void
+    spif_rx_data_wr(uint32_t value)
+    {
+        TLM_ERR("Write to R/O register SPIF_RX_DATA, data = 0x%08X", value);
+    }
+
+    /// SPIF_CLK_CTRL register read hook
+    uint32_t
+    spif_clk_ctrl_rd()
+    {
+        return this->m_reg[SPIF_CLK_CTRL_INDEX];
+    }
+
+    /// SPIF_CLK_CTRL register write hook
+    void
+    spif_clk_ctrl_wr(uint32_t value)
+    {
+        this->m_reg[SPIF_CLK_CTRL_INDEX] = value;
+    }
+
+    /// SPIF_SETUP register read hook
+    uint32_t
+    spif_setup_rd()
+    {
+        return this->m_reg[SPIF_SETUP_INDEX];
+    }
+
+    /// SPIF_SETUP register write hook
+    void
+    spif_setup_wr(uint32_t value)
+    {
+        this->m_reg[SPIF_SETUP_INDEX] = value;
+    }
+
+    /// SPIF_STATUS register read hook
+    uint32_t
+    spif_status_rd()
+    {
+        return this->m_reg[SPIF_STATUS_INDEX];
+    }
+
+    /// SPIF_STATUS register write hook
+    void
+    spif_status_wr(uint32_t value)
+    {
+        this->m_reg[SPIF_STATUS_INDEX] = value;
+    }
+
+    /** Register read function, dispatched to the register hooks of the model
+     * @param[in] offset Offset of the register to access
+     * @return The value read
+     */
+    virtual uint32_t
+    reg_rd(uint32_t offset)
+    {
+        MODEL* model = static_cast<MODEL*>(this);
+        uint32_t index = offset/4;
+
+        // sanity check
+        assert(index < REG_SPIF_COUNT);
+
+        // internal delay
+        this->delay();
+
+        switch (index)
+        {
+        case SPIF_TX_DATA_INDEX:
+            return model->spif_tx_data_rd();
+        case SPIF_RX_DATA_INDEX:
+            return model->spif_rx_data_rd();
+        case SPIF_CLK_CTRL_INDEX:
+            return model->spif_clk_ctrl_rd();
+        case SPIF_SETUP_INDEX:
+            return model->spif_setup_rd();
+        case SPIF_STATUS_INDEX:
+            return model->spif_status_rd();
+        default:
+            return this->m_reg[index];
+        }
+    }
+
+    /** Register write function, dispatched to the register hooks of the model
+     * @param[in] offset Offset of the register to access
+     * @param[in] value Value to write in the register
+     */
+    virtual void
+    reg_wr(uint32_t offset, uint32_t value)
+    {
+        MODEL* model = static_cast<MODEL*>(this);
+        uint32_t index = offset/4;
+
+        // sanity check
+        assert(index < REG_SPIF_COUNT);
+
+        // internal delay
+        this->delay();
+
+        switch (index)
+        {
+        case SPIF_TX_DATA_INDEX:
+            model->spif_tx_data_wr(value);
+            break;
+        case SPIF_RX_DATA_INDEX:
+            model->spif_rx_data_wr(value);
+            break;
+        case SPIF_CLK_CTRL_INDEX:
+            model->spif_clk_ctrl_wr(value);
+            break;
+        case SPIF_SETUP_INDEX:
+            model->spif_setup_wr(value);
+            break;
+        case SPIF_STATUS_INDEX:
+            model->spif_status_wr(value);
+            break;
+        default:
+            this->m_reg[index] = value;
+            break;
+        }
+    }
+};
 
 #endif // _REG_SPIF_H_
 
@@ -4,7 +4,7 @@
 /// debug level
 #define UART_DEBUG_LEVEL 0
 
-/// Macro to print debug messages
+/// Macro to print debug messages (the levels above UART_DEBUG_LEVEL go to the runtime trace)
 /// @param __l level of debug message (0 means always printed)
 /// @param __f format of the debug string
 /// @param ... variable arguments
@@ -12,33 +12,24 @@
     do {                                                                                \
         if (UART_DEBUG_LEVEL >= __l) {                                                  \
             TLM_DBG(__f, ##__VA_ARGS__);                                                \
+        } else {                                                                        \
+            TLM_TRACE(__l, __f, ##__VA_ARGS__);                                         \
         }                                                                               \
     } while (false)
 
 // using this namespace to simplify streaming
 using namespace std;
 
-char const*const uart_regnames[] =
-{
-    "UCON",
-    "USTAT",
-    "UDATA",
-    "URxCON",
-    "UTxCON",
-    "UCTS",
-    "UBR"
-};
-
 void
 Uart::thread_tx(void)
 {
     while (true)
     {
-        uint32_t timeout;
-        uint8_t c;
+        uint8_t c[UART_FIFO_SIZE];
+        uint32_t count;
 
         // wait for the TX event
-        sc_core::wait(m_tx.event);
+        TIMELINE_WAIT(m_tx.event);
 
         // sanity check: there must be elements to send
         assert(m_tx.fifo.size() != 0);
@@ -47,30 +38,49 @@ Uart::thread_tx(void)
         if (m_reg[UCON_INDEX] & TX_OEN_B_BIT)
             UART_TLM_DBG(0, "WARNING: character TX'd but TXD wire output disabled");
 
-        // pop the first element from the queue
-        c = m_tx.fifo.front();
-        m_tx.fifo.pop();
-
         if ((m_reg[UBR_INDEX] & UBRMOD_MASK) == 0)
             TLM_ERR("MOD=0, invalid UBR=0x%08X", m_reg[UBR_INDEX]);
 
-        // wait for the time to TX the char over the wire
-        if (m_reg[UCON_INDEX] & XTIM_BIT)
-            timeout = (1000 * ((m_reg[UBR_INDEX] & UBRMOD_MASK) >> UBRMOD_LSB))/(3 * (((m_reg[UBR_INDEX] & UBRINC_MASK) >> UBRINC_LSB)+1));
-        else
-            timeout = (2000 * ((m_reg[UBR_INDEX] & UBRMOD_MASK) >> UBRMOD_LSB))/(3 * (((m_reg[UBR_INDEX] & UBRINC_MASK) >> UBRINC_LSB)+1));
+        // take the first element from the queue (the whole FIFO in fast mode)
+        count = (m_timing == UART_TIMING_WIRE) ? 1 : m_tx.fifo.size();
+        for (uint32_t i = 0; i < count; i++)
+            c[i] = m_tx.fifo[i];
 
-        sc_core::wait(timeout, sc_core::SC_NS);
+        // send them to the host (buffered, written by the host thread) or the other platform:
+        // the bytes the host cannot take yet stay in the FIFO, so the firmware sees the level
+        if (m_host != NULL)
+        {
+            while ((count = m_host->write(c, count)) == 0)
+            {
+                // the output ring is full: retry after the time of a character
+                TIMELINE_WAIT(this->char_time(), sc_core::SC_NS);
+            }
+        }
+        else if (m_link != NULL)
+            m_link->write(c, count);
 
-        // print character sent
-        UART_TLM_DBG(0, "TX (%c)", c);
+        // print characters sent
+        for (uint32_t i = 0; i < count; i++)
+            UART_TLM_DBG(2, "TX (%c)", c[i]);
+
+        // the first one leaves the FIFO for the shift register, the others of the chunk
+        // are still counted in the FIFO level until they are sent
+        m_tx.fifo.pop_front();
+        this->check_int();
+
+        // wait for the time to TX the chars over the wire
+        if (m_timing != UART_TIMING_ZERO)
+            TIMELINE_WAIT(count * this->char_time(), sc_core::SC_NS);
+
+        // the rest of the chunk leaves the FIFO
+        m_tx.fifo.erase(m_tx.fifo.begin(), m_tx.fifo.begin() + (count - 1));
 
         // check the interrupt status
         this->check_int();
 
         // check if there are more bytes to send and if TX is enabled
         if (m_tx.fifo.size() && (m_reg[UCON_INDEX] & TXE_BIT))
-            m_tx.event.notify(sc_core::SC_ZERO_TIME);
+            TIMELINE_NOTIFY(m_tx.event, sc_core::SC_ZERO_TIME);
     }
 }
 
@@ -79,8 +89,9 @@ Uart::thread_rx(void)
 {
     while (true)
     {
-        uint32_t timeout;
         uint8_t *c;
+        uint8_t host[UART_FIFO_SIZE];
+        uint32_t count;
 
         // check if there are pending chars
         c = m_rx_eq.get_next_transaction();
@@ -91,15 +102,10 @@ Uart::thread_rx(void)
             if (m_reg[UCON_INDEX] & RXE_BIT)
             {
                 // wait for the time to RX the char over the wire
-                if (m_reg[UCON_INDEX] & XTIM_BIT)
-                    timeout = (1000 * ((m_reg[UBR_INDEX] & UBRMOD_MASK) >> UBRMOD_LSB))/(3 * (((m_reg[UBR_INDEX] & UBRINC_MASK) >> UBRINC_LSB)+1));
-                else
-                    timeout = (2000 * ((m_reg[UBR_INDEX] & UBRMOD_MASK) >> UBRMOD_LSB))/(3 * (((m_reg[UBR_INDEX] & UBRINC_MASK) >> UBRINC_LSB)+1));
-
-                sc_core::wait(timeout, sc_core::SC_NS);
+                TIMELINE_WAIT(this->char_time(), sc_core::SC_NS);
 
                 // print character received
-                UART_TLM_DBG(0, "RX (%c)", *c);
+                UART_TLM_DBG(2, "RX (%c)", *c);
 
                 // add the character to the reception FIFO
                 m_rx.fifo.push(*c);
@@ -114,171 +120,218 @@ Uart::thread_rx(void)
 
             free(c);
         }
+        else if ((m_host == NULL) && (m_link == NULL))
+        {
+            TIMELINE_WAIT(m_rx_eq.get_event());
+        }
+        else if ((m_reg[UCON_INDEX] & RXE_BIT) && (m_rx.fifo.size() < UART_FIFO_SIZE) &&
+                 ((count = this->line_read(host, (m_timing == UART_TIMING_WIRE) ? 1 :
+                                           UART_FIFO_SIZE - m_rx.fifo.size())) != 0))
+        {
+            // characters from the host (kept by the host while the RX FIFO is full), one
+            // at a time or up to the free space of the FIFO in fast mode
+            if (m_timing != UART_TIMING_ZERO)
+                TIMELINE_WAIT(count * this->char_time(), sc_core::SC_NS);
+
+            for (uint32_t i = 0; i < count; i++)
+            {
+                UART_TLM_DBG(2, "RX (%c)", host[i]);
+                m_rx.fifo.push(host[i]);
+            }
+            this->check_int();
+        }
         else
         {
-            sc_core::wait(m_rx_eq.get_event());
+            // nothing from the host: poll it again later
+            TIMELINE_WAIT(UART_HOST_POLL_NS, sc_core::SC_NS, m_rx_eq.get_event());
         }
     }
 }
 
 uint32_t
-Uart::reg_rd(uint32_t offset)
+Uart::udata_rd()
 {
     uint32_t result;
-    // retrieve the required parameters
-    uint32_t index = offset/4;
 
-    // sanity check
-    assert(index < REG_UART_COUNT);
-
-    // internal delay
-    this->delay();
-
-    switch (index)
+    if (!m_rx.fifo.empty())
     {
-    case UDATA_INDEX:
-        if (!m_rx.fifo.empty())
-        {
-            result = (uint32_t)m_rx.fifo.front();
-            m_rx.fifo.pop();
-        }
-        else
-        {
-            UART_TLM_DBG(0, "Reading UDATA while RX FIFO empty");
-            result = 0;
-        }
-        break;
-    case URXCON_INDEX:
-        // read the number of used bytes in the RX FIFO
-        result = m_rx.fifo.size();
-        break;
-    case UTXCON_INDEX:
-        // read the number of free bytes in the TX FIFO
-        result = 32-m_tx.fifo.size();
-        break;
-    default:
-        // read the register value
-        result = m_reg[index];
-        break;
+        result = (uint32_t)m_rx.fifo.front();
+        m_rx.fifo.pop();
+    }
+    else
+    {
+        UART_TLM_DBG(0, "Reading UDATA while RX FIFO empty");
+        result = 0;
     }
-
-    UART_TLM_DBG(2, "RD(%s) : 0x%08X", uart_regnames[index], result);
 
     return result;
 }
 
+uint32_t
+Uart::urxcon_rd()
+{
+    // read the number of used bytes in the RX FIFO
+    return m_rx.fifo.size();
+}
+
+uint32_t
+Uart::utxcon_rd()
+{
+    // read the number of free bytes in the TX FIFO
+    return UART_FIFO_SIZE-m_tx.fifo.size();
+}
+
 void
-Uart::reg_wr(uint32_t offset, uint32_t value)
+Uart::ucon_wr(uint32_t value)
 {
     double baudrate;
     uint32_t inc;
     uint32_t mod;
 
-    // retrieve the required parameters
-    uint32_t index = offset/4;
+    m_reg[UCON_INDEX] = value;
 
-    // sanity check
-    assert(index < REG_UART_COUNT);
+    // check TX path
+    if ((value & TXE_BIT) && m_tx.fifo.size())
+        TIMELINE_NOTIFY(m_tx.event);
 
-    // internal delay
-    this->delay();
+    inc = (m_reg[UBR_INDEX] & UBRINC_MASK) >> UBRINC_LSB;
+    mod = (m_reg[UBR_INDEX] & UBRMOD_MASK) >> UBRMOD_LSB;
 
-    UART_TLM_DBG(2, "WR(%s) : 0x%08X", uart_regnames[index], value);
-    switch (index)
+    if (mod != 0)
     {
-    case UCON_INDEX:
-        m_reg[index] = value;
+        // wait for the time to TX the char over the wire
+        if (m_reg[UCON_INDEX] & XTIM_BIT)
+            baudrate = (3000000 * (inc+1)) / mod;
+        else
+            baudrate = (1500000 * (inc+1)) / mod;
 
-        // check TX path
-        if ((value & TXE_BIT) && m_tx.fifo.size())
-            m_tx.event.notify();
+        UART_TLM_DBG(1, "writing UCON(0x%08X): UBR=0x%08X INC=0x%04X MOD=0x%04X -> baudrate=%f",
+                m_reg[UCON_INDEX], m_reg[UBR_INDEX], inc, mod, baudrate);
+    }
+    else
+    {
+        UART_TLM_DBG(1, "writing UCON(0x%08X): UBR=0x%08X MOD=0, baudrate not valid yet",
+                m_reg[UCON_INDEX], m_reg[UBR_INDEX]);
+    }
 
-        inc = (m_reg[UBR_INDEX] & UBRINC_MASK) >> UBRINC_LSB;
-        mod = (m_reg[UBR_INDEX] & UBRMOD_MASK) >> UBRMOD_LSB;
+    // check not supported features
+    if (value & CONTX_BIT)
+        UART_TLM_DBG(0, "Continuous TX feature not implemented 0x%08X", value);
+    if (value & TST_BIT)
+        UART_TLM_DBG(0, "TST feature not supported 0x%08X", value);
 
-        if (mod != 0)
-        {
-            // wait for the time to TX the char over the wire
-            if (m_reg[UCON_INDEX] & XTIM_BIT)
-                baudrate = (3000000 * (inc+1)) / mod;
-            else
-                baudrate = (1500000 * (inc+1)) / mod;
+    // check the interrupt status
+    this->check_int();
+}
 
-            UART_TLM_DBG(1, "writing UCON(0x%08X): UBR=0x%08X INC=0x%04X MOD=0x%04X -> baudrate=%f",
-                    m_reg[UCON_INDEX], m_reg[UBR_INDEX], inc, mod, baudrate);
-        }
-        else
-        {
-            UART_TLM_DBG(1, "writing UCON(0x%08X): UBR=0x%08X MOD=0, baudrate not valid yet",
-                    m_reg[UCON_INDEX], m_reg[UBR_INDEX]);
-        }
+void
+Uart::udata_wr(uint32_t value)
+{
+    if (m_tx.fifo.size() < UART_FIFO_SIZE)
+    {
+        m_tx.fifo.push_back((uint8_t)(value & 0xFF));
 
-        // check not supported features
-        if (value & CONTX_BIT)
-            UART_TLM_DBG(0, "Continuous TX feature not implemented 0x%08X", value);
-        if (value & TST_BIT)
-            UART_TLM_DBG(0, "TST feature not supported 0x%08X", value);
-        break;
-    case USTAT_INDEX:
-        TLM_ERR("Write to UART R/O register 0x%02X, data = 0x%08X", offset, value);
-        break;
-
-    case UDATA_INDEX:
-        if (!m_tx.fifo.size() < 32)
-        {
-            m_tx.fifo.push((uint8_t)(value & 0xFF));
+        // check if TX is enabled
+        if (m_reg[UCON_INDEX] & TXE_BIT)
+            TIMELINE_NOTIFY(m_tx.event);
+    }
+    else
+        UART_TLM_DBG(0, "Pushing UDATA while TX FIFO full");
 
-            // check if TX is enabled
-            if (m_reg[UCON_INDEX] & TXE_BIT)
-                m_tx.event.notify();
-        }
-        else
-            UART_TLM_DBG(0, "Pushing UDATA while TX FIFO full");
-        break;
-    case URXCON_INDEX:
-        // sanity check
-        if (value > 31)
-            TLM_ERR("Write to UART URXCON register 0x%02X, invalid data = 0x%08X", offset, value);
-        m_reg[index] = value;
-        break;
-    case UTXCON_INDEX:
-        // sanity check
-        if (value > 31)
-            TLM_ERR("Write to UART UTXCON register 0x%02X, invalid data = 0x%08X", offset, value);
-        m_reg[index] = value;
-        break;
-    case UBR_INDEX:
-        m_reg[index] = value;
-
-        inc = (m_reg[UBR_INDEX] & UBRINC_MASK) >> UBRINC_LSB;
-        mod = (m_reg[UBR_INDEX] & UBRMOD_MASK) >> UBRMOD_LSB;
-
-        if (mod != 0)
-        {
-            // wait for the time to TX the char over the wire
-            if (m_reg[UCON_INDEX] & XTIM_BIT)
-                baudrate = (3000000 * (inc+1)) / mod;
-            else
-                baudrate = (1500000 * (inc+1)) / mod;
+    // check the interrupt status
+    this->check_int();
+}
 
-            UART_TLM_DBG(1, "writing UBR(0x%08X): UCON=0x%08X INC=0x%04X MOD=0x%04X -> baudrate %f",
-                    m_reg[UBR_INDEX], m_reg[UCON_INDEX], inc, mod, baudrate);
-        }
-        else
-        {
-            TLM_ERR("writing UBR(0x%08X): setting MOD to 0, invalid", m_reg[UBR_INDEX]);
-        }
-        break;
+void
+Uart::urxcon_wr(uint32_t value)
+{
+    // sanity check
+    if (value > 31)
+        TLM_ERR("Write to UART URXCON register 0x%02X, invalid data = 0x%08X", URXCON_INDEX*4, value);
+    m_reg[URXCON_INDEX] = value;
 
-    default:
-        m_reg[index] = value;
-        break;
-    }
+    // check the interrupt status
+    this->check_int();
+}
+
+void
+Uart::utxcon_wr(uint32_t value)
+{
+    // sanity check
+    if (value > 31)
+        TLM_ERR("Write to UART UTXCON register 0x%02X, invalid data = 0x%08X", UTXCON_INDEX*4, value);
+    m_reg[UTXCON_INDEX] = value;
 
     // check the interrupt status
     this->check_int();
 }
 
+void
+Uart::ubr_wr(uint32_t value)
+{
+    double baudrate;
+    uint32_t inc;
+    uint32_t mod;
+
+    m_reg[UBR_INDEX] = value;
+
+    inc = (m_reg[UBR_INDEX] & UBRINC_MASK) >> UBRINC_LSB;
+    mod = (m_reg[UBR_INDEX] & UBRMOD_MASK) >> UBRMOD_LSB;
+
+    if (mod != 0)
+    {
+        // wait for the time to TX the char over the wire
+        if (m_reg[UCON_INDEX] & XTIM_BIT)
+            baudrate = (3000000 * (inc+1)) / mod;
+        else
+            baudrate = (1500000 * (inc+1)) / mod;
+
+        UART_TLM_DBG(1, "writing UBR(0x%08X): UCON=0x%08X INC=0x%04X MOD=0x%04X -> baudrate %f",
+                m_reg[UBR_INDEX], m_reg[UCON_INDEX], inc, mod, baudrate);
+    }
+    else
+    {
+        TLM_ERR("writing UBR(0x%08X): setting MOD to 0, invalid", m_reg[UBR_INDEX]);
+    }
+}
+
+void
+Uart::configure(Parameters& parameters, Parameter& config)
+{
+    MSP& options = *config.get_config();
+
+    if (options.count("timing") != 0)
+    {
+        std::string& timing = *options["timing"]->get_lowercase();
+
+        if (timing == "wire")
+            this->set_timing(UART_TIMING_WIRE);
+        else if (timing == "chunk")
+            this->set_timing(UART_TIMING_CHUNK);
+        else if (timing == "zero")
+            this->set_timing(UART_TIMING_ZERO);
+        else
+            TLM_ERR("unknown timing %s (wire, chunk or zero)", options["timing"]->c_str());
+    }
+
+    if (*config.get_lowercase() == "link")
+        this->set_link(Link::channel(this->name(), config, "uart"));
+    else
+        this->set_host(new HostIo(this->name(), parameters, config));
+}
+
+uint32_t
+Uart::char_time()
+{
+    uint32_t inc = (m_reg[UBR_INDEX] & UBRINC_MASK) >> UBRINC_LSB;
+    uint32_t mod = (m_reg[UBR_INDEX] & UBRMOD_MASK) >> UBRMOD_LSB;
+
+    if (m_reg[UCON_INDEX] & XTIM_BIT)
+        return (1000 * mod)/(3 * (inc+1));
+    else
+        return (2000 * mod)/(3 * (inc+1));
+}
+
 void
 Uart::check_int(void)
 {
@@ -286,7 +339,7 @@ Uart::check_int(void)
     // check TX interrupt
     if (m_reg[UCON_INDEX] & MTXR_BIT)
     {
-        if ((32-m_tx.fifo.size()) >= m_reg[UTXCON_INDEX])
+        if ((UART_FIFO_SIZE-m_tx.fifo.size()) >= m_reg[UTXCON_INDEX])
         {
             this->interrupt.set();
             return;
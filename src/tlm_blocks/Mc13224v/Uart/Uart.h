@@ -1,20 +1,41 @@
 #ifndef UART_H_
 #define UART_H_
 
-// this is a peripheral
-#include "Generic/Peripheral/Peripheral.h"
-
 // that generates an interrupt
 #include "Generic/IntMaster/IntMaster.h"
 
-// include the registers definition
+// this is a peripheral with the registers definition
 #include "reg_uart.h"
 
 // include the queue element
+#include <deque>
 #include <queue>
 
+// host side of the serial line
+#include "HostIo/HostIo.h"
+
+// or another platform
+#include "Link/Link.h"
+
+/// Number of characters of the TX and RX FIFOs
+#define UART_FIFO_SIZE 32
+
+/// Timing of the characters on the wire
+enum UartTiming
+{
+    /// One timed event per character, at the baud rate
+    UART_TIMING_WIRE,
+    /// One timed event per FIFO chunk, at the baud rate
+    UART_TIMING_CHUNK,
+    /// FIFO chunks transferred in zero time
+    UART_TIMING_ZERO
+};
+
+/// Period of the polling of the host input when idle (ns)
+#define UART_HOST_POLL_NS 100000
+
 /// Interrupt Controller block model
-struct Uart : Peripheral<REG_UART_COUNT>
+struct Uart : RegUart<Uart>
 {
     // Not necessary if this module does not have a thread
     SC_HAS_PROCESS(Uart);
@@ -25,10 +46,13 @@ struct Uart : Peripheral<REG_UART_COUNT>
      */
 
     Uart(sc_core::sc_module_name name, int instance)
-    : Peripheral<REG_UART_COUNT>(name)
+    : RegUart<Uart>(name)
     , interrupt("interrupt")
     , instance(instance)
     , m_rx_eq("rx_eq")
+    , m_host(NULL)
+    , m_link(NULL)
+    , m_timing(UART_TIMING_WIRE)
     {
         // create threads
         SC_THREAD(thread_tx);
@@ -38,7 +62,54 @@ struct Uart : Peripheral<REG_UART_COUNT>
     /// Source interrupt
     IntMaster interrupt;
 
+    /** Configure the serial line from the platform configuration file:
+     * <pre>
+     * uart1 pty
+     *     timing chunk
+     * uart1 link
+     *     channel console
+     * </pre>
+     * where the value selects the host backend (see HostIo), or "link" a "uart" channel
+     * to another platform (see Link), and the optional timing the
+     * character timing: "wire" (default, one event per character), "chunk" (one event
+     * per FIFO chunk, same throughput) or "zero" (chunks transferred in zero time).
+     * @param[in] parameters Command line parameters
+     * @param[in] config Parameter of the UART
+     */
+    void
+    configure(Parameters& parameters, Parameter& config);
+
+    /** Connect the serial line to the host
+     * @param[in, out] host Host stream receiving TX and feeding RX
+     */
+    void
+    set_host(HostIo* host)
+    {
+        m_host = host;
+    }
+
+    /** Connect the serial line to another platform
+     * @param[in, out] link End of the "uart" channel
+     */
+    void
+    set_link(LinkChannel* link)
+    {
+        m_link = link;
+    }
+
+    /** Set the timing of the characters (fast-baud modes for bulk transfers)
+     * @param[in] timing Timing of the characters
+     */
+    void
+    set_timing(UartTiming timing)
+    {
+        m_timing = timing;
+    }
+
 private:
+    // the register map dispatches the accesses to the register hooks
+    friend struct RegUart<Uart>;
+
     /// Instance number
     int instance;
 
@@ -48,8 +119,8 @@ private:
         /// Event used to hold the UART TX thread
         sc_core::sc_event event;
 
-        /// FIFO
-        std::queue<uint8_t> fifo;
+        /// FIFO (the characters of a chunk stay in it until the chunk is sent)
+        std::deque<uint8_t> fifo;
     } m_tx;
 
     /// Structure containing the information for the RX path
@@ -62,6 +133,15 @@ private:
     /// Event queue containing the received chars
     tlm_utils::peq_with_get<uint8_t> m_rx_eq;
 
+    /// Host side of the serial line (NULL if none)
+    HostIo* m_host;
+
+    /// Other platform on the serial line (NULL if none)
+    LinkChannel* m_link;
+
+    /// Timing of the characters
+    UartTiming m_timing;
+
     /// Module threads
     void thread_tx(void);
     void thread_rx(void);
@@ -69,19 +149,70 @@ private:
     /// Check the interrupt status
     void check_int();
 
-    /** Register read function
-     * @param[in] offset Offset of the register to read
-     * @return The value read
+    /** Get the characters received from the host or the other platform
+     * @param[out] buf Buffer to fill
+     * @param[in] len Maximum number of characters to get
+     * @return The number of characters copied
+     */
+    size_t
+    line_read(uint8_t* buf, size_t len)
+    {
+        return (m_host != NULL) ? m_host->read(buf, len) : m_link->read(buf, len);
+    }
+
+    /** Time to transfer one character over the wire
+     * @return The character time in ns
+     */
+    uint32_t
+    char_time();
+
+    /** UDATA register read hook: pop a character from the RX FIFO
+     * @return The character received
+     */
+    uint32_t
+    udata_rd();
+
+    /** URXCON register read hook
+     * @return The number of used bytes in the RX FIFO
+     */
+    uint32_t
+    urxcon_rd();
+
+    /** UTXCON register read hook
+     * @return The number of free bytes in the TX FIFO
      */
     uint32_t
-    reg_rd(uint32_t offset);
+    utxcon_rd();
+
+    /** UCON register write hook: start the TX path if enabled
+     * @param[in] value Value written in the register
+     */
+    void
+    ucon_wr(uint32_t value);
+
+    /** UDATA register write hook: push a character in the TX FIFO
+     * @param[in] value Value written in the register
+     */
+    void
+    udata_wr(uint32_t value);
+
+    /** URXCON register write hook: set the RX FIFO interrupt level
+     * @param[in] value Value written in the register
+     */
+    void
+    urxcon_wr(uint32_t value);
+
+    /** UTXCON register write hook: set the TX FIFO interrupt level
+     * @param[in] value Value written in the register
+     */
+    void
+    utxcon_wr(uint32_t value);
 
-    /** Register write function
-     * @param[in] offset Offset of the register to read
-     * @param[in] offset Value to write in the register
+    /** UBR register write hook: set the baud rate
+     * @param[in] value Value written in the register
      */
     void
-    reg_wr(uint32_t offset, uint32_t value);
+    ubr_wr(uint32_t value);
 };
 
 #endif /*UART_H_*/
@@ -4,7 +4,7 @@
 #include <stdint.h>
 #include "compiler.h"
 #include "arch.h"
-#include "reg_sim.h"
+#include "Generic/Peripheral/Peripheral.h"
 
 #define REG_UART_BASE_ADDR 0x80005000
 
@@ -36,16 +36,6 @@
  */
 #define UCON_INDEX  0x00000000
 
-__INLINE uint32_t ucon_get(void)
-{
-    return sim_reg_uart_rd(UCON_INDEX);
-}
-
-__INLINE void ucon_set(uint32_t value)
-{
-    sim_reg_uart_wr(UCON_INDEX, value);
-}
-
 // field definitions
 #define TST_BIT         0x00008000
 #define TST_POS         15
@@ -94,227 +84,6 @@ __INLINE void ucon_set(uint32_t value)
 #define RXE_RST         0x0
 #define TXE_RST         0x0
 
-__INLINE void ucon_pack(uint8_t tst, uint8_t mrxr, uint8_t mtxr, uint8_t fce, uint8_t fcp, uint8_t xtim, uint8_t res, uint8_t txoenb, uint8_t contx, uint8_t sb, uint8_t st2, uint8_t ep, uint8_t pen, uint8_t rxe, uint8_t txe)
-{
-    ASSERT_ERR(((tst << 15) & ~0x00008000) == 0);
-    ASSERT_ERR(((mrxr << 14) & ~0x00004000) == 0);
-    ASSERT_ERR(((mtxr << 13) & ~0x00002000) == 0);
-    ASSERT_ERR(((fce << 12) & ~0x00001000) == 0);
-    ASSERT_ERR(((fcp << 11) & ~0x00000800) == 0);
-    ASSERT_ERR(((xtim << 10) & ~0x00000400) == 0);
-    ASSERT_ERR(((res << 9) & ~0x00000200) == 0);
-    ASSERT_ERR(((txoenb << 7) & ~0x00000080) == 0);
-    ASSERT_ERR(((contx << 6) & ~0x00000040) == 0);
-    ASSERT_ERR(((sb << 5) & ~0x00000020) == 0);
-    ASSERT_ERR(((st2 << 4) & ~0x00000010) == 0);
-    ASSERT_ERR(((ep << 3) & ~0x00000008) == 0);
-    ASSERT_ERR(((pen << 2) & ~0x00000004) == 0);
-    ASSERT_ERR(((rxe << 1) & ~0x00000002) == 0);
-    ASSERT_ERR(((txe << 0) & ~0x00000001) == 0);
-    sim_reg_uart_wr(UCON_INDEX,  (tst << 15) | (mrxr << 14) | (mtxr << 13) | (fce << 12) | (fcp << 11) | (xtim << 10) | (res << 9) | (txoenb << 7) | (contx << 6) | (sb << 5) | (st2 << 4) | (ep << 3) | (pen << 2) | (rxe << 1) | (txe << 0));
-}
-
-__INLINE void ucon_unpack(uint8_t* tst, uint8_t* mrxr, uint8_t* mtxr, uint8_t* fce, uint8_t* fcp, uint8_t* xtim, uint8_t* res, uint8_t* txoenb, uint8_t* contx, uint8_t* sb, uint8_t* st2, uint8_t* ep, uint8_t* pen, uint8_t* rxe, uint8_t* txe)
-{
-    uint32_t localVal = sim_reg_uart_rd(UCON_INDEX);
-
-    *tst = (localVal & 0x00008000) >> 15;
-    *mrxr = (localVal & 0x00004000) >> 14;
-    *mtxr = (localVal & 0x00002000) >> 13;
-    *fce = (localVal & 0x00001000) >> 12;
-    *fcp = (localVal & 0x00000800) >> 11;
-    *xtim = (localVal & 0x00000400) >> 10;
-    *res = (localVal & 0x00000200) >> 9;
-    *txoenb = (localVal & 0x00000080) >> 7;
-    *contx = (localVal & 0x00000040) >> 6;
-    *sb = (localVal & 0x00000020) >> 5;
-    *st2 = (localVal & 0x00000010) >> 4;
-    *ep = (localVal & 0x00000008) >> 3;
-    *pen = (localVal & 0x00000004) >> 2;
-    *rxe = (localVal & 0x00000002) >> 1;
-    *txe = (localVal & 0x00000001) >> 0;
-}
-
-__INLINE uint8_t tst_getf(void)
-{
-    uint32_t localVal = sim_reg_uart_rd(UCON_INDEX);
-    return ((localVal & 0x00008000) >> 15);
-}
-
-__INLINE void tst_setf(uint8_t tst)
-{
-    ASSERT_ERR(((tst << 15) & ~0x00008000) == 0);
-    sim_reg_uart_wr(UCON_INDEX, (sim_reg_uart_rd(UCON_INDEX) & ~0x00008000) | (tst << 15));
-}
-
-__INLINE uint8_t mrxr_getf(void)
-{
-    uint32_t localVal = sim_reg_uart_rd(UCON_INDEX);
-    return ((localVal & 0x00004000) >> 14);
-}
-
-__INLINE void mrxr_setf(uint8_t mrxr)
-{
-    ASSERT_ERR(((mrxr << 14) & ~0x00004000) == 0);
-    sim_reg_uart_wr(UCON_INDEX, (sim_reg_uart_rd(UCON_INDEX) & ~0x00004000) | (mrxr << 14));
-}
-
-__INLINE uint8_t mtxr_getf(void)
-{
-    uint32_t localVal = sim_reg_uart_rd(UCON_INDEX);
-    return ((localVal & 0x00002000) >> 13);
-}
-
-__INLINE void mtxr_setf(uint8_t mtxr)
-{
-    ASSERT_ERR(((mtxr << 13) & ~0x00002000) == 0);
-    sim_reg_uart_wr(UCON_INDEX, (sim_reg_uart_rd(UCON_INDEX) & ~0x00002000) | (mtxr << 13));
-}
-
-__INLINE uint8_t fce_getf(void)
-{
-    uint32_t localVal = sim_reg_uart_rd(UCON_INDEX);
-    return ((localVal & 0x00001000) >> 12);
-}
-
-__INLINE void fce_setf(uint8_t fce)
-{
-    ASSERT_ERR(((fce << 12) & ~0x00001000) == 0);
-    sim_reg_uart_wr(UCON_INDEX, (sim_reg_uart_rd(UCON_INDEX) & ~0x00001000) | (fce << 12));
-}
-
-__INLINE uint8_t fcp_getf(void)
-{
-    uint32_t localVal = sim_reg_uart_rd(UCON_INDEX);
-    return ((localVal & 0x00000800) >> 11);
-}
-
-__INLINE void fcp_setf(uint8_t fcp)
-{
-    ASSERT_ERR(((fcp << 11) & ~0x00000800) == 0);
-    sim_reg_uart_wr(UCON_INDEX, (sim_reg_uart_rd(UCON_INDEX) & ~0x00000800) | (fcp << 11));
-}
-
-__INLINE uint8_t xtim_getf(void)
-{
-    uint32_t localVal = sim_reg_uart_rd(UCON_INDEX);
-    return ((localVal & 0x00000400) >> 10);
-}
-
-__INLINE void xtim_setf(uint8_t xtim)
-{
-    ASSERT_ERR(((xtim << 10) & ~0x00000400) == 0);
-    sim_reg_uart_wr(UCON_INDEX, (sim_reg_uart_rd(UCON_INDEX) & ~0x00000400) | (xtim << 10));
-}
-
-__INLINE uint8_t res_getf(void)
-{
-    uint32_t localVal = sim_reg_uart_rd(UCON_INDEX);
-    return ((localVal & 0x00000200) >> 9);
-}
-
-__INLINE void res_setf(uint8_t res)
-{
-    ASSERT_ERR(((res << 9) & ~0x00000200) == 0);
-    sim_reg_uart_wr(UCON_INDEX, (sim_reg_uart_rd(UCON_INDEX) & ~0x00000200) | (res << 9));
-}
-
-__INLINE uint8_t tx_oen_b_getf(void)
-{
-    uint32_t localVal = sim_reg_uart_rd(UCON_INDEX);
-    return ((localVal & 0x00000080) >> 7);
-}
-
-__INLINE void tx_oen_b_setf(uint8_t txoenb)
-{
-    ASSERT_ERR(((txoenb << 7) & ~0x00000080) == 0);
-    sim_reg_uart_wr(UCON_INDEX, (sim_reg_uart_rd(UCON_INDEX) & ~0x00000080) | (txoenb << 7));
-}
-
-__INLINE uint8_t contx_getf(void)
-{
-    uint32_t localVal = sim_reg_uart_rd(UCON_INDEX);
-    return ((localVal & 0x00000040) >> 6);
-}
-
-__INLINE void contx_setf(uint8_t contx)
-{
-    ASSERT_ERR(((contx << 6) & ~0x00000040) == 0);
-    sim_reg_uart_wr(UCON_INDEX, (sim_reg_uart_rd(UCON_INDEX) & ~0x00000040) | (contx << 6));
-}
-
-__INLINE uint8_t sb_getf(void)
-{
-    uint32_t localVal = sim_reg_uart_rd(UCON_INDEX);
-    return ((localVal & 0x00000020) >> 5);
-}
-
-__INLINE void sb_setf(uint8_t sb)
-{
-    ASSERT_ERR(((sb << 5) & ~0x00000020) == 0);
-    sim_reg_uart_wr(UCON_INDEX, (sim_reg_uart_rd(UCON_INDEX) & ~0x00000020) | (sb << 5));
-}
-
-__INLINE uint8_t st2_getf(void)
-{
-    uint32_t localVal = sim_reg_uart_rd(UCON_INDEX);
-    return ((localVal & 0x00000010) >> 4);
-}
-
-__INLINE void st2_setf(uint8_t st2)
-{
-    ASSERT_ERR(((st2 << 4) & ~0x00000010) == 0);
-    sim_reg_uart_wr(UCON_INDEX, (sim_reg_uart_rd(UCON_INDEX) & ~0x00000010) | (st2 << 4));
-}
-
-__INLINE uint8_t ep_getf(void)
-{
-    uint32_t localVal = sim_reg_uart_rd(UCON_INDEX);
-    return ((localVal & 0x00000008) >> 3);
-}
-
-__INLINE void ep_setf(uint8_t ep)
-{
-    ASSERT_ERR(((ep << 3) & ~0x00000008) == 0);
-    sim_reg_uart_wr(UCON_INDEX, (sim_reg_uart_rd(UCON_INDEX) & ~0x00000008) | (ep << 3));
-}
-
-__INLINE uint8_t pen_getf(void)
-{
-    uint32_t localVal = sim_reg_uart_rd(UCON_INDEX);
-    return ((localVal & 0x00000004) >> 2);
-}
-
-__INLINE void pen_setf(uint8_t pen)
-{
-    ASSERT_ERR(((pen << 2) & ~0x00000004) == 0);
-    sim_reg_uart_wr(UCON_INDEX, (sim_reg_uart_rd(UCON_INDEX) & ~0x00000004) | (pen << 2));
-}
-
-__INLINE uint8_t rxe_getf(void)
-{
-    uint32_t localVal = sim_reg_uart_rd(UCON_INDEX);
-    return ((localVal & 0x00000002) >> 1);
-}
-
-__INLINE void rxe_setf(uint8_t rxe)
-{
-    ASSERT_ERR(((rxe << 1) & ~0x00000002) == 0);
-    sim_reg_uart_wr(UCON_INDEX, (sim_reg_uart_rd(UCON_INDEX) & ~0x00000002) | (rxe << 1));
-}
-
-__INLINE uint8_t txe_getf(void)
-{
-    uint32_t localVal = sim_reg_uart_rd(UCON_INDEX);
-    return ((localVal & 0x00000001) >> 0);
-}
-
-__INLINE void txe_setf(uint8_t txe)
-{
-    ASSERT_ERR(((txe << 0) & ~0x00000001) == 0);
-    sim_reg_uart_wr(UCON_INDEX, (sim_reg_uart_rd(UCON_INDEX) & ~0x00000001) | (txe << 0));
-}
-
 /**
  * @brief USTAT register definition
  * <pre>
@@ -332,16 +101,6 @@ __INLINE void txe_setf(uint8_t txe)
  */
 #define USTAT_INDEX  0x00000001
 
-__INLINE uint32_t ustat_get(void)
-{
-    return sim_reg_uart_rd(USTAT_INDEX);
-}
-
-__INLINE void ustat_set(uint32_t value)
-{
-    sim_reg_uart_wr(USTAT_INDEX, value);
-}
-
 // field definitions
 #define TXRDY_BIT    0x00000080
 #define TXRDY_POS    7
@@ -369,68 +128,6 @@ __INLINE void ustat_set(uint32_t value)
 #define PE_RST       0x0
 #define SE_RST       0x0
 
-__INLINE void ustat_unpack(uint8_t* txrdy, uint8_t* rxrdy, uint8_t* rue, uint8_t* roe, uint8_t* toe, uint8_t* fe, uint8_t* pe, uint8_t* se)
-{
-    uint32_t localVal = sim_reg_uart_rd(USTAT_INDEX);
-
-    *txrdy = (localVal & 0x00000080) >> 7;
-    *rxrdy = (localVal & 0x00000040) >> 6;
-    *rue = (localVal & 0x00000020) >> 5;
-    *roe = (localVal & 0x00000010) >> 4;
-    *toe = (localVal & 0x00000008) >> 3;
-    *fe = (localVal & 0x00000004) >> 2;
-    *pe = (localVal & 0x00000002) >> 1;
-    *se = (localVal & 0x00000001) >> 0;
-}
-
-__INLINE uint8_t txrdy_getf(void)
-{
-    uint32_t localVal = sim_reg_uart_rd(USTAT_INDEX);
-    return ((localVal & 0x00000080) >> 7);
-}
-
-__INLINE uint8_t rxrdy_getf(void)
-{
-    uint32_t localVal = sim_reg_uart_rd(USTAT_INDEX);
-    return ((localVal & 0x00000040) >> 6);
-}
-
-__INLINE uint8_t rue_getf(void)
-{
-    uint32_t localVal = sim_reg_uart_rd(USTAT_INDEX);
-    return ((localVal & 0x00000020) >> 5);
-}
-
-__INLINE uint8_t roe_getf(void)
-{
-    uint32_t localVal = sim_reg_uart_rd(USTAT_INDEX);
-    return ((localVal & 0x00000010) >> 4);
-}
-
-__INLINE uint8_t toe_getf(void)
-{
-    uint32_t localVal = sim_reg_uart_rd(USTAT_INDEX);
-    return ((localVal & 0x00000008) >> 3);
-}
-
-__INLINE uint8_t fe_getf(void)
-{
-    uint32_t localVal = sim_reg_uart_rd(USTAT_INDEX);
-    return ((localVal & 0x00000004) >> 2);
-}
-
-__INLINE uint8_t pe_getf(void)
-{
-    uint32_t localVal = sim_reg_uart_rd(USTAT_INDEX);
-    return ((localVal & 0x00000002) >> 1);
-}
-
-__INLINE uint8_t se_getf(void)
-{
-    uint32_t localVal = sim_reg_uart_rd(USTAT_INDEX);
-    return ((localVal & 0x00000001) >> 0);
-}
-
 /**
  * @brief UDATA register definition
  * <pre>
@@ -441,16 +138,6 @@ __INLINE uint8_t se_getf(void)
  */
 #define UDATA_INDEX  0x00000002
 
-__INLINE uint32_t udata_get(void)
-{
-    return sim_reg_uart_rd(UDATA_INDEX);
-}
-
-__INLINE void udata_set(uint32_t value)
-{
-    sim_reg_uart_wr(UDATA_INDEX, value);
-}
-
 // field definitions
 #define UDATA_MASK   0x000000FF
 #define UDATA_LSB    0
@@ -458,19 +145,6 @@ __INLINE void udata_set(uint32_t value)
 
 #define UDATA_RST    0x0
 
-__INLINE uint8_t udata_getf(void)
-{
-    uint32_t localVal = sim_reg_uart_rd(UDATA_INDEX);
-    ASSERT_ERR((localVal & ~0x000000FF) == 0);
-    return (localVal >> 0);
-}
-
-__INLINE void udata_setf(uint8_t udata)
-{
-    ASSERT_ERR(((udata << 0) & ~0x000000FF) == 0);
-    sim_reg_uart_wr(UDATA_INDEX, udata << 0);
-}
-
 /**
  * @brief URXCON register definition
  * <pre>
@@ -481,16 +155,6 @@ __INLINE void udata_setf(uint8_t udata)
  */
 #define URXCON_INDEX  0x00000003
 
-__INLINE uint32_t urxcon_get(void)
-{
-    return sim_reg_uart_rd(URXCON_INDEX);
-}
-
-__INLINE void urxcon_set(uint32_t value)
-{
-    sim_reg_uart_wr(URXCON_INDEX, value);
-}
-
 // field definitions
 #define RXLEVEL_MASK   0x0000003F
 #define RXLEVEL_LSB    0
@@ -498,19 +162,6 @@ __INLINE void urxcon_set(uint32_t value)
 
 #define RXLEVEL_RST    0x0
 
-__INLINE uint8_t rxlevel_getf(void)
-{
-    uint32_t localVal = sim_reg_uart_rd(URXCON_INDEX);
-    ASSERT_ERR((localVal & ~0x0000003F) == 0);
-    return (localVal >> 0);
-}
-
-__INLINE void rxlevel_setf(uint8_t rxlevel)
-{
-    ASSERT_ERR(((rxlevel << 0) & ~0x0000003F) == 0);
-    sim_reg_uart_wr(URXCON_INDEX, rxlevel << 0);
-}
-
 /**
  * @brief UTXCON register definition
  * <pre>
@@ -521,16 +172,6 @@ __INLINE void rxlevel_setf(uint8_t rxlevel)
  */
 #define UTXCON_INDEX  0x00000004
 
-__INLINE uint32_t utxcon_get(void)
-{
-    return sim_reg_uart_rd(UTXCON_INDEX);
-}
-
-__INLINE void utxcon_set(uint32_t value)
-{
-    sim_reg_uart_wr(UTXCON_INDEX, value);
-}
-
 // field definitions
 #define TXLEVEL_MASK   0x0000003F
 #define TXLEVEL_LSB    0
@@ -538,19 +179,6 @@ __INLINE void utxcon_set(uint32_t value)
 
 #define TXLEVEL_RST    0x0
 
-__INLINE uint8_t txlevel_getf(void)
-{
-    uint32_t localVal = sim_reg_uart_rd(UTXCON_INDEX);
-    ASSERT_ERR((localVal & ~0x0000003F) == 0);
-    return (localVal >> 0);
-}
-
-__INLINE void txlevel_setf(uint8_t txlevel)
-{
-    ASSERT_ERR(((txlevel << 0) & ~0x0000003F) == 0);
-    sim_reg_uart_wr(UTXCON_INDEX, txlevel << 0);
-}
-
 /**
  * @brief UCTS register definition
  * <pre>
@@ -561,16 +189,6 @@ __INLINE void txlevel_setf(uint8_t txlevel)
  */
 #define UCTS_INDEX  0x00000005
 
-__INLINE uint32_t ucts_get(void)
-{
-    return sim_reg_uart_rd(UCTS_INDEX);
-}
-
-__INLINE void ucts_set(uint32_t value)
-{
-    sim_reg_uart_wr(UCTS_INDEX, value);
-}
-
 // field definitions
 #define CTS_LEVEL_MASK   0x0000001F
 #define CTS_LEVEL_LSB    0
@@ -578,19 +196,6 @@ __INLINE void ucts_set(uint32_t value)
 
 #define CTS_LEVEL_RST    0x0
 
-__INLINE uint8_t cts_level_getf(void)
-{
-    uint32_t localVal = sim_reg_uart_rd(UCTS_INDEX);
-    ASSERT_ERR((localVal & ~0x0000001F) == 0);
-    return (localVal >> 0);
-}
-
-__INLINE void cts_level_setf(uint8_t ctslevel)
-{
-    ASSERT_ERR(((ctslevel << 0) & ~0x0000001F) == 0);
-    sim_reg_uart_wr(UCTS_INDEX, ctslevel << 0);
-}
-
 /**
  * @brief UBR register definition
  * <pre>
@@ -602,16 +207,6 @@ __INLINE void cts_level_setf(uint8_t ctslevel)
  */
 #define UBR_INDEX  0x00000006
 
-__INLINE uint32_t ubr_get(void)
-{
-    return sim_reg_uart_rd(UBR_INDEX);
-}
-
-__INLINE void ubr_set(uint32_t value)
-{
-    sim_reg_uart_wr(UBR_INDEX, value);
-}
-
 // field definitions
 #define UBRINC_MASK   0xFFFF0000
 #define UBRINC_LSB    16
@@ -623,45 +218,709 @@ __INLINE void ubr_set(uint32_t value)
 #define UBRINC_RST    0x0
 #define UBRMOD_RST    0x0
 
-__INLINE void ubr_pack(uint16_t ubrinc, uint16_t ubrmod)
-{
-    ASSERT_ERR(((ubrinc << 16) & ~0xFFFF0000) == 0);
-    ASSERT_ERR(((ubrmod << 0) & ~0x0000FFFF) == 0);
-    sim_reg_uart_wr(UBR_INDEX,  (ubrinc << 16) | (ubrmod << 0));
-}
-
-__INLINE void ubr_unpack(uint16_t* ubrinc, uint16_t* ubrmod)
-{
-    uint32_t localVal = sim_reg_uart_rd(UBR_INDEX);
-
-    *ubrinc = (localVal & 0xFFFF0000) >> 16;
-    *ubrmod = (localVal & 0x0000FFFF) >> 0;
-}
-
-__INLINE uint16_t ubrinc_getf(void)
-{
-    uint32_t localVal = sim_reg_uart_rd(UBR_INDEX);
-    return ((localVal & 0xFFFF0000) >> 16);
-}
-
-__INLINE void ubrinc_setf(uint16_t ubrinc)
-{
-    ASSERT_ERR(((ubrinc << 16) & ~0xFFFF0000) == 0);
-    sim_reg_uart_wr(UBR_INDEX, (sim_reg_uart_rd(UBR_INDEX) & ~0xFFFF0000) | (ubrinc << 16));
-}
-
-__INLINE uint16_t ubrmod_getf(void)
-{
-    uint32_t localVal = sim_reg_uart_rd(UBR_INDEX);
-    return ((localVal & 0x0000FFFF) >> 0);
-}
-
-__INLINE void ubrmod_setf(uint16_t ubrmod)
-{
-    ASSERT_ERR(((ubrmod << 0) & ~0x0000FFFF) == 0);
-    sim_reg_uart_wr(UBR_INDEX, (sim_reg_uart_rd(UBR_INDEX) & ~0x0000FFFF) | (ubrmod << 0));
-}
-
+/**
+ * @brief Register map of the REG_UART block, to be derived by the block model
+ *
+ * The register accesses are dispatched at compile time to the register hooks
+ * {regname}_rd() and {regname}_wr(value) of the model, which only redefines the
+ * hooks of the registers having side effects.
+ * @param MODEL Block model deriving from this class
+ */
+template <typename MODEL>
+struct RegUart : Peripheral<REG_UART_COUNT>
+{
+    /** Constructor
+     * @param[in] name Name of the module
+     */
+    RegUart(sc_core::sc_module_name name)
+    : Peripheral<REG_UART_COUNT>(name)
+    {
+        this->set_reg_names(&reg_name);
+    }
+
+    /** Name of a register
+     * @param[in] index Index of the register
+     * @return The name of the register, NULL if there is no register at this index
+     */
+    static const char*
+    reg_name(uint32_t index)
+    {
+        static const char* const names[REG_UART_COUNT] =
+        {
+            "UCON",
+            "USTAT",
+            "UDATA",
+            "URXCON",
+            "UTXCON",
+            "UCTS",
+            "UBR",
+        };
+
+        return (index < REG_UART_COUNT) ? names[index] : NULL;
+    }
+
+    uint32_t ucon_get(void)
+    {
+        return this->m_reg[UCON_INDEX];
+    }
+
+    void ucon_set(uint32_t value)
+    {
+        this->m_reg[UCON_INDEX] = value;
+    }
+
+    typedef RegField<UCON_INDEX, 0x00008000, 15> tst_field;
+    typedef RegField<UCON_INDEX, 0x00004000, 14> mrxr_field;
+    typedef RegField<UCON_INDEX, 0x00002000, 13> mtxr_field;
+    typedef RegField<UCON_INDEX, 0x00001000, 12> fce_field;
+    typedef RegField<UCON_INDEX, 0x00000800, 11> fcp_field;
+    typedef RegField<UCON_INDEX, 0x00000400, 10> xtim_field;
+    typedef RegField<UCON_INDEX, 0x00000200, 9> res_field;
+    typedef RegField<UCON_INDEX, 0x00000080, 7> tx_oen_b_field;
+    typedef RegField<UCON_INDEX, 0x00000040, 6> contx_field;
+    typedef RegField<UCON_INDEX, 0x00000020, 5> sb_field;
+    typedef RegField<UCON_INDEX, 0x00000010, 4> st2_field;
+    typedef RegField<UCON_INDEX, 0x00000008, 3> ep_field;
+    typedef RegField<UCON_INDEX, 0x00000004, 2> pen_field;
+    typedef RegField<UCON_INDEX, 0x00000002, 1> rxe_field;
+    typedef RegField<UCON_INDEX, 0x00000001, 0> txe_field;
+
+    void ucon_pack(uint8_t tst, uint8_t mrxr, uint8_t mtxr, uint8_t fce, uint8_t fcp, uint8_t xtim, uint8_t res, uint8_t txoenb, uint8_t contx, uint8_t sb, uint8_t st2, uint8_t ep, uint8_t pen, uint8_t rxe, uint8_t txe)
+    {
+        ASSERT_ERR(((tst << 15) & ~0x00008000) == 0);
+        ASSERT_ERR(((mrxr << 14) & ~0x00004000) == 0);
+        ASSERT_ERR(((mtxr << 13) & ~0x00002000) == 0);
+        ASSERT_ERR(((fce << 12) & ~0x00001000) == 0);
+        ASSERT_ERR(((fcp << 11) & ~0x00000800) == 0);
+        ASSERT_ERR(((xtim << 10) & ~0x00000400) == 0);
+        ASSERT_ERR(((res << 9) & ~0x00000200) == 0);
+        ASSERT_ERR(((txoenb << 7) & ~0x00000080) == 0);
+        ASSERT_ERR(((contx << 6) & ~0x00000040) == 0);
+        ASSERT_ERR(((sb << 5) & ~0x00000020) == 0);
+        ASSERT_ERR(((st2 << 4) & ~0x00000010) == 0);
+        ASSERT_ERR(((ep << 3) & ~0x00000008) == 0);
+        ASSERT_ERR(((pen << 2) & ~0x00000004) == 0);
+        ASSERT_ERR(((rxe << 1) & ~0x00000002) == 0);
+        ASSERT_ERR(((txe << 0) & ~0x00000001) == 0);
+        this->m_reg[UCON_INDEX] =  (tst << 15) | (mrxr << 14) | (mtxr << 13) | (fce << 12) | (fcp << 11) | (xtim << 10) | (res << 9) | (txoenb << 7) | (contx << 6) | (sb << 5) | (st2 << 4) | (ep << 3) | (pen << 2) | (rxe << 1) | (txe << 0);
+    }
+
+    void ucon_unpack(uint8_t* tst, uint8_t* mrxr, uint8_t* mtxr, uint8_t* fce, uint8_t* fcp, uint8_t* xtim, uint8_t* res, uint8_t* txoenb, uint8_t* contx, uint8_t* sb, uint8_t* st2, uint8_t* ep, uint8_t* pen, uint8_t* rxe, uint8_t* txe)
+    {
+        uint32_t localVal = this->m_reg[UCON_INDEX];
+
+        *tst = (localVal & 0x00008000) >> 15;
+        *mrxr = (localVal & 0x00004000) >> 14;
+        *mtxr = (localVal & 0x00002000) >> 13;
+        *fce = (localVal & 0x00001000) >> 12;
+        *fcp = (localVal & 0x00000800) >> 11;
+        *xtim = (localVal & 0x00000400) >> 10;
+        *res = (localVal & 0x00000200) >> 9;
+        *txoenb = (localVal & 0x00000080) >> 7;
+        *contx = (localVal & 0x00000040) >> 6;
+        *sb = (localVal & 0x00000020) >> 5;
+        *st2 = (localVal & 0x00000010) >> 4;
+        *ep = (localVal & 0x00000008) >> 3;
+        *pen = (localVal & 0x00000004) >> 2;
+        *rxe = (localVal & 0x00000002) >> 1;
+        *txe = (localVal & 0x00000001) >> 0;
+    }
+
+    uint8_t tst_getf(void)
+    {
+        uint32_t localVal = this->m_reg[UCON_INDEX];
+        return ((localVal & 0x00008000) >> 15);
+    }
+
+    void tst_setf(uint8_t tst)
+    {
+        ASSERT_ERR(((tst << 15) & ~0x00008000) == 0);
+        this->m_reg[UCON_INDEX] = (this->m_reg[UCON_INDEX] & ~0x00008000) | (tst << 15);
+    }
+
+    uint8_t mrxr_getf(void)
+    {
+        uint32_t localVal = this->m_reg[UCON_INDEX];
+        return ((localVal & 0x00004000) >> 14);
+    }
+
+    void mrxr_setf(uint8_t mrxr)
+    {
+        ASSERT_ERR(((mrxr << 14) & ~0x00004000) == 0);
+        this->m_reg[UCON_INDEX] = (this->m_reg[UCON_INDEX] & ~0x00004000) | (mrxr << 14);
+    }
+
+    uint8_t mtxr_getf(void)
+    {
+        uint32_t localVal = this->m_reg[UCON_INDEX];
+        return ((localVal & 0x00002000) >> 13);
+    }
+
+    void mtxr_setf(uint8_t mtxr)
+    {
+        ASSERT_ERR(((mtxr << 13) & ~0x00002000) == 0);
+        this->m_reg[UCON_INDEX] = (this->m_reg[UCON_INDEX] & ~0x00002000) | (mtxr << 13);
+    }
+
+    uint8_t fce_getf(void)
+    {
+        uint32_t localVal = this->m_reg[UCON_INDEX];
+        return ((localVal & 0x00001000) >> 12);
+    }
+
+    void fce_setf(uint8_t fce)
+    {
+        ASSERT_ERR(((fce << 12) & ~0x00001000) == 0);
+        this->m_reg[UCON_INDEX] = (this->m_reg[UCON_INDEX] & ~0x00001000) | (fce << 12);
+    }
+
+    uint8_t fcp_getf(void)
+    {
+        uint32_t localVal = this->m_reg[UCON_INDEX];
+        return ((localVal & 0x00000800) >> 11);
+    }
+
+    void fcp_setf(uint8_t fcp)
+    {
+        ASSERT_ERR(((fcp << 11) & ~0x00000800) == 0);
+        this->m_reg[UCON_INDEX] = (this->m_reg[UCON_INDEX] & ~0x00000800) | (fcp << 11);
+    }
+
+    uint8_t xtim_getf(void)
+    {
+        uint32_t localVal = this->m_reg[UCON_INDEX];
+        return ((localVal & 0x00000400) >> 10);
+    }
+
+    void xtim_setf(uint8_t xtim)
+    {
+        ASSERT_ERR(((xtim << 10) & ~0x00000400) == 0);
+        this->m_reg[UCON_INDEX] = (this->m_reg[UCON_INDEX] & ~0x00000400) | (xtim << 10);
+    }
+
+    uint8_t res_getf(void)
+    {
+        uint32_t localVal = this->m_reg[UCON_INDEX];
+        return ((localVal & 0x00000200) >> 9);
+    }
+
+    void res_setf(uint8_t res)
+    {
+        ASSERT_ERR(((res << 9) & ~0x00000200) == 0);
+        this->m_reg[UCON_INDEX] = (this->m_reg[UCON_INDEX] & ~0x00000200) | (res << 9);
+    }
+
+    uint8_t tx_oen_b_getf(void)
+    {
+        uint32_t localVal = this->m_reg[UCON_INDEX];
+        return ((localVal & 0x00000080) >> 7);
+    }
+
+    void tx_oen_b_setf(uint8_t txoenb)
+    {
+        ASSERT_ERR(((txoenb << 7) & ~0x00000080) == 0);
+        this->m_reg[UCON_INDEX] = (this->m_reg[UCON_INDEX] & ~0x00000080) | (txoenb << 7);
+    }
+
+    uint8_t contx_getf(void)
+    {
+        uint32_t localVal = this->m_reg[UCON_INDEX];
+        return ((localVal & 0x00000040) >> 6);
+    }
+
+    void contx_setf(uint8_t contx)
+    {
+        ASSERT_ERR(((contx << 6) & ~0x00000040) == 0);
+        this->m_reg[UCON_INDEX] = (this->m_reg[UCON_INDEX] & ~0x00000040) | (contx << 6);
+    }
+
+    uint8_t sb_getf(void)
+    {
+        uint32_t localVal = this->m_reg[UCON_INDEX];
+        return ((localVal & 0x00000020) >> 5);
+    }
+
+    void sb_setf(uint8_t sb)
+    {
+        ASSERT_ERR(((sb << 5) & ~0x00000020) == 0);
+        this->m_reg[UCON_INDEX] = (this->m_reg[UCON_INDEX] & ~0x00000020) | (sb << 5);
+    }
+
+    uint8_t st2_getf(void)
+    {
+        uint32_t localVal = this->m_reg[UCON_INDEX];
+        return ((localVal & 0x00000010) >> 4);
+    }
+
+    void st2_setf(uint8_t st2)
+    {
+        ASSERT_ERR(((st2 << 4) & ~0x00000010) == 0);
+        this->m_reg[UCON_INDEX] = (this->m_reg[UCON_INDEX] & ~0x00000010) | (st2 << 4);
+    }
+
+    uint8_t ep_getf(void)
+    {
+        uint32_t localVal = this->m_reg[UCON_INDEX];
+        return ((localVal & 0x00000008) >> 3);
+    }
+
+    void ep_setf(uint8_t ep)
+    {
+        ASSERT_ERR(((ep << 3) & ~0x00000008) == 0);
+        this->m_reg[UCON_INDEX] = (this->m_reg[UCON_INDEX] & ~0x00000008) | (ep << 3);
+    }
+
+    uint8_t pen_getf(void)
+    {
+        uint32_t localVal = this->m_reg[UCON_INDEX];
+        return ((localVal & 0x00000004) >> 2);
+    }
+
+    void pen_setf(uint8_t pen)
+    {
+        ASSERT_ERR(((pen << 2) & ~0x00000004) == 0);
+        this->m_reg[UCON_INDEX] = (this->m_reg[UCON_INDEX] & ~0x00000004) | (pen << 2);
+    }
+
+    uint8_t rxe_getf(void)
+    {
+        uint32_t localVal = this->m_reg[UCON_INDEX];
+        return ((localVal & 0x00000002) >> 1);
+    }
+
+    void rxe_setf(uint8_t rxe)
+    {
+        ASSERT_ERR(((rxe << 1) & ~0x00000002) == 0);
+        this->m_reg[UCON_INDEX] = (this->m_reg[UCON_INDEX] & ~0x00000002) | (rxe << 1);
+    }
+
+    uint8_t txe_getf(void)
+    {
+        uint32_t localVal = this->m_reg[UCON_INDEX];
+        return ((localVal & 0x00000001) >> 0);
+    }
+
+    void txe_setf(uint8_t txe)
+    {
+        ASSERT_ERR(((txe << 0) & ~0x00000001) == 0);
+        this->m_reg[UCON_INDEX] = (this->m_reg[UCON_INDEX] & ~0x00000001) | (txe << 0);
+    }
+
+    uint32_t ustat_get(void)
+    {
+        return this->m_reg[USTAT_INDEX];
+    }
+
+    void ustat_set(uint32_t value)
+    {
+        this->m_reg[USTAT_INDEX] = value;
+    }
+
+    typedef RegField<USTAT_INDEX, 0x00000080, 7> txrdy_field;
+    typedef RegField<USTAT_INDEX, 0x00000040, 6> rxrdy_field;
+    typedef RegField<USTAT_INDEX, 0x00000020, 5> rue_field;
+    typedef RegField<USTAT_INDEX, 0x00000010, 4> roe_field;
+    typedef RegField<USTAT_INDEX, 0x00000008, 3> toe_field;
+    typedef RegField<USTAT_INDEX, 0x00000004, 2> fe_field;
+    typedef RegField<USTAT_INDEX, 0x00000002, 1> pe_field;
+    typedef RegField<USTAT_INDEX, 0x00000001, 0> se_field;
+
+    void ustat_unpack(uint8_t* txrdy, uint8_t* rxrdy, uint8_t* rue, uint8_t* roe, uint8_t* toe, uint8_t* fe, uint8_t* pe, uint8_t* se)
+    {
+        uint32_t localVal = this->m_reg[USTAT_INDEX];
+
+        *txrdy = (localVal & 0x00000080) >> 7;
+        *rxrdy = (localVal & 0x00000040) >> 6;
+        *rue = (localVal & 0x00000020) >> 5;
+        *roe = (localVal & 0x00000010) >> 4;
+        *toe = (localVal & 0x00000008) >> 3;
+        *fe = (localVal & 0x00000004) >> 2;
+        *pe = (localVal & 0x00000002) >> 1;
+        *se = (localVal & 0x00000001) >> 0;
+    }
+
+    uint8_t txrdy_getf(void)
+    {
+        uint32_t localVal = this->m_reg[USTAT_INDEX];
+        return ((localVal & 0x00000080) >> 7);
+    }
+
+    uint8_t rxrdy_getf(void)
+    {
+        uint32_t localVal = this->m_reg[USTAT_INDEX];
+        return ((localVal & 0x00000040) >> 6);
+    }
+
+    uint8_t rue_getf(void)
+    {
+        uint32_t localVal = this->m_reg[USTAT_INDEX];
+        return ((localVal & 0x00000020) >> 5);
+    }
+
+    uint8_t roe_getf(void)
+    {
+        uint32_t localVal = this->m_reg[USTAT_INDEX];
+        return ((localVal & 0x00000010) >> 4);
+    }
+
+    uint8_t toe_getf(void)
+    {
+        uint32_t localVal = this->m_reg[USTAT_INDEX];
+        return ((localVal & 0x00000008) >> 3);
+    }
+
+    uint8_t fe_getf(void)
+    {
+        uint32_t localVal = this->m_reg[USTAT_INDEX];
+        return ((localVal & 0x00000004) >> 2);
+    }
+
+    uint8_t pe_getf(void)
+    {
+        uint32_t localVal = this->m_reg[USTAT_INDEX];
+        return ((localVal & 0x00000002) >> 1);
+    }
+
+    uint8_t se_getf(void)
+    {
+        uint32_t localVal = this->m_reg[USTAT_INDEX];
+        return ((localVal & 0x00000001) >> 0);
+    }
+
+    uint32_t udata_get(void)
+    {
+        return this->m_reg[UDATA_INDEX];
+    }
+
+    void udata_set(uint32_t value)
+    {
+        this->m_reg[UDATA_INDEX] = value;
+    }
+
+    typedef RegField<UDATA_INDEX, 0x000000FF, 0> udata_field;
+
+    uint8_t udata_getf(void)
+    {
+        uint32_t localVal = this->m_reg[UDATA_INDEX];
+        ASSERT_ERR((localVal & ~0x000000FF) == 0);
+        return (localVal >> 0);
+    }
+
+    void udata_setf(uint8_t udata)
+    {
+        ASSERT_ERR(((udata << 0) & ~0x000000FF) == 0);
+        this->m_reg[UDATA_INDEX] = udata << 0;
+    }
+
+    uint32_t urxcon_get(void)
+    {
+        return this->m_reg[URXCON_INDEX];
+    }
+
+    void urxcon_set(uint32_t value)
+    {
+        this->m_reg[URXCON_INDEX] = value;
+    }
+
+    typedef RegField<URXCON_INDEX, 0x0000003F, 0> rxlevel_field;
+
+    uint8_t rxlevel_getf(void)
+    {
+        uint32_t localVal = this->m_reg[URXCON_INDEX];
+        ASSERT_ERR((localVal & ~0x0000003F) == 0);
+        return (localVal >> 0);
+    }
+
+    void rxlevel_setf(uint8_t rxlevel)
+    {
+        ASSERT_ERR(((rxlevel << 0) & ~0x0000003F) == 0);
+        this->m_reg[URXCON_INDEX] = rxlevel << 0;
+    }
+
+    uint32_t utxcon_get(void)
+    {
+        return this->m_reg[UTXCON_INDEX];
+    }
+
+    void utxcon_set(uint32_t value)
+    {
+        this->m_reg[UTXCON_INDEX] = value;
+    }
+
+    typedef RegField<UTXCON_INDEX, 0x0000003F, 0> txlevel_field;
+
+    uint8_t txlevel_getf(void)
+    {
+        uint32_t localVal = this->m_reg[UTXCON_INDEX];
+        ASSERT_ERR((localVal & ~0x0000003F) == 0);
+        return (localVal >> 0);
+    }
+
+    void txlevel_setf(uint8_t txlevel)
+    {
+        ASSERT_ERR(((txlevel << 0) & ~0x0000003F) == 0);
+        this->m_reg[UTXCON_INDEX] = txlevel << 0;
+    }
+
+    uint32_t ucts_get(void)
+    {
+        return this->m_reg[UCTS_INDEX];
+    }
+
+    void ucts_set(uint32_t value)
+    {
+        this->m_reg[UCTS_INDEX] = value;
+    }
+
+    typedef RegField<UCTS_INDEX, 0x0000001F, 0> cts_level_field;
+
+    uint8_t cts_level_getf(void)
+    {
+        uint32_t localVal = this->m_reg[UCTS_INDEX];
+        ASSERT_ERR((localVal & ~0x0000001F) == 0);
+        return (localVal >> 0);
+    }
+
+    void cts_level_setf(uint8_t ctslevel)
+    {
+        ASSERT_ERR(((ctslevel << 0) & ~0x0000001F) == 0);
+        this->m_reg[UCTS_INDEX] = ctslevel << 0;
+    }
+
+    uint32_t ubr_get(void)
+    {
+        return this->m_reg[UBR_INDEX];
+    }
+
+    void ubr_set(uint32_t value)
+    {
+        this->m_reg[UBR_INDEX] = value;
+    }
+
+    typedef RegField<UBR_INDEX, 0xFFFF0000, 16> ubrinc_field;
+    typedef RegField<UBR_INDEX, 0x0000FFFF, 0> ubrmod_field;
+
+    void ubr_pack(uint16_t ubrinc, uint16_t ubrmod)
+    {
+        ASSERT_ERR(((ubrinc << 16) & ~0xFFFF0000) == 0);
+        ASSERT_ERR(((ubrmod << 0) & ~0x0000FFFF) == 0);
+        this->m_reg[UBR_INDEX] =  (ubrinc << 16) | (ubrmod << 0);
+    }
+
+    void ubr_unpack(uint16_t* ubrinc, uint16_t* ubrmod)
+    {
+        uint32_t localVal = this->m_reg[UBR_INDEX];
+
+        *ubrinc = (localVal & 0xFFFF0000) >> 16;
+        *ubrmod = (localVal & 0x0000FFFF) >> 0;
+    }
+
+    uint16_t ubrinc_getf(void)
+    {
+        uint32_t localVal = this->m_reg[UBR_INDEX];
+        return ((localVal & 0xFFFF0000) >> 16);
+    }
+
+    void ubrinc_setf(uint16_t ubrinc)
+    {
+        ASSERT_ERR(((ubrinc << 16) & ~0xFFFF0000) == 0);
+        this->m_reg[UBR_INDEX] = (this->m_reg[UBR_INDEX] & ~0xFFFF0000) | (ubrinc << 16);
+    }
+
+    uint16_t ubrmod_getf(void)
+    {
+        uint32_t localVal = this->m_reg[UBR_INDEX];
+        return ((localVal & 0x0000FFFF) >> 0);
+    }
+
+    void ubrmod_setf(uint16_t ubrmod)
+    {
+        ASSERT_ERR(((ubrmod << 0) & ~0x0000FFFF) == 0);
+        this->m_reg[UBR_INDEX] = (this->m_reg[UBR_INDEX] & ~0x0000FFFF) | (ubrmod << 0);
+    }
+
+
+protected:
+    /// UCON register read hook
+    uint32_t
+    ucon_rd()
+    {
+        return this->m_reg[UCON_INDEX];
+    }
+
+    /// UCON register write hook
+    void
+    ucon_wr(uint32_t value)
+    {
+        this->m_reg[UCON_INDEX] = value;
+    }
+
+    /// USTAT register read hook
+    uint32_t
+    ustat_rd()
+    {
+        return this->m_reg[USTAT_INDEX];
+    }
+
+    /// USTAT register write hook
+    void
+    ustat_wr(uint32_t value)
+    {
+        TLM_ERR("Write to R/O register USTAT, data = 0x%08X", value);
+    }
+
+    /// UDATA register read hook
+    uint32_t
+    udata_rd()
+    {
+        return this->m_reg[UDATA_INDEX];
+    }
+
+    /// UDATA register write hook
+    void
+    udata_wr(uint32_t value)
+    {
+        this->m_reg[UDATA_INDEX] = value;
+    }
+
+    /// URXCON register read hook
+    uint32_t
+    urxcon_rd()
+    {
+        return this->m_reg[URXCON_INDEX];
+    }
+
+    /// URXCON register write hook
+    void
+    urxcon_wr(uint32_t value)
+    {
+        this->m_reg[URXCON_INDEX] = value;
+    }
+
+    /// UTXCON register read hook
+    uint32_t
+    utxcon_rd()
+    {
+        return this->m_reg[UTXCON_INDEX];
+    }
+
+    /// UTXCON register write hook
+    void
+    utxcon_wr(uint32_t value)
+    {
+        this->m_reg[UTXCON_INDEX] = value;
+    }
+
+    /// UCTS register read hook
+    uint32_t
+    ucts_rd()
+    {
+        return this->m_reg[UCTS_INDEX];
+    }
+
+    /// UCTS register write hook
+    void
+    ucts_wr(uint32_t value)
+    {
+        this->m_reg[UCTS_INDEX] = value;
+    }
+
+    /// UBR register read hook
+    uint32_t
+    ubr_rd()
+    {
+        return this->m_reg[UBR_INDEX];
+    }
+
+    /// UBR register write hook
+    void
+    ubr_wr(uint32_t value)
+    {
+        this->m_reg[UBR_INDEX] = value;
+    }
+
+    /** Register read function, dispatched to the register hooks of the model
+     * @param[in] offset Offset of the register to access
+     * @return The value read
+     */
+    virtual uint32_t
+    reg_rd(uint32_t offset)
+    {
+        MODEL* model = static_cast<MODEL*>(this);
+        uint32_t index = offset/4;
+
+        // sanity check
+        assert(index < REG_UART_COUNT);
+
+        // internal delay
+        this->delay();
+
+        switch (index)
+        {
+        case UCON_INDEX:
+            return model->ucon_rd();
+        case USTAT_INDEX:
+            return model->ustat_rd();
+        case UDATA_INDEX:
+            return model->udata_rd();
+        case URXCON_INDEX:
+            return model->urxcon_rd();
+        case UTXCON_INDEX:
+            return model->utxcon_rd();
+        case UCTS_INDEX:
+            return model->ucts_rd();
+        case UBR_INDEX:
+            return model->ubr_rd();
+        default:
+            return this->m_reg[index];
+        }
+    }
+
+    /** Register write function, dispatched to the register hooks of the model
+     * @param[in] offset Offset of the register to access
+     * @param[in] value Value to write in the register
+     */
+    virtual void
+    reg_wr(uint32_t offset, uint32_t value)
+    {
+        MODEL* model = static_cast<MODEL*>(this);
+        uint32_t index = offset/4;
+
+        // sanity check
+        assert(index < REG_UART_COUNT);
+
+        // internal delay
+        this->delay();
+
+        switch (index)
+        {
+        case UCON_INDEX:
+            model->ucon_wr(value);
+            break;
+        case USTAT_INDEX:
+            model->ustat_wr(value);
+            break;
+        case UDATA_INDEX:
+            model->udata_wr(value);
+            break;
+        case URXCON_INDEX:
+            model->urxcon_wr(value);
+            break;
+        case UTXCON_INDEX:
+            model->utxcon_wr(value);
+            break;
+        case UCTS_INDEX:
+            model->ucts_wr(value);
+            break;
+        case UBR_INDEX:
+            model->ubr_wr(value);
+            break;
+        default:
+            this->m_reg[index] = value;
+            break;
+        }
+    }
+};
 
 #endif // _REG_UART_H_
 
@@ -12,6 +12,15 @@
 #include "tlm_utils/simple_initiator_socket.h"
 #include "tlm_utils/simple_target_socket.h"
 
+// performance report
+#include "Perf/Perf.h"
+
+// timeline of the process activity
+#include "Timeline/Timeline.h"
+
+// memory access heatmap
+#include "Heatmap/Heatmap.h"
+
 /// Used to select debugging (0 = OFF, 1 = ON)
 #define DEBUG_BUS 0
 
@@ -41,6 +50,9 @@ struct Bus : sc_core::sc_module
         // initialize the bus and the current trans
         m_free = true;
         m_one_pending = false;
+        m_transactions = 0;
+        Perf::add_transactions(this->name(), &m_transactions);
+        m_heatmap = Heatmap::add_table(this->name());
 
         for (uint8_t i = 0; i < N_INITIATORS; i++)
         {
@@ -109,6 +121,12 @@ struct Bus : sc_core::sc_module
 
             m_targ_range[id].base = base;
             m_targ_range[id].mask = mask;
+
+            // count the accesses of the target
+            if (m_heatmap != NULL)
+            {
+                m_heat[id] = m_heatmap->add_target(init_socket[id]->name(), base, ~mask + 1);
+            }
             return false;
         }
         else
@@ -171,7 +189,7 @@ private:
                     m_pending[id].is_pending = true;
 
                     // wait to get re-scheduled
-                    wait(m_pending[id].event);
+                    TIMELINE_WAIT(m_pending[id].event);
 
                     // mark the initiator as not pending anymore
                     m_pending[id].is_pending = false;
@@ -191,9 +209,22 @@ private:
 
                 // mark the bus as busy
                 m_free = false;
+                m_transactions++;
 
                 // Forward transaction to appropriate target
-                (*init_socket[target_nr])->b_transport(trans, delay);
+                if (m_heatmap == NULL)
+                {
+                    (*init_socket[target_nr])->b_transport(trans, delay);
+                }
+                else
+                {
+                    sc_core::sc_time start = sc_core::sc_time_stamp() + delay;
+
+                    (*init_socket[target_nr])->b_transport(trans, delay);
+                    m_heatmap->record(m_heatmap->initiator(id), m_heat[target_nr], masked_address,
+                                      trans.is_write(), trans.get_data_length(),
+                                      (sc_core::sc_time_stamp() + delay - start).value());
+                }
 
                 // Replace original address
                 trans.set_address(address);
@@ -208,7 +239,7 @@ private:
                     {
                         if (m_pending[i].is_pending)
                         {
-                            m_pending[i].event.notify();
+                            TIMELINE_NOTIFY(m_pending[i].event);
                             break;
                         }
                     }
@@ -325,6 +356,15 @@ private:
 
     // Indicate that bus is free for a new request.
     bool m_free;
+
+    /// Number of transactions routed
+    uint64_t m_transactions;
+
+    /// Access counters of the heatmap (NULL if not configured)
+    HeatmapTable* m_heatmap;
+
+    /// Target identifier of each target in the access counters
+    int m_heat[N_TARGETS];
 };
 
 #endif /*BUS_H_*/
@@ -7,14 +7,16 @@
 /// debug level
 #define DUMMY_DEBUG_LEVEL 0
 
-/// Macro to print debug messages
+/// Macro to print debug messages (the levels above DUMMY_DEBUG_LEVEL go to the runtime trace)
 /// @param __l level of debug message (0 means always printed)
 /// @param __f format of the debug string
 /// @param ... variable arguments
 #define DUMMY_TLM_DBG(__l, __f, ...)                                                    \
     do {                                                                                \
         if (DUMMY_DEBUG_LEVEL >= __l) {                                                 \
-            TLM_DBG(__f, __VA_ARGS__);                                                  \
+            TLM_DBG(__f, ##__VA_ARGS__);                                                \
+        } else {                                                                        \
+            TLM_TRACE(__l, __f, ##__VA_ARGS__);                                         \
         }                                                                               \
     } while (false)
 
@@ -52,7 +54,7 @@ struct Dummy : Peripheral<REG_DUMMY_COUNT>
         while (1)
         {
             // wait for an event
-            sc_core::wait();
+            TIMELINE_WAIT();
         }
     }
 
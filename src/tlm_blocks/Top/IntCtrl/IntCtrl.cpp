@@ -68,7 +68,7 @@ IntCtrl::reg_wr(uint32_t offset, uint32_t value)
     {
     case REG_INTCTRL_WFI:
         // WFI
-        wait();
+        TIMELINE_WAIT();
         break;
     default:
         m_reg[index] = value;
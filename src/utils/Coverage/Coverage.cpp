@@ -0,0 +1,455 @@
+#include "Coverage/Coverage.h"
+#include "utils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+
+/// Magic of the coverage file
+#define COVERAGE_MAGIC "SOCCOVER"
+
+std::vector<Coverage*> Coverage::s_coverages;
+
+/** Write a JSON string
+ * @param[in] fp File to write
+ * @param[in] value String to write
+ */
+static void
+json_string(FILE* fp, const char* value)
+{
+    fputc('"', fp);
+    for (; *value != '\0'; value++)
+    {
+        if ((*value == '"') || (*value == '\\'))
+        {
+            fputc('\\', fp);
+            fputc(*value, fp);
+        }
+        else if ((unsigned char)*value < 0x20)
+        {
+            fprintf(fp, "\\u%04x", (unsigned char)*value);
+        }
+        else
+        {
+            fputc(*value, fp);
+        }
+    }
+    fputc('"', fp);
+}
+
+Coverage::Coverage(const std::string& elfpath, Parameters& parameters, Parameter& config)
+: m_elfpath(elfpath)
+, m_runs(0)
+{
+    MSP* options = config.get_config();
+    MSP::iterator option;
+    Segment* segment;
+    uint32_t offset;
+
+    // the output files are relative to the configuration file
+    config.add_path(parameters.configpath);
+    m_basename = *config.get_string();
+
+    // line number table of the firmware
+    m_elf.Open(elfpath.c_str(), true);
+
+    // covered regions, the executable segments by default
+    for (option = options->begin(); option != options->end(); option++)
+    {
+        unsigned int base, size;
+
+        if (sscanf(option->second->c_str(), "%i %i", &base, &size) != 2)
+        {
+            SYS_ERR("coverage", "invalid region %s: %s", option->first.c_str(), option->second->c_str());
+        }
+        this->add_region(base, size);
+    }
+    if (options->empty())
+    {
+        while ((segment = m_elf.GetNextSegment()) != NULL)
+        {
+            if (segment->Flags() & PF_X)
+            {
+                this->add_region(segment->Address(), segment->Size());
+            }
+        }
+    }
+    if (m_regions.empty())
+    {
+        SYS_ERR("coverage", "no region to cover in %s", elfpath.c_str());
+    }
+
+    // bitmaps of the regions, in the layout of the coverage file
+    offset = 0;
+    for (size_t i = 0; i < m_regions.size(); i++)
+    {
+        offset += 3 * bitmap_size(m_regions[i].size);
+    }
+    m_bitmaps.assign(offset, 0);
+    offset = 0;
+    for (size_t i = 0; i < m_regions.size(); i++)
+    {
+        uint32_t size = bitmap_size(m_regions[i].size);
+
+        m_regions[i].executed = &m_bitmaps[offset];
+        m_regions[i].passed = &m_bitmaps[offset + size];
+        m_regions[i].failed = &m_bitmaps[offset + 2 * size];
+        offset += 3 * size;
+    }
+
+    // the coverage is written whatever the way the simulation ends
+    if (s_coverages.empty())
+    {
+        atexit(&Coverage::close);
+    }
+    s_coverages.push_back(this);
+}
+
+void
+Coverage::add_region(uint32_t base, uint32_t size)
+{
+    region r;
+
+    // regions are halfword aligned
+    r.base = base & ~1;
+    r.size = (size + (base & 1) + 1) & ~1;
+    r.executed = NULL;
+    r.passed = NULL;
+    r.failed = NULL;
+    if (r.size == 0)
+    {
+        return;
+    }
+    for (size_t i = 0; i < m_regions.size(); i++)
+    {
+        if (((r.base - m_regions[i].base) < m_regions[i].size) ||
+            ((m_regions[i].base - r.base) < r.size))
+        {
+            SYS_ERR("coverage", "region 0x%08X overlaps region 0x%08X", r.base, m_regions[i].base);
+        }
+    }
+    m_regions.push_back(r);
+}
+
+uint32_t
+Coverage::bitmap_size(uint32_t size)
+{
+    return ((size >> 1) + 7) >> 3;
+}
+
+bool
+Coverage::test(const uint8_t* bitmap, uint32_t offset)
+{
+    offset >>= 1;
+    return (bitmap[offset >> 3] >> (offset & 7)) & 1;
+}
+
+void
+Coverage::close()
+{
+    for (size_t i = 0; i < s_coverages.size(); i++)
+    {
+        Coverage* coverage = s_coverages[i];
+
+        coverage->merge();
+        coverage->annotate();
+        coverage->write_lcov();
+        coverage->write_json();
+    }
+    s_coverages.clear();
+}
+
+void
+Coverage::merge()
+{
+    std::string path = m_basename + ".cov";
+    std::vector<uint32_t> header;
+    std::vector<uint8_t> previous;
+    bool valid;
+    int fd;
+
+    // layout of the file: magic, version, number of regions, number of runs, regions
+    // (base, size) and the bitmaps
+    header.resize(2 + 3);
+    memcpy(&header[0], COVERAGE_MAGIC, 8);
+    header[2] = COVERAGE_VERSION;
+    header[3] = m_regions.size();
+    for (size_t i = 0; i < m_regions.size(); i++)
+    {
+        header.push_back(m_regions[i].base);
+        header.push_back(m_regions[i].size);
+    }
+
+    // the file is shared by the parallel runs
+    fd = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0)
+    {
+        fprintf(stderr, "coverage: can not open coverage file %s\n", path.c_str());
+        return;
+    }
+    flock(fd, LOCK_EX);
+
+    // merge the bitmaps of the previous runs, when covering the same regions
+    previous.resize(header.size() * sizeof(uint32_t) + m_bitmaps.size());
+    valid = read(fd, &previous[0], previous.size()) == (ssize_t)previous.size();
+    if (valid)
+    {
+        uint32_t runs;
+
+        memcpy(&runs, &previous[4 * sizeof(uint32_t)], sizeof(runs));
+        header[4] = runs;
+        valid = memcmp(&previous[0], &header[0], header.size() * sizeof(uint32_t)) == 0;
+    }
+    if (valid)
+    {
+        const uint8_t* bitmaps = &previous[header.size() * sizeof(uint32_t)];
+
+        m_runs = header[4];
+        for (size_t i = 0; i < m_bitmaps.size(); i++)
+        {
+            m_bitmaps[i] |= bitmaps[i];
+        }
+    }
+    else if (lseek(fd, 0, SEEK_END) != 0)
+    {
+        fprintf(stderr, "coverage: %s covers other regions, previous runs discarded\n", path.c_str());
+    }
+    m_runs++;
+    header[4] = m_runs;
+
+    // write back the merged bitmaps
+    if ((lseek(fd, 0, SEEK_SET) != 0) ||
+        (write(fd, &header[0], header.size() * sizeof(uint32_t)) != (ssize_t)(header.size() * sizeof(uint32_t))) ||
+        (write(fd, &m_bitmaps[0], m_bitmaps.size()) != (ssize_t)m_bitmaps.size()) ||
+        (ftruncate(fd, header.size() * sizeof(uint32_t) + m_bitmaps.size()) != 0))
+    {
+        fprintf(stderr, "coverage: can not write coverage file %s\n", path.c_str());
+    }
+    flock(fd, LOCK_UN);
+    ::close(fd);
+}
+
+bool
+Coverage::is_executed(uint32_t pc, bool& covered)
+{
+    region* r = this->find(pc);
+
+    covered = (r != NULL);
+    return covered && test(r->executed, pc - r->base);
+}
+
+bool
+Coverage::collect(uint32_t start, uint32_t end, SourceLine& line)
+{
+    bool covered = false;
+
+    for (size_t i = 0; i < m_regions.size(); i++)
+    {
+        const region& r = m_regions[i];
+        uint32_t first, last;
+
+        // part of the range inside the region
+        first = (start > r.base) ? start - r.base : 0;
+        last = ((end - r.base) < r.size) ? end - r.base : r.size;
+        if ((end <= r.base) || (start >= r.base + r.size) || (first >= last))
+        {
+            continue;
+        }
+        covered = true;
+
+        for (uint32_t offset = first & ~1; offset < last; offset += 2)
+        {
+            if (test(r.executed, offset))
+            {
+                line.executed = true;
+            }
+            if (test(r.passed, offset) || test(r.failed, offset))
+            {
+                line.branches.push_back(std::make_pair(test(r.passed, offset), test(r.failed, offset)));
+            }
+        }
+    }
+    return covered;
+}
+
+void
+Coverage::annotate()
+{
+    // lines: each entry of the table covers the addresses up to the next entry
+    for (int i = 0; i + 1 < m_elf.LinesNum(); i++)
+    {
+        const Line* entry = m_elf.GetLine(i);
+        SourceLine line;
+
+        if (entry->File() == NULL)
+        {
+            continue;
+        }
+        line.executed = false;
+        if (this->collect(entry->Address(), m_elf.GetLine(i + 1)->Address(), line))
+        {
+            std::map<uint32_t, SourceLine>& lines = m_files[entry->File()].lines;
+            std::map<uint32_t, SourceLine>::iterator found = lines.find(entry->Number());
+
+            // the instructions of a line can be spread over several entries
+            if (found == lines.end())
+            {
+                lines[entry->Number()] = line;
+            }
+            else
+            {
+                found->second.executed |= line.executed;
+                found->second.branches.insert(found->second.branches.end(), line.branches.begin(), line.branches.end());
+            }
+        }
+    }
+
+    // functions: the entry point gives the line and the execution
+    for (int i = 0; i < m_elf.SymbolsNum(); i++)
+    {
+        const Symbol* symbol = m_elf.GetSymbol(i);
+        const Line* entry = m_elf.FindLine(symbol->Address());
+        Function function;
+        bool covered;
+
+        function.name = symbol->Name();
+        function.executed = this->is_executed(symbol->Address(), covered);
+        if ((entry == NULL) || (entry->File() == NULL) || !covered)
+        {
+            continue;
+        }
+        function.line = entry->Number();
+        m_files[entry->File()].functions.push_back(function);
+    }
+}
+
+void
+Coverage::write_lcov()
+{
+    std::map<std::string, SourceFile>::const_iterator file;
+    std::string path = m_basename + ".info";
+    FILE* fp;
+
+    fp = fopen(path.c_str(), "w");
+    if (fp == NULL)
+    {
+        fprintf(stderr, "coverage: can not create lcov file %s\n", path.c_str());
+        return;
+    }
+
+    fprintf(fp, "TN:\n");
+    for (file = m_files.begin(); file != m_files.end(); file++)
+    {
+        std::map<uint32_t, SourceLine>::const_iterator line;
+        int found = 0, hit = 0, brfound = 0, brhit = 0, fnhit = 0;
+
+        fprintf(fp, "SF:%s\n", file->first.c_str());
+
+        // functions
+        for (size_t i = 0; i < file->second.functions.size(); i++)
+        {
+            const Function& function = file->second.functions[i];
+
+            fprintf(fp, "FN:%u,%s\n", function.line, function.name);
+        }
+        for (size_t i = 0; i < file->second.functions.size(); i++)
+        {
+            const Function& function = file->second.functions[i];
+
+            fprintf(fp, "FNDA:%d,%s\n", function.executed ? 1 : 0, function.name);
+            fnhit += function.executed ? 1 : 0;
+        }
+        fprintf(fp, "FNF:%d\n", (int)file->second.functions.size());
+        fprintf(fp, "FNH:%d\n", fnhit);
+
+        // branches: one block per conditional instruction, passed then failed
+        for (line = file->second.lines.begin(); line != file->second.lines.end(); line++)
+        {
+            for (size_t i = 0; i < line->second.branches.size(); i++)
+            {
+                fprintf(fp, "BRDA:%u,%d,0,%d\n", line->first, (int)i, line->second.branches[i].first ? 1 : 0);
+                fprintf(fp, "BRDA:%u,%d,1,%d\n", line->first, (int)i, line->second.branches[i].second ? 1 : 0);
+                brfound += 2;
+                brhit += (line->second.branches[i].first ? 1 : 0) + (line->second.branches[i].second ? 1 : 0);
+            }
+        }
+        fprintf(fp, "BRF:%d\n", brfound);
+        fprintf(fp, "BRH:%d\n", brhit);
+
+        // lines
+        for (line = file->second.lines.begin(); line != file->second.lines.end(); line++)
+        {
+            fprintf(fp, "DA:%u,%d\n", line->first, line->second.executed ? 1 : 0);
+            found++;
+            hit += line->second.executed ? 1 : 0;
+        }
+        fprintf(fp, "LF:%d\n", found);
+        fprintf(fp, "LH:%d\n", hit);
+        fprintf(fp, "end_of_record\n");
+    }
+    fclose(fp);
+}
+
+void
+Coverage::write_json()
+{
+    std::map<std::string, SourceFile>::const_iterator file;
+    std::string path = m_basename + ".json";
+    FILE* fp;
+
+    fp = fopen(path.c_str(), "w");
+    if (fp == NULL)
+    {
+        fprintf(stderr, "coverage: can not create gcov file %s\n", path.c_str());
+        return;
+    }
+
+    fprintf(fp, "{\"format_version\": \"1\", \"gcc_version\": \"\", \"current_working_directory\": \"\", ");
+    fprintf(fp, "\"data_file\": ");
+    json_string(fp, m_elfpath.c_str());
+    fprintf(fp, ", \"runs\": %u, \"files\": [", m_runs);
+    for (file = m_files.begin(); file != m_files.end(); file++)
+    {
+        std::map<uint32_t, SourceLine>::const_iterator line;
+
+        fprintf(fp, "%s\n{\"file\": ", (file == m_files.begin()) ? "" : ",");
+        json_string(fp, file->first.c_str());
+
+        fprintf(fp, ", \"functions\": [");
+        for (size_t i = 0; i < file->second.functions.size(); i++)
+        {
+            const Function& function = file->second.functions[i];
+
+            fprintf(fp, "%s{\"name\": ", (i == 0) ? "" : ", ");
+            json_string(fp, function.name);
+            fprintf(fp, ", \"demangled_name\": ");
+            json_string(fp, function.name);
+            fprintf(fp, ", \"start_line\": %u, \"start_column\": 0, \"end_line\": %u, \"end_column\": 0",
+                    function.line, function.line);
+            fprintf(fp, ", \"blocks\": 1, \"blocks_executed\": %d, \"execution_count\": %d}",
+                    function.executed ? 1 : 0, function.executed ? 1 : 0);
+        }
+
+        fprintf(fp, "], \"lines\": [");
+        for (line = file->second.lines.begin(); line != file->second.lines.end(); line++)
+        {
+            fprintf(fp, "%s\n {\"line_number\": %u, \"count\": %d, \"unexecuted_block\": %s, \"branches\": [",
+                    (line == file->second.lines.begin()) ? "" : ",", line->first,
+                    line->second.executed ? 1 : 0, line->second.executed ? "false" : "true");
+            for (size_t i = 0; i < line->second.branches.size(); i++)
+            {
+                fprintf(fp, "%s{\"count\": %d, \"fallthrough\": false, \"throw\": false}, "
+                        "{\"count\": %d, \"fallthrough\": true, \"throw\": false}",
+                        (i == 0) ? "" : ", ", line->second.branches[i].first ? 1 : 0,
+                        line->second.branches[i].second ? 1 : 0);
+            }
+            fprintf(fp, "]}");
+        }
+        fprintf(fp, "]}");
+    }
+    fprintf(fp, "]}\n");
+    fclose(fp);
+}
@@ -0,0 +1,157 @@
+#ifndef COVERAGE_H_
+#define COVERAGE_H_
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+#include <map>
+
+#include "Parameters.h"
+
+// line number table
+#include "ElfReader/ElfReader.h"
+
+// coverage bitmaps
+#include "arm.h"
+
+/// Version of the coverage file format
+#define COVERAGE_VERSION 1
+
+/** Code coverage of the firmware executed by an ARM core.
+ * Each halfword of the covered regions has three bits: instruction executed, condition
+ * passed and condition failed (conditional ARM instructions and Thumb conditional
+ * branches).  The bitmaps are cheap enough to be always enabled in regression runs.
+ *
+ * The coverage is configured from the CPU configuration:
+ * <pre>
+ * coverage firmware
+ *     rom 0x00000000 0x18000
+ *     flash 0x00400000 0x20000
+ * </pre>
+ * where the value gives the base name of the files written at exit, and the optional
+ * sub-parameters the covered regions (name, base address and size).  Without region,
+ * the executable segments of the ELF file are covered.  At exit:
+ *  - firmware.cov, the raw bitmaps, is merged with the bitmaps of the previous runs (the
+ *    file is locked, so parallel runs can share it)
+ *  - firmware.info (lcov tracefile) and firmware.json (gcov JSON format) are exported
+ *    from the merged bitmaps and the line number table of the ELF file
+ */
+struct Coverage : arm_coverage
+{
+    /** Constructor
+     * @param[in] elfpath ELF file executed by the core
+     * @param[in] parameters Command line parameters
+     * @param[in] config Coverage parameter of the CPU configuration
+     */
+    Coverage(const std::string& elfpath, Parameters& parameters, Parameter& config);
+
+    /// Merge and export the bitmaps of all the coverages
+    static void
+    close();
+
+private:
+    /// Coverage of a source line
+    struct SourceLine
+    {
+        /// At least one instruction executed
+        bool executed;
+        /// Outcomes of the conditional instructions of the line (passed, failed)
+        std::vector<std::pair<bool, bool> > branches;
+    };
+
+    /// Coverage of a function
+    struct Function
+    {
+        /// Function name
+        const char* name;
+        /// Line of the entry point
+        uint32_t line;
+        /// Entry point executed
+        bool executed;
+    };
+
+    /// Coverage of a source file
+    struct SourceFile
+    {
+        /// Lines, indexed by number
+        std::map<uint32_t, SourceLine> lines;
+        /// Functions
+        std::vector<Function> functions;
+    };
+
+    /** Add a covered region
+     * @param[in] base Start address of the region
+     * @param[in] size Size of the region in bytes
+     */
+    void
+    add_region(uint32_t base, uint32_t size);
+
+    /** Get the size of a bitmap of a region
+     * @param[in] size Size of the region in bytes
+     * @return The size of the bitmap in bytes
+     */
+    static uint32_t
+    bitmap_size(uint32_t size);
+
+    /** Test the bit of a halfword in a bitmap
+     * @param[in] bitmap Bitmap to test
+     * @param[in] offset Offset of the halfword in the region
+     * @return true if the bit is set
+     */
+    static bool
+    test(const uint8_t* bitmap, uint32_t offset);
+
+    /// Merge the bitmaps with the coverage file of the previous runs
+    void
+    merge();
+
+    /** Collect the coverage of an address range
+     * @param[in] start Start address of the range
+     * @param[in] end End address of the range (excluded)
+     * @param[in, out] line Coverage of the source line of the range
+     * @return true if the range is covered
+     */
+    bool
+    collect(uint32_t start, uint32_t end, SourceLine& line);
+
+    /** Check if an instruction was executed
+     * @param[in] pc Address of the instruction
+     * @param[out] covered Indicates if the address is in a covered region
+     * @return true if the instruction was executed
+     */
+    bool
+    is_executed(uint32_t pc, bool& covered);
+
+    /// Build the coverage of the source files from the line number table
+    void
+    annotate();
+
+    /// Write the coverage in lcov tracefile format
+    void
+    write_lcov();
+
+    /// Write the coverage in gcov JSON format
+    void
+    write_json();
+
+    /// ELF file executed
+    std::string m_elfpath;
+    /// Base name of the output files
+    std::string m_basename;
+    /// Symbols and line number table of the ELF file
+    ElfReader m_elf;
+
+    /// Storage of the bitmaps
+    std::vector<uint8_t> m_bitmaps;
+    /// Number of runs merged in the coverage file
+    uint32_t m_runs;
+
+    /// Coverage of the source files, indexed by name
+    std::map<std::string, SourceFile> m_files;
+
+    /// All the coverages, written at exit
+    static std::vector<Coverage*> s_coverages;
+};
+
+#endif /*COVERAGE_H_*/
@@ -33,6 +33,12 @@
  *     ... Segment->Data() copied at Segment->Size()
  * }
  * @endcode
+ *
+ * When opened with the index, the reader also provides the address to function
+ * (ElfReader::FindSymbol()) and address to source line (ElfReader::FindLine())
+ * lookups, built from the symbol table and the .debug_line section.  The index is
+ * cached next to the ELF file (file.elf.idx) and reused as long as the ELF file is
+ * not modified.
  * 
  * @see ElfReader
  * @see Segment
@@ -49,6 +55,8 @@
 #include <fcntl.h>
 // data returned by the stat() function
 #include <sys/stat.h>
+// close()
+#include <unistd.h>
 // memory management declarations
 #include <sys/mman.h>
 // verify program assertion
@@ -58,6 +66,12 @@
 // ELF declarations
 #include <elf.h>
 
+// symbol and line index
+#include <vector>
+#include <map>
+#include <string>
+#include <algorithm>
+
 
 // for SYS_ERR
 #include "utils.h"
@@ -72,6 +86,12 @@
 #define elfreader_dbg(...)
 #endif
 
+/// Version of the index cache file
+#define ELFREADER_CACHE_VERSION 2
+
+/// No string in the index (offset in the string pool)
+#define ELFREADER_NO_STRING 0xFFFFFFFF
+
 /** @brief Class representing a loadable segment of an ELF file
  * Contains all the relevant information concerning a loadable segment of an ELF file.
  * This information is extracted from the program headers of the ELF file.
@@ -86,15 +106,18 @@ private:
     int m_Size;
     /// Segment data address in system memory
     uint32_t m_Address;
+    /// Segment permissions (PF_X, PF_W, PF_R)
+    uint32_t m_Flags;
 
 public:
     /** Default constructor
      * @param[in, out] Data Pointer to the data of the segment to create
      * @param[in] Size Size of the Segment
      * @param[in] Address Address of the segment in memory
+     * @param[in] Flags Permissions of the segment
      */
-    Segment(char* Data, int Size, uint32_t Address) :
-        m_Data(Data), m_Size(Size), m_Address(Address)
+    Segment(char* Data, int Size, uint32_t Address, uint32_t Flags = 0) :
+        m_Data(Data), m_Size(Size), m_Address(Address), m_Flags(Flags)
     {
     }
     
@@ -129,6 +152,169 @@ public:
     {
         return m_Address;
     }
+
+    /// Retrieve the segment permissions (PF_X for code)
+    uint32_t Flags(void)
+    {
+        return m_Flags;
+    }
+};
+
+/** @brief Class representing a function symbol of an ELF file
+ * Contains the address range and the name of a function, as found in the symbol table
+ * of the ELF file.
+ * @see ElfReader::FindSymbol()
+ */
+class Symbol
+{
+private:
+    /// Start address of the function (Thumb bit cleared)
+    uint32_t m_Address;
+    /// End address of the function (excluded)
+    uint32_t m_End;
+    /// Name of the function (in the string table of the ELF file)
+    const char* m_Name;
+
+public:
+    /** Default constructor
+     * @param[in] Address Start address of the function
+     * @param[in] End End address of the function (excluded)
+     * @param[in] Name Name of the function
+     */
+    Symbol(uint32_t Address, uint32_t End, const char* Name) :
+        m_Address(Address), m_End(End), m_Name(Name)
+    {
+    }
+
+    /// Retrieve the start address of the function
+    uint32_t Address(void) const
+    {
+        return m_Address;
+    }
+
+    /// Retrieve the end address of the function (excluded)
+    uint32_t End(void) const
+    {
+        return m_End;
+    }
+
+    /** @brief Retrieve the name of the function
+     * The name points to a location in the ELF file, it remains valid as long as the
+     * ElfReader instance exists.
+     */
+    const char* Name(void) const
+    {
+        return m_Name;
+    }
+
+    /// Symbols are sorted by address
+    bool operator<(const Symbol& other) const
+    {
+        return m_Address < other.m_Address;
+    }
+};
+
+/** @brief Class representing a section of an ELF file
+ * @see ElfReader::FindSection()
+ */
+class Section
+{
+private:
+    /// Section name (in the section names table of the ELF file)
+    const char* m_Name;
+    /// Section data pointer (NULL if the section has no data in the file)
+    char* m_Data;
+    /// Section size
+    uint32_t m_Size;
+    /// Section address in system memory
+    uint32_t m_Address;
+
+public:
+    /** Default constructor
+     * @param[in] Name Name of the section
+     * @param[in] Data Pointer to the data of the section
+     * @param[in] Size Size of the section
+     * @param[in] Address Address of the section in memory
+     */
+    Section(const char* Name, char* Data, uint32_t Size, uint32_t Address) :
+        m_Name(Name), m_Data(Data), m_Size(Size), m_Address(Address)
+    {
+    }
+
+    /// Retrieve the section name
+    const char* Name(void) const
+    {
+        return m_Name;
+    }
+
+    /// Retrieve the section data pointer (in the mapped ELF file)
+    char* Data(void) const
+    {
+        return m_Data;
+    }
+
+    /// Retrieve the section size
+    uint32_t Size(void) const
+    {
+        return m_Size;
+    }
+
+    /// Retrieve the section system address
+    uint32_t Address(void) const
+    {
+        return m_Address;
+    }
+};
+
+/** @brief Class representing an entry of the line number table of an ELF file
+ * The entry covers the addresses up to the next entry.  The entries marking the end
+ * of a sequence of instructions have no file.
+ * @see ElfReader::FindLine()
+ */
+class Line
+{
+private:
+    /// Start address of the entry
+    uint32_t m_Address;
+    /// Source line number
+    uint32_t m_Number;
+    /// Source file name (NULL at the end of a sequence)
+    const char* m_File;
+
+public:
+    /** Default constructor
+     * @param[in] Address Start address of the entry
+     * @param[in] File Source file name
+     * @param[in] Number Source line number
+     */
+    Line(uint32_t Address, const char* File, uint32_t Number) :
+        m_Address(Address), m_Number(Number), m_File(File)
+    {
+    }
+
+    /// Retrieve the start address of the entry
+    uint32_t Address(void) const
+    {
+        return m_Address;
+    }
+
+    /// Retrieve the source file name, NULL at the end of a sequence
+    const char* File(void) const
+    {
+        return m_File;
+    }
+
+    /// Retrieve the source line number
+    uint32_t Number(void) const
+    {
+        return m_Number;
+    }
+
+    /// Entries are sorted by address
+    bool operator<(const Line& other) const
+    {
+        return m_Address < other.m_Address;
+    }
 };
 
 /** @brief Class representing an ELF file
@@ -144,13 +330,56 @@ private:
     /// Pointer to the memory area where the ELF file content is mmap'd
     void* m_MmapBuf;
     /// Size of the memory area where the ELF file is mmap'd
-    int m_MmapSize;
-    /// Contains the number of segments in the ELF file
-    int m_SegmentsNum;
-    /// Contains the number of segments in the ELF file
+    size_t m_MmapSize;
+    /// Contains the index of the next segment to retrieve
     int m_CurrentSegment;
     /// Array of the segments in the ELF file
-    Segment** m_Segments;
+    std::vector<Segment> m_Segments;
+    /// Array of the sections in the ELF file
+    std::vector<Section> m_Sections;
+    /// Function symbols of the ELF file, sorted by address
+    std::vector<Symbol> m_Symbols;
+    /// Line number table of the ELF file, sorted by address
+    std::vector<Line> m_Lines;
+    /// Names of the symbols and of the source files
+    std::vector<char> m_Strings;
+
+    /// Function symbol in the index (as stored in the cache file)
+    struct SymbolRecord
+    {
+        uint32_t Address;
+        uint32_t End;
+        uint32_t Name;
+    };
+
+    /// Line number table entry in the index (as stored in the cache file)
+    struct LineRecord
+    {
+        uint32_t Address;
+        uint32_t File;
+        uint32_t Number;
+
+        /// The end of a sequence goes before the start of the next one
+        bool operator<(const LineRecord& other) const
+        {
+            return (Address < other.Address) ||
+                ((Address == other.Address) && (File == ELFREADER_NO_STRING) &&
+                 (other.File != ELFREADER_NO_STRING));
+        }
+    };
+
+    /// Header of the index cache file
+    struct CacheHeader
+    {
+        char Magic[8];
+        uint32_t Version;
+        uint32_t SymbolsNum;
+        uint32_t LinesNum;
+        uint32_t StringsSize;
+        uint64_t ElfSize;
+        uint64_t ElfTime;
+        uint64_t ElfTimeNsec;
+    };
     
 public:
     /** @brief Default constructor
@@ -159,7 +388,7 @@ public:
      * is performed during this phase.
      */
     ElfReader() :
-        m_Fd(-1), m_MmapBuf(NULL), m_MmapSize(0), m_SegmentsNum(0), m_CurrentSegment(0)
+        m_Fd(-1), m_MmapBuf(NULL), m_MmapSize(0), m_CurrentSegment(0)
     {
     }
 
@@ -169,8 +398,6 @@ public:
      */
     ~ElfReader()
     {
-        int i;
-
         // check if the file was successfully opened
         if (m_Fd != -1)
         {
@@ -182,16 +409,6 @@ public:
             }
             // close the file
             close(m_Fd);
-
-
-            // destroy the Segment instances
-            for (i = 0; i < m_SegmentsNum; i++)
-            {
-                delete m_Segments[i];
-            }
-
-            // destroy the array of Segments
-            delete [] m_Segments;
         }
     }
 
@@ -202,15 +419,18 @@ public:
      * @warning If the user omits to call this function, no segments can be retrieved but
      * this mistake is handled and can not lead to a crash
      * @param[in] file Name of the ELF file to parse
+     * @param[in] index Indicates if the symbol and line index must be built
      * @see ElfReader::GetNextSegment()
      */
-    void Open(const char* file)
+    void Open(const char* file, bool index = false)
     {
         int i;
         struct stat stat;
         Elf32_Ehdr* Ehdr;
         Elf32_Phdr* Phdr;
         Elf32_Shdr* Shdr;
+        const char* Names;
+        uint32_t NamesSize;
 
         // print information
         elfreader_dbg("elfreader:\n");
@@ -236,6 +456,11 @@ public:
         {
             SYS_ERR("ElfReader.Open", "ERROR: mmap (%s)", strerror(errno));
         }
+        // check that the file contains at least the header
+        if (m_MmapSize < sizeof(Elf32_Ehdr))
+        {
+            SYS_ERR("ElfReader.Open", "ERROR: file too small (%d)", (int)m_MmapSize);
+        }
         // check that the specified file is elf
         if ((Ehdr->e_ident[EI_MAG0]!=ELFMAG0)||(Ehdr->e_ident[EI_MAG1]!=ELFMAG1)||
             (Ehdr->e_ident[EI_MAG2]!=ELFMAG2)||(Ehdr->e_ident[EI_MAG3]!=ELFMAG3))
@@ -336,12 +561,21 @@ public:
         }
         assert(Ehdr->e_phoff!=0);
 
-        // parse the program headers
+        // check that the headers are inside the file
+        if (!this->InFile(Ehdr->e_phoff, Ehdr->e_phentsize * Ehdr->e_phnum) ||
+            !this->InFile(Ehdr->e_shoff, Ehdr->e_shentsize * Ehdr->e_shnum) ||
+            (Ehdr->e_phentsize < sizeof(Elf32_Phdr)) ||
+            ((Ehdr->e_shnum != 0) && (Ehdr->e_shentsize < sizeof(Elf32_Shdr))))
+        {
+            SYS_ERR("ElfReader.Open", "ERROR: headers outside of the file (%s)", file);
+        }
+
+        // parse the program headers and fill the array of segments
         for (i = 0; i < Ehdr->e_phnum; i++)
         {
             elfreader_dbg("  - segment %d:\n", i);
             // map the program header
-            Phdr = (Elf32_Phdr*)((uint32_t)Ehdr + Ehdr->e_phoff + (Ehdr->e_phentsize * i));
+            Phdr = (Elf32_Phdr*)((char*)Ehdr + Ehdr->e_phoff + (Ehdr->e_phentsize * i));
 
             // print the program header
             elfreader_dbg("    + offset: 0x%x\n", Phdr->p_offset);
@@ -353,14 +587,35 @@ public:
             elfreader_dbg("    + flags: 0x%08X\n", Phdr->p_flags);
             elfreader_dbg("    + align: %d\n", Phdr->p_align);
 
+            // check that the data is inside the file
+            if (!this->InFile(Phdr->p_offset, Phdr->p_filesz))
+            {
+                SYS_ERR("ElfReader.Open", "ERROR: segment %d outside of the file", i);
+            }
+
+            m_Segments.push_back(Segment((char*)Ehdr + Phdr->p_offset, Phdr->p_filesz, Phdr->p_vaddr,
+                                         Phdr->p_flags));
+        }
+
+        // retrieve the section names table
+        Names = NULL;
+        NamesSize = 0;
+        if (Ehdr->e_shstrndx < Ehdr->e_shnum)
+        {
+            Shdr = (Elf32_Shdr*)((char*)Ehdr + Ehdr->e_shoff + (Ehdr->e_shentsize * Ehdr->e_shstrndx));
+            if (this->InFile(Shdr->sh_offset, Shdr->sh_size))
+            {
+                Names = (char*)Ehdr + Shdr->sh_offset;
+                NamesSize = Shdr->sh_size;
+            }
         }
 
-        // parse section headers
+        // parse section headers and fill the array of sections
         for (i = 0; i < Ehdr->e_shnum; i++)
         {
             elfreader_dbg("  - section %d:\n", i);
             // map the section header
-            Shdr = (Elf32_Shdr*)((uint32_t)Ehdr + Ehdr->e_shoff + (Ehdr->e_shentsize * i));
+            Shdr = (Elf32_Shdr*)((char*)Ehdr + Ehdr->e_shoff + (Ehdr->e_shentsize * i));
 
             // print the section header
             elfreader_dbg("    + name index: %d\n", Shdr->sh_name);
@@ -373,27 +628,35 @@ public:
             elfreader_dbg("    + info: %d\n", Shdr->sh_info);
             elfreader_dbg("    + align: %d\n", Shdr->sh_addralign);
             elfreader_dbg("    + entry size: %d\n", Shdr->sh_entsize);
-        }
 
-        // initialize the number of segments
-        m_SegmentsNum = Ehdr->e_phnum;
+            // the sections without data in the file (.bss) have no data pointer
+            if ((Shdr->sh_type != SHT_NOBITS) && !this->InFile(Shdr->sh_offset, Shdr->sh_size))
+            {
+                SYS_ERR("ElfReader.Open", "ERROR: section %d outside of the file", i);
+            }
+            m_Sections.push_back(Section(
+                    (Shdr->sh_name < NamesSize) ? Names + Shdr->sh_name : "",
+                    (Shdr->sh_type != SHT_NOBITS) ? (char*)Ehdr + Shdr->sh_offset : NULL,
+                    Shdr->sh_size, Shdr->sh_addr));
+        }
 
-        // allocate the array of Segment pointers
-        m_Segments = new Segment * [m_SegmentsNum];
+        elfreader_dbg("  - number of segments: %d\n", (int)m_Segments.size());
 
-        // fill the arrays
-        for (i=0; i < Ehdr->e_phnum; i++)
+        // build the symbol and line index, or reuse the one of the last run
+        if (index)
         {
-            // map the program header
-            Phdr = (Elf32_Phdr*)((uint32_t)Ehdr + Ehdr->e_phoff + (Ehdr->e_phentsize * i));
+            std::string cache = std::string(file) + ".idx";
+            std::vector<SymbolRecord> symbols;
+            std::vector<LineRecord> lines;
 
-            m_Segments[i] = new Segment((char*)Ehdr + Phdr->p_offset, Phdr->p_filesz, Phdr->p_vaddr);
-
-            elfreader_dbg("  - segment %d: %d bytes at 0x%08X\n", i, m_Segments[i]->Size(),
-                    (int)m_Segments[i]->Address());
+            if (!this->LoadCache(cache, stat, symbols, lines))
+            {
+                this->ReadSymbols(Ehdr, symbols);
+                this->ReadLines(lines);
+                this->SaveCache(cache, stat, symbols, lines);
+            }
+            this->Resolve(symbols, lines);
         }
-
-        elfreader_dbg("  - number of segments: %d\n", m_SegmentsNum);
     }
 
     /** Retrieve the next segment in the ELF file
@@ -405,10 +668,10 @@ public:
     Segment* GetNextSegment()
     {
         // check if the current segment is within boundaries
-        if (m_CurrentSegment < m_SegmentsNum)
+        if (m_CurrentSegment < (int)m_Segments.size())
         {
             // return the current segment pointer and increment the index
-            return m_Segments[m_CurrentSegment++];
+            return &m_Segments[m_CurrentSegment++];
         }
         else
         {
@@ -416,6 +679,815 @@ public:
             return NULL;
         }
     }
+
+    /** Find a section by name
+     * @param[in] Name Name of the section
+     * @return Pointer to the Section instance or NULL if there is no such section
+     */
+    const Section* FindSection(const char* Name) const
+    {
+        for (size_t i = 0; i < m_Sections.size(); i++)
+        {
+            if (strcmp(m_Sections[i].Name(), Name) == 0)
+            {
+                return &m_Sections[i];
+            }
+        }
+        return NULL;
+    }
+
+    /** Find the function containing an address
+     * @warning If the Open method has not been called or the ELF file has no symbol
+     * table, this function always returns NULL.
+     * @param[in] Address Address to look for
+     * @return Pointer to the Symbol instance or NULL if no function contains the address
+     */
+    const Symbol* FindSymbol(uint32_t Address) const
+    {
+        std::vector<Symbol>::const_iterator i;
+
+        // first symbol starting after the address
+        i = std::upper_bound(m_Symbols.begin(), m_Symbols.end(), Symbol(Address, 0, NULL));
+        if (i == m_Symbols.begin())
+        {
+            return NULL;
+        }
+        --i;
+
+        // check that the address is inside the function
+        if (Address >= i->End())
+        {
+            return NULL;
+        }
+        return &(*i);
+    }
+
+    /// Retrieve the number of function symbols
+    int SymbolsNum(void) const
+    {
+        return m_Symbols.size();
+    }
+
+    /** Retrieve a function symbol by index, the symbols are sorted by address
+     * @param[in] Index Index of the symbol
+     * @return Pointer to the Symbol instance
+     */
+    const Symbol* GetSymbol(int Index) const
+    {
+        return &m_Symbols[Index];
+    }
+
+    /** Find the source line of an address
+     * @warning If the Open method has not been called with the index or the ELF file
+     * has no line number table, this function always returns NULL.
+     * @param[in] Address Address to look for
+     * @return Pointer to the Line instance or NULL if the address has no source line
+     */
+    const Line* FindLine(uint32_t Address) const
+    {
+        std::vector<Line>::const_iterator i;
+
+        // first entry starting after the address
+        i = std::upper_bound(m_Lines.begin(), m_Lines.end(), Line(Address, NULL, 0));
+        if (i == m_Lines.begin())
+        {
+            return NULL;
+        }
+        --i;
+
+        // check that the address is not after the end of a sequence
+        if (i->File() == NULL)
+        {
+            return NULL;
+        }
+        return &(*i);
+    }
+
+    /// Retrieve the number of entries of the line number table
+    int LinesNum(void) const
+    {
+        return m_Lines.size();
+    }
+
+    /** Retrieve an entry of the line number table by index, the entries are sorted
+     * by address
+     * @param[in] Index Index of the entry
+     * @return Pointer to the Line instance
+     */
+    const Line* GetLine(int Index) const
+    {
+        return &m_Lines[Index];
+    }
+
+private:
+    /// DWARF line number program opcodes
+    enum
+    {
+        DW_LNS_copy = 1,
+        DW_LNS_advance_pc = 2,
+        DW_LNS_advance_line = 3,
+        DW_LNS_set_file = 4,
+        DW_LNS_const_add_pc = 8,
+        DW_LNS_fixed_advance_pc = 9,
+
+        DW_LNE_end_sequence = 1,
+        DW_LNE_set_address = 2,
+        DW_LNE_define_file = 3,
+
+        DW_LNCT_path = 1,
+        DW_LNCT_directory_index = 2,
+
+        DW_FORM_data2 = 0x05,
+        DW_FORM_data4 = 0x06,
+        DW_FORM_data8 = 0x07,
+        DW_FORM_string = 0x08,
+        DW_FORM_block = 0x09,
+        DW_FORM_data1 = 0x0b,
+        DW_FORM_strp = 0x0e,
+        DW_FORM_udata = 0x0f,
+        DW_FORM_data16 = 0x1e,
+        DW_FORM_line_strp = 0x1f
+    };
+
+    /** Check that a range of the ELF file is inside the file
+     * @param[in] Offset Offset of the range in the file
+     * @param[in] Size Size of the range
+     * @return true if the range is inside the file
+     */
+    bool InFile(uint32_t Offset, uint32_t Size) const
+    {
+        return (Offset <= m_MmapSize) && (Size <= m_MmapSize - Offset);
+    }
+
+    /** Add a string to the string pool, once
+     * @param[in] String String to add
+     * @param[in, out] Pool Offsets of the strings already in the pool
+     * @return The offset of the string in the pool
+     */
+    uint32_t Intern(const std::string& String, std::map<std::string, uint32_t>& Pool)
+    {
+        std::map<std::string, uint32_t>::const_iterator i = Pool.find(String);
+
+        if (i != Pool.end())
+        {
+            return i->second;
+        }
+
+        uint32_t Offset = m_Strings.size();
+        m_Strings.insert(m_Strings.end(), String.c_str(), String.c_str() + String.length() + 1);
+        Pool[String] = Offset;
+        return Offset;
+    }
+
+    /** Fill the array of function symbols from the symbol table
+     * @param[in] Ehdr Pointer to the ELF header (mapped file)
+     * @param[out] Symbols Function symbols, sorted by address
+     */
+    void ReadSymbols(Elf32_Ehdr* Ehdr, std::vector<SymbolRecord>& Symbols)
+    {
+        std::map<std::string, uint32_t> Pool;
+        char* base = (char*)Ehdr;
+        int i, j;
+
+        for (i = 0; i < Ehdr->e_shnum; i++)
+        {
+            Elf32_Shdr* Shdr = (Elf32_Shdr*)(base + Ehdr->e_shoff + (Ehdr->e_shentsize * i));
+
+            // only the static symbol table is used
+            if ((Shdr->sh_type != SHT_SYMTAB) || (Shdr->sh_link >= Ehdr->e_shnum))
+            {
+                continue;
+            }
+
+            // the names are in the linked string table
+            Elf32_Shdr* Strtab = (Elf32_Shdr*)(base + Ehdr->e_shoff + (Ehdr->e_shentsize * Shdr->sh_link));
+            Elf32_Sym* Sym = (Elf32_Sym*)(base + Shdr->sh_offset);
+            int count = Shdr->sh_size / sizeof(Elf32_Sym);
+
+            for (j = 0; j < count; j++)
+            {
+                // keep the defined functions only (mapping symbols $a/$t/$d are not functions)
+                if ((ELF32_ST_TYPE(Sym[j].st_info) != STT_FUNC) || (Sym[j].st_shndx == SHN_UNDEF) ||
+                    (Sym[j].st_name >= Strtab->sh_size))
+                {
+                    continue;
+                }
+
+                // the Thumb functions have the bit 0 set
+                SymbolRecord Record;
+                Record.Address = Sym[j].st_value & ~1;
+                Record.End = Record.Address + Sym[j].st_size;
+                Record.Name = this->Intern(std::string(base + Strtab->sh_offset + Sym[j].st_name,
+                        strnlen(base + Strtab->sh_offset + Sym[j].st_name, Strtab->sh_size - Sym[j].st_name)),
+                        Pool);
+                Symbols.push_back(Record);
+            }
+        }
+
+        // sort by address and remove the aliases
+        std::stable_sort(Symbols.begin(), Symbols.end(), SymbolLess);
+        for (i = 0, j = 0; i < (int)Symbols.size(); i++)
+        {
+            if ((j == 0) || (Symbols[i].Address != Symbols[j - 1].Address))
+            {
+                Symbols[j++] = Symbols[i];
+            }
+        }
+        Symbols.resize(j);
+
+        // the functions without size extend to the next function
+        for (i = 0; i < (int)Symbols.size(); i++)
+        {
+            if (Symbols[i].End == Symbols[i].Address)
+            {
+                Symbols[i].End = ((i + 1) < (int)Symbols.size()) ? Symbols[i + 1].Address : 0xFFFFFFFF;
+            }
+        }
+
+        elfreader_dbg("  - number of function symbols: %d\n", (int)Symbols.size());
+    }
+
+    /// Order of the function symbols
+    static bool SymbolLess(const SymbolRecord& a, const SymbolRecord& b)
+    {
+        return a.Address < b.Address;
+    }
+
+    /** Read an unsigned LEB128 number
+     * @param[in, out] p Pointer to the number, moved after it
+     * @param[in] end End of the data
+     * @return The number
+     */
+    static uint32_t ReadULEB(const uint8_t*& p, const uint8_t* end)
+    {
+        uint32_t value = 0;
+        int shift = 0;
+
+        while (p < end)
+        {
+            uint8_t byte = *p++;
+            if (shift < 32)
+            {
+                value |= (uint32_t)(byte & 0x7F) << shift;
+            }
+            shift += 7;
+            if ((byte & 0x80) == 0)
+            {
+                break;
+            }
+        }
+        return value;
+    }
+
+    /** Read a signed LEB128 number
+     * @param[in, out] p Pointer to the number, moved after it
+     * @param[in] end End of the data
+     * @return The number
+     */
+    static int32_t ReadSLEB(const uint8_t*& p, const uint8_t* end)
+    {
+        uint32_t value = 0;
+        int shift = 0;
+        uint8_t byte = 0;
+
+        while (p < end)
+        {
+            byte = *p++;
+            if (shift < 32)
+            {
+                value |= (uint32_t)(byte & 0x7F) << shift;
+            }
+            shift += 7;
+            if ((byte & 0x80) == 0)
+            {
+                break;
+            }
+        }
+        // sign extension
+        if ((shift < 32) && (byte & 0x40))
+        {
+            value |= ~0U << shift;
+        }
+        return (int32_t)value;
+    }
+
+    /** Read a null terminated string
+     * @param[in, out] p Pointer to the string, moved after it
+     * @param[in] end End of the data
+     * @return The string
+     */
+    static std::string ReadString(const uint8_t*& p, const uint8_t* end)
+    {
+        const uint8_t* start = p;
+
+        while ((p < end) && (*p != '\0'))
+        {
+            p++;
+        }
+        std::string String((const char*)start, p - start);
+        if (p < end)
+        {
+            p++;
+        }
+        return String;
+    }
+
+    /** Fill the line number table from the .debug_line section (DWARF 2 to 5)
+     * @param[out] Lines Line number table, sorted by address
+     */
+    void ReadLines(std::vector<LineRecord>& Lines)
+    {
+        const Section* Debug = this->FindSection(".debug_line");
+        std::map<std::string, uint32_t> Pool;
+
+        // check if the file has debug information
+        if ((Debug == NULL) || (Debug->Data() == NULL))
+        {
+            return;
+        }
+
+        const uint8_t* p = (const uint8_t*)Debug->Data();
+        const uint8_t* end = p + Debug->Size();
+
+        // loop on the line number programs of the compilation units
+        while ((end - p) >= 4)
+        {
+            uint32_t length;
+            memcpy(&length, p, sizeof(length));
+            const uint8_t* unit = p + 4;
+
+            // the 64 bit DWARF format is not supported
+            if ((length >= 0xFFFFFFF0) || (length > (uint32_t)(end - unit)) || (length < 6))
+            {
+                elfreader_dbg("  - unsupported .debug_line unit at 0x%x\n", (int)(p - (const uint8_t*)Debug->Data()));
+                break;
+            }
+            p = unit + length;
+            this->ReadLineProgram(unit, p, Lines, Pool);
+        }
+
+        // sort by address, the ends of sequence first
+        std::stable_sort(Lines.begin(), Lines.end());
+
+        elfreader_dbg("  - number of lines: %d\n", (int)Lines.size());
+    }
+
+    /** Decode the line number program of a compilation unit
+     * @param[in] q Start of the unit (after the unit length)
+     * @param[in] end End of the unit
+     * @param[in, out] Lines Line number table
+     * @param[in, out] Pool Offsets of the file names already in the string pool
+     */
+    void ReadLineProgram(const uint8_t* q, const uint8_t* end, std::vector<LineRecord>& Lines,
+            std::map<std::string, uint32_t>& Pool)
+    {
+        std::vector<std::string> Dirs;
+        std::vector<uint32_t> Files;
+        uint16_t version;
+        uint32_t header_length;
+
+        memcpy(&version, q, sizeof(version));
+        if (version >= 5)
+        {
+            // address and segment selector sizes
+            q += 2;
+        }
+        memcpy(&header_length, q + 2, sizeof(header_length));
+        q += 6;
+        if ((version < 2) || (version > 5) || (q > end) || (header_length > (uint32_t)(end - q)))
+        {
+            elfreader_dbg("  - unsupported .debug_line version %d\n", version);
+            return;
+        }
+        const uint8_t* program = q + header_length;
+
+        // header
+        if ((program - q) < ((version >= 4) ? 6 : 5))
+        {
+            return;
+        }
+        uint8_t min_inst_length = *q++;
+        if (version >= 4)
+        {
+            // maximum operations per instruction (VLIW only)
+            q++;
+        }
+        q++; // default is_stmt
+        int8_t line_base = (int8_t)*q++;
+        uint8_t line_range = *q++;
+        uint8_t opcode_base = *q++;
+        const uint8_t* opcode_lengths = q;
+        if ((line_range == 0) || (opcode_base == 0) || ((program - q) < (opcode_base - 1)))
+        {
+            return;
+        }
+        q += opcode_base - 1;
+
+        if (version >= 5)
+        {
+            // include directories and file names described by entry formats
+            if (!this->ReadEntries(q, program, Dirs, NULL, Pool) ||
+                !this->ReadEntries(q, program, Dirs, &Files, Pool))
+            {
+                elfreader_dbg("  - unsupported .debug_line entry format\n");
+                return;
+            }
+        }
+        else
+        {
+            // include directories (0 is the compilation directory)
+            Dirs.push_back("");
+            while ((q < program) && (*q != '\0'))
+            {
+                Dirs.push_back(ReadString(q, program));
+            }
+            q++;
+
+            // file names (starting at 1)
+            Files.push_back(ELFREADER_NO_STRING);
+            while ((q < program) && (*q != '\0'))
+            {
+                std::string Name = ReadString(q, program);
+                uint32_t Dir = ReadULEB(q, program);
+                ReadULEB(q, program); // modification time
+                ReadULEB(q, program); // length
+                Files.push_back(this->Intern(this->FilePath(Dirs, Dir, Name), Pool));
+            }
+        }
+
+        // state machine
+        uint32_t address = 0;
+        uint32_t file = 1;
+        uint32_t line = 1;
+        size_t sequence = Lines.size();
+        q = program;
+        while (q < end)
+        {
+            uint8_t opcode = *q++;
+            bool row = false;
+
+            if (opcode >= opcode_base)
+            {
+                // special opcode
+                opcode -= opcode_base;
+                address += (opcode / line_range) * min_inst_length;
+                line += line_base + (opcode % line_range);
+                row = true;
+            }
+            else if (opcode == 0)
+            {
+                // extended opcode
+                uint32_t length = ReadULEB(q, end);
+                const uint8_t* next = q + length;
+                if ((length == 0) || (length > (uint32_t)(end - q)))
+                {
+                    break;
+                }
+                switch (*q++)
+                {
+                case DW_LNE_end_sequence:
+                    this->AddLine(Lines, sequence, address, ELFREADER_NO_STRING, 0);
+                    sequence = Lines.size();
+                    address = 0;
+                    file = 1;
+                    line = 1;
+                    break;
+                case DW_LNE_set_address:
+                    if (length >= 5)
+                    {
+                        memcpy(&address, q, sizeof(address));
+                    }
+                    break;
+                case DW_LNE_define_file:
+                {
+                    std::string Name = ReadString(q, next);
+                    uint32_t Dir = ReadULEB(q, next);
+                    Files.push_back(this->Intern(this->FilePath(Dirs, Dir, Name), Pool));
+                    break;
+                }
+                default:
+                    break;
+                }
+                q = next;
+            }
+            else
+            {
+                // standard opcode
+                switch (opcode)
+                {
+                case DW_LNS_copy:
+                    row = true;
+                    break;
+                case DW_LNS_advance_pc:
+                    address += ReadULEB(q, end) * min_inst_length;
+                    break;
+                case DW_LNS_advance_line:
+                    line += ReadSLEB(q, end);
+                    break;
+                case DW_LNS_set_file:
+                    file = ReadULEB(q, end);
+                    break;
+                case DW_LNS_const_add_pc:
+                    address += ((255 - opcode_base) / line_range) * min_inst_length;
+                    break;
+                case DW_LNS_fixed_advance_pc:
+                    if ((end - q) >= 2)
+                    {
+                        address += q[0] | (q[1] << 8);
+                        q += 2;
+                    }
+                    break;
+                default:
+                    // skip the operands of the other opcodes
+                    for (int i = 0; i < opcode_lengths[opcode - 1]; i++)
+                    {
+                        ReadULEB(q, end);
+                    }
+                    break;
+                }
+            }
+
+            if (row)
+            {
+                this->AddLine(Lines, sequence, address,
+                        (file < Files.size()) ? Files[file] : ELFREADER_NO_STRING, line);
+            }
+        }
+    }
+
+    /** Read the include directories or the file names of a DWARF 5 line number program
+     * @param[in, out] q Pointer to the entry formats, moved after the entries
+     * @param[in] end End of the header
+     * @param[in, out] Dirs Include directories
+     * @param[out] Files File names (NULL to read the include directories)
+     * @param[in, out] Pool Offsets of the file names already in the string pool
+     * @return false if an entry format is not supported
+     */
+    bool ReadEntries(const uint8_t*& q, const uint8_t* end, std::vector<std::string>& Dirs,
+            std::vector<uint32_t>* Files, std::map<std::string, uint32_t>& Pool)
+    {
+        std::vector<std::pair<uint32_t, uint32_t> > Formats;
+        uint32_t i, j, count;
+
+        if (q >= end)
+        {
+            return false;
+        }
+        count = *q++;
+        for (i = 0; i < count; i++)
+        {
+            uint32_t type = ReadULEB(q, end);
+            Formats.push_back(std::make_pair(type, ReadULEB(q, end)));
+        }
+
+        count = ReadULEB(q, end);
+        for (i = 0; (i < count) && (q < end); i++)
+        {
+            std::string Name;
+            uint32_t Dir = 0;
+
+            for (j = 0; j < Formats.size(); j++)
+            {
+                std::string String;
+                uint64_t Value = 0;
+
+                switch (Formats[j].second)
+                {
+                case DW_FORM_string:
+                    String = ReadString(q, end);
+                    break;
+                case DW_FORM_line_strp:
+                case DW_FORM_strp:
+                {
+                    const Section* Strings = this->FindSection(
+                            (Formats[j].second == DW_FORM_strp) ? ".debug_str" : ".debug_line_str");
+                    uint32_t Offset;
+                    if ((end - q) < 4)
+                    {
+                        return false;
+                    }
+                    memcpy(&Offset, q, sizeof(Offset));
+                    q += 4;
+                    if ((Strings != NULL) && (Strings->Data() != NULL) && (Offset < Strings->Size()))
+                    {
+                        const uint8_t* p = (const uint8_t*)Strings->Data() + Offset;
+                        String = ReadString(p, (const uint8_t*)Strings->Data() + Strings->Size());
+                    }
+                    break;
+                }
+                case DW_FORM_udata:
+                    Value = ReadULEB(q, end);
+                    break;
+                case DW_FORM_data1:
+                case DW_FORM_data2:
+                case DW_FORM_data4:
+                case DW_FORM_data8:
+                case DW_FORM_data16:
+                {
+                    uint32_t size = (Formats[j].second == DW_FORM_data1) ? 1 :
+                                    (Formats[j].second == DW_FORM_data2) ? 2 :
+                                    (Formats[j].second == DW_FORM_data4) ? 4 :
+                                    (Formats[j].second == DW_FORM_data8) ? 8 : 16;
+                    if ((uint32_t)(end - q) < size)
+                    {
+                        return false;
+                    }
+                    memcpy(&Value, q, (size <= 8) ? size : 0);
+                    q += size;
+                    break;
+                }
+                case DW_FORM_block:
+                    Value = ReadULEB(q, end);
+                    if (Value > (uint64_t)(end - q))
+                    {
+                        return false;
+                    }
+                    q += Value;
+                    break;
+                default:
+                    return false;
+                }
+
+                if (Formats[j].first == DW_LNCT_path)
+                {
+                    Name = String;
+                }
+                else if (Formats[j].first == DW_LNCT_directory_index)
+                {
+                    Dir = Value;
+                }
+            }
+
+            if (Files == NULL)
+            {
+                Dirs.push_back(Name);
+            }
+            else
+            {
+                Files->push_back(this->Intern(this->FilePath(Dirs, Dir, Name), Pool));
+            }
+        }
+        return true;
+    }
+
+    /** Add an entry to the line number table, merged with the previous entry of the
+     * sequence if it is for the same line
+     * @param[in, out] Lines Line number table
+     * @param[in] sequence Index of the first entry of the current sequence
+     * @param[in] address Address of the entry
+     * @param[in] file File name of the entry (ELFREADER_NO_STRING for the end of sequence)
+     * @param[in] line Line number of the entry
+     */
+    static void AddLine(std::vector<LineRecord>& Lines, size_t sequence, uint32_t address,
+            uint32_t file, uint32_t line)
+    {
+        LineRecord Record;
+
+        if ((Lines.size() > sequence) && (file != ELFREADER_NO_STRING) &&
+            (Lines.back().File == file) && (Lines.back().Number == line))
+        {
+            return;
+        }
+        Record.Address = address;
+        Record.File = file;
+        Record.Number = line;
+        Lines.push_back(Record);
+    }
+
+    /** Build the path of a source file of the line number table
+     * @param[in] Dirs Include directories of the compilation unit
+     * @param[in] Dir Index of the directory of the file
+     * @param[in] Name Name of the file
+     * @return The path of the file
+     */
+    static std::string FilePath(const std::vector<std::string>& Dirs, uint32_t Dir, const std::string& Name)
+    {
+        if ((Name[0] == '/') || (Dir == 0) || (Dir >= Dirs.size()))
+        {
+            return Name;
+        }
+        return Dirs[Dir] + "/" + Name;
+    }
+
+    /** Load the index from the cache file
+     * @param[in] Path Path of the cache file
+     * @param[in] Stat Information of the ELF file
+     * @param[out] Symbols Function symbols
+     * @param[out] Lines Line number table
+     * @return true if the cache was valid and loaded
+     */
+    bool LoadCache(const std::string& Path, const struct stat& Stat, std::vector<SymbolRecord>& Symbols,
+            std::vector<LineRecord>& Lines)
+    {
+        CacheHeader Header;
+        FILE* fp;
+        bool valid;
+
+        fp = fopen(Path.c_str(), "rb");
+        if (fp == NULL)
+        {
+            return false;
+        }
+
+        // the cache must have been built from the same ELF file
+        valid = (fread(&Header, sizeof(Header), 1, fp) == 1) &&
+            (memcmp(Header.Magic, "ELFINDEX", sizeof(Header.Magic)) == 0) &&
+            (Header.Version == ELFREADER_CACHE_VERSION) &&
+            (Header.ElfSize == (uint64_t)Stat.st_size) && (Header.ElfTime == (uint64_t)Stat.st_mtime) &&
+            (Header.ElfTimeNsec == (uint64_t)Stat.st_mtim.tv_nsec);
+        if (valid)
+        {
+            Symbols.resize(Header.SymbolsNum);
+            Lines.resize(Header.LinesNum);
+            m_Strings.resize(Header.StringsSize);
+            valid = ((Header.SymbolsNum == 0) ||
+                     (fread(&Symbols[0], sizeof(SymbolRecord), Header.SymbolsNum, fp) == Header.SymbolsNum)) &&
+                    ((Header.LinesNum == 0) ||
+                     (fread(&Lines[0], sizeof(LineRecord), Header.LinesNum, fp) == Header.LinesNum)) &&
+                    ((Header.StringsSize == 0) ||
+                     (fread(&m_Strings[0], 1, Header.StringsSize, fp) == Header.StringsSize));
+        }
+        fclose(fp);
+
+        if (!valid)
+        {
+            Symbols.clear();
+            Lines.clear();
+            m_Strings.clear();
+        }
+        elfreader_dbg("  - index cache %s: %s\n", Path.c_str(), valid ? "loaded" : "outdated");
+        return valid;
+    }
+
+    /** Save the index in the cache file (errors are ignored, the cache is optional)
+     * @param[in] Path Path of the cache file
+     * @param[in] Stat Information of the ELF file
+     * @param[in] Symbols Function symbols
+     * @param[in] Lines Line number table
+     */
+    void SaveCache(const std::string& Path, const struct stat& Stat, const std::vector<SymbolRecord>& Symbols,
+            const std::vector<LineRecord>& Lines)
+    {
+        CacheHeader Header;
+        char Temp[32];
+        FILE* fp;
+        bool valid;
+
+        // write a temporary file then rename it, for the simulations running in parallel
+        snprintf(Temp, sizeof(Temp), ".%d", (int)getpid());
+        fp = fopen((Path + Temp).c_str(), "wb");
+        if (fp == NULL)
+        {
+            return;
+        }
+
+        memset(&Header, 0, sizeof(Header));
+        memcpy(Header.Magic, "ELFINDEX", sizeof(Header.Magic));
+        Header.Version = ELFREADER_CACHE_VERSION;
+        Header.SymbolsNum = Symbols.size();
+        Header.LinesNum = Lines.size();
+        Header.StringsSize = m_Strings.size();
+        Header.ElfSize = Stat.st_size;
+        Header.ElfTime = Stat.st_mtime;
+        Header.ElfTimeNsec = Stat.st_mtim.tv_nsec;
+        valid = (fwrite(&Header, sizeof(Header), 1, fp) == 1) &&
+                (Symbols.empty() || (fwrite(&Symbols[0], sizeof(SymbolRecord), Symbols.size(), fp) == Symbols.size())) &&
+                (Lines.empty() || (fwrite(&Lines[0], sizeof(LineRecord), Lines.size(), fp) == Lines.size())) &&
+                (m_Strings.empty() || (fwrite(&m_Strings[0], 1, m_Strings.size(), fp) == m_Strings.size()));
+        valid = (fclose(fp) == 0) && valid;
+
+        if (!valid || (rename((Path + Temp).c_str(), Path.c_str()) != 0))
+        {
+            unlink((Path + Temp).c_str());
+        }
+    }
+
+    /** Build the symbols and the line number table from the index
+     * @param[in] Symbols Function symbols
+     * @param[in] Lines Line number table
+     */
+    void Resolve(const std::vector<SymbolRecord>& Symbols, const std::vector<LineRecord>& Lines)
+    {
+        size_t i;
+
+        // the strings must not move anymore
+        m_Symbols.reserve(Symbols.size());
+        for (i = 0; i < Symbols.size(); i++)
+        {
+            if (Symbols[i].Name >= m_Strings.size())
+            {
+                continue;
+            }
+            m_Symbols.push_back(Symbol(Symbols[i].Address, Symbols[i].End, &m_Strings[Symbols[i].Name]));
+        }
+
+        m_Lines.reserve(Lines.size());
+        for (i = 0; i < Lines.size(); i++)
+        {
+            m_Lines.push_back(Line(Lines[i].Address,
+                    (Lines[i].File < m_Strings.size()) ? &m_Strings[Lines[i].File] : NULL, Lines[i].Number));
+        }
+    }
 };
 
 #endif /*ELFREADER_H_*/
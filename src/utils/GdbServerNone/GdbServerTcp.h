@@ -19,7 +19,7 @@
 /// debug level
 #define GDBSERVERTCP_DEBUG_LEVEL 0
 
-/// Macro to print debug messages
+/// Macro to print debug messages (the levels above GDBSERVERTCP_DEBUG_LEVEL go to the runtime trace)
 /// @param __l level of debug message (0 means always printed)
 /// @param __f format of the debug string
 /// @param ... variable arguments
@@ -27,6 +27,8 @@
     do {                                                                                \
         if (GDBSERVERTCP_DEBUG_LEVEL >= __l) {                                          \
             SYS_DBG("gdbservertcp", __f, ##__VA_ARGS__);                                \
+        } else {                                                                        \
+            SYS_TRACE("gdbservertcp", __l, __f, ##__VA_ARGS__);                         \
         }                                                                               \
     } while (false)
 
@@ -0,0 +1,240 @@
+#include "Heatmap/Heatmap.h"
+#include "utils.h"
+#include "gdbserver.h"
+
+#include <stdlib.h>
+
+std::string Heatmap::s_path;
+std::vector<HeatmapTable*> Heatmap::s_tables;
+
+HeatmapTable::HeatmapTable(const char* name)
+: m_name(name)
+, m_num_initiators(0)
+, m_last(0)
+{
+    for (int i = 0; i < HEATMAP_MAX_INITIATORS; i++)
+    {
+        m_processes[i] = NULL;
+    }
+}
+
+int
+HeatmapTable::add_target(const char* name, uint64_t base, uint64_t size)
+{
+    Target target;
+
+    target.name = name;
+    target.base = base;
+    target.pages = (size + (1 << HEATMAP_PAGE_SHIFT) - 1) >> HEATMAP_PAGE_SHIFT;
+    if (target.pages > HEATMAP_MAX_PAGES)
+    {
+        target.pages = HEATMAP_MAX_PAGES;
+    }
+    else if (target.pages == 0)
+    {
+        target.pages = 1;
+    }
+    target.first = m_cells.size() / HEATMAP_MAX_INITIATORS;
+
+    // the targets are added at elaboration, before any access
+    m_cells.resize((target.first + target.pages) * HEATMAP_MAX_INITIATORS);
+    memset(&m_cells[target.first * HEATMAP_MAX_INITIATORS], 0,
+           target.pages * HEATMAP_MAX_INITIATORS * sizeof(HeatmapCell));
+    m_targets.push_back(target);
+    return m_targets.size() - 1;
+}
+
+int
+HeatmapTable::initiator(int index)
+{
+    char name[32];
+
+    if (index >= HEATMAP_MAX_INITIATORS)
+    {
+        index = HEATMAP_MAX_INITIATORS - 1;
+    }
+    if (m_initiators[index].empty())
+    {
+        sprintf(name, "targ_socket_%d", index);
+        m_initiators[index] = name;
+        if (index >= m_num_initiators)
+        {
+            m_num_initiators = index + 1;
+        }
+    }
+    return index;
+}
+
+int
+HeatmapTable::current()
+{
+    const void* process = sc_core::sc_get_current_process_b();
+
+    if ((m_num_initiators != 0) && (m_processes[m_last] == process))
+    {
+        return m_last;
+    }
+    for (m_last = 0; m_last < m_num_initiators; m_last++)
+    {
+        if (m_processes[m_last] == process)
+        {
+            return m_last;
+        }
+    }
+
+    // new initiator (the extra ones share the last slot)
+    if (m_num_initiators == HEATMAP_MAX_INITIATORS)
+    {
+        m_last = HEATMAP_MAX_INITIATORS - 1;
+        m_initiators[m_last] = "others";
+        return m_last;
+    }
+    m_processes[m_last] = process;
+    m_initiators[m_last] = sc_core::sc_get_current_process_handle().name();
+    m_num_initiators++;
+    return m_last;
+}
+
+void
+HeatmapTable::add(HeatmapCell& total, const HeatmapCell& cell)
+{
+    total.reads += cell.reads;
+    total.writes += cell.writes;
+    total.read_bytes += cell.read_bytes;
+    total.write_bytes += cell.write_bytes;
+    total.latency += cell.latency;
+}
+
+void
+HeatmapTable::write_line(FILE* file, const char* initiator, const char* target, const uint64_t* page,
+                         const HeatmapCell& cell, double resolution)
+{
+    fprintf(file, "%s,%s,%s,", m_name.c_str(), initiator, target);
+    if (page != NULL)
+    {
+        fprintf(file, "0x%08llX", (unsigned long long)*page);
+    }
+    else
+    {
+        fprintf(file, "total");
+    }
+    fprintf(file, ",%llu,%llu,%llu,%llu,%.3f\n",
+            (unsigned long long)cell.reads, (unsigned long long)cell.writes,
+            (unsigned long long)cell.read_bytes, (unsigned long long)cell.write_bytes,
+            cell.latency * resolution);
+}
+
+void
+HeatmapTable::write(FILE* file, double resolution)
+{
+    HeatmapCell total;
+
+    for (int i = 0; i < m_num_initiators; i++)
+    {
+        for (size_t t = 0; t < m_targets.size(); t++)
+        {
+            const Target& target = m_targets[t];
+
+            // pages accessed, then the total of the target
+            memset(&total, 0, sizeof(total));
+            for (uint64_t p = 0; p < target.pages; p++)
+            {
+                const HeatmapCell& cell = m_cells[(target.first + p) * HEATMAP_MAX_INITIATORS + i];
+                uint64_t page = target.base + (p << HEATMAP_PAGE_SHIFT);
+
+                if ((cell.reads + cell.writes) == 0)
+                {
+                    continue;
+                }
+                this->write_line(file, m_initiators[i].c_str(), target.name.c_str(), &page, cell, resolution);
+                HeatmapTable::add(total, cell);
+            }
+            if ((total.reads + total.writes) != 0)
+            {
+                this->write_line(file, m_initiators[i].c_str(), target.name.c_str(), NULL, total, resolution);
+            }
+        }
+    }
+}
+
+void
+Heatmap::configure(Parameters& parameters, Parameter& config)
+{
+    FILE* file;
+
+    // sanity check
+    if (!s_path.empty())
+    {
+        SYS_ERR("heatmap", "heatmap already configured");
+    }
+
+    // the heatmap file is relative to the configuration file
+    config.add_path(parameters.configpath);
+    s_path = config.c_str();
+    file = fopen(s_path.c_str(), "w");
+    if (file == NULL)
+    {
+        SYS_ERR("heatmap", "can not create heatmap file %s", s_path.c_str());
+    }
+    fclose(file);
+
+    // the counters can be written on request from the debugger
+    gdbserver::add_monitor("heatmap", &Heatmap::monitor, NULL);
+
+    // the counters are written whatever the way the simulation ends
+    atexit(&Heatmap::close);
+}
+
+HeatmapTable*
+Heatmap::add_table(const char* name)
+{
+    HeatmapTable* table;
+
+    if (s_path.empty())
+    {
+        return NULL;
+    }
+    table = new HeatmapTable(name);
+    s_tables.push_back(table);
+    return table;
+}
+
+bool
+Heatmap::dump(const char* path)
+{
+    FILE* file = fopen(path, "w");
+    double resolution = sc_core::sc_get_time_resolution().to_seconds() * 1e9;
+
+    if (file == NULL)
+    {
+        return true;
+    }
+    fprintf(file, "decoder,initiator,target,page,reads,writes,read_bytes,write_bytes,latency_ns\n");
+    for (size_t i = 0; i < s_tables.size(); i++)
+    {
+        s_tables[i]->write(file, resolution);
+    }
+    fclose(file);
+    return false;
+}
+
+std::string
+Heatmap::monitor(void* opaque, const char* args)
+{
+    std::string path = (*args != '\0') ? args : s_path;
+
+    if (Heatmap::dump(path.c_str()))
+    {
+        return "can not create heatmap file " + path + "\n";
+    }
+    return "heatmap written to " + path + "\n";
+}
+
+void
+Heatmap::close()
+{
+    if (Heatmap::dump(s_path.c_str()))
+    {
+        SYS_DBG("heatmap", "can not create heatmap file %s", s_path.c_str());
+    }
+}
@@ -0,0 +1,209 @@
+#ifndef HEATMAP_H_
+#define HEATMAP_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <string>
+#include <vector>
+
+#include "Parameters.h"
+
+/// Size of the pages of the heatmap (log2, 4 KiB pages)
+#define HEATMAP_PAGE_SHIFT 12
+
+/// Maximum number of pages of a target (the accesses above go to the last page)
+#define HEATMAP_MAX_PAGES 4096
+
+/// Maximum number of initiators of a decoder (the extra ones share the last slot)
+#define HEATMAP_MAX_INITIATORS 4
+
+/// Counters of the accesses of an initiator to a page
+struct HeatmapCell
+{
+    /// Number of read transactions
+    uint64_t reads;
+    /// Number of write transactions
+    uint64_t writes;
+    /// Number of bytes read
+    uint64_t read_bytes;
+    /// Number of bytes written
+    uint64_t write_bytes;
+    /// Modelled latency of the transactions, in time resolution units
+    uint64_t latency;
+};
+
+/** Access counters of an address decoder.
+ * The counters are kept per initiator, per target and per page of the targets, in a
+ * single flat array indexed by (page of the decoder, initiator).
+ */
+struct HeatmapTable
+{
+    /** Constructor
+     * @param[in] name Name of the decoder
+     */
+    HeatmapTable(const char* name);
+
+    /** Add a target to the decoder
+     * @param[in] name Name of the target
+     * @param[in] base Base address of the target in the decoder space
+     * @param[in] size Size of the target in bytes
+     * @return The target identifier
+     */
+    int
+    add_target(const char* name, uint64_t base, uint64_t size);
+
+    /** Get the slot of a named initiator (socket of the decoder)
+     * @param[in] index Index of the initiator socket
+     * @return The initiator identifier
+     */
+    int
+    initiator(int index);
+
+    /** Get the slot of the initiator running the transaction (current process)
+     * @return The initiator identifier
+     */
+    int
+    current();
+
+    /** Count a transaction
+     * @param[in] initiator Initiator identifier
+     * @param[in] target Target identifier
+     * @param[in] offset Address of the access in the target
+     * @param[in] write Indicates a write access
+     * @param[in] bytes Number of bytes of the access
+     * @param[in] latency Modelled latency of the access, in time resolution units
+     */
+    void
+    record(int initiator, int target, uint64_t offset, bool write, uint32_t bytes, uint64_t latency)
+    {
+        const Target& t = m_targets[target];
+        uint64_t page = offset >> HEATMAP_PAGE_SHIFT;
+        HeatmapCell* cell;
+
+        if (page >= t.pages)
+        {
+            page = t.pages - 1;
+        }
+        cell = &m_cells[(t.first + page) * HEATMAP_MAX_INITIATORS + initiator];
+        if (write)
+        {
+            cell->writes++;
+            cell->write_bytes += bytes;
+        }
+        else
+        {
+            cell->reads++;
+            cell->read_bytes += bytes;
+        }
+        cell->latency += latency;
+    }
+
+    /** Write the counters in CSV
+     * @param[in] file Output file
+     * @param[in] resolution Time resolution in ns
+     */
+    void
+    write(FILE* file, double resolution);
+
+private:
+    /// Target of the decoder
+    struct Target
+    {
+        /// Name of the target
+        std::string name;
+        /// Base address of the target
+        uint64_t base;
+        /// Number of pages of the target
+        uint64_t pages;
+        /// First page of the target in the counters
+        uint64_t first;
+    };
+
+    /** Write a line of counters
+     * @param[in] file Output file
+     * @param[in] initiator Name of the initiator
+     * @param[in] target Name of the target
+     * @param[in] page Address of the page, or NULL for the totals
+     * @param[in] cell Counters
+     * @param[in] resolution Time resolution in ns
+     */
+    void
+    write_line(FILE* file, const char* initiator, const char* target, const uint64_t* page,
+               const HeatmapCell& cell, double resolution);
+
+    /** Add counters to others
+     * @param[in, out] total Counters to increment
+     * @param[in] cell Counters to add
+     */
+    static void
+    add(HeatmapCell& total, const HeatmapCell& cell);
+
+    /// Name of the decoder
+    std::string m_name;
+    /// Targets of the decoder
+    std::vector<Target> m_targets;
+    /// Names of the initiators
+    std::string m_initiators[HEATMAP_MAX_INITIATORS];
+    /// Processes of the initiators (for the initiators identified by their process)
+    const void* m_processes[HEATMAP_MAX_INITIATORS];
+    /// Number of initiators seen
+    int m_num_initiators;
+    /// Last initiator found by current()
+    int m_last;
+    /// Counters, indexed by (page, initiator)
+    std::vector<HeatmapCell> m_cells;
+};
+
+/** Memory access heatmap of the platform.
+ * The address decoders (AddrDec and Bus) count the reads and writes, bytes and
+ * modelled latency of each initiator on each 4 KiB page of their targets. The
+ * counters are written in CSV at exit and on the remote GDB command
+ * "monitor heatmap [file]", one line per (decoder, initiator, target, page) accessed
+ * followed by the totals per initiator and target.
+ *
+ * The heatmap is configured from the platform configuration file:
+ * <pre>
+ * heatmap heatmap.csv
+ * </pre>
+ */
+struct Heatmap
+{
+    /** Configure the heatmap
+     * @param[in] parameters Command line parameters
+     * @param[in] config Heatmap parameter of the configuration file
+     */
+    static void
+    configure(Parameters& parameters, Parameter& config);
+
+    /** Create the counters of a decoder
+     * @param[in] name Name of the decoder
+     * @return The counters, or NULL if the heatmap is not configured
+     */
+    static HeatmapTable*
+    add_table(const char* name);
+
+    /** Write the counters of all the decoders
+     * @param[in] path Path of the CSV file
+     * @return true if there was an error, false otherwise
+     */
+    static bool
+    dump(const char* path);
+
+    /// Write the counters at exit
+    static void
+    close();
+
+private:
+    /// Remote GDB monitor command writing the counters
+    static std::string
+    monitor(void* opaque, const char* args);
+
+    /// Path of the CSV file written at exit (empty if not configured)
+    static std::string s_path;
+
+    /// Counters of the decoders
+    static std::vector<HeatmapTable*> s_tables;
+};
+
+#endif /*HEATMAP_H_*/
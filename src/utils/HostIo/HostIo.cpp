@@ -0,0 +1,312 @@
+#include "HostIo/HostIo.h"
+#include "utils.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+std::vector<HostIo*> HostIo::s_streams;
+
+HostIo::HostIo(const char* name, Parameters& parameters, Parameter& config)
+: m_name(name)
+, m_listen(-1)
+, m_slave(-1)
+, m_in(-1)
+, m_out(-1)
+, m_rx_head(0)
+, m_rx_tail(0)
+, m_tx_head(0)
+, m_tx_tail(0)
+, m_stop(false)
+{
+    MSP& options = *config.get_config();
+    std::string& backend = *config.get_lowercase();
+
+    if (backend == "pty")
+    {
+        m_backend = BACKEND_PTY;
+        this->open_pty();
+    }
+    else if (backend == "unix")
+    {
+        m_backend = BACKEND_UNIX;
+        this->open_unix(parameters, options);
+    }
+    else if (backend == "file")
+    {
+        m_backend = BACKEND_FILE;
+        m_in = this->open_path(parameters, options, "input", O_RDONLY | O_NONBLOCK);
+        m_out = this->open_path(parameters, options, "output", O_WRONLY | O_CREAT | O_TRUNC);
+    }
+    else if (backend == "stdio")
+    {
+        // the standard streams are shared with the simulator: left blocking, only the
+        // host thread accesses them
+        m_backend = BACKEND_STDIO;
+        m_in = STDIN_FILENO;
+        m_out = STDOUT_FILENO;
+    }
+    else
+    {
+        SYS_ERR(name, "unknown host backend %s (pty, unix, file or stdio)", config.c_str());
+    }
+
+    // the streams are flushed whatever the way the simulation ends
+    if (s_streams.empty())
+    {
+        atexit(&HostIo::close);
+    }
+    s_streams.push_back(this);
+
+    if (pthread_create(&m_thread, NULL, &HostIo::thread, this) != 0)
+    {
+        SYS_ERR(name, "can not create the host thread");
+    }
+}
+
+int
+HostIo::open_path(Parameters& parameters, MSP& options, const char* key, int flags)
+{
+    Parameter* path;
+    int fd;
+
+    if (options.count(key) == 0)
+    {
+        return -1;
+    }
+
+    // the files are relative to the configuration file
+    path = options[key];
+    path->add_path(parameters.configpath);
+    fd = open(path->c_str(), flags, 0644);
+    if (fd < 0)
+    {
+        SYS_ERR(m_name.c_str(), "can not open %s file %s", key, path->c_str());
+    }
+    return fd;
+}
+
+void
+HostIo::open_pty()
+{
+    struct termios tio;
+    const char* slave;
+
+    m_in = posix_openpt(O_RDWR | O_NOCTTY);
+    if ((m_in < 0) || (grantpt(m_in) != 0) || (unlockpt(m_in) != 0) || ((slave = ptsname(m_in)) == NULL))
+    {
+        SYS_ERR(m_name.c_str(), "can not create a pseudo-terminal");
+    }
+
+    // raw terminal: the bytes are passed unchanged
+    m_slave = open(slave, O_RDWR | O_NOCTTY);
+    if ((m_slave >= 0) && (tcgetattr(m_slave, &tio) == 0))
+    {
+        cfmakeraw(&tio);
+        tcsetattr(m_slave, TCSANOW, &tio);
+    }
+    fcntl(m_in, F_SETFL, O_NONBLOCK);
+    m_out = m_in;
+
+    SYS_DBG(m_name.c_str(), "pseudo-terminal %s", slave);
+}
+
+void
+HostIo::open_unix(Parameters& parameters, MSP& options)
+{
+    struct sockaddr_un addr;
+    Parameter* path;
+
+    if (options.count("path") == 0)
+    {
+        SYS_ERR(m_name.c_str(), "unix backend requires a path");
+    }
+    path = options["path"];
+    path->add_path(parameters.configpath);
+    m_path = path->c_str();
+    if (m_path.length() >= sizeof(addr.sun_path))
+    {
+        SYS_ERR(m_name.c_str(), "socket path too long %s", m_path.c_str());
+    }
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, m_path.c_str());
+
+    // a socket left by a previous run is replaced
+    unlink(m_path.c_str());
+    m_listen = socket(AF_UNIX, SOCK_STREAM, 0);
+    if ((m_listen < 0) || (bind(m_listen, (struct sockaddr*)&addr, sizeof(addr)) != 0) ||
+        (listen(m_listen, 1) != 0))
+    {
+        SYS_ERR(m_name.c_str(), "can not listen on socket %s", m_path.c_str());
+    }
+    fcntl(m_listen, F_SETFL, O_NONBLOCK);
+
+    SYS_DBG(m_name.c_str(), "listening on %s", m_path.c_str());
+}
+
+void*
+HostIo::thread(void* arg)
+{
+    ((HostIo*)arg)->run();
+    return NULL;
+}
+
+void
+HostIo::run()
+{
+    struct pollfd fds;
+
+    while (!m_stop)
+    {
+        // accept a client (one at a time)
+        if ((m_listen >= 0) && (m_in < 0))
+        {
+            m_in = accept(m_listen, NULL, NULL);
+            if (m_in >= 0)
+            {
+                fcntl(m_in, F_SETFL, O_NONBLOCK);
+                m_out = m_in;
+                SYS_DBG(m_name.c_str(), "client connected");
+            }
+        }
+
+        // wait for input (short timeout to serve the output and the stop request)
+        fds.fd = (m_in >= 0) ? m_in : m_listen;
+        fds.events = POLLIN;
+        fds.revents = 0;
+        if (fds.fd >= 0)
+        {
+            poll(&fds, 1, 1);
+        }
+        else
+        {
+            usleep(1000);
+        }
+
+        if ((m_in >= 0) && (fds.revents != 0) && !this->receive())
+        {
+            // end of the input: a client can reconnect, a replay is over
+            if (m_backend == BACKEND_UNIX)
+            {
+                SYS_DBG(m_name.c_str(), "client disconnected");
+                ::close(m_in);
+                m_out = -1;
+            }
+            else if ((m_in != STDIN_FILENO) && (m_in != m_out))
+            {
+                ::close(m_in);
+            }
+            m_in = -1;
+        }
+
+        if (!this->send())
+        {
+            SYS_DBG(m_name.c_str(), "output closed");
+            if (m_out == m_in)
+            {
+                ::close(m_in);
+                m_in = -1;
+            }
+            else if (m_out != STDOUT_FILENO)
+            {
+                ::close(m_out);
+            }
+            m_out = -1;
+        }
+    }
+
+    // last output of the firmware
+    this->send();
+}
+
+bool
+HostIo::receive()
+{
+    uint8_t buf[4096];
+    uint32_t head = m_rx_head;
+    size_t room = HOSTIO_RING_SIZE - (head - m_rx_tail);
+    ssize_t len;
+
+    // the model is late: the host input is kept until there is room
+    if (room == 0)
+    {
+        return true;
+    }
+    len = ::read(m_in, buf, (room < sizeof(buf)) ? room : sizeof(buf));
+    if (len < 0)
+    {
+        return ((errno == EAGAIN) || (errno == EINTR) || ((m_backend == BACKEND_PTY) && (errno == EIO)));
+    }
+    if (len == 0)
+    {
+        return false;
+    }
+    for (ssize_t i = 0; i < len; i++, head++)
+    {
+        m_rx[head & (HOSTIO_RING_SIZE - 1)] = buf[i];
+    }
+    __sync_synchronize();
+    m_rx_head = head;
+    return true;
+}
+
+bool
+HostIo::send()
+{
+    uint32_t head = m_tx_head;
+    uint32_t tail = m_tx_tail;
+    uint32_t start, len;
+    ssize_t written;
+
+    while (head != tail)
+    {
+        // no output (no client connected): the bytes are dropped
+        if (m_out < 0)
+        {
+            m_tx_tail = head;
+            return true;
+        }
+
+        // contiguous part of the ring
+        __sync_synchronize();
+        start = tail & (HOSTIO_RING_SIZE - 1);
+        len = head - tail;
+        if (len > (HOSTIO_RING_SIZE - start))
+        {
+            len = HOSTIO_RING_SIZE - start;
+        }
+        written = ::write(m_out, &m_tx[start], len);
+        if (written < 0)
+        {
+            return ((errno == EAGAIN) || (errno == EINTR));
+        }
+        tail += written;
+        __sync_synchronize();
+        m_tx_tail = tail;
+    }
+    return true;
+}
+
+void
+HostIo::close()
+{
+    for (size_t i = 0; i < s_streams.size(); i++)
+    {
+        HostIo* stream = s_streams[i];
+
+        stream->m_stop = true;
+        pthread_join(stream->m_thread, NULL);
+        if (!stream->m_path.empty())
+        {
+            unlink(stream->m_path.c_str());
+        }
+    }
+    s_streams.clear();
+}
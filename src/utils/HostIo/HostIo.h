@@ -0,0 +1,196 @@
+#ifndef HOSTIO_H_
+#define HOSTIO_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <pthread.h>
+
+#include <string>
+#include <vector>
+
+#include "Parameters.h"
+
+/// Number of bytes of each ring buffer (must be a power of 2)
+#define HOSTIO_RING_SIZE 65536
+
+/** Byte stream between a model (a serial port) and the host.
+ * The host side is served by a background thread doing buffered non-blocking reads and
+ * writes, the model only moves bytes in and out of lock-free ring buffers, so the
+ * simulation thread never blocks and never does a system call per byte.
+ *
+ * The backend is configured from the platform configuration file:
+ * <pre>
+ * uart1 pty
+ * uart1 unix
+ *     path uart1.sock
+ * uart1 file
+ *     input rx.bin
+ *     output tx.bin
+ * uart1 stdio
+ * </pre>
+ * where "pty" creates a pseudo-terminal (its name is printed), "unix" listens for one
+ * client on a Unix domain socket, "file" replays the input file (or named pipe) and
+ * writes the output file (both optional), and "stdio" uses the standard input and output.
+ * The paths are relative to the configuration file.
+ */
+struct HostIo
+{
+    /** Open the backend and start the host thread
+     * @param[in] name Name of the stream (used in the messages)
+     * @param[in] parameters Command line parameters
+     * @param[in] config Parameter of the configuration file selecting the backend
+     */
+    HostIo(const char* name, Parameters& parameters, Parameter& config);
+
+    /** Get the bytes received from the host
+     * @param[out] buf Buffer to fill
+     * @param[in] len Maximum number of bytes to get
+     * @return The number of bytes copied (0 if none pending)
+     */
+    size_t
+    read(uint8_t* buf, size_t len)
+    {
+        uint32_t head = m_rx_head;
+        uint32_t tail = m_rx_tail;
+        size_t i;
+
+        // fast path: nothing received
+        if (head == tail)
+        {
+            return 0;
+        }
+        __sync_synchronize();
+        for (i = 0; (i < len) && (tail != head); i++, tail++)
+        {
+            buf[i] = m_rx[tail & (HOSTIO_RING_SIZE - 1)];
+        }
+        __sync_synchronize();
+        m_rx_tail = tail;
+        return i;
+    }
+
+    /** Send bytes to the host (as many as the output ring can take)
+     * @param[in] buf Bytes to send
+     * @param[in] len Number of bytes to send
+     * @return The number of bytes accepted (less than len if the host does not keep up)
+     */
+    size_t
+    write(const uint8_t* buf, size_t len)
+    {
+        uint32_t head = m_tx_head;
+        size_t i;
+
+        for (i = 0; (i < len) && ((head - m_tx_tail) < HOSTIO_RING_SIZE); i++, head++)
+        {
+            m_tx[head & (HOSTIO_RING_SIZE - 1)] = buf[i];
+        }
+        __sync_synchronize();
+        m_tx_head = head;
+        return i;
+    }
+
+    /// Flush the pending output and stop the host threads (at exit)
+    static void
+    close();
+
+private:
+    /// Kind of backend
+    enum Backend
+    {
+        BACKEND_PTY,
+        BACKEND_UNIX,
+        BACKEND_FILE,
+        BACKEND_STDIO
+    };
+
+    /// Host thread entry point
+    static void*
+    thread(void* arg);
+
+    /// Host thread: move the bytes between the rings and the file descriptors
+    void
+    run();
+
+    /** Receive the pending bytes of the input
+     * @return false if the input is closed, true otherwise
+     */
+    bool
+    receive();
+
+    /** Send the pending bytes to the output
+     * @return false if the output is closed, true otherwise
+     */
+    bool
+    send();
+
+    /** Open a file relative to the configuration file
+     * @param[in] parameters Command line parameters
+     * @param[in] options Options of the backend
+     * @param[in] key Option containing the path
+     * @param[in] flags Flags of open()
+     * @return The file descriptor (-1 if the option is not given)
+     */
+    int
+    open_path(Parameters& parameters, MSP& options, const char* key, int flags);
+
+    /// Open a pseudo-terminal
+    void
+    open_pty();
+
+    /** Listen on a Unix domain socket
+     * @param[in] parameters Command line parameters
+     * @param[in] options Options of the backend
+     */
+    void
+    open_unix(Parameters& parameters, MSP& options);
+
+    /// Name of the stream
+    std::string m_name;
+
+    /// Kind of backend
+    Backend m_backend;
+
+    /// Listening socket (unix backend, -1 otherwise)
+    int m_listen;
+
+    /// Path of the listening socket (unix backend)
+    std::string m_path;
+
+    /// Slave side of the pseudo-terminal, kept open so that clients can come and go (-1 if none)
+    int m_slave;
+
+    /// Input file descriptor (-1 if none)
+    int m_in;
+
+    /// Output file descriptor (-1 if none)
+    int m_out;
+
+    /// Bytes received from the host
+    uint8_t m_rx[HOSTIO_RING_SIZE];
+
+    /// Write index of the received bytes (host thread)
+    volatile uint32_t m_rx_head;
+
+    /// Read index of the received bytes (simulation thread)
+    volatile uint32_t m_rx_tail;
+
+    /// Bytes sent to the host
+    uint8_t m_tx[HOSTIO_RING_SIZE];
+
+    /// Write index of the sent bytes (simulation thread)
+    volatile uint32_t m_tx_head;
+
+    /// Read index of the sent bytes (host thread)
+    volatile uint32_t m_tx_tail;
+
+    /// Indicates that the host thread must stop
+    volatile bool m_stop;
+
+    /// Host thread
+    pthread_t m_thread;
+
+    /// Streams opened (closed at exit)
+    static std::vector<HostIo*> s_streams;
+};
+
+#endif /*HOSTIO_H_*/
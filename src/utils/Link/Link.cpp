@@ -0,0 +1,219 @@
+#include "Link/Link.h"
+#include "utils.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/// Default synchronization period in us
+#define LINK_DEFAULT_QUANTUM 100
+
+Link* Link::s_link = NULL;
+
+void
+LinkChannel::send(uint32_t value)
+{
+    uint32_t head = m_tx->head;
+
+    if ((head - m_tx->tail) >= LINK_RING_SIZE)
+    {
+        m_dropped++;
+        return;
+    }
+    m_tx->events[head & (LINK_RING_SIZE - 1)].time = sc_core::sc_time_stamp().value();
+    m_tx->events[head & (LINK_RING_SIZE - 1)].value = value;
+    __sync_synchronize();
+    m_tx->head = head + 1;
+}
+
+bool
+LinkChannel::receive(uint32_t& value)
+{
+    uint32_t tail = m_rx->tail;
+    LinkEvent* event;
+
+    // fast path: nothing sent
+    if (tail == m_rx->head)
+    {
+        return false;
+    }
+    __sync_synchronize();
+    event = &m_rx->events[tail & (LINK_RING_SIZE - 1)];
+
+    // the peer is ahead: the value is kept until its time
+    if (event->time > sc_core::sc_time_stamp().value())
+    {
+        return false;
+    }
+    value = event->value;
+    __sync_synchronize();
+    m_rx->tail = tail + 1;
+    return true;
+}
+
+bool
+LinkChannel::pending(sc_core::sc_time& time)
+{
+    uint32_t tail = m_rx->tail;
+
+    if (tail == m_rx->head)
+    {
+        return false;
+    }
+    __sync_synchronize();
+    time = sc_core::sc_time((sc_dt::uint64)m_rx->events[tail & (LINK_RING_SIZE - 1)].time, false);
+    return true;
+}
+
+size_t
+LinkChannel::read(uint8_t* buf, size_t len)
+{
+    uint32_t value;
+    size_t i;
+
+    for (i = 0; (i < len) && this->receive(value); i++)
+    {
+        buf[i] = value;
+    }
+    return i;
+}
+
+void
+LinkChannel::write(const uint8_t* buf, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        this->send(buf[i]);
+    }
+}
+
+void
+Link::configure(Parameters& parameters, Parameter& config)
+{
+    // sanity check
+    if (s_link != NULL)
+    {
+        SYS_ERR("link", "link already configured");
+    }
+
+    s_link = new Link("link", parameters, config);
+
+    // the process leaves the domain whatever the way the simulation ends
+    atexit(&Link::close);
+}
+
+Link::Link(sc_core::sc_module_name name, Parameters& parameters, Parameter& config)
+: sc_core::sc_module(name)
+, m_domain(NULL)
+{
+    MSP& options = *config.get_config();
+
+    m_quantum = sc_core::sc_time(LINK_DEFAULT_QUANTUM, sc_core::SC_US);
+    if (options.count("quantum") != 0)
+    {
+        if (options["quantum"]->get_int() <= 0)
+        {
+            TLM_ERR("invalid quantum %s", options["quantum"]->c_str());
+        }
+        m_quantum = sc_core::sc_time(options["quantum"]->get_int(), sc_core::SC_US);
+    }
+
+    // join the processes of the domain
+    m_domain = (LinkDomain*)m_shm.open(this->name(), "/socemu-link-" + *config.get_string(),
+                                       sizeof(LinkDomain), LINK_MAGIC,
+                                       SyncShm::nodes(this->name(), parameters, config));
+
+    TLM_DBG("node %d in domain %s, quantum %s", m_shm.node(), config.c_str(), m_quantum.to_string().c_str());
+
+    SC_THREAD(thread_process);
+}
+
+LinkChannel*
+Link::channel(const char* owner, const std::string& name, const char* type)
+{
+    LinkDomain* domain;
+    LinkChannelData* data = NULL;
+    int end = -1;
+    uint32_t i;
+
+    if (s_link == NULL)
+    {
+        SYS_ERR(owner, "channel %s requires a link domain", name.c_str());
+    }
+    if (name.length() >= LINK_NAME_SIZE)
+    {
+        SYS_ERR(owner, "channel name too long %s", name.c_str());
+    }
+    domain = s_link->m_domain;
+
+    // the channel table is shared by the processes
+    s_link->m_shm.lock();
+    for (i = 0; i < LINK_MAX_CHANNELS; i++)
+    {
+        if (strcmp(domain->channels[i].name, name.c_str()) == 0)
+        {
+            data = &domain->channels[i];
+            break;
+        }
+        if ((data == NULL) && (domain->channels[i].name[0] == '\0'))
+        {
+            data = &domain->channels[i];
+        }
+    }
+    if ((data != NULL) && (data->name[0] == '\0'))
+    {
+        strcpy(data->name, name.c_str());
+        strncpy(data->type, type, LINK_NAME_SIZE - 1);
+    }
+    if ((data != NULL) && (data->ends < 2) && (strcmp(data->type, type) == 0))
+    {
+        end = data->ends++;
+    }
+    s_link->m_shm.unlock();
+
+    if (data == NULL)
+    {
+        SYS_ERR(owner, "too many channels in the domain (%s)", name.c_str());
+    }
+    if (strcmp(data->type, type) != 0)
+    {
+        SYS_ERR(owner, "channel %s is a %s channel, not %s", name.c_str(), data->type, type);
+    }
+    if (end < 0)
+    {
+        SYS_ERR(owner, "channel %s already has two ends", name.c_str());
+    }
+
+    // each end sends in its own ring and receives from the other one
+    SYS_DBG(owner, "%s channel %s, end %d", type, name.c_str(), end);
+    return new LinkChannel(&data->rings[end], &data->rings[1 - end]);
+}
+
+LinkChannel*
+Link::channel(const char* owner, Parameter& config, const char* type)
+{
+    MSP& options = *config.get_config();
+
+    if (options.count("channel") == 0)
+    {
+        SYS_ERR(owner, "link requires a channel");
+    }
+    return Link::channel(owner, *options["channel"]->get_string(), type);
+}
+
+void
+Link::thread_process()
+{
+    while (true)
+    {
+        // the first synchronization waits for all the processes of the domain
+        m_shm.sync();
+        TIMELINE_WAIT(m_quantum);
+    }
+}
+
+void
+Link::close()
+{
+    s_link->m_shm.close();
+    s_link = NULL;
+}
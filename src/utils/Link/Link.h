@@ -0,0 +1,224 @@
+#ifndef LINK_H_
+#define LINK_H_
+
+/// Channels between the platforms simulated by several processes
+
+#include "systemc"
+
+#include <stdint.h>
+
+#include <string>
+
+#include "Parameters.h"
+#include "SyncShm/SyncShm.h"
+
+/// Maximum number of channels in a link domain
+#define LINK_MAX_CHANNELS 32
+
+/// Maximum length of the name and type of a channel (including the terminating zero)
+#define LINK_NAME_SIZE 32
+
+/// Number of events of each direction of a channel (must be a power of 2)
+#define LINK_RING_SIZE 4096
+
+/// Magic number of an initialized domain ("LNK1")
+#define LINK_MAGIC 0x4C4E4B31
+
+/// Value sent over a channel (a character, an SPI word or an interrupt level)
+struct LinkEvent
+{
+    /// Time of the event (time resolution units)
+    uint64_t time;
+    /// Value of the event
+    uint32_t value;
+};
+
+/// Events sent in one direction of a channel (one producer, one consumer)
+struct LinkRing
+{
+    /// Write index (producer)
+    volatile uint32_t head;
+    /// Read index (consumer)
+    volatile uint32_t tail;
+    /// Events
+    LinkEvent events[LINK_RING_SIZE];
+};
+
+/// Channel content, in the shared memory
+struct LinkChannelData
+{
+    /// Name of the channel (empty for a free entry)
+    char name[LINK_NAME_SIZE];
+    /// Type of the channel (both ends must agree)
+    char type[LINK_NAME_SIZE];
+    /// Number of ends attached
+    uint32_t ends;
+    /// Events sent by each end
+    LinkRing rings[2];
+};
+
+/// Domain content, in the shared memory
+struct LinkDomain
+{
+    /// Processes of the domain
+    SyncShmHeader sync;
+    /// Channels
+    LinkChannelData channels[LINK_MAX_CHANNELS];
+};
+
+/** End of a channel between two platforms.
+ * The values sent are stamped with the current simulation time, the peer receives them
+ * once its own time has reached the stamp.
+ */
+struct LinkChannel
+{
+    /** Constructor
+     * @param[in] tx Events sent by this end
+     * @param[in] rx Events sent by the peer
+     */
+    LinkChannel(LinkRing* tx, LinkRing* rx)
+    : m_tx(tx)
+    , m_rx(rx)
+    , m_dropped(0)
+    {
+    }
+
+    /** Send a value to the peer (dropped if the peer does not keep up)
+     * @param[in] value Value to send
+     */
+    void
+    send(uint32_t value);
+
+    /** Receive the next value sent by the peer
+     * @param[out] value Value received
+     * @return true if a value was received, false if none is due at the current time
+     */
+    bool
+    receive(uint32_t& value);
+
+    /** Get the time of the next value sent by the peer
+     * @param[out] time Time of the value, may be later than the current time
+     * @return true if a value is pending, false otherwise
+     */
+    bool
+    pending(sc_core::sc_time& time);
+
+    /** Get the bytes sent by the peer (byte stream channels)
+     * @param[out] buf Buffer to fill
+     * @param[in] len Maximum number of bytes to get
+     * @return The number of bytes copied (0 if none due)
+     */
+    size_t
+    read(uint8_t* buf, size_t len);
+
+    /** Send bytes to the peer (byte stream channels)
+     * @param[in] buf Bytes to send
+     * @param[in] len Number of bytes to send
+     */
+    void
+    write(const uint8_t* buf, size_t len);
+
+    /// Events sent by this end
+    LinkRing* m_tx;
+
+    /// Events sent by the peer
+    LinkRing* m_rx;
+
+    /// Number of values dropped because the peer ring was full
+    uint64_t m_dropped;
+};
+
+/** Link domain joining the platforms simulated by several processes.
+ * The processes of a domain share a memory containing the channels between their
+ * platforms: serial lines ("uart"), SPI buses ("spi") and interrupt lines ("irq"). Each
+ * channel has two ends, the first platform attached to a channel gets one end, the
+ * second the other one.
+ *
+ * The simulated times of the processes are kept together by a conservative
+ * synchronization (see SyncShm): a process only goes past the time T + quantum once all
+ * the other processes have reached T, so a value is received at most one quantum after
+ * the time it was sent, and never before. A larger quantum lets the processes run longer
+ * on their own core between two synchronizations, a smaller one reduces the latency. No
+ * process starts simulating before all the processes of the domain have joined it.
+ *
+ * The domain is configured from the platform configuration file:
+ * <pre>
+ * link board
+ *     quantum 100
+ *     nodes 2
+ * </pre>
+ * where the value gives the name of the domain shared by the processes, the optional
+ * quantum the synchronization period in us and the optional nodes the number of processes
+ * joining the domain (by default, the number of configuration files of the command line).
+ * The processes leave the domain at exit, the shared memory is removed when the last one
+ * leaves.
+ */
+struct Link : sc_core::sc_module
+{
+    // Module has a thread
+    SC_HAS_PROCESS(Link);
+
+    /** Join the domain
+     * @param[in] parameters Command line parameters
+     * @param[in] config Link parameter of the configuration file
+     */
+    static void
+    configure(Parameters& parameters, Parameter& config);
+
+    /** Attach to a channel of the domain
+     * @param[in] owner Name of the module attaching (used in the messages)
+     * @param[in] name Name of the channel
+     * @param[in] type Type of the channel
+     * @return The end of the channel
+     */
+    static LinkChannel*
+    channel(const char* owner, const std::string& name, const char* type);
+
+    /** Attach to the channel given in the "channel" sub-option of a parameter
+     * @param[in] owner Name of the module attaching (used in the messages)
+     * @param[in] config Parameter of the module
+     * @param[in] type Type of the channel
+     * @return The end of the channel
+     */
+    static LinkChannel*
+    channel(const char* owner, Parameter& config, const char* type);
+
+    /** Get the synchronization period
+     * @return The quantum of the domain
+     */
+    static const sc_core::sc_time&
+    quantum()
+    {
+        return s_link->m_quantum;
+    }
+
+    /// Leave the domain (at exit)
+    static void
+    close();
+
+private:
+    /** Constructor: join the domain
+     * @param[in] name Name of the module
+     * @param[in] parameters Command line parameters
+     * @param[in] config Link parameter of the configuration file
+     */
+    Link(sc_core::sc_module_name name, Parameters& parameters, Parameter& config);
+
+    /// Synchronization thread
+    void
+    thread_process();
+
+    /// Node of the process in the shared memory
+    SyncShm m_shm;
+
+    /// Shared domain
+    LinkDomain* m_domain;
+
+    /// Synchronization period
+    sc_core::sc_time m_quantum;
+
+    /// Domain joined by this process (NULL if none)
+    static Link* s_link;
+};
+
+#endif /*LINK_H_*/
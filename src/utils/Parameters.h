@@ -159,6 +159,18 @@ public:
     std::string configpath;
     /// Command line parameter indicating that the debug interface should wait at init
     Parameter gdb_wait;
+    /// Command line parameter giving the number of instructions executed by a core (empty if unlimited)
+    Parameter instructions;
+    /// Command line parameter giving the simulated time (empty if unlimited)
+    Parameter time;
+    /// Command line parameter giving the symbol or address stopping the simulation (empty if none)
+    Parameter stop;
+    /// Command line parameter giving the address of the test finished word (empty if none)
+    Parameter exitword;
+    /// Command line parameter giving the wall time limit in seconds (empty if none)
+    Parameter watchdog;
+    /// Number of platforms of the command line (one process each)
+    unsigned int platforms;
 
     /// Parameters parsed from configuration file
     MSP config;
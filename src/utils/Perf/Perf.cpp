@@ -0,0 +1,240 @@
+#include "Perf/Perf.h"
+#include "utils.h"
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/time.h>
+
+std::vector<Perf::Counter> Perf::s_cores;
+std::vector<Perf::Counter> Perf::s_buses;
+std::vector<Perf::Sample> Perf::s_samples;
+FILE* Perf::s_file = NULL;
+double Perf::s_start = 0;
+double Perf::s_interval = 0;
+volatile bool Perf::s_due = false;
+volatile bool Perf::s_stop = false;
+
+/// Background thread requesting the periodic reports
+static pthread_t perf_thread;
+
+void
+Perf::configure(Parameters& parameters, Parameter& config)
+{
+    MSP* options = config.get_config();
+    struct timeval now;
+
+    // sanity check
+    if (s_file != NULL)
+    {
+        SYS_ERR("perf", "perf already configured");
+    }
+
+    // the report file is relative to the configuration file
+    config.add_path(parameters.configpath);
+    s_file = fopen(config.c_str(), "w");
+    if (s_file == NULL)
+    {
+        SYS_ERR("perf", "can not create perf file %s", config.c_str());
+    }
+
+    // period of the reports
+    if (options->count("interval") != 0)
+    {
+        s_interval = atof((*options)["interval"]->c_str());
+        if (s_interval < 0)
+        {
+            SYS_ERR("perf", "invalid interval %s", (*options)["interval"]->c_str());
+        }
+    }
+
+    gettimeofday(&now, NULL);
+    s_start = now.tv_sec + now.tv_usec / 1e6;
+
+    // the reports are requested by a timer to keep the simulation thread free of
+    // system calls
+    if ((s_interval > 0) && (pthread_create(&perf_thread, NULL, &Perf::timer, NULL) != 0))
+    {
+        SYS_ERR("perf", "can not create the perf thread");
+    }
+
+    // the report is written whatever the way the simulation ends
+    atexit(&Perf::close);
+}
+
+void
+Perf::add_instructions(const char* name, const uint64_t* counter, const uint64_t* paused)
+{
+    Counter core;
+
+    core.name = name;
+    core.value = counter;
+    core.last = 0;
+    core.paused = paused;
+    s_cores.push_back(core);
+}
+
+void
+Perf::add_transactions(const char* name, const uint64_t* counter)
+{
+    Counter bus;
+
+    bus.name = name;
+    bus.value = counter;
+    bus.last = 0;
+    bus.paused = NULL;
+    s_buses.push_back(bus);
+}
+
+double
+Perf::wall()
+{
+    struct timeval now;
+
+    gettimeofday(&now, NULL);
+    return now.tv_sec + now.tv_usec / 1e6 - s_start;
+}
+
+double
+Perf::rate(double count, double seconds)
+{
+    return (seconds > 0) ? count / seconds : 0;
+}
+
+void
+Perf::snapshot(Sample& sample)
+{
+    sample.wall = Perf::wall();
+    sample.sim = sc_core::sc_time_stamp().to_seconds();
+    sample.instrs = 0;
+    for (size_t i = 0; i < s_cores.size(); i++)
+    {
+        sample.instrs += *s_cores[i].value;
+    }
+    sample.trans = 0;
+    for (size_t i = 0; i < s_buses.size(); i++)
+    {
+        sample.trans += *s_buses[i].value;
+    }
+    sample.deltas = sc_core::sc_delta_count();
+}
+
+void
+Perf::report()
+{
+    Sample sample, last;
+    double elapsed;
+
+    s_due = false;
+    Perf::snapshot(sample);
+    if (s_samples.empty())
+    {
+        memset(&last, 0, sizeof(last));
+    }
+    else
+    {
+        last = s_samples.back();
+    }
+    s_samples.push_back(sample);
+    elapsed = sample.wall - last.wall;
+
+    // rates over the last interval
+    printf("perf: %.1f s: %.2f MIPS, sim/wall %.3g, %.0f deltas/s",
+           sample.wall, rate(sample.instrs - last.instrs, elapsed) / 1e6,
+           rate(sample.sim - last.sim, elapsed), rate(sample.deltas - last.deltas, elapsed));
+    for (size_t i = 0; i < s_buses.size(); i++)
+    {
+        printf(", %s %.0f trans/s", s_buses[i].name.c_str(),
+               rate(*s_buses[i].value - s_buses[i].last, elapsed));
+        s_buses[i].last = *s_buses[i].value;
+    }
+    printf("\n");
+    fflush(stdout);
+}
+
+void*
+Perf::timer(void* arg)
+{
+    double next = s_interval;
+
+    while (!s_stop)
+    {
+        // sleep in short steps to stop quickly at exit
+        if (Perf::wall() < next)
+        {
+            usleep(10000);
+            continue;
+        }
+        s_due = true;
+        next += s_interval;
+    }
+    return NULL;
+}
+
+void
+Perf::close()
+{
+    Sample sample;
+
+    // check if the report is configured
+    if (s_file == NULL)
+    {
+        return;
+    }
+
+    // stop the timer
+    if (s_interval > 0)
+    {
+        s_stop = true;
+        pthread_join(perf_thread, NULL);
+    }
+
+    // totals of the run
+    Perf::snapshot(sample);
+    fprintf(s_file, "{\n");
+    fprintf(s_file, "    \"wall_seconds\": %.6f,\n", sample.wall);
+    fprintf(s_file, "    \"sim_seconds\": %.12g,\n", sample.sim);
+    fprintf(s_file, "    \"sim_wall_ratio\": %.6g,\n", rate(sample.sim, sample.wall));
+    fprintf(s_file, "    \"instructions\": %llu,\n", (unsigned long long)sample.instrs);
+    fprintf(s_file, "    \"mips\": %.3f,\n", rate(sample.instrs, sample.wall) / 1e6);
+    fprintf(s_file, "    \"delta_cycles\": %llu,\n", (unsigned long long)sample.deltas);
+    fprintf(s_file, "    \"delta_cycles_per_second\": %.1f,\n", rate(sample.deltas, sample.wall));
+
+    fprintf(s_file, "    \"cores\": {");
+    for (size_t i = 0; i < s_cores.size(); i++)
+    {
+        fprintf(s_file, "%s\n        \"%s\": {\"instructions\": %llu, \"mips\": %.3f", (i == 0) ? "" : ",",
+                s_cores[i].name.c_str(), (unsigned long long)*s_cores[i].value,
+                rate(*s_cores[i].value, sample.wall) / 1e6);
+        if (s_cores[i].paused != NULL)
+        {
+            fprintf(s_file, ", \"paused_cycles\": %llu", (unsigned long long)*s_cores[i].paused);
+        }
+        fprintf(s_file, "}");
+    }
+    fprintf(s_file, "%s},\n", s_cores.empty() ? "" : "\n    ");
+
+    fprintf(s_file, "    \"buses\": {");
+    for (size_t i = 0; i < s_buses.size(); i++)
+    {
+        fprintf(s_file, "%s\n        \"%s\": {\"transactions\": %llu, \"per_second\": %.1f}", (i == 0) ? "" : ",",
+                s_buses[i].name.c_str(), (unsigned long long)*s_buses[i].value,
+                rate(*s_buses[i].value, sample.wall));
+    }
+    fprintf(s_file, "%s},\n", s_buses.empty() ? "" : "\n    ");
+
+    // periodic reports
+    fprintf(s_file, "    \"samples\": [");
+    for (size_t i = 0; i < s_samples.size(); i++)
+    {
+        fprintf(s_file, "%s\n        {\"wall_seconds\": %.6f, \"sim_seconds\": %.12g, \"instructions\": %llu, "
+                "\"transactions\": %llu, \"delta_cycles\": %llu}", (i == 0) ? "" : ",",
+                s_samples[i].wall, s_samples[i].sim, (unsigned long long)s_samples[i].instrs,
+                (unsigned long long)s_samples[i].trans, (unsigned long long)s_samples[i].deltas);
+    }
+    fprintf(s_file, "%s]\n", s_samples.empty() ? "" : "\n    ");
+    fprintf(s_file, "}\n");
+
+    fclose(s_file);
+    s_file = NULL;
+}
@@ -0,0 +1,150 @@
+#ifndef PERF_H_
+#define PERF_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <string>
+#include <vector>
+
+#include "Parameters.h"
+
+/** Performance report of the simulator.
+ * The throughput of the simulation is reported while running and at exit:
+ *  - host instructions per second (MIPS) of each core
+ *  - simulated time versus wall time
+ *  - transactions per second of each bus
+ *  - SystemC delta cycles per second (the scheduler activity)
+ *  - core cycles spent paused (clock gated until a wake event)
+ *
+ * The report is configured from the platform configuration file:
+ * <pre>
+ * perf perf.json
+ *     interval 10
+ * </pre>
+ * where the value gives the JSON file written at exit, and the optional interval the
+ * period in wall seconds of the reports printed while running (none by default).
+ *
+ * The counters are owned by the models and registered at construction; the periodic
+ * reports are requested by a background timer and printed by the simulation thread
+ * (Perf::poll()), so the counters are always read consistently.
+ */
+struct Perf
+{
+    /** Configure the report and start the interval timer
+     * @param[in] parameters Command line parameters
+     * @param[in] config Perf parameter of the configuration file
+     */
+    static void
+    configure(Parameters& parameters, Parameter& config);
+
+    /** Register the instruction counter of a core
+     * @param[in] name Name of the core
+     * @param[in] counter Number of instructions executed by the core
+     * @param[in] paused Number of cycles the core clock was gated (NULL if not accounted)
+     */
+    static void
+    add_instructions(const char* name, const uint64_t* counter, const uint64_t* paused = NULL);
+
+    /** Register the transaction counter of a bus
+     * @param[in] name Name of the bus
+     * @param[in] counter Number of transactions routed by the bus
+     */
+    static void
+    add_transactions(const char* name, const uint64_t* counter);
+
+    /// Print the periodic report if it is due (called from the simulation thread)
+    static void
+    poll()
+    {
+        if (__builtin_expect(s_due, 0))
+        {
+            Perf::report();
+        }
+    }
+
+    /// Stop the interval timer and write the JSON report
+    static void
+    close();
+
+private:
+    /// Counter registered by a model
+    struct Counter
+    {
+        /// Name of the model
+        std::string name;
+        /// Value of the counter
+        const uint64_t* value;
+        /// Value at the previous report
+        uint64_t last;
+        /// Cycles spent paused (cores only, NULL if not accounted)
+        const uint64_t* paused;
+    };
+
+    /// Snapshot of the simulation at a report
+    struct Sample
+    {
+        /// Wall time since the configuration in seconds
+        double wall;
+        /// Simulated time in seconds
+        double sim;
+        /// Instructions executed by all the cores
+        uint64_t instrs;
+        /// Transactions routed by all the buses
+        uint64_t trans;
+        /// SystemC delta cycles
+        uint64_t deltas;
+    };
+
+    /// Print the periodic report
+    static void
+    report();
+
+    /** Take a snapshot of the simulation
+     * @param[out] sample Snapshot of the counters
+     */
+    static void
+    snapshot(Sample& sample);
+
+    /// Get the wall time since the configuration in seconds
+    static double
+    wall();
+
+    /** Compute a rate
+     * @param[in] count Number of events
+     * @param[in] seconds Duration
+     * @return The number of events per second
+     */
+    static double
+    rate(double count, double seconds);
+
+    /// Background thread requesting the periodic reports
+    static void*
+    timer(void* arg);
+
+    /// Instruction counters of the cores
+    static std::vector<Counter> s_cores;
+
+    /// Transaction counters of the buses
+    static std::vector<Counter> s_buses;
+
+    /// Reports printed while running
+    static std::vector<Sample> s_samples;
+
+    /// JSON report file
+    static FILE* s_file;
+
+    /// Wall time of the configuration in seconds since the epoch
+    static double s_start;
+
+    /// Period of the reports in wall seconds (0 if none)
+    static double s_interval;
+
+    /// Indicates that a periodic report is due
+    static volatile bool s_due;
+
+    /// Indicates that the timer must stop
+    static volatile bool s_stop;
+};
+
+#endif /*PERF_H_*/
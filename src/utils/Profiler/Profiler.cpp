@@ -0,0 +1,466 @@
+#include "Profiler/Profiler.h"
+#include "utils.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/// Return address of the root frame (never reached)
+#define PROFILER_NO_RETURN 0xFFFFFFFF
+
+std::vector<Profiler*> Profiler::s_profilers;
+
+/** Helpers to write python marshal data (format version 2, read by python 2 and 3)
+ * @{
+ */
+static void
+marshal_u32(FILE* fp, uint32_t value)
+{
+    fputc(value & 0xFF, fp);
+    fputc((value >> 8) & 0xFF, fp);
+    fputc((value >> 16) & 0xFF, fp);
+    fputc((value >> 24) & 0xFF, fp);
+}
+
+static void
+marshal_int(FILE* fp, uint64_t value)
+{
+    uint64_t rest;
+    int digits;
+
+    // small integers
+    if (value <= 0x7FFFFFFF)
+    {
+        fputc('i', fp);
+        marshal_u32(fp, value);
+        return;
+    }
+
+    // long integers, in 15 bits digits
+    for (digits = 0, rest = value; rest != 0; rest >>= 15)
+    {
+        digits++;
+    }
+    fputc('l', fp);
+    marshal_u32(fp, digits);
+    for (; digits > 0; digits--)
+    {
+        fputc(value & 0xFF, fp);
+        fputc((value >> 8) & 0x7F, fp);
+        value >>= 15;
+    }
+}
+
+static void
+marshal_float(FILE* fp, double value)
+{
+    uint64_t bits;
+
+    memcpy(&bits, &value, sizeof(bits));
+    fputc('g', fp);
+    marshal_u32(fp, bits & 0xFFFFFFFF);
+    marshal_u32(fp, bits >> 32);
+}
+
+static void
+marshal_string(FILE* fp, const char* value)
+{
+    fputc('u', fp);
+    marshal_u32(fp, strlen(value));
+    fputs(value, fp);
+}
+
+static void
+marshal_tuple(FILE* fp, uint32_t size)
+{
+    fputc('(', fp);
+    marshal_u32(fp, size);
+}
+/// @}
+
+Profiler::Profiler(const std::string& elfpath, Parameters& parameters, Parameter& config)
+: m_elfpath(elfpath)
+, m_period(1)
+, m_instrs(0)
+, m_cycles(0)
+, m_last(0)
+, m_last_instrs(0)
+, m_next(PROFILER_NO_RETURN)
+, m_step(0)
+, m_function(-1)
+, m_start(0)
+, m_end(0)
+, m_exception(false)
+, m_exception_ret(0)
+{
+    MSP* options = config.get_config();
+    Function function;
+    std::string path;
+
+    // the output files are relative to the configuration file
+    config.add_path(parameters.configpath);
+    path = *config.get_string() + ".callgrind";
+    m_callgrind = fopen(path.c_str(), "w");
+    if (m_callgrind == NULL)
+    {
+        SYS_ERR("profiler", "can not create profile file %s", path.c_str());
+    }
+    path = *config.get_string() + ".pstats";
+    m_pstats = fopen(path.c_str(), "wb");
+    if (m_pstats == NULL)
+    {
+        SYS_ERR("profiler", "can not create profile file %s", path.c_str());
+    }
+
+    // reporting period of the sequential instructions
+    if (options->count("period") != 0)
+    {
+        if ((*options)["period"]->get_int() <= 0)
+        {
+            SYS_ERR("profiler", "invalid period %s", (*options)["period"]->c_str());
+        }
+        m_period = (*options)["period"]->get_int();
+    }
+
+    // symbols of the firmware, plus the unknown code
+    m_elf.Open(elfpath.c_str(), true);
+    memset(&function, 0, sizeof(function));
+    m_functions.assign(m_elf.SymbolsNum() + 1, function);
+
+    // the profiles are written whatever the way the simulation ends
+    if (s_profilers.empty())
+    {
+        atexit(&Profiler::close);
+    }
+    s_profilers.push_back(this);
+}
+
+void
+Profiler::arm_instr(uint32_t pc, uint32_t lr, bool thumb, uint32_t cycles, uint32_t instrs)
+{
+    uint32_t elapsed = cycles - m_last;
+    uint32_t count = instrs - m_last_instrs;
+
+    m_last = cycles;
+    m_last_instrs = instrs;
+
+    // account the previous instructions (the ones not reported are sequential)
+    if (m_function >= 0)
+    {
+        m_instrs += count;
+        m_cycles += elapsed;
+        m_functions[m_function].instrs += count;
+        m_functions[m_function].cycles += elapsed;
+        m_next += (count - 1) * m_step;
+    }
+
+    // retrieve the function of the instruction
+    if ((pc < m_start) || (pc >= m_end))
+    {
+        m_function = this->lookup(pc);
+    }
+
+    // check for calls and returns
+    if ((pc != m_next) || m_exception)
+    {
+        this->branch(pc, lr);
+    }
+    m_step = thumb ? 2 : 4;
+    m_next = pc + m_step;
+}
+
+void
+Profiler::arm_exception(uint32_t vector, uint32_t ret)
+{
+    // a reset restarts the call graph
+    if (vector == ARMul_ResetV)
+    {
+        while (!m_stack.empty())
+        {
+            this->pop();
+        }
+        m_exception = false;
+        return;
+    }
+
+    // the next instruction is the entry of the handler
+    m_exception = true;
+    m_exception_ret = ret;
+}
+
+int
+Profiler::lookup(uint32_t pc)
+{
+    const Symbol* symbol = m_elf.FindSymbol(pc);
+
+    // code outside of the functions is looked up at every instruction
+    if (symbol == NULL)
+    {
+        m_start = pc;
+        m_end = pc + 1;
+        return m_functions.size() - 1;
+    }
+
+    m_start = symbol->Address();
+    m_end = symbol->End();
+    return symbol - m_elf.GetSymbol(0);
+}
+
+void
+Profiler::branch(uint32_t pc, uint32_t lr)
+{
+    int i;
+
+    // the first instruction is the root of the call graph
+    if (m_stack.empty())
+    {
+        m_exception = false;
+        this->push(-1, m_function, PROFILER_NO_RETURN);
+        return;
+    }
+
+    // exception: call from the interrupted function
+    if (m_exception)
+    {
+        m_exception = false;
+        this->push(m_stack.back().function, m_function, m_exception_ret);
+        return;
+    }
+
+    // return: branch to the return address of a frame
+    for (i = m_stack.size() - 1; (i > 0) && (i >= (int)m_stack.size() - PROFILER_UNWIND_DEPTH); i--)
+    {
+        if (m_stack[i].ret == pc)
+        {
+            while ((int)m_stack.size() > i)
+            {
+                this->pop();
+            }
+            return;
+        }
+    }
+
+    // call: the link register holds the address of the next sequential instruction
+    if ((lr & ~1) == m_next)
+    {
+        this->push(m_stack.back().function, m_function, m_next);
+        return;
+    }
+
+    // tail call: branch to the start of another function, returning to the caller
+    if ((pc == m_start) && (m_function != m_stack.back().function) &&
+        (m_function != (int)m_functions.size() - 1))
+    {
+        int caller = m_stack.back().function;
+        uint32_t ret = m_stack.back().ret;
+
+        this->pop();
+        this->push(caller, m_function, ret);
+    }
+}
+
+void
+Profiler::push(int caller, int function, uint32_t ret)
+{
+    Frame frame;
+
+    // the returns were missed (context switch, longjmp), restart the call graph
+    if (m_stack.size() == PROFILER_MAX_DEPTH)
+    {
+        while (!m_stack.empty())
+        {
+            this->pop();
+        }
+        caller = -1;
+    }
+
+    frame.function = function;
+    frame.ret = ret & ~1;
+    frame.instrs = m_instrs;
+    frame.cycles = m_cycles;
+    frame.edge = NULL;
+
+    // statistics of the call
+    if (caller >= 0)
+    {
+        frame.edge = &m_edges[std::make_pair(caller, function)];
+        frame.edge->calls++;
+    }
+    m_functions[function].calls++;
+    if (m_functions[function].active++ == 0)
+    {
+        m_functions[function].primitive++;
+    }
+
+    m_stack.push_back(frame);
+}
+
+void
+Profiler::pop()
+{
+    Frame& frame = m_stack.back();
+    Function& function = m_functions[frame.function];
+    uint64_t instrs = m_instrs - frame.instrs;
+    uint64_t cycles = m_cycles - frame.cycles;
+
+    // the recursive calls are already included in the outer call
+    if (--function.active == 0)
+    {
+        function.incl_instrs += instrs;
+        function.incl_cycles += cycles;
+    }
+    if (frame.edge != NULL)
+    {
+        frame.edge->incl_instrs += instrs;
+        frame.edge->incl_cycles += cycles;
+    }
+
+    m_stack.pop_back();
+}
+
+const char*
+Profiler::name(int function)
+{
+    if (function == (int)m_functions.size() - 1)
+    {
+        return "[unknown]";
+    }
+    return m_elf.GetSymbol(function)->Name();
+}
+
+uint32_t
+Profiler::address(int function)
+{
+    if (function == (int)m_functions.size() - 1)
+    {
+        return 0;
+    }
+    return m_elf.GetSymbol(function)->Address();
+}
+
+void
+Profiler::close()
+{
+    for (size_t i = 0; i < s_profilers.size(); i++)
+    {
+        Profiler* profiler = s_profilers[i];
+
+        // the functions still running return now
+        while (!profiler->m_stack.empty())
+        {
+            profiler->pop();
+        }
+
+        profiler->write_callgrind();
+        profiler->write_pstats();
+    }
+    s_profilers.clear();
+}
+
+void
+Profiler::write_callgrind()
+{
+    std::map<std::pair<int, int>, Edge>::const_iterator edge;
+    FILE* fp = m_callgrind;
+
+    fprintf(fp, "# callgrind format\n");
+    fprintf(fp, "version: 1\n");
+    fprintf(fp, "creator: open-socemu\n");
+    fprintf(fp, "cmd: %s\n", m_elfpath.c_str());
+    fprintf(fp, "positions: instr\n");
+    fprintf(fp, "events: Instructions Cycles\n");
+    fprintf(fp, "summary: %llu %llu\n\n", (unsigned long long)m_instrs, (unsigned long long)m_cycles);
+    fprintf(fp, "ob=%s\n", m_elfpath.c_str());
+
+    for (int i = 0; i < (int)m_functions.size(); i++)
+    {
+        const Function& function = m_functions[i];
+
+        // skip the functions never executed
+        if ((function.calls == 0) && (function.instrs == 0))
+        {
+            continue;
+        }
+
+        // cost of the function itself
+        fprintf(fp, "\nfn=%s\n", this->name(i));
+        fprintf(fp, "0x%08X %llu %llu\n", this->address(i),
+                (unsigned long long)function.instrs, (unsigned long long)function.cycles);
+
+        // cost of the calls, the edges are sorted by caller
+        for (edge = m_edges.lower_bound(std::make_pair(i, 0));
+             (edge != m_edges.end()) && (edge->first.first == i); ++edge)
+        {
+            fprintf(fp, "cfn=%s\n", this->name(edge->first.second));
+            fprintf(fp, "calls=%llu 0x%08X\n", (unsigned long long)edge->second.calls,
+                    this->address(edge->first.second));
+            fprintf(fp, "0x%08X %llu %llu\n", this->address(i),
+                    (unsigned long long)edge->second.incl_instrs,
+                    (unsigned long long)edge->second.incl_cycles);
+        }
+    }
+
+    fclose(fp);
+}
+
+void
+Profiler::write_pstats()
+{
+    std::map<std::pair<int, int>, Edge>::const_iterator edge;
+    std::vector<std::vector<std::pair<int, const Edge*> > > callers(m_functions.size());
+    FILE* fp = m_pstats;
+
+    // callers of each function
+    for (edge = m_edges.begin(); edge != m_edges.end(); ++edge)
+    {
+        callers[edge->first.second].push_back(std::make_pair(edge->first.first, &edge->second));
+    }
+
+    // dictionary {(file, line, function): (cc, nc, tt, ct, callers)}, the function
+    // address is used as line number to keep the homonyms apart
+    fputc('{', fp);
+    for (int i = 0; i < (int)m_functions.size(); i++)
+    {
+        const Function& function = m_functions[i];
+
+        // skip the functions never executed
+        if ((function.calls == 0) && (function.instrs == 0))
+        {
+            continue;
+        }
+
+        marshal_tuple(fp, 3);
+        marshal_string(fp, m_elfpath.c_str());
+        marshal_int(fp, this->address(i));
+        marshal_string(fp, this->name(i));
+
+        marshal_tuple(fp, 5);
+        marshal_int(fp, function.primitive);
+        marshal_int(fp, function.calls);
+        marshal_float(fp, function.cycles);
+        marshal_float(fp, function.incl_cycles);
+
+        // callers {(file, line, function): (nc, cc, tt, ct)}, the own time being
+        // shared in proportion of the calls
+        fputc('{', fp);
+        for (size_t j = 0; j < callers[i].size(); j++)
+        {
+            int caller = callers[i][j].first;
+            const Edge* stats = callers[i][j].second;
+
+            marshal_tuple(fp, 3);
+            marshal_string(fp, m_elfpath.c_str());
+            marshal_int(fp, this->address(caller));
+            marshal_string(fp, this->name(caller));
+
+            marshal_tuple(fp, 4);
+            marshal_int(fp, stats->calls);
+            marshal_int(fp, stats->calls);
+            marshal_float(fp, (double)function.cycles * stats->calls / function.calls);
+            marshal_float(fp, stats->incl_cycles);
+        }
+        fputc('0', fp);
+    }
+    fputc('0', fp);
+
+    fclose(fp);
+}
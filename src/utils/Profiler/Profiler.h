@@ -0,0 +1,220 @@
+#ifndef PROFILER_H_
+#define PROFILER_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <string>
+#include <vector>
+#include <map>
+
+#include "Parameters.h"
+
+// symbol index
+#include "ElfReader/ElfReader.h"
+
+// instruction flow observer
+#include "arm.h"
+
+/// Maximum depth of the call stack (deeper calls unwind the stack)
+#define PROFILER_MAX_DEPTH 4096
+
+/// Number of frames checked when looking for the target of a return
+#define PROFILER_UNWIND_DEPTH 16
+
+/** Guest profiler of an ARM core.
+ * The instructions and the cycles executed are attributed to the functions of the
+ * ELF file, and the calls are tracked to build the call graph:
+ *  - a call is a branch setting the link register to the next instruction (BL, BLX,
+ *    MOV lr, pc followed by BX)
+ *  - a return is a branch to the return address of a frame of the call stack (BX lr,
+ *    POP {pc}, LDM, exception returns)
+ *  - a branch to the start of another function is a tail call
+ *  - an exception is a call from the interrupted function
+ *
+ * The profiler is configured from the CPU configuration:
+ * <pre>
+ * profile firmware
+ *     period 1
+ * </pre>
+ * where the value gives the base name of the files written at exit:
+ *  - firmware.callgrind, in callgrind format (kcachegrind)
+ *  - firmware.pstats, in python pstats format (tools/RunSnakeRun), the times being
+ *    the numbers of cycles
+ *
+ * The optional period reduces the cost of the profiling: the core reports all the
+ * branch targets but only one sequential instruction out of N (1, the default, reports
+ * every instruction).  The instructions not reported are attributed to the function of
+ * the previous report, so the profile stays exact except for the code falling through
+ * to the next function.
+ */
+struct Profiler : arm_observer
+{
+    /** Constructor
+     * @param[in] elfpath ELF file executed by the core
+     * @param[in] parameters Command line parameters
+     * @param[in] config Profile parameter of the CPU configuration
+     */
+    Profiler(const std::string& elfpath, Parameters& parameters, Parameter& config);
+
+    /** Get the reporting period of the sequential instructions
+     * @return The period option
+     */
+    uint32_t
+    period() const
+    {
+        return m_period;
+    }
+
+    /// Implementation of arm_observer virtual function
+    void
+    arm_instr(uint32_t pc, uint32_t lr, bool thumb, uint32_t cycles, uint32_t instrs);
+
+    /// Implementation of arm_observer virtual function
+    void
+    arm_exception(uint32_t vector, uint32_t ret);
+
+    /// Write the profiles of all the profilers
+    static void
+    close();
+
+private:
+    /// Statistics of a function
+    struct Function
+    {
+        /// Number of calls
+        uint64_t calls;
+        /// Number of primitive (non recursive) calls
+        uint64_t primitive;
+        /// Instructions executed in the function
+        uint64_t instrs;
+        /// Cycles spent in the function
+        uint64_t cycles;
+        /// Instructions executed in the function and its callees
+        uint64_t incl_instrs;
+        /// Cycles spent in the function and its callees
+        uint64_t incl_cycles;
+        /// Number of frames of the function in the call stack
+        int active;
+    };
+
+    /// Statistics of the calls from a function to another
+    struct Edge
+    {
+        /// Number of calls
+        uint64_t calls;
+        /// Instructions executed by the callee
+        uint64_t incl_instrs;
+        /// Cycles spent by the callee
+        uint64_t incl_cycles;
+    };
+
+    /// Frame of the call stack
+    struct Frame
+    {
+        /// Function called
+        int function;
+        /// Return address (Thumb bit cleared)
+        uint32_t ret;
+        /// Instructions executed when the function was entered
+        uint64_t instrs;
+        /// Cycles elapsed when the function was entered
+        uint64_t cycles;
+        /// Statistics of the call (NULL for the root frame)
+        Edge* edge;
+    };
+
+    /** Find the function containing an address
+     * @param[in] pc Address to look for
+     * @return The function index (the last index is for the unknown code)
+     */
+    int
+    lookup(uint32_t pc);
+
+    /** Handle a non sequential instruction
+     * @param[in] pc Address of the instruction
+     * @param[in] lr Link register of the current mode
+     */
+    void
+    branch(uint32_t pc, uint32_t lr);
+
+    /** Push a frame on the call stack
+     * @param[in] caller Calling function (-1 for the root frame)
+     * @param[in] function Function called
+     * @param[in] ret Return address
+     */
+    void
+    push(int caller, int function, uint32_t ret);
+
+    /// Pop the top frame of the call stack
+    void
+    pop();
+
+    /** Get the name of a function
+     * @param[in] function Function index
+     * @return The name of the function
+     */
+    const char*
+    name(int function);
+
+    /** Get the address of a function
+     * @param[in] function Function index
+     * @return The start address of the function
+     */
+    uint32_t
+    address(int function);
+
+    /// Write the profile in callgrind format
+    void
+    write_callgrind();
+
+    /// Write the profile in pstats format
+    void
+    write_pstats();
+
+    /// ELF file executed
+    std::string m_elfpath;
+    /// Callgrind output file
+    FILE* m_callgrind;
+    /// Pstats output file
+    FILE* m_pstats;
+    /// Symbols of the ELF file
+    ElfReader m_elf;
+
+    /// Statistics of the functions, indexed as the symbols (plus the unknown code)
+    std::vector<Function> m_functions;
+    /// Statistics of the calls, indexed by (caller, callee)
+    std::map<std::pair<int, int>, Edge> m_edges;
+    /// Call stack
+    std::vector<Frame> m_stack;
+
+    /// Reporting period of the sequential instructions
+    uint32_t m_period;
+
+    /// Total number of instructions executed
+    uint64_t m_instrs;
+    /// Total number of cycles elapsed
+    uint64_t m_cycles;
+    /// Cycle counter of the core at the last instruction
+    uint32_t m_last;
+    /// Instruction counter of the core at the last instruction
+    uint32_t m_last_instrs;
+    /// Address of the next sequential instruction
+    uint32_t m_next;
+    /// Size of the instructions since the last instruction (0 before the first one)
+    uint32_t m_step;
+    /// Function of the last instruction (-1 before the first instruction)
+    int m_function;
+    /// Address range of the function of the last instruction
+    uint32_t m_start, m_end;
+
+    /// Indicates that an exception was taken before the current instruction
+    bool m_exception;
+    /// Return address of the exception
+    uint32_t m_exception_ret;
+
+    /// All the profilers, written at exit
+    static std::vector<Profiler*> s_profilers;
+};
+
+#endif /*PROFILER_H_*/
@@ -0,0 +1,157 @@
+#include "RegStats/RegStats.h"
+#include "utils.h"
+#include "gdbserver.h"
+
+#include <stdlib.h>
+
+std::string RegStats::s_path;
+uint32_t RegStats::s_top = 10;
+std::vector<RegStats::Block> RegStats::s_blocks;
+
+void
+RegStats::configure(Parameters& parameters, Parameter& config)
+{
+    MSP* options = config.get_config();
+    FILE* file;
+
+    // sanity check
+    if (!s_path.empty())
+    {
+        SYS_ERR("regstats", "regstats already configured");
+    }
+
+    // number of registers reported per block
+    if (options->count("top") != 0)
+    {
+        s_top = strtoul((*options)["top"]->c_str(), NULL, 0);
+        if (s_top == 0)
+        {
+            SYS_ERR("regstats", "invalid top %s", (*options)["top"]->c_str());
+        }
+    }
+
+    // the report file is relative to the configuration file
+    config.add_path(parameters.configpath);
+    s_path = config.c_str();
+    file = fopen(s_path.c_str(), "w");
+    if (file == NULL)
+    {
+        SYS_ERR("regstats", "can not create regstats file %s", s_path.c_str());
+    }
+    fclose(file);
+
+    // the report can be written on request from the debugger
+    gdbserver::add_monitor("regstats", &RegStats::monitor, NULL);
+
+    // the report is written whatever the way the simulation ends
+    atexit(&RegStats::close);
+}
+
+void
+RegStats::add_block(const char* name, uint32_t count, const uint64_t* reads, const uint64_t* writes,
+                    const RegNameFunc* names)
+{
+    Block block;
+
+    // the blocks are only tracked when the report is configured
+    if (s_path.empty())
+    {
+        return;
+    }
+    block.name = name;
+    block.count = count;
+    block.reads = reads;
+    block.writes = writes;
+    block.names = names;
+    s_blocks.push_back(block);
+}
+
+bool
+RegStats::dump(const char* path)
+{
+    FILE* file = fopen(path, "w");
+    std::vector<uint32_t> top;
+
+    if (file == NULL)
+    {
+        return true;
+    }
+
+    for (size_t b = 0; b < s_blocks.size(); b++)
+    {
+        const Block& block = s_blocks[b];
+        uint64_t reads = 0, writes = 0;
+
+        // hottest registers first (insertion in the top list)
+        top.clear();
+        for (uint32_t i = 0; i < block.count; i++)
+        {
+            uint64_t accesses = block.reads[i] + block.writes[i];
+            size_t pos = top.size();
+
+            reads += block.reads[i];
+            writes += block.writes[i];
+            if (accesses == 0)
+            {
+                continue;
+            }
+            while ((pos > 0) && ((block.reads[top[pos - 1]] + block.writes[top[pos - 1]]) < accesses))
+            {
+                pos--;
+            }
+            if (pos < s_top)
+            {
+                top.insert(top.begin() + pos, i);
+                if (top.size() > s_top)
+                {
+                    top.pop_back();
+                }
+            }
+        }
+
+        if ((reads + writes) == 0)
+        {
+            continue;
+        }
+        fprintf(file, "%s: %llu reads, %llu writes\n", block.name.c_str(),
+                (unsigned long long)reads, (unsigned long long)writes);
+        for (size_t i = 0; i < top.size(); i++)
+        {
+            uint32_t index = top[i];
+            const char* name = ((block.names != NULL) && (*block.names != NULL)) ? (*block.names)(index) : NULL;
+            char label[16];
+
+            if (name == NULL)
+            {
+                sprintf(label, "REG_%u", index);
+                name = label;
+            }
+            fprintf(file, "    %-16s 0x%03X  reads %12llu  writes %12llu  %5.1f%%\n", name, index * 4,
+                    (unsigned long long)block.reads[index], (unsigned long long)block.writes[index],
+                    100.0 * (block.reads[index] + block.writes[index]) / (reads + writes));
+        }
+    }
+    fclose(file);
+    return false;
+}
+
+std::string
+RegStats::monitor(void* opaque, const char* args)
+{
+    std::string path = (*args != '\0') ? args : s_path;
+
+    if (RegStats::dump(path.c_str()))
+    {
+        return "can not create regstats file " + path + "\n";
+    }
+    return "regstats written to " + path + "\n";
+}
+
+void
+RegStats::close()
+{
+    if (RegStats::dump(s_path.c_str()))
+    {
+        SYS_DBG("regstats", "can not create regstats file %s", s_path.c_str());
+    }
+}
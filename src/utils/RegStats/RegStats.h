@@ -0,0 +1,89 @@
+#ifndef REGSTATS_H_
+#define REGSTATS_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <string>
+#include <vector>
+
+#include "Parameters.h"
+
+/// Function giving the name of a register from its index (reg_name() of the register maps)
+typedef const char* (*RegNameFunc)(uint32_t index);
+
+/** Access statistics of the peripheral registers.
+ * Each Peripheral counts the reads and writes of each of its registers; the hottest
+ * registers of each block are reported at exit and on the remote GDB command
+ * "monitor regstats [file]", with the names of the generated register maps.
+ *
+ * The report is configured from the platform configuration file:
+ * <pre>
+ * regstats regstats.txt
+ *     top 10
+ * </pre>
+ * where the value gives the report file, and the optional top the number of registers
+ * reported per block (10 by default).
+ */
+struct RegStats
+{
+    /** Configure the report
+     * @param[in] parameters Command line parameters
+     * @param[in] config RegStats parameter of the configuration file
+     */
+    static void
+    configure(Parameters& parameters, Parameter& config);
+
+    /** Register the counters of a block
+     * @param[in] name Name of the block
+     * @param[in] count Number of registers of the block
+     * @param[in] reads Number of reads of each register
+     * @param[in] writes Number of writes of each register
+     * @param[in] names Function giving the name of the registers (NULL if none, read at report)
+     */
+    static void
+    add_block(const char* name, uint32_t count, const uint64_t* reads, const uint64_t* writes,
+              const RegNameFunc* names);
+
+    /** Write the report of all the blocks
+     * @param[in] path Path of the report file
+     * @return true if there was an error, false otherwise
+     */
+    static bool
+    dump(const char* path);
+
+    /// Write the report at exit
+    static void
+    close();
+
+private:
+    /// Counters of a block
+    struct Block
+    {
+        /// Name of the block
+        std::string name;
+        /// Number of registers
+        uint32_t count;
+        /// Number of reads of each register
+        const uint64_t* reads;
+        /// Number of writes of each register
+        const uint64_t* writes;
+        /// Function giving the name of the registers
+        const RegNameFunc* names;
+    };
+
+    /// Remote GDB monitor command writing the report
+    static std::string
+    monitor(void* opaque, const char* args);
+
+    /// Path of the report written at exit (empty if not configured)
+    static std::string s_path;
+
+    /// Number of registers reported per block
+    static uint32_t s_top;
+
+    /// Counters of the blocks
+    static std::vector<Block> s_blocks;
+};
+
+#endif /*REGSTATS_H_*/
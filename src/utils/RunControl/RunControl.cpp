@@ -0,0 +1,208 @@
+#include "RunControl/RunControl.h"
+#include "ElfReader/ElfReader.h"
+#include "utils.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/time.h>
+
+/// Wall seconds left to the simulation to stop once the watchdog expired
+#define RUN_WATCHDOG_GRACE 5
+
+uint64_t RunControl::s_instructions = RUN_UNLIMITED;
+sc_core::sc_time RunControl::s_time;
+std::string RunControl::s_stop;
+bool RunControl::s_exit_word = false;
+uint32_t RunControl::s_exit_address = RUN_NO_ADDRESS;
+double RunControl::s_watchdog = 0;
+volatile bool RunControl::s_expired = false;
+volatile bool RunControl::s_finished = false;
+int RunControl::s_code = 0;
+
+/// Background thread of the watchdog
+static pthread_t run_thread;
+
+void
+RunControl::configure(Parameters& parameters)
+{
+    char unit[8];
+    double value;
+    char* end;
+
+    // instruction limit of each core
+    if (!parameters.instructions.get_string()->empty())
+    {
+        s_instructions = strtoull(parameters.instructions.c_str(), &end, 0);
+        if ((*end != '\0') || (s_instructions == 0))
+        {
+            SYS_ERR("run", "invalid instruction count %s", parameters.instructions.c_str());
+        }
+    }
+
+    // simulated time limit, in seconds unless a unit is given
+    if (!parameters.time.get_string()->empty())
+    {
+        strcpy(unit, "s");
+        if ((sscanf(parameters.time.c_str(), "%lf%7s", &value, unit) < 1) || (value <= 0))
+        {
+            SYS_ERR("run", "invalid time %s", parameters.time.c_str());
+        }
+        if (strcmp(unit, "s") == 0)
+        {
+            s_time = sc_core::sc_time(value, sc_core::SC_SEC);
+        }
+        else if (strcmp(unit, "ms") == 0)
+        {
+            s_time = sc_core::sc_time(value, sc_core::SC_MS);
+        }
+        else if (strcmp(unit, "us") == 0)
+        {
+            s_time = sc_core::sc_time(value, sc_core::SC_US);
+        }
+        else if (strcmp(unit, "ns") == 0)
+        {
+            s_time = sc_core::sc_time(value, sc_core::SC_NS);
+        }
+        else
+        {
+            SYS_ERR("run", "invalid time unit %s (s, ms, us or ns)", unit);
+        }
+    }
+
+    // stop address, resolved by each core in its own ELF file
+    s_stop = *parameters.stop.get_string();
+
+    // test finished word
+    if (!parameters.exitword.get_string()->empty())
+    {
+        s_exit_address = strtoul(parameters.exitword.c_str(), &end, 0);
+        if (*end != '\0')
+        {
+            SYS_ERR("run", "invalid test finished address %s", parameters.exitword.c_str());
+        }
+        s_exit_word = true;
+    }
+
+    // wall time limit
+    if (!parameters.watchdog.get_string()->empty())
+    {
+        s_watchdog = atof(parameters.watchdog.c_str());
+        if (s_watchdog <= 0)
+        {
+            SYS_ERR("run", "invalid watchdog %s", parameters.watchdog.c_str());
+        }
+        if (pthread_create(&run_thread, NULL, &RunControl::watchdog, NULL) != 0)
+        {
+            SYS_ERR("run", "can not create the watchdog thread");
+        }
+        pthread_detach(run_thread);
+    }
+}
+
+int
+RunControl::start()
+{
+    if (s_time == sc_core::SC_ZERO_TIME)
+    {
+        sc_core::sc_start();
+        return s_code;
+    }
+
+    sc_core::sc_start(s_time);
+    if (!s_finished)
+    {
+        s_finished = true;
+        SYS_DBG("run", "simulated time limit reached, exit code %d", s_code);
+    }
+    return s_code;
+}
+
+uint32_t
+RunControl::stop_address(const char* owner, const std::string* elfpath)
+{
+    ElfReader elf;
+    uint32_t addr;
+    char* end;
+    int i;
+
+    if (s_stop.empty())
+    {
+        return RUN_NO_ADDRESS;
+    }
+
+    // an address is used as is
+    addr = strtoul(s_stop.c_str(), &end, 0);
+    if (*end == '\0')
+    {
+        return addr;
+    }
+
+    // a symbol is looked up in the functions of the firmware of the core
+    if (elfpath != NULL)
+    {
+        elf.Open(elfpath->c_str(), true);
+        for (i = 0; i < elf.SymbolsNum(); i++)
+        {
+            if (strcmp(elf.GetSymbol(i)->Name(), s_stop.c_str()) == 0)
+            {
+                SYS_DBG(owner, "stop at %s (0x%08X)", s_stop.c_str(), elf.GetSymbol(i)->Address());
+                return elf.GetSymbol(i)->Address();
+            }
+        }
+    }
+    SYS_DBG(owner, "stop symbol %s not found, the core does not stop on it", s_stop.c_str());
+    return RUN_NO_ADDRESS;
+}
+
+void
+RunControl::finish(const char* owner, const char* reason, int code)
+{
+    // the first condition met gives the exit code
+    if (!s_finished)
+    {
+        s_finished = true;
+        s_code = code;
+        SYS_DBG(owner, "%s, exit code %d", reason, code);
+        sc_core::sc_stop();
+    }
+
+    // the simulation stops at the end of the current delta cycle
+    sc_core::wait();
+}
+
+void*
+RunControl::watchdog(void* arg)
+{
+    struct timeval start, now;
+    double limit = s_watchdog;
+
+    gettimeofday(&start, NULL);
+    while (true)
+    {
+        // sleep in short steps to leave quickly once the simulation stopped
+        usleep(10000);
+        if (s_finished)
+        {
+            return NULL;
+        }
+        gettimeofday(&now, NULL);
+        if ((now.tv_sec - start.tv_sec) + (now.tv_usec - start.tv_usec) / 1e6 < limit)
+        {
+            continue;
+        }
+
+        // first ask the simulation thread to stop, then kill the process if it is stuck
+        if (!s_expired)
+        {
+            s_expired = true;
+            limit += RUN_WATCHDOG_GRACE;
+            continue;
+        }
+        fprintf(stderr, "watchdog: simulation not responding, exit code %d\n", RUN_WATCHDOG_CODE);
+        fflush(stdout);
+        _exit(RUN_WATCHDOG_CODE);
+    }
+    return NULL;
+}
@@ -0,0 +1,135 @@
+#ifndef RUNCONTROL_H_
+#define RUNCONTROL_H_
+
+#include "systemc"
+
+#include <stdint.h>
+
+#include <string>
+
+#include "Parameters.h"
+
+/// Instruction count of a core without limit
+#define RUN_UNLIMITED (~0ULL)
+
+/// Address of a core without stop address (never an instruction address)
+#define RUN_NO_ADDRESS (0xFFFFFFFF)
+
+/// Exit code of a simulation stopped by the watchdog (same as timeout(1))
+#define RUN_WATCHDOG_CODE 124
+
+/** Stop conditions of the simulation.
+ * The simulation ends with the first condition met, the process exit code is given by
+ * the condition:
+ *  - a core executed the number of instructions of the -n option (exit code 0)
+ *  - the simulated time of the -t option elapsed (exit code 0)
+ *  - a core executed the instruction at the symbol or address of the -s option (exit
+ *    code in r0, so a stop at the exit function of the C library gives its argument)
+ *  - the firmware wrote the test finished word at the address of the -x option (exit
+ *    code written)
+ *  - the wall time of the -w option elapsed (exit code RUN_WATCHDOG_CODE)
+ *
+ * The conditions are checked where the simulation already spends its time outside of the
+ * instruction decode: the instruction and address limits by the loop calling the ISS, the
+ * test finished word on the word writes leaving the core (the word must not be cached in
+ * write-back), the watchdog with the periodic reports (RunControl::poll()).
+ *
+ * The simulation is stopped by sc_stop(), so the reports written at exit are complete.
+ */
+struct RunControl
+{
+    /** Configure the stop conditions and start the watchdog
+     * @param[in] parameters Command line parameters
+     */
+    static void
+    configure(Parameters& parameters);
+
+    /** Run the simulation until a stop condition is met
+     * @return The exit code of the condition met
+     */
+    static int
+    start();
+
+    /** Get the number of instructions executed by a core before the simulation stops
+     * @return The number of instructions, RUN_UNLIMITED if none
+     */
+    static uint64_t
+    instructions()
+    {
+        return s_instructions;
+    }
+
+    /** Get the address of the instruction stopping the simulation
+     * @param[in] owner Name of the core (used in the messages)
+     * @param[in] elfpath ELF file of the core, to look up a symbol (NULL if none)
+     * @return The address of the instruction, RUN_NO_ADDRESS if none
+     */
+    static uint32_t
+    stop_address(const char* owner, const std::string* elfpath);
+
+    /** Check if a word write is the test finished word
+     * @param[in] owner Name of the core (used in the messages)
+     * @param[in] addr Address written
+     * @param[in] data Data written, used as exit code
+     */
+    static void
+    check_write(const char* owner, uint32_t addr, uint32_t data)
+    {
+        if (__builtin_expect(addr == s_exit_address, 0) && s_exit_word)
+        {
+            RunControl::finish(owner, "test finished", data);
+        }
+    }
+
+    /// Stop the simulation if the watchdog expired (called from the simulation thread)
+    static void
+    poll()
+    {
+        if (__builtin_expect(s_expired, 0))
+        {
+            RunControl::finish("watchdog", "wall time limit reached", RUN_WATCHDOG_CODE);
+        }
+    }
+
+    /** Stop the simulation, the calling thread never resumes
+     * @param[in] owner Name of the module stopping the simulation
+     * @param[in] reason Condition met
+     * @param[in] code Exit code of the simulation (the first condition met gives it)
+     */
+    static void
+    finish(const char* owner, const char* reason, int code);
+
+private:
+    /// Background thread of the watchdog
+    static void*
+    watchdog(void* arg);
+
+    /// Number of instructions executed by a core before the simulation stops
+    static uint64_t s_instructions;
+
+    /// Simulated time of the simulation (zero if not limited)
+    static sc_core::sc_time s_time;
+
+    /// Symbol or address of the instruction stopping the simulation (empty if none)
+    static std::string s_stop;
+
+    /// Indicates that the test finished word is configured
+    static bool s_exit_word;
+
+    /// Address of the test finished word
+    static uint32_t s_exit_address;
+
+    /// Wall time of the simulation in seconds (0 if not limited)
+    static double s_watchdog;
+
+    /// Indicates that the watchdog expired
+    static volatile bool s_expired;
+
+    /// Indicates that the simulation is stopping
+    static volatile bool s_finished;
+
+    /// Exit code of the simulation
+    static int s_code;
+};
+
+#endif /*RUNCONTROL_H_*/
@@ -0,0 +1,215 @@
+#include "SyncShm/SyncShm.h"
+#include "utils.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stddef.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+uint32_t
+SyncShm::nodes(const char* owner, Parameters& parameters, Parameter& config)
+{
+    MSP& options = *config.get_config();
+
+    if (options.count("nodes") == 0)
+    {
+        return parameters.platforms;
+    }
+    if (options["nodes"]->get_int() <= 0)
+    {
+        SYS_ERR(owner, "invalid nodes %s", options["nodes"]->c_str());
+    }
+    return options["nodes"]->get_int();
+}
+
+SyncShmHeader*
+SyncShm::open(const char* owner, const std::string& path, size_t size, uint32_t magic, uint32_t expected)
+{
+    struct stat st;
+    bool creator;
+    int fd;
+
+    // the first process creates the shared memory, the others wait until it is initialized
+    m_path = path;
+    m_size = size;
+    fd = shm_open(m_path.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    creator = (fd >= 0);
+    if (creator)
+    {
+        if (ftruncate(fd, m_size) != 0)
+        {
+            SYS_ERR(owner, "can not size %s", m_path.c_str());
+        }
+    }
+    else
+    {
+        fd = shm_open(m_path.c_str(), O_RDWR, 0);
+        while ((fd >= 0) && (fstat(fd, &st) == 0) && ((size_t)st.st_size < m_size))
+        {
+            usleep(SYNCSHM_POLL_US);
+        }
+    }
+    if (fd < 0)
+    {
+        SYS_ERR(owner, "can not open %s", m_path.c_str());
+    }
+    m_header = (SyncShmHeader*)mmap(NULL, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (m_header == MAP_FAILED)
+    {
+        SYS_ERR(owner, "can not map %s", m_path.c_str());
+    }
+    if (creator)
+    {
+        __sync_synchronize();
+        m_header->magic = magic;
+    }
+    while (m_header->magic != magic)
+    {
+        usleep(SYNCSHM_POLL_US);
+    }
+
+    this->lock();
+
+    // the content left by killed processes is cleared
+    if (this->count() == 0)
+    {
+        memset((uint8_t*)m_header + offsetof(SyncShmHeader, joined), 0,
+               m_size - offsetof(SyncShmHeader, joined));
+    }
+
+    // take a free node, starting at the current time
+    for (m_node = 0; m_node < SYNCSHM_MAX_NODES; m_node++)
+    {
+        if (m_header->pid[m_node] == 0)
+        {
+            m_header->time[m_node] = sc_core::sc_time_stamp().value();
+            m_header->pid[m_node] = getpid();
+            m_header->joined++;
+            break;
+        }
+    }
+
+    this->unlock();
+
+    if (m_node == SYNCSHM_MAX_NODES)
+    {
+        SYS_ERR(owner, "too many processes in %s", m_path.c_str());
+    }
+    m_expected = expected;
+
+    return m_header;
+}
+
+void
+SyncShm::lock()
+{
+    while (__sync_lock_test_and_set(&m_header->lock, 1))
+    {
+        usleep(SYNCSHM_POLL_US);
+    }
+}
+
+void
+SyncShm::unlock()
+{
+    __sync_lock_release(&m_header->lock);
+}
+
+void
+SyncShm::sync()
+{
+    uint64_t now = sc_core::sc_time_stamp().value();
+    uint32_t i;
+
+    // the first time, wait for all the nodes to join
+    if (m_expected != 0)
+    {
+        if (m_header->joined < m_expected)
+        {
+            SYS_DBG(m_path.c_str(), "waiting for %d processes", m_expected - m_header->joined);
+        }
+        while (m_header->joined < m_expected)
+        {
+            usleep(SYNCSHM_POLL_US);
+        }
+        m_expected = 0;
+    }
+
+    // publish the time reached, then wait for the other nodes to reach it
+    __sync_synchronize();
+    m_header->time[m_node] = now;
+    for (i = 0; i < SYNCSHM_MAX_NODES; i++)
+    {
+        while ((i != m_node) && (m_header->pid[i] != 0) && (m_header->time[i] < now))
+        {
+            // a process killed does not leave the shared memory
+            if (!this->alive(i))
+            {
+                break;
+            }
+            usleep(SYNCSHM_POLL_US);
+        }
+    }
+}
+
+void
+SyncShm::close()
+{
+    bool last;
+
+    if (m_header == NULL)
+    {
+        return;
+    }
+
+    // the last node removes the shared memory
+    this->lock();
+    m_header->pid[m_node] = 0;
+    last = (this->count() == 0);
+    this->unlock();
+    if (last)
+    {
+        shm_unlink(m_path.c_str());
+    }
+    munmap(m_header, m_size);
+    m_header = NULL;
+}
+
+bool
+SyncShm::alive(uint32_t node)
+{
+    int32_t pid = m_header->pid[node];
+
+    if (pid == 0)
+    {
+        return false;
+    }
+    if ((kill(pid, 0) == 0) || (errno != ESRCH))
+    {
+        return true;
+    }
+
+    // the process no longer exists
+    __sync_bool_compare_and_swap(&m_header->pid[node], pid, 0);
+    return false;
+}
+
+uint32_t
+SyncShm::count()
+{
+    uint32_t count = 0;
+
+    for (uint32_t i = 0; i < SYNCSHM_MAX_NODES; i++)
+    {
+        if (this->alive(i))
+        {
+            count++;
+        }
+    }
+    return count;
+}
@@ -0,0 +1,131 @@
+#ifndef SYNCSHM_H_
+#define SYNCSHM_H_
+
+/// Shared memory joined by several simulator processes, with time synchronization
+
+#include "systemc"
+
+#include <stdint.h>
+
+#include <string>
+
+#include "Parameters.h"
+
+/// Maximum number of processes joining a shared memory
+#define SYNCSHM_MAX_NODES 64
+
+/// Host polling period while waiting for the other processes in us
+#define SYNCSHM_POLL_US 50
+
+/// Header of the shared memory (the content of the user follows)
+struct SyncShmHeader
+{
+    /// Magic number of the content (set by the first process)
+    volatile uint32_t magic;
+    /// Lock of the nodes table and of the content
+    volatile uint32_t lock;
+    /// Number of nodes joined since the content was initialized
+    volatile uint32_t joined;
+    /// Process identifier of each node (0 for a free entry)
+    volatile int32_t pid[SYNCSHM_MAX_NODES];
+    /// Time reached by each node (time resolution units)
+    volatile uint64_t time[SYNCSHM_MAX_NODES];
+};
+
+/** Node of a POSIX shared memory joined by several simulator processes.
+ * The first process creates the shared memory, the content is cleared when a process joins
+ * it while no node is alive (left over by processes killed before leaving). The nodes of
+ * processes which no longer exist are dropped, so they never block the others.
+ *
+ * The simulated times of the nodes are kept together by a conservative synchronization:
+ * sync() publishes the time of the node then waits for the other nodes to reach it. The
+ * first call also waits for the expected number of nodes to join, so no node goes past the
+ * start time before the values of the others can reach it.
+ */
+struct SyncShm
+{
+    /// Constructor
+    SyncShm()
+    : m_header(NULL)
+    , m_size(0)
+    , m_node(0)
+    , m_expected(1)
+    {
+    }
+
+    /** Get the number of nodes expected in a shared memory
+     * @param[in] owner Name of the module (used in the messages)
+     * @param[in] parameters Command line parameters
+     * @param[in] config Parameter of the shared memory, with an optional "nodes" sub-option
+     * @return The "nodes" sub-option, the number of platforms of the command line if none
+     */
+    static uint32_t
+    nodes(const char* owner, Parameters& parameters, Parameter& config);
+
+    /** Create or join a shared memory, starting at the current time
+     * @param[in] owner Name of the module (used in the messages)
+     * @param[in] path Name of the shared memory
+     * @param[in] size Size of the shared memory, starting with a SyncShmHeader
+     * @param[in] magic Magic number of the content
+     * @param[in] expected Number of nodes to wait for before the first synchronization
+     * @return The shared memory
+     */
+    SyncShmHeader*
+    open(const char* owner, const std::string& path, size_t size, uint32_t magic, uint32_t expected);
+
+    /// Take the lock of the shared memory
+    void
+    lock();
+
+    /// Release the lock of the shared memory
+    void
+    unlock();
+
+    /// Publish the current time and wait for the other nodes to reach it
+    void
+    sync();
+
+    /// Leave the shared memory, removed when the last node leaves
+    void
+    close();
+
+    /** Get the node of this process
+     * @return The index of the node
+     */
+    uint32_t
+    node() const
+    {
+        return m_node;
+    }
+
+private:
+    /** Check if the process of a node still exists, drop the node otherwise
+     * @param[in] node Index of the node
+     * @return true if the node is alive
+     */
+    bool
+    alive(uint32_t node);
+
+    /** Drop the dead nodes and count the alive ones (lock taken)
+     * @return The number of nodes alive
+     */
+    uint32_t
+    count();
+
+    /// Name of the shared memory
+    std::string m_path;
+
+    /// Shared memory
+    SyncShmHeader* m_header;
+
+    /// Size of the shared memory
+    size_t m_size;
+
+    /// Node of this process
+    uint32_t m_node;
+
+    /// Number of nodes to wait for before the first synchronization (0 once reached)
+    uint32_t m_expected;
+};
+
+#endif /*SYNCSHM_H_*/
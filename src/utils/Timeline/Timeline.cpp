@@ -0,0 +1,257 @@
+#include "Timeline/Timeline.h"
+#include "utils.h"
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+/** Timeline file format (Chrome trace-event JSON, array form):
+ *  - a "thread_name" metadata event declaring the track of each process
+ *  - a complete event ("X") for each activation of a process, with the wall time
+ *    in us as time base and the simulation time and waited condition as arguments
+ *  - an instant event ("i") for each notification, on the track of the notifier
+ * The closing bracket is written at exit, the viewers accept the file without it.
+ */
+
+std::map<const char*, uint64_t> Timeline::s_begin;
+uint64_t Timeline::s_switch = 0;
+std::map<const char*, int> Timeline::s_tracks;
+FILE* Timeline::s_file = NULL;
+uint64_t Timeline::s_start = 0;
+TimelineRecord* Timeline::s_ring = NULL;
+volatile uint32_t Timeline::s_head = 0;
+volatile uint32_t Timeline::s_tail = 0;
+volatile bool Timeline::s_stop = false;
+
+/// Background thread draining the ring buffer
+static pthread_t timeline_thread;
+
+void
+Timeline::configure(Parameters& parameters, Parameter& config)
+{
+    // sanity check
+    if (s_ring != NULL)
+    {
+        SYS_ERR("timeline", "timeline already configured");
+    }
+
+    // the timeline file is relative to the configuration file
+    config.add_path(parameters.configpath);
+    s_file = fopen(config.c_str(), "w");
+    if (s_file == NULL)
+    {
+        SYS_ERR("timeline", "can not create timeline file %s", config.c_str());
+    }
+    fprintf(s_file, "[\n");
+    fprintf(s_file, "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": 0, "
+            "\"args\": {\"name\": \"simulation\"}}");
+
+    s_start = Timeline::wall();
+
+    // create the ring buffer and start draining it
+    s_ring = new TimelineRecord[TIMELINE_RING_SIZE];
+    if (pthread_create(&timeline_thread, NULL, &Timeline::drain, NULL) != 0)
+    {
+        SYS_ERR("timeline", "can not create the timeline thread");
+    }
+
+    // the timeline is flushed whatever the way the simulation ends
+    atexit(&Timeline::close);
+}
+
+uint64_t
+Timeline::wall()
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec - s_start;
+}
+
+TimelineRecord*
+Timeline::reserve()
+{
+    // wait for a free record if the ring buffer is full
+    while ((s_head - s_tail) >= TIMELINE_RING_SIZE)
+    {
+        sched_yield();
+    }
+    return &s_ring[s_head & (TIMELINE_RING_SIZE - 1)];
+}
+
+void
+Timeline::commit()
+{
+    // make sure the record is written before the head
+    __sync_synchronize();
+    s_head = s_head + 1;
+}
+
+const char*
+Timeline::suspend(const char* label)
+{
+    const char* process = sc_core::sc_get_current_process_handle().name();
+    std::map<const char*, uint64_t>::iterator begin = s_begin.find(process);
+    TimelineRecord* record;
+    uint64_t now = Timeline::wall();
+
+    record = Timeline::reserve();
+    record->kind = TimelineRecord::SLICE;
+    // the first activation of a process started after the last suspension
+    record->begin = (begin != s_begin.end()) ? begin->second : s_switch;
+    record->end = now;
+    record->sim = sc_core::sc_time_stamp().to_seconds();
+    record->process = process;
+    record->module = NULL;
+    record->label = label;
+    Timeline::commit();
+
+    s_switch = now;
+    return process;
+}
+
+void
+Timeline::resume(const char* process)
+{
+    s_begin[process] = Timeline::wall();
+}
+
+void
+Timeline::notify(const char* module, const char* label)
+{
+    TimelineRecord* record;
+
+    record = Timeline::reserve();
+    record->kind = TimelineRecord::NOTIFY;
+    record->begin = record->end = Timeline::wall();
+    record->sim = sc_core::sc_time_stamp().to_seconds();
+    record->process = sc_core::sc_get_current_process_handle().name();
+    record->module = module;
+    record->label = label;
+    Timeline::commit();
+}
+
+void
+Timeline::string(const char* str)
+{
+    fputc('"', s_file);
+    for (; *str != '\0'; str++)
+    {
+        if ((*str == '"') || (*str == '\\'))
+            fputc('\\', s_file);
+        fputc(*str, s_file);
+    }
+    fputc('"', s_file);
+}
+
+int
+Timeline::track(const char* process)
+{
+    std::map<const char*, int>::const_iterator i;
+    int tid;
+
+    // notifications outside of the processes go to the simulation track
+    if (*process == '\0')
+    {
+        return 0;
+    }
+
+    i = s_tracks.find(process);
+    if (i != s_tracks.end())
+    {
+        return i->second;
+    }
+
+    // declare the track of the process
+    tid = s_tracks.size() + 1;
+    s_tracks[process] = tid;
+    fprintf(s_file, ",\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": %d, \"args\": {\"name\": ", tid);
+    Timeline::string(process);
+    fprintf(s_file, "}}");
+    return tid;
+}
+
+void
+Timeline::write(const TimelineRecord& record)
+{
+    int tid = Timeline::track(record.process);
+
+    if (record.kind == TimelineRecord::SLICE)
+    {
+        const char* name = strrchr(record.process, '.');
+
+        fprintf(s_file, ",\n{\"name\": ");
+        Timeline::string((name != NULL) ? name + 1 : record.process);
+        fprintf(s_file, ", \"cat\": \"process\", \"ph\": \"X\", \"pid\": 1, \"tid\": %d, "
+                "\"ts\": %.3f, \"dur\": %.3f, \"args\": {\"sim_seconds\": %.12g, \"wait\": ",
+                tid, record.begin / 1e3, (record.end - record.begin) / 1e3, record.sim);
+        Timeline::string(record.label);
+        fprintf(s_file, "}}");
+    }
+    else
+    {
+        fprintf(s_file, ",\n{\"name\": ");
+        Timeline::string(record.label);
+        fprintf(s_file, ", \"cat\": \"notify\", \"ph\": \"i\", \"s\": \"t\", \"pid\": 1, \"tid\": %d, "
+                "\"ts\": %.3f, \"args\": {\"sim_seconds\": %.12g, \"module\": ",
+                tid, record.begin / 1e3, record.sim);
+        Timeline::string(record.module);
+        fprintf(s_file, "}}");
+    }
+}
+
+void*
+Timeline::drain(void* arg)
+{
+    while (true)
+    {
+        uint32_t head = s_head;
+        uint32_t tail = s_tail;
+
+        if (head == tail)
+        {
+            // check if everything was written
+            if (s_stop)
+            {
+                break;
+            }
+            usleep(1000);
+            continue;
+        }
+
+        // make sure the records are read after the head
+        __sync_synchronize();
+
+        for (; tail != head; tail++)
+        {
+            Timeline::write(s_ring[tail & (TIMELINE_RING_SIZE - 1)]);
+        }
+
+        // release the records
+        __sync_synchronize();
+        s_tail = head;
+    }
+    return NULL;
+}
+
+void
+Timeline::close()
+{
+    // check if the timeline is running
+    if (s_ring == NULL)
+    {
+        return;
+    }
+
+    // flush the records
+    s_stop = true;
+    pthread_join(timeline_thread, NULL);
+    delete[] s_ring;
+    s_ring = NULL;
+
+    fprintf(s_file, "\n]\n");
+    fclose(s_file);
+    s_file = NULL;
+}
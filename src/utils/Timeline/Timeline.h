@@ -0,0 +1,185 @@
+#ifndef TIMELINE_H_
+#define TIMELINE_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <map>
+
+#include "Parameters.h"
+
+/// Number of records in the timeline ring buffer (must be a power of 2)
+#define TIMELINE_RING_SIZE 65536
+
+/// Macro to wait in a SystemC thread, recording the activations of the thread
+/// @param ... arguments of sc_core::wait()
+#define TIMELINE_WAIT(...)                                                  \
+do {                                                                        \
+    if (__builtin_expect(Timeline::enabled(), 0)) {                         \
+        const char* __process = Timeline::suspend(#__VA_ARGS__);            \
+        sc_core::wait(__VA_ARGS__);                                         \
+        Timeline::resume(__process);                                        \
+    } else {                                                                \
+        sc_core::wait(__VA_ARGS__);                                         \
+    }                                                                       \
+} while (0)
+
+/// Macro to notify an event from SC modules, recording the notification
+/// @param __e event to notify
+/// @param ... arguments of sc_core::sc_event::notify()
+#define TIMELINE_NOTIFY(__e, ...)                                           \
+do {                                                                        \
+    if (__builtin_expect(Timeline::enabled(), 0)) {                         \
+        Timeline::notify(this->name(), #__e);                               \
+    }                                                                       \
+    (__e).notify(__VA_ARGS__);                                              \
+} while (0)
+
+/// Timeline record, formatted by the background thread
+struct TimelineRecord
+{
+    /// Kinds of the records
+    enum
+    {
+        SLICE,
+        NOTIFY
+    };
+
+    /// Wall time of the start of the record in ns
+    uint64_t begin;
+    /// Wall time of the end of the record in ns
+    uint64_t end;
+    /// Simulation time of the record in seconds
+    double sim;
+    /// Name of the running process
+    const char* process;
+    /// Name of the notifying module (notifications only)
+    const char* module;
+    /// Waited condition or notified event, as written in the source code
+    const char* label;
+    /// Kind of the record
+    int kind;
+};
+
+/** Timeline of the SystemC process activity.
+ * The activations of the threads (the wall time spent between two waits) and the
+ * event notifications are recorded in a ring buffer drained by a background thread
+ * to a Chrome trace-event JSON file, opened with chrome://tracing or Perfetto UI.
+ * Each thread gets its own track, and each slice gives the simulation time and the
+ * condition waited at its end.
+ *
+ * The models record their activity with TIMELINE_WAIT and TIMELINE_NOTIFY in place
+ * of sc_core::wait() and sc_core::sc_event::notify().
+ *
+ * The timeline is configured from the platform configuration file:
+ * <pre>
+ * timeline timeline.json
+ * </pre>
+ */
+struct Timeline
+{
+    /** Configure the timeline and start the background thread
+     * @param[in] parameters Command line parameters
+     * @param[in] config Timeline parameter of the configuration file
+     */
+    static void
+    configure(Parameters& parameters, Parameter& config);
+
+    /// Check if the timeline is recorded
+    static bool
+    enabled()
+    {
+        return s_ring != NULL;
+    }
+
+    /** Record the end of the activation of the current process
+     * @param[in] label Waited condition
+     * @return The name of the current process
+     */
+    static const char*
+    suspend(const char* label);
+
+    /** Record the start of an activation of a process
+     * @param[in] process Name of the process
+     */
+    static void
+    resume(const char* process);
+
+    /** Record an event notification
+     * @param[in] module Name of the notifying module
+     * @param[in] label Notified event
+     */
+    static void
+    notify(const char* module, const char* label);
+
+    /// Flush the ring buffer, stop the background thread and close the timeline file
+    static void
+    close();
+
+private:
+    /// Get the wall time since the configuration in ns
+    static uint64_t
+    wall();
+
+    /** Get a free record of the ring buffer
+     * @return The record to fill before calling commit()
+     */
+    static TimelineRecord*
+    reserve();
+
+    /// Publish the record returned by reserve()
+    static void
+    commit();
+
+    /** Write a record in the timeline file
+     * @param[in] record Record to write
+     */
+    static void
+    write(const TimelineRecord& record);
+
+    /** Get the track of a process, declaring it on first use
+     * @param[in] process Name of the process
+     * @return The thread identifier of the track
+     */
+    static int
+    track(const char* process);
+
+    /** Write a string in the timeline file, escaped for JSON
+     * @param[in] str String to write
+     */
+    static void
+    string(const char* str);
+
+    /// Background thread writing the records to the timeline file
+    static void*
+    drain(void* arg);
+
+    /// Start of the current activation of each process, by name
+    static std::map<const char*, uint64_t> s_begin;
+
+    /// Wall time of the last suspension (start of the activations not seen yet)
+    static uint64_t s_switch;
+
+    /// Track of each process, by name (background thread only)
+    static std::map<const char*, int> s_tracks;
+
+    /// Timeline file
+    static FILE* s_file;
+
+    /// Wall time of the configuration in ns since the epoch
+    static uint64_t s_start;
+
+    /// Ring buffer
+    static TimelineRecord* s_ring;
+
+    /// Number of records written in the ring buffer
+    static volatile uint32_t s_head;
+
+    /// Number of records drained from the ring buffer
+    static volatile uint32_t s_tail;
+
+    /// Indicates that the background thread must stop
+    static volatile bool s_stop;
+};
+
+#endif /*TIMELINE_H_*/
@@ -0,0 +1,406 @@
+#include "Trace/Trace.h"
+#include "utils.h"
+
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sched.h>
+
+/** Trace file format:
+ *  - header: "SOCTRACE" magic, record size and version (32 bits each)
+ *  - TraceRecord records, in the host byte order
+ *  - a record with the module 0xFFFF marking the end of the records
+ *  - the tables, as text lines:
+ *      R <time resolution in ps>
+ *      M <module id> <module name>
+ *      F <format id> <file>:<line> <format with \ and newlines escaped>
+ */
+
+/// Version of the trace file format
+#define TRACE_VERSION 1
+
+/// Module identifier marking the end of the records
+#define TRACE_END 0xFFFF
+
+bool Trace::s_configured = false;
+uint8_t Trace::s_level[TRACE_MAX_MODULES];
+std::vector<std::string> Trace::s_modules;
+std::map<std::string, uint16_t> Trace::s_ids;
+std::vector<TraceSite*> Trace::s_sites;
+std::map<std::string, int> Trace::s_config;
+int Trace::s_default = 0;
+FILE* Trace::s_file = NULL;
+TraceRecord* Trace::s_ring = NULL;
+volatile uint32_t Trace::s_head = 0;
+volatile uint32_t Trace::s_tail = 0;
+volatile bool Trace::s_stop = false;
+
+/// Background thread draining the ring buffer
+static pthread_t trace_thread;
+
+TraceSite::TraceSite(const char* file, int line, const char* format)
+: file(file)
+, line(line)
+, format(format)
+, nargs(0)
+, m_name(NULL)
+, m_module(0)
+{
+    const char* p = format;
+
+    // extract the kind of the arguments from the conversions
+    while ((p = strchr(p, '%')) != NULL)
+    {
+        int longs = 0;
+
+        p++;
+        if (*p == '%')
+        {
+            p++;
+            continue;
+        }
+
+        // flags, width and precision
+        while ((*p != '\0') && (strchr("-+ #0123456789.*", *p) != NULL))
+        {
+            if ((*p == '*') && (nargs < TRACE_MAX_ARGS))
+            {
+                args[nargs++] = ARG_INT;
+            }
+            p++;
+        }
+
+        // length modifiers
+        while ((*p != '\0') && (strchr("hlLqjzt", *p) != NULL))
+        {
+            if ((*p == 'l') || (*p == 'j') || (*p == 'z') || (*p == 't'))
+            {
+                longs++;
+            }
+            else if ((*p == 'L') || (*p == 'q'))
+            {
+                longs = 2;
+            }
+            p++;
+        }
+
+        if ((*p == '\0') || (nargs == TRACE_MAX_ARGS))
+        {
+            break;
+        }
+
+        // conversion
+        switch (*p)
+        {
+        case 'e': case 'E': case 'f': case 'F': case 'g': case 'G': case 'a': case 'A':
+            args[nargs++] = ARG_DOUBLE;
+            break;
+        case 's':
+            args[nargs++] = ARG_STRING;
+            break;
+        case 'p':
+            args[nargs++] = ARG_POINTER;
+            break;
+        default:
+            args[nargs++] = (longs == 0) ? ARG_INT : ((longs == 1) ? ARG_LONG : ARG_LONGLONG);
+            break;
+        }
+        p++;
+    }
+
+    // register the format
+    this->id = Trace::format(this);
+}
+
+void
+Trace::configure(Parameters& parameters, Parameter& config)
+{
+    MSP* levels = config.get_config();
+    uint32_t header[2];
+
+    // sanity check
+    if (s_file != NULL)
+    {
+        SYS_ERR("trace", "trace already configured");
+    }
+
+    // the trace file is relative to the configuration file
+    config.add_path(parameters.configpath);
+    s_file = fopen(config.c_str(), "wb");
+    if (s_file == NULL)
+    {
+        SYS_ERR("trace", "can not create trace file %s", config.c_str());
+    }
+
+    // retrieve the level of the modules
+    for (MSP::const_iterator i = levels->begin(); i != levels->end(); ++i)
+    {
+        if (i->first == "default")
+        {
+            s_default = i->second->get_int();
+        }
+        else
+        {
+            s_config[i->first] = i->second->get_int();
+        }
+    }
+
+    // apply the configuration to the modules already registered
+    for (size_t i = 0; i < s_modules.size(); i++)
+    {
+        s_level[i] = Trace::level(s_modules[i]);
+    }
+
+    // write the header
+    fwrite("SOCTRACE", 8, 1, s_file);
+    header[0] = sizeof(TraceRecord);
+    header[1] = TRACE_VERSION;
+    fwrite(header, sizeof(header), 1, s_file);
+
+    // create the ring buffer and start draining it
+    s_ring = new TraceRecord[TRACE_RING_SIZE];
+    if (pthread_create(&trace_thread, NULL, &Trace::drain, NULL) != 0)
+    {
+        SYS_ERR("trace", "can not create the trace thread");
+    }
+
+    // the records are flushed whatever the way the simulation ends
+    atexit(&Trace::close);
+
+    // the trace sites can now record
+    s_configured = true;
+}
+
+uint16_t
+Trace::module(const char* name)
+{
+    std::map<std::string, uint16_t>::const_iterator i;
+    uint16_t id;
+
+    // check if the module is already registered
+    i = s_ids.find(name);
+    if (i != s_ids.end())
+    {
+        return i->second;
+    }
+
+    // sanity check
+    if (s_modules.size() == TRACE_MAX_MODULES)
+    {
+        SYS_ERR("trace", "too many traced modules (%s)", name);
+    }
+
+    // register the module
+    id = s_modules.size();
+    s_modules.push_back(name);
+    s_ids[name] = id;
+    s_level[id] = Trace::level(name);
+
+    return id;
+}
+
+int
+Trace::level(const std::string& name)
+{
+    std::string lowercase(name);
+    std::map<std::string, int>::const_iterator level;
+    size_t pos;
+
+    // configuration names are lowercase
+    for (pos = 0; pos < lowercase.length(); pos++)
+    {
+        lowercase[pos] = tolower(lowercase[pos]);
+    }
+
+    // look for the full name, then for the last part of the name
+    level = s_config.find(lowercase);
+    if ((level == s_config.end()) && ((pos = lowercase.rfind('.')) != std::string::npos))
+    {
+        level = s_config.find(lowercase.substr(pos + 1));
+    }
+
+    return (level != s_config.end()) ? level->second : s_default;
+}
+
+uint16_t
+Trace::format(TraceSite* site)
+{
+    s_sites.push_back(site);
+    return s_sites.size() - 1;
+}
+
+void
+Trace::record(const TraceSite& site, uint16_t module, int level, ...)
+{
+    TraceRecord* record;
+    uint8_t* payload;
+    uint8_t* end;
+    va_list ap;
+
+    // the trace is not configured
+    if (s_ring == NULL)
+    {
+        return;
+    }
+
+    // wait for a free record if the ring buffer is full
+    while ((s_head - s_tail) >= TRACE_RING_SIZE)
+    {
+        sched_yield();
+    }
+
+    record = &s_ring[s_head & (TRACE_RING_SIZE - 1)];
+    record->time = sc_core::sc_time_stamp().value();
+    record->module = module;
+    record->format = site.id;
+    record->level = level;
+
+    // pack the arguments (the ones not fitting in the payload are lost)
+    payload = record->payload;
+    end = record->payload + TRACE_PAYLOAD_SIZE;
+    va_start(ap, level);
+    for (int i = 0; i < site.nargs; i++)
+    {
+        switch (site.args[i])
+        {
+        case TraceSite::ARG_INT:
+        {
+            int32_t value = va_arg(ap, int);
+            if ((payload + sizeof(value)) > end) break;
+            memcpy(payload, &value, sizeof(value));
+            payload += sizeof(value);
+            break;
+        }
+        case TraceSite::ARG_LONG:
+        case TraceSite::ARG_LONGLONG:
+        case TraceSite::ARG_POINTER:
+        {
+            int64_t value;
+            if (site.args[i] == TraceSite::ARG_LONG)
+                value = va_arg(ap, long);
+            else if (site.args[i] == TraceSite::ARG_LONGLONG)
+                value = va_arg(ap, long long);
+            else
+                value = (intptr_t)va_arg(ap, void*);
+            if ((payload + sizeof(value)) > end) break;
+            memcpy(payload, &value, sizeof(value));
+            payload += sizeof(value);
+            break;
+        }
+        case TraceSite::ARG_DOUBLE:
+        {
+            double value = va_arg(ap, double);
+            if ((payload + sizeof(value)) > end) break;
+            memcpy(payload, &value, sizeof(value));
+            payload += sizeof(value);
+            break;
+        }
+        case TraceSite::ARG_STRING:
+        {
+            const char* value = va_arg(ap, const char*);
+            size_t length = strlen(value);
+            if (payload == end) break;
+            // truncate the string to the room left
+            if (length > (size_t)(end - payload - 1))
+            {
+                length = end - payload - 1;
+            }
+            memcpy(payload, value, length);
+            payload[length] = '\0';
+            payload += length + 1;
+            break;
+        }
+        }
+    }
+    va_end(ap);
+
+    // publish the record to the background thread
+    __sync_synchronize();
+    s_head = s_head + 1;
+}
+
+void*
+Trace::drain(void* arg)
+{
+    while (true)
+    {
+        uint32_t head = s_head;
+        uint32_t tail = s_tail;
+
+        if (head == tail)
+        {
+            // check if everything was written
+            if (s_stop)
+            {
+                break;
+            }
+            usleep(1000);
+            continue;
+        }
+
+        // make sure the records are read after the head
+        __sync_synchronize();
+
+        // write the contiguous records
+        if ((head & (TRACE_RING_SIZE - 1)) <= (tail & (TRACE_RING_SIZE - 1)))
+        {
+            head = (tail | (TRACE_RING_SIZE - 1)) + 1;
+        }
+        fwrite(&s_ring[tail & (TRACE_RING_SIZE - 1)], sizeof(TraceRecord), head - tail, s_file);
+
+        // release the records
+        __sync_synchronize();
+        s_tail = head;
+    }
+    return NULL;
+}
+
+void
+Trace::close()
+{
+    TraceRecord marker;
+
+    // check if the trace is running
+    if (s_ring == NULL)
+    {
+        return;
+    }
+
+    // flush the records
+    s_configured = false;
+    s_stop = true;
+    pthread_join(trace_thread, NULL);
+    delete[] s_ring;
+    s_ring = NULL;
+
+    // mark the end of the records
+    memset(&marker, 0, sizeof(marker));
+    marker.module = TRACE_END;
+    fwrite(&marker, sizeof(marker), 1, s_file);
+
+    // write the tables
+    fprintf(s_file, "R %.0f\n", sc_core::sc_get_time_resolution().to_seconds() * 1e12);
+    for (size_t i = 0; i < s_modules.size(); i++)
+    {
+        fprintf(s_file, "M %u %s\n", (unsigned int)i, s_modules[i].c_str());
+    }
+    for (size_t i = 0; i < s_sites.size(); i++)
+    {
+        fprintf(s_file, "F %u %s:%d ", (unsigned int)i, s_sites[i]->file, s_sites[i]->line);
+        for (const char* p = s_sites[i]->format; *p != '\0'; p++)
+        {
+            if (*p == '\\')
+                fputs("\\\\", s_file);
+            else if (*p == '\n')
+                fputs("\\n", s_file);
+            else
+                fputc(*p, s_file);
+        }
+        fputc('\n', s_file);
+    }
+
+    fclose(s_file);
+    s_file = NULL;
+}
@@ -0,0 +1,258 @@
+#ifndef TRACE_H_
+#define TRACE_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <string>
+#include <vector>
+#include <map>
+
+#include "Parameters.h"
+
+/// Maximum number of modules that can be traced
+#define TRACE_MAX_MODULES 1024
+
+/// Maximum number of arguments of a trace format
+#define TRACE_MAX_ARGS 8
+
+/// Size of the arguments payload of a trace record
+#define TRACE_PAYLOAD_SIZE 48
+
+/// Number of records in the trace ring buffer (must be a power of 2)
+#define TRACE_RING_SIZE 65536
+
+/// Macro to record a trace message for a named entity
+/// @param __n name of the traced entity
+/// @param __l level of the trace message (1 and above)
+/// @param __f format of the trace message (printf like)
+/// @param ... variable arguments
+#define SYS_TRACE(__n, __l, __f, ...)                                       \
+do {                                                                        \
+    if (Trace::configured()) {                                              \
+        static TraceSite __site(__FILE__, __LINE__, __f);                   \
+        uint16_t __module = __site.module(__n);                             \
+        if (Trace::enabled(__module, __l)) {                                \
+            Trace::record(__site, __module, __l, ##__VA_ARGS__);            \
+        }                                                                   \
+    }                                                                       \
+} while (0)
+
+/// Macro to record a trace message for an already registered module
+/// @param __m identifier of the traced module (see Trace::module)
+/// @param __l level of the trace message (1 and above)
+/// @param __f format of the trace message (printf like)
+/// @param ... variable arguments
+#define SYS_TRACE_ID(__m, __l, __f, ...)                                    \
+do {                                                                        \
+    if (Trace::configured() && Trace::enabled(__m, __l)) {                  \
+        static TraceSite __site(__FILE__, __LINE__, __f);                   \
+        Trace::record(__site, __m, __l, ##__VA_ARGS__);                     \
+    }                                                                       \
+} while (0)
+
+/// Macro to record a trace message from SC modules
+/// The module must hold its trace identifier in m_trace_module (see BusSlave and BusMaster)
+/// @param __l level of the trace message (1 and above)
+/// @param __f format of the trace message (printf like)
+/// @param ... variable arguments
+#define TLM_TRACE(__l, __f, ...)                                            \
+    SYS_TRACE_ID(this->m_trace_module, __l, __f, ##__VA_ARGS__)
+
+/// Binary trace record, as written in the trace file
+struct TraceRecord
+{
+    /// Simulation time of the record in ps
+    uint64_t time;
+    /// Identifier of the traced module
+    uint16_t module;
+    /// Identifier of the trace format
+    uint16_t format;
+    /// Level of the trace message
+    uint8_t level;
+    /// Padding
+    uint8_t reserved[3];
+    /// Arguments of the format, packed in the order of the conversions
+    uint8_t payload[TRACE_PAYLOAD_SIZE];
+};
+
+/// Location of a trace message in the source code, registered on first use
+struct TraceSite
+{
+    /// Kinds of the format arguments
+    enum
+    {
+        ARG_INT,
+        ARG_LONG,
+        ARG_LONGLONG,
+        ARG_DOUBLE,
+        ARG_STRING,
+        ARG_POINTER
+    };
+
+    /** Constructor: parse the format and register it
+     * @param[in] file Source file of the trace message
+     * @param[in] line Source line of the trace message
+     * @param[in] format Format of the trace message
+     */
+    TraceSite(const char* file, int line, const char* format);
+
+    /** Get the identifier of the module recording the message
+     * @param[in] name Name of the module
+     * @return The module identifier
+     */
+    inline uint16_t
+    module(const char* name);
+
+    /// Source file of the message
+    const char* file;
+    /// Source line of the message
+    int line;
+    /// Format of the message
+    const char* format;
+    /// Identifier of the format
+    uint16_t id;
+    /// Number of arguments
+    int nargs;
+    /// Kind of each argument
+    uint8_t args[TRACE_MAX_ARGS];
+
+private:
+    /// Name of the last module that recorded the message
+    const char* m_name;
+    /// Identifier of the last module that recorded the message
+    uint16_t m_module;
+};
+
+/** Runtime trace of the simulation.
+ * The messages are recorded as binary records (time, module, format, arguments)
+ * in a ring buffer drained to the trace file by a background thread. The trace file
+ * is turned back into text with tools/trace_decode.
+ *
+ * The trace is configured from the platform configuration file:
+ * <pre>
+ * trace trace.bin
+ *     default 1
+ *     uart1 3
+ * </pre>
+ * where each sub-parameter gives the level of a module (full or last part of
+ * the name), default applying to the modules not listed.
+ */
+struct Trace
+{
+    /** Configure the trace and start the background thread
+     * @param[in] parameters Command line parameters
+     * @param[in] config Trace parameter of the configuration file
+     */
+    static void
+    configure(Parameters& parameters, Parameter& config);
+
+    /** Get the identifier of a module, registering it if needed
+     * @param[in] name Name of the module
+     * @return The module identifier
+     */
+    static uint16_t
+    module(const char* name);
+
+    /** Register the format of a trace site
+     * @param[in] site Trace site to register
+     * @return The format identifier
+     */
+    static uint16_t
+    format(TraceSite* site);
+
+    /** Check if the trace is configured
+     * @return true if the messages are recorded
+     */
+    static bool
+    configured()
+    {
+        return s_configured;
+    }
+
+    /** Check if a message must be recorded
+     * @param[in] module Module identifier
+     * @param[in] level Level of the message
+     * @return true if the module is traced at this level
+     */
+    static bool
+    enabled(uint16_t module, int level)
+    {
+        return s_level[module] >= level;
+    }
+
+    /** Record a message in the ring buffer
+     * @param[in] site Trace site of the message
+     * @param[in] module Module identifier
+     * @param[in] level Level of the message
+     * @param[in] ... Arguments of the message format
+     */
+    static void
+    record(const TraceSite& site, uint16_t module, int level, ...);
+
+    /// Flush the ring buffer, stop the background thread and close the trace file
+    static void
+    close();
+
+private:
+    /** Get the configured level of a module
+     * @param[in] name Name of the module
+     * @return The trace level of the module
+     */
+    static int
+    level(const std::string& name);
+
+    /// Background thread writing the records to the trace file
+    static void*
+    drain(void* arg);
+
+    /// Indicates that the trace is configured
+    static bool s_configured;
+
+    /// Level of each module
+    static uint8_t s_level[TRACE_MAX_MODULES];
+
+    /// Name of each module
+    static std::vector<std::string> s_modules;
+
+    /// Identifier of each module, by name
+    static std::map<std::string, uint16_t> s_ids;
+
+    /// Registered trace sites, indexed by format identifier
+    static std::vector<TraceSite*> s_sites;
+
+    /// Configured level of the modules, by name
+    static std::map<std::string, int> s_config;
+
+    /// Level of the modules not configured
+    static int s_default;
+
+    /// Trace file
+    static FILE* s_file;
+
+    /// Ring buffer
+    static TraceRecord* s_ring;
+
+    /// Number of records written in the ring buffer
+    static volatile uint32_t s_head;
+
+    /// Number of records drained from the ring buffer
+    static volatile uint32_t s_tail;
+
+    /// Indicates that the background thread must stop
+    static volatile bool s_stop;
+};
+
+uint16_t
+TraceSite::module(const char* name)
+{
+    // the name of a module does not move, so the pointer identifies it
+    if (name != m_name)
+    {
+        m_module = Trace::module(name);
+        m_name = name;
+    }
+    return m_module;
+}
+
+#endif /*TRACE_H_*/
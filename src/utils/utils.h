@@ -7,6 +7,24 @@
 // obvious inclusion
 #include "systemc"
 
+// runtime trace of the debug messages
+#include "Trace/Trace.h"
+
+// performance report
+#include "Perf/Perf.h"
+
+// timeline of the process activity
+#include "Timeline/Timeline.h"
+
+// memory access heatmap
+#include "Heatmap/Heatmap.h"
+
+// peripheral register access statistics
+#include "RegStats/RegStats.h"
+
+// stop conditions of the simulation
+#include "RunControl/RunControl.h"
+
 /// Macro to configure debug the utils tools (could be configured for a single file)
 #ifndef UTILS_DEBUG_LEVEL
     #define UTILS_DEBUG_LEVEL 0
@@ -38,6 +56,18 @@
 #define BIT_SET(__r, __p)                                                   \
     (((__r) & (1 << (__p))) != 0)
 
+/// Macro to get the position of the highest bit set in a 32-bit mask
+/// @param[in] __r register value (must not be 0)
+/// @return the position of the most significant bit set
+#define BIT_MSB(__r)                                                        \
+    (31 - __builtin_clz((uint32_t)(__r)))
+
+/// Macro to get the position of the lowest bit set in a 32-bit mask
+/// @param[in] __r register value (must not be 0)
+/// @return the position of the least significant bit set
+#define BIT_LSB(__r)                                                        \
+    (__builtin_ctz((uint32_t)(__r)))
+
 /// Macro to print error and exit
 /// @param[in] format print format
 #define TLM_ERR(format, ...)                                                \
@@ -7,12 +7,15 @@ Synopsis:
     reg_xls2h.py xlsname
           to test the validity of a register definition
 
-    reg_xls2h.py [--verbose] [--simu] [--short] [--sheet=N] xlsname prefix regaddr outfile
+    reg_xls2h.py [--verbose] [--simu [--class]] [--short] [--sheet=N] xlsname prefix regaddr outfile
           to generate the header file of a HW block
 
 where:
     --verbose to turn on verbose mode
     --simu means that the file must be generated for simulation environment
+    --class means that the simulation accessors are generated as members of a
+            register map class dispatching the accesses to the block model,
+            instead of functions working on the global register image
     --short means that the file must generate short macros (field name
             not prefixed with register name)
     --sheet=N means that the XLS file provided is in the MODEM register definition
@@ -46,11 +49,11 @@ class reg_xls2h:
     def read_xls(self):
         self.xls.extract_all()
 
-    def gen_header(self, prefix, regaddr, outfile, forsimu, longname):
+    def gen_header(self, prefix, regaddr, outfile, forsimu, longname, forclass):
         # create a header instance
         self.header = header(prefix, regaddr, outfile)
         # generate the file
-        self.header.generate(self.xls, forsimu, longname, False)
+        self.header.generate(self.xls, forsimu, longname, False, forclass)
 
 def usage():
     sys.stdout.write(usage_doc)
@@ -59,7 +62,7 @@ def usage():
 def main():
     # parse the command line
     try:
-        opts, args = getopt.getopt(sys.argv[1:], "", ["simu", "short", "verbose", "sheet="])
+        opts, args = getopt.getopt(sys.argv[1:], "", ["simu", "class", "short", "verbose", "sheet="])
     except getopt.GetoptError:
         # print help information and exit:
         usage()
@@ -68,10 +71,16 @@ def main():
     verbose = False
     sheetname = "Registers"
     forsimu = False
+    forclass = False
     longname = True
 
     if ("--simu","") in opts:
         forsimu = True
+    if ("--class","") in opts:
+        if not forsimu:
+            usage()
+            sys.exit("ERROR: --class is only valid with --simu")
+        forclass = True
     if ("--short","") in opts:
         longname = False
     if ("--verbose","") in opts:
@@ -94,7 +103,7 @@ def main():
     # check the number of parameters is correct
     if len(args) == 4:
         # generate the file only if requested
-        my_reg_xls2h.gen_header(args[1], args[2], args[3], forsimu, longname)
+        my_reg_xls2h.gen_header(args[1], args[2], args[3], forsimu, longname, forclass)
     elif len(args) != 1:
         # print help information and exit:
         usage()
@@ -6,6 +6,7 @@ from common.legalexception import *
 from reg_xls2h_xls import *
 from os.path import basename
 from os.path import splitext
+from StringIO import StringIO
 
 def translate(name):
     # by default, just uppercase
@@ -56,7 +57,144 @@ class header:
 
         self.outfile = outfile
 
-    def generate(self, xls, forsimu, longname, gendoc):
+    def gen_class(self, fout, accessors, hooks, block, fname, blockname):
+        "method to generate the register map class of the block (simulation only)"
+
+        # class name from the file name: reg_crm -> RegCrm
+        clsname = "".join(map(lambda x:x.capitalize(), fname.split("_")))
+        base = "Peripheral<%s_COUNT>"%(blockname, )
+
+        # name of each register, NULL in the holes of the register map
+        names = ["NULL"] * block.num_regs
+        for (regname, hookname, reg) in hooks:
+            for i in range(reg.max - reg.min + 1):
+                index = reg.addr/4 + i
+                if index < block.num_regs:
+                    names[index] = '"%s"'%(regname, )
+
+        fout.write("/**\n")
+        fout.write(" * @brief Register map of the %s block, to be derived by the block model\n"%(blockname, ))
+        fout.write(" *\n")
+        fout.write(" * The register accesses are dispatched at compile time to the register hooks\n")
+        fout.write(" * {regname}_rd() and {regname}_wr(value) of the model, which only redefines the\n")
+        fout.write(" * hooks of the registers having side effects.\n")
+        fout.write(" * @param MODEL Block model deriving from this class\n")
+        fout.write(" */\n")
+        fout.write("template <typename MODEL>\n")
+        fout.write("struct %s : %s\n"%(clsname, base))
+        fout.write("{\n")
+        fout.write("    /** Constructor\n")
+        fout.write("     * @param[in] name Name of the module\n")
+        fout.write("     */\n")
+        fout.write("    %s(sc_core::sc_module_name name)\n"%(clsname, ))
+        fout.write("    : %s(name)\n"%(base, ))
+        fout.write("    {\n")
+        fout.write("        this->set_reg_names(&reg_name);\n")
+        fout.write("    }\n\n")
+
+        fout.write("    /** Name of a register\n")
+        fout.write("     * @param[in] index Index of the register\n")
+        fout.write("     * @return The name of the register, NULL if there is no register at this index\n")
+        fout.write("     */\n")
+        fout.write("    static const char*\n")
+        fout.write("    reg_name(uint32_t index)\n")
+        fout.write("    {\n")
+        fout.write("        static const char* const names[%s_COUNT] =\n"%(blockname, ))
+        fout.write("        {\n")
+        for name in names:
+            fout.write("            %s,\n"%(name, ))
+        fout.write("        };\n\n")
+        fout.write("        return (index < %s_COUNT) ? names[index] : NULL;\n"%(blockname, ))
+        fout.write("    }\n\n")
+
+        # register and field accessors
+        for line in accessors.split("\n"):
+            if line:
+                fout.write("    %s\n"%(line, ))
+            else:
+                fout.write("\n")
+
+        # default register hooks: plain storage, read only registers can not be written
+        fout.write("protected:\n")
+        for (regname, hookname, reg) in hooks:
+            if reg.multi:
+                index = "%s_INDEX + idx"%(regname, )
+                param_beg = "uint32_t idx, "
+                param_one = "uint32_t idx"
+            else:
+                index = "%s_INDEX"%(regname, )
+                param_beg = ""
+                param_one = ""
+
+            fout.write("    /// %s register read hook\n"%(regname, ))
+            fout.write("    uint32_t\n")
+            fout.write("    %s_rd(%s)\n"%(hookname, param_one))
+            fout.write("    {\n")
+            fout.write("        return this->m_reg[%s];\n"%(index, ))
+            fout.write("    }\n\n")
+
+            fout.write("    /// %s register write hook\n"%(regname, ))
+            fout.write("    void\n")
+            fout.write("    %s_wr(%suint32_t value)\n"%(hookname, param_beg))
+            fout.write("    {\n")
+            if reg.sw == 'R':
+                fout.write("        TLM_ERR(\"Write to R/O register %s, data = 0x%%08X\", value);\n"%(regname, ))
+            else:
+                fout.write("        this->m_reg[%s] = value;\n"%(index, ))
+            fout.write("    }\n\n")
+
+        # dispatch of the register accesses to the hooks of the model
+        for kind in ("rd", "wr"):
+            fout.write("    /** Register %s function, dispatched to the register hooks of the model\n"%({"rd":"read", "wr":"write"}[kind], ))
+            fout.write("     * @param[in] offset Offset of the register to access\n")
+            if kind == "rd":
+                fout.write("     * @return The value read\n")
+                fout.write("     */\n")
+                fout.write("    virtual uint32_t\n")
+                fout.write("    reg_rd(uint32_t offset)\n")
+            else:
+                fout.write("     * @param[in] value Value to write in the register\n")
+                fout.write("     */\n")
+                fout.write("    virtual void\n")
+                fout.write("    reg_wr(uint32_t offset, uint32_t value)\n")
+            fout.write("    {\n")
+            fout.write("        MODEL* model = static_cast<MODEL*>(this);\n")
+            fout.write("        uint32_t index = offset/4;\n\n")
+            fout.write("        // sanity check\n")
+            fout.write("        assert(index < %s_COUNT);\n\n"%(blockname, ))
+            fout.write("        // internal delay\n")
+            fout.write("        this->delay();\n\n")
+            fout.write("        switch (index)\n")
+            fout.write("        {\n")
+            for (regname, hookname, reg) in hooks:
+                if reg.multi:
+                    fout.write(  "        case %s_INDEX ... %s_INDEX + %d:\n"
+                               % (regname, regname, reg.max - reg.min))
+                    args = "index - %s_INDEX"%(regname, )
+                else:
+                    fout.write("        case %s_INDEX:\n"%(regname, ))
+                    args = ""
+                if kind == "rd":
+                    fout.write("            return model->%s_rd(%s);\n"%(hookname, args))
+                else:
+                    if args:
+                        args += ", "
+                    fout.write("            model->%s_wr(%svalue);\n"%(hookname, args))
+                    fout.write("            break;\n")
+            fout.write("        default:\n")
+            if kind == "rd":
+                fout.write("            return this->m_reg[index];\n")
+            else:
+                fout.write("            this->m_reg[index] = value;\n")
+                fout.write("            break;\n")
+            fout.write("        }\n")
+            fout.write("    }\n")
+            if kind == "rd":
+                fout.write("\n")
+
+        fout.write("};\n")
+
+    def generate(self, xls, forsimu, longname, gendoc, forclass=False):
         "method to generate the header file"
 
         # only one block containing all the registers in the xls sheet
@@ -158,7 +296,9 @@ class header:
         fout.write("#include <stdint.h>\n")
         fout.write("#include \"compiler.h\"\n")
         fout.write("#include \"arch.h\"\n")
-        if forsimu:
+        if forclass:
+            fout.write("#include \"Generic/Peripheral/Peripheral.h\"\n")
+        elif forsimu:
             fout.write("#include \"reg_sim.h\"\n")
         fout.write("\n")
 
@@ -181,6 +321,16 @@ class header:
             fout.write(" */\n")
         fout.write("#define %s_DECODING_MASK 0x%08X\n\n"%(blockname, block.decode_mask))
 
+        # in class mode the accessors are members of the register map class,
+        # they are generated aside and the register hooks are collected
+        if forclass:
+            ffun = StringIO()
+            inline = ""
+        else:
+            ffun = fout
+            inline = "__INLINE "
+        hooks = []
+
         # loop on all the registers
         for reg in block.registers:
             # if the regname is a noregister do not put it
@@ -282,6 +432,17 @@ class header:
                 reg_wr_end = ")"
 
 
+            elif forclass:
+                # class reg read/write setup, on the register image of the instance
+                if reg.multi:
+                    reg_rd = "this->m_reg[%s_INDEX + idx]"%(regname)
+                    reg_wr_beg = "this->m_reg[%s_INDEX + idx] = "%(regname)
+                else:
+                    reg_rd = "this->m_reg[%s_INDEX]"%(regname)
+                    reg_wr_beg = "this->m_reg[%s_INDEX] = "%(regname)
+
+                reg_wr_end = ""
+
             elif not forsimu:
                 # normal reg read/write macro setup
                 if reg.multi:
@@ -308,6 +469,10 @@ class header:
                 reg_wr_end = ")"
 
 
+            # register hooks called by the generated dispatch
+            if not reg.rf:
+                hooks.append((regname, cs_regname.lower(), reg))
+
             if reg.multi:
                 func_beg = "{\n    ASSERT_ERR(idx <= %d);\n" % (reg.max)
             else:
@@ -322,29 +487,29 @@ class header:
             # REG_get function
             if reg.sw != 'W' and reg.gen_read and not reg.rf:
                 if gendoc:
-                    fout.write("/**\n")
-                    fout.write(" * @brief Returns the current value of the %s register.\n"%(regname,))
-                    fout.write(" * The %s register will be read and its value returned.\n"%(regname,))
-                    fout.write(" * @return The current value of the %s register.\n"%(regname,))
-                    fout.write(" */\n")
-                fout.write("__INLINE uint32_t %s_get(%s)\n"%(cs_regname.lower(), param_one))
-                fout.write(func_beg)
-                fout.write("    return %s;\n" % (reg_rd))
-                fout.write(func_end)
+                    ffun.write("/**\n")
+                    ffun.write(" * @brief Returns the current value of the %s register.\n"%(regname,))
+                    ffun.write(" * The %s register will be read and its value returned.\n"%(regname,))
+                    ffun.write(" * @return The current value of the %s register.\n"%(regname,))
+                    ffun.write(" */\n")
+                ffun.write(inline + "uint32_t %s_get(%s)\n"%(cs_regname.lower(), param_one))
+                ffun.write(func_beg)
+                ffun.write("    return %s;\n" % (reg_rd))
+                ffun.write(func_end)
 
             # REG_set function
             if reg.sw != 'R' or forsimu:
                 if gendoc:
-                    fout.write("/**\n")
-                    fout.write(" * @brief Sets the %s register to a value.\n"%(regname,))
-                    fout.write(" * The %s register will be written.\n"%(regname,))
-                    fout.write(" * @param value - The value to write.\n")
-                    fout.write(" */\n")
+                    ffun.write("/**\n")
+                    ffun.write(" * @brief Sets the %s register to a value.\n"%(regname,))
+                    ffun.write(" * The %s register will be written.\n"%(regname,))
+                    ffun.write(" * @param value - The value to write.\n")
+                    ffun.write(" */\n")
 
-                fout.write("__INLINE void %s_%s(%suint32_t value)\n"%(cs_regname.lower(), func_set_name, param_beg))
-                fout.write(func_beg)
-                fout.write("    %svalue%s;\n"%(reg_wr_beg, reg_wr_end))
-                fout.write(func_end)
+                ffun.write(inline + "void %s_%s(%suint32_t value)\n"%(cs_regname.lower(), func_set_name, param_beg))
+                ffun.write(func_beg)
+                ffun.write("    %svalue%s;\n"%(reg_wr_beg, reg_wr_end))
+                ffun.write(func_end)
 
             if len(reg.fields) != 0:
                 if reg.gen_field:
@@ -369,6 +534,14 @@ class header:
                         fout.write(str_def_hex % (field.h_name + "_RST", field.reset))
 
                     fout.write("\n")
+
+                    # compile time field descriptors
+                    if forclass and not reg.rf:
+                        for field in reg.fields:
+                            ffun.write(  "typedef RegField<%s_INDEX, 0x%08X, %d> %s%s_field;\n"
+                                       % (regname, field.mask, field.low_bitpos,
+                                          field_prefix.lower(), field.h_name.lower()))
+                        ffun.write("\n")
                 else:
                     fout.write("// fields defined in symmetrical set/clear register\n")
 
@@ -377,116 +550,119 @@ class header:
 
                     # REG_pack function
                     if gendoc:
-                        fout.write("/**\n")
-                        fout.write(" * @brief Constructs a value for the %s register given values for its fields\n"%(regname, ))
-                        fout.write(" * and writes the value to the register.\n")
-                        fout.write(" *\n")
+                        ffun.write("/**\n")
+                        ffun.write(" * @brief Constructs a value for the %s register given values for its fields\n"%(regname, ))
+                        ffun.write(" * and writes the value to the register.\n")
+                        ffun.write(" *\n")
                         for field in reg.writable_fields:
-                            fout.write(" * @param[in] %s - The value to use for the %s field.\n"%(field.h_param, field.name))
-                        fout.write(" */\n")
-                    fout.write("__INLINE void %s_pack(%s"%(regname.lower(),param_beg))
+                            ffun.write(" * @param[in] %s - The value to use for the %s field.\n"%(field.h_param, field.name))
+                        ffun.write(" */\n")
+                    ffun.write(inline + "void %s_pack(%s"%(regname.lower(),param_beg))
                     for field in reg.writable_fields:
-                        fout.write("%s %s"%(field.type, field.h_param))
+                        ffun.write("%s %s"%(field.type, field.h_param))
                         # check if it is the last element
                         if field == reg.writable_fields[-1]:
-                            fout.write(")\n")
+                            ffun.write(")\n")
                         else:
-                            fout.write(", ")
-                    fout.write(func_beg)
+                            ffun.write(", ")
+                    ffun.write(func_beg)
                     for field in reg.writable_fields:
-                        fout.write("    ASSERT_ERR(((%s << %d) & ~0x%08X) == 0);\n"%(field.h_param, field.low_bitpos, field.mask))
+                        ffun.write("    ASSERT_ERR(((%s << %d) & ~0x%08X) == 0);\n"%(field.h_param, field.low_bitpos, field.mask))
 
-                    fout.write("    %s"%(reg_wr_beg))
+                    ffun.write("    %s"%(reg_wr_beg))
 
                     for field in reg.writable_fields:
-                        fout.write(" (%s << %d)"%(field.h_param, field.low_bitpos))
+                        ffun.write(" (%s << %d)"%(field.h_param, field.low_bitpos))
                         # check if it is the last element
                         if field != reg.writable_fields[-1]:
-                            fout.write(" |")
+                            ffun.write(" |")
                         else:
-                            fout.write("%s;\n" % reg_wr_end)
+                            ffun.write("%s;\n" % reg_wr_end)
 
-                    fout.write(func_end)
+                    ffun.write(func_end)
 
                 # REG_unpack function
                 if reg.sw != 'W' and reg.gen_read and len(reg.fields) > 1:
                     if gendoc:
-                        fout.write("/**\n")
-                        fout.write(" * @brief Unpacks %s's fields from current value of the %s register.\n"%(regname, regname))
-                        fout.write(" *\n")
-                        fout.write(" * Reads the %s register and populates all the _field variables with the corresponding\n"%(regname,))
-                        fout.write(" * values from the register.\n")
-                        fout.write(" *\n")
+                        ffun.write("/**\n")
+                        ffun.write(" * @brief Unpacks %s's fields from current value of the %s register.\n"%(regname, regname))
+                        ffun.write(" *\n")
+                        ffun.write(" * Reads the %s register and populates all the _field variables with the corresponding\n"%(regname,))
+                        ffun.write(" * values from the register.\n")
+                        ffun.write(" *\n")
                         for field in reg.fields:
-                            fout.write(" * @param[out] %s - Will be populated with the current value of this field from the register.\n"%(field.h_param,))
-                        fout.write(" */\n")
+                            ffun.write(" * @param[out] %s - Will be populated with the current value of this field from the register.\n"%(field.h_param,))
+                        ffun.write(" */\n")
 
-                    fout.write("__INLINE void %s_unpack(%s"%(cs_regname.lower(), param_beg))
+                    ffun.write(inline + "void %s_unpack(%s"%(cs_regname.lower(), param_beg))
                     for field in reg.fields:
-                        fout.write("%s* %s"%(field.type, field.h_param))
+                        ffun.write("%s* %s"%(field.type, field.h_param))
                         # check if it is the last element
                         if reg.fields.index(field) == len(reg.fields)-1:
-                            fout.write(")\n")
+                            ffun.write(")\n")
                         else:
-                            fout.write(", ")
-                    fout.write(func_beg)
-                    fout.write("    uint32_t localVal = %s;\n"%(reg_rd))
-                    fout.write("\n")
+                            ffun.write(", ")
+                    ffun.write(func_beg)
+                    ffun.write("    uint32_t localVal = %s;\n"%(reg_rd))
+                    ffun.write("\n")
                     for field in reg.fields:
                         if len(reg.fields) == 1:
-                            fout.write("    ASSERT_ERR((localVal & ~0x%08X) == 0);\n"%(field.mask,))
-                            fout.write("    *%s = localVal >> %d;\n"%(field.h_param, field.low_bitpos))
+                            ffun.write("    ASSERT_ERR((localVal & ~0x%08X) == 0);\n"%(field.mask,))
+                            ffun.write("    *%s = localVal >> %d;\n"%(field.h_param, field.low_bitpos))
                         else:
-                            fout.write("    *%s = (localVal & 0x%08X) >> %d;\n"%(field.h_param, field.mask, field.low_bitpos))
-                    fout.write(func_end)
+                            ffun.write("    *%s = (localVal & 0x%08X) >> %d;\n"%(field.h_param, field.mask, field.low_bitpos))
+                    ffun.write(func_end)
 
             # loop on all the fields to generate the field related
             for field in reg.fields:
                 if field.sw != 'W' and reg.gen_read and not reg.rf:
                     if gendoc:
-                        fout.write("/**\n")
-                        fout.write(" * @brief Returns the current value of the %s field in the %s register.\n"%(field.name, regname))
-                        fout.write(" *\n")
-                        fout.write(" * The %s register will be read and the %s field's value will be returned.\n"%(regname, field.name))
-                        fout.write(" *\n")
-                        fout.write(" * @return The current value of the %s field in the %s register.\n"%(field.name, regname))
-                        fout.write(" */\n")
-                    fout.write("__INLINE %s %s%s_getf(%s)\n"%(field.type, field_prefix.lower(), field.h_name.lower(), param_one ))
-                    fout.write(func_beg)
-                    fout.write("    uint32_t localVal = %s;\n"%(reg_rd))
+                        ffun.write("/**\n")
+                        ffun.write(" * @brief Returns the current value of the %s field in the %s register.\n"%(field.name, regname))
+                        ffun.write(" *\n")
+                        ffun.write(" * The %s register will be read and the %s field's value will be returned.\n"%(regname, field.name))
+                        ffun.write(" *\n")
+                        ffun.write(" * @return The current value of the %s field in the %s register.\n"%(field.name, regname))
+                        ffun.write(" */\n")
+                    ffun.write(inline + "%s %s%s_getf(%s)\n"%(field.type, field_prefix.lower(), field.h_name.lower(), param_one ))
+                    ffun.write(func_beg)
+                    ffun.write("    uint32_t localVal = %s;\n"%(reg_rd))
 
                     # do not mask for single field
                     if len(reg.fields) == 1:
-                        fout.write("    ASSERT_ERR((localVal & ~0x%08X) == 0);\n"%(field.mask,))
-                        fout.write("    return (localVal >> %d);\n"%(field.low_bitpos,))
+                        ffun.write("    ASSERT_ERR((localVal & ~0x%08X) == 0);\n"%(field.mask,))
+                        ffun.write("    return (localVal >> %d);\n"%(field.low_bitpos,))
                     else:
-                        fout.write("    return ((localVal & 0x%08X) >> %d);\n"%(field.mask, field.low_bitpos))
-                    fout.write(func_end)
+                        ffun.write("    return ((localVal & 0x%08X) >> %d);\n"%(field.mask, field.low_bitpos))
+                    ffun.write(func_end)
 
 
                 # only provide set functionality to writable fields
                 if field.writable and not reg.rf:
                     if gendoc:
-                        fout.write("/**\n")
-                        fout.write(" * @brief Sets the %s field of the %s register.\n"%(field.name, regname))
-                        fout.write(" *\n")
-                        fout.write(" * The %s register will be read, modified to contain the new field value, and written.\n"%(regname, ))
-                        fout.write(" *\n")
-                        fout.write(" * @param[in] %s - The value to set the field to.\n"%(field.h_param,))
-                        fout.write(" */\n")
-                    fout.write(  "__INLINE void %s%s_%sf(%s%s %s)\n"
+                        ffun.write("/**\n")
+                        ffun.write(" * @brief Sets the %s field of the %s register.\n"%(field.name, regname))
+                        ffun.write(" *\n")
+                        ffun.write(" * The %s register will be read, modified to contain the new field value, and written.\n"%(regname, ))
+                        ffun.write(" *\n")
+                        ffun.write(" * @param[in] %s - The value to set the field to.\n"%(field.h_param,))
+                        ffun.write(" */\n")
+                    ffun.write(  inline + "void %s%s_%sf(%s%s %s)\n"
                                % (field_prefix.lower(), field.h_name.lower(), func_set_name,
                                   param_beg, field.type, field.h_param))
-                    fout.write(func_beg)
-                    fout.write("    ASSERT_ERR(((%s << %d) & ~0x%08X) == 0);\n"%(field.h_param, field.low_bitpos, field.mask))
+                    ffun.write(func_beg)
+                    ffun.write("    ASSERT_ERR(((%s << %d) & ~0x%08X) == 0);\n"%(field.h_param, field.low_bitpos, field.mask))
 
                     # generate direct accesses for set/clear registers or single writable field field
                     if (reg.sw in ('S', 'C')) or (len(reg.writable_fields) == 1):
-                        fout.write("    %s%s << %d%s;\n"%(reg_wr_beg, field.h_param, field.low_bitpos, reg_wr_end))
+                        ffun.write("    %s%s << %d%s;\n"%(reg_wr_beg, field.h_param, field.low_bitpos, reg_wr_end))
                     else:
-                        fout.write(  "    %s(%s & ~0x%08X) | (%s << %d)%s;\n"
+                        ffun.write(  "    %s(%s & ~0x%08X) | (%s << %d)%s;\n"
                                    % (reg_wr_beg, reg_rd, field.mask, field.h_param, field.low_bitpos, reg_wr_end))
-                    fout.write(func_end)
+                    ffun.write(func_end)
+
+        if forclass:
+            self.gen_class(fout, ffun.getvalue(), hooks, block, fname, blockname)
 
         fout.write("\n#endif // %s\n\n"%define)
 
@@ -0,0 +1,159 @@
+########################################################################################
+# Tool to decode the binary runtime trace of the simulator into text
+########################################################################################
+
+usage_doc = """
+Synopsis:
+    trace_decode.py [--module=NAME] [--level=N] tracefile
+
+where:
+    --module=NAME only prints the messages of the modules whose name ends with NAME
+    --level=N only prints the messages of level N and below
+    "tracefile" designates the trace file written by the simulator
+"""
+
+import sys, re, struct, getopt
+
+# conversion specification of a printf format
+conversion = re.compile(r"%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d+))?(hh|h|ll|l|L|q|j|z|t)?([diouxXeEfFgGaAcsp%])")
+
+# module identifier marking the end of the records
+TRACE_END = 0xFFFF
+
+# record header: time, module, format, level, padding
+header_fmt = "<QHHB3x"
+header_size = struct.calcsize(header_fmt)
+
+
+class trace:
+    "class of a trace file"
+    def __init__(self, tracename):
+        "constructor: read the records and the tables"
+        data = open(tracename, "rb").read()
+
+        if data[0:8] != b"SOCTRACE":
+            raise Exception("ERROR: %s is not a trace file" % tracename)
+        (self.recsize, version) = struct.unpack("<II", data[8:16])
+        if version != 1:
+            raise Exception("ERROR: unsupported trace version %d" % version)
+
+        # records until the end marker
+        self.records = []
+        pos = 16
+        while pos + self.recsize <= len(data):
+            record = data[pos:pos + self.recsize]
+            pos += self.recsize
+            (time, module, fmt, level) = struct.unpack(header_fmt, record[0:header_size])
+            if module == TRACE_END:
+                break
+            self.records.append((time, module, fmt, level, record[header_size:]))
+
+        # tables
+        self.resolution = 1
+        self.modules = {}
+        self.formats = {}
+        for line in data[pos:].decode("latin-1").split("\n"):
+            if line.startswith("R "):
+                self.resolution = int(line[2:])
+            elif line.startswith("M "):
+                (ident, name) = line[2:].split(" ", 1)
+                self.modules[int(ident)] = name
+            elif line.startswith("F "):
+                (ident, location, fmt) = line[2:].split(" ", 2)
+                fmt = re.sub(r"\\(.)", lambda m: {"n": "\n"}.get(m.group(1), m.group(1)), fmt)
+                self.formats[int(ident)] = (location, fmt)
+
+    def format(self, fmt, payload):
+        "method to rebuild the text of a message from its format and packed arguments"
+        state = {"pos": 0}
+
+        def take(size, kind):
+            pos = state["pos"]
+            if pos + size > len(payload):
+                return 0
+            state["pos"] = pos + size
+            return struct.unpack("<" + kind, payload[pos:pos + size])[0]
+
+        def convert(m):
+            (flags, width, precision, length, conv) = m.groups()
+            if conv == "%":
+                return "%"
+            if width == "*":
+                width = str(take(4, "i"))
+            if precision == "*":
+                precision = str(take(4, "i"))
+            spec = "%" + flags + (width or "") + ("." + precision if precision else "")
+
+            if conv in "eEfFgGaA":
+                value = take(8, "d")
+                if conv in "aA":
+                    conv = "g"
+            elif conv == "s":
+                pos = state["pos"]
+                end = payload.find(b"\0", pos)
+                if end < 0:
+                    end = len(payload)
+                value = payload[pos:end].decode("latin-1")
+                state["pos"] = end + 1
+            elif conv == "p":
+                value = take(8, "q") & 0xFFFFFFFFFFFFFFFF
+                spec = "%#" + (width or "") + "x"
+                conv = ""
+            elif length in ("l", "ll", "L", "q", "j", "z", "t"):
+                value = take(8, "q")
+                if conv in "ouxX":
+                    value &= 0xFFFFFFFFFFFFFFFF
+            else:
+                value = take(4, "i")
+                if conv in "ouxX":
+                    value &= 0xFFFFFFFF
+                if conv == "u":
+                    conv = "d"
+            if conv == "u":
+                conv = "d"
+            return (spec + conv) % value
+
+        return conversion.sub(convert, fmt)
+
+    def dump(self, fout, module=None, level=None):
+        "method to print the messages"
+        for (time, ident, fmt, lvl, payload) in self.records:
+            name = self.modules.get(ident, "module%d" % ident)
+            if module is not None and not name.endswith(module):
+                continue
+            if level is not None and lvl > level:
+                continue
+            (location, text) = self.formats.get(fmt, ("?", "unknown format %d" % fmt))
+            ns = float(time * self.resolution) / 1000
+            fout.write("%s: %s at %s ns\n" % (name, self.format(text, payload), ("%f" % ns).rstrip("0").rstrip(".")))
+
+
+def usage():
+    sys.stdout.write(usage_doc)
+
+
+def main():
+    # parse the command line
+    try:
+        opts, args = getopt.getopt(sys.argv[1:], "", ["module=", "level="])
+    except getopt.GetoptError:
+        usage()
+        sys.exit(2)
+
+    module = None
+    level = None
+    for opt in opts:
+        if opt[0] == "--module":
+            module = opt[1]
+        elif opt[0] == "--level":
+            level = int(opt[1])
+
+    if len(args) != 1:
+        usage()
+        sys.exit("ERROR: unexpected number of parameters")
+
+    trace(args[0]).dump(sys.stdout, module, level)
+
+
+if __name__ == "__main__":
+    main()